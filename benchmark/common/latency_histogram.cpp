@@ -0,0 +1,103 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace infinity {
+
+LatencyHistogram::LatencyHistogram(uint32_t sub_bucket_bits) : sub_bucket_bits_(std::clamp(sub_bucket_bits, 2u, 16u)) {
+    // the exact buckets, then half of them for each of the power of two ranges above
+    size_t exact_count = size_t(1) << sub_bucket_bits_;
+    counts_.resize(exact_count + (64 - sub_bucket_bits_) * (exact_count / 2));
+}
+
+void LatencyHistogram::Record(uint64_t value) {
+    ++counts_[IndexOf(value)];
+    ++count_;
+    sum_ += value;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram &other) {
+    if (other.sub_bucket_bits_ != sub_bucket_bits_) {
+        // different layouts, fall back to the highest value of each bucket
+        for (size_t i = 0; i < other.counts_.size(); ++i) {
+            for (uint64_t j = 0; j < other.counts_[i]; ++j) {
+                Record(other.HighestOf(i));
+            }
+        }
+        return;
+    }
+    for (size_t i = 0; i < counts_.size(); ++i) {
+        counts_[i] += other.counts_[i];
+    }
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+void LatencyHistogram::Reset() {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    count_ = 0;
+    sum_ = 0;
+    min_ = UINT64_MAX;
+    max_ = 0;
+}
+
+uint64_t LatencyHistogram::ValueAtPercentile(double percentile) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * count_)));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts_.size(); ++i) {
+        seen += counts_[i];
+        if (seen >= target) {
+            return std::min(HighestOf(i), max_);
+        }
+    }
+    return max_;
+}
+
+size_t LatencyHistogram::IndexOf(uint64_t value) const {
+    uint64_t exact_count = uint64_t(1) << sub_bucket_bits_;
+    if (value < exact_count) {
+        return value;
+    }
+    // value >> shift is in [exact_count / 2, exact_count)
+    uint32_t shift = std::bit_width(value) - sub_bucket_bits_;
+    uint64_t half_count = exact_count / 2;
+    return exact_count + (shift - 1) * half_count + ((value >> shift) - half_count);
+}
+
+uint64_t LatencyHistogram::HighestOf(size_t index) const {
+    uint64_t exact_count = uint64_t(1) << sub_bucket_bits_;
+    if (index < exact_count) {
+        return index;
+    }
+    uint64_t half_count = exact_count / 2;
+    uint64_t k = index - exact_count;
+    uint32_t shift = k / half_count + 1;
+    uint64_t top = k % half_count + half_count;
+    return (top << shift) + ((uint64_t(1) << shift) - 1);
+}
+
+} // namespace infinity
@@ -0,0 +1,60 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace infinity {
+
+// A latency histogram in the way of HdrHistogram. The values below 2^sub_bucket_bits are counted exactly, and every
+// power of two range above is split into 2^(sub_bucket_bits - 1) linear buckets, so a percentile is reported within a
+// relative error of 2^(1 - sub_bucket_bits) at any magnitude, in a fixed number of counters. Not thread safe, each
+// thread records into its own histogram, and they are merged at the end.
+class LatencyHistogram {
+public:
+    explicit LatencyHistogram(uint32_t sub_bucket_bits = 8);
+
+    void Record(uint64_t value);
+
+    void Merge(const LatencyHistogram &other);
+
+    void Reset();
+
+    // the highest value of the bucket where the given percent of the values are at or below, 0 when empty
+    [[nodiscard]] uint64_t ValueAtPercentile(double percentile) const;
+
+    [[nodiscard]] uint64_t count() const { return count_; }
+
+    [[nodiscard]] uint64_t min() const { return count_ == 0 ? 0 : min_; }
+
+    [[nodiscard]] uint64_t max() const { return max_; }
+
+    [[nodiscard]] double mean() const { return count_ == 0 ? 0 : static_cast<double>(sum_) / count_; }
+
+private:
+    [[nodiscard]] size_t IndexOf(uint64_t value) const;
+
+    [[nodiscard]] uint64_t HighestOf(size_t index) const;
+
+    uint32_t sub_bucket_bits_{};
+    std::vector<uint64_t> counts_;
+    uint64_t count_{0};
+    uint64_t sum_{0};
+    uint64_t min_{UINT64_MAX};
+    uint64_t max_{0};
+};
+
+} // namespace infinity
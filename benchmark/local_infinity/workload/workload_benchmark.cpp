@@ -0,0 +1,580 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "latency_histogram.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+import stl;
+import third_party;
+import profiler;
+import infinity;
+
+import internal_types;
+import logical_type;
+import embedding_info;
+import create_index_info;
+import column_def;
+import data_type;
+import query_options;
+import query_result;
+import extra_ddl_info;
+import statement_common;
+import parsed_expr;
+import constant_expr;
+import column_expr;
+import function_expr;
+import knn_expr;
+import match_expr;
+import fusion_expr;
+import search_expr;
+import search_options;
+import logger;
+
+using namespace infinity;
+
+// A workload runs a pool of client threads for a fixed time against one table with a vector column and a full-text
+// column. Each operation of a thread is an insert batch with the probability of 1 - read_ratio, otherwise a query of
+// the kind drawn from the knn / match / hybrid weights. The rows and the queries are synthetic and seeded, so the same
+// workload gives the same stream of operations on any machine without a dataset.
+struct Workload {
+    String name_;
+    SizeT threads_ = 8;
+    SizeT duration_s_ = 60;
+    SizeT warmup_s_ = 5;
+    f64 read_ratio_ = 0.8;
+    SizeT initial_rows_ = 100'000;
+    SizeT insert_batch_ = 100;
+    SizeT dimension_ = 128;
+    SizeT vocabulary_ = 20'000;
+    SizeT words_per_row_ = 24;
+    SizeT topn_ = 10;
+    SizeT ef_ = 100;
+    f64 knn_weight_ = 1;
+    f64 match_weight_ = 1;
+    f64 hybrid_weight_ = 2;
+    // the fraction of the rows a query is filtered to, 1 means no filter
+    f64 filter_selectivity_ = 1;
+    u64 seed_ = 42;
+
+    nlohmann::json ToJson() const {
+        nlohmann::json res;
+        res["name"] = name_;
+        res["threads"] = threads_;
+        res["duration_s"] = duration_s_;
+        res["warmup_s"] = warmup_s_;
+        res["read_ratio"] = read_ratio_;
+        res["initial_rows"] = initial_rows_;
+        res["insert_batch"] = insert_batch_;
+        res["dimension"] = dimension_;
+        res["vocabulary"] = vocabulary_;
+        res["words_per_row"] = words_per_row_;
+        res["topn"] = topn_;
+        res["ef"] = ef_;
+        res["knn_weight"] = knn_weight_;
+        res["match_weight"] = match_weight_;
+        res["hybrid_weight"] = hybrid_weight_;
+        res["filter_selectivity"] = filter_selectivity_;
+        res["seed"] = seed_;
+        return res;
+    }
+
+    // the fields present in the json override the current values
+    void FromJson(const nlohmann::json &json) {
+        auto read = [&](const char *key, auto &value) {
+            if (json.contains(key)) {
+                json[key].get_to(value);
+            }
+        };
+        read("name", name_);
+        read("threads", threads_);
+        read("duration_s", duration_s_);
+        read("warmup_s", warmup_s_);
+        read("read_ratio", read_ratio_);
+        read("initial_rows", initial_rows_);
+        read("insert_batch", insert_batch_);
+        read("dimension", dimension_);
+        read("vocabulary", vocabulary_);
+        read("words_per_row", words_per_row_);
+        read("topn", topn_);
+        read("ef", ef_);
+        read("knn_weight", knn_weight_);
+        read("match_weight", match_weight_);
+        read("hybrid_weight", hybrid_weight_);
+        read("filter_selectivity", filter_selectivity_);
+        read("seed", seed_);
+    }
+};
+
+Map<String, Workload> BuiltinWorkloads() {
+    Map<String, Workload> res;
+    {
+        Workload w;
+        w.name_ = "ingest";
+        w.read_ratio_ = 0;
+        w.initial_rows_ = 0;
+        w.insert_batch_ = 500;
+        res.emplace(w.name_, w);
+    }
+    {
+        Workload w;
+        w.name_ = "hybrid";
+        w.read_ratio_ = 1;
+        res.emplace(w.name_, w);
+    }
+    {
+        Workload w;
+        w.name_ = "mixed";
+        w.read_ratio_ = 0.8;
+        res.emplace(w.name_, w);
+    }
+    {
+        Workload w;
+        w.name_ = "filtered";
+        w.read_ratio_ = 0.95;
+        w.filter_selectivity_ = 0.1;
+        res.emplace(w.name_, w);
+    }
+    return res;
+}
+
+enum class OpType : u8 { kInsert = 0, kKnn, kMatch, kHybrid, kCount };
+
+const char *OpTypeToString(OpType op) {
+    switch (op) {
+        case OpType::kInsert:
+            return "insert";
+        case OpType::kKnn:
+            return "knn";
+        case OpType::kMatch:
+            return "match";
+        case OpType::kHybrid:
+            return "hybrid";
+        default:
+            return "invalid";
+    }
+}
+
+constexpr SizeT kOpTypeCount = static_cast<SizeT>(OpType::kCount);
+
+// per thread state, merged after the run
+struct WorkerStats {
+    Vector<LatencyHistogram> latency_ = Vector<LatencyHistogram>(kOpTypeCount);
+    Vector<SizeT> errors_ = Vector<SizeT>(kOpTypeCount, 0);
+    SizeT inserted_rows_ = 0;
+};
+
+class DataGenerator {
+public:
+    DataGenerator(const Workload &workload, u64 seed)
+        : workload_(workload), rng_(seed), word_dist_(MakeZipfWeights(workload.vocabulary_)), norm_dist_(0, 1) {}
+
+    String Text() {
+        String res;
+        for (SizeT i = 0; i < workload_.words_per_row_; ++i) {
+            if (i > 0) {
+                res += ' ';
+            }
+            res += Word();
+        }
+        return res;
+    }
+
+    // two words drawn by the same zipf distribution as the rows, so the frequent terms are queried the most
+    String QueryText() { return Word() + " " + Word(); }
+
+    void Embedding(f32 *dest) {
+        for (SizeT i = 0; i < workload_.dimension_; ++i) {
+            dest[i] = norm_dist_(rng_);
+        }
+    }
+
+    f64 Uniform() { return std::uniform_real_distribution<f64>(0, 1)(rng_); }
+
+private:
+    static std::discrete_distribution<SizeT> MakeZipfWeights(SizeT vocabulary) {
+        std::vector<f64> weights(vocabulary);
+        for (SizeT i = 0; i < vocabulary; ++i) {
+            weights[i] = 1.0 / (i + 1);
+        }
+        return std::discrete_distribution<SizeT>(weights.begin(), weights.end());
+    }
+
+    String Word() { return fmt::format("w{}", word_dist_(rng_)); }
+
+    const Workload &workload_;
+    std::mt19937_64 rng_;
+    std::discrete_distribution<SizeT> word_dist_;
+    std::normal_distribution<f32> norm_dist_;
+};
+
+const String kDbName = "default_db";
+const String kTableName = "workload_benchmark";
+
+SharedPtr<Infinity> CreateTable(const String &data_path, const Workload &workload) {
+    Vector<ColumnDef *> column_defs;
+    {
+        auto col_type = MakeShared<DataType>(LogicalType::kBigInt);
+        column_defs.push_back(new ColumnDef(0, col_type, "id", std::set<ConstraintType>()));
+    }
+    {
+        auto col_type = MakeShared<DataType>(LogicalType::kVarchar);
+        column_defs.push_back(new ColumnDef(1, col_type, "body", std::set<ConstraintType>()));
+    }
+    {
+        auto embedding_info = MakeShared<EmbeddingInfo>(EmbeddingDataType::kElemFloat, workload.dimension_);
+        auto col_type = MakeShared<DataType>(LogicalType::kEmbedding, embedding_info);
+        column_defs.push_back(new ColumnDef(2, col_type, "vec", std::set<ConstraintType>()));
+    }
+
+    Infinity::LocalInit(data_path);
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+
+    DropTableOptions drop_tb_options;
+    drop_tb_options.conflict_type_ = ConflictType::kIgnore;
+    infinity->DropTable(kDbName, kTableName, std::move(drop_tb_options));
+
+    CreateTableOptions create_tb_options;
+    create_tb_options.conflict_type_ = ConflictType::kIgnore;
+    infinity->CreateTable(kDbName, kTableName, std::move(column_defs), Vector<TableConstraint *>{}, std::move(create_tb_options));
+
+    // NOTE: ~CreateStatement() deletes index_info_list, index_info and index_param_list_
+    {
+        auto index_info_list = new Vector<IndexInfo *>();
+        auto index_info = new IndexInfo();
+        index_info->index_type_ = IndexType::kFullText;
+        index_info->column_name_ = "body";
+        index_info->index_param_list_ = new Vector<InitParameter *>();
+        index_info_list->push_back(index_info);
+        auto result = infinity->CreateIndex(kDbName, kTableName, "body_index", index_info_list, CreateIndexOptions());
+        if (!result.IsOk()) {
+            LOG_ERROR(fmt::format("Fail to create full-text index: {}", result.ToString()));
+        }
+    }
+    {
+        auto index_info_list = new Vector<IndexInfo *>();
+        auto index_info = new IndexInfo();
+        index_info->index_type_ = IndexType::kHnsw;
+        index_info->column_name_ = "vec";
+        index_info->index_param_list_ = new Vector<InitParameter *>();
+        index_info->index_param_list_->emplace_back(new InitParameter("M", "16"));
+        index_info->index_param_list_->emplace_back(new InitParameter("ef_construction", "200"));
+        index_info->index_param_list_->emplace_back(new InitParameter("metric", "l2"));
+        index_info->index_param_list_->emplace_back(new InitParameter("encode", "plain"));
+        index_info_list->push_back(index_info);
+        auto result = infinity->CreateIndex(kDbName, kTableName, "vec_index", index_info_list, CreateIndexOptions());
+        if (!result.IsOk()) {
+            LOG_ERROR(fmt::format("Fail to create hnsw index: {}", result.ToString()));
+        }
+    }
+    return infinity;
+}
+
+bool InsertBatch(Infinity *infinity, DataGenerator &gen, const Workload &workload, i64 first_id, SizeT row_count) {
+    auto *columns = new Vector<String>{"id", "body", "vec"};
+    auto *values = new Vector<Vector<ParsedExpr *> *>();
+    values->reserve(row_count);
+    std::vector<f32> embedding(workload.dimension_);
+    for (SizeT i = 0; i < row_count; ++i) {
+        auto *value_list = new Vector<ParsedExpr *>(columns->size());
+
+        auto *id_expr = new ConstantExpr(LiteralType::kInteger);
+        id_expr->integer_value_ = first_id + i;
+        value_list->at(0) = id_expr;
+
+        String text = gen.Text();
+        auto *text_expr = new ConstantExpr(LiteralType::kString);
+        text_expr->str_value_ = (char *)malloc(text.size() + 1);
+        std::memcpy(text_expr->str_value_, text.c_str(), text.size() + 1);
+        value_list->at(1) = text_expr;
+
+        gen.Embedding(embedding.data());
+        auto *vec_expr = new ConstantExpr(LiteralType::kDoubleArray);
+        vec_expr->double_array_.assign(embedding.begin(), embedding.end());
+        value_list->at(2) = vec_expr;
+
+        values->push_back(value_list);
+    }
+    // NOTE: ~InsertStatement() deletes or frees columns, values, value_list, the exprs and str_value_
+    return infinity->Insert(kDbName, kTableName, columns, values).IsOk();
+}
+
+KnnExpr *MakeKnnExpr(DataGenerator &gen, const Workload &workload) {
+    auto *knn_expr = new KnnExpr();
+    knn_expr->dimension_ = workload.dimension_;
+    knn_expr->distance_type_ = KnnDistanceType::kL2;
+    knn_expr->topn_ = workload.topn_;
+    knn_expr->opt_params_ = new std::vector<InitParameter *>();
+    knn_expr->opt_params_->push_back(new InitParameter("ef", std::to_string(workload.ef_)));
+    knn_expr->embedding_data_type_ = EmbeddingDataType::kElemFloat;
+    auto *embedding_data_ptr = new f32[workload.dimension_];
+    gen.Embedding(embedding_data_ptr);
+    knn_expr->embedding_data_ptr_ = embedding_data_ptr;
+    auto *column_expr = new ColumnExpr();
+    column_expr->names_.emplace_back("vec");
+    knn_expr->column_expr_ = column_expr;
+    return knn_expr;
+}
+
+MatchExpr *MakeMatchExpr(DataGenerator &gen, const Workload &workload) {
+    auto *match_expr = new MatchExpr();
+    match_expr->fields_ = "body";
+    match_expr->matching_text_ = gen.QueryText();
+    match_expr->options_text_ = fmt::format("topn={}", workload.topn_);
+    return match_expr;
+}
+
+// id < max_id * selectivity, nullptr when the workload is not filtered
+ParsedExpr *MakeFilterExpr(const Workload &workload, i64 max_id) {
+    if (workload.filter_selectivity_ >= 1) {
+        return nullptr;
+    }
+    auto *column_expr = new ColumnExpr();
+    column_expr->names_.emplace_back("id");
+    auto *value_expr = new ConstantExpr(LiteralType::kInteger);
+    value_expr->integer_value_ = static_cast<i64>(max_id * workload.filter_selectivity_);
+    auto *filter_expr = new FunctionExpr();
+    filter_expr->func_name_ = "<";
+    filter_expr->arguments_ = new std::vector<ParsedExpr *>{column_expr, value_expr};
+    return filter_expr;
+}
+
+bool Query(Infinity *infinity, DataGenerator &gen, const Workload &workload, OpType op, i64 max_id) {
+    auto *exprs = new std::vector<ParsedExpr *>();
+    if (op == OpType::kKnn || op == OpType::kHybrid) {
+        exprs->push_back(MakeKnnExpr(gen, workload));
+    }
+    if (op == OpType::kMatch || op == OpType::kHybrid) {
+        exprs->push_back(MakeMatchExpr(gen, workload));
+    }
+    if (op == OpType::kHybrid) {
+        auto *fusion_expr = new FusionExpr();
+        fusion_expr->method_ = "rrf";
+        fusion_expr->options_ = MakeShared<SearchOptions>(fmt::format("topn={}", workload.topn_));
+        exprs->push_back(fusion_expr);
+    }
+    auto *search_expr = new SearchExpr();
+    search_expr->SetExprs(exprs);
+
+    auto *output_columns = new std::vector<ParsedExpr *>();
+    auto *select_rowid_expr = new FunctionExpr();
+    select_rowid_expr->func_name_ = "row_id";
+    output_columns->push_back(select_rowid_expr);
+    return infinity->Search(kDbName, kTableName, search_expr, MakeFilterExpr(workload, max_id), output_columns).IsOk();
+}
+
+void Preload(Infinity *infinity, const Workload &workload, Atomic<i64> &next_id) {
+    if (workload.initial_rows_ == 0) {
+        return;
+    }
+    BaseProfiler profiler;
+    profiler.Begin();
+    DataGenerator gen(workload, workload.seed_);
+    constexpr SizeT preload_batch = 1000;
+    for (SizeT loaded = 0; loaded < workload.initial_rows_; loaded += preload_batch) {
+        SizeT row_count = std::min(preload_batch, workload.initial_rows_ - loaded);
+        InsertBatch(infinity, gen, workload, next_id.fetch_add(row_count), row_count);
+    }
+    infinity->Flush();
+    LOG_INFO(fmt::format("Preload {} rows cost: {}", workload.initial_rows_, profiler.ElapsedToString()));
+    profiler.End();
+}
+
+void RunWorker(SizeT thread_id, const Workload &workload, Atomic<i64> &next_id, Atomic<bool> &recording, Atomic<bool> &stop, WorkerStats &stats) {
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    DataGenerator gen(workload, workload.seed_ + 1 + thread_id);
+    std::discrete_distribution<SizeT> query_dist({workload.knn_weight_, workload.match_weight_, workload.hybrid_weight_});
+    std::mt19937_64 query_rng(workload.seed_ ^ (thread_id + 1));
+
+    while (!stop.load(std::memory_order_relaxed)) {
+        OpType op = OpType::kInsert;
+        if (gen.Uniform() < workload.read_ratio_) {
+            op = static_cast<OpType>(static_cast<SizeT>(OpType::kKnn) + query_dist(query_rng));
+        }
+        auto begin = std::chrono::steady_clock::now();
+        bool ok = false;
+        if (op == OpType::kInsert) {
+            ok = InsertBatch(infinity.get(), gen, workload, next_id.fetch_add(workload.insert_batch_), workload.insert_batch_);
+        } else {
+            ok = Query(infinity.get(), gen, workload, op, next_id.load(std::memory_order_relaxed));
+        }
+        auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+        if (!recording.load(std::memory_order_relaxed)) {
+            continue;
+        }
+        SizeT op_idx = static_cast<SizeT>(op);
+        if (!ok) {
+            ++stats.errors_[op_idx];
+            continue;
+        }
+        stats.latency_[op_idx].Record(elapsed_ns);
+        if (op == OpType::kInsert) {
+            stats.inserted_rows_ += workload.insert_batch_;
+        }
+    }
+}
+
+nlohmann::json Run(const Workload &workload, const String &data_path) {
+    SharedPtr<Infinity> infinity = CreateTable(data_path, workload);
+    Atomic<i64> next_id{0};
+    Preload(infinity.get(), workload, next_id);
+
+    Atomic<bool> recording{false};
+    Atomic<bool> stop{false};
+    Vector<WorkerStats> stats(workload.threads_);
+    Vector<std::thread> threads;
+    threads.reserve(workload.threads_);
+    for (SizeT i = 0; i < workload.threads_; ++i) {
+        threads.emplace_back([&, i] { RunWorker(i, workload, next_id, recording, stop, stats[i]); });
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(workload.warmup_s_));
+    recording.store(true);
+    auto begin = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::seconds(workload.duration_s_));
+    recording.store(false);
+    f64 elapsed_s = std::chrono::duration<f64>(std::chrono::steady_clock::now() - begin).count();
+    stop.store(true);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    WorkerStats total;
+    for (const auto &s : stats) {
+        for (SizeT i = 0; i < kOpTypeCount; ++i) {
+            total.latency_[i].Merge(s.latency_[i]);
+            total.errors_[i] += s.errors_[i];
+        }
+        total.inserted_rows_ += s.inserted_rows_;
+    }
+
+    nlohmann::json report;
+    report["workload"] = workload.ToJson();
+    report["elapsed_s"] = elapsed_s;
+    report["inserted_rows_per_s"] = total.inserted_rows_ / elapsed_s;
+    SizeT total_ops = 0;
+    for (SizeT i = 0; i < kOpTypeCount; ++i) {
+        const auto &h = total.latency_[i];
+        total_ops += h.count();
+        if (h.count() == 0 && total.errors_[i] == 0) {
+            continue;
+        }
+        nlohmann::json op_json;
+        op_json["count"] = h.count();
+        op_json["errors"] = total.errors_[i];
+        op_json["ops_per_s"] = h.count() / elapsed_s;
+        op_json["min_ms"] = h.min() / 1e6;
+        op_json["mean_ms"] = h.mean() / 1e6;
+        op_json["p50_ms"] = h.ValueAtPercentile(50) / 1e6;
+        op_json["p90_ms"] = h.ValueAtPercentile(90) / 1e6;
+        op_json["p99_ms"] = h.ValueAtPercentile(99) / 1e6;
+        op_json["p999_ms"] = h.ValueAtPercentile(99.9) / 1e6;
+        op_json["max_ms"] = h.max() / 1e6;
+        report["ops"][OpTypeToString(static_cast<OpType>(i))] = op_json;
+    }
+    report["ops_per_s"] = total_ops / elapsed_s;
+
+    infinity->LocalDisconnect();
+    Infinity::LocalUnInit();
+    return report;
+}
+
+int main(int argc, char *argv[]) {
+    CLI::App app{"workload_benchmark"};
+    auto workloads = BuiltinWorkloads();
+    String workload_name = "mixed";
+    String workload_file;
+    String data_path = "/var/infinity";
+    String output_path;
+    Workload overrides;
+    app.add_option("--workload", workload_name, "Built-in workload, one of ingest, hybrid, mixed, filtered, default mixed");
+    app.add_option("--workload-file", workload_file, "JSON file of workload fields overriding the built-in workload");
+    app.add_option("--threads", overrides.threads_, "Number of client threads");
+    app.add_option("--duration", overrides.duration_s_, "Measured seconds, after the warmup");
+    app.add_option("--warmup", overrides.warmup_s_, "Warmup seconds, not recorded");
+    app.add_option("--read-ratio", overrides.read_ratio_, "Fraction of the operations that are queries, in [0, 1]")->check(CLI::Range(0.0, 1.0));
+    app.add_option("--initial-rows", overrides.initial_rows_, "Rows loaded before the run");
+    app.add_option("--insert-batch", overrides.insert_batch_, "Rows of each insert operation");
+    app.add_option("--dimension", overrides.dimension_, "Dimension of the vector column");
+    app.add_option("--topn", overrides.topn_, "Top n of each query");
+    app.add_option("--data-path", data_path, "Data path of the local infinity, default /var/infinity");
+    app.add_option("--output", output_path, "Write the JSON report to the file instead of stdout");
+    try {
+        app.parse(argc, argv);
+    } catch (const CLI::ParseError &e) {
+        return app.exit(e);
+    }
+
+    auto iter = workloads.find(workload_name);
+    if (iter == workloads.end()) {
+        std::cerr << "Unknown workload: " << workload_name << std::endl;
+        return -1;
+    }
+    Workload workload = iter->second;
+    if (!workload_file.empty()) {
+        std::ifstream input(workload_file);
+        if (!input.is_open()) {
+            std::cerr << "Failed to open workload file: " << workload_file << std::endl;
+            return -1;
+        }
+        workload.FromJson(nlohmann::json::parse(input));
+    }
+    // the command line options come last, only the ones given
+    nlohmann::json given;
+    for (const auto *option : app.get_options()) {
+        if (option->count() == 0) {
+            continue;
+        }
+        const auto &name = option->get_name();
+        if (name == "--threads") {
+            given["threads"] = overrides.threads_;
+        } else if (name == "--duration") {
+            given["duration_s"] = overrides.duration_s_;
+        } else if (name == "--warmup") {
+            given["warmup_s"] = overrides.warmup_s_;
+        } else if (name == "--read-ratio") {
+            given["read_ratio"] = overrides.read_ratio_;
+        } else if (name == "--initial-rows") {
+            given["initial_rows"] = overrides.initial_rows_;
+        } else if (name == "--insert-batch") {
+            given["insert_batch"] = overrides.insert_batch_;
+        } else if (name == "--dimension") {
+            given["dimension"] = overrides.dimension_;
+        } else if (name == "--topn") {
+            given["topn"] = overrides.topn_;
+        }
+    }
+    workload.FromJson(given);
+    if (workload.threads_ == 0 || workload.insert_batch_ == 0 || workload.dimension_ == 0 || workload.vocabulary_ == 0) {
+        std::cerr << "threads, insert_batch, dimension and vocabulary must be positive" << std::endl;
+        return -1;
+    }
+
+    std::cout << ">>> Workload Benchmark: " << workload.ToJson().dump() << std::endl;
+    nlohmann::json report = Run(workload, data_path);
+    if (output_path.empty()) {
+        std::cout << report.dump(4) << std::endl;
+    } else {
+        std::ofstream output(output_path);
+        output << report.dump(4) << std::endl;
+        std::cout << "Report written to " << output_path << std::endl;
+    }
+    return 0;
+}
@@ -46,6 +46,14 @@ public:
         return AnalyzeImpl(input, &array, &Analyzer::AppendTermList);
     }
 
+    /// Same terms as Analyze, but each one is passed to on_term(const char *text, u32 len, u32 offset) instead of being
+    /// put into a TermList. The text is only valid during the call, the caller copies it where it keeps the terms.
+    template <typename OnTerm>
+    int AnalyzeTerms(const Term &input, OnTerm &on_term) {
+        TermForwarder<OnTerm> forwarder{this, on_term};
+        return AnalyzeImpl(input, &forwarder, &Analyzer::ForwardTerm<OnTerm>);
+    }
+
 protected:
     typedef void (
         *HookType)(void *data, const char *text, const u32 len, const u32 offset, const u8 and_or_bit, const u8 level, const bool is_special_char);
@@ -68,6 +76,31 @@ protected:
         }
     }
 
+    template <typename OnTerm>
+    struct TermForwarder {
+        Analyzer *analyzer_;
+        OnTerm &on_term_;
+        bool last_is_place_holder_{false};
+    };
+
+    template <typename OnTerm>
+    static void
+    ForwardTerm(void *data, const char *text, const u32 len, const u32 offset, const u8 and_or_bit, const u8 level, const bool is_special_char) {
+        auto *forwarder = static_cast<TermForwarder<OnTerm> *>(data);
+        Analyzer *analyzer = forwarder->analyzer_;
+
+        if (is_special_char && !analyzer->extract_special_char_)
+            return;
+        if (is_special_char && analyzer->convert_to_placeholder_) {
+            if (!forwarder->last_is_place_holder_)
+                forwarder->on_term_(PLACE_HOLDER.c_str(), PLACE_HOLDER.length(), offset);
+            forwarder->last_is_place_holder_ = true;
+        } else {
+            forwarder->on_term_(text, len, offset);
+            forwarder->last_is_place_holder_ = std::string_view(text, len) == PLACE_HOLDER;
+        }
+    }
+
     static void AppendTermListForJieba(void *data, cppjieba::Word &cut_word) {
         void **parameters = (void **)data;
         TermList *output = (TermList *)parameters[0];
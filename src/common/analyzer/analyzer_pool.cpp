@@ -39,6 +39,8 @@ constexpr u64 Str2Int(const char *str, u64 last_value = basis) {
 }
 
 Tuple<UniquePtr<Analyzer>, Status> AnalyzerPool::GetAnalyzer(const std::string_view &name) {
+    // the prototypes are loaded once by whichever thread comes first
+    std::unique_lock lock(mutex_);
     switch (Str2Int(name.data())) {
         case Str2Int(CHINESE.data()): {
             // chinese-{coarse|fine}
@@ -120,4 +122,19 @@ Tuple<UniquePtr<Analyzer>, Status> AnalyzerPool::GetAnalyzer(const std::string_v
     }
 }
 
+Tuple<Analyzer *, Status> AnalyzerPool::GetPooledAnalyzer(const std::string_view &name) {
+    static thread_local HashMap<String, UniquePtr<Analyzer>> pooled_analyzers;
+    String key(name);
+    if (auto iter = pooled_analyzers.find(key); iter != pooled_analyzers.end()) {
+        return {iter->second.get(), Status::OK()};
+    }
+    auto [analyzer, status] = GetAnalyzer(key);
+    if (!status.ok()) {
+        return {nullptr, status};
+    }
+    Analyzer *analyzer_ptr = analyzer.get();
+    pooled_analyzers.emplace(std::move(key), std::move(analyzer));
+    return {analyzer_ptr, Status::OK()};
+}
+
 } // namespace infinity
\ No newline at end of file
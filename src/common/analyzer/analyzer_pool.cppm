@@ -30,6 +30,10 @@ public:
 
     Tuple<UniquePtr<Analyzer>, Status> GetAnalyzer(const std::string_view &name);
 
+    /// An analyzer owned by the calling thread and reused by its later calls with the same name, so the inverting
+    /// threads don't build one per batch. It must not be used by another thread.
+    Tuple<Analyzer *, Status> GetPooledAnalyzer(const std::string_view &name);
+
     void Set(const std::string_view &name);
 
 public:
@@ -39,6 +43,7 @@ public:
     static constexpr std::string_view NGRAM = "ngram";
 
 private:
+    std::mutex mutex_{};
     CacheType cache_{};
 };
 
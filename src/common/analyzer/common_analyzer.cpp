@@ -77,11 +77,9 @@ int CommonLanguageAnalyzer::AnalyzeImpl(const Term &input, void *data, HookType
                 char *lowercase_term = lowercase_string_buffer_.data();
                 ToLower(token_, len_, lowercase_term, term_string_buffer_limit_);
                 SizeT stemming_term_str_size = 0;
-                String stem_term;
                 if (extract_eng_stem_) {
-                    stemmer_->Stem(lowercase_term, stem_term);
-                    if (strcmp(stem_term.c_str(), lowercase_term)) {
-                        stemming_term_str_size = stem_term.length();
+                    if (stemmer_->Stem(lowercase_term, len_, stem_term_) && strcmp(stem_term_.c_str(), lowercase_term)) {
+                        stemming_term_str_size = stem_term_.length();
                     }
                 }
                 bool lowercase_is_different = memcmp(token_, lowercase_term, len_) != 0;
@@ -96,7 +94,7 @@ int CommonLanguageAnalyzer::AnalyzeImpl(const Term &input, void *data, HookType
                         temp_offset = offset_;
                     }
                     if (stemming_term_str_size) {
-                        func(data, stem_term.c_str(), stemming_term_str_size, offset_, Term::OR, level_ + 1, false);
+                        func(data, stem_term_.c_str(), stemming_term_str_size, offset_, Term::OR, level_ + 1, false);
                         temp_offset = offset_;
                     }
                     if (case_sensitive_ && contain_lower_ && lowercase_is_different) {
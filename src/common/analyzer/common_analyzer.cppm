@@ -70,6 +70,8 @@ protected:
     static const SizeT term_string_buffer_limit_ = 4096 * 3;
 
     Vector<char> lowercase_string_buffer_;
+    /// kept across the tokens to reuse its capacity
+    String stem_term_;
     UniquePtr<Stemmer> stemmer_{nullptr};
     const char *token_{nullptr};
     SizeT len_{0};
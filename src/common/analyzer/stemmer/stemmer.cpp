@@ -134,13 +134,13 @@ void Stemmer::DeInit(void) {
     }
 }
 
-bool Stemmer::Stem(const String &term, String &resultWord) {
+bool Stemmer::Stem(const char *term, SizeT len, String &resultWord) {
     if (!stem_function_) {
         return false;
     }
 
     // set environment
-    if (SN_set_current(((StemFunc *)stem_function_)->env, term.length(), (const symbol *)term.c_str())) {
+    if (SN_set_current(((StemFunc *)stem_function_)->env, len, (const symbol *)term)) {
         ((StemFunc *)stem_function_)->env->l = 0;
         return false;
     }
@@ -152,7 +152,7 @@ bool Stemmer::Stem(const String &term, String &resultWord) {
 
     ((StemFunc *)stem_function_)->env->p[((StemFunc *)stem_function_)->env->l] = 0;
 
-    resultWord = (char *)((StemFunc *)stem_function_)->env->p;
+    resultWord.assign((char *)((StemFunc *)stem_function_)->env->p, ((StemFunc *)stem_function_)->env->l);
 
     return true;
 }
@@ -51,7 +51,10 @@ public:
 
     void DeInit();
 
-    bool Stem(const String &term, String &resultWord);
+    bool Stem(const String &term, String &resultWord) { return Stem(term.c_str(), term.length(), resultWord); }
+
+    /// reuse the capacity of resultWord, so a caller keeping it across terms doesn't allocate
+    bool Stem(const char *term, SizeT len, String &resultWord);
 
 private:
     // int stemLang_; ///< language for stemming
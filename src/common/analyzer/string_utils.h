@@ -99,6 +99,35 @@ inline std::string ToLower(std::string const &s) {
 
 inline bool IsUTF8Sep(const uint8_t c) { return c < 128 && !std::isalnum(c); }
 
+/// return the length of the leading run of ASCII letters and digits
+inline size_t AsciiAlnumSpan(const char *data, size_t len) {
+    size_t pos = 0;
+#if defined(__SSE2__)
+    // map each range to the bottom of the signed byte range, so one signed compare tests both of its ends
+    const auto digit_shift = _mm_set1_epi8('0' - 128);
+    const auto digit_limit = _mm_set1_epi8(-128 + 10);
+    const auto alpha_shift = _mm_set1_epi8('a' - 128);
+    const auto alpha_limit = _mm_set1_epi8(-128 + 26);
+    const auto lower_bit = _mm_set1_epi8(0x20);
+    for (; pos + 16 <= len; pos += 16) {
+        auto bytes = _mm_loadu_si128((const __m128i *)(data + pos));
+        auto is_digit = _mm_cmpgt_epi8(digit_limit, _mm_sub_epi8(bytes, digit_shift));
+        auto is_alpha = _mm_cmpgt_epi8(alpha_limit, _mm_sub_epi8(_mm_or_si128(bytes, lower_bit), alpha_shift));
+        uint32_t mask = _mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha));
+        if (mask != 0xFFFF) {
+            return pos + __builtin_ctz(~mask);
+        }
+    }
+#endif
+    for (; pos < len; ++pos) {
+        const uint8_t ch = data[pos];
+        if ((uint8_t)(ch - '0') >= 10 && (uint8_t)((ch | 0x20) - 'a') >= 26) {
+            break;
+        }
+    }
+    return pos;
+}
+
 template <typename T>
 inline uint32_t GetLeadingZeroBits(T x) {
     if constexpr (sizeof(T) <= sizeof(unsigned int)) {
@@ -14,6 +14,7 @@
 
 module;
 
+#include "string_utils.h"
 #include <cctype>
 #include <cstring>
 
@@ -34,7 +35,7 @@ CharTypeTable::CharTypeTable(bool use_def_delim) {
     if (!use_def_delim)
         return;
     // set the lower 4 bit to record default char type
-    for (u8 i = 0; i < BYTE_MAX; i++) {
+    for (u32 i = 0; i < BYTE_MAX; i++) {
         if (std::isalnum(i))
             continue;
         else if (std::isspace(i))
@@ -70,7 +71,10 @@ void CharTypeTable::SetConfig(const TokenizeConfig &conf) {
     }
 }
 
-void Tokenizer::SetConfig(const TokenizeConfig &conf) { table_.SetConfig(conf); }
+void Tokenizer::SetConfig(const TokenizeConfig &conf) {
+    table_.SetConfig(conf);
+    ascii_alnum_only_ = false;
+}
 
 void Tokenizer::Tokenize(const String &input) {
     input_ = (String *)&input;
@@ -78,48 +82,70 @@ void Tokenizer::Tokenize(const String &input) {
 }
 
 bool Tokenizer::NextToken() {
-    while (input_cursor_ < input_->length() && table_.GetType(input_->at(input_cursor_)) == SPACE_CHR) {
+    const char *input = input_->data();
+    const SizeT input_length = input_->length();
+    while (input_cursor_ < input_length && table_.GetType(input[input_cursor_]) == SPACE_CHR) {
         input_cursor_++;
     }
-    if (input_cursor_ == input_->length())
+    if (input_cursor_ == input_length)
         return false;
 
-    output_buffer_cursor_ = 0;
-
-    if (output_buffer_cursor_ >= output_buffer_size_) {
-        GrowOutputBuffer();
-    }
-    output_buffer_[output_buffer_cursor_++] = input_->at(input_cursor_);
-    if (table_.GetType(input_->at(input_cursor_)) == DELIMITER_CHR) {
+    const SizeT token_begin = input_cursor_;
+    token_ = input + token_begin;
+    if (table_.GetType(input[input_cursor_]) == DELIMITER_CHR) {
         ++input_cursor_;
+        token_length_ = 1;
         is_delimiter_ = true;
         return true;
-    } else {
-        ++input_cursor_;
-        is_delimiter_ = false;
-
-        while (input_cursor_ < input_->length()) {
-            CharType cur_type = table_.GetType(input_->at(input_cursor_));
-            if (cur_type == SPACE_CHR || cur_type == DELIMITER_CHR) {
-                return true;
-            } else if (cur_type == ALLOW_CHR) {
-                if (output_buffer_cursor_ >= output_buffer_size_) {
-                    GrowOutputBuffer();
-                }
-                output_buffer_[output_buffer_cursor_++] = input_->at(input_cursor_++);
-            } else {
-                ++input_cursor_;
+    }
+    is_delimiter_ = false;
+
+    // the first char is kept whatever its type is, the allowed chars after it are used in place until a united char
+    input_cursor_ = ScanAllowed(input_cursor_ + 1);
+    if (input_cursor_ == input_length || table_.GetType(input[input_cursor_]) != UNITE_CHR) {
+        token_length_ = input_cursor_ - token_begin;
+        return true;
+    }
+
+    // the united chars are dropped, so the token is copied
+    output_buffer_cursor_ = input_cursor_ - token_begin;
+    while (output_buffer_cursor_ > output_buffer_.size()) {
+        GrowOutputBuffer();
+    }
+    memcpy(output_buffer_.data(), input + token_begin, output_buffer_cursor_);
+    while (input_cursor_ < input_length) {
+        CharType cur_type = table_.GetType(input[input_cursor_]);
+        if (cur_type == SPACE_CHR || cur_type == DELIMITER_CHR) {
+            break;
+        } else if (cur_type == ALLOW_CHR) {
+            if (output_buffer_cursor_ >= output_buffer_.size()) {
+                GrowOutputBuffer();
             }
+            output_buffer_[output_buffer_cursor_++] = input[input_cursor_++];
+        } else {
+            ++input_cursor_;
         }
-        return true;
     }
+    token_ = output_buffer_.data();
+    token_length_ = output_buffer_cursor_;
+    return true;
+}
+
+SizeT Tokenizer::ScanAllowed(SizeT begin) {
+    const char *input = input_->data();
+    const SizeT input_length = input_->length();
+    if (ascii_alnum_only_) {
+        return begin + AsciiAlnumSpan(input + begin, input_length - begin);
+    }
+    SizeT end = begin;
+    while (end < input_length && table_.IsAllow(input[end])) {
+        ++end;
+    }
+    return end;
 }
 
 bool Tokenizer::GrowOutputBuffer() {
-    char *new_output_buffer = new char[output_buffer_size_ * 2];
-    memcpy(new_output_buffer, output_buffer_, output_buffer_size_ * sizeof(char));
-    output_buffer_ = new_output_buffer;
-    output_buffer_size_ *= 2;
+    output_buffer_.resize(output_buffer_.size() * 2);
     return true;
 }
 
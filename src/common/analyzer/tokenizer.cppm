@@ -20,7 +20,7 @@ import stl;
 import term;
 
 namespace infinity {
-constexpr unsigned BYTE_MAX = 255;
+constexpr unsigned BYTE_MAX = 256;
 
 export class TokenizeConfig {
 public:
@@ -60,9 +60,7 @@ public:
 
 export class Tokenizer {
 public:
-    Tokenizer(bool use_def_delim = true) : table_(use_def_delim) { output_buffer_ = new char[output_buffer_size_](); }
-
-    ~Tokenizer() { delete[] output_buffer_; }
+    Tokenizer(bool use_def_delim = true) : table_(use_def_delim), ascii_alnum_only_(use_def_delim), output_buffer_(4096) {}
 
     /// \brief set the user defined char types
     /// \param list char type option list
@@ -74,9 +72,10 @@ public:
 
     bool NextToken();
 
-    inline const char *GetToken() { return output_buffer_; }
+    /// the token points into the input unless it has united chars to drop, valid until the next call
+    inline const char *GetToken() { return token_; }
 
-    inline SizeT GetLength() { return output_buffer_cursor_; }
+    inline SizeT GetLength() { return token_length_; }
 
     inline bool IsDelimiter() { return is_delimiter_; }
 
@@ -89,6 +88,8 @@ public:
     bool Tokenize(const String &input_string, TermList &prim_terms);
 
 private:
+    SizeT ScanAllowed(SizeT begin);
+
     bool GrowOutputBuffer();
 
 private:
@@ -98,9 +99,14 @@ private:
 
     SizeT input_cursor_{0};
 
-    SizeT output_buffer_size_{4096};
+    /// the char types are the default ones, so the allowed chars are exactly the ASCII letters and digits
+    bool ascii_alnum_only_{true};
+
+    const char *token_{nullptr};
+
+    SizeT token_length_{0};
 
-    char *output_buffer_{nullptr};
+    Vector<char> output_buffer_;
 
     SizeT output_buffer_cursor_{0};
 
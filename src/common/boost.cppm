@@ -16,6 +16,7 @@ module;
 
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/thread_pool.hpp>
 
 export module boost;
 
@@ -25,6 +26,7 @@ namespace boost {
     }
     namespace asio {
         export using boost::asio::io_service;
+        export using boost::asio::thread_pool;
         namespace ip {
             export using boost::asio::ip::tcp;
             export using boost::asio::ip::make_address;
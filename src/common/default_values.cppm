@@ -41,7 +41,9 @@ export {
     constexpr i64 MAX_BLOB_SIZE = 65536L * 65536L;
     constexpr i64 MAX_BITMAP_SIZE = 65536;
     constexpr i64 EMBEDDING_LIMIT = 65536;
-    constexpr auto PG_MSG_BUFFER_SIZE = 4096u;
+    constexpr u32 PG_MAX_MESSAGE_SIZE = 256 * 1024 * 1024u;
+    // pg server: io threads only drive the sockets, query threads parse, plan and wait for the fragments on the task scheduler
+    constexpr u64 PG_SERVER_IO_THREAD_NUM = 4;
 
     // column vector related constants
     constexpr i64 MAX_BLOCK_CAPACITY = 65536L;
@@ -138,6 +140,9 @@ export {
     constexpr std::string_view DEFAULT_DB_NAME = "default_db";
     constexpr std::string_view SYSTEM_CONFIG_TABLE_NAME = "config";
     constexpr SizeT DEFAULT_PROFILER_HISTORY_SIZE = 128;
+    constexpr SizeT DEFAULT_QUERY_FILTER_CACHE_SIZE = 256 * 1024 * 1024; // 256MB of cached segment filter results
+    constexpr SizeT DEFAULT_PLAN_CACHE_CAPACITY = 1024;                 // cached plans of SEARCH statements
+    constexpr SizeT DEFAULT_QUERY_RESULT_CACHE_SIZE = 128 * 1024 * 1024; // 128MB of cached SEARCH results
 
     // default hnsw parameter
     constexpr SizeT HNSW_M = 16;
@@ -146,13 +151,37 @@ export {
 
     constexpr SizeT BMP_BLOCK_SIZE = 16;
 
+    // default diskann parameter
+    constexpr SizeT DISKANN_MAX_DEGREE = 64;
+    constexpr SizeT DISKANN_BUILD_LIST_SIZE = 100;
+    constexpr f32 DISKANN_ALPHA = 1.2f;
+    constexpr SizeT DISKANN_SEARCH_LIST_SIZE = 100;
+    constexpr SizeT DISKANN_BEAM_WIDTH = 4;
+
     // default distance compute blas parameter
     constexpr SizeT DISTANCE_COMPUTE_BLAS_QUERY_BS = 4096;
     constexpr SizeT DISTANCE_COMPUTE_BLAS_DATABASE_BS = 1024;
 
+    // shared thread pool, the quotas are in percent of cpu_limit
+    constexpr SizeT DEFAULT_SHARED_THREAD_POOL_SIZE = 4;
+    constexpr i64 DEFAULT_INGEST_CPU_QUOTA = 75;
+    constexpr i64 DEFAULT_BACKGROUND_CPU_QUOTA = 25;
+
+    // sampled query profiling, both are off by default
+    constexpr i64 DEFAULT_PROFILE_SAMPLE_RATE = 0; // profile 1 in N queries
+    constexpr i64 DEFAULT_SLOW_QUERY_THRESHOLD = 0; // milliseconds
+    constexpr i64 MAX_SLOW_QUERY_THRESHOLD = 3600 * 1000;
+
     constexpr SizeT DBT_COMPACTION_M = 4;
     constexpr SizeT DBT_COMPACTION_C = 4;
     constexpr SizeT DBT_COMPACTION_S = DEFAULT_BLOCK_CAPACITY;
+    constexpr i64 DEFAULT_COMPACTION_IO_RATE = 64 * 1024l * 1024l; // bytes per second rewritten by auto compaction, 0 means unlimited
+    constexpr std::string_view DEFAULT_COMPACTION_IO_RATE_STR = "64MB";
+    // the cost model rewriting a segment with deleted rows alone
+    constexpr f64 DEFAULT_COMPACTION_MIN_DELETE_RATIO = 0.2;
+    constexpr f64 DEFAULT_COMPACTION_INDEX_REBUILD_COST = 2.0;
+    constexpr f64 DEFAULT_COMPACTION_HEAT_WEIGHT = 0.5;
+    constexpr f64 MAX_COMPACTION_COST_WEIGHT = 100.0;
 
     // default query option parameter
     constexpr u32 DEFAULT_MATCH_TEXT_OPTION_TOP_N = 10;
@@ -189,6 +218,10 @@ export {
     constexpr std::string_view COMPACT_INTERVAL_OPTION_NAME = "compact_interval";
     constexpr std::string_view OPTIMIZE_INTERVAL_OPTION_NAME = "optimize_interval";
     constexpr std::string_view MEM_INDEX_CAPACITY_OPTION_NAME = "mem_index_capacity";
+    constexpr std::string_view COMPACTION_IO_RATE_OPTION_NAME = "compaction_io_rate";
+    constexpr std::string_view COMPACTION_MIN_DELETE_RATIO_OPTION_NAME = "compaction_min_delete_ratio";
+    constexpr std::string_view COMPACTION_INDEX_REBUILD_COST_OPTION_NAME = "compaction_index_rebuild_cost";
+    constexpr std::string_view COMPACTION_HEAT_WEIGHT_OPTION_NAME = "compaction_heat_weight";
 
     constexpr std::string_view BUFFER_MANAGER_SIZE_OPTION_NAME = "buffer_manager_size";
     constexpr std::string_view TEMP_DIR_OPTION_NAME = "temp_dir";
@@ -202,6 +235,10 @@ export {
     constexpr std::string_view RESOURCE_DIR_OPTION_NAME = "resource_dir";
 
     constexpr std::string_view RECORD_RUNNING_QUERY_OPTION_NAME = "record_running_query";
+    constexpr std::string_view INGEST_CPU_QUOTA_OPTION_NAME = "ingest_cpu_quota";
+    constexpr std::string_view BACKGROUND_CPU_QUOTA_OPTION_NAME = "background_cpu_quota";
+    constexpr std::string_view PROFILE_SAMPLE_RATE_OPTION_NAME = "profile_sample_rate";
+    constexpr std::string_view SLOW_QUERY_THRESHOLD_OPTION_NAME = "slow_query_threshold";
 
     // Variable name
     constexpr std::string_view QUERY_COUNT_VAR_NAME = "query_count";        // global and session
@@ -220,6 +257,7 @@ export {
     constexpr std::string_view CATALOG_VERSION_VAR_NAME = "catalog_version";   // global
     constexpr std::string_view ACTIVE_WAL_FILENAME_VAR_NAME = "active_wal_filename";   // global
     constexpr std::string_view ENABLE_PROFILE_VAR_NAME = "enable_profile";  // session
+    constexpr std::string_view ENABLE_RESULT_CACHE_VAR_NAME = "enable_result_cache";  // session
     constexpr std::string_view PROFILE_RECORD_CAPACITY_VAR_NAME = "profile_record_capacity";  // session
     constexpr std::string_view BG_TASK_COUNT_VAR_NAME = "bg_task_count";  // global
     constexpr std::string_view RUNNING_BG_TASK_VAR_NAME = "running_bg_task";  // global
@@ -136,6 +136,7 @@ export namespace std {
     using std::max_element;
     using std::min_element;
     using std::nearbyint;
+    using std::nth_element;
     using std::partial_sort;
     using std::pop_heap;
     using std::pow;
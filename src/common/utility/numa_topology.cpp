@@ -0,0 +1,160 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sched.h>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
+module numa_topology;
+
+import stl;
+
+namespace infinity {
+
+namespace {
+
+thread_local i64 thread_numa_node = -1;
+
+// cpus the process may run on, all of them when the affinity can't be read
+bool IsAllowedCpu(u32 cpu) {
+#if defined(__linux__)
+    static const Optional<cpu_set_t> allowed_cpus = []() -> Optional<cpu_set_t> {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+            return None;
+        }
+        return cpu_set;
+    }();
+    return !allowed_cpus.has_value() || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &*allowed_cpus));
+#else
+    return true;
+#endif
+}
+
+NumaTopology DiscoverTopology() {
+    Vector<Pair<i32, Vector<u32>>> nodes;
+    std::error_code ec;
+    for (const auto &entry : std::filesystem::directory_iterator("/sys/devices/system/node", ec)) {
+        String name = entry.path().filename().string();
+        if (name.size() <= 4 || name.compare(0, 4, "node") != 0 || !std::all_of(name.begin() + 4, name.end(), ::isdigit)) {
+            continue;
+        }
+        std::ifstream cpu_list_file(entry.path() / "cpulist");
+        String cpu_list;
+        std::getline(cpu_list_file, cpu_list);
+        Vector<u32> cpus = NumaTopology::ParseCpuList(cpu_list);
+        cpus.erase(std::remove_if(cpus.begin(), cpus.end(), [](u32 cpu) { return !IsAllowedCpu(cpu); }), cpus.end());
+        if (!cpus.empty()) {
+            nodes.emplace_back(std::stoi(name.substr(4)), std::move(cpus));
+        }
+    }
+    if (nodes.empty()) {
+        Vector<u32> cpus;
+        for (u32 cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu) {
+            cpus.push_back(cpu);
+        }
+        nodes.emplace_back(0, std::move(cpus));
+    }
+    std::sort(nodes.begin(), nodes.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
+    Vector<Vector<u32>> node_cpus;
+    Vector<i32> kernel_node_ids;
+    for (auto &[kernel_node_id, cpus] : nodes) {
+        kernel_node_ids.push_back(kernel_node_id);
+        node_cpus.push_back(std::move(cpus));
+    }
+    return NumaTopology(std::move(node_cpus), std::move(kernel_node_ids));
+}
+
+} // namespace
+
+const NumaTopology &NumaTopology::instance() {
+    static const NumaTopology topology = DiscoverTopology();
+    return topology;
+}
+
+NumaTopology::NumaTopology(Vector<Vector<u32>> node_cpus, Vector<i32> kernel_node_ids)
+    : node_cpus_(std::move(node_cpus)), kernel_node_ids_(std::move(kernel_node_ids)) {
+    for (SizeT node = 0; node < node_cpus_.size(); ++node) {
+        for (u32 cpu : node_cpus_[node]) {
+            if (cpu >= cpu_nodes_.size()) {
+                cpu_nodes_.resize(cpu + 1, 0);
+            }
+            cpu_nodes_[cpu] = node;
+        }
+    }
+}
+
+bool NumaTopology::MovePagesToNode(void *ptr, SizeT size, SizeT node) const {
+#if defined(__linux__)
+    if (node_count() < 2 || node >= node_count()) {
+        return false;
+    }
+    static const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(ptr) + page_size - 1) / page_size * page_size;
+    uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + size) / page_size * page_size;
+    if (begin >= end) {
+        return false;
+    }
+    SizeT page_count = (end - begin) / page_size;
+    Vector<void *> pages(page_count);
+    for (SizeT i = 0; i < page_count; ++i) {
+        pages[i] = reinterpret_cast<void *>(begin + i * page_size);
+    }
+    Vector<int> nodes(page_count, kernel_node_ids_[node]);
+    Vector<int> status(page_count);
+    // pages already on the node are left as they are
+    return syscall(SYS_move_pages, 0, page_count, pages.data(), nodes.data(), status.data(), MPOL_MF_MOVE) == 0;
+#else
+    return false;
+#endif
+}
+
+i64 NumaTopology::ThreadNode() { return thread_numa_node; }
+
+void NumaTopology::SetThreadNode(i64 node) { thread_numa_node = node; }
+
+Vector<u32> NumaTopology::ParseCpuList(const String &cpu_list) {
+    Vector<u32> cpus;
+    std::stringstream ss(cpu_list);
+    String range;
+    while (std::getline(ss, range, ',')) {
+        SizeT dash = range.find('-');
+        try {
+            u32 first = std::stoul(range.substr(0, dash));
+            u32 last = dash == String::npos ? first : std::stoul(range.substr(dash + 1));
+            for (u32 cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        } catch (const std::exception &) {
+            // blank or malformed range
+        }
+    }
+    return cpus;
+}
+
+} // namespace infinity
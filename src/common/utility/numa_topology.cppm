@@ -0,0 +1,59 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module numa_topology;
+
+import stl;
+
+namespace infinity {
+
+// The NUMA nodes of the machine and the cpus of each that the process may run on, read once from
+// /sys/devices/system/node. Without that directory, or when no node has such a cpu, it is a single node with all the cpus.
+// Nodes are numbered from 0 in the order of their kernel ids, nodes without cpus are left out.
+export class NumaTopology {
+public:
+    static const NumaTopology &instance();
+
+    // node_cpus[i] are the cpus of node i, kernel_node_ids[i] its kernel id
+    NumaTopology(Vector<Vector<u32>> node_cpus, Vector<i32> kernel_node_ids);
+
+    SizeT node_count() const { return node_cpus_.size(); }
+
+    const Vector<u32> &NodeCpus(SizeT node) const { return node_cpus_[node]; }
+
+    // 0 for a cpu of no node
+    SizeT NodeOfCpu(u32 cpu) const { return cpu < cpu_nodes_.size() ? cpu_nodes_[cpu] : 0; }
+
+    // Moves the pages entirely inside [ptr, ptr + size) to the node, without changing the memory policy of the range.
+    // Returns false when there is a single node or the kernel refused.
+    bool MovePagesToNode(void *ptr, SizeT size, SizeT node) const;
+
+    // The node of the worker the calling thread is, -1 for a thread that isn't pinned to a node.
+    static i64 ThreadNode();
+
+    static void SetThreadNode(i64 node);
+
+    // "0-3,8,10-11" to 0, 1, 2, 3, 8, 10, 11
+    static Vector<u32> ParseCpuList(const String &cpu_list);
+
+private:
+    Vector<Vector<u32>> node_cpus_{};
+    Vector<i32> kernel_node_ids_{};
+    Vector<SizeT> cpu_nodes_{};
+};
+
+} // namespace infinity
@@ -1375,7 +1375,25 @@ void ExplainPhysicalPlan::Explain(const PhysicalShow *show_node, SharedPtr<Vecto
 
             String output_columns_str = String(intent_size, ' ');
             output_columns_str += " - output columns: [record_no, parser, logical planner, optimizer, physical planner, pipeline builder, task "
-                                  "builder, executor, total_cost]";
+                                  "builder, executor, total_cost, reason, query]";
+            result->emplace_back(MakeShared<String>(output_columns_str));
+            break;
+        }
+        case ShowType::kShowProfile: {
+            String show_str;
+            if (intent_size != 0) {
+                show_str = String(intent_size - 2, ' ');
+                show_str += "-> SHOW PROFILE ";
+            } else {
+                show_str = "SHOW PROFILE ";
+            }
+            show_str += "(";
+            show_str += std::to_string(show_node->node_id());
+            show_str += ")";
+            result->emplace_back(MakeShared<String>(show_str));
+
+            String output_columns_str = String(intent_size, ' ');
+            output_columns_str += " - output columns: [fragment_id, task_id, operator, runs, elapsed, input_rows, output_rows, output_data_size]";
             result->emplace_back(MakeShared<String>(output_columns_str));
             break;
         }
@@ -35,6 +35,9 @@ import infinity_exception;
 import expression_type;
 import bound_cast_func;
 import logger;
+import data_type;
+import logical_type;
+import aggregate_function;
 
 namespace infinity {
 
@@ -84,8 +87,10 @@ void ExpressionEvaluator::Execute(const SharedPtr<AggregateExpression> &expr,
     SharedPtr<ColumnVector> &child_output_col = child_state->OutputColumnVector();
     this->Execute(child_expr, child_state, child_output_col);
 
-    if (expr->aggregate_function_.return_type_ != *output_column_vector->data_type()) {
-        Status status = Status::DataTypeMismatch(expr->aggregate_function_.return_type_.ToString(), output_column_vector->data_type()->ToString());
+    const bool partial = state->agg_partial_state_;
+    const DataType output_type = partial ? DataType(LogicalType::kVarchar) : expr->aggregate_function_.return_type_;
+    if (output_type != *output_column_vector->data_type()) {
+        Status status = Status::DataTypeMismatch(output_type.ToString(), output_column_vector->data_type()->ToString());
         LOG_ERROR(status.message());
         RecoverableError(status);
     }
@@ -103,15 +108,13 @@ void ExpressionEvaluator::Execute(const SharedPtr<AggregateExpression> &expr,
         }
         case AggregateFlag::kFinish: {
             expr->aggregate_function_.update_func_(data_state, child_output_col);
-            const_ptr_t result_ptr = expr->aggregate_function_.finalize_func_(data_state);
-            output_column_vector->AppendByPtr(result_ptr);
+            expr->aggregate_function_.AppendResult(data_state, *output_column_vector, partial);
             break;
         }
         case AggregateFlag::kRunAndFinish: {
             expr->aggregate_function_.init_func_(data_state);
             expr->aggregate_function_.update_func_(data_state, child_output_col);
-            const_ptr_t result_ptr = expr->aggregate_function_.finalize_func_(data_state);
-            output_column_vector->AppendByPtr(result_ptr);
+            expr->aggregate_function_.AppendResult(data_state, *output_column_vector, partial);
             break;
         }
     }
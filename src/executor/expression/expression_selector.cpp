@@ -14,6 +14,8 @@
 
 module;
 
+#include <bit>
+
 module expression_selector;
 
 import stl;
@@ -54,6 +56,18 @@ SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
     return output_true_select->Size();
 }
 
+SharedPtr<Selection>
+ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, const DataBlock *input_data_block, SizeT count) {
+    this->input_data_ = input_data_block;
+    SharedPtr<Selection> input_select = nullptr;
+    SharedPtr<Selection> output_true_select = MakeShared<Selection>();
+    output_true_select->Initialize(count);
+    SharedPtr<Selection> output_false_select = nullptr;
+
+    Select(expr, state, count, input_select, output_true_select, output_false_select);
+    return output_true_select;
+}
+
 void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                 SharedPtr<ExpressionState> &state,
                                 SizeT count,
@@ -130,4 +144,13 @@ void ExpressionSelector::Select(const SharedPtr<ColumnVector> &bool_column, Size
     }
 }
 
+void ExpressionSelector::Select(const u64 *row_bits, SizeT count, SharedPtr<Selection> &output_true_select) {
+    SizeT unit_count = BitmaskBuffer::UnitCount(count);
+    for (SizeT i = 0; i < unit_count; ++i) {
+        for (u64 bits = row_bits[i]; bits != 0; bits &= bits - 1) {
+            output_true_select->Append(i * BitmaskBuffer::UNIT_BITS + std::countr_zero(bits));
+        }
+    }
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -34,6 +34,9 @@ public:
                  DataBlock *output_data_block,
                  SizeT count);
 
+    // only evaluate the filter, the surviving rows are returned as a selection instead of being copied out
+    SharedPtr<Selection> Select(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, const DataBlock *input_data_block, SizeT count);
+
     void Select(const SharedPtr<BaseExpression> &expr,
                 SharedPtr<ExpressionState> &state,
                 SizeT count,
@@ -45,6 +48,9 @@ public:
 
     static void Select(const SharedPtr<ColumnVector> &bool_column, SizeT count, SharedPtr<Selection> &output_true_select, bool nullable);
 
+    // the rows whose bits are set, e.g. by a FusedPredicate
+    static void Select(const u64 *row_bits, SizeT count, SharedPtr<Selection> &output_true_select);
+
 private:
     const DataBlock *input_data_{nullptr};
 };
@@ -66,6 +66,9 @@ public:
 
     AggregateFlag agg_flag_{AggregateFlag::kUninitialized};
 
+    // output the serialized state instead of the result, to be merged with the states of other tasks
+    bool agg_partial_state_{false};
+
 private:
     Vector<SharedPtr<ExpressionState>> children_;
     String name_;
@@ -0,0 +1,366 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+
+module fused_predicate;
+
+import stl;
+import base_expression;
+import expression_type;
+import function_expression;
+import reference_expression;
+import value_expression;
+import data_block;
+import column_vector;
+import bitmask;
+import bitmask_buffer;
+import value;
+import logical_type;
+import internal_types;
+import data_type;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+enum class CompareType : u8 { kEqual, kNotEqual, kLess, kLessEqual, kGreater, kGreaterEqual };
+
+struct CompareInfo {
+    const char *name_;
+    CompareType type_;
+    // the type after swapping the arguments
+    CompareType reverse_type_;
+};
+
+constexpr Array<CompareInfo, 6> kCompareInfos = {{
+    {"=", CompareType::kEqual, CompareType::kEqual},
+    {"<>", CompareType::kNotEqual, CompareType::kNotEqual},
+    {"<", CompareType::kLess, CompareType::kGreater},
+    {"<=", CompareType::kLessEqual, CompareType::kGreaterEqual},
+    {">", CompareType::kGreater, CompareType::kLess},
+    {">=", CompareType::kGreaterEqual, CompareType::kLessEqual},
+}};
+
+template <CompareType kCompare, typename T>
+inline bool Compare(const T &left, const T &right) {
+    if constexpr (kCompare == CompareType::kEqual) {
+        return left == right;
+    } else if constexpr (kCompare == CompareType::kNotEqual) {
+        return !(left == right);
+    } else if constexpr (kCompare == CompareType::kLess) {
+        return left < right;
+    } else if constexpr (kCompare == CompareType::kLessEqual) {
+        return left <= right;
+    } else if constexpr (kCompare == CompareType::kGreater) {
+        return left > right;
+    } else {
+        return left >= right;
+    }
+}
+
+using KernelType = void (*)(const void *column_data, const void *constant, SizeT count, u64 *result);
+
+// 64 rows make one word of the result, the inner loop has no branch so it's vectorized
+template <typename ColumnType, typename ConstantType, CompareType kCompare>
+void CompareKernel(const void *column_data, const void *constant_ptr, SizeT count, u64 *result) {
+    const auto *data = static_cast<const ColumnType *>(column_data);
+    ConstantType constant;
+    std::memcpy(&constant, constant_ptr, sizeof(ConstantType));
+    const SizeT full_word_count = count / BitmaskBuffer::UNIT_BITS;
+    for (SizeT word_idx = 0; word_idx < full_word_count; ++word_idx) {
+        const ColumnType *word_data = data + word_idx * BitmaskBuffer::UNIT_BITS;
+        u64 bits = 0;
+        for (SizeT bit_idx = 0; bit_idx < BitmaskBuffer::UNIT_BITS; ++bit_idx) {
+            bits |= u64(Compare<kCompare>(static_cast<ConstantType>(word_data[bit_idx]), constant)) << bit_idx;
+        }
+        result[word_idx] = bits;
+    }
+    if (const SizeT tail_count = count % BitmaskBuffer::UNIT_BITS; tail_count > 0) {
+        const ColumnType *word_data = data + full_word_count * BitmaskBuffer::UNIT_BITS;
+        u64 bits = 0;
+        for (SizeT bit_idx = 0; bit_idx < tail_count; ++bit_idx) {
+            bits |= u64(Compare<kCompare>(static_cast<ConstantType>(word_data[bit_idx]), constant)) << bit_idx;
+        }
+        result[full_word_count] = bits;
+    }
+}
+
+template <typename ColumnType, typename ConstantType>
+KernelType GetKernel(CompareType compare_type) {
+    switch (compare_type) {
+        case CompareType::kEqual:
+            return &CompareKernel<ColumnType, ConstantType, CompareType::kEqual>;
+        case CompareType::kNotEqual:
+            return &CompareKernel<ColumnType, ConstantType, CompareType::kNotEqual>;
+        case CompareType::kLess:
+            return &CompareKernel<ColumnType, ConstantType, CompareType::kLess>;
+        case CompareType::kLessEqual:
+            return &CompareKernel<ColumnType, ConstantType, CompareType::kLessEqual>;
+        case CompareType::kGreater:
+            return &CompareKernel<ColumnType, ConstantType, CompareType::kGreater>;
+        case CompareType::kGreaterEqual:
+            return &CompareKernel<ColumnType, ConstantType, CompareType::kGreaterEqual>;
+    }
+    return nullptr;
+}
+
+// The column is compared as the constant type, which is the same type or the widened type of a cast, as the binder
+// casts "smaller ints" to BigInt and numbers to Double.
+template <typename ConstantType>
+KernelType GetKernelByColumnType(LogicalType column_type, CompareType compare_type) {
+    switch (column_type) {
+        case LogicalType::kTinyInt:
+            return GetKernel<TinyIntT, ConstantType>(compare_type);
+        case LogicalType::kSmallInt:
+            return GetKernel<SmallIntT, ConstantType>(compare_type);
+        case LogicalType::kInteger:
+            return GetKernel<IntegerT, ConstantType>(compare_type);
+        case LogicalType::kBigInt:
+            return GetKernel<BigIntT, ConstantType>(compare_type);
+        case LogicalType::kFloat:
+            return GetKernel<FloatT, ConstantType>(compare_type);
+        case LogicalType::kDouble:
+            return GetKernel<DoubleT, ConstantType>(compare_type);
+        default:
+            return nullptr;
+    }
+}
+
+bool IsWideningCast(LogicalType source_type, LogicalType target_type) {
+    switch (source_type) {
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+            return target_type == LogicalType::kBigInt || target_type == LogicalType::kDouble;
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+            return target_type == LogicalType::kDouble;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+struct FusedPredicate::Node {
+    enum class Type : u8 { kAnd, kOr, kCompare };
+
+    Type type_{Type::kCompare};
+    Vector<UniquePtr<Node>> children_;
+
+    // kCompare
+    SizeT column_idx_{0};
+    LogicalType column_type_{LogicalType::kInvalid};
+    KernelType kernel_{nullptr};
+    u64 constant_{0};
+    String name_;
+
+    static UniquePtr<Node> Make(const SharedPtr<BaseExpression> &expression);
+
+    static UniquePtr<Node> MakeCompare(const SharedPtr<BaseExpression> &column_expr, const SharedPtr<BaseExpression> &value_expr, CompareType compare_type);
+
+    SizeT Depth() const {
+        SizeT depth = 0;
+        for (const auto &child : children_) {
+            depth = std::max(depth, child->Depth());
+        }
+        return depth + 1;
+    }
+
+    bool Evaluate(const DataBlock &input_data_block, SizeT count, u64 *result, u64 *scratch) const;
+};
+
+UniquePtr<FusedPredicate::Node> FusedPredicate::Node::Make(const SharedPtr<BaseExpression> &expression) {
+    if (expression->type() != ExpressionType::kFunction || expression->arguments().size() != 2) {
+        return nullptr;
+    }
+    const auto &function_name = std::static_pointer_cast<FunctionExpression>(expression)->ScalarFunctionName();
+    const auto &left = expression->arguments()[0];
+    const auto &right = expression->arguments()[1];
+    if (function_name == "AND" || function_name == "OR") {
+        auto node = MakeUnique<Node>();
+        node->type_ = function_name == "AND" ? Type::kAnd : Type::kOr;
+        for (const auto &argument : {left, right}) {
+            auto child = Make(argument);
+            if (child.get() == nullptr) {
+                return nullptr;
+            }
+            // a AND (b AND c) is evaluated as one level
+            if (child->type_ == node->type_) {
+                for (auto &grand_child : child->children_) {
+                    node->children_.push_back(std::move(grand_child));
+                }
+            } else {
+                node->children_.push_back(std::move(child));
+            }
+        }
+        return node;
+    }
+    for (const auto &compare_info : kCompareInfos) {
+        if (function_name != compare_info.name_) {
+            continue;
+        }
+        if (right->type() == ExpressionType::kValue) {
+            return MakeCompare(left, right, compare_info.type_);
+        }
+        if (left->type() == ExpressionType::kValue) {
+            return MakeCompare(right, left, compare_info.reverse_type_);
+        }
+        return nullptr;
+    }
+    return nullptr;
+}
+
+UniquePtr<FusedPredicate::Node>
+FusedPredicate::Node::MakeCompare(const SharedPtr<BaseExpression> &column_expr, const SharedPtr<BaseExpression> &value_expr, CompareType compare_type) {
+    const BaseExpression *reference_expr = column_expr.get();
+    if (reference_expr->type() == ExpressionType::kCast) {
+        reference_expr = reference_expr->arguments()[0].get();
+        if (!IsWideningCast(reference_expr->Type().type(), column_expr->Type().type())) {
+            return nullptr;
+        }
+    }
+    if (reference_expr->type() != ExpressionType::kReference) {
+        return nullptr;
+    }
+    const Value &value = static_cast<const ValueExpression *>(value_expr.get())->GetValue();
+    const LogicalType constant_type = column_expr->Type().type();
+    // a null constant is of type null
+    if (value.type().type() != constant_type) {
+        return nullptr;
+    }
+
+    auto node = MakeUnique<Node>();
+    node->column_idx_ = static_cast<const ReferenceExpression *>(reference_expr)->column_index();
+    node->column_type_ = reference_expr->Type().type();
+    node->name_ = fmt::format("{} {} {}", reference_expr->Name(), kCompareInfos[static_cast<SizeT>(compare_type)].name_, value.ToString());
+    auto set_constant = [&]<typename ConstantType>(ConstantType constant) {
+        static_assert(sizeof(ConstantType) <= sizeof(node->constant_));
+        std::memcpy(&node->constant_, &constant, sizeof(ConstantType));
+        node->kernel_ = GetKernelByColumnType<ConstantType>(node->column_type_, compare_type);
+    };
+    switch (constant_type) {
+        case LogicalType::kTinyInt:
+            set_constant(value.GetValue<TinyIntT>());
+            break;
+        case LogicalType::kSmallInt:
+            set_constant(value.GetValue<SmallIntT>());
+            break;
+        case LogicalType::kInteger:
+            set_constant(value.GetValue<IntegerT>());
+            break;
+        case LogicalType::kBigInt:
+            set_constant(value.GetValue<BigIntT>());
+            break;
+        case LogicalType::kFloat:
+            set_constant(value.GetValue<FloatT>());
+            break;
+        case LogicalType::kDouble:
+            set_constant(value.GetValue<DoubleT>());
+            break;
+        case LogicalType::kDate: {
+            if (node->column_type_ == LogicalType::kDate) {
+                std::memcpy(&node->constant_, &value.value_.date, sizeof(DateT));
+                node->kernel_ = GetKernel<DateT, DateT>(compare_type);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    if (node->kernel_ == nullptr) {
+        return nullptr;
+    }
+    return node;
+}
+
+bool FusedPredicate::Node::Evaluate(const DataBlock &input_data_block, SizeT count, u64 *result, u64 *scratch) const {
+    const SizeT word_count = BitmaskBuffer::UnitCount(count);
+    if (type_ == Type::kCompare) {
+        const ColumnVector &column = *input_data_block.column_vectors[column_idx_];
+        if (column.vector_type() != ColumnVectorType::kFlat || column.data_type()->type() != column_type_) {
+            return false;
+        }
+        kernel_(column.data(), &constant_, count, result);
+        if (const Bitmask &nulls = *column.nulls_ptr_; !nulls.IsAllTrue()) {
+            const u64 *valid_words = nulls.GetData();
+            for (SizeT word_idx = 0; word_idx < word_count; ++word_idx) {
+                result[word_idx] &= valid_words[word_idx];
+            }
+        }
+        return true;
+    }
+
+    if (!children_[0]->Evaluate(input_data_block, count, result, scratch + word_count)) {
+        return false;
+    }
+    for (SizeT child_idx = 1; child_idx < children_.size(); ++child_idx) {
+        if (!children_[child_idx]->Evaluate(input_data_block, count, scratch, scratch + word_count)) {
+            return false;
+        }
+        if (type_ == Type::kAnd) {
+            for (SizeT word_idx = 0; word_idx < word_count; ++word_idx) {
+                result[word_idx] &= scratch[word_idx];
+            }
+        } else {
+            for (SizeT word_idx = 0; word_idx < word_count; ++word_idx) {
+                result[word_idx] |= scratch[word_idx];
+            }
+        }
+    }
+    return true;
+}
+
+FusedPredicate::FusedPredicate(UniquePtr<Node> root) : root_(std::move(root)), depth_(root_->Depth()) {}
+
+FusedPredicate::~FusedPredicate() = default;
+
+UniquePtr<FusedPredicate> FusedPredicate::Make(const SharedPtr<BaseExpression> &expression) {
+    UniquePtr<Node> root = Node::Make(expression);
+    if (root.get() == nullptr) {
+        return nullptr;
+    }
+    return MakeUnique<FusedPredicate>(std::move(root));
+}
+
+bool FusedPredicate::Evaluate(const DataBlock &input_data_block, SizeT count, u64 *result) const {
+    if (count == 0) {
+        return true;
+    }
+    Vector<u64> scratch(BitmaskBuffer::UnitCount(count) * depth_);
+    return root_->Evaluate(input_data_block, count, result, scratch.data());
+}
+
+String FusedPredicate::ToString() const {
+    std::function<String(const Node &)> to_string = [&](const Node &node) -> String {
+        if (node.type_ == Node::Type::kCompare) {
+            return node.name_;
+        }
+        String result = "(";
+        for (SizeT child_idx = 0; child_idx < node.children_.size(); ++child_idx) {
+            if (child_idx > 0) {
+                result += node.type_ == Node::Type::kAnd ? " AND " : " OR ";
+            }
+            result += to_string(*node.children_[child_idx]);
+        }
+        return result + ")";
+    };
+    return to_string(*root_);
+}
+
+} // namespace infinity
@@ -0,0 +1,53 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module fused_predicate;
+
+import stl;
+import base_expression;
+import data_block;
+import logical_type;
+
+namespace infinity {
+
+// A filter which is an AND/OR tree of "column compare constant" on fixed width types, e.g. a > 5 AND (b < 10 OR c = 2.5).
+// It's recognized once when the plan is built. Each comparison is a kernel specialized for the column type, the constant
+// type and the compare operator, and the tree combines the bits of the rows word by word. The row bits are written once,
+// so no ExpressionState or boolean column is created for the nodes of the tree. A row with null never satisfies a comparison.
+export class FusedPredicate {
+public:
+    // nullptr if the expression has any other shape
+    static UniquePtr<FusedPredicate> Make(const SharedPtr<BaseExpression> &expression);
+
+    // Set the bit of each of the first count rows satisfying the predicate, result holds (count + 63) / 64 words.
+    // False if a column of the block isn't flat, then the expression should be evaluated as usual.
+    bool Evaluate(const DataBlock &input_data_block, SizeT count, u64 *result) const;
+
+    String ToString() const;
+
+    struct Node;
+
+    explicit FusedPredicate(UniquePtr<Node> root);
+
+    ~FusedPredicate();
+
+private:
+    UniquePtr<Node> root_;
+    // the levels of the tree, one scratch bitmap for each
+    SizeT depth_{0};
+};
+
+} // namespace infinity
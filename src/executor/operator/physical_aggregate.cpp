@@ -38,6 +38,7 @@ import default_values;
 import expression_state;
 import expression_evaluator;
 import aggregate_expression;
+import aggregate_function;
 import status;
 import logical_type;
 import internal_types;
@@ -638,7 +639,7 @@ void PhysicalAggregate::GenerateGroupByResult(const SharedPtr<DataTable> &input_
 
 bool PhysicalAggregate::SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>> &input_blocks,
                                                Vector<UniquePtr<DataBlock>> &output_blocks,
-                                               Vector<UniquePtr<char[]>> &states,
+                                               Vector<AggregateStatePtr> &states,
                                                bool task_completed) {
     SizeT aggregates_count = aggregates_.size();
     if (aggregates_count <= 0) {
@@ -650,6 +651,16 @@ bool PhysicalAggregate::SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>
     SizeT input_block_count = input_blocks.size();
 
     if (input_block_count == 0) {
+        if (task_completed && !output_blocks.empty()) {
+            // The last call brings no block, append the results of the states updated by the earlier calls
+            DataBlock *output_data_block = output_blocks[0].get();
+            for (SizeT idx = 0; idx < aggregates_count; ++idx) {
+                const AggregateFunction &function = static_cast<AggregateExpression *>(aggregates_[idx].get())->aggregate_function_;
+                function.AppendResult(states[idx].get(), *output_data_block->column_vectors[idx], IsPartialState(idx));
+            }
+            output_data_block->Finalize();
+            return true;
+        }
         // No input data
         LOG_TRACE("No input, no aggregate result");
         return true;
@@ -667,14 +678,25 @@ bool PhysicalAggregate::SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>
     Vector<SharedPtr<DataType>> output_types;
     output_types.reserve(aggregates_count);
 
-    AggregateFlag flag = output_blocks.empty() ? (!task_completed ? AggregateFlag::kUninitialized : AggregateFlag::kRunAndFinish)
-                                               : (!task_completed ? AggregateFlag::kRunning : AggregateFlag::kFinish);
+    // The states are initialized by the first block of the task and finished by its last block, the result is appended once.
+    const bool first_call = output_blocks.empty();
+    auto block_flag = [&](SizeT block_idx) {
+        const bool first_block = first_call && block_idx == 0;
+        const bool last_block = task_completed && block_idx == input_block_count - 1;
+        if (first_block) {
+            return last_block ? AggregateFlag::kRunAndFinish : AggregateFlag::kUninitialized;
+        }
+        return last_block ? AggregateFlag::kFinish : AggregateFlag::kRunning;
+    };
 
     for (i64 idx = 0; auto &expr : aggregates_) {
         // expression state
-        expr_states.emplace_back(ExpressionState::CreateState(std::static_pointer_cast<AggregateExpression>(expr), states[idx].get(), flag));
+        expr_states.emplace_back(
+            ExpressionState::CreateState(std::static_pointer_cast<AggregateExpression>(expr), states[idx].get(), block_flag(0)));
+        const bool partial_state = IsPartialState(idx);
+        expr_states.back()->agg_partial_state_ = partial_state;
 
-        SharedPtr<DataType> output_type = MakeShared<DataType>(expr->Type());
+        SharedPtr<DataType> output_type = MakeShared<DataType>(partial_state ? DataType(LogicalType::kVarchar) : expr->Type());
 
         // column definition
         SharedPtr<ColumnDef> col_def = MakeShared<ColumnDef>(idx, output_type, expr->Name(), std::set<ConstraintType>());
@@ -687,18 +709,15 @@ bool PhysicalAggregate::SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>
     }
 
     if (output_blocks.empty()) {
-        for (SizeT block_idx = 0; block_idx < input_block_count; ++block_idx) {
-            output_blocks.emplace_back(DataBlock::MakeUniquePtr());
-            auto out_put_block = output_blocks.back().get();
-            out_put_block->Init(*GetOutputTypes());
-        }
+        // the row of the results, appended by the last block
+        output_blocks.emplace_back(DataBlock::MakeUniquePtr());
+        output_blocks.back()->Init(*GetOutputTypes());
     }
+    DataBlock *output_data_block = output_blocks[0].get();
 
     for (SizeT block_idx = 0; block_idx < input_block_count; ++block_idx) {
         DataBlock *input_data_block = input_blocks[block_idx].get();
 
-        DataBlock *output_data_block = output_blocks[block_idx].get();
-
         ExpressionEvaluator evaluator;
         evaluator.Init(input_data_block);
 
@@ -706,12 +725,9 @@ bool PhysicalAggregate::SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>
         // calculate every columns value
         for (SizeT expr_idx = 0; expr_idx < expression_count; ++expr_idx) {
             LOG_TRACE("Physical aggregate Execute");
+            expr_states[expr_idx]->agg_flag_ = block_flag(block_idx);
             evaluator.Execute(aggregates_[expr_idx], expr_states[expr_idx], output_data_block->column_vectors[expr_idx]);
         }
-        if (task_completed) {
-            // Finalize the output block (e.g. calculate the average value
-            output_data_block->Finalize();
-        }
         // {
         //     auto row = input_data_block->row_count();
         //     if (row == 0) {
@@ -738,6 +754,10 @@ bool PhysicalAggregate::SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>
         //     }
         // }
     }
+    if (task_completed) {
+        // Finalize the output block (e.g. calculate the average value
+        output_data_block->Finalize();
+    }
     return true;
 }
 
@@ -764,11 +784,15 @@ SharedPtr<Vector<SharedPtr<DataType>>> PhysicalAggregate::GetOutputTypes() const
         result->emplace_back(MakeShared<DataType>(groups_[i]->Type()));
     }
     for (SizeT i = 0; i < aggregates_count; ++i) {
-        result->emplace_back(MakeShared<DataType>(aggregates_[i]->Type()));
+        result->emplace_back(MakeShared<DataType>(IsPartialState(i) ? DataType(LogicalType::kVarchar) : aggregates_[i]->Type()));
     }
     return result;
 }
 
+bool PhysicalAggregate::IsPartialState(SizeT aggregate_idx) const {
+    return partial_states_ && static_cast<AggregateExpression *>(aggregates_[aggregate_idx].get())->aggregate_function_.IsMergeable();
+}
+
 Vector<HashRange> PhysicalAggregate::GetHashRanges(i64 parallel_count) const {
     Vector<HashRange> result;
     result.resize(parallel_count);
@@ -31,6 +31,7 @@ import data_block;
 import internal_types;
 import data_type;
 import logger;
+import aggregate_function;
 
 namespace infinity {
 
@@ -74,13 +75,19 @@ public:
 
     bool SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>> &input_blocks,
                                 Vector<UniquePtr<DataBlock>> &output_blocks,
-                                Vector<UniquePtr<char[]>> &states,
+                                Vector<AggregateStatePtr> &states,
                                 bool task_completed);
 
     inline u64 GroupTableIndex() const { return groupby_index_; }
 
     inline u64 AggregateTableIndex() const { return aggregate_index_; }
 
+    // Called when the tasks are merged by PhysicalMergeAggregate, then the mergeable aggregates output their
+    // serialized states instead of the results.
+    inline void SetPartialStates() { partial_states_ = true; }
+
+    bool IsPartialState(SizeT aggregate_idx) const;
+
     SharedPtr<Vector<String>> GetOutputNames() const final;
 
     SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
@@ -93,6 +100,7 @@ private:
     SharedPtr<DataTable> input_table_{};
     u64 groupby_index_{};
     u64 aggregate_index_{};
+    bool partial_states_{false};
 };
 
 } // namespace infinity
@@ -36,6 +36,12 @@ import status;
 import infinity_exception;
 import variables;
 import logger;
+import infinity_context;
+import resource_manager;
+import default_values;
+import storage;
+import compaction_process;
+import compaction_rate_limiter;
 
 namespace infinity {
 
@@ -64,6 +70,15 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
                             query_context->current_session()->SetProfile(set_command->value_bool());
                             return true;
                         }
+                        case SessionVariable::kEnableResultCache: {
+                            if (set_command->value_type() != SetVarType::kBool) {
+                                Status status = Status::DataTypeMismatch("Boolean", set_command->value_type_str());
+                                LOG_ERROR(status.message());
+                                RecoverableError(status);
+                            }
+                            query_context->current_session()->SetResultCache(set_command->value_bool());
+                            return true;
+                        }
                         case SessionVariable::kInvalid: {
                             Status status = Status::InvalidCommand(fmt::format("Unknown session variable: {}", set_command->var_name()));
                             LOG_ERROR(status.message());
@@ -157,6 +172,72 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
                             config->SetRecordRunningQuery(flag);
                             break;
                         }
+                        case GlobalOptionIndex::kIngestCPUQuota:
+                        case GlobalOptionIndex::kBackgroundCPUQuota: {
+                            if (set_command->value_type() != SetVarType::kInteger) {
+                                Status status = Status::DataTypeMismatch("Integer", set_command->value_type_str());
+                                LOG_ERROR(status.message());
+                                RecoverableError(status);
+                            }
+                            i64 percent = set_command->value_int();
+                            if (percent < 1 || percent > 100) {
+                                Status status = Status::SetInvalidVarValue(set_command->var_name(), "1 ~ 100");
+                                LOG_ERROR(status.message());
+                                RecoverableError(status);
+                            }
+                            config->SetCPUQuota(config_index, percent);
+                            TaskClass task_class = config_index == GlobalOptionIndex::kIngestCPUQuota ? TaskClass::kIngest : TaskClass::kBackground;
+                            InfinityContext::instance().GetSharedThreadPool().SetQuota(task_class, percent);
+                            break;
+                        }
+                        case GlobalOptionIndex::kProfileSampleRate: {
+                            if (set_command->value_type() != SetVarType::kInteger) {
+                                Status status = Status::DataTypeMismatch("Integer", set_command->value_type_str());
+                                LOG_ERROR(status.message());
+                                RecoverableError(status);
+                            }
+                            i64 sample_rate = set_command->value_int();
+                            if (sample_rate < 0) {
+                                Status status = Status::SetInvalidVarValue(set_command->var_name(), "0 ~ max i64");
+                                LOG_ERROR(status.message());
+                                RecoverableError(status);
+                            }
+                            config->SetProfileSampleRate(sample_rate);
+                            break;
+                        }
+                        case GlobalOptionIndex::kSlowQueryThreshold: {
+                            if (set_command->value_type() != SetVarType::kInteger) {
+                                Status status = Status::DataTypeMismatch("Integer", set_command->value_type_str());
+                                LOG_ERROR(status.message());
+                                RecoverableError(status);
+                            }
+                            i64 threshold_ms = set_command->value_int();
+                            if (threshold_ms < 0 || threshold_ms > MAX_SLOW_QUERY_THRESHOLD) {
+                                Status status = Status::SetInvalidVarValue(set_command->var_name(), fmt::format("0 ~ {}", MAX_SLOW_QUERY_THRESHOLD));
+                                LOG_ERROR(status.message());
+                                RecoverableError(status);
+                            }
+                            config->SetSlowQueryThreshold(threshold_ms);
+                            break;
+                        }
+                        case GlobalOptionIndex::kCompactionIORate: {
+                            if (set_command->value_type() != SetVarType::kInteger) {
+                                Status status = Status::DataTypeMismatch("Integer", set_command->value_type_str());
+                                LOG_ERROR(status.message());
+                                RecoverableError(status);
+                            }
+                            i64 bytes_per_second = set_command->value_int();
+                            if (bytes_per_second < 0) {
+                                Status status = Status::SetInvalidVarValue(set_command->var_name(), "0 ~ max i64");
+                                LOG_ERROR(status.message());
+                                RecoverableError(status);
+                            }
+                            config->SetCompactionIORate(bytes_per_second);
+                            if (auto *compaction_processor = query_context->storage()->compaction_processor(); compaction_processor != nullptr) {
+                                compaction_processor->rate_limiter()->SetRate(bytes_per_second);
+                            }
+                            break;
+                        }
                         case GlobalOptionIndex::kInvalid: {
                             Status status = Status::InvalidCommand(fmt::format("Unknown config: {}", set_command->var_name()));
                             LOG_ERROR(status.message());
@@ -191,7 +272,7 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
             LocalFileSystem fs;
             FileWriter file_writer(fs, export_command->file_name(), 128);
 
-            auto json = QueryProfiler::Serialize(profiler_record).dump();
+            auto json = QueryProfiler::Serialize(profiler_record.get()).dump();
             file_writer.Write(json.c_str(), json.size());
             file_writer.Flush();
             break;
@@ -33,6 +33,10 @@ import default_values;
 import logger;
 import infinity_exception;
 import third_party;
+import storage;
+import compaction_process;
+import compaction_rate_limiter;
+import column_def;
 
 namespace infinity {
 
@@ -138,6 +142,19 @@ bool PhysicalCompact::Execute(QueryContext *query_context, OperatorState *operat
 
     SizeT column_count = table_entry->ColumnCount();
 
+    // charge the background compaction for the bytes it copies, the compaction thread waits them off before the next
+    // compaction, varchar and other variable length data are counted by their inline size
+    CompactionRateLimiter *rate_limiter = nullptr;
+    SizeT row_size = 0;
+    if (compact_type_ == CompactStatementType::kAuto) {
+        if (auto *compaction_processor = query_context->storage()->compaction_processor(); compaction_processor != nullptr) {
+            rate_limiter = compaction_processor->rate_limiter();
+        }
+        for (const auto &column_def : table_entry->column_defs()) {
+            row_size += column_def->type()->Size();
+        }
+    }
+
     auto new_segment = SegmentEntry::NewSegmentEntry(table_entry, Catalog::GetNextSegmentID(table_entry), txn);
     SegmentID new_segment_id = new_segment->segment_id();
 
@@ -155,8 +172,10 @@ bool PhysicalCompact::Execute(QueryContext *query_context, OperatorState *operat
                 input_column_vectors.emplace_back(column_block_entry->GetColumnVector(buffer_mgr));
             }
             SizeT read_offset = 0;
+            Vector<u64> visible;
+            BlockOffset visible_row_count = block_entry->GetVisibleMask(begin_ts, visible);
             while (true) {
-                auto [row_begin, row_end] = block_entry->GetVisibleRange(begin_ts, read_offset);
+                auto [row_begin, row_end] = BlockEntry::GetVisibleRange(visible, visible_row_count, read_offset);
                 SizeT read_size = row_end - row_begin;
                 if (read_size == 0) {
                     break;
@@ -166,6 +185,9 @@ bool PhysicalCompact::Execute(QueryContext *query_context, OperatorState *operat
                     if (read_size1 == 0) {
                         return;
                     }
+                    if (rate_limiter != nullptr) {
+                        rate_limiter->Charge(read_size1 * row_size);
+                    }
                     new_block->AppendBlock(input_column_vectors, row_begin, read_size1, buffer_mgr);
                     RowID new_row_id(new_segment_id, new_block->block_id() * block_capacity + new_block->row_count());
                     remapper.AddMap(segment_id, block_id, row_begin, new_row_id);
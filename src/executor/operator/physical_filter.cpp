@@ -27,6 +27,9 @@ import operator_state;
 import expression_state;
 import expression_selector;
 import data_block;
+import selection;
+import bitmask_buffer;
+import fused_predicate;
 import logger;
 import third_party;
 
@@ -55,6 +58,24 @@ void PhysicalFilter::Init() {
     //    output_ = DataTable::Make(table_def, TableType::kIntermediate);
 }
 
+SharedPtr<Selection>
+PhysicalFilter::SelectRows(ExpressionSelector &selector, SharedPtr<ExpressionState> &condition_state, const DataBlock *input_data_block) const {
+    SizeT row_count = input_data_block->row_count();
+    if (fused_predicate_.get() != nullptr) {
+        Vector<u64> row_bits(BitmaskBuffer::UnitCount(row_count));
+        if (fused_predicate_->Evaluate(*input_data_block, row_count, row_bits.data())) {
+            SharedPtr<Selection> selection = MakeShared<Selection>();
+            selection->Initialize(row_count);
+            ExpressionSelector::Select(row_bits.data(), row_count, selection);
+            return selection;
+        }
+    }
+    if (condition_state.get() == nullptr) {
+        condition_state = ExpressionState::CreateState(condition_);
+    }
+    return selector.Select(condition_, condition_state, input_data_block, row_count);
+}
+
 bool PhysicalFilter::Execute(QueryContext *, OperatorState *operator_state) {
     auto* prev_op_state = operator_state->prev_op_state_;
     auto* filter_operator_state = static_cast<FilterOperatorState *>(operator_state);
@@ -67,19 +88,36 @@ bool PhysicalFilter::Execute(QueryContext *, OperatorState *operator_state) {
 
     SizeT input_block_count = prev_op_state->data_block_array_.size();
 
+    // created on the first block which the fused predicate can't evaluate
+    SharedPtr<ExpressionState> &condition_state = filter_operator_state->condition_state_;
+
     for(SizeT block_idx = 0; block_idx < input_block_count; ++ block_idx) {
+        // selector contains a pointer to input data, which should not be shared by multiple tasks
+        ExpressionSelector selector;
+
+        if (late_materialize_) {
+            UniquePtr<DataBlock> &input_data_block = prev_op_state->data_block_array_[block_idx];
+            input_data_block->Materialize();
+            SharedPtr<Selection> selection = SelectRows(selector, condition_state, input_data_block.get());
+            SizeT selected_count = selection->Size();
+            if (selected_count < input_data_block->row_count()) {
+                input_data_block->SetSelection(std::move(selection));
+            }
+            operator_state->data_block_array_.emplace_back(std::move(input_data_block));
+            LOG_TRACE(fmt::format("{} rows after filter", selected_count));
+            continue;
+        }
 
         // create uninitialized data block for output
         UniquePtr<DataBlock> data_block = DataBlock::MakeUniquePtr();
         DataBlock* output_data_block = data_block.get();
         operator_state->data_block_array_.emplace_back(std::move(data_block));
 
-        SharedPtr<ExpressionState> condition_state = ExpressionState::CreateState(condition_);
         DataBlock* input_data_block = prev_op_state->data_block_array_[block_idx].get();
 
-        // selector contains a pointer to input data, which should not be shared by multiple tasks
-        ExpressionSelector selector;
-        SizeT selected_count = selector.Select(condition_, condition_state, input_data_block, output_data_block, input_data_block->row_count());
+        SharedPtr<Selection> selection = SelectRows(selector, condition_state, input_data_block);
+        SizeT selected_count = selection->Size();
+        output_data_block->Init(input_data_block, selection);
 
         LOG_TRACE(fmt::format("{} rows after filter", selected_count));
     }
@@ -28,13 +28,19 @@ import load_meta;
 import infinity_exception;
 import internal_types;
 import data_type;
+import fused_predicate;
+import expression_state;
+import expression_selector;
+import data_block;
+import selection;
 
 namespace infinity {
 
 export class PhysicalFilter : public PhysicalOperator {
 public:
     explicit PhysicalFilter(u64 id, UniquePtr<PhysicalOperator> left, SharedPtr<BaseExpression> condition, SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kFilter, std::move(left), nullptr, id, load_metas), condition_(std::move(condition)) {}
+        : PhysicalOperator(PhysicalOperatorType::kFilter, std::move(left), nullptr, id, load_metas), condition_(std::move(condition)),
+          fused_predicate_(FusedPredicate::Make(condition_)) {}
 
     ~PhysicalFilter() override = default;
 
@@ -50,8 +56,21 @@ public:
 
     inline const SharedPtr<BaseExpression> &condition() const { return condition_; }
 
+    // output the input blocks with a selection of the surviving rows instead of copying them,
+    // only enabled when the parent operator handles DataBlock selection
+    inline void EnableLateMaterialize() { late_materialize_ = true; }
+
+    inline bool late_materialize() const { return late_materialize_; }
+
+    // nullptr if the condition isn't an AND/OR tree of comparisons between a fixed width column and a constant
+    inline const FusedPredicate *fused_predicate() const { return fused_predicate_.get(); }
+
 private:
+    SharedPtr<Selection> SelectRows(ExpressionSelector &selector, SharedPtr<ExpressionState> &condition_state, const DataBlock *input_data_block) const;
+
     SharedPtr<BaseExpression> condition_;
+    UniquePtr<FusedPredicate> fused_predicate_;
+    bool late_materialize_{false};
 
     SharedPtr<DataTable> input_table_{};
 };
@@ -101,7 +101,7 @@ SizeT UnSyncCounter::Offset(SizeT row_count) {
     i64 last_offset = offset_ - row_count;
 
     if (last_offset > 0) {
-        result = row_count - 1;
+        result = row_count;
         offset_ = last_offset;
     } else {
         result = offset_;
@@ -185,7 +185,7 @@ bool PhysicalLimit::Execute(QueryContext *query_context,
         }
         SizeT row_count = input_blocks[block_id]->row_count();
 
-        if (offset > row_count) {
+        if (offset >= row_count) {
             offset -= row_count;
         } else {
             block_start_idx = block_id;
@@ -202,9 +202,11 @@ bool PhysicalLimit::Execute(QueryContext *query_context,
         auto block = DataBlock::MakeUniquePtr();
 
         block->Init(input_block->types());
-        if (limit >= row_count) {
-            block->AppendWith(input_block.get(), offset, row_count);
-            limit -= row_count;
+        // the first block is copied from the offset on
+        SizeT copy_count = row_count - offset;
+        if (limit >= copy_count) {
+            block->AppendWith(input_block.get(), offset, copy_count);
+            limit -= copy_count;
         } else {
             block->AppendWith(input_block.get(), offset, limit);
             limit = 0;
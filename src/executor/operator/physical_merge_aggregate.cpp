@@ -26,6 +26,8 @@ import data_block;
 
 import physical_aggregate;
 import aggregate_expression;
+import aggregate_function;
+import column_vector;
 
 import infinity_exception;
 
@@ -47,6 +49,7 @@ bool PhysicalMergeAggregate::Execute(QueryContext *query_context, OperatorState
     if (merge_aggregate_op_state->input_complete_) {
 
         LOG_TRACE("PhysicalMergeAggregate::Input is complete");
+        FinalizePartialStates(merge_aggregate_op_state);
         for (auto &output_block : merge_aggregate_op_state->data_block_array_) {
             output_block->Finalize();
         }
@@ -59,6 +62,7 @@ bool PhysicalMergeAggregate::Execute(QueryContext *query_context, OperatorState
 }
 
 void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorState *op_state) {
+    MergePartialStates(op_state);
     if (op_state->data_block_array_.empty()) {
         op_state->data_block_array_.emplace_back(std::move(op_state->input_data_block_));
         LOG_TRACE("Physical MergeAggregate execute first block");
@@ -66,6 +70,9 @@ void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorS
         auto agg_op = dynamic_cast<PhysicalAggregate *>(this->left());
         auto aggs_size = agg_op->aggregates_.size();
         for (SizeT col_idx = 0; col_idx < aggs_size; ++col_idx) {
+            if (agg_op->IsPartialState(col_idx)) {
+                continue;
+            }
             auto agg_expression = static_cast<AggregateExpression *>(agg_op->aggregates_[col_idx].get());
 
             auto function_name = agg_expression->aggregate_function_.GetFuncName();
@@ -108,6 +115,62 @@ void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorS
     }
 }
 
+void PhysicalMergeAggregate::MergePartialStates(MergeAggregateOperatorState *op_state) {
+    auto agg_op = dynamic_cast<PhysicalAggregate *>(this->left());
+    SizeT aggs_size = agg_op->aggregates_.size();
+    if (op_state->states_.empty()) {
+        op_state->states_.resize(aggs_size);
+        for (SizeT col_idx = 0; col_idx < aggs_size; ++col_idx) {
+            if (!agg_op->IsPartialState(col_idx)) {
+                continue;
+            }
+            const AggregateFunction &function = static_cast<AggregateExpression *>(agg_op->aggregates_[col_idx].get())->aggregate_function_;
+            op_state->states_[col_idx] = function.InitState();
+            function.init_func_(op_state->states_[col_idx].get());
+        }
+    }
+    if (op_state->input_data_block_.get() == nullptr || op_state->input_data_block_->row_count() == 0) {
+        return;
+    }
+    for (SizeT col_idx = 0; col_idx < aggs_size; ++col_idx) {
+        if (op_state->states_[col_idx].get() == nullptr) {
+            continue;
+        }
+        const AggregateFunction &function = static_cast<AggregateExpression *>(agg_op->aggregates_[col_idx].get())->aggregate_function_;
+        Value partial_state = op_state->input_data_block_->GetValue(col_idx, 0);
+        function.merge_func_(op_state->states_[col_idx].get(), partial_state.GetVarchar());
+    }
+}
+
+void PhysicalMergeAggregate::FinalizePartialStates(MergeAggregateOperatorState *op_state) {
+    if (op_state->data_block_array_.empty() || op_state->data_block_array_[0]->row_count() == 0) {
+        return;
+    }
+    auto agg_op = dynamic_cast<PhysicalAggregate *>(this->left());
+    SizeT aggs_size = agg_op->aggregates_.size();
+    bool has_partial_state = false;
+    for (SizeT col_idx = 0; col_idx < aggs_size; ++col_idx) {
+        has_partial_state |= agg_op->IsPartialState(col_idx);
+    }
+    if (!has_partial_state) {
+        return;
+    }
+
+    DataBlock *merged_block = op_state->data_block_array_[0].get();
+    auto output_block = DataBlock::MakeUniquePtr();
+    output_block->Init(*output_types_);
+    for (SizeT col_idx = 0; col_idx < aggs_size; ++col_idx) {
+        ColumnVector &output_column = *output_block->column_vectors[col_idx];
+        if (op_state->states_[col_idx].get() != nullptr) {
+            const AggregateFunction &function = static_cast<AggregateExpression *>(agg_op->aggregates_[col_idx].get())->aggregate_function_;
+            function.AppendResult(op_state->states_[col_idx].get(), output_column, false);
+        } else {
+            output_column.AppendValue(merged_block->GetValue(col_idx, 0));
+        }
+    }
+    op_state->data_block_array_[0] = std::move(output_block);
+}
+
 template <typename T>
 void PhysicalMergeAggregate::HandleAggregateFunction(const String &function_name, MergeAggregateOperatorState *op_state, SizeT col_idx) {
     LOG_TRACE(function_name);
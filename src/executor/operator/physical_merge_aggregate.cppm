@@ -73,6 +73,12 @@ public:
 
     void SimpleMergeAggregateExecute(MergeAggregateOperatorState *merge_aggregate_op_state);
 
+    // merge the partial states of the input block into the states of the operator
+    void MergePartialStates(MergeAggregateOperatorState *op_state);
+
+    // replace the output block with the results of the merged states and the values of the other aggregates
+    void FinalizePartialStates(MergeAggregateOperatorState *op_state);
+
     template <typename T>
     void UpdateData(MergeAggregateOperatorState *op_state, MathOperation<T> operation, SizeT col_idx);
 
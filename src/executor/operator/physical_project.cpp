@@ -25,6 +25,9 @@ import expression_evaluator;
 import expression_state;
 import data_block;
 import column_vector;
+import base_expression;
+import reference_expression;
+import expression_type;
 
 import infinity_exception;
 
@@ -32,6 +35,40 @@ module physical_project;
 
 namespace infinity {
 
+namespace {
+
+// mark the input columns read by the expression
+// return false if the expression may read input columns in a way not tracked here
+bool CollectUsedColumns(const SharedPtr<BaseExpression> &expr, Vector<bool> &column_used) {
+    switch (expr->type()) {
+        case ExpressionType::kReference: {
+            SizeT column_index = static_cast<const ReferenceExpression *>(expr.get())->column_index();
+            if (column_index >= column_used.size()) {
+                return false;
+            }
+            column_used[column_index] = true;
+            return true;
+        }
+        case ExpressionType::kValue: {
+            return true;
+        }
+        case ExpressionType::kCast:
+        case ExpressionType::kFunction: {
+            for (const auto &argument : expr->arguments()) {
+                if (!CollectUsedColumns(argument, column_used)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+} // namespace
+
 void PhysicalProject::Init() {
     //    executor.Init(expressions_);
     //
@@ -80,6 +117,19 @@ bool PhysicalProject::Execute(QueryContext *, OperatorState *operator_state) {
         SizeT input_block_count = prev_op_state->data_block_array_.size();
         for(SizeT block_idx = 0; block_idx < input_block_count; ++ block_idx) {
             DataBlock* input_data_block = prev_op_state->data_block_array_[block_idx].get();
+            if (input_data_block->HasSelection()) {
+                // rows filtered out by the child are dropped here, only the projected columns are copied
+                Vector<bool> column_used(input_data_block->column_count(), false);
+                bool all_tracked = true;
+                for (const auto &expr : expressions_) {
+                    all_tracked = all_tracked && CollectUsedColumns(expr, column_used);
+                }
+                if (all_tracked) {
+                    input_data_block->Materialize(column_used);
+                } else {
+                    input_data_block->Materialize();
+                }
+            }
 
             project_operator_state->data_block_array_.emplace_back(DataBlock::MakeUniquePtr());
             DataBlock* output_data_block = project_operator_state->data_block_array_.back().get();
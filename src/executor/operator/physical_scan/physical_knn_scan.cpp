@@ -66,6 +66,9 @@ import block_entry;
 import segment_index_entry;
 import segment_entry;
 import abstract_hnsw;
+import index_diskann;
+import diskann_index;
+import hnsw_common;
 
 namespace infinity {
 
@@ -214,9 +217,17 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
             }
             // check index type
             if (auto index_type = table_index_entry->index_base()->index_type_;
-                index_type != IndexType::kIVFFlat and index_type != IndexType::kHnsw) {
+                index_type != IndexType::kIVFFlat and index_type != IndexType::kHnsw and index_type != IndexType::kDiskAnn) {
                 LOG_TRACE(fmt::format("KnnScan: PlanWithIndex(): Skipping non-knn index."));
                 continue;
+            } else if (index_type == IndexType::kDiskAnn) {
+                // the graph ranks by the metric it is built for, the other distances scan the rows
+                MetricType metric_type = static_cast<const IndexDiskAnn *>(table_index_entry->index_base())->metric_type_;
+                if (!(metric_type == MetricType::kMetricL2 && knn_expr->distance_type_ == KnnDistanceType::kL2) &&
+                    !(metric_type == MetricType::kMetricInnerProduct && knn_expr->distance_type_ == KnnDistanceType::kInnerProduct)) {
+                    LOG_TRACE(fmt::format("KnnScan: PlanWithIndex(): Skipping diskann index of another metric."));
+                    continue;
+                }
             }
 
             // Fill the segment with index
@@ -258,6 +269,11 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
     auto dist_func = static_cast<KnnDistance1<DataType> *>(knn_scan_function_data->knn_distance_.get());
     auto merge_heap = static_cast<MergeKnn<DataType, C> *>(knn_scan_function_data->merge_knn_base_.get());
     auto query = static_cast<const DataType *>(knn_scan_shared_data->query_embedding_);
+    // the k-th distance found by all tasks, candidates worse than it are skipped
+    auto topk_threshold = static_cast<KnnThreshold<DataType, C> *>(knn_scan_shared_data->topk_threshold_.get());
+    if (topk_threshold != nullptr) {
+        merge_heap->UpdateThreshold(0, topk_threshold->Get());
+    }
 
     SizeT index_task_n = knn_scan_shared_data->index_entries_->size();
     SizeT brute_task_n = knn_scan_shared_data->block_column_entries_->size();
@@ -398,6 +414,12 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                     auto hnsw_search = [&](BufferHandle index_handle, bool with_lock, int chunk_id = -1) {
                         AbstractHnsw<f32, SegmentOffset> abstract_hnsw(index_handle.GetDataMut(), index_hnsw);
 
+                        // stop at the k-th distance of the other segments, smaller is better in the index
+                        DataType dist_bound = std::numeric_limits<DataType>::max();
+                        if (topk_threshold != nullptr) {
+                            dist_bound = C<DataType, RowID>::IsMax ? topk_threshold->Get() : -topk_threshold->Get();
+                        }
+
                         for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
                             if (opt_param.param_name_ == "ef") {
                                 u64 ef = std::stoull(opt_param.param_value_);
@@ -417,24 +439,26 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                                 if (segment_entry->CheckAnyDelete(begin_ts)) {
                                     DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
                                     std::tie(result_n1, d_ptr, l_ptr) =
-                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock);
+                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock, dist_bound);
                                 } else {
                                     BitmaskFilter<SegmentOffset> filter(bitmask);
                                     std::tie(result_n1, d_ptr, l_ptr) =
-                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock);
+                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock, dist_bound);
                                 }
                             } else {
                                 SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
                                 if (segment_entry->CheckAnyDelete(begin_ts)) {
                                     DeleteFilter filter(segment_entry, begin_ts, max_segment_offset);
                                     std::tie(result_n1, d_ptr, l_ptr) =
-                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock);
+                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock, dist_bound);
                                 } else {
                                     if (!with_lock) {
-                                        std::tie(result_n1, d_ptr, l_ptr) = abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, false);
+                                        std::tie(result_n1, d_ptr, l_ptr) =
+                                            abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, false, dist_bound);
                                     } else {
                                         AppendFilter filter(max_segment_offset);
-                                        std::tie(result_n1, d_ptr, l_ptr) = abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, true);
+                                        std::tie(result_n1, d_ptr, l_ptr) =
+                                            abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, true, dist_bound);
                                     }
                                 }
                             }
@@ -482,6 +506,9 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                             }
                             merge_heap->Search(0, d_ptr.get(), row_ids.get(), result_n);
                         }
+                        if (topk_threshold != nullptr) {
+                            topk_threshold->Update(merge_heap->GetKthDistance(0));
+                        }
                     };
 
                     auto [chunk_index_entries, memory_index_entry] = segment_index_entry->GetHnswIndexSnapshot();
@@ -499,6 +526,97 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
 
                     break;
                 }
+                case IndexType::kDiskAnn: {
+                    DiskAnnSearchOption search_option{DISKANN_SEARCH_LIST_SIZE, DISKANN_BEAM_WIDTH};
+                    for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
+                        if (opt_param.param_name_ == "search_list_size") {
+                            search_option.search_list_size_ = std::stoull(opt_param.param_value_);
+                        } else if (opt_param.param_name_ == "beam_width") {
+                            search_option.beam_width_ = std::stoull(opt_param.param_value_);
+                        }
+                    }
+
+                    auto diskann_search = [&](const DiskAnnIndex *index, const FilterBase<SegmentOffset> *filter) {
+                        for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                            const DataType *query =
+                                static_cast<const DataType *>(knn_scan_shared_data->query_embedding_) + query_idx * knn_scan_shared_data->dimension_;
+                            auto [result_n, d_ptr, l_ptr] = index->KnnSearch(query, knn_scan_shared_data->topk_, search_option, filter);
+                            if (knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kInnerProduct) {
+                                for (SizeT i = 0; i < result_n; ++i) {
+                                    d_ptr[i] = -d_ptr[i];
+                                }
+                            }
+                            auto row_ids = MakeUniqueForOverwrite<RowID[]>(result_n);
+                            for (SizeT i = 0; i < result_n; ++i) {
+                                row_ids[i] = RowID{segment_id, l_ptr[i]};
+                            }
+                            merge_heap->Search(query_idx, d_ptr.get(), row_ids.get(), result_n);
+                        }
+                    };
+
+                    // the chunks hold the rows committed before they were built, newer rows are only visible to newer txns
+                    SegmentOffset covered_row_count = 0;
+                    for (const auto &chunk_index_entry : segment_index_entry->GetDiskAnnIndexSnapshot()) {
+                        if (!chunk_index_entry->CheckVisible(txn)) {
+                            continue;
+                        }
+                        covered_row_count = std::max<SegmentOffset>(covered_row_count,
+                                                                    chunk_index_entry->base_rowid_.segment_offset_ + chunk_index_entry->row_count_);
+                        BufferHandle index_handle = chunk_index_entry->GetIndex();
+                        const auto *index = static_cast<const DiskAnnIndex *>(index_handle.GetData());
+                        if (use_bitmask) {
+                            if (segment_entry->CheckAnyDelete(begin_ts)) {
+                                DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
+                                diskann_search(index, &filter);
+                            } else {
+                                BitmaskFilter<SegmentOffset> filter(bitmask);
+                                diskann_search(index, &filter);
+                            }
+                        } else {
+                            SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
+                            if (segment_entry->CheckAnyDelete(begin_ts)) {
+                                DeleteFilter filter(segment_entry, begin_ts, max_segment_offset);
+                                diskann_search(index, &filter);
+                            } else {
+                                diskann_search(index, nullptr);
+                            }
+                        }
+                    }
+
+                    // diskann has no memory index, scan the rows appended after the chunks until OPTIMIZE rebuilds them
+                    BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
+                    ColumnID column_id = segment_index_entry->table_index_entry()->column_def()->id();
+                    for (const auto *block_entry : block_index->segment_block_index_.at(segment_id).block_map_) {
+                        const auto block_id = block_entry->block_id();
+                        const auto row_count = block_entry->row_count();
+                        const SegmentOffset block_offset = block_entry->segment_offset();
+                        if (block_offset + row_count <= covered_row_count) {
+                            continue;
+                        }
+                        Bitmask block_bitmask;
+                        if (!this->CalculateFilterBitmask(segment_id, block_id, row_count, block_bitmask)) {
+                            continue;
+                        }
+                        block_entry->SetDeleteBitmask(begin_ts, block_bitmask);
+                        for (SegmentOffset offset = block_offset; offset < covered_row_count; ++offset) {
+                            block_bitmask.SetFalse(offset - block_offset);
+                        }
+                        ColumnVector column_vector = block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(buffer_mgr);
+                        auto data = reinterpret_cast<const DataType *>(column_vector.data());
+                        merge_heap->Search(query,
+                                           data,
+                                           knn_scan_shared_data->dimension_,
+                                           dist_func->dist_func_,
+                                           row_count,
+                                           segment_id,
+                                           block_id,
+                                           block_bitmask);
+                    }
+                    if (topk_threshold != nullptr) {
+                        topk_threshold->Update(merge_heap->GetKthDistance(0));
+                    }
+                    break;
+                }
                 default: {
                     Status status = Status::NotSupport("Not implemented index type");
                     LOG_ERROR(status.message());
@@ -507,17 +625,22 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
             }
         }
     }
+    if (topk_threshold != nullptr) {
+        topk_threshold->Update(merge_heap->GetKthDistance(0));
+    }
     if (knn_scan_shared_data->current_index_idx_ >= index_task_n && knn_scan_shared_data->current_block_idx_ >= brute_task_n) {
         LOG_TRACE(fmt::format("KnnScan: {} task finished", knn_scan_function_data->task_id_));
         // all task Complete
 
         merge_heap->End();
-        i64 result_n = std::min(knn_scan_shared_data->topk_, merge_heap->total_count());
+        // candidates skipped by the threshold are scanned but not kept, total_count() isn't the number of results
+        i64 result_n = knn_scan_shared_data->topk_;
 
         SizeT query_n = knn_scan_shared_data->query_count_;
         Vector<char *> result_dists_list;
         Vector<RowID *> row_ids_list;
         for (SizeT query_id = 0; query_id < query_n; ++query_id) {
+            result_n = std::min(result_n, merge_heap->result_count(query_id));
             result_dists_list.emplace_back(reinterpret_cast<char *>(merge_heap->GetDistancesByIdx(query_id)));
             row_ids_list.emplace_back(merge_heap->GetIDsByIdx(query_id));
         }
@@ -65,7 +65,7 @@ import embedding_info;
 import buffer_manager;
 import buffer_handle;
 import match_tensor_scan_function_data;
-import mlas_matrix_multiply;
+import maxsim_kernel;
 import physical_fusion;
 import filter_value_type_classification;
 
@@ -413,26 +413,47 @@ struct MaxSimOp<float, float> {
                        const u32 query_embedding_num,
                        const u32 target_embedding_num,
                        const u32 basic_embedding_dimension) {
-        auto output_ptr = MakeUniqueForOverwrite<float[]>(query_embedding_num * target_embedding_num);
-        matrixA_multiply_transpose_matrixB_output_to_C(reinterpret_cast<const float *>(query_tensor_ptr),
-                                                       reinterpret_cast<const float *>(target_tensor_ptr),
-                                                       query_embedding_num,
-                                                       target_embedding_num,
-                                                       basic_embedding_dimension,
-                                                       output_ptr.get());
-        float maxsim_score = 0.0f;
-        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
-            const float *query_ip_ptr = output_ptr.get() + query_i * target_embedding_num;
-            float max_score_i = std::numeric_limits<float>::lowest();
-            for (u32 k = 0; k < target_embedding_num; ++k) {
-                max_score_i = std::max(max_score_i, query_ip_ptr[k]);
-            }
-            maxsim_score += max_score_i;
-        }
-        return maxsim_score;
+        return MaxSimF32(reinterpret_cast<const float *>(query_tensor_ptr),
+                         reinterpret_cast<const float *>(target_tensor_ptr),
+                         query_embedding_num,
+                         target_embedding_num,
+                         basic_embedding_dimension);
     }
 };
 
+// other numeric types are converted to float once, so that they share the tiled / GEMM kernels of MaxSimF32
+template <typename ElemT>
+const float *ToF32Embeddings(const char *raw_ptr, const SizeT elem_num, UniquePtr<float[]> &buffer) {
+    if constexpr (std::is_same_v<ElemT, float>) {
+        return reinterpret_cast<const float *>(raw_ptr);
+    } else if constexpr (std::is_same_v<ElemT, bool>) {
+        buffer = MakeUniqueForOverwrite<float[]>(elem_num);
+        ExpandBitsToF32(reinterpret_cast<const u8 *>(raw_ptr), elem_num, buffer.get());
+        return buffer.get();
+    } else {
+        const auto elem_ptr = reinterpret_cast<const ElemT *>(raw_ptr);
+        buffer = MakeUniqueForOverwrite<float[]>(elem_num);
+        for (SizeT i = 0; i < elem_num; ++i) {
+            buffer[i] = static_cast<float>(elem_ptr[i]);
+        }
+        return buffer.get();
+    }
+}
+
+template <typename TensorElemT, typename QueryElemT>
+float MaxSimAsF32(const char *raw_query_tensor_ptr,
+                  const char *raw_target_tensor_ptr,
+                  const u32 query_embedding_num,
+                  const u32 target_embedding_num,
+                  const u32 basic_embedding_dimension) {
+    UniquePtr<float[]> query_buffer;
+    UniquePtr<float[]> target_buffer;
+    const float *query_ptr = ToF32Embeddings<QueryElemT>(raw_query_tensor_ptr, SizeT(query_embedding_num) * basic_embedding_dimension, query_buffer);
+    const float *target_ptr =
+        ToF32Embeddings<TensorElemT>(raw_target_tensor_ptr, SizeT(target_embedding_num) * basic_embedding_dimension, target_buffer);
+    return MaxSimF32(query_ptr, target_ptr, query_embedding_num, target_embedding_num, basic_embedding_dimension);
+}
+
 template <typename TensorElemT, typename QueryElemT>
     requires(!std::is_same_v<TensorElemT, bool> && !std::is_same_v<QueryElemT, bool>)
 struct MaxSimOp<TensorElemT, QueryElemT> {
@@ -441,24 +462,19 @@ struct MaxSimOp<TensorElemT, QueryElemT> {
                        const u32 query_embedding_num,
                        const u32 target_embedding_num,
                        const u32 basic_embedding_dimension) {
-        const auto query_tensor_ptr = reinterpret_cast<const QueryElemT *>(raw_query_tensor_ptr);
-        const auto target_tensor_ptr = reinterpret_cast<const TensorElemT *>(raw_target_tensor_ptr);
-        auto output_ptr = MakeUniqueForOverwrite<float[]>(query_embedding_num * target_embedding_num);
-        float maxsim_score = 0.0f;
-        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
-            float max_score_i = std::numeric_limits<float>::lowest();
-            for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
-                const auto query_ptr = query_tensor_ptr + query_i * basic_embedding_dimension;
-                const auto target_ptr = target_tensor_ptr + target_j * basic_embedding_dimension;
-                float score_ij = 0.0f;
-                for (u32 k = 0; k < basic_embedding_dimension; ++k) {
-                    score_ij += static_cast<float>(query_ptr[k]) * static_cast<float>(target_ptr[k]);
-                }
-                max_score_i = std::max(max_score_i, score_ij);
-            }
-            maxsim_score += max_score_i;
+        if constexpr (std::is_same_v<TensorElemT, i8> && std::is_same_v<QueryElemT, i8>) {
+            return MaxSimI8(reinterpret_cast<const i8 *>(raw_query_tensor_ptr),
+                            reinterpret_cast<const i8 *>(raw_target_tensor_ptr),
+                            query_embedding_num,
+                            target_embedding_num,
+                            basic_embedding_dimension);
+        } else {
+            return MaxSimAsF32<TensorElemT, QueryElemT>(raw_query_tensor_ptr,
+                                                        raw_target_tensor_ptr,
+                                                        query_embedding_num,
+                                                        target_embedding_num,
+                                                        basic_embedding_dimension);
         }
-        return maxsim_score;
     }
 };
 
@@ -469,28 +485,11 @@ struct MaxSimOp<bool, bool> {
                        const u32 query_embedding_num,
                        const u32 target_embedding_num,
                        const u32 basic_embedding_dimension) {
-        const auto query_tensor_ptr = reinterpret_cast<const u8 *>(raw_query_tensor_ptr);
-        const auto target_tensor_ptr = reinterpret_cast<const u8 *>(raw_target_tensor_ptr);
-        const auto unit_embedding_bytes = basic_embedding_dimension / 8;
-        auto output_ptr = MakeUniqueForOverwrite<float[]>(query_embedding_num * target_embedding_num);
-        float maxsim_score = 0.0f;
-        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
-            u32 max_score_i = 0;
-            for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
-                const auto query_ptr = query_tensor_ptr + query_i * unit_embedding_bytes;
-                const auto target_ptr = target_tensor_ptr + target_j * unit_embedding_bytes;
-                u32 score_ij = 0;
-                auto is_true = [](const u8 *ptr, const u32 k) -> bool { return ptr[k / 8] & (1u << (k % 8)); };
-                for (u32 k = 0; k < basic_embedding_dimension; ++k) {
-                    if (is_true(query_ptr, k) && is_true(target_ptr, k)) {
-                        ++score_ij;
-                    }
-                }
-                max_score_i = std::max(max_score_i, score_ij);
-            }
-            maxsim_score += max_score_i;
-        }
-        return maxsim_score;
+        return MaxSimBit(reinterpret_cast<const u8 *>(raw_query_tensor_ptr),
+                         reinterpret_cast<const u8 *>(raw_target_tensor_ptr),
+                         query_embedding_num,
+                         target_embedding_num,
+                         basic_embedding_dimension);
     }
 };
 
@@ -501,28 +500,11 @@ struct MaxSimOp<bool, QueryElemT> {
                        const u32 query_embedding_num,
                        const u32 target_embedding_num,
                        const u32 basic_embedding_dimension) {
-        const auto query_tensor_ptr = reinterpret_cast<const QueryElemT *>(raw_query_tensor_ptr);
-        const auto target_tensor_ptr = reinterpret_cast<const u8 *>(raw_target_tensor_ptr);
-        const auto unit_embedding_bytes = basic_embedding_dimension / 8;
-        auto output_ptr = MakeUniqueForOverwrite<float[]>(query_embedding_num * target_embedding_num);
-        float maxsim_score = 0.0f;
-        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
-            float max_score_i = std::numeric_limits<float>::lowest();
-            for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
-                const auto query_ptr = query_tensor_ptr + query_i * basic_embedding_dimension;
-                const auto target_ptr = target_tensor_ptr + target_j * unit_embedding_bytes;
-                float score_ij = 0.0f;
-                auto is_true = [](const u8 *ptr, const u32 k) -> bool { return ptr[k / 8] & (1u << (k % 8)); };
-                for (u32 k = 0; k < basic_embedding_dimension; ++k) {
-                    if (is_true(target_ptr, k)) {
-                        score_ij += static_cast<float>(query_ptr[k]);
-                    }
-                }
-                max_score_i = std::max(max_score_i, score_ij);
-            }
-            maxsim_score += max_score_i;
-        }
-        return maxsim_score;
+        return MaxSimAsF32<bool, QueryElemT>(raw_query_tensor_ptr,
+                                             raw_target_tensor_ptr,
+                                             query_embedding_num,
+                                             target_embedding_num,
+                                             basic_embedding_dimension);
     }
 };
 
@@ -533,28 +515,11 @@ struct MaxSimOp<TensorElemT, bool> {
                        const u32 query_embedding_num,
                        const u32 target_embedding_num,
                        const u32 basic_embedding_dimension) {
-        const auto query_tensor_ptr = reinterpret_cast<const u8 *>(raw_query_tensor_ptr);
-        const auto target_tensor_ptr = reinterpret_cast<const TensorElemT *>(raw_target_tensor_ptr);
-        const auto unit_embedding_bytes = basic_embedding_dimension / 8;
-        auto output_ptr = MakeUniqueForOverwrite<float[]>(query_embedding_num * target_embedding_num);
-        float maxsim_score = 0.0f;
-        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
-            float max_score_i = std::numeric_limits<float>::lowest();
-            for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
-                const auto query_ptr = query_tensor_ptr + query_i * unit_embedding_bytes;
-                const auto target_ptr = target_tensor_ptr + target_j * basic_embedding_dimension;
-                float score_ij = 0.0f;
-                auto is_true = [](const u8 *ptr, const u32 k) -> bool { return ptr[k / 8] & (1u << (k % 8)); };
-                for (u32 k = 0; k < basic_embedding_dimension; ++k) {
-                    if (is_true(query_ptr, k)) {
-                        score_ij += static_cast<float>(target_ptr[k]);
-                    }
-                }
-                max_score_i = std::max(max_score_i, score_ij);
-            }
-            maxsim_score += max_score_i;
-        }
-        return maxsim_score;
+        return MaxSimAsF32<TensorElemT, bool>(raw_query_tensor_ptr,
+                                              raw_target_tensor_ptr,
+                                              query_embedding_num,
+                                              target_embedding_num,
+                                              basic_embedding_dimension);
     }
 };
 
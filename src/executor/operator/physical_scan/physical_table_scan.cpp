@@ -148,8 +148,13 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
                                       block_ids_idx,
                                       block_ids->size()));
             }
+            // Fully visible blocks return an empty mask without loading the block version.
+            table_scan_function_data_ptr->current_visible_row_count_ =
+                current_block_entry->GetVisibleMask(begin_ts, table_scan_function_data_ptr->current_visible_mask_);
         }
-        auto [row_begin, row_end] = current_block_entry->GetVisibleRange(begin_ts, read_offset);
+        auto [row_begin, row_end] = BlockEntry::GetVisibleRange(table_scan_function_data_ptr->current_visible_mask_,
+                                                                table_scan_function_data_ptr->current_visible_row_count_,
+                                                                read_offset);
         if (row_begin == row_end) {
             // we have read all data from current block, move to next block
             ++block_ids_idx;
@@ -14,8 +14,10 @@
 
 module;
 
-#include <string>
+#include <algorithm>
 #include <map>
+#include <string>
+#include <tuple>
 
 module physical_show;
 
@@ -212,8 +214,8 @@ void PhysicalShow::Init() {
         }
         case ShowType::kShowProfiles: {
 
-            output_names_->reserve(9);
-            output_types_->reserve(9);
+            output_names_->reserve(13);
+            output_types_->reserve(13);
 
             output_names_->emplace_back("record_no");
             output_names_->emplace_back("command parsing");
@@ -226,6 +228,8 @@ void PhysicalShow::Init() {
             output_names_->emplace_back("commit");
             output_names_->emplace_back("rollback");
             output_names_->emplace_back("total_cost");
+            output_names_->emplace_back("reason");
+            output_names_->emplace_back("query");
 
             output_types_->emplace_back(varchar_type);
             output_types_->emplace_back(varchar_type);
@@ -238,6 +242,8 @@ void PhysicalShow::Init() {
             output_types_->emplace_back(varchar_type);
             output_types_->emplace_back(varchar_type);
             output_types_->emplace_back(varchar_type);
+            output_types_->emplace_back(varchar_type);
+            output_types_->emplace_back(varchar_type);
             break;
         }
         case ShowType::kShowSegments: {
@@ -419,6 +425,27 @@ void PhysicalShow::Init() {
             output_types_->emplace_back(varchar_type);
             break;
         }
+        case ShowType::kShowProfile: {
+            output_names_->reserve(8);
+            output_types_->reserve(8);
+            output_names_->emplace_back("fragment_id");
+            output_names_->emplace_back("task_id");
+            output_names_->emplace_back("operator");
+            output_names_->emplace_back("runs");
+            output_names_->emplace_back("elapsed");
+            output_names_->emplace_back("input_rows");
+            output_names_->emplace_back("output_rows");
+            output_names_->emplace_back("output_data_size");
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(varchar_type);
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(varchar_type);
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(bigint_type);
+            break;
+        }
         case ShowType::kShowTransactions: {
             output_names_->reserve(2);
             output_types_->reserve(2);
@@ -494,6 +521,10 @@ bool PhysicalShow::Execute(QueryContext *query_context, OperatorState *operator_
             ExecuteShowProfiles(query_context, show_operator_state);
             break;
         }
+        case ShowType::kShowProfile: {
+            ExecuteShowProfile(query_context, show_operator_state);
+            break;
+        }
         case ShowType::kShowSegments: {
             ExecuteShowSegments(query_context, show_operator_state);
             break;
@@ -1082,6 +1113,10 @@ void PhysicalShow::ExecuteShowIndexSegment(QueryContext *query_context, ShowOper
                     chunk_index_entries = std::get<0>(segment_index_entry->GetBMPIndexSnapshot());
                     break;
                 }
+                case IndexType::kDiskAnn: {
+                    chunk_index_entries = segment_index_entry->GetDiskAnnIndexSnapshot();
+                    break;
+                }
                 case IndexType::kInvalid: {
                     Status status3 = Status::InvalidIndexName(index_type_name);
                     LOG_ERROR(fmt::format("{} is invalid.", index_type_name));
@@ -1166,6 +1201,10 @@ void PhysicalShow::ExecuteShowIndexChunk(QueryContext *query_context, ShowOperat
             chunk_indexes = chunk_index_entries;
             break;
         }
+        case IndexType::kDiskAnn: {
+            chunk_indexes = segment_index_entry->GetDiskAnnIndexSnapshot();
+            break;
+        }
         case IndexType::kInvalid: {
             Status status3 = Status::InvalidIndexName(index_type_name);
             LOG_ERROR(fmt::format("{} is invalid.", index_type_name));
@@ -1557,6 +1596,8 @@ void PhysicalShow::ExecuteShowProfiles(QueryContext *query_context, ShowOperator
         MakeShared<ColumnDef>(8, varchar_type, "commit", std::set<ConstraintType>()),
         MakeShared<ColumnDef>(9, varchar_type, "rollback", std::set<ConstraintType>()),
         MakeShared<ColumnDef>(10, varchar_type, "total_cost", std::set<ConstraintType>()),
+        MakeShared<ColumnDef>(11, varchar_type, "reason", std::set<ConstraintType>()),
+        MakeShared<ColumnDef>(12, varchar_type, "query", std::set<ConstraintType>()),
     };
 
     auto catalog = txn->GetCatalog();
@@ -1574,6 +1615,8 @@ void PhysicalShow::ExecuteShowProfiles(QueryContext *query_context, ShowOperator
                                              varchar_type,
                                              varchar_type,
                                              varchar_type,
+                                             varchar_type,
+                                             varchar_type,
                                              varchar_type};
     SizeT row_count = 0;
     output_block_ptr->Init(column_types);
@@ -1586,25 +1629,107 @@ void PhysicalShow::ExecuteShowProfiles(QueryContext *query_context, ShowOperator
         }
 
         // Output record no
-        ValueExpression record_no_expr(Value::MakeVarchar(fmt::format("{}", i)));
+        ValueExpression record_no_expr(Value::MakeVarchar(fmt::format("{}", records[i]->profile_id())));
         record_no_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
 
         // Output each query phase
-        i64 total_cost{};
-        SizeT column_count = column_defs.size();
-        for (SizeT j = 0; j < column_count - 2; ++j) {
-            i64 this_time = records[i]->ElapsedAt(j);
-            total_cost += this_time;
-
-            NanoSeconds duration(this_time);
+        constexpr SizeT phase_count = static_cast<SizeT>(QueryPhase::kInvalid);
+        for (SizeT j = 0; j < phase_count; ++j) {
+            NanoSeconds duration(records[i]->ElapsedAt(j));
             ValueExpression phase_cost_expr(Value::MakeVarchar(BaseProfiler::ElapsedToString(duration)));
             phase_cost_expr.AppendToChunk(output_block_ptr->column_vectors[j + 1]);
         }
 
         // Output total query duration
-        NanoSeconds total_duration(total_cost);
+        NanoSeconds total_duration(records[i]->TotalElapsed());
         ValueExpression phase_cost_expr(Value::MakeVarchar(BaseProfiler::ElapsedToString(total_duration)));
-        phase_cost_expr.AppendToChunk(output_block_ptr->column_vectors.back());
+        phase_cost_expr.AppendToChunk(output_block_ptr->column_vectors[phase_count + 1]);
+
+        // Output why it was profiled and the query
+        ValueExpression reason_expr(Value::MakeVarchar(QueryProfiler::ProfileReasonToString(records[i]->reason())));
+        reason_expr.AppendToChunk(output_block_ptr->column_vectors[phase_count + 2]);
+        ValueExpression query_expr(Value::MakeVarchar(records[i]->query_text()));
+        query_expr.AppendToChunk(output_block_ptr->column_vectors[phase_count + 3]);
+
+        if (++row_count == output_block_ptr->capacity()) {
+            output_block_ptr->Finalize();
+            show_operator_state->output_.emplace_back(std::move(output_block_ptr));
+            output_block_ptr = nullptr;
+            row_count = 0;
+        }
+    }
+
+    if (output_block_ptr) {
+        output_block_ptr->Finalize();
+        show_operator_state->output_.emplace_back(std::move(output_block_ptr));
+    }
+}
+
+void PhysicalShow::ExecuteShowProfile(QueryContext *query_context, ShowOperatorState *show_operator_state) {
+    // hold the record, the history may drop it meanwhile
+    SharedPtr<QueryProfiler> profiler = query_context->storage()->catalog()->GetProfileRecord(*profile_no_);
+    if (profiler.get() == nullptr) {
+        Status status = Status::DataNotExist(fmt::format("The record does not exist: {}", *profile_no_));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+
+    // each operator of a task summed over the runs of the task
+    struct OperatorRow {
+        u64 fragment_id_{};
+        i64 task_id_{};
+        String name_{};
+        i64 runs_{};
+        i64 elapsed_{};
+        i64 input_rows_{};
+        i64 output_rows_{};
+        i64 output_data_size_{};
+    };
+    Vector<OperatorRow> rows;
+    for (const auto &[fragment_id, tasks] : profiler->records()) {
+        for (const auto &[task_id, task_profilers] : tasks) {
+            SizeT first_row = rows.size();
+            for (const auto &task_profiler : task_profilers) {
+                for (SizeT op_idx = 0; op_idx < task_profiler.timings_.size(); ++op_idx) {
+                    const auto &op = task_profiler.timings_[op_idx];
+                    if (first_row + op_idx == rows.size()) {
+                        rows.push_back(OperatorRow{fragment_id, task_id, op.name_});
+                    }
+                    OperatorRow &row = rows[first_row + op_idx];
+                    ++row.runs_;
+                    row.elapsed_ += op.elapsed_;
+                    row.input_rows_ += op.input_rows_;
+                    row.output_rows_ += op.output_rows_;
+                    row.output_data_size_ += op.output_data_size_;
+                }
+            }
+        }
+    }
+    std::stable_sort(rows.begin(), rows.end(), [](const OperatorRow &lhs, const OperatorRow &rhs) {
+        return std::tie(lhs.fragment_id_, lhs.task_id_) < std::tie(rhs.fragment_id_, rhs.task_id_);
+    });
+
+    UniquePtr<DataBlock> output_block_ptr = DataBlock::MakeUniquePtr();
+    output_block_ptr->Init(*output_types_);
+    SizeT row_count = 0;
+    for (const OperatorRow &row : rows) {
+        if (!output_block_ptr) {
+            output_block_ptr = DataBlock::MakeUniquePtr();
+            output_block_ptr->Init(*output_types_);
+        }
+
+        Vector<Value> values{Value::MakeBigInt(row.fragment_id_),
+                             Value::MakeBigInt(row.task_id_),
+                             Value::MakeVarchar(row.name_),
+                             Value::MakeBigInt(row.runs_),
+                             Value::MakeVarchar(BaseProfiler::ElapsedToString(NanoSeconds(row.elapsed_))),
+                             Value::MakeBigInt(row.input_rows_),
+                             Value::MakeBigInt(row.output_rows_),
+                             Value::MakeBigInt(row.output_data_size_)};
+        for (SizeT column_id = 0; column_id < values.size(); ++column_id) {
+            ValueExpression value_expr(values[column_id]);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[column_id]);
+        }
 
         if (++row_count == output_block_ptr->capacity()) {
             output_block_ptr->Finalize();
@@ -2343,6 +2468,90 @@ void PhysicalShow::ExecuteShowConfigs(QueryContext *query_context, ShowOperatorS
         }
     }
 
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(INGEST_CPU_QUOTA_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(std::to_string(global_config->CPUQuota(GlobalOptionIndex::kIngestCPUQuota)));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Percent of the shared thread pool used by full-text inverting and index building.");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(BACKGROUND_CPU_QUOTA_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(std::to_string(global_config->CPUQuota(GlobalOptionIndex::kBackgroundCPUQuota)));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Percent of the shared thread pool used by background work.");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(PROFILE_SAMPLE_RATE_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(std::to_string(global_config->ProfileSampleRate()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Profile one in this many queries into the profile history, 0 to disable.");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(SLOW_QUERY_THRESHOLD_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(std::to_string(global_config->SlowQueryThreshold()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Keep the profile of queries taking at least this many milliseconds, 0 to disable.");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
     {
         {
             // option name
@@ -2679,6 +2888,90 @@ void PhysicalShow::ExecuteShowConfigs(QueryContext *query_context, ShowOperatorS
         }
     }
 
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(COMPACTION_IO_RATE_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(std::to_string(global_config->CompactionIORate()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Bytes per second rewritten by auto compaction, 0 means unlimited");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(COMPACTION_MIN_DELETE_RATIO_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(std::to_string(global_config->CompactionMinDeleteRatio()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Least ratio of deleted rows to rewrite a segment alone");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(COMPACTION_INDEX_REBUILD_COST_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(std::to_string(global_config->CompactionIndexRebuildCost()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Cost to rebuild one index for a row, relative to copying the row");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(COMPACTION_HEAT_WEIGHT_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(std::to_string(global_config->CompactionHeatWeight()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Extra saving of a deleted row each time the queries reading its segment double");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
     {
         {
             // option name
@@ -3142,6 +3435,25 @@ void PhysicalShow::ExecuteShowSessionVariable(QueryContext *query_context, ShowO
             value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
             break;
         }
+        case SessionVariable::kEnableResultCache: {
+            Vector<SharedPtr<ColumnDef>> output_column_defs = {
+                MakeShared<ColumnDef>(0, integer_type, "value", std::set<ConstraintType>()),
+            };
+
+            SharedPtr<TableDef> table_def = TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("variables"), output_column_defs);
+            output_ = MakeShared<DataTable>(table_def, TableType::kResult);
+
+            Vector<SharedPtr<DataType>> output_column_types{
+                bool_type,
+            };
+
+            output_block_ptr->Init(output_column_types);
+
+            Value value = Value::MakeBool(query_context->is_enable_result_cache());
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+            break;
+        }
         default: {
             operator_state->status_ = Status::NoSysVar(object_name_);
             LOG_ERROR(operator_state->status_.message());
@@ -3288,6 +3600,28 @@ void PhysicalShow::ExecuteShowSessionVariables(QueryContext *query_context, Show
                 }
                 break;
             }
+            case SessionVariable::kEnableResultCache: {
+                {
+                    // option name
+                    Value value = Value::MakeVarchar(var_name);
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+                }
+                {
+                    // option value
+                    String enable_result_cache_condition = query_context->is_enable_result_cache() ? "true" : "false";
+                    Value value = Value::MakeVarchar(enable_result_cache_condition);
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+                }
+                {
+                    // option description
+                    Value value = Value::MakeVarchar("Reuse the results of repeated search statements");
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+                }
+                break;
+            }
             default: {
                 operator_state->status_ = Status::NoSysVar(var_name);
                 LOG_ERROR(operator_state->status_.message());
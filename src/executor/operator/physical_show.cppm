@@ -49,10 +49,11 @@ public:
                           Optional<String> index_name,
                           Optional<u64> session_id,
                           Optional<TransactionID> txn_id,
+                          Optional<u64> profile_no,
                           SharedPtr<Vector<LoadMeta>> load_metas)
         : PhysicalOperator(PhysicalOperatorType::kShow, nullptr, nullptr, id, load_metas), scan_type_(type), db_name_(std::move(db_name)),
           object_name_(std::move(object_name)), table_index_(table_index), segment_id_(segment_id), block_id_(block_id), chunk_id_(chunk_id), column_id_(column_id),
-          index_name_(index_name), session_id_(session_id), txn_id_(txn_id) {}
+          index_name_(index_name), session_id_(session_id), txn_id_(txn_id), profile_no_(profile_no) {}
 
     ~PhysicalShow() override = default;
 
@@ -114,6 +115,8 @@ private:
 
     void ExecuteShowProfiles(QueryContext *query_context, ShowOperatorState *operator_state);
 
+    void ExecuteShowProfile(QueryContext *query_context, ShowOperatorState *operator_state);
+
     void ExecuteShowConfigs(QueryContext *query_context, ShowOperatorState *operator_state);
 
     void ExecuteShowSessionVariable(QueryContext *query_context, ShowOperatorState *operator_state);
@@ -149,6 +152,7 @@ private:
     Optional<String> index_name_{};
     Optional<u64> session_id_{};
     Optional<TransactionID> txn_id_{};
+    Optional<u64> profile_no_{};
 
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
@@ -40,6 +40,14 @@ void PhysicalSink::Init() {}
 bool PhysicalSink::Execute(QueryContext *, OperatorState *) { return true; }
 
 bool PhysicalSink::Execute(QueryContext *, FragmentContext *fragment_context, SinkState *sink_state) {
+    if (OperatorState *prev_op_state = sink_state->prev_op_state_; prev_op_state != nullptr) {
+        // blocks leaving the fragment can't carry a selection, copy the selected rows now
+        for (auto &data_block : prev_op_state->data_block_array_) {
+            if (data_block.get() != nullptr and data_block->HasSelection()) {
+                data_block->Materialize();
+            }
+        }
+    }
     switch (sink_state->state_type_) {
         case SinkStateType::kInvalid: {
             String error_message = "Invalid sinker type";
@@ -37,6 +37,7 @@ import internal_types;
 import column_def;
 import data_type;
 import segment_entry;
+import aggregate_function;
 
 namespace infinity {
 
@@ -67,10 +68,10 @@ export struct OperatorState {
 
 // Aggregate
 export struct AggregateOperatorState : public OperatorState {
-    inline explicit AggregateOperatorState(Vector<UniquePtr<char[]>> states)
+    inline explicit AggregateOperatorState(Vector<AggregateStatePtr> states)
         : OperatorState(PhysicalOperatorType::kAggregate), states_(std::move(states)) {}
 
-    Vector<UniquePtr<char[]>> states_;
+    Vector<AggregateStatePtr> states_;
 };
 
 // Merge Aggregate
@@ -81,6 +82,8 @@ export struct MergeAggregateOperatorState : public OperatorState {
     // Vector<UniquePtr<DataBlock>> input_data_blocks_{nullptr};
     UniquePtr<DataBlock> input_data_block_{nullptr};
     bool input_complete_{false};
+    // the merged states of the aggregates output as partial states, null for the others
+    Vector<AggregateStatePtr> states_{};
 };
 
 // Merge Parallel Aggregate
@@ -158,6 +161,9 @@ export struct MergeKnnOperatorState : public OperatorState {
 // Filter
 export struct FilterOperatorState : public OperatorState {
     inline explicit FilterOperatorState() : OperatorState(PhysicalOperatorType::kFilter) {}
+
+    // created on the first block and reused by the following ones
+    SharedPtr<ExpressionState> condition_state_{};
 };
 
 // IndexScan
@@ -605,6 +605,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildAggregate(const SharedPtr<Logi
     if (tasklet_count == 1) {
         return physical_agg_op;
     } else {
+        physical_agg_op->SetPartialStates();
         return MakeUnique<PhysicalMergeAggregate>(query_context_ptr_->GetNextNodeID(),
                                                   logical_aggregate->base_table_ref_,
                                                   std::move(physical_agg_op),
@@ -717,6 +718,10 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildLimit(const SharedPtr<LogicalN
 
     SharedPtr<LogicalLimit> logical_limit = static_pointer_cast<LogicalLimit>(logical_operator);
     UniquePtr<PhysicalOperator> input_physical_operator = BuildPhysicalOperator(input_logical_node);
+    if (input_physical_operator->operator_type() == PhysicalOperatorType::kFilter) {
+        // limit copies only the rows it outputs
+        static_cast<PhysicalFilter *>(input_physical_operator.get())->EnableLateMaterialize();
+    }
     if (input_physical_operator->TaskletCount() <= 1) {
         return MakeUnique<PhysicalLimit>(logical_operator->node_id(),
                                          std::move(input_physical_operator),
@@ -817,6 +822,10 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildProjection(const SharedPtr<Log
     UniquePtr<PhysicalOperator> input_physical_operator{};
     if (input_logical_node.get() != nullptr) {
         input_physical_operator = BuildPhysicalOperator(input_logical_node);
+        if (input_physical_operator->operator_type() == PhysicalOperatorType::kFilter) {
+            // project copies only the selected rows of the projected columns
+            static_cast<PhysicalFilter *>(input_physical_operator.get())->EnableLateMaterialize();
+        }
     }
     return MakeUnique<PhysicalProject>(logical_operator->node_id(),
                                        logical_project->table_index_,
@@ -874,6 +883,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildShow(const SharedPtr<LogicalNo
                                     logical_show->index_name(),
                                     logical_show->session_id(),
                                     logical_show->transaction_id(),
+                                    logical_show->profile_no(),
                                     logical_operator->load_metas());
 }
 
@@ -14,6 +14,7 @@
 
 module;
 
+#include <cstring>
 #include <sstream>
 import stl;
 import expression_type;
@@ -82,4 +83,23 @@ String KnnExpression::ToString() const {
     return expr_str;
 }
 
+void KnnExpression::OwnQueryEmbedding() {
+    if (owned_query_embedding_.get() != nullptr) {
+        return;
+    }
+    const SizeT embedding_size = EmbeddingT::EmbeddingSize(embedding_data_type_, dimension_);
+    owned_query_embedding_ = MakeUniqueForOverwrite<char[]>(embedding_size);
+    std::memcpy(owned_query_embedding_.get(), query_embedding_.ptr, embedding_size);
+    query_embedding_.ptr = owned_query_embedding_.get();
+}
+
+void KnnExpression::SetQueryEmbedding(const void *query_embedding) {
+    if (owned_query_embedding_.get() == nullptr) {
+        String error_message = "KnnExpression: the query embedding is not owned by the expression";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    std::memcpy(owned_query_embedding_.get(), query_embedding, EmbeddingT::EmbeddingSize(embedding_data_type_, dimension_));
+}
+
 } // namespace infinity
@@ -43,6 +43,12 @@ public:
 
     String ToString() const override;
 
+    // copy the query embedding out of the parsed statement, so that the expression can be kept by the plan cache
+    void OwnQueryEmbedding();
+
+    // replace the query embedding with one of the same element type and dimension, the embedding should be owned
+    void SetQueryEmbedding(const void *query_embedding);
+
     bool IsKnnMinHeap() const {
         switch (distance_type_) {
             case KnnDistanceType::kL2:
@@ -61,9 +67,12 @@ public:
     const i64 dimension_{0};
     const EmbeddingDataType embedding_data_type_{EmbeddingDataType::kElemInvalid};
     const KnnDistanceType distance_type_{KnnDistanceType::kInvalid};
-    const EmbeddingT query_embedding_;
+    EmbeddingT query_embedding_;
     const i64 topn_;
     Vector<InitParameter> opt_params_;
+
+private:
+    UniquePtr<char[]> owned_query_embedding_{};
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -14,6 +14,8 @@
 
 module;
 
+#include <cstring>
+
 module match_tensor_expression;
 
 import stl;
@@ -59,4 +61,23 @@ String MatchTensorExpression::ToString() const {
     return fmt::format("MATCH TENSOR ({}, [{}], {}, '{}')", column_expr_->Name(), tensor_str, MethodToString(search_method_), options_text_);
 }
 
+void MatchTensorExpression::OwnQueryEmbedding() {
+    if (owned_query_embedding_.get() != nullptr) {
+        return;
+    }
+    const SizeT tensor_size = EmbeddingT::EmbeddingSize(embedding_data_type_, dimension_);
+    owned_query_embedding_ = MakeUniqueForOverwrite<char[]>(tensor_size);
+    std::memcpy(owned_query_embedding_.get(), query_embedding_.ptr, tensor_size);
+    query_embedding_.ptr = owned_query_embedding_.get();
+}
+
+void MatchTensorExpression::SetQueryEmbedding(const void *query_embedding) {
+    if (owned_query_embedding_.get() == nullptr) {
+        String error_message = "MatchTensorExpression: the query tensor is not owned by the expression";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    std::memcpy(owned_query_embedding_.get(), query_embedding, EmbeddingT::EmbeddingSize(embedding_data_type_, dimension_));
+}
+
 } // namespace infinity
@@ -43,14 +43,23 @@ public:
 
     static String MethodToString(MatchTensorSearchMethod method);
 
+    // copy the query tensor out of the parsed statement, so that the expression can be kept by the plan cache
+    void OwnQueryEmbedding();
+
+    // replace the query tensor with one of the same element type and dimension, the tensor should be owned
+    void SetQueryEmbedding(const void *query_embedding);
+
     const MatchTensorSearchMethod search_method_;
     const ColumnExpression *column_expr_ = nullptr;
     const EmbeddingDataType embedding_data_type_;
     const u32 dimension_;                        // num of total elements in the tensor (num of embedding * dimension of single embedding)
-    const EmbeddingT query_embedding_;           // treat the query tensor as an embedding here
+    EmbeddingT query_embedding_;                 // treat the query tensor as an embedding here
     const u32 tensor_basic_embedding_dimension_; // dimension of single embedding in the tensor column
     const u32 num_of_embedding_in_query_tensor_ = dimension_ / tensor_basic_embedding_dimension_;
     const String options_text_;
+
+private:
+    UniquePtr<char[]> owned_query_embedding_{};
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -0,0 +1,96 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <string_view>
+#include <type_traits>
+
+module approx_count_distinct;
+
+import stl;
+import catalog;
+import aggregate_function;
+import aggregate_function_set;
+import approx_sketch;
+
+import logical_type;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+template <typename ValueType>
+struct ApproxCountDistinctState {
+public:
+    HyperLogLog hll_;
+    BigIntT result_;
+
+    inline void Initialize() { hll_.Initialize(); }
+
+    inline void Update(const ValueType *__restrict input, SizeT idx) {
+        ValueType value = input[idx];
+        if constexpr (std::is_floating_point_v<ValueType>) {
+            // -0.0 equals 0.0
+            value = value == 0 ? 0 : value;
+        }
+        hll_.Add(SketchHash(&value, sizeof(ValueType)));
+    }
+
+    inline void UpdateString(std::string_view value) { hll_.Add(SketchHash(value)); }
+
+    inline void ConstantUpdate(const ValueType *__restrict input, SizeT idx, SizeT) { Update(input, idx); }
+
+    inline ptr_t Finalize() {
+        result_ = hll_.Count();
+        return (ptr_t)&result_;
+    }
+
+    inline String Serialize() const { return String(reinterpret_cast<const char *>(&hll_), sizeof(HyperLogLog)); }
+
+    inline void Merge(std::string_view other) { hll_.Merge(*reinterpret_cast<const HyperLogLog *>(other.data())); }
+
+    inline static SizeT Size(const DataType &) { return sizeof(ApproxCountDistinctState); }
+};
+
+template <typename ValueType>
+void AddApproxCountDistinctFunction(AggregateFunctionSet &function_set, LogicalType input_type) {
+    AggregateFunction function = MergeableUnaryAggregate<ApproxCountDistinctState<ValueType>, ValueType, BigIntT>(function_set.name(),
+                                                                                                                  DataType(input_type),
+                                                                                                                  DataType(LogicalType::kBigInt));
+    function_set.AddFunction(function);
+}
+
+void RegisterApproxCountDistinctFunction(const UniquePtr<Catalog> &catalog_ptr) {
+    String func_name = "APPROX_COUNT_DISTINCT";
+
+    SharedPtr<AggregateFunctionSet> function_set_ptr = MakeShared<AggregateFunctionSet>(func_name);
+
+    AddApproxCountDistinctFunction<TinyIntT>(*function_set_ptr, LogicalType::kTinyInt);
+    AddApproxCountDistinctFunction<SmallIntT>(*function_set_ptr, LogicalType::kSmallInt);
+    AddApproxCountDistinctFunction<IntegerT>(*function_set_ptr, LogicalType::kInteger);
+    AddApproxCountDistinctFunction<BigIntT>(*function_set_ptr, LogicalType::kBigInt);
+    AddApproxCountDistinctFunction<HugeIntT>(*function_set_ptr, LogicalType::kHugeInt);
+    AddApproxCountDistinctFunction<FloatT>(*function_set_ptr, LogicalType::kFloat);
+    AddApproxCountDistinctFunction<DoubleT>(*function_set_ptr, LogicalType::kDouble);
+    AddApproxCountDistinctFunction<DateT>(*function_set_ptr, LogicalType::kDate);
+    AddApproxCountDistinctFunction<TimeT>(*function_set_ptr, LogicalType::kTime);
+    AddApproxCountDistinctFunction<DateTimeT>(*function_set_ptr, LogicalType::kDateTime);
+    AddApproxCountDistinctFunction<TimestampT>(*function_set_ptr, LogicalType::kTimestamp);
+    AddApproxCountDistinctFunction<VarcharT>(*function_set_ptr, LogicalType::kVarchar);
+
+    Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
+}
+
+} // namespace infinity
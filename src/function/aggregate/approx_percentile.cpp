@@ -0,0 +1,108 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+#include <string_view>
+
+module approx_percentile;
+
+import stl;
+import catalog;
+import aggregate_function;
+import aggregate_function_set;
+import approx_sketch;
+
+import logical_type;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+// The percentile is the second argument of APPROX_PERCENTILE, and 0.5 for MEDIAN.
+template <typename ValueType, bool kWithPercentile>
+struct ApproxPercentileState {
+public:
+    TDigest digest_;
+    f64 percentile_;
+    DoubleT result_;
+
+    inline void Initialize() {
+        digest_.Initialize();
+        percentile_ = 0.5;
+    }
+
+    inline void SetParameter(f64 percentile)
+        requires kWithPercentile
+    {
+        percentile_ = percentile;
+    }
+
+    inline static bool ValidParameter(f64 percentile) { return percentile >= 0 && percentile <= 1; }
+
+    inline void Update(const ValueType *__restrict input, SizeT idx) { digest_.Add(static_cast<f64>(input[idx])); }
+
+    inline void ConstantUpdate(const ValueType *__restrict input, SizeT idx, SizeT count) {
+        for (SizeT i = 0; i < count; ++i) {
+            Update(input, idx);
+        }
+    }
+
+    // NaN if there is no value
+    inline ptr_t Finalize() {
+        result_ = digest_.Quantile(percentile_);
+        return (ptr_t)&result_;
+    }
+
+    inline String Serialize() const { return String(reinterpret_cast<const char *>(&digest_), sizeof(TDigest)); }
+
+    inline void Merge(std::string_view other) {
+        // the serialized digest isn't aligned
+        auto other_digest = MakeUnique<TDigest>();
+        std::memcpy(other_digest.get(), other.data(), sizeof(TDigest));
+        digest_.Merge(*other_digest);
+    }
+
+    inline static SizeT Size(const DataType &) { return sizeof(ApproxPercentileState); }
+};
+
+template <typename ValueType, bool kWithPercentile>
+void AddApproxPercentileFunction(AggregateFunctionSet &function_set, LogicalType input_type) {
+    AggregateFunction function =
+        MergeableUnaryAggregate<ApproxPercentileState<ValueType, kWithPercentile>, ValueType, DoubleT>(function_set.name(),
+                                                                                                      DataType(input_type),
+                                                                                                      DataType(LogicalType::kDouble));
+    function_set.AddFunction(function);
+}
+
+template <bool kWithPercentile>
+void RegisterPercentileFunction(const UniquePtr<Catalog> &catalog_ptr, const String &func_name) {
+    SharedPtr<AggregateFunctionSet> function_set_ptr = MakeShared<AggregateFunctionSet>(func_name);
+
+    AddApproxPercentileFunction<TinyIntT, kWithPercentile>(*function_set_ptr, LogicalType::kTinyInt);
+    AddApproxPercentileFunction<SmallIntT, kWithPercentile>(*function_set_ptr, LogicalType::kSmallInt);
+    AddApproxPercentileFunction<IntegerT, kWithPercentile>(*function_set_ptr, LogicalType::kInteger);
+    AddApproxPercentileFunction<BigIntT, kWithPercentile>(*function_set_ptr, LogicalType::kBigInt);
+    AddApproxPercentileFunction<FloatT, kWithPercentile>(*function_set_ptr, LogicalType::kFloat);
+    AddApproxPercentileFunction<DoubleT, kWithPercentile>(*function_set_ptr, LogicalType::kDouble);
+
+    Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
+}
+
+void RegisterApproxPercentileFunction(const UniquePtr<Catalog> &catalog_ptr) { RegisterPercentileFunction<true>(catalog_ptr, "APPROX_PERCENTILE"); }
+
+void RegisterMedianFunction(const UniquePtr<Catalog> &catalog_ptr) { RegisterPercentileFunction<false>(catalog_ptr, "MEDIAN"); }
+
+} // namespace infinity
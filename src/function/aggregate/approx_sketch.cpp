@@ -0,0 +1,179 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+#include <numbers>
+
+module approx_sketch;
+
+import stl;
+
+namespace infinity {
+
+u64 SketchHash(const void *data, SizeT len) {
+    // FNV-1a, then the murmur3 finalizer so that the leading bits used by HyperLogLog are well mixed
+    const auto *bytes = static_cast<const u8 *>(data);
+    u64 h = 14695981039346656037ull;
+    for (SizeT i = 0; i < len; ++i) {
+        h ^= bytes[i];
+        h *= 1099511628211ull;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+void HyperLogLog::Merge(const HyperLogLog &other) {
+    for (u32 i = 0; i < kRegisterCount; ++i) {
+        registers_[i] = std::max(registers_[i], other.registers_[i]);
+    }
+}
+
+u64 HyperLogLog::Count() const {
+    constexpr f64 m = kRegisterCount;
+    constexpr f64 alpha = 0.7213 / (1 + 1.079 / m);
+    f64 sum = 0;
+    u32 zero_count = 0;
+    for (u32 i = 0; i < kRegisterCount; ++i) {
+        sum += std::ldexp(1.0, -registers_[i]);
+        zero_count += registers_[i] == 0;
+    }
+    f64 estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && zero_count > 0) {
+        // linear counting for small cardinalities
+        estimate = m * std::log(m / zero_count);
+    }
+    return std::llround(estimate);
+}
+
+namespace {
+
+f64 ScaleK1(f64 q) { return TDigest::kCompression / (2 * std::numbers::pi) * std::asin(2 * q - 1); }
+
+f64 ScaleK1Inverse(f64 k) {
+    if (k >= TDigest::kCompression / 4) {
+        return 1;
+    }
+    return (std::sin(k * 2 * std::numbers::pi / TDigest::kCompression) + 1) / 2;
+}
+
+} // namespace
+
+void TDigest::Initialize() {
+    centroid_count_ = 0;
+    buffer_count_ = 0;
+    total_weight_ = 0;
+    min_ = std::numeric_limits<f64>::infinity();
+    max_ = -std::numeric_limits<f64>::infinity();
+}
+
+void TDigest::Add(f64 mean, f64 weight) {
+    if (buffer_count_ == kBufferSize) {
+        Compress();
+    }
+    buffer_means_[buffer_count_] = mean;
+    buffer_weights_[buffer_count_] = weight;
+    ++buffer_count_;
+    total_weight_ += weight;
+    min_ = std::min(min_, mean);
+    max_ = std::max(max_, mean);
+}
+
+void TDigest::Merge(const TDigest &other) {
+    for (SizeT i = 0; i < other.centroid_count_; ++i) {
+        Add(other.means_[i], other.weights_[i]);
+    }
+    for (SizeT i = 0; i < other.buffer_count_; ++i) {
+        Add(other.buffer_means_[i], other.buffer_weights_[i]);
+    }
+    // the centroids of the other digest don't keep its extremes
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+void TDigest::Compress() {
+    if (buffer_count_ == 0) {
+        return;
+    }
+    Vector<Pair<f64, f64>> items;
+    items.reserve(centroid_count_ + buffer_count_);
+    for (SizeT i = 0; i < centroid_count_; ++i) {
+        items.emplace_back(means_[i], weights_[i]);
+    }
+    for (SizeT i = 0; i < buffer_count_; ++i) {
+        items.emplace_back(buffer_means_[i], buffer_weights_[i]);
+    }
+    std::sort(items.begin(), items.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    centroid_count_ = 0;
+    buffer_count_ = 0;
+    f64 weight_so_far = 0;
+    f64 weight_limit = total_weight_ * ScaleK1Inverse(ScaleK1(0) + 1);
+    auto [cur_mean, cur_weight] = items[0];
+    for (SizeT i = 1; i < items.size(); ++i) {
+        const auto [mean, weight] = items[i];
+        // a centroid covers at most one unit of the scale function, the last slot takes what is left
+        if (weight_so_far + cur_weight + weight <= weight_limit || centroid_count_ == kMaxCentroids - 1) {
+            cur_weight += weight;
+            cur_mean += (mean - cur_mean) * weight / cur_weight;
+            continue;
+        }
+        means_[centroid_count_] = cur_mean;
+        weights_[centroid_count_] = cur_weight;
+        ++centroid_count_;
+        weight_so_far += cur_weight;
+        weight_limit = total_weight_ * ScaleK1Inverse(ScaleK1(weight_so_far / total_weight_) + 1);
+        cur_mean = mean;
+        cur_weight = weight;
+    }
+    means_[centroid_count_] = cur_mean;
+    weights_[centroid_count_] = cur_weight;
+    ++centroid_count_;
+}
+
+f64 TDigest::Quantile(f64 q) {
+    Compress();
+    if (centroid_count_ == 0) {
+        return std::numeric_limits<f64>::quiet_NaN();
+    }
+    if (centroid_count_ == 1) {
+        return means_[0];
+    }
+    // each centroid is centered at the middle of its weight, interpolate linearly between the centers
+    const f64 index = q * total_weight_;
+    if (index < weights_[0] / 2) {
+        return min_ + (means_[0] - min_) * index / (weights_[0] / 2);
+    }
+    const SizeT last = centroid_count_ - 1;
+    if (index > total_weight_ - weights_[last] / 2) {
+        const f64 tail = total_weight_ - index;
+        return max_ - (max_ - means_[last]) * tail / (weights_[last] / 2);
+    }
+    f64 center = weights_[0] / 2;
+    for (SizeT i = 0; i < last; ++i) {
+        const f64 next_center = center + (weights_[i] + weights_[i + 1]) / 2;
+        if (index <= next_center) {
+            return means_[i] + (means_[i + 1] - means_[i]) * (index - center) / (next_center - center);
+        }
+        center = next_center;
+    }
+    return means_[last];
+}
+
+} // namespace infinity
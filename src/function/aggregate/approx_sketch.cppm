@@ -0,0 +1,231 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+export module approx_sketch;
+
+import stl;
+
+namespace infinity {
+
+export u64 SketchHash(const void *data, SizeT len);
+
+export inline u64 SketchHash(std::string_view value) { return SketchHash(value.data(), value.size()); }
+
+// HyperLogLog with 2^12 registers, the standard error is about 1.6%.
+// It's trivially copyable, so it can live in an aggregate state and be merged from its bytes.
+export class HyperLogLog {
+public:
+    static constexpr u32 kPrecision = 12;
+    static constexpr u32 kRegisterCount = 1u << kPrecision;
+
+    void Initialize() { std::memset(registers_, 0, sizeof(registers_)); }
+
+    void Add(u64 hash) {
+        const u32 idx = hash >> (64 - kPrecision);
+        // the guard bit bounds the rank when the remaining bits are all zero
+        const u64 w = (hash << kPrecision) | (1ull << (kPrecision - 1));
+        const u8 rank = std::countl_zero(w) + 1;
+        if (registers_[idx] < rank) {
+            registers_[idx] = rank;
+        }
+    }
+
+    void Merge(const HyperLogLog &other);
+
+    u64 Count() const;
+
+private:
+    u8 registers_[kRegisterCount];
+};
+
+// Merging t-digest of bounded size for approximate quantiles, accurate at the tails.
+// Values are buffered and compressed into at most kMaxCentroids centroids with the k1 scale function.
+export class TDigest {
+public:
+    static constexpr f64 kCompression = 100;
+    static constexpr SizeT kMaxCentroids = 2 * kCompression;
+    static constexpr SizeT kBufferSize = 512;
+
+    void Initialize();
+
+    void Add(f64 value) { Add(value, 1); }
+
+    void Merge(const TDigest &other);
+
+    // NaN if no value is added
+    f64 Quantile(f64 q);
+
+    f64 total_weight() const { return total_weight_; }
+
+private:
+    void Add(f64 mean, f64 weight);
+
+    void Compress();
+
+    f64 means_[kMaxCentroids];
+    f64 weights_[kMaxCentroids];
+    SizeT centroid_count_;
+    f64 buffer_means_[kBufferSize];
+    f64 buffer_weights_[kBufferSize];
+    SizeT buffer_count_;
+    f64 total_weight_;
+    f64 min_;
+    f64 max_;
+};
+
+// Space-saving summary of the most frequent keys. A key that is counted has its count overestimated by at most
+// the smallest count of the summary, and a key more frequent than total/capacity is always counted.
+// The counters are ordered by count, so a count is raised and the least frequent key replaced in O(log capacity).
+export template <typename Key>
+class SpaceSaving {
+    using CountOrder = MultiMap<u64, Key>;
+
+public:
+    explicit SpaceSaving(SizeT capacity) : capacity_(capacity) {}
+
+    // the counters refer to the nodes of the order, which move with it but can't be copied
+    SpaceSaving(const SpaceSaving &) = delete;
+    SpaceSaving(SpaceSaving &&) = default;
+
+    void Add(const Key &key, u64 count = 1) {
+        if (auto iter = counters_.find(key); iter != counters_.end()) {
+            iter->second = Raise(iter->second, count);
+            return;
+        }
+        if (counters_.size() < capacity_) {
+            counters_.emplace(key, order_.emplace(count, key));
+            return;
+        }
+        // replace the least frequent key, the new key may have been counted by it
+        auto min_iter = order_.begin();
+        counters_.erase(min_iter->second);
+        min_iter->second = key;
+        counters_.emplace(key, Raise(min_iter, count));
+    }
+
+    // merge of mergeable summaries: a key missing from a full summary may have the smallest count of it
+    void Merge(const SpaceSaving &other) {
+        const u64 this_min = MinCount();
+        const u64 other_min = other.MinCount();
+        Vector<Pair<Key, u64>> merged;
+        merged.reserve(order_.size() + other.order_.size());
+        for (const auto &[count, key] : order_) {
+            auto iter = other.counters_.find(key);
+            merged.emplace_back(key, count + (iter != other.counters_.end() ? iter->second->first : other_min));
+        }
+        for (const auto &[count, key] : other.order_) {
+            if (!counters_.contains(key)) {
+                merged.emplace_back(key, count + this_min);
+            }
+        }
+        counters_.clear();
+        order_.clear();
+        for (auto &[key, count] : merged) {
+            Insert(std::move(key), count);
+        }
+        while (order_.size() > capacity_) {
+            counters_.erase(order_.begin()->second);
+            order_.erase(order_.begin());
+        }
+    }
+
+    // the most frequent keys, in descending order of count
+    Vector<Pair<Key, u64>> TopK(SizeT k) const {
+        Vector<Pair<Key, u64>> result;
+        result.reserve(std::min(k, order_.size()));
+        for (auto iter = order_.rbegin(); iter != order_.rend() && result.size() < k; ++iter) {
+            result.emplace_back(iter->second, iter->first);
+        }
+        return result;
+    }
+
+    void Serialize(String &output) const {
+        AppendPod(output, capacity_);
+        AppendPod(output, order_.size());
+        for (const auto &[count, key] : order_) {
+            if constexpr (std::is_same_v<Key, String>) {
+                AppendPod(output, key.size());
+                output.append(key);
+            } else {
+                AppendPod(output, key);
+            }
+            AppendPod(output, count);
+        }
+    }
+
+    static SpaceSaving Deserialize(std::string_view input) {
+        SpaceSaving summary(ReadPod<SizeT>(input));
+        const auto size = ReadPod<SizeT>(input);
+        for (SizeT i = 0; i < size; ++i) {
+            Key key{};
+            if constexpr (std::is_same_v<Key, String>) {
+                const auto len = ReadPod<SizeT>(input);
+                key.assign(input.substr(0, len));
+                input.remove_prefix(len);
+            } else {
+                key = ReadPod<Key>(input);
+            }
+            summary.Insert(std::move(key), ReadPod<u64>(input));
+        }
+        return summary;
+    }
+
+    SizeT capacity() const { return capacity_; }
+
+private:
+    u64 MinCount() const {
+        if (order_.size() < capacity_) {
+            return 0;
+        }
+        return order_.begin()->first;
+    }
+
+    void Insert(Key key, u64 count) {
+        auto iter = order_.emplace(count, key);
+        counters_.emplace(std::move(key), iter);
+    }
+
+    // move the counter to its new count, the iterators of the other counters stay valid
+    typename CountOrder::iterator Raise(typename CountOrder::iterator iter, u64 count) {
+        auto node = order_.extract(iter);
+        node.key() += count;
+        return order_.insert(std::move(node));
+    }
+
+    template <typename T>
+    static void AppendPod(String &output, const T &value) {
+        output.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    static T ReadPod(std::string_view &input) {
+        T value;
+        std::memcpy(&value, input.data(), sizeof(T));
+        input.remove_prefix(sizeof(T));
+        return value;
+    }
+
+    SizeT capacity_;
+    CountOrder order_;
+    HashMap<Key, typename CountOrder::iterator> counters_;
+};
+
+} // namespace infinity
@@ -0,0 +1,139 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+#include <string_view>
+#include <type_traits>
+
+module approx_top_k;
+
+import stl;
+import catalog;
+import aggregate_function;
+import aggregate_function_set;
+import approx_sketch;
+import infinity_exception;
+import value;
+import third_party;
+import logger;
+
+import logical_type;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+// APPROX_TOP_K(x, k) returns the k most frequent values with their estimated counts as a json array,
+// e.g. [{"value":3,"count":120},{"value":7,"count":64}]. The summary keeps more counters than k for accuracy.
+// It's owned by the state and released by FinalizeValue, Serialize or Destroy.
+template <typename ValueType>
+struct ApproxTopKState {
+public:
+    using KeyType = std::conditional_t<std::is_same_v<ValueType, VarcharT>, String, ValueType>;
+
+    static constexpr SizeT kDefaultK = 10;
+    static constexpr SizeT kCapacityFactor = 4;
+
+    SpaceSaving<KeyType> *summary_;
+    SizeT k_;
+
+    inline void Initialize() {
+        k_ = kDefaultK;
+        summary_ = new SpaceSaving<KeyType>(k_ * kCapacityFactor);
+    }
+
+    inline void Destroy() {
+        delete summary_;
+        summary_ = nullptr;
+    }
+
+    inline void SetParameter(f64 k) {
+        delete summary_;
+        k_ = k;
+        summary_ = new SpaceSaving<KeyType>(k_ * kCapacityFactor);
+    }
+
+    inline static bool ValidParameter(f64 k) { return k >= 1 && k <= 1000 && std::floor(k) == k; }
+
+    inline void Update(const ValueType *__restrict input, SizeT idx) {
+        ValueType value = input[idx];
+        if constexpr (std::is_floating_point_v<ValueType>) {
+            // -0.0 equals 0.0
+            value = value == 0 ? 0 : value;
+        }
+        summary_->Add(value);
+    }
+
+    inline void UpdateString(std::string_view value) { summary_->Add(String(value)); }
+
+    inline void ConstantUpdate(const ValueType *__restrict input, SizeT idx, SizeT count) { summary_->Add(input[idx], count); }
+
+    inline ptr_t Finalize() {
+        String error_message = "The result of APPROX_TOP_K should be appended by value";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+        return nullptr;
+    }
+
+    Value FinalizeValue() {
+        json result = json::array();
+        for (const auto &[key, count] : summary_->TopK(k_)) {
+            json item;
+            item["value"] = key;
+            item["count"] = count;
+            result.push_back(std::move(item));
+        }
+        Destroy();
+        return Value::MakeVarchar(std::string_view(result.dump()));
+    }
+
+    String Serialize() {
+        String output;
+        summary_->Serialize(output);
+        Destroy();
+        return output;
+    }
+
+    inline void Merge(std::string_view other) { summary_->Merge(SpaceSaving<KeyType>::Deserialize(other)); }
+
+    inline static SizeT Size(const DataType &) { return sizeof(ApproxTopKState); }
+};
+
+template <typename ValueType>
+void AddApproxTopKFunction(AggregateFunctionSet &function_set, LogicalType input_type) {
+    AggregateFunction function = MergeableUnaryAggregate<ApproxTopKState<ValueType>, ValueType, VarcharT>(function_set.name(),
+                                                                                                          DataType(input_type),
+                                                                                                          DataType(LogicalType::kVarchar));
+    function_set.AddFunction(function);
+}
+
+void RegisterApproxTopKFunction(const UniquePtr<Catalog> &catalog_ptr) {
+    String func_name = "APPROX_TOP_K";
+
+    SharedPtr<AggregateFunctionSet> function_set_ptr = MakeShared<AggregateFunctionSet>(func_name);
+
+    AddApproxTopKFunction<TinyIntT>(*function_set_ptr, LogicalType::kTinyInt);
+    AddApproxTopKFunction<SmallIntT>(*function_set_ptr, LogicalType::kSmallInt);
+    AddApproxTopKFunction<IntegerT>(*function_set_ptr, LogicalType::kInteger);
+    AddApproxTopKFunction<BigIntT>(*function_set_ptr, LogicalType::kBigInt);
+    AddApproxTopKFunction<FloatT>(*function_set_ptr, LogicalType::kFloat);
+    AddApproxTopKFunction<DoubleT>(*function_set_ptr, LogicalType::kDouble);
+    AddApproxTopKFunction<VarcharT>(*function_set_ptr, LogicalType::kVarchar);
+
+    Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
+}
+
+} // namespace infinity
@@ -0,0 +1,168 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+module count_distinct;
+
+import stl;
+import catalog;
+import aggregate_function;
+import aggregate_function_set;
+
+import logical_type;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+template <SizeT N>
+struct BitsOfSize;
+
+template <>
+struct BitsOfSize<1> {
+    using type = u8;
+};
+
+template <>
+struct BitsOfSize<2> {
+    using type = u16;
+};
+
+template <>
+struct BitsOfSize<4> {
+    using type = u32;
+};
+
+template <>
+struct BitsOfSize<8> {
+    using type = u64;
+};
+
+template <typename ValueType>
+struct DistinctKey {
+    using type = typename BitsOfSize<sizeof(ValueType)>::type;
+};
+
+template <>
+struct DistinctKey<VarcharT> {
+    using type = String;
+};
+
+// Exact COUNT(DISTINCT x). The values are kept in a hash set owned by the state, which is released by Finalize,
+// Serialize or Destroy. Fixed size values are kept by their bits, strings by their content.
+template <typename ValueType>
+struct CountDistinctState {
+public:
+    using KeyType = typename DistinctKey<ValueType>::type;
+
+    HashSet<KeyType> *values_;
+    BigIntT result_;
+
+    inline void Initialize() { values_ = new HashSet<KeyType>(); }
+
+    inline void Destroy() {
+        delete values_;
+        values_ = nullptr;
+    }
+
+    inline void Update(const ValueType *__restrict input, SizeT idx) {
+        ValueType value = input[idx];
+        if constexpr (std::is_floating_point_v<ValueType>) {
+            // -0.0 equals 0.0
+            value = value == 0 ? 0 : value;
+        }
+        KeyType key;
+        std::memcpy(&key, &value, sizeof(KeyType));
+        values_->insert(key);
+    }
+
+    inline void UpdateString(std::string_view value) { values_->emplace(value); }
+
+    inline void ConstantUpdate(const ValueType *__restrict input, SizeT idx, SizeT) { Update(input, idx); }
+
+    inline ptr_t Finalize() {
+        result_ = values_->size();
+        Destroy();
+        return (ptr_t)&result_;
+    }
+
+    String Serialize() {
+        String output;
+        for (const auto &key : *values_) {
+            if constexpr (std::is_same_v<KeyType, String>) {
+                const u32 len = key.size();
+                output.append(reinterpret_cast<const char *>(&len), sizeof(len));
+                output.append(key);
+            } else {
+                output.append(reinterpret_cast<const char *>(&key), sizeof(KeyType));
+            }
+        }
+        Destroy();
+        return output;
+    }
+
+    void Merge(std::string_view other) {
+        while (!other.empty()) {
+            if constexpr (std::is_same_v<KeyType, String>) {
+                u32 len;
+                std::memcpy(&len, other.data(), sizeof(len));
+                values_->emplace(other.substr(sizeof(len), len));
+                other.remove_prefix(sizeof(len) + len);
+            } else {
+                KeyType key;
+                std::memcpy(&key, other.data(), sizeof(KeyType));
+                values_->insert(key);
+                other.remove_prefix(sizeof(KeyType));
+            }
+        }
+    }
+
+    inline static SizeT Size(const DataType &) { return sizeof(CountDistinctState); }
+};
+
+template <typename ValueType>
+void AddCountDistinctFunction(AggregateFunctionSet &function_set, LogicalType input_type) {
+    AggregateFunction function = MergeableUnaryAggregate<CountDistinctState<ValueType>, ValueType, BigIntT>(function_set.name(),
+                                                                                                            DataType(input_type),
+                                                                                                            DataType(LogicalType::kBigInt));
+    function_set.AddFunction(function);
+}
+
+void RegisterCountDistinctFunction(const UniquePtr<Catalog> &catalog_ptr) {
+    // bound for COUNT(DISTINCT x)
+    String func_name = "COUNT_DISTINCT";
+
+    SharedPtr<AggregateFunctionSet> function_set_ptr = MakeShared<AggregateFunctionSet>(func_name);
+
+    AddCountDistinctFunction<TinyIntT>(*function_set_ptr, LogicalType::kTinyInt);
+    AddCountDistinctFunction<SmallIntT>(*function_set_ptr, LogicalType::kSmallInt);
+    AddCountDistinctFunction<IntegerT>(*function_set_ptr, LogicalType::kInteger);
+    AddCountDistinctFunction<BigIntT>(*function_set_ptr, LogicalType::kBigInt);
+    AddCountDistinctFunction<FloatT>(*function_set_ptr, LogicalType::kFloat);
+    AddCountDistinctFunction<DoubleT>(*function_set_ptr, LogicalType::kDouble);
+    AddCountDistinctFunction<DateT>(*function_set_ptr, LogicalType::kDate);
+    AddCountDistinctFunction<TimeT>(*function_set_ptr, LogicalType::kTime);
+    AddCountDistinctFunction<DateTimeT>(*function_set_ptr, LogicalType::kDateTime);
+    AddCountDistinctFunction<TimestampT>(*function_set_ptr, LogicalType::kTimestamp);
+    AddCountDistinctFunction<VarcharT>(*function_set_ptr, LogicalType::kVarchar);
+
+    Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
+}
+
+} // namespace infinity
@@ -15,6 +15,7 @@
 module;
 
 #include <sstream>
+#include <string_view>
 
 module aggregate_function;
 
@@ -22,6 +23,8 @@ import base_expression;
 import infinity_exception;
 import status;
 import logger;
+import column_vector;
+import value;
 
 namespace infinity {
 
@@ -32,6 +35,28 @@ void AggregateFunction::CastArgumentTypes(BaseExpression &) {
     RecoverableError(status);
 }
 
+bool AggregateFunction::BindParameter(f64 parameter) {
+    if (set_parameter_func_ == nullptr || !check_parameter_func_(parameter)) {
+        return false;
+    }
+    init_func_ = [init_func = std::move(init_func_), set_parameter_func = set_parameter_func_, parameter](ptr_t state) {
+        init_func(state);
+        set_parameter_func(state, parameter);
+    };
+    return true;
+}
+
+void AggregateFunction::AppendResult(ptr_t state, ColumnVector &output_column_vector, bool partial) const {
+    if (partial) {
+        const String serialized_state = serialize_func_(state);
+        output_column_vector.AppendValue(Value::MakeVarchar(std::string_view(serialized_state)));
+    } else if (finalize_value_func_ != nullptr) {
+        output_column_vector.AppendValue(finalize_value_func_(state));
+    } else {
+        output_column_vector.AppendByPtr(finalize_func_(state));
+    }
+}
+
 std::string AggregateFunction::ToString() const {
 
     std::stringstream ss;
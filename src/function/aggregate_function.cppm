@@ -14,6 +14,7 @@
 
 module;
 
+#include <string_view>
 #include <type_traits>
 
 export module aggregate_function;
@@ -29,12 +30,38 @@ import data_type;
 import logical_type;
 import internal_types;
 import logger;
+import value;
 
 namespace infinity {
 
 using AggregateInitializeFuncType = std::function<void(ptr_t)>;
 using AggregateUpdateFuncType = std::function<void(ptr_t, const SharedPtr<ColumnVector> &)>;
 using AggregateFinalizeFuncType = std::function<ptr_t(ptr_t)>;
+using AggregateFinalizeValueFuncType = std::function<Value(ptr_t)>;
+using AggregateSerializeFuncType = std::function<String(ptr_t)>;
+using AggregateMergeFuncType = std::function<void(ptr_t, std::string_view)>;
+using AggregateParameterFuncType = std::function<void(ptr_t, f64)>;
+using AggregateCheckParameterFuncType = std::function<bool(f64)>;
+using AggregateDestroyFuncType = std::function<void(ptr_t)>;
+
+// Frees the state buffer and the memory the state owns out of it, also when the state is dropped without being finalized,
+// e.g. by a failed or cancelled query. The buffer is zeroed at first, so a state never initialized is destroyed as well.
+export struct AggregateStateDeleter {
+    AggregateDestroyFuncType destroy_func_{};
+
+    void operator()(char *state) const {
+        if (destroy_func_) {
+            destroy_func_(state);
+        }
+        delete[] state;
+    }
+};
+
+export using AggregateStatePtr = UniquePtr<char[], AggregateStateDeleter>;
+
+// The input states of these functions take varchar values, e.g. for counting distinct strings.
+template <typename AggregateState>
+concept StringUpdatableState = requires(AggregateState *state, std::string_view value) { state->UpdateString(value); };
 
 class AggregateOperation {
 public:
@@ -68,8 +95,15 @@ public:
             case ColumnVectorType::kFlat: {
                 SizeT row_count = input_column_vector->Size();
                 auto *input_ptr = (InputType *)(input_column_vector->data());
-                for (SizeT idx = 0; idx < row_count; ++idx) {
-                    ((AggregateState *)state)->Update(input_ptr, idx);
+                if constexpr (std::is_same_v<InputType, VarcharT> && StringUpdatableState<AggregateState>) {
+                    String buffer;
+                    for (SizeT idx = 0; idx < row_count; ++idx) {
+                        ((AggregateState *)state)->UpdateString(input_column_vector->GetVarcharView(idx, buffer));
+                    }
+                } else {
+                    for (SizeT idx = 0; idx < row_count; ++idx) {
+                        ((AggregateState *)state)->Update(input_ptr, idx);
+                    }
                 }
                 break;
             }
@@ -86,7 +120,12 @@ public:
                     break;
                 }
                 auto *input_ptr = (InputType *)(input_column_vector->data());
-                ((AggregateState *)state)->Update(input_ptr, 0);
+                if constexpr (std::is_same_v<InputType, VarcharT> && StringUpdatableState<AggregateState>) {
+                    String buffer;
+                    ((AggregateState *)state)->UpdateString(input_column_vector->GetVarcharView(0, buffer));
+                } else {
+                    ((AggregateState *)state)->Update(input_ptr, 0);
+                }
                 break;
             }
             case ColumnVectorType::kHeterogeneous: {
@@ -108,6 +147,31 @@ public:
         ptr_t result = ((AggregateState *)state)->Finalize();
         return result;
     }
+
+    template <typename AggregateState>
+    static inline Value StateFinalizeValue(const ptr_t state) {
+        return ((AggregateState *)state)->FinalizeValue();
+    }
+
+    template <typename AggregateState>
+    static inline String StateSerialize(const ptr_t state) {
+        return ((AggregateState *)state)->Serialize();
+    }
+
+    template <typename AggregateState>
+    static inline void StateMerge(const ptr_t state, std::string_view other) {
+        ((AggregateState *)state)->Merge(other);
+    }
+
+    template <typename AggregateState>
+    static inline void StateSetParameter(const ptr_t state, f64 parameter) {
+        ((AggregateState *)state)->SetParameter(parameter);
+    }
+
+    template <typename AggregateState>
+    static inline void StateDestroy(const ptr_t state) {
+        ((AggregateState *)state)->Destroy();
+    }
 };
 
 export class AggregateFunction : public Function {
@@ -129,15 +193,37 @@ public:
 
     [[nodiscard]] String ToString() const override;
 
-    UniquePtr<char[]> InitState() const { return MakeUnique<char[]>(state_size_); }
+    AggregateStatePtr InitState() const { return AggregateStatePtr(new char[state_size_](), AggregateStateDeleter{destroy_func_}); }
 
     [[nodiscard]] String GetFuncName() const { return name_; }
 
+    // The state can be serialized into a varchar and merged into another state, so that the partial states
+    // of parallel tasks are combined instead of their results.
+    [[nodiscard]] bool IsMergeable() const { return merge_func_ != nullptr; }
+
+    // Set the constant argument of e.g. APPROX_PERCENTILE(x, 0.9) to every initialized state.
+    // Return false if the function takes no such argument or the value is out of range.
+    bool BindParameter(f64 parameter);
+
+    // Append the result of the state, or the serialized state if partial. The state can't be updated afterwards.
+    void AppendResult(ptr_t state, ColumnVector &output_column_vector, bool partial) const;
+
 public:
     AggregateInitializeFuncType init_func_;
     AggregateUpdateFuncType update_func_;
     AggregateFinalizeFuncType finalize_func_;
 
+    // optional, for the results that can't be appended by pointer, e.g. varchar
+    AggregateFinalizeValueFuncType finalize_value_func_{};
+    // optional, for the mergeable states
+    AggregateSerializeFuncType serialize_func_{};
+    AggregateMergeFuncType merge_func_{};
+    // optional, for the functions taking a constant argument
+    AggregateParameterFuncType set_parameter_func_{};
+    AggregateCheckParameterFuncType check_parameter_func_{};
+    // optional, for the states owning memory out of the state buffer
+    AggregateDestroyFuncType destroy_func_{};
+
     DataType argument_type_;
     DataType return_type_;
 
@@ -155,4 +241,25 @@ inline AggregateFunction UnaryAggregate(const String &name, const DataType &inpu
                              AggregateOperation::StateFinalize<AggregateState, ResultType>);
 }
 
+// The state implements `String Serialize()` and `void Merge(std::string_view)`, and optionally
+// `Value FinalizeValue()`, `void SetParameter(f64)` with `static bool ValidParameter(f64)`, `void UpdateString(std::string_view)`
+// and `void Destroy()` for the memory owned by the state, which is called once more after Finalize or Serialize.
+export template <typename AggregateState, typename InputType, typename ResultType>
+inline AggregateFunction MergeableUnaryAggregate(const String &name, const DataType &input_type, const DataType &return_type) {
+    AggregateFunction function = UnaryAggregate<AggregateState, InputType, ResultType>(name, input_type, return_type);
+    function.serialize_func_ = AggregateOperation::StateSerialize<AggregateState>;
+    function.merge_func_ = AggregateOperation::StateMerge<AggregateState>;
+    if constexpr (requires(AggregateState *state) { state->FinalizeValue(); }) {
+        function.finalize_value_func_ = AggregateOperation::StateFinalizeValue<AggregateState>;
+    }
+    if constexpr (requires(AggregateState *state, f64 parameter) { state->SetParameter(parameter); }) {
+        function.set_parameter_func_ = AggregateOperation::StateSetParameter<AggregateState>;
+        function.check_parameter_func_ = AggregateState::ValidParameter;
+    }
+    if constexpr (requires(AggregateState *state) { state->Destroy(); }) {
+        function.destroy_func_ = AggregateOperation::StateDestroy<AggregateState>;
+    }
+    return function;
+}
+
 } // namespace infinity
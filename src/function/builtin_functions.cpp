@@ -24,6 +24,10 @@ import first;
 import max;
 import min;
 import sum;
+import approx_count_distinct;
+import approx_percentile;
+import approx_top_k;
+import count_distinct;
 
 import add;
 import abs;
@@ -44,6 +48,7 @@ import not_func;
 import or_func;
 import plus;
 import pow;
+import regexp_match;
 import substring;
 import substract;
 import default_values;
@@ -71,6 +76,11 @@ void BuiltinFunctions::RegisterAggregateFunction() {
     RegisterMaxFunction(catalog_ptr_);
     RegisterMinFunction(catalog_ptr_);
     RegisterSumFunction(catalog_ptr_);
+    RegisterCountDistinctFunction(catalog_ptr_);
+    RegisterApproxCountDistinctFunction(catalog_ptr_);
+    RegisterApproxPercentileFunction(catalog_ptr_);
+    RegisterMedianFunction(catalog_ptr_);
+    RegisterApproxTopKFunction(catalog_ptr_);
 }
 
 void BuiltinFunctions::RegisterScalarFunction() {
@@ -103,6 +113,7 @@ void BuiltinFunctions::RegisterScalarFunction() {
     // like function
     RegisterLikeFunction(catalog_ptr_);
     RegisterNotLikeFunction(catalog_ptr_);
+    RegisterRegexpMatchFunction(catalog_ptr_);
 
     // extract function
     RegisterExtractFunction(catalog_ptr_);
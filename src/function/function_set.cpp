@@ -26,6 +26,10 @@ namespace infinity {
 
 SharedPtr<FunctionSet> FunctionSet::GetFunctionSet(Catalog *catalog, const FunctionExpr &expr) {
     String function_name = expr.func_name_;
+    if (expr.distinct_ && IsEqual(function_name, String("count"))) {
+        // COUNT(DISTINCT x)
+        function_name = "count_distinct";
+    }
 
     // SharedPtr<Catalog>& catalog
     SharedPtr<FunctionSet> function_set_ptr = Catalog::GetFunctionSetByName(catalog, function_name);
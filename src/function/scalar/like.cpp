@@ -19,109 +19,15 @@ module like;
 import stl;
 import catalog;
 import logical_type;
-import infinity_exception;
 import scalar_function;
 import scalar_function_set;
+import string_pattern;
 
-import third_party;
 import internal_types;
 import data_type;
-import logger;
 
 namespace infinity {
 
-bool LikeOperator(const ptr_t left_ptr, SizeT left_len, const ptr_t right_ptr, SizeT right_len) {
-    SizeT left_idx{0}, right_idx{0};
-
-    while (right_idx < right_len) {
-        char left_char = left_ptr[left_idx];
-        char right_char = right_ptr[right_idx];
-        if (right_char == '_' or (left_char == right_char)) {
-            ++left_idx;
-            ++right_idx;
-        } else if (right_char == '%') {
-            ++right_idx;
-
-            // If there are more than one %
-            while (right_idx < right_len && right_ptr[right_idx] == '%') {
-                ++right_idx;
-            }
-
-            // % is the last character
-            if (right_idx == right_len) {
-                return true;
-            }
-
-            // Check any left part is matched with rest of right part.
-            while (left_idx < left_len) {
-                if (LikeOperator(&left_ptr[left_idx], left_len - left_idx, &right_ptr[right_idx], right_len - right_idx)) {
-                    return true;
-                }
-                ++left_idx;
-            }
-
-            // Not matched
-            return false;
-        } else {
-            return false;
-        }
-    }
-
-    while (right_idx < right_len && right_ptr[right_idx] == '%') {
-        ++right_idx;
-    }
-
-    return left_idx == left_len && right_idx == right_len;
-}
-
-struct LikeFunction {
-    template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        String error_message = "Not implement: LikeFunction";
-        LOG_CRITICAL(error_message);
-        UnrecoverableError(error_message);
-    }
-};
-
-template <>
-inline void LikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    String error_message = "Not implement";
-    LOG_CRITICAL(error_message);
-    UnrecoverableError(error_message);
-
-//    ptr_t left_ptr = left.GetDataPtr();
-//    SizeT left_len = left.GetDataLen();
-//    ptr_t right_ptr = right.GetDataPtr();
-//    SizeT right_len = right.GetDataLen();
-
-//    result = LikeOperator(left_ptr, left_len, right_ptr, right_len);
-}
-
-struct NotLikeFunction {
-    template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        String error_message = "Not implement";
-        LOG_CRITICAL(error_message);
-        UnrecoverableError(error_message);
-
-    }
-};
-
-template <>
-inline void NotLikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    String error_message = "Not implement";
-    LOG_CRITICAL(error_message);
-    UnrecoverableError(error_message);
-
-
-//    ptr_t left_ptr = left.GetDataPtr();
-//    SizeT left_len = left.GetDataLen();
-//    ptr_t right_ptr = right.GetDataPtr();
-//    SizeT right_len = right.GetDataLen();
-
-//    result = !LikeOperator(left_ptr, left_len, right_ptr, right_len);
-}
-
 void RegisterLikeFunction(const UniquePtr<Catalog> &catalog_ptr) {
     String func_name = "like";
 
@@ -130,7 +36,7 @@ void RegisterLikeFunction(const UniquePtr<Catalog> &catalog_ptr) {
     ScalarFunction varchar_like_function(func_name,
                                          {DataType(LogicalType::kVarchar), DataType(LogicalType::kVarchar)},
                                          DataType(kBoolean),
-                                         &ScalarFunction::BinaryFunction<VarcharT, VarcharT, BooleanT, LikeFunction>);
+                                         &PatternMatchFunction<LikePattern, false>);
     function_set_ptr->AddFunction(varchar_like_function);
 
     Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
@@ -144,7 +50,7 @@ void RegisterNotLikeFunction(const UniquePtr<Catalog> &catalog_ptr) {
     ScalarFunction varchar_not_like_function(func_name,
                                              {DataType(LogicalType::kVarchar), DataType(LogicalType::kVarchar)},
                                              DataType(kBoolean),
-                                             &ScalarFunction::BinaryFunction<VarcharT, VarcharT, BooleanT, NotLikeFunction>);
+                                             &PatternMatchFunction<LikePattern, true>);
     function_set_ptr->AddFunction(varchar_not_like_function);
 
     Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
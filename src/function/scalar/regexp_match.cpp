@@ -0,0 +1,45 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module regexp_match;
+
+import stl;
+import catalog;
+import logical_type;
+import scalar_function;
+import scalar_function_set;
+import string_pattern;
+
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+void RegisterRegexpMatchFunction(const UniquePtr<Catalog> &catalog_ptr) {
+    String func_name = "regexp_match";
+
+    SharedPtr<ScalarFunctionSet> function_set_ptr = MakeShared<ScalarFunctionSet>(func_name);
+
+    ScalarFunction varchar_regexp_match_function(func_name,
+                                                 {DataType(LogicalType::kVarchar), DataType(LogicalType::kVarchar)},
+                                                 DataType(kBoolean),
+                                                 &PatternMatchFunction<RegexPattern, false>);
+    function_set_ptr->AddFunction(varchar_regexp_match_function);
+
+    Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
+}
+
+} // namespace infinity
@@ -0,0 +1,657 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <cstring>
+#include <string_view>
+
+module string_pattern;
+
+import stl;
+import status;
+import infinity_exception;
+import third_party;
+import logger;
+
+namespace infinity {
+
+// LikePattern
+
+LikePattern::LikePattern(std::string_view pattern) {
+    Segment current;
+    for (SizeT i = 0; i < pattern.size(); ++i) {
+        char c = pattern[i];
+        if (c == '\\' && i + 1 < pattern.size()) {
+            current.chars_.push_back(pattern[++i]);
+            current.any_.push_back(false);
+        } else if (c == '%') {
+            segments_.push_back(std::move(current));
+            current = Segment();
+        } else {
+            current.chars_.push_back(c);
+            current.any_.push_back(c == '_');
+        }
+    }
+    segments_.push_back(std::move(current));
+
+    // '%%' is the same as '%', only the first and the last segments may be empty
+    if (segments_.size() > 2) {
+        Vector<Segment> segments;
+        for (SizeT i = 0; i < segments_.size(); ++i) {
+            if (i == 0 || i + 1 == segments_.size() || !segments_[i].chars_.empty()) {
+                segments.push_back(std::move(segments_[i]));
+            }
+        }
+        segments_ = std::move(segments);
+    }
+
+    bool has_any = false;
+    for (auto &segment : segments_) {
+        min_length_ += segment.chars_.size();
+        if (std::find(segment.any_.begin(), segment.any_.end(), true) == segment.any_.end()) {
+            segment.any_.clear();
+        } else {
+            has_any = true;
+        }
+    }
+    anchored_begin_ = !segments_.front().chars_.empty();
+    anchored_end_ = !segments_.back().chars_.empty();
+
+    const Segment &first = segments_.front();
+    SizeT prefix_length = first.any_.empty() ? first.chars_.size() : std::find(first.any_.begin(), first.any_.end(), true) - first.any_.begin();
+    literal_prefix_ = first.chars_.substr(0, prefix_length);
+
+    if (has_any) {
+        kind_ = Kind::kGeneral;
+    } else if (segments_.size() == 1) {
+        kind_ = Kind::kExact;
+    } else if (segments_.size() == 2 && anchored_begin_ != anchored_end_) {
+        kind_ = anchored_begin_ ? Kind::kPrefix : Kind::kSuffix;
+    } else if (segments_.size() == 3 && !anchored_begin_ && !anchored_end_) {
+        kind_ = Kind::kContains;
+    }
+}
+
+bool LikePattern::Match(std::string_view text) const {
+    switch (kind_) {
+        case Kind::kExact:
+            return text == segments_[0].chars_;
+        case Kind::kPrefix:
+            return text.starts_with(segments_[0].chars_);
+        case Kind::kSuffix:
+            return text.ends_with(segments_[1].chars_);
+        case Kind::kContains:
+            return text.find(segments_[1].chars_) != std::string_view::npos;
+        case Kind::kGeneral:
+            break;
+    }
+
+    const Segment &first = segments_.front();
+    if (segments_.size() == 1) {
+        return text.size() == first.chars_.size() && first.MatchAt(text, 0);
+    }
+    if (text.size() < min_length_) {
+        return false;
+    }
+    const Segment &last = segments_.back();
+    SizeT end = text.size() - last.chars_.size();
+    if (!first.MatchAt(text, 0) || !last.MatchAt(text, end)) {
+        return false;
+    }
+    // the leftmost match of each middle segment leaves the most room for the following ones
+    std::string_view middle = text.substr(0, end);
+    SizeT pos = first.chars_.size();
+    for (SizeT i = 1; i + 1 < segments_.size(); ++i) {
+        SizeT found = segments_[i].Find(middle, pos);
+        if (found == std::string_view::npos) {
+            return false;
+        }
+        pos = found + segments_[i].chars_.size();
+    }
+    return true;
+}
+
+bool LikePattern::Segment::MatchAt(std::string_view text, SizeT pos) const {
+    if (pos + chars_.size() > text.size()) {
+        return false;
+    }
+    if (any_.empty()) {
+        return std::memcmp(text.data() + pos, chars_.data(), chars_.size()) == 0;
+    }
+    for (SizeT i = 0; i < chars_.size(); ++i) {
+        if (!any_[i] && text[pos + i] != chars_[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+SizeT LikePattern::Segment::Find(std::string_view text, SizeT from) const {
+    if (any_.empty()) {
+        return text.find(chars_, from);
+    }
+    for (SizeT pos = from; pos + chars_.size() <= text.size(); ++pos) {
+        if (MatchAt(text, pos)) {
+            return pos;
+        }
+    }
+    return std::string_view::npos;
+}
+
+// RegexPattern
+
+namespace {
+
+constexpr SizeT kMaxRepeat = 1000;
+constexpr SizeT kMaxProgramSize = 100000;
+constexpr SizeT kMaxNestingDepth = 1000;
+
+void RaiseRegexError(std::string_view pattern, const String &detail) {
+    Status status = Status::SyntaxError(fmt::format("Invalid regular expression '{}': {}", pattern, detail));
+    LOG_ERROR(status.message());
+    RecoverableError(status);
+}
+
+} // namespace
+
+struct RegexPattern::Node {
+    enum class Type : u8 {
+        kClass,
+        kBegin,
+        kEnd,
+        kConcat,
+        kAlternate,
+        kRepeat,
+    };
+
+    explicit Node(Type type) : type_(type) {}
+
+    Type type_;
+    std::bitset<256> class_;
+    Vector<UniquePtr<Node>> children_;
+    SizeT min_{0};
+    // -1 for unbounded
+    i64 max_{-1};
+};
+
+// Recursive descent parser: alternate := concat ('|' concat)*, concat := repeat*, repeat := atom quantifier*
+class RegexPattern::Parser {
+public:
+    explicit Parser(std::string_view pattern) : pattern_(pattern) {}
+
+    UniquePtr<Node> Parse() {
+        auto node = ParseAlternate();
+        if (pos_ < pattern_.size()) {
+            RaiseRegexError(pattern_, "unmatched ')'");
+        }
+        return node;
+    }
+
+private:
+    bool AtEnd() const { return pos_ >= pattern_.size(); }
+
+    char Peek() const { return pattern_[pos_]; }
+
+    UniquePtr<Node> ParseAlternate() {
+        if (++depth_ > kMaxNestingDepth) {
+            RaiseRegexError(pattern_, "nesting too deep");
+        }
+        auto node = MakeUnique<Node>(Node::Type::kAlternate);
+        node->children_.push_back(ParseConcat());
+        while (!AtEnd() && Peek() == '|') {
+            ++pos_;
+            node->children_.push_back(ParseConcat());
+        }
+        --depth_;
+        if (node->children_.size() == 1) {
+            return std::move(node->children_[0]);
+        }
+        return node;
+    }
+
+    UniquePtr<Node> ParseConcat() {
+        auto node = MakeUnique<Node>(Node::Type::kConcat);
+        while (!AtEnd() && Peek() != '|' && Peek() != ')') {
+            node->children_.push_back(ParseRepeat());
+        }
+        if (node->children_.size() == 1) {
+            return std::move(node->children_[0]);
+        }
+        return node;
+    }
+
+    UniquePtr<Node> ParseRepeat() {
+        auto node = ParseAtom();
+        while (!AtEnd()) {
+            SizeT min = 0;
+            i64 max = -1;
+            char c = Peek();
+            if (c == '*') {
+                ++pos_;
+            } else if (c == '+') {
+                min = 1;
+                ++pos_;
+            } else if (c == '?') {
+                max = 1;
+                ++pos_;
+            } else if (c != '{' || !ParseCount(min, max)) {
+                break;
+            }
+            // the laziness doesn't change whether the text matches
+            if (!AtEnd() && Peek() == '?') {
+                ++pos_;
+            }
+            auto repeat = MakeUnique<Node>(Node::Type::kRepeat);
+            repeat->min_ = min;
+            repeat->max_ = max;
+            repeat->children_.push_back(std::move(node));
+            node = std::move(repeat);
+        }
+        return node;
+    }
+
+    // {n}, {n,} or {n,m}. A brace which doesn't start a valid count is a literal, as in RE2.
+    bool ParseCount(SizeT &min, i64 &max) {
+        SizeT pos = pos_ + 1;
+        auto parse_number = [&](SizeT &number) {
+            SizeT begin = pos;
+            number = 0;
+            while (pos < pattern_.size() && std::isdigit(static_cast<unsigned char>(pattern_[pos])) && pos - begin < 5) {
+                number = number * 10 + (pattern_[pos++] - '0');
+            }
+            return pos > begin;
+        };
+        SizeT lower = 0;
+        if (!parse_number(lower)) {
+            return false;
+        }
+        SizeT upper = lower;
+        bool unbounded = false;
+        if (pos < pattern_.size() && pattern_[pos] == ',') {
+            ++pos;
+            if (!parse_number(upper)) {
+                unbounded = true;
+            }
+        }
+        if (pos >= pattern_.size() || pattern_[pos] != '}') {
+            return false;
+        }
+        if (lower > kMaxRepeat || upper > kMaxRepeat || (!unbounded && upper < lower)) {
+            RaiseRegexError(pattern_, "bad repetition operator");
+        }
+        pos_ = pos + 1;
+        min = lower;
+        max = unbounded ? -1 : i64(upper);
+        return true;
+    }
+
+    UniquePtr<Node> ParseAtom() {
+        char c = pattern_[pos_++];
+        switch (c) {
+            case '(': {
+                if (!AtEnd() && Peek() == '?') {
+                    if (pos_ + 1 < pattern_.size() && pattern_[pos_ + 1] == ':') {
+                        pos_ += 2;
+                    } else {
+                        RaiseRegexError(pattern_, "unsupported group syntax");
+                    }
+                }
+                auto node = ParseAlternate();
+                if (AtEnd() || Peek() != ')') {
+                    RaiseRegexError(pattern_, "missing ')'");
+                }
+                ++pos_;
+                return node;
+            }
+            case '[':
+                return ParseClass();
+            case '.': {
+                auto node = MakeUnique<Node>(Node::Type::kClass);
+                node->class_.set();
+                node->class_.reset('\n');
+                return node;
+            }
+            case '^':
+                return MakeUnique<Node>(Node::Type::kBegin);
+            case '$':
+                return MakeUnique<Node>(Node::Type::kEnd);
+            case '*':
+            case '+':
+            case '?':
+                RaiseRegexError(pattern_, "missing argument to repetition operator");
+                return nullptr;
+            case '\\': {
+                auto node = MakeUnique<Node>(Node::Type::kClass);
+                ParseEscape(node->class_);
+                return node;
+            }
+            default: {
+                auto node = MakeUnique<Node>(Node::Type::kClass);
+                node->class_.set(static_cast<u8>(c));
+                return node;
+            }
+        }
+    }
+
+    // [abc], [^a-z], []a] and [\d_]
+    UniquePtr<Node> ParseClass() {
+        auto node = MakeUnique<Node>(Node::Type::kClass);
+        bool negate = false;
+        if (!AtEnd() && Peek() == '^') {
+            negate = true;
+            ++pos_;
+        }
+        bool first = true;
+        while (!AtEnd() && (Peek() != ']' || first)) {
+            first = false;
+            std::bitset<256> item;
+            u8 low = ParseClassChar(item);
+            if (item.none() && pos_ + 1 < pattern_.size() && Peek() == '-' && pattern_[pos_ + 1] != ']') {
+                ++pos_;
+                std::bitset<256> high_item;
+                u8 high = ParseClassChar(high_item);
+                if (high_item.any() || high < low) {
+                    RaiseRegexError(pattern_, "bad character class range");
+                }
+                for (SizeT b = low; b <= high; ++b) {
+                    node->class_.set(b);
+                }
+            } else if (item.none()) {
+                node->class_.set(low);
+            } else {
+                node->class_ |= item;
+            }
+        }
+        if (AtEnd()) {
+            RaiseRegexError(pattern_, "missing ']'");
+        }
+        ++pos_;
+        if (negate) {
+            node->class_.flip();
+        }
+        return node;
+    }
+
+    // A single character of a class, or fill the class of an escape like \d.
+    u8 ParseClassChar(std::bitset<256> &escape_class) {
+        if (Peek() != '\\') {
+            return static_cast<u8>(pattern_[pos_++]);
+        }
+        ++pos_;
+        std::bitset<256> escaped;
+        ParseEscape(escaped);
+        if (escaped.count() == 1) {
+            for (SizeT b = 0; b < 256; ++b) {
+                if (escaped.test(b)) {
+                    return static_cast<u8>(b);
+                }
+            }
+        }
+        escape_class = escaped;
+        return 0;
+    }
+
+    // the character after '\'
+    void ParseEscape(std::bitset<256> &result) {
+        if (AtEnd()) {
+            RaiseRegexError(pattern_, "trailing '\\'");
+        }
+        char c = pattern_[pos_++];
+        auto set_if = [&](auto predicate, bool negate) {
+            for (SizeT b = 0; b < 256; ++b) {
+                if (bool(predicate(int(b))) != negate) {
+                    result.set(b);
+                }
+            }
+        };
+        auto is_word = [](int b) { return std::isalnum(b) || b == '_'; };
+        auto is_digit = [](int b) { return std::isdigit(b); };
+        auto is_space = [](int b) { return std::isspace(b); };
+        switch (c) {
+            case 'd':
+            case 'D':
+                set_if(is_digit, c == 'D');
+                return;
+            case 'w':
+            case 'W':
+                set_if(is_word, c == 'W');
+                return;
+            case 's':
+            case 'S':
+                set_if(is_space, c == 'S');
+                return;
+            case 'n':
+                result.set('\n');
+                return;
+            case 't':
+                result.set('\t');
+                return;
+            case 'r':
+                result.set('\r');
+                return;
+            case 'f':
+                result.set('\f');
+                return;
+            case 'v':
+                result.set('\v');
+                return;
+            default:
+                break;
+        }
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            RaiseRegexError(pattern_, fmt::format("unsupported escape sequence \\{}", c));
+        }
+        result.set(static_cast<u8>(c));
+    }
+
+    std::string_view pattern_;
+    SizeT pos_{0};
+    SizeT depth_{0};
+};
+
+bool RegexPattern::GetLiteral(const Node &node, String &literal) {
+    if (node.type_ == Node::Type::kClass) {
+        if (node.class_.count() != 1) {
+            return false;
+        }
+        for (SizeT b = 0; b < 256; ++b) {
+            if (node.class_.test(b)) {
+                literal.push_back(static_cast<char>(b));
+            }
+        }
+        return true;
+    }
+    if (node.type_ == Node::Type::kConcat) {
+        for (const auto &child : node.children_) {
+            if (!GetLiteral(*child, literal)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+RegexPattern::RegexPattern(std::string_view pattern) {
+    Parser parser(pattern);
+    UniquePtr<Node> root = parser.Parse();
+    if (GetLiteral(*root, literal_)) {
+        is_literal_ = true;
+        return;
+    }
+    Compile(*root);
+    Emit(OpCode::kMatch);
+    if (program_.size() > kMaxProgramSize) {
+        RaiseRegexError(pattern, "pattern too large");
+    }
+    on_list_.resize(program_.size(), 0);
+}
+
+u32 RegexPattern::Emit(OpCode op, u32 arg, u32 arg2) {
+    program_.push_back({op, arg, arg2});
+    return program_.size() - 1;
+}
+
+void RegexPattern::Compile(const Node &node) {
+    if (program_.size() > kMaxProgramSize) {
+        // checked by the constructor
+        return;
+    }
+    switch (node.type_) {
+        case Node::Type::kClass: {
+            // share the class of consecutive single bytes, e.g. the repeated body of a{100}
+            auto iter = std::find(classes_.begin(), classes_.end(), node.class_);
+            u32 class_idx = iter - classes_.begin();
+            if (iter == classes_.end()) {
+                classes_.push_back(node.class_);
+            }
+            Emit(OpCode::kByte, class_idx);
+            break;
+        }
+        case Node::Type::kBegin: {
+            Emit(OpCode::kBegin);
+            break;
+        }
+        case Node::Type::kEnd: {
+            Emit(OpCode::kEnd);
+            break;
+        }
+        case Node::Type::kConcat: {
+            for (const auto &child : node.children_) {
+                Compile(*child);
+            }
+            break;
+        }
+        case Node::Type::kAlternate: {
+            Vector<u32> jumps;
+            for (SizeT i = 0; i + 1 < node.children_.size(); ++i) {
+                u32 split = Emit(OpCode::kSplit, program_.size() + 1);
+                Compile(*node.children_[i]);
+                jumps.push_back(Emit(OpCode::kJump));
+                program_[split].arg2_ = program_.size();
+            }
+            Compile(*node.children_.back());
+            for (u32 jump : jumps) {
+                program_[jump].arg_ = program_.size();
+            }
+            break;
+        }
+        case Node::Type::kRepeat: {
+            const Node &child = *node.children_[0];
+            for (SizeT i = 0; i < node.min_; ++i) {
+                Compile(child);
+            }
+            if (node.max_ < 0) {
+                u32 split = Emit(OpCode::kSplit, program_.size() + 1);
+                Compile(child);
+                Emit(OpCode::kJump, split);
+                program_[split].arg2_ = program_.size();
+            } else {
+                Vector<u32> splits;
+                for (SizeT i = node.min_; i < SizeT(node.max_); ++i) {
+                    splits.push_back(Emit(OpCode::kSplit, program_.size() + 1));
+                    Compile(child);
+                }
+                for (u32 split : splits) {
+                    program_[split].arg2_ = program_.size();
+                }
+            }
+            break;
+        }
+    }
+}
+
+void RegexPattern::AddThread(Vector<u32> &list, u32 pc, SizeT pos, SizeT text_len) const {
+    stack_.clear();
+    stack_.push_back(pc);
+    while (!stack_.empty()) {
+        pc = stack_.back();
+        stack_.pop_back();
+        if (on_list_[pc] == generation_) {
+            continue;
+        }
+        on_list_[pc] = generation_;
+        const Instruction &inst = program_[pc];
+        switch (inst.op_) {
+            case OpCode::kJump: {
+                stack_.push_back(inst.arg_);
+                break;
+            }
+            case OpCode::kSplit: {
+                stack_.push_back(inst.arg2_);
+                stack_.push_back(inst.arg_);
+                break;
+            }
+            case OpCode::kBegin: {
+                if (pos == 0) {
+                    stack_.push_back(pc + 1);
+                }
+                break;
+            }
+            case OpCode::kEnd: {
+                if (pos == text_len) {
+                    stack_.push_back(pc + 1);
+                }
+                break;
+            }
+            case OpCode::kByte:
+            case OpCode::kMatch: {
+                list.push_back(pc);
+                break;
+            }
+        }
+    }
+}
+
+void RegexPattern::NextGeneration() const {
+    if (++generation_ == 0) {
+        std::fill(on_list_.begin(), on_list_.end(), 0);
+        generation_ = 1;
+    }
+}
+
+bool RegexPattern::Match(std::string_view text) const {
+    if (is_literal_) {
+        return text.find(literal_) != std::string_view::npos;
+    }
+    current_list_.clear();
+    next_list_.clear();
+    NextGeneration();
+    AddThread(current_list_, 0, 0, text.size());
+    for (SizeT pos = 0;; ++pos) {
+        NextGeneration();
+        for (u32 pc : current_list_) {
+            const Instruction &inst = program_[pc];
+            if (inst.op_ == OpCode::kMatch) {
+                return true;
+            }
+            if (pos < text.size() && classes_[inst.arg_].test(static_cast<u8>(text[pos]))) {
+                AddThread(next_list_, pc + 1, pos + 1, text.size());
+            }
+        }
+        if (pos == text.size()) {
+            return false;
+        }
+        // the search is unanchored, a new thread starts at every position
+        AddThread(next_list_, 0, pos + 1, text.size());
+        std::swap(current_list_, next_list_);
+        next_list_.clear();
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,188 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bitset>
+#include <string_view>
+
+export module string_pattern;
+
+import stl;
+import column_vector;
+import data_block;
+import bitmask;
+import vector_buffer;
+import infinity_exception;
+import logger;
+
+namespace infinity {
+
+// A LIKE pattern compiled once per query. '%' matches any sequence, '_' matches any single byte and '\' escapes the
+// next character. The pattern is split by '%' into segments, which are matched leftmost-first: the first and last
+// segments are anchored unless the pattern starts or ends with '%', the middle ones are searched in order. This is
+// linear in the length of the text, no backtracking is needed.
+export class LikePattern {
+public:
+    enum class Kind : u8 {
+        kExact,    // abc
+        kPrefix,   // abc%
+        kSuffix,   // %abc
+        kContains, // %abc%
+        kGeneral,
+    };
+
+    explicit LikePattern(std::string_view pattern);
+
+    bool Match(std::string_view text) const;
+
+    Kind kind() const { return kind_; }
+
+    // The text of an exact pattern or the literal prefix before the first wildcard, without escapes.
+    std::string_view LiteralPrefix() const { return literal_prefix_; }
+
+private:
+    struct Segment {
+        String chars_;
+        // '_' positions, empty if there is none
+        Vector<bool> any_;
+
+        bool MatchAt(std::string_view text, SizeT pos) const;
+        // the leftmost position not before `from` where the segment matches, or npos
+        SizeT Find(std::string_view text, SizeT from) const;
+    };
+
+    Vector<Segment> segments_;
+    bool anchored_begin_{true};
+    bool anchored_end_{true};
+    SizeT min_length_{0};
+    Kind kind_{Kind::kGeneral};
+    String literal_prefix_;
+};
+
+// A regular expression for REGEXP_MATCH, compiled to a Thompson NFA and run by a Pike VM, so the matching time is
+// O(text length * program size) for any input, like RE2. Supported syntax: literals, '.', '[...]' and '[^...]' with
+// ranges, the escapes \d \D \w \W \s \S, '^', '$', groups, '|', and the repetitions '*', '+', '?', '{n}', '{n,}'
+// and '{n,m}'. Backreferences and lookaround are rejected. Search is unanchored, as in POSIX regexec.
+// Match reuses the thread lists of the pattern, so a pattern is used by one thread at a time.
+export class RegexPattern {
+public:
+    // raise a recoverable error on invalid pattern
+    explicit RegexPattern(std::string_view pattern);
+
+    bool Match(std::string_view text) const;
+
+private:
+    enum class OpCode : u8 {
+        kByte,  // consume a byte in class arg_
+        kSplit, // fork to arg_ and arg2_
+        kJump,  // go to arg_
+        kBegin, // assert the beginning of the text
+        kEnd,   // assert the end of the text
+        kMatch,
+    };
+
+    struct Instruction {
+        OpCode op_;
+        u32 arg_{0};
+        u32 arg2_{0};
+    };
+
+    struct Node;
+    class Parser;
+
+    static bool GetLiteral(const Node &node, String &literal);
+
+    void Compile(const Node &node);
+
+    u32 Emit(OpCode op, u32 arg = 0, u32 arg2 = 0);
+
+    void NextGeneration() const;
+
+    // add the threads reachable from pc by epsilon transitions
+    void AddThread(Vector<u32> &list, u32 pc, SizeT pos, SizeT text_len) const;
+
+    Vector<Instruction> program_;
+    Vector<std::bitset<256>> classes_;
+    // the whole pattern is a literal, matched by substring search
+    bool is_literal_{false};
+    String literal_;
+
+    // a pc is on the list being built if its mark equals the generation
+    mutable Vector<u32> on_list_;
+    mutable u32 generation_{0};
+    mutable Vector<u32> stack_;
+    mutable Vector<u32> current_list_;
+    mutable Vector<u32> next_list_;
+};
+
+// The scalar function of `text LIKE pattern` and the like, evaluated over the whole block. The pattern is compiled
+// once if it's constant, which is the common case; a column of patterns is compiled whenever the pattern changes.
+export template <typename Pattern, bool kNegate>
+void PatternMatchFunction(const DataBlock &input, SharedPtr<ColumnVector> &output) {
+    if (input.column_count() != 2) {
+        String error_message = "Pattern match function: input column count isn't two.";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    const SharedPtr<ColumnVector> &text_column = input.column_vectors[0];
+    const SharedPtr<ColumnVector> &pattern_column = input.column_vectors[1];
+    const bool text_constant = text_column->vector_type() == ColumnVectorType::kConstant;
+    const bool pattern_constant = pattern_column->vector_type() == ColumnVectorType::kConstant;
+    const SizeT row_count = text_constant && pattern_constant ? 1 : input.row_count();
+
+    // null if any argument is null
+    const SharedPtr<Bitmask> &text_null = text_column->nulls_ptr_;
+    const SharedPtr<Bitmask> &pattern_null = pattern_column->nulls_ptr_;
+    SharedPtr<Bitmask> &result_null = output->nulls_ptr_;
+    if ((text_constant && !text_null->IsAllTrue()) || (pattern_constant && !pattern_null->IsAllTrue())) {
+        result_null->SetAllFalse();
+        output->Finalize(row_count);
+        return;
+    }
+    if (text_null->IsAllTrue()) {
+        result_null->DeepCopy(*pattern_null);
+    } else {
+        result_null->DeepCopy(*text_null);
+        if (!pattern_null->IsAllTrue()) {
+            result_null->Merge(*pattern_null);
+        }
+    }
+    const bool all_valid = result_null->IsAllTrue();
+
+    String text_buffer;
+    String pattern_buffer;
+    String compiled_text;
+    UniquePtr<Pattern> pattern;
+    if (pattern_constant) {
+        pattern = MakeUnique<Pattern>(pattern_column->GetVarcharView(0, pattern_buffer));
+    }
+    for (SizeT idx = 0; idx < row_count; ++idx) {
+        if (!all_valid && !result_null->IsTrue(idx)) {
+            continue;
+        }
+        if (!pattern_constant) {
+            std::string_view pattern_text = pattern_column->GetVarcharView(idx, pattern_buffer);
+            if (pattern.get() == nullptr || pattern_text != compiled_text) {
+                pattern = MakeUnique<Pattern>(pattern_text);
+                compiled_text = pattern_text;
+            }
+        }
+        std::string_view text = text_column->GetVarcharView(text_constant ? 0 : idx, text_buffer);
+        output->buffer_->SetCompactBit(idx, pattern->Match(text) != kNegate);
+    }
+    output->Finalize(row_count);
+}
+
+} // namespace infinity
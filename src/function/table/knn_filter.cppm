@@ -48,10 +48,14 @@ private:
 export class DeleteFilter final : public FilterBase<SegmentOffset> {
 public:
     explicit DeleteFilter(const SegmentEntry *segment, TxnTimeStamp query_ts, SegmentOffset max_segment_offset)
-        : segment_(segment), query_ts_(query_ts), max_segment_offset_(max_segment_offset) {}
+        : segment_(segment), query_ts_(query_ts), max_segment_offset_(max_segment_offset), fully_visible_(segment->FullyVisible(query_ts)),
+          segment_row_count_(segment->row_count()) {}
 
     bool operator()(const SegmentOffset &segment_offset) const final {
         bool check_append = max_segment_offset_ == 0;
+        if (fully_visible_) {
+            return segment_offset <= max_segment_offset_ && (!check_append || segment_offset < segment_row_count_);
+        }
         return segment_offset <= max_segment_offset_ && segment_->CheckRowVisible(segment_offset, query_ts_, check_append);
     }
 
@@ -61,6 +65,11 @@ private:
     const TxnTimeStamp query_ts_;
 
     const SegmentOffset max_segment_offset_;
+
+    // No row of the segment is deleted or appended after query_ts, skip the per row visibility check.
+    const bool fully_visible_;
+
+    const SizeT segment_row_count_;
 };
 
 export class DeleteWithBitmaskFilter final : public FilterBase<SegmentOffset> {
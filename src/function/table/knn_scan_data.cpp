@@ -69,6 +69,29 @@ KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type) {
 
 // --------------------------------------------
 
+void KnnScanSharedData::InitTopKThreshold() {
+    if (query_count_ != 1 or elem_type_ != EmbeddingDataType::kElemFloat) {
+        return;
+    }
+    switch (knn_distance_type_) {
+        case KnnDistanceType::kL2:
+        case KnnDistanceType::kHamming: {
+            topk_threshold_ = MakeUnique<KnnThreshold<f32, CompareMax>>();
+            break;
+        }
+        case KnnDistanceType::kCosine:
+        case KnnDistanceType::kInnerProduct: {
+            topk_threshold_ = MakeUnique<KnnThreshold<f32, CompareMin>>();
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+// --------------------------------------------
+
 KnnScanFunctionData::KnnScanFunctionData(KnnScanSharedData *shared_data, u32 current_parallel_idx)
     : knn_scan_shared_data_(shared_data), task_id_(current_parallel_idx) {
     switch (knn_scan_shared_data_->elem_type_) {
@@ -51,7 +51,12 @@ public:
                       KnnDistanceType knn_distance_type)
         : table_ref_(table_ref), block_column_entries_(std::move(block_column_entries)), index_entries_(std::move(index_entries)),
           opt_params_(std::move(opt_params)), topk_(topk), dimension_(dimension), query_count_(query_embedding_count),
-          query_embedding_(query_embedding), elem_type_(elem_type), knn_distance_type_(knn_distance_type) {}
+          query_embedding_(query_embedding), elem_type_(elem_type), knn_distance_type_(knn_distance_type) {
+        InitTopKThreshold();
+    }
+
+private:
+    void InitTopKThreshold();
 
 public:
     const SharedPtr<BaseTableRef> table_ref_{};
@@ -69,6 +74,9 @@ public:
 
     atomic_u64 current_block_idx_{0};
     atomic_u64 current_index_idx_{0};
+
+    // k-th best distance among the results of all tasks, nullptr if the scan has more than one query
+    UniquePtr<KnnThresholdBase> topk_threshold_{};
 };
 
 //-------------------------------------------------------------------
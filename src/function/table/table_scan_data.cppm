@@ -35,6 +35,10 @@ public:
 
     u64 current_block_ids_idx_{0};
     SizeT current_read_offset_{0};
+
+    // Visibility of the current block, computed once when the scan enters the block.
+    BlockOffset current_visible_row_count_{0};
+    Vector<u64> current_visible_mask_{};
 };
 
 } // namespace infinity
@@ -178,6 +178,38 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             UnrecoverableError(status.message());
         }
 
+        // Ingest CPU quota
+        UniquePtr<IntegerOption> ingest_cpu_quota_option = MakeUnique<IntegerOption>(INGEST_CPU_QUOTA_OPTION_NAME, DEFAULT_INGEST_CPU_QUOTA, 100, 1);
+        status = global_options_.AddOption(std::move(ingest_cpu_quota_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Background CPU quota
+        UniquePtr<IntegerOption> background_cpu_quota_option = MakeUnique<IntegerOption>(BACKGROUND_CPU_QUOTA_OPTION_NAME, DEFAULT_BACKGROUND_CPU_QUOTA, 100, 1);
+        status = global_options_.AddOption(std::move(background_cpu_quota_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Profile sample rate
+        UniquePtr<IntegerOption> profile_sample_rate_option = MakeUnique<IntegerOption>(PROFILE_SAMPLE_RATE_OPTION_NAME, DEFAULT_PROFILE_SAMPLE_RATE, std::numeric_limits<i64>::max(), 0);
+        status = global_options_.AddOption(std::move(profile_sample_rate_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Slow query threshold
+        UniquePtr<IntegerOption> slow_query_threshold_option = MakeUnique<IntegerOption>(SLOW_QUERY_THRESHOLD_OPTION_NAME, DEFAULT_SLOW_QUERY_THRESHOLD, MAX_SLOW_QUERY_THRESHOLD, 0);
+        status = global_options_.AddOption(std::move(slow_query_threshold_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Server address
         String server_address_str = "0.0.0.0";
         UniquePtr<StringOption> server_address_option = MakeUnique<StringOption>(SERVER_ADDRESS_OPTION_NAME, server_address_str);
@@ -327,6 +359,38 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             UnrecoverableError(status.message());
         }
 
+        // Compaction IO Rate
+        UniquePtr<IntegerOption> compaction_io_rate_option =
+            MakeUnique<IntegerOption>(COMPACTION_IO_RATE_OPTION_NAME, DEFAULT_COMPACTION_IO_RATE, std::numeric_limits<i64>::max(), 0);
+        status = global_options_.AddOption(std::move(compaction_io_rate_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Compaction Cost Model
+        UniquePtr<FloatOption> compaction_min_delete_ratio_option =
+            MakeUnique<FloatOption>(COMPACTION_MIN_DELETE_RATIO_OPTION_NAME, DEFAULT_COMPACTION_MIN_DELETE_RATIO, 1.0, 0.0);
+        status = global_options_.AddOption(std::move(compaction_min_delete_ratio_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+        UniquePtr<FloatOption> compaction_index_rebuild_cost_option =
+            MakeUnique<FloatOption>(COMPACTION_INDEX_REBUILD_COST_OPTION_NAME, DEFAULT_COMPACTION_INDEX_REBUILD_COST, MAX_COMPACTION_COST_WEIGHT, 0.0);
+        status = global_options_.AddOption(std::move(compaction_index_rebuild_cost_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+        UniquePtr<FloatOption> compaction_heat_weight_option =
+            MakeUnique<FloatOption>(COMPACTION_HEAT_WEIGHT_OPTION_NAME, DEFAULT_COMPACTION_HEAT_WEIGHT, MAX_COMPACTION_COST_WEIGHT, 0.0);
+        status = global_options_.AddOption(std::move(compaction_heat_weight_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Buffer Manager Size
         i64 buffer_manager_size = DEFAULT_BUFFER_MANAGER_SIZE;
         UniquePtr<IntegerOption> buffer_manager_size_option =
@@ -532,6 +596,76 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kIngestCPUQuota: {
+                            i64 ingest_cpu_quota = DEFAULT_INGEST_CPU_QUOTA;
+                            if (elem.second.is_integer()) {
+                                ingest_cpu_quota = elem.second.value_or(ingest_cpu_quota);
+                            } else {
+                                return Status::InvalidConfig("'ingest_cpu_quota' field isn't integer.");
+                            }
+                            UniquePtr<IntegerOption> ingest_cpu_quota_option = MakeUnique<IntegerOption>(INGEST_CPU_QUOTA_OPTION_NAME, ingest_cpu_quota, 100, 1);
+                            if (!ingest_cpu_quota_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid ingest cpu quota: {}", ingest_cpu_quota));
+                            }
+                            Status status = global_options_.AddOption(std::move(ingest_cpu_quota_option));
+                            if (!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kBackgroundCPUQuota: {
+                            i64 background_cpu_quota = DEFAULT_BACKGROUND_CPU_QUOTA;
+                            if (elem.second.is_integer()) {
+                                background_cpu_quota = elem.second.value_or(background_cpu_quota);
+                            } else {
+                                return Status::InvalidConfig("'background_cpu_quota' field isn't integer.");
+                            }
+                            UniquePtr<IntegerOption> background_cpu_quota_option = MakeUnique<IntegerOption>(BACKGROUND_CPU_QUOTA_OPTION_NAME, background_cpu_quota, 100, 1);
+                            if (!background_cpu_quota_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid background cpu quota: {}", background_cpu_quota));
+                            }
+                            Status status = global_options_.AddOption(std::move(background_cpu_quota_option));
+                            if (!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kProfileSampleRate: {
+                            i64 profile_sample_rate = DEFAULT_PROFILE_SAMPLE_RATE;
+                            if (elem.second.is_integer()) {
+                                profile_sample_rate = elem.second.value_or(profile_sample_rate);
+                            } else {
+                                return Status::InvalidConfig("'profile_sample_rate' field isn't integer.");
+                            }
+                            UniquePtr<IntegerOption> profile_sample_rate_option =
+                                MakeUnique<IntegerOption>(PROFILE_SAMPLE_RATE_OPTION_NAME, profile_sample_rate, std::numeric_limits<i64>::max(), 0);
+                            if (!profile_sample_rate_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid profile sample rate: {}", profile_sample_rate));
+                            }
+                            Status status = global_options_.AddOption(std::move(profile_sample_rate_option));
+                            if (!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kSlowQueryThreshold: {
+                            i64 slow_query_threshold = DEFAULT_SLOW_QUERY_THRESHOLD;
+                            if (elem.second.is_integer()) {
+                                slow_query_threshold = elem.second.value_or(slow_query_threshold);
+                            } else {
+                                return Status::InvalidConfig("'slow_query_threshold' field isn't integer.");
+                            }
+                            UniquePtr<IntegerOption> slow_query_threshold_option =
+                                MakeUnique<IntegerOption>(SLOW_QUERY_THRESHOLD_OPTION_NAME, slow_query_threshold, MAX_SLOW_QUERY_THRESHOLD, 0);
+                            if (!slow_query_threshold_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid slow query threshold: {}", slow_query_threshold));
+                            }
+                            Status status = global_options_.AddOption(std::move(slow_query_threshold_option));
+                            if (!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'general' field", var_name));
                         }
@@ -578,6 +712,40 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                         UnrecoverableError(status.message());
                     }
                 }
+
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kIngestCPUQuota) == nullptr) {
+                    UniquePtr<IntegerOption> ingest_cpu_quota_option = MakeUnique<IntegerOption>(INGEST_CPU_QUOTA_OPTION_NAME, DEFAULT_INGEST_CPU_QUOTA, 100, 1);
+                    Status status = global_options_.AddOption(std::move(ingest_cpu_quota_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kBackgroundCPUQuota) == nullptr) {
+                    UniquePtr<IntegerOption> background_cpu_quota_option = MakeUnique<IntegerOption>(BACKGROUND_CPU_QUOTA_OPTION_NAME, DEFAULT_BACKGROUND_CPU_QUOTA, 100, 1);
+                    Status status = global_options_.AddOption(std::move(background_cpu_quota_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kProfileSampleRate) == nullptr) {
+                    UniquePtr<IntegerOption> profile_sample_rate_option =
+                        MakeUnique<IntegerOption>(PROFILE_SAMPLE_RATE_OPTION_NAME, DEFAULT_PROFILE_SAMPLE_RATE, std::numeric_limits<i64>::max(), 0);
+                    Status status = global_options_.AddOption(std::move(profile_sample_rate_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kSlowQueryThreshold) == nullptr) {
+                    UniquePtr<IntegerOption> slow_query_threshold_option =
+                        MakeUnique<IntegerOption>(SLOW_QUERY_THRESHOLD_OPTION_NAME, DEFAULT_SLOW_QUERY_THRESHOLD, MAX_SLOW_QUERY_THRESHOLD, 0);
+                    Status status = global_options_.AddOption(std::move(slow_query_threshold_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
             }
         }
 
@@ -1090,6 +1258,52 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kCompactionIORate: {
+                            // Compaction IO Rate
+                            i64 compaction_io_rate = DEFAULT_COMPACTION_IO_RATE;
+                            if(elem.second.is_string()) {
+                                String compaction_io_rate_str = elem.second.value_or(DEFAULT_COMPACTION_IO_RATE_STR.data());
+                                auto res = ParseByteSize(compaction_io_rate_str, compaction_io_rate);
+                                if (!res.ok()) {
+                                    return res;
+                                }
+                            } else {
+                                return Status::InvalidConfig("'compaction_io_rate' field isn't string, such as \"64MB\".");
+                            }
+                            UniquePtr<IntegerOption> compaction_io_rate_option =
+                                MakeUnique<IntegerOption>(COMPACTION_IO_RATE_OPTION_NAME, compaction_io_rate, std::numeric_limits<i64>::max(), 0);
+                            if (!compaction_io_rate_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid compaction io rate: {}", compaction_io_rate));
+                            }
+                            Status status = global_options_.AddOption(std::move(compaction_io_rate_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kCompactionMinDeleteRatio:
+                        case GlobalOptionIndex::kCompactionIndexRebuildCost:
+                        case GlobalOptionIndex::kCompactionHeatWeight: {
+                            // Compaction Cost Model
+                            f64 value = 0;
+                            if(elem.second.is_floating_point()) {
+                                value = elem.second.value_or(value);
+                            } else if(elem.second.is_integer()) {
+                                value = elem.second.value_or(i64(0));
+                            } else {
+                                return Status::InvalidConfig(fmt::format("'{}' field isn't number.", var_name));
+                            }
+                            f64 upper_bound = option_index == GlobalOptionIndex::kCompactionMinDeleteRatio ? 1.0 : MAX_COMPACTION_COST_WEIGHT;
+                            UniquePtr<FloatOption> cost_option = MakeUnique<FloatOption>(var_name, value, upper_bound, 0.0);
+                            if (!cost_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid {}: {}", var_name, value));
+                            }
+                            Status status = global_options_.AddOption(std::move(cost_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'storage' field", var_name));
                         }
@@ -1150,6 +1364,43 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                     }
                 }
 
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kCompactionIORate) == nullptr) {
+                    // Compaction IO Rate
+                    UniquePtr<IntegerOption> compaction_io_rate_option =
+                        MakeUnique<IntegerOption>(COMPACTION_IO_RATE_OPTION_NAME, DEFAULT_COMPACTION_IO_RATE, std::numeric_limits<i64>::max(), 0);
+                    Status status = global_options_.AddOption(std::move(compaction_io_rate_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kCompactionMinDeleteRatio) == nullptr) {
+                    UniquePtr<FloatOption> compaction_min_delete_ratio_option =
+                        MakeUnique<FloatOption>(COMPACTION_MIN_DELETE_RATIO_OPTION_NAME, DEFAULT_COMPACTION_MIN_DELETE_RATIO, 1.0, 0.0);
+                    Status status = global_options_.AddOption(std::move(compaction_min_delete_ratio_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kCompactionIndexRebuildCost) == nullptr) {
+                    UniquePtr<FloatOption> compaction_index_rebuild_cost_option =
+                        MakeUnique<FloatOption>(COMPACTION_INDEX_REBUILD_COST_OPTION_NAME, DEFAULT_COMPACTION_INDEX_REBUILD_COST, MAX_COMPACTION_COST_WEIGHT, 0.0);
+                    Status status = global_options_.AddOption(std::move(compaction_index_rebuild_cost_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kCompactionHeatWeight) == nullptr) {
+                    UniquePtr<FloatOption> compaction_heat_weight_option =
+                        MakeUnique<FloatOption>(COMPACTION_HEAT_WEIGHT_OPTION_NAME, DEFAULT_COMPACTION_HEAT_WEIGHT, MAX_COMPACTION_COST_WEIGHT, 0.0);
+                    Status status = global_options_.AddOption(std::move(compaction_heat_weight_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
             } else {
                 return Status::InvalidConfig("No 'storage' section in configure file.");
             }
@@ -1568,6 +1819,57 @@ void Config::SetRecordRunningQuery(bool flag) {
     record_running_query_ = flag;
 }
 
+i64 Config::CPUQuota(GlobalOptionIndex option_index) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(option_index);
+}
+
+void Config::SetCPUQuota(GlobalOptionIndex option_index, i64 percent) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    BaseOption *base_option = global_options_.GetOptionByIndex(option_index);
+    if (base_option->data_type_ != BaseOptionDataType::kInteger) {
+        String error_message = "Attempt to set integer value to cpu quota data type option";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    IntegerOption *cpu_quota_option = static_cast<IntegerOption *>(base_option);
+    cpu_quota_option->value_ = percent;
+}
+
+i64 Config::ProfileSampleRate() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kProfileSampleRate);
+}
+
+void Config::SetProfileSampleRate(i64 sample_rate) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    BaseOption *base_option = global_options_.GetOptionByIndex(GlobalOptionIndex::kProfileSampleRate);
+    if (base_option->data_type_ != BaseOptionDataType::kInteger) {
+        String error_message = "Attempt to set integer value to profile sample rate data type option";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    IntegerOption *profile_sample_rate_option = static_cast<IntegerOption *>(base_option);
+    profile_sample_rate_option->value_ = sample_rate;
+}
+
+i64 Config::SlowQueryThreshold() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kSlowQueryThreshold);
+}
+
+void Config::SetSlowQueryThreshold(i64 threshold_ms) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    BaseOption *base_option = global_options_.GetOptionByIndex(GlobalOptionIndex::kSlowQueryThreshold);
+    if (base_option->data_type_ != BaseOptionDataType::kInteger) {
+        String error_message = "Attempt to set integer value to slow query threshold data type option";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    IntegerOption *slow_query_threshold_option = static_cast<IntegerOption *>(base_option);
+    slow_query_threshold_option->value_ = threshold_ms;
+}
+
 // Network
 String Config::ServerAddress() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -1675,6 +1977,38 @@ i64 Config::MemIndexCapacity() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kMemIndexCapacity);
 }
 
+i64 Config::CompactionIORate() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kCompactionIORate);
+}
+
+void Config::SetCompactionIORate(i64 bytes_per_second) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    BaseOption *base_option = global_options_.GetOptionByIndex(GlobalOptionIndex::kCompactionIORate);
+    if (base_option->data_type_ != BaseOptionDataType::kInteger) {
+        String error_message = "Attempt to set compaction io rate value to non-integer data type option";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    IntegerOption *compaction_io_rate_option = static_cast<IntegerOption *>(base_option);
+    compaction_io_rate_option->value_ = bytes_per_second;
+}
+
+f64 Config::CompactionMinDeleteRatio() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetFloatValue(GlobalOptionIndex::kCompactionMinDeleteRatio);
+}
+
+f64 Config::CompactionIndexRebuildCost() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetFloatValue(GlobalOptionIndex::kCompactionIndexRebuildCost);
+}
+
+f64 Config::CompactionHeatWeight() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetFloatValue(GlobalOptionIndex::kCompactionHeatWeight);
+}
+
 // Buffer
 i64 Config::BufferManagerSize() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -1746,6 +2080,10 @@ void Config::PrintAll() {
     fmt::print(" - version: {}\n", Version());
     fmt::print(" - timezone: {}{}\n", TimeZone(), TimeZoneBias());
     fmt::print(" - cpu_limit: {}\n", CPULimit());
+    fmt::print(" - ingest_cpu_quota: {}%\n", CPUQuota(GlobalOptionIndex::kIngestCPUQuota));
+    fmt::print(" - background_cpu_quota: {}%\n", CPUQuota(GlobalOptionIndex::kBackgroundCPUQuota));
+    fmt::print(" - profile_sample_rate: {}\n", ProfileSampleRate());
+    fmt::print(" - slow_query_threshold: {}ms\n", SlowQueryThreshold());
 
     //    // Profiler
     //    fmt::print(" - enable_profiler: {}\n", system_option_.enable_profiler);
@@ -1773,6 +2111,10 @@ void Config::PrintAll() {
     fmt::print(" - compact_interval: {}\n", Utility::FormatTimeInfo(CompactInterval()));
     fmt::print(" - optimize_index_interval: {}\n", Utility::FormatTimeInfo(OptimizeIndexInterval()));
     fmt::print(" - memindex_capacity: {}\n", Utility::FormatByteSize(MemIndexCapacity()));
+    fmt::print(" - compaction_io_rate: {}/s\n", Utility::FormatByteSize(CompactionIORate()));
+    fmt::print(" - compaction_min_delete_ratio: {}\n", CompactionMinDeleteRatio());
+    fmt::print(" - compaction_index_rebuild_cost: {}\n", CompactionIndexRebuildCost());
+    fmt::print(" - compaction_heat_weight: {}\n", CompactionHeatWeight());
 
     // Buffer manager
     fmt::print(" - buffer_manager_size: {}\n", Utility::FormatByteSize(BufferManagerSize()));
@@ -45,6 +45,15 @@ public:
         return record_running_query_;
     }
     void SetRecordRunningQuery(bool flag);
+    // kIngestCPUQuota or kBackgroundCPUQuota, in percent of cpu_limit
+    i64 CPUQuota(GlobalOptionIndex option_index);
+    void SetCPUQuota(GlobalOptionIndex option_index, i64 percent);
+    // Profile 1 in N queries, 0 for none
+    i64 ProfileSampleRate();
+    void SetProfileSampleRate(i64 sample_rate);
+    // Profile the queries taking at least this many milliseconds, 0 for none
+    i64 SlowQueryThreshold();
+    void SetSlowQueryThreshold(i64 threshold_ms);
 
     // Network
     String ServerAddress();
@@ -75,6 +84,15 @@ public:
 
     i64 MemIndexCapacity();
 
+    // bytes per second rewritten by auto compaction, 0 means unlimited
+    i64 CompactionIORate();
+    void SetCompactionIORate(i64 bytes_per_second);
+
+    // the cost model rewriting a segment with deleted rows alone, see CompactionCostModel
+    f64 CompactionMinDeleteRatio();
+    f64 CompactionIndexRebuildCost();
+    f64 CompactionHeatWeight();
+
     // Buffer
     i64 BufferManagerSize();
 
@@ -27,6 +27,10 @@ import task_scheduler;
 import storage;
 import session_manager;
 import variables;
+import plan_cache;
+import query_result_cache;
+import default_values;
+import options;
 
 namespace infinity {
 
@@ -56,8 +60,12 @@ void InfinityContext::Init(const SharedPtr<String> &config_path) {
         storage_ = MakeUnique<Storage>(config_.get());
         storage_->Init();
 
-        inverting_thread_pool_.resize(config_->CPULimit());
-        commiting_thread_pool_.resize(config_->CPULimit());
+        plan_cache_ = MakeUnique<PlanCache>(DEFAULT_PLAN_CACHE_CAPACITY);
+        result_cache_ = MakeUnique<QueryResultCache>(DEFAULT_QUERY_RESULT_CACHE_SIZE);
+
+        shared_thread_pool_.Resize(config_->CPULimit());
+        shared_thread_pool_.SetQuota(TaskClass::kIngest, config_->CPUQuota(GlobalOptionIndex::kIngestCPUQuota));
+        shared_thread_pool_.SetQuota(TaskClass::kBackground, config_->CPUQuota(GlobalOptionIndex::kBackgroundCPUQuota));
         initialized_ = true;
     }
 }
@@ -68,6 +76,10 @@ void InfinityContext::UnInit() {
     }
     initialized_ = false;
 
+    // cached plans refer to the catalog entries
+    result_cache_.reset();
+    plan_cache_.reset();
+
     storage_->UnInit();
     storage_.reset();
 
@@ -76,6 +88,9 @@ void InfinityContext::UnInit() {
     task_scheduler_->UnInit();
     task_scheduler_.reset();
 
+    // the storage and the fragments are gone, no task is submitted any more
+    shared_thread_pool_.Stop();
+
     resource_manager_.reset();
 
     Logger::Shutdown();
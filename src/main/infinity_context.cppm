@@ -23,7 +23,10 @@ import task_scheduler;
 import storage;
 import singleton;
 import session_manager;
+import plan_cache;
+import query_result_cache;
 import third_party;
+import default_values;
 
 namespace infinity {
 
@@ -39,8 +42,11 @@ public:
 
     [[nodiscard]] inline SessionManager *session_manager() noexcept { return session_mgr_.get(); }
 
-    [[nodiscard]] inline ThreadPool &GetFulltextInvertingThreadPool() { return inverting_thread_pool_; }
-    [[nodiscard]] inline ThreadPool &GetFulltextCommitingThreadPool() { return commiting_thread_pool_; }
+    [[nodiscard]] inline PlanCache *plan_cache() noexcept { return plan_cache_.get(); }
+
+    [[nodiscard]] inline QueryResultCache *result_cache() noexcept { return result_cache_.get(); }
+
+    [[nodiscard]] inline SharedThreadPool &GetSharedThreadPool() { return shared_thread_pool_; }
 
     void Init(const SharedPtr<String> &config_path);
 
@@ -56,9 +62,10 @@ private:
     UniquePtr<TaskScheduler> task_scheduler_{};
     UniquePtr<Storage> storage_{};
     UniquePtr<SessionManager> session_mgr_{};
-    // For fulltext index
-    ThreadPool inverting_thread_pool_{4};
-    ThreadPool commiting_thread_pool_{2};
+    UniquePtr<PlanCache> plan_cache_{};
+    UniquePtr<QueryResultCache> result_cache_{};
+    // For fulltext index and other ingest and background work, sized by cpu_limit in Init
+    SharedThreadPool shared_thread_pool_{DEFAULT_SHARED_THREAD_POOL_SIZE};
 
     bool initialized_{false};
 };
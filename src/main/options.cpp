@@ -51,6 +51,10 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(COMPACT_INTERVAL_OPTION_NAME)] = GlobalOptionIndex::kCompactInterval;
     name2index_[String(OPTIMIZE_INTERVAL_OPTION_NAME)] = GlobalOptionIndex::kOptimizeIndexInterval;
     name2index_[String(MEM_INDEX_CAPACITY_OPTION_NAME)] = GlobalOptionIndex::kMemIndexCapacity;
+    name2index_[String(COMPACTION_IO_RATE_OPTION_NAME)] = GlobalOptionIndex::kCompactionIORate;
+    name2index_[String(COMPACTION_MIN_DELETE_RATIO_OPTION_NAME)] = GlobalOptionIndex::kCompactionMinDeleteRatio;
+    name2index_[String(COMPACTION_INDEX_REBUILD_COST_OPTION_NAME)] = GlobalOptionIndex::kCompactionIndexRebuildCost;
+    name2index_[String(COMPACTION_HEAT_WEIGHT_OPTION_NAME)] = GlobalOptionIndex::kCompactionHeatWeight;
 
     name2index_[String(BUFFER_MANAGER_SIZE_OPTION_NAME)] = GlobalOptionIndex::kBufferManagerSize;
     name2index_[String(TEMP_DIR_OPTION_NAME)] = GlobalOptionIndex::kTempDir;
@@ -64,6 +68,10 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(RESOURCE_DIR_OPTION_NAME)] = GlobalOptionIndex::kResourcePath;
 
     name2index_[String(RECORD_RUNNING_QUERY_OPTION_NAME)] = GlobalOptionIndex::kRecordRunningQuery;
+    name2index_[String(INGEST_CPU_QUOTA_OPTION_NAME)] = GlobalOptionIndex::kIngestCPUQuota;
+    name2index_[String(BACKGROUND_CPU_QUOTA_OPTION_NAME)] = GlobalOptionIndex::kBackgroundCPUQuota;
+    name2index_[String(PROFILE_SAMPLE_RATE_OPTION_NAME)] = GlobalOptionIndex::kProfileSampleRate;
+    name2index_[String(SLOW_QUERY_THRESHOLD_OPTION_NAME)] = GlobalOptionIndex::kSlowQueryThreshold;
 }
 
 Status GlobalOptions::AddOption(UniquePtr<BaseOption> option) {
@@ -131,6 +139,17 @@ i64 GlobalOptions::GetIntegerValue(GlobalOptionIndex option_index) {
     return integer_option->value_;
 }
 
+f64 GlobalOptions::GetFloatValue(GlobalOptionIndex option_index) {
+    BaseOption* base_option = GetOptionByIndex(option_index);
+    if(base_option->data_type_ != BaseOptionDataType::kFloat) {
+        String error_message = "Attempt to fetch float value from non-float data type option";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    FloatOption* float_option = static_cast<FloatOption*>(base_option);
+    return float_option->value_;
+}
+
 bool GlobalOptions::GetBoolValue(GlobalOptionIndex option_index) {
     BaseOption* base_option = GetOptionByIndex(option_index);
     if(base_option->data_type_ != BaseOptionDataType::kBoolean) {
@@ -55,6 +55,8 @@ export struct FloatOption : public BaseOption {
     explicit FloatOption(std::string_view name, f64 default_value, f64 upper_bound, f64 lower_bound)
         : BaseOption(std::move(name), BaseOptionDataType::kFloat), value_(default_value), upper_bound_(upper_bound), lower_bound_(lower_bound) {}
 
+    [[nodiscard]] inline bool Validate() const { return value_ >= lower_bound_ && value_ <= upper_bound_; }
+
     f64 value_{};
     f64 upper_bound_{};
     f64 lower_bound_{};
@@ -142,7 +144,15 @@ export enum class GlobalOptionIndex {
     kFlushMethodAtCommit = 27,
     kResourcePath = 28,
     kRecordRunningQuery = 29,
-    kInvalid = 30
+    kIngestCPUQuota = 30,
+    kBackgroundCPUQuota = 31,
+    kProfileSampleRate = 32,
+    kSlowQueryThreshold = 33,
+    kCompactionIORate = 34,
+    kCompactionMinDeleteRatio = 35,
+    kCompactionIndexRebuildCost = 36,
+    kCompactionHeatWeight = 37,
+    kInvalid = 38
 };
 
 export struct GlobalOptions {
@@ -154,6 +164,7 @@ export struct GlobalOptions {
 
     String GetStringValue(GlobalOptionIndex option_index);
     i64 GetIntegerValue(GlobalOptionIndex option_index);
+    f64 GetFloatValue(GlobalOptionIndex option_index);
     bool GetBoolValue(GlobalOptionIndex option_index);
 
     Vector<UniquePtr<BaseOption>> options_;
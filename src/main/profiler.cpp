@@ -211,6 +211,30 @@ String QueryProfiler::QueryPhaseToString(QueryPhase phase) {
     return {};
 }
 
+String QueryProfiler::ProfileReasonToString(ProfileReason reason) {
+    switch (reason) {
+        case ProfileReason::kSession: {
+            return "session";
+        }
+        case ProfileReason::kSampled: {
+            return "sampled";
+        }
+        case ProfileReason::kSlow: {
+            return "slow";
+        }
+    }
+    return {};
+}
+
+i64 QueryProfiler::TotalElapsed() const {
+    constexpr SizeT profilers_count = magic_enum::enum_integer(QueryPhase::kInvalid);
+    i64 total = 0;
+    for (SizeT idx = 0; idx < profilers_count; ++idx) {
+        total += profilers_[idx].Elapsed();
+    }
+    return total;
+}
+
 void QueryProfiler::StartPhase(QueryPhase phase) {
     if (!enable_) {
         return;
@@ -373,9 +397,18 @@ nlohmann::json QueryProfiler::Serialize(const QueryProfiler *profiler) {
 
         json["fragments"].push_back(json_fragments);
     }
-    json["total"] = end - start;
+    // a query profiled for being slow has no task records
+    json["total"] = profiler->records_.empty() ? 0 : end - start;
     json["time_unit"] = "ns";
 
+    json["reason"] = ProfileReasonToString(profiler->reason_);
+    json["query"] = profiler->query_text_;
+    constexpr SizeT profilers_count = magic_enum::enum_integer(QueryPhase::kInvalid);
+    for (SizeT idx = 0; idx < profilers_count; ++idx) {
+        json["phases"][QueryPhaseToString(magic_enum::enum_value<QueryPhase>(idx))] = profiler->profilers_[idx].Elapsed();
+    }
+    json["phases_total"] = profiler->TotalElapsed();
+
     return json;
 }
 
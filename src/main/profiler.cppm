@@ -183,11 +183,19 @@ private:
     const PhysicalOperator *active_operator_ = nullptr;
 };
 
+// Why a query profile is taken
+export enum class ProfileReason : i8 {
+    kSession = 0, // the session turned profiling on
+    kSampled,     // one of every profile_sample_rate queries
+    kSlow,        // it took at least slow_query_threshold, only the query phases are timed
+};
+
 export class QueryProfiler {
 public:
     QueryProfiler() = default;
 
-    explicit QueryProfiler(bool enable) : enable_(enable) {};
+    explicit QueryProfiler(bool enable, ProfileReason reason = ProfileReason::kSession)
+        : enable_(enable), reason_(reason), profile_tasks_(reason != ProfileReason::kSlow) {};
 
     void StartPhase(QueryPhase phase);
 
@@ -197,20 +205,52 @@ public:
 
     void Flush(TaskProfiler &&profiler);
 
-    i64 ElapsedAt(SizeT index) {
+    i64 ElapsedAt(SizeT index) const {
         return profilers_[index].Elapsed();
     }
 
+    // Sum of all query phases in nanoseconds
+    i64 TotalElapsed() const;
+
+    ProfileReason reason() const { return reason_; }
+
+    // A sampled query is profiled with its operators, whatever it was profiled for so far
+    void SetSampled() {
+        reason_ = ProfileReason::kSampled;
+        profile_tasks_ = true;
+    }
+
+    // Whether the tasks time their operators
+    bool profile_tasks() const { return profile_tasks_; }
+
+    const String &query_text() const { return query_text_; }
+
+    void set_query_text(String query_text) { query_text_ = std::move(query_text); }
+
+    // The number of the profile in the history, kept while the older profiles are dropped
+    u64 profile_id() const { return profile_id_; }
+
+    void set_profile_id(u64 profile_id) { profile_id_ = profile_id; }
+
+    // fragment id -> task id -> one profiler for each run of the task, only read once the query is done
+    const HashMap<u64, HashMap<i64, Vector<TaskProfiler>>> &records() const { return records_; }
+
     OptimizerProfiler &optimizer() { return optimizer_; }
 
     [[nodiscard]] String ToString() const;
 
     static String QueryPhaseToString(QueryPhase phase);
 
+    static String ProfileReasonToString(ProfileReason reason);
+
     static nlohmann::json Serialize(const QueryProfiler *profiler);
 
 private:
     bool enable_ {};
+    ProfileReason reason_{ProfileReason::kSession};
+    bool profile_tasks_{true};
+    String query_text_{};
+    u64 profile_id_{};
 
     std::mutex flush_lock_{};
     HashMap<u64, HashMap<i64, Vector<TaskProfiler>>> records_{};
@@ -53,9 +53,28 @@ import parser_assert;
 import plan_fragment;
 import bg_query_state;
 import show_statement;
+import infinity_context;
+import plan_cache;
+import query_result_cache;
+import select_statement;
+import table_reference;
+import catalog;
+import data_table;
+import column_def;
 
 namespace infinity {
 
+namespace {
+
+// shared by all sessions, so that the sample rate holds for the whole server
+Atomic<u64> profile_sample_count{0};
+
+bool IsProfiledStatement(StatementType type) {
+    return type != StatementType::kCommand && type != StatementType::kExplain && type != StatementType::kShow;
+}
+
+} // namespace
+
 QueryContext::QueryContext(BaseSession *session) : session_ptr_(session){};
 
 QueryContext::~QueryContext() { UnInit(); }
@@ -84,6 +103,9 @@ void QueryContext::Init(Config *global_config_ptr,
 
 QueryResult QueryContext::Query(const String &query) {
     CreateQueryProfiler();
+    if (query_profiler_) {
+        query_profiler_->set_query_text(query);
+    }
 
     StartProfile(QueryPhase::kParser);
     UniquePtr<ParserResult> parsed_result = MakeUnique<ParserResult>();
@@ -117,8 +139,17 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
     Vector<UniquePtr<PhysicalOperator>> physical_plans{};
     SharedPtr<PlanFragment> plan_fragment{};
     UniquePtr<Notifier> notifier{};
+    PlanCache *plan_cache = nullptr;
+    Optional<String> plan_cache_key{};
+    UniquePtr<CachedPlan> cached_plan{};
+    QueryResultCache *result_cache = nullptr;
+    Optional<String> table_snapshot{};
+    String result_cache_key{};
+    bool result_cache_hit = false;
 
     query_id_ = session_ptr_->query_count();
+    CreateQueryProfiler();
+    SampleQueryProfiler(statement);
 //    ProfilerStart("Query");
 //    BaseProfiler profiler;
 //    profiler.Begin();
@@ -150,63 +181,117 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
 //                        session_ptr_->GetTxn()->TxnID(),
 //                        session_ptr_->GetTxn()->BeginTS(),
 //                        statement->ToString()));
-        RecordQueryProfiler(statement->type_);
 
-        // Build unoptimized logical plan for each SQL statement.
-        StartProfile(QueryPhase::kLogicalPlan);
-        SharedPtr<BindContext> bind_context;
-        auto status = logical_planner_->Build(statement, bind_context);
-        // FIXME
-        if (!status.ok()) {
-            LOG_ERROR(status.message());
-            RecoverableError(status);
+        Txn *txn = GetTxn();
+        plan_cache = InfinityContext::instance().plan_cache();
+        PlanParameters plan_parameters;
+        if (plan_cache != nullptr) {
+            plan_cache_key = PlanCache::MakeKey(statement, schema_name(), plan_parameters);
         }
-
-        current_max_node_id_ = bind_context->GetNewLogicalNodeId();
-        logical_plans = logical_planner_->LogicalPlans();
-        StopProfile(QueryPhase::kLogicalPlan);
-//        LOG_WARN(fmt::format("Before optimizer cost: {}", profiler.ElapsedToString()));
-        // Apply optimized rule to the logical plan
-        StartProfile(QueryPhase::kOptimizer);
-        for (auto &logical_plan : logical_plans) {
-            optimizer_->optimize(logical_plan, statement->type_);
+        const TxnTimeStamp schema_version = storage_->catalog()->schema_version_.load();
+
+        // Return the result of a repeated search, if the table hasn't changed since the result was cached
+        if (plan_cache_key.has_value() and is_enable_result_cache()) {
+            result_cache = InfinityContext::instance().result_cache();
+            const auto *table_ref = static_cast<const TableReference *>(static_cast<const SelectStatement *>(statement)->table_ref_);
+            const String &db_name = table_ref->db_name_.empty() ? schema_name() : table_ref->db_name_;
+            if (auto [table_entry, table_status] = txn->GetTableByName(db_name, table_ref->table_name_); table_status.ok()) {
+                table_snapshot = QueryResultCache::MakeTableSnapshot(table_entry, txn, schema_version);
+            }
+            if (table_snapshot.has_value()) {
+                result_cache_key = PlanCache::MakeResultKey(*plan_cache_key, plan_parameters);
+                result_cache_hit =
+                    result_cache->Get(result_cache_key, *table_snapshot, query_result.result_table_, query_result.root_operator_type_);
+            }
         }
-        StopProfile(QueryPhase::kOptimizer);
 
-        // Build physical plan
-        StartProfile(QueryPhase::kPhysicalPlan);
-        for (auto &logical_plan : logical_plans) {
-            auto physical_plan = physical_planner_->BuildPhysicalOperator(logical_plan);
-            physical_plans.push_back(std::move(physical_plan));
-        }
-        StopProfile(QueryPhase::kPhysicalPlan);
-//        LOG_WARN(fmt::format("Before pipeline cost: {}", profiler.ElapsedToString()));
-        StartProfile(QueryPhase::kPipelineBuild);
-        // Fragment Builder, only for test now.
-        {
-            Vector<PhysicalOperator *> physical_plan_ptrs;
-            for (auto &physical_plan : physical_plans) {
-                physical_plan_ptrs.push_back(physical_plan.get());
+        if (!result_cache_hit) {
+            // Reuse the bound and optimized plan of a statement with the same shape
+            if (plan_cache_key.has_value()) {
+                cached_plan = plan_cache->Take(*plan_cache_key, txn->BeginTS(), schema_version);
+                if (cached_plan.get() != nullptr and !PlanCache::BindParameters(*cached_plan, plan_parameters, txn)) {
+                    cached_plan.reset();
+                }
+            }
+
+            if (cached_plan.get() != nullptr) {
+                current_max_node_id_ = cached_plan->max_node_id_;
+                logical_plans = cached_plan->logical_plans_;
+            } else {
+                // Build unoptimized logical plan for each SQL statement.
+                StartProfile(QueryPhase::kLogicalPlan);
+                SharedPtr<BindContext> bind_context;
+                auto status = logical_planner_->Build(statement, bind_context);
+                // FIXME
+                if (!status.ok()) {
+                    LOG_ERROR(status.message());
+                    RecoverableError(status);
+                }
+
+                current_max_node_id_ = bind_context->GetNewLogicalNodeId();
+                logical_plans = logical_planner_->LogicalPlans();
+                StopProfile(QueryPhase::kLogicalPlan);
+//                LOG_WARN(fmt::format("Before optimizer cost: {}", profiler.ElapsedToString()));
+                // Apply optimized rule to the logical plan
+                StartProfile(QueryPhase::kOptimizer);
+                for (auto &logical_plan : logical_plans) {
+                    optimizer_->optimize(logical_plan, statement->type_);
+                }
+                StopProfile(QueryPhase::kOptimizer);
+
+                // a transaction older than the last schema change may have bound stale catalog entries
+                if (plan_cache_key.has_value() and txn->BeginTS() > schema_version) {
+                    cached_plan = PlanCache::MakeCachedPlan(logical_plans, bind_context, current_max_node_id_, plan_parameters, schema_version);
+                }
             }
-            plan_fragment = fragment_builder_->BuildFragment(physical_plan_ptrs);
+
+            // Build physical plan
+            StartProfile(QueryPhase::kPhysicalPlan);
+            for (auto &logical_plan : logical_plans) {
+                auto physical_plan = physical_planner_->BuildPhysicalOperator(logical_plan);
+                physical_plans.push_back(std::move(physical_plan));
+            }
+            StopProfile(QueryPhase::kPhysicalPlan);
+//            LOG_WARN(fmt::format("Before pipeline cost: {}", profiler.ElapsedToString()));
+            StartProfile(QueryPhase::kPipelineBuild);
+            // Fragment Builder, only for test now.
+            {
+                Vector<PhysicalOperator *> physical_plan_ptrs;
+                for (auto &physical_plan : physical_plans) {
+                    physical_plan_ptrs.push_back(physical_plan.get());
+                }
+                plan_fragment = fragment_builder_->BuildFragment(physical_plan_ptrs);
+            }
+            StopProfile(QueryPhase::kPipelineBuild);
+
+            StartProfile(QueryPhase::kTaskBuild);
+            notifier = MakeUnique<Notifier>();
+            FragmentContext::BuildTask(this, nullptr, plan_fragment.get(), notifier.get());
+            StopProfile(QueryPhase::kTaskBuild);
+//            LOG_WARN(fmt::format("Before execution cost: {}", profiler.ElapsedToString()));
+            StartProfile(QueryPhase::kExecution);
+            scheduler_->Schedule(plan_fragment.get(), statement);
+            query_result.result_table_ = plan_fragment->GetResult();
+            query_result.root_operator_type_ = logical_plans.back()->operator_type();
+            StopProfile(QueryPhase::kExecution);
         }
-        StopProfile(QueryPhase::kPipelineBuild);
-
-        StartProfile(QueryPhase::kTaskBuild);
-        notifier = MakeUnique<Notifier>();
-        FragmentContext::BuildTask(this, nullptr, plan_fragment.get(), notifier.get());
-        StopProfile(QueryPhase::kTaskBuild);
-//        LOG_WARN(fmt::format("Before execution cost: {}", profiler.ElapsedToString()));
-        StartProfile(QueryPhase::kExecution);
-        scheduler_->Schedule(plan_fragment.get(), statement);
-        query_result.result_table_ = plan_fragment->GetResult();
-        query_result.root_operator_type_ = logical_plans.back()->operator_type();
-        StopProfile(QueryPhase::kExecution);
 //        LOG_WARN(fmt::format("Before commit cost: {}", profiler.ElapsedToString()));
         StartProfile(QueryPhase::kCommit);
         this->CommitTxn();
         StopProfile(QueryPhase::kCommit);
 
+        if (cached_plan.get() != nullptr) {
+            // the physical plan shares the expressions of the cached plan, release it before the plan can be taken again
+            notifier.reset();
+            plan_fragment.reset();
+            physical_plans.clear();
+            plan_cache->Put(*plan_cache_key, std::move(cached_plan));
+        }
+
+        if (table_snapshot.has_value() and !result_cache_hit and query_result.result_table_.get() != nullptr) {
+            result_cache->Put(result_cache_key, *table_snapshot, query_result.result_table_, query_result.root_operator_type_);
+        }
+
     } catch (RecoverableException &e) {
 
         StopProfile();
@@ -229,6 +314,7 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
     }
 
 //    ProfilerStop();
+    RecordQueryProfiler(statement);
     session_ptr_->IncreaseQueryCount();
     session_manager_->IncreaseQueryCount();
 
@@ -254,6 +340,57 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
     return query_result;
 }
 
+QueryResult QueryContext::DescribeStatement(const BaseStatement *statement) {
+    QueryResult query_result;
+    if (statement->type_ != StatementType::kSelect and statement->type_ != StatementType::kShow and statement->type_ != StatementType::kExplain) {
+        // The other statements only return the status
+        query_result.result_table_ = DataTable::MakeResultTable({});
+        return query_result;
+    }
+    try {
+        this->BeginTxn();
+
+        SharedPtr<BindContext> bind_context;
+        auto status = logical_planner_->Build(statement, bind_context);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        Vector<SharedPtr<LogicalNode>> logical_plans = logical_planner_->LogicalPlans();
+        for (auto &logical_plan : logical_plans) {
+            optimizer_->optimize(logical_plan, statement->type_);
+        }
+        // The output of some operators, such as SHOW, is only known to the physical operator
+        UniquePtr<PhysicalOperator> physical_plan = physical_planner_->BuildPhysicalOperator(logical_plans.back());
+        SharedPtr<Vector<String>> column_names = physical_plan->GetOutputNames();
+        SharedPtr<Vector<SharedPtr<DataType>>> column_types = physical_plan->GetOutputTypes();
+
+        Vector<SharedPtr<ColumnDef>> column_defs;
+        column_defs.reserve(column_names->size());
+        for (SizeT col_idx = 0; col_idx < column_names->size(); ++col_idx) {
+            column_defs.emplace_back(MakeShared<ColumnDef>(col_idx, column_types->at(col_idx), column_names->at(col_idx), std::set<ConstraintType>()));
+        }
+        query_result.result_table_ = DataTable::MakeResultTable(column_defs);
+        query_result.root_operator_type_ = logical_plans.back()->operator_type();
+
+        // Nothing has been written, the transaction only served the catalog lookups
+        Txn *txn = session_ptr_->GetTxn();
+        storage_->txn_manager()->RollBackTxn(txn);
+        session_ptr_->SetTxn(nullptr);
+    } catch (RecoverableException &e) {
+        Txn *txn = session_ptr_->GetTxn();
+        if (txn != nullptr) {
+            storage_->txn_manager()->RollBackTxn(txn);
+            session_ptr_->SetTxn(nullptr);
+        }
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(e.ErrorCode(), e.what());
+    } catch (ParserException &e) {
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(ErrorCode::kParserError, e.what());
+    }
+    return query_result;
+}
+
 bool QueryContext::ExecuteBGStatement(BaseStatement *statement, BGQueryState &state) {
     QueryResult query_result;
     try {
@@ -319,6 +456,52 @@ bool QueryContext::JoinBGStatement(BGQueryState &state, TxnTimeStamp &commit_ts,
     return true;
 }
 
+void QueryContext::CreateQueryProfiler() {
+    if (query_profiler_) {
+        return;
+    }
+    if (is_enable_profiling()) {
+        query_profiler_ = MakeShared<QueryProfiler>(true);
+    } else if (global_config_->SlowQueryThreshold() > 0) {
+        query_profiler_ = MakeShared<QueryProfiler>(true, ProfileReason::kSlow);
+    }
+}
+
+void QueryContext::SampleQueryProfiler(const BaseStatement *statement) {
+    if (!IsProfiledStatement(statement->type_)) {
+        return;
+    }
+    i64 sample_rate = global_config_->ProfileSampleRate();
+    if (sample_rate <= 0 || profile_sample_count.fetch_add(1, std::memory_order_relaxed) % sample_rate != 0) {
+        return;
+    }
+    if (!query_profiler_) {
+        query_profiler_ = MakeShared<QueryProfiler>(true, ProfileReason::kSampled);
+    } else if (query_profiler_->reason() == ProfileReason::kSlow) {
+        query_profiler_->SetSampled();
+    }
+}
+
+void QueryContext::RecordQueryProfiler(const BaseStatement *statement) {
+    // the next statement of the context starts a profiler of its own
+    SharedPtr<QueryProfiler> query_profiler = std::move(query_profiler_);
+    if (!query_profiler || !IsProfiledStatement(statement->type_)) {
+        return;
+    }
+    // a failed statement may leave its phase open
+    query_profiler->Stop();
+    if (query_profiler->reason() == ProfileReason::kSlow) {
+        i64 threshold_ms = global_config_->SlowQueryThreshold();
+        if (threshold_ms == 0 || query_profiler->TotalElapsed() < threshold_ms * 1000 * 1000) {
+            return;
+        }
+    }
+    if (query_profiler->query_text().empty()) {
+        query_profiler->set_query_text(statement->ToString());
+    }
+    storage_->catalog()->AppendProfileRecord(std::move(query_profiler));
+}
+
 void QueryContext::BeginTxn() {
     if (session_ptr_->GetTxn() == nullptr) {
         Txn* new_txn = storage_->txn_manager()->BeginTxn(nullptr);
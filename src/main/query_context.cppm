@@ -66,6 +66,9 @@ public:
 
     QueryResult QueryStatement(const BaseStatement *statement);
 
+    // Plan the statement without executing it. The result table has the columns of the rows returned by the statement, but no rows.
+    QueryResult DescribeStatement(const BaseStatement *statement);
+
     bool ExecuteBGStatement(BaseStatement *statement, BGQueryState &state);
 
     bool JoinBGStatement(BGQueryState &state, TxnTimeStamp &commit_ts, bool rollback = false);
@@ -78,6 +81,11 @@ public:
 
     [[nodiscard]] inline bool is_enable_profiling() const { return session_ptr_->GetProfile(); }
 
+    // Whether the tasks of this query time their operators, for a session or sampled profile
+    [[nodiscard]] inline bool is_profiling_tasks() const { return query_profiler_ && query_profiler_->profile_tasks(); }
+
+    [[nodiscard]] inline bool is_enable_result_cache() const { return session_ptr_->GetResultCache(); }
+
     [[nodiscard]] inline u64 memory_size_limit() const { return memory_size_limit_; }
 
     [[nodiscard]] inline u64 query_id() const { return query_id_; }
@@ -130,17 +138,14 @@ public:
     }
 
 private:
-    inline void CreateQueryProfiler() {
-        if (is_enable_profiling()) {
-            query_profiler_ = MakeShared<QueryProfiler>(true);
-        }
-    }
+    // Profiles the query if the session asks for it, or times its phases if slow queries are kept
+    void CreateQueryProfiler();
 
-    inline void RecordQueryProfiler(const StatementType &type) {
-        if (type != StatementType::kCommand && type != StatementType::kExplain && type != StatementType::kShow) {
-            GetTxn()->GetCatalog()->AppendProfileRecord(query_profiler_);
-        }
-    }
+    // Makes it a full profile for one of every profile_sample_rate statements
+    void SampleQueryProfiler(const BaseStatement *statement);
+
+    // Keeps the profile in the catalog history once the statement is done, a slow profile only if it reached the threshold
+    void RecordQueryProfiler(const BaseStatement *statement);
 
     inline void StartProfile(QueryPhase phase) {
         if(query_profiler_) {
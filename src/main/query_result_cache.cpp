@@ -0,0 +1,116 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module query_result_cache;
+
+import stl;
+import third_party;
+import data_table;
+import data_block;
+import column_vector;
+import vector_buffer;
+import bitmask;
+import logical_node_type;
+import table_entry;
+import txn;
+
+namespace infinity {
+
+namespace {
+
+SizeT ResultMemoryCost(DataTable *result) {
+    SizeT memory_cost = 0;
+    for (SizeT i = 0; i < result->DataBlockCount(); ++i) {
+        const auto &data_block = result->GetDataBlockById(i);
+        for (const auto &column_vector : data_block->column_vectors) {
+            // the fixed size part, and the heaps of the varchar, tensor and sparse payloads
+            memory_cost += column_vector->buffer_->MemorySize();
+            if (column_vector->nulls_ptr_.get() != nullptr and column_vector->nulls_ptr_->GetData() != nullptr) {
+                memory_cost += (column_vector->nulls_ptr_->count() + 63) / 64 * sizeof(u64);
+            }
+        }
+    }
+    return memory_cost;
+}
+
+} // namespace
+
+Optional<String> QueryResultCache::MakeTableSnapshot(TableEntry *table_entry, Txn *txn, TxnTimeStamp schema_version) {
+    const TxnTimeStamp begin_ts = txn->BeginTS();
+    if (begin_ts <= schema_version) {
+        return None;
+    }
+    // the commits on the table, and the memory index commits which make the committed rows searchable, bump the data version
+    auto [data_version, data_version_ts] = table_entry->data_version();
+    if (data_version_ts > begin_ts) {
+        // the transaction sees an older version of the table, which has no version number of its own
+        return None;
+    }
+    return fmt::format("{}#{}#{}", *table_entry->TableEntryDir(), schema_version, data_version);
+}
+
+bool QueryResultCache::Get(const String &query_key, const String &table_snapshot, SharedPtr<DataTable> &result, LogicalNodeType &root_operator_type) {
+    std::lock_guard lock(mutex_);
+    auto map_iter = entry_map_.find(query_key);
+    if (map_iter == entry_map_.end()) {
+        ++miss_count_;
+        return false;
+    }
+    auto list_iter = map_iter->second;
+    if (list_iter->table_snapshot_ != table_snapshot) {
+        // the table has changed since the result was cached
+        EraseNoLock(list_iter);
+        ++miss_count_;
+        return false;
+    }
+    lru_list_.splice(lru_list_.begin(), lru_list_, list_iter);
+    result = list_iter->result_;
+    root_operator_type = list_iter->root_operator_type_;
+    ++hit_count_;
+    return true;
+}
+
+void QueryResultCache::Put(const String &query_key, const String &table_snapshot, SharedPtr<DataTable> result, LogicalNodeType root_operator_type) {
+    const SizeT memory_cost = query_key.size() + table_snapshot.size() + ResultMemoryCost(result.get());
+    if (memory_cost > memory_limit_) {
+        return;
+    }
+    std::lock_guard lock(mutex_);
+    if (auto map_iter = entry_map_.find(query_key); map_iter != entry_map_.end()) {
+        EraseNoLock(map_iter->second);
+    }
+    while (!lru_list_.empty() && memory_usage_ + memory_cost > memory_limit_) {
+        EraseNoLock(--lru_list_.end());
+    }
+    lru_list_.push_front(CacheEntry{query_key, table_snapshot, memory_cost, std::move(result), root_operator_type});
+    entry_map_.emplace(query_key, lru_list_.begin());
+    memory_usage_ += memory_cost;
+}
+
+void QueryResultCache::Clear() {
+    std::lock_guard lock(mutex_);
+    entry_map_.clear();
+    lru_list_.clear();
+    memory_usage_ = 0;
+}
+
+void QueryResultCache::EraseNoLock(List<CacheEntry>::iterator iter) {
+    memory_usage_ -= iter->memory_cost_;
+    entry_map_.erase(iter->key_);
+    lru_list_.erase(iter);
+}
+
+} // namespace infinity
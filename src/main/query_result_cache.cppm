@@ -0,0 +1,78 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module query_result_cache;
+
+import stl;
+import data_table;
+import logical_node_type;
+import table_entry;
+import txn;
+
+namespace infinity {
+
+// Memory-bounded LRU cache of SEARCH results, used by sessions with `enable_result_cache` set.
+// An entry is keyed by the statement with its payloads (PlanCache::MakeResultKey), and remembers the
+// snapshot of the table it was computed on. A lookup with another snapshot drops the entry, so new segments,
+// appends, deletes, compaction and index changes invalidate the results of the table.
+export class QueryResultCache {
+public:
+    explicit QueryResultCache(SizeT memory_limit) : memory_limit_(memory_limit) {}
+
+    // the segments, their visible rows and the indexes of the table seen by the transaction
+    // return None if it can't be described by commit timestamps, e.g. the table has changed after the transaction began
+    static Optional<String> MakeTableSnapshot(TableEntry *table_entry, Txn *txn, TxnTimeStamp schema_version);
+
+    // return true and share the cached result if there is a valid entry
+    bool Get(const String &query_key, const String &table_snapshot, SharedPtr<DataTable> &result, LogicalNodeType &root_operator_type);
+
+    // the result should be materialized, it's shared by the queries hitting the entry
+    void Put(const String &query_key, const String &table_snapshot, SharedPtr<DataTable> result, LogicalNodeType root_operator_type);
+
+    void Clear();
+
+    SizeT memory_usage() const {
+        std::lock_guard lock(mutex_);
+        return memory_usage_;
+    }
+
+    SizeT hit_count() const { return hit_count_.load(); }
+
+    SizeT miss_count() const { return miss_count_.load(); }
+
+private:
+    struct CacheEntry {
+        String key_;
+        String table_snapshot_;
+        SizeT memory_cost_;
+        SharedPtr<DataTable> result_;
+        LogicalNodeType root_operator_type_;
+    };
+
+    void EraseNoLock(List<CacheEntry>::iterator iter);
+
+    const SizeT memory_limit_;
+    mutable std::mutex mutex_;
+    SizeT memory_usage_ = 0;
+    // most recently used entry at the front
+    List<CacheEntry> lru_list_;
+    HashMap<String, List<CacheEntry>::iterator> entry_map_;
+
+    Atomic<SizeT> hit_count_{0};
+    Atomic<SizeT> miss_count_{0};
+};
+
+} // namespace infinity
@@ -0,0 +1,233 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <exception>
+
+module resource_manager;
+
+import stl;
+import logger;
+import third_party;
+import infinity_exception;
+import infinity_context;
+
+namespace infinity {
+
+SharedThreadPool::SharedThreadPool(SizeT thread_count) { Resize(thread_count); }
+
+SharedThreadPool::~SharedThreadPool() { Stop(); }
+
+void SharedThreadPool::Submit(TaskClass task_class, std::function<void()> task) {
+    if (task_class == TaskClass::kInvalid) {
+        String error_message = "Submit a task of invalid class to the shared thread pool";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    {
+        std::unique_lock lock(mtx_);
+        queues_[static_cast<SizeT>(task_class)].push_back(std::move(task));
+    }
+    cv_.notify_one();
+}
+
+void SharedThreadPool::ParallelFor(TaskClass task_class, SizeT task_count, std::function<void(SizeT)> task) {
+    if (task_count == 0) {
+        return;
+    }
+    if (task_count == 1) {
+        task(0);
+        return;
+    }
+    // shared with the pool threads, a helper which starts after the return finds no task left and never calls task_
+    struct ParallelForState {
+        std::function<void(SizeT)> task_;
+        SizeT task_count_{};
+        atomic_u64 next_task_{0};
+        std::mutex mtx_;
+        std::condition_variable cv_;
+        SizeT done_count_{0};
+        std::exception_ptr exception_{};
+    };
+    auto state = MakeShared<ParallelForState>();
+    state->task_ = std::move(task);
+    state->task_count_ = task_count;
+    auto run = [state] {
+        while (true) {
+            SizeT task_idx = state->next_task_.fetch_add(1);
+            if (task_idx >= state->task_count_) {
+                return;
+            }
+            std::exception_ptr exception{};
+            try {
+                state->task_(task_idx);
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            std::unique_lock lock(state->mtx_);
+            if (exception && !state->exception_) {
+                state->exception_ = exception;
+            }
+            if (++state->done_count_ == state->task_count_) {
+                state->cv_.notify_all();
+            }
+        }
+    };
+    // no helper on a stopped pool
+    SizeT helper_count = std::min(task_count, std::max(thread_count(), SizeT(1))) - 1;
+    for (SizeT i = 0; i < helper_count; ++i) {
+        Submit(task_class, run);
+    }
+    run();
+    std::unique_lock lock(state->mtx_);
+    state->cv_.wait(lock, [&] { return state->done_count_ == state->task_count_; });
+    if (state->exception_) {
+        std::rethrow_exception(state->exception_);
+    }
+}
+
+void SharedThreadPool::Resize(SizeT thread_count) {
+    // every class leaves a thread for the others, see Limit
+    thread_count = std::max(thread_count, SizeT(2));
+    std::unique_lock lock(mtx_);
+    if (stop_) {
+        return;
+    }
+    thread_count_ = thread_count;
+    for (SizeT worker_id = 0; worker_id < thread_count; ++worker_id) {
+        if (worker_id == threads_.size()) {
+            threads_.emplace_back();
+            thread_alive_.push_back(false);
+        }
+        if (!thread_alive_[worker_id]) {
+            // the thread of a shrink has marked itself dead under the lock, so it's returning
+            if (threads_[worker_id].joinable()) {
+                threads_[worker_id].join();
+            }
+            thread_alive_[worker_id] = true;
+            threads_[worker_id] = Thread([this, worker_id] { WorkerLoop(worker_id); });
+        }
+    }
+    lock.unlock();
+    // wake up the threads beyond the size to exit
+    cv_.notify_all();
+}
+
+void SharedThreadPool::SetQuota(TaskClass task_class, SizeT percent) {
+    if (task_class == TaskClass::kInvalid || percent == 0 || percent > 100) {
+        String error_message = fmt::format("Invalid quota {}% of task class {}", percent, static_cast<u8>(task_class));
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    {
+        std::unique_lock lock(mtx_);
+        quota_percent_[static_cast<SizeT>(task_class)] = percent;
+    }
+    cv_.notify_all();
+}
+
+void SharedThreadPool::Stop() {
+    {
+        std::unique_lock lock(mtx_);
+        if (stop_) {
+            return;
+        }
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto &thread : threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    std::unique_lock lock(mtx_);
+    threads_.clear();
+    thread_alive_.clear();
+    thread_count_ = 0;
+    for (auto &queue : queues_) {
+        queue.clear();
+    }
+    stop_ = false;
+}
+
+SizeT SharedThreadPool::thread_count() const {
+    std::unique_lock lock(mtx_);
+    return thread_count_;
+}
+
+SizeT SharedThreadPool::QueueSize(TaskClass task_class) const {
+    std::unique_lock lock(mtx_);
+    return queues_[static_cast<SizeT>(task_class)].size();
+}
+
+SizeT SharedThreadPool::RunningCount(TaskClass task_class) const {
+    std::unique_lock lock(mtx_);
+    return running_[static_cast<SizeT>(task_class)];
+}
+
+void SharedThreadPool::WorkerLoop(SizeT worker_id) {
+    std::unique_lock lock(mtx_);
+    while (true) {
+        TaskClass task_class = TaskClass::kInvalid;
+        cv_.wait(lock, [&] {
+            if (stop_ || worker_id >= thread_count_) {
+                return true;
+            }
+            task_class = PickClass();
+            return task_class != TaskClass::kInvalid;
+        });
+        if (stop_ || worker_id >= thread_count_) {
+            thread_alive_[worker_id] = false;
+            return;
+        }
+        SizeT class_idx = static_cast<SizeT>(task_class);
+        std::function<void()> task = std::move(queues_[class_idx].front());
+        queues_[class_idx].pop_front();
+        ++running_[class_idx];
+        lock.unlock();
+
+        try {
+            task();
+        } catch (const std::exception &e) {
+            LOG_ERROR(fmt::format("Task of class {} in the shared thread pool failed: {}", class_idx, e.what()));
+        }
+
+        lock.lock();
+        --running_[class_idx];
+        // a task of the class may be waiting for the quota
+        cv_.notify_one();
+    }
+}
+
+TaskClass SharedThreadPool::PickClass() const {
+    for (SizeT class_idx = 0; class_idx < TASK_CLASS_COUNT; ++class_idx) {
+        if (!queues_[class_idx].empty() && running_[class_idx] < Limit(class_idx)) {
+            return static_cast<TaskClass>(class_idx);
+        }
+    }
+    return TaskClass::kInvalid;
+}
+
+SizeT SharedThreadPool::Limit(SizeT class_idx) const {
+    SizeT limit = std::min(thread_count_ * quota_percent_[class_idx] / 100, thread_count_ - 1);
+    return std::max(limit, SizeT(1));
+}
+
+void SharedParallelFor(TaskClass task_class, SizeT task_count, std::function<void(SizeT)> task) {
+    InfinityContext::instance().GetSharedThreadPool().ParallelFor(task_class, task_count, std::move(task));
+}
+
+} // namespace infinity
@@ -21,6 +21,71 @@ import stl;
 
 namespace infinity {
 
+// The classes of the work run by the shared thread pool, in the order of priority.
+export enum class TaskClass : u8 {
+    kQuery = 0,
+    kIngest,     // full-text inverting, index building
+    kBackground, // committing and merging of the memory indexes
+    kInvalid,
+};
+
+export constexpr SizeT TASK_CLASS_COUNT = static_cast<SizeT>(TaskClass::kInvalid);
+
+// One pool of threads shared by the query, ingest and background work of the process, instead of a fixed pool for each
+// of them. An idle thread takes the task of the highest class which hasn't used up its quota, which is the most threads
+// running the tasks of the class at once, in percent of the pool size. The quota of every class, the query class as well,
+// is kept below the pool size, so that the tasks of one class which wait for another class can't hold all the threads.
+// The pool can be resized at any time, a thread beyond the new size exits after its current task.
+export class SharedThreadPool {
+public:
+    explicit SharedThreadPool(SizeT thread_count);
+
+    ~SharedThreadPool();
+
+    void Submit(TaskClass task_class, std::function<void()> task);
+
+    // Run task(0) to task(task_count - 1) as tasks of the class and return when all are done. The calling thread runs them
+    // as well, so it never waits for a task still in the queue, and a call from a pool thread can't hold up the pool.
+    // The first exception thrown by a task is rethrown to the caller after the others finish.
+    void ParallelFor(TaskClass task_class, SizeT task_count, std::function<void(SizeT)> task);
+
+    void Resize(SizeT thread_count);
+
+    void SetQuota(TaskClass task_class, SizeT percent);
+
+    // join all threads, the queued tasks are dropped. Resize starts the pool again.
+    void Stop();
+
+    SizeT thread_count() const;
+
+    SizeT QueueSize(TaskClass task_class) const;
+
+    SizeT RunningCount(TaskClass task_class) const;
+
+private:
+    void WorkerLoop(SizeT worker_id);
+
+    // the class of the task to run next, kInvalid if none can run now; called when lock held
+    TaskClass PickClass() const;
+
+    // called when lock held
+    SizeT Limit(SizeT class_idx) const;
+
+    mutable std::mutex mtx_;
+    std::condition_variable cv_;
+    Array<Deque<std::function<void()>>, TASK_CLASS_COUNT> queues_;
+    Array<SizeT, TASK_CLASS_COUNT> running_{};
+    Array<SizeT, TASK_CLASS_COUNT> quota_percent_{100, 100, 100};
+
+    SizeT thread_count_{0};
+    Vector<Thread> threads_;
+    Vector<bool> thread_alive_;
+    bool stop_{false};
+};
+
+// ParallelFor on the shared thread pool of the process, for the modules which infinity_context depends on.
+export void SharedParallelFor(TaskClass task_class, SizeT task_count, std::function<void(SizeT)> task);
+
 export class ResourceManager : public Singleton<ResourceManager> {
 public:
     explicit ResourceManager(u64 total_cpu_count, u64 total_memory)
@@ -44,7 +44,7 @@ public:
     [[nodiscard]] inline Txn *GetTxn() const { return txn_; }
     inline void SetTxn(Txn *txn) { txn_ = txn; }
 
-    const QueryProfiler *GetProfileRecord(SizeT index) { return txn_->GetCatalog()->GetProfileRecord(index); }
+    SharedPtr<QueryProfiler> GetProfileRecord(u64 profile_id) { return txn_->GetCatalog()->GetProfileRecord(profile_id); }
 
     void IncreaseQueryCount() { ++query_count_; }
 
@@ -64,6 +64,10 @@ public:
 
     bool GetProfile() const { return enable_profile_; }
 
+    void SetResultCache(bool flag) { enable_result_cache_ = flag; }
+
+    bool GetResultCache() const { return enable_result_cache_; }
+
 protected:
     std::time_t connected_time_;
 
@@ -83,6 +87,9 @@ protected:
     u64 rollbacked_txn_count_{0};
 
     bool enable_profile_{false};
+
+    // reuse the results of repeated SEARCH statements
+    bool enable_result_cache_{false};
 };
 
 export class LocalSession : public BaseSession {
@@ -48,6 +48,7 @@ void VarUtil::InitVariablesMap() {
     session_name_map_[TOTAL_ROLLBACK_COUNT_VAR_NAME.data()] = SessionVariable::kTotalRollbackCount;
     session_name_map_[CONNECTED_TS_VAR_NAME.data()] = SessionVariable::kConnectedTime;
     session_name_map_["enable_profile"] = SessionVariable::kEnableProfile;
+    session_name_map_[ENABLE_RESULT_CACHE_VAR_NAME.data()] = SessionVariable::kEnableResultCache;
 }
 
 HashMap<String, GlobalVariable> VarUtil::global_name_map_;
@@ -52,6 +52,7 @@ export enum class SessionVariable {
     kTotalRollbackCount,        // session
     kConnectedTime,             // session
     kEnableProfile,             // session
+    kEnableResultCache,         // session
 
     kInvalid,
 };
@@ -0,0 +1,190 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <sstream>
+
+module metrics;
+
+import stl;
+import third_party;
+import logger;
+import infinity_exception;
+
+namespace infinity {
+
+namespace {
+
+const char *MetricTypeToString(MetricType type) {
+    switch (type) {
+        case MetricType::kCounter:
+            return "counter";
+        case MetricType::kGauge:
+            return "gauge";
+        case MetricType::kHistogram:
+            return "histogram";
+    }
+    return "untyped";
+}
+
+String EscapeHelp(const String &help) {
+    String res;
+    for (char c : help) {
+        if (c == '\\') {
+            res += "\\\\";
+        } else if (c == '\n') {
+            res += "\\n";
+        } else {
+            res += c;
+        }
+    }
+    return res;
+}
+
+// name{labels} or name{labels,extra_label}, without braces when both are empty
+String SeriesName(const String &name, const String &labels, const String &extra_label = "") {
+    if (labels.empty() && extra_label.empty()) {
+        return name;
+    }
+    if (labels.empty() || extra_label.empty()) {
+        return fmt::format("{}{{{}{}}}", name, labels, extra_label);
+    }
+    return fmt::format("{}{{{},{}}}", name, labels, extra_label);
+}
+
+} // namespace
+
+MetricHistogram::MetricHistogram(Vector<f64> bounds) : bounds_(std::move(bounds)), buckets_(MakeUnique<Atomic<u64>[]>(bounds_.size() + 1)) {
+    if (!std::is_sorted(bounds_.begin(), bounds_.end())) {
+        String error_message = "Histogram bounds must be sorted";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+}
+
+void MetricHistogram::Observe(f64 value) {
+    SizeT idx = std::lower_bound(bounds_.begin(), bounds_.end(), value) - bounds_.begin();
+    buckets_[idx].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+Vector<u64> MetricHistogram::BucketCounts() const {
+    Vector<u64> res(bounds_.size() + 1);
+    for (SizeT i = 0; i < res.size(); ++i) {
+        res[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    return res;
+}
+
+MetricsRegistry &MetricsRegistry::instance() {
+    static MetricsRegistry instance;
+    return instance;
+}
+
+Vector<f64> MetricsRegistry::DefaultLatencyBounds() {
+    return {0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1, 5, 10};
+}
+
+String MetricsRegistry::Label(const String &key, const String &value) {
+    String res = key + "=\"";
+    for (char c : value) {
+        if (c == '\\' || c == '"') {
+            res += '\\';
+            res += c;
+        } else if (c == '\n') {
+            res += "\\n";
+        } else {
+            res += c;
+        }
+    }
+    res += '"';
+    return res;
+}
+
+MetricsRegistry::MetricFamily &MetricsRegistry::GetFamily(const String &name, const String &help, MetricType type) {
+    auto [iter, inserted] = families_.try_emplace(name);
+    MetricFamily &family = iter->second;
+    if (inserted) {
+        family.help_ = help;
+        family.type_ = type;
+    } else if (family.type_ != type) {
+        String error_message = fmt::format("Metric {} is registered as {}, not {}", name, MetricTypeToString(family.type_), MetricTypeToString(type));
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    return family;
+}
+
+MetricCounter *MetricsRegistry::Counter(const String &name, const String &help, const String &labels) {
+    std::unique_lock lock(mutex_);
+    auto &metric = GetFamily(name, help, MetricType::kCounter).counters_[labels];
+    if (metric.get() == nullptr) {
+        metric = MakeUnique<MetricCounter>();
+    }
+    return metric.get();
+}
+
+MetricGauge *MetricsRegistry::Gauge(const String &name, const String &help, const String &labels) {
+    std::unique_lock lock(mutex_);
+    auto &metric = GetFamily(name, help, MetricType::kGauge).gauges_[labels];
+    if (metric.get() == nullptr) {
+        metric = MakeUnique<MetricGauge>();
+    }
+    return metric.get();
+}
+
+MetricHistogram *MetricsRegistry::Histogram(const String &name, const String &help, const String &labels, Vector<f64> bounds) {
+    std::unique_lock lock(mutex_);
+    auto &metric = GetFamily(name, help, MetricType::kHistogram).histograms_[labels];
+    if (metric.get() == nullptr) {
+        metric = MakeUnique<MetricHistogram>(std::move(bounds));
+    }
+    return metric.get();
+}
+
+String MetricsRegistry::ToPrometheusText() const {
+    std::stringstream ss;
+    std::unique_lock lock(mutex_);
+    for (const auto &[name, family] : families_) {
+        ss << "# HELP " << name << ' ' << EscapeHelp(family.help_) << '\n';
+        ss << "# TYPE " << name << ' ' << MetricTypeToString(family.type_) << '\n';
+        for (const auto &[labels, counter] : family.counters_) {
+            ss << SeriesName(name, labels) << ' ' << counter->value() << '\n';
+        }
+        for (const auto &[labels, gauge] : family.gauges_) {
+            ss << SeriesName(name, labels) << ' ' << gauge->value() << '\n';
+        }
+        for (const auto &[labels, histogram] : family.histograms_) {
+            // the buckets are read one by one under writes, the count is taken from them so that it equals the +Inf bucket
+            f64 sum = histogram->sum();
+            Vector<u64> buckets = histogram->BucketCounts();
+            const auto &bounds = histogram->bounds();
+            u64 cumulative = 0;
+            for (SizeT i = 0; i < bounds.size(); ++i) {
+                cumulative += buckets[i];
+                ss << SeriesName(name + "_bucket", labels, fmt::format("le=\"{}\"", bounds[i])) << ' ' << cumulative << '\n';
+            }
+            cumulative += buckets.back();
+            ss << SeriesName(name + "_bucket", labels, "le=\"+Inf\"") << ' ' << cumulative << '\n';
+            ss << SeriesName(name + "_sum", labels) << ' ' << fmt::format("{}", sum) << '\n';
+            ss << SeriesName(name + "_count", labels) << ' ' << cumulative << '\n';
+        }
+    }
+    return ss.str();
+}
+
+} // namespace infinity
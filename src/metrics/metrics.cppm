@@ -0,0 +1,128 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module metrics;
+
+import stl;
+
+namespace infinity {
+
+export class MetricCounter {
+public:
+    inline void Add(u64 value = 1) { value_.fetch_add(value, std::memory_order_relaxed); }
+
+    inline u64 value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    Atomic<u64> value_{0};
+};
+
+export class MetricGauge {
+public:
+    inline void Set(i64 value) { value_.store(value, std::memory_order_relaxed); }
+
+    inline void Add(i64 value) { value_.fetch_add(value, std::memory_order_relaxed); }
+
+    inline i64 value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    Atomic<i64> value_{0};
+};
+
+// Fixed upper bounds, every observation is counted in the first bucket whose bound is at or above it, and the buckets
+// are made cumulative only when exported.
+export class MetricHistogram {
+public:
+    explicit MetricHistogram(Vector<f64> bounds);
+
+    void Observe(f64 value);
+
+    const Vector<f64> &bounds() const { return bounds_; }
+
+    // bounds().size() + 1 counts, the last one is above all bounds
+    Vector<u64> BucketCounts() const;
+
+    u64 count() const { return count_.load(std::memory_order_relaxed); }
+
+    f64 sum() const { return sum_.load(std::memory_order_relaxed); }
+
+private:
+    const Vector<f64> bounds_;
+    UniquePtr<Atomic<u64>[]> buckets_;
+    Atomic<u64> count_{0};
+    Atomic<f64> sum_{0};
+};
+
+// Observes the seconds from the construction to the destruction into the histogram, nothing when it is nullptr.
+export class MetricTimer {
+public:
+    explicit MetricTimer(MetricHistogram *histogram) : histogram_(histogram), begin_(std::chrono::steady_clock::now()) {}
+
+    ~MetricTimer() {
+        if (histogram_ != nullptr) {
+            histogram_->Observe(std::chrono::duration<f64>(std::chrono::steady_clock::now() - begin_).count());
+        }
+    }
+
+private:
+    MetricHistogram *histogram_;
+    std::chrono::time_point<std::chrono::steady_clock> begin_;
+};
+
+export enum class MetricType : u8 {
+    kCounter,
+    kGauge,
+    kHistogram,
+};
+
+// The process wide metrics. A metric is looked up by name and labels under a lock once, the caller keeps the returned
+// pointer, which lives as long as the process, and updates it without any lock.
+export class MetricsRegistry {
+public:
+    static MetricsRegistry &instance();
+
+    // 10us to 10s
+    static Vector<f64> DefaultLatencyBounds();
+
+    // key="value", with the value escaped
+    static String Label(const String &key, const String &value);
+
+    // labels are the comma separated output of Label(), empty for none
+    MetricCounter *Counter(const String &name, const String &help, const String &labels = "");
+
+    MetricGauge *Gauge(const String &name, const String &help, const String &labels = "");
+
+    MetricHistogram *Histogram(const String &name, const String &help, const String &labels = "", Vector<f64> bounds = DefaultLatencyBounds());
+
+    // Prometheus text exposition format 0.0.4
+    String ToPrometheusText() const;
+
+private:
+    struct MetricFamily {
+        String help_{};
+        MetricType type_{MetricType::kCounter};
+        Map<String, UniquePtr<MetricCounter>> counters_{};
+        Map<String, UniquePtr<MetricGauge>> gauges_{};
+        Map<String, UniquePtr<MetricHistogram>> histograms_{};
+    };
+
+    MetricFamily &GetFamily(const String &name, const String &help, MetricType type);
+
+    mutable std::mutex mutex_{};
+    Map<String, MetricFamily> families_{};
+};
+
+} // namespace infinity
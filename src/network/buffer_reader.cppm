@@ -14,25 +14,22 @@
 
 module;
 
-import boost;
 import pg_message;
-import ring_buffer_iterator;
-import default_values;
 import stl;
 
 export module buffer_reader;
 
 namespace infinity {
 
+// Decodes one message that has been completely received by the connection.
 export class BufferReader {
 public:
-    explicit BufferReader(const SharedPtr<boost::asio::ip::tcp::socket> &socket) : socket_(socket){};
+    BufferReader() = default;
 
-    [[nodiscard]] SizeT size() const;
+    // start to decode a new message
+    void Reset(Vector<char> data);
 
-    [[nodiscard]] static inline SizeT max_capacity() { return PG_MSG_BUFFER_SIZE - 1; }
-
-    [[nodiscard]] inline bool full() const { return size() == max_capacity(); }
+    [[nodiscard]] SizeT size() const { return data_.size() - pos_; }
 
     i8 read_value_i8();
 
@@ -51,13 +48,10 @@ public:
     String read_string();
 
 private:
-    void receive_more(SizeT more_bytes = 1);
-
-    Array<char, PG_MSG_BUFFER_SIZE> data_{};
-    RingBufferIterator start_pos_{data_};
-    RingBufferIterator current_pos_{data_};
+    void check_available(SizeT bytes) const;
 
-    SharedPtr<boost::asio::ip::tcp::socket> socket_;
+    Vector<char> data_{};
+    SizeT pos_{0};
 };
 
 } // namespace infinity
@@ -14,25 +14,19 @@
 
 module;
 
-import boost;
 import pg_message;
-import ring_buffer_iterator;
-import default_values;
 import stl;
 
 export module buffer_writer;
 
 namespace infinity {
 
+// Encodes outgoing messages into memory, the connection writes them to the socket asynchronously.
 export class BufferWriter {
 public:
-    explicit BufferWriter(const SharedPtr<boost::asio::ip::tcp::socket> &socket) : socket_(socket) {}
+    BufferWriter() = default;
 
-    [[nodiscard]] SizeT size() const;
-
-    inline static SizeT max_capacity() { return PG_MSG_BUFFER_SIZE - 1; }
-
-    inline bool full() const { return size() == max_capacity(); }
+    [[nodiscard]] SizeT size() const { return data_.size(); }
 
     void send_value_i8(i8 host_value);
 
@@ -48,16 +42,13 @@ public:
 
     void send_string(const String &value, NullTerminator null_terminator = NullTerminator::kYes);
 
-    // 0 means flush whole buffer.
-    void flush(SizeT bytes = 0);
+    // take all pending bytes
+    Vector<char> take();
 
 private:
-    void try_flush(SizeT bytes);
+    void append(const void *data, SizeT bytes);
 
-    Array<char, PG_MSG_BUFFER_SIZE> data_{};
-    RingBufferIterator start_pos_{data_};
-    RingBufferIterator current_pos_{data_};
-    SharedPtr<boost::asio::ip::tcp::socket> socket_{};
+    Vector<char> data_{};
 };
 
 } // namespace infinity
@@ -15,6 +15,9 @@
 module;
 
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
 
 module connection;
 
@@ -39,120 +42,304 @@ import logical_type;
 import embedding_info;
 import sparse_info;
 import data_type;
+import status;
+import pg_parameter;
+import constant_expr;
+import sql_parser;
+import parser_result;
+import pg_worker_pool;
 
 namespace infinity {
 
-Connection::Connection(boost::asio::io_service &io_service)
-    : socket_(MakeShared<boost::asio::ip::tcp::socket>(io_service)), pg_handler_(MakeShared<PGProtocolHandler>(socket())) {}
+Connection::Connection(boost::asio::io_service &io_service, atomic_u64 &running_connection_count, PGWorkerPool &worker_pool)
+    : socket_(MakeShared<boost::asio::ip::tcp::socket>(io_service)), running_connection_count_(running_connection_count),
+      worker_pool_(worker_pool), pg_handler_(MakeShared<PGProtocolHandler>()) {}
 
 Connection::~Connection() {
     if (session_ == nullptr) {
         // To avoid null ptr access
         return;
     }
+    --running_connection_count_;
     SessionManager *session_mgr = InfinityContext::instance().session_manager();
     session_mgr->RemoveSessionByID(session_->session_id());
 }
 
-void Connection::Run() {
+void Connection::Start() {
+    boost::system::error_code error;
     // Disable Nagle's algorithm to reduce TCP latency, but will reduce the throughput.
-    socket_->set_option(boost::asio::ip::tcp::no_delay(true));
+    socket_->set_option(boost::asio::ip::tcp::no_delay(true), error);
+    const auto remote_endpoint = socket_->remote_endpoint(error);
+    if (error) {
+        LOG_TRACE(fmt::format("Connection is closed before start: {}", error.message()));
+        return;
+    }
 
     SessionManager *session_manager = InfinityContext::instance().session_manager();
     session_ = session_manager->CreateRemoteSession();
+    session_->SetClientInfo(remote_endpoint.address().to_string(), remote_endpoint.port());
+    ++running_connection_count_;
 
-    HandleConnection();
+    ReadStartupHeader();
+}
 
-    session_->SetClientInfo(socket_->remote_endpoint().address().to_string(), socket_->remote_endpoint().port());
+void Connection::ReadStartupHeader() {
+    read_buffer_.resize(STARTUP_HEADER_SIZE);
+    boost::asio::async_read(*socket_,
+                            boost::asio::buffer(read_buffer_),
+                            [self = shared_from_this()](const boost::system::error_code &error, SizeT) {
+                                if (error) {
+                                    self->Close();
+                                    return;
+                                }
+                                self->pg_handler_->set_message(std::move(self->read_buffer_));
+                                Optional<u32> body_length;
+                                try {
+                                    body_length = self->pg_handler_->read_startup_header();
+                                } catch (const std::exception &e) {
+                                    LOG_ERROR(e.what());
+                                    self->Close();
+                                    return;
+                                }
+                                if (!body_length.has_value()) {
+                                    // SSL request has been refused, the client sends the startup message again
+                                    self->WriteResponse(false);
+                                    self->ReadStartupHeader();
+                                    return;
+                                }
+                                self->ReadStartupBody(body_length.value());
+                            });
+}
 
-    while (!terminate_connection_) {
+void Connection::ReadStartupBody(u32 body_length) {
+    read_buffer_.resize(body_length);
+    boost::asio::async_read(*socket_, boost::asio::buffer(read_buffer_), [self = shared_from_this()](const boost::system::error_code &error, SizeT) {
+        if (error) {
+            self->Close();
+            return;
+        }
+        self->pg_handler_->set_message(std::move(self->read_buffer_));
+        self->pg_handler_->read_startup_body();
+        self->pg_handler_->send_authentication();
+        self->pg_handler_->send_parameter("server_version", "14");
+        self->pg_handler_->send_parameter("server_encoding", "UTF8");
+        self->pg_handler_->send_parameter("client_encoding", "UTF8");
+        self->pg_handler_->send_parameter("DateStyle", "IOS, DMY");
+        self->pg_handler_->send_ready_for_query();
+        self->WriteResponse(true);
+    });
+}
+
+void Connection::ReadCommandHeader() {
+    read_buffer_.resize(MESSAGE_HEADER_SIZE);
+    boost::asio::async_read(*socket_, boost::asio::buffer(read_buffer_), [self = shared_from_this()](const boost::system::error_code &error, SizeT) {
+        if (error) {
+            // Client is disconnected.
+            self->Close();
+            return;
+        }
+        self->pg_handler_->set_message(std::move(self->read_buffer_));
         try {
-            HandleRequest();
-        } catch (const infinity::RecoverableException &e) {
-            LOG_TRACE(fmt::format("Recoverable exception: {}", e.what()));
-            return ;
-        } catch (const infinity::UnrecoverableException& e) {
-            HashMap<PGMessageType, String> error_message_map;
-            error_message_map[PGMessageType::kHumanReadableError] = e.what();
-            LOG_ERROR(e.what());
-            pg_handler_->send_error_response(error_message_map);
-            pg_handler_->send_ready_for_query();
+            const auto [command_type, body_length] = self->pg_handler_->read_command_header();
+            self->ReadCommandBody(command_type, body_length);
         } catch (const std::exception &e) {
-            HashMap<PGMessageType, String> error_message_map;
-            error_message_map[PGMessageType::kHumanReadableError] = e.what();
             LOG_ERROR(e.what());
-            pg_handler_->send_error_response(error_message_map);
-            pg_handler_->send_ready_for_query();
+            self->Close();
         }
-    }
+    });
 }
 
-void Connection::HandleConnection() {
-    const auto body_length = pg_handler_->read_startup_header();
-
-    pg_handler_->read_startup_body(body_length);
-    pg_handler_->send_authentication();
-    pg_handler_->send_parameter("server_version", "14");
-    pg_handler_->send_parameter("server_encoding", "UTF8");
-    pg_handler_->send_parameter("client_encoding", "UTF8");
-    pg_handler_->send_parameter("DateStyle", "IOS, DMY");
-    pg_handler_->send_ready_for_query();
+void Connection::ReadCommandBody(PGMessageType command_type, u32 body_length) {
+    read_buffer_.resize(body_length);
+    boost::asio::async_read(*socket_,
+                            boost::asio::buffer(read_buffer_),
+                            [self = shared_from_this(), command_type](const boost::system::error_code &error, SizeT) {
+                                if (error) {
+                                    self->Close();
+                                    return;
+                                }
+                                self->pg_handler_->set_message(std::move(self->read_buffer_));
+                                self->DispatchCommand(command_type);
+                            });
 }
 
-void Connection::HandleRequest() {
-    const auto cmd_type = pg_handler_->read_command_type();
-
-    // FIXME
-    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
-    query_context_ptr->Init(InfinityContext::instance().config(),
-                            InfinityContext::instance().task_scheduler(),
-                            InfinityContext::instance().storage(),
-                            InfinityContext::instance().resource_manager(),
-                            InfinityContext::instance().session_manager());
-
-    switch (cmd_type) {
-        case PGMessageType::kBindCommand: {
-            LOG_TRACE("BindCommand");
+void Connection::DispatchCommand(PGMessageType command_type) {
+    switch (command_type) {
+        case PGMessageType::kSimpleQueryCommand:
+        case PGMessageType::kParseCommand:
+        case PGMessageType::kDescribeCommand:
+        case PGMessageType::kExecuteCommand: {
+            // These commands parse, plan or run a query, which waits for the fragments on the task scheduler.
+            worker_pool_.Submit([self = shared_from_this(), command_type]() {
+                self->HandleCommand(command_type);
+                self->FinishCommand(command_type);
+            });
             break;
         }
-        case PGMessageType::kDescribeCommand: {
-            LOG_TRACE("DescribeCommand");
-            break;
+        default: {
+            HandleCommand(command_type);
+            FinishCommand(command_type);
         }
-        case PGMessageType::kExecuteCommand: {
-            LOG_TRACE("ExecuteCommand");
-            break;
+    }
+}
+
+void Connection::HandleCommand(PGMessageType command_type) {
+    if (skip_until_sync_ && command_type != PGMessageType::kSyncCommand && command_type != PGMessageType::kTerminateCommand) {
+        return;
+    }
+    try {
+        switch (command_type) {
+            case PGMessageType::kBindCommand: {
+                LOG_TRACE("BindCommand");
+                HandleBind();
+                break;
+            }
+            case PGMessageType::kDescribeCommand: {
+                LOG_TRACE("DescribeCommand");
+                HandleDescribe();
+                break;
+            }
+            case PGMessageType::kExecuteCommand: {
+                LOG_TRACE("ExecuteCommand");
+                HandleExecute();
+                break;
+            }
+            case PGMessageType::kParseCommand: {
+                LOG_TRACE("ParseCommand");
+                HandleParse();
+                break;
+            }
+            case PGMessageType::kCloseCommand: {
+                LOG_TRACE("CloseCommand");
+                HandleClose();
+                break;
+            }
+            case PGMessageType::kSimpleQueryCommand: {
+                HandlerSimpleQuery();
+                break;
+            }
+            case PGMessageType::kSyncCommand: {
+                LOG_TRACE("SyncCommand");
+                skip_until_sync_ = false;
+                // The unnamed portal is closed at the end of the transaction.
+                portals_.erase(String());
+                pg_handler_->send_ready_for_query();
+                break;
+            }
+            case PGMessageType::kFlushCommand: {
+                LOG_TRACE("FlushCommand");
+                break;
+            }
+            case PGMessageType::kTerminateCommand: {
+                terminate_connection_ = true;
+                break;
+            }
+            default: {
+                String error_message = "Unknown PG command type";
+                LOG_CRITICAL(error_message);
+                UnrecoverableError(error_message);
+            }
         }
-        case PGMessageType::kParseCommand: {
-            LOG_TRACE("ParseCommand");
-            break;
+    } catch (const infinity::RecoverableException &e) {
+        LOG_TRACE(fmt::format("Recoverable exception: {}", e.what()));
+        SendErrorResponse(e.what());
+        if (e.ErrorCode() == ErrorCode::kIOError) {
+            // Malformed message, the following bytes can't be decoded anymore.
+            terminate_connection_ = true;
         }
+    } catch (const infinity::UnrecoverableException &e) {
+        LOG_ERROR(e.what());
+        SendErrorResponse(e.what());
+    } catch (const std::exception &e) {
+        LOG_ERROR(e.what());
+        SendErrorResponse(e.what());
+    }
+}
+
+void Connection::FinishCommand(PGMessageType command_type) {
+    if (terminate_connection_) {
+        WriteResponse(false);
+        return;
+    }
+    switch (command_type) {
         case PGMessageType::kSimpleQueryCommand: {
-            HandlerSimpleQuery(query_context_ptr.get());
+            if (skip_until_sync_) {
+                // Simple query isn't part of the extended query protocol, the error has been reported.
+                skip_until_sync_ = false;
+                pg_handler_->send_ready_for_query();
+            }
+            WriteResponse(true);
             break;
         }
-        case PGMessageType::kSyncCommand: {
-            LOG_TRACE("SyncCommand");
-            break;
-        }
-        case PGMessageType::kTerminateCommand: {
-            terminate_connection_ = true;
+        case PGMessageType::kSyncCommand:
+        case PGMessageType::kFlushCommand: {
+            WriteResponse(true);
             break;
         }
         default: {
-            String error_message = "Unknown PG command type";
-            LOG_CRITICAL(error_message);
-            UnrecoverableError(error_message);
+            // The responses of the extended query protocol are sent at the next Sync or Flush.
+            ReadCommandHeader();
+        }
+    }
+}
+
+void Connection::WriteResponse(bool read_next) {
+    if (!pg_handler_->has_output()) {
+        if (terminate_connection_) {
+            Close();
+        } else if (read_next) {
+            ReadCommandHeader();
         }
+        return;
     }
+    auto output = MakeShared<Vector<char>>(pg_handler_->take_output());
+    boost::asio::async_write(*socket_,
+                             boost::asio::buffer(*output),
+                             [self = shared_from_this(), output, read_next](const boost::system::error_code &error, SizeT) {
+                                 if (error) {
+                                     LOG_TRACE(fmt::format("Client close the connection: {}", error.message()));
+                                     self->Close();
+                                     return;
+                                 }
+                                 if (self->terminate_connection_) {
+                                     self->Close();
+                                 } else if (read_next) {
+                                     self->ReadCommandHeader();
+                                 }
+                             });
+}
+
+void Connection::Close() {
+    boost::system::error_code error;
+    socket_->shutdown(boost::asio::ip::tcp::socket::shutdown_both, error);
+    socket_->close(error);
 }
 
-void Connection::HandlerSimpleQuery(QueryContext *query_context) {
+UniquePtr<QueryContext> Connection::CreateQueryContext() {
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager());
+    return query_context_ptr;
+}
+
+void Connection::SendErrorResponse(const String &error_message) {
+    HashMap<PGMessageType, String> error_message_map;
+    error_message_map[PGMessageType::kHumanReadableError] = error_message;
+    pg_handler_->send_error_response(error_message_map);
+    // The ready for query message is sent at the next Sync, or by the simple query.
+    skip_until_sync_ = true;
+}
+
+void Connection::HandlerSimpleQuery() {
     const String &query = pg_handler_->read_command_body();
     LOG_TRACE(fmt::format("Query: {}", query));
 
     // Start to execute the query.
-    QueryResult result = query_context->Query(query);
+    UniquePtr<QueryContext> query_context_ptr = CreateQueryContext();
+    QueryResult result = query_context_ptr->Query(query);
 
     // Response to the result message to client
     if (result.result_table_.get() == nullptr) {
@@ -162,12 +349,210 @@ void Connection::HandlerSimpleQuery(QueryContext *query_context) {
     } else {
         // Have result
         SendTableDescription(result.result_table_);
-        SendQueryResponse(result);
+        SendQueryRows(result, 0, 0);
+        SendQueryComplete(result);
     }
 
     pg_handler_->send_ready_for_query();
 }
 
+void Connection::HandleParse() {
+    PGParseMessage parse_message = pg_handler_->read_parse_message();
+    LOG_TRACE(fmt::format("Parse statement: {}, query: {}", parse_message.statement_name_, parse_message.query_));
+    auto statement = MakeShared<PGPreparedStatement>();
+    statement->query_ = std::move(parse_message.query_);
+    statement->parameter_types_ = std::move(parse_message.parameter_types_);
+    // The query is parsed once here, Bind only writes the parameters into the parsed statement.
+    SizeT parameter_count = 0;
+    statement->template_ = PGStatementTemplate::Make(statement->query_, parameter_count);
+    if (statement->parameter_types_.size() > parameter_count) {
+        parameter_count = statement->parameter_types_.size();
+    }
+    statement->parameter_types_.resize(parameter_count, PGTypeOid::kUnspecified);
+    for (const u32 parameter_type : statement->parameter_types_) {
+        // Report the types which can't be bound now rather than at Bind
+        MakeParameterSample(parameter_type);
+    }
+    // The unnamed statement is replaced by the next Parse, a named one is replaced as well for simplicity.
+    prepared_statements_[parse_message.statement_name_] = std::move(statement);
+    pg_handler_->SendParseComplete();
+}
+
+void Connection::HandleBind() {
+    PGBindMessage bind_message = pg_handler_->read_bind_message();
+    auto statement_iter = prepared_statements_.find(bind_message.statement_name_);
+    if (statement_iter == prepared_statements_.end()) {
+        RecoverableError(Status::SyntaxError(fmt::format("Prepared statement \"{}\" doesn't exist", bind_message.statement_name_)));
+    }
+    for (const PGFormatCode result_format : bind_message.result_formats_) {
+        if (result_format != PGFormatCode::kText) {
+            RecoverableError(Status::NotSupport("Binary result format"));
+        }
+    }
+    const auto &formats = bind_message.parameter_formats_;
+    if (formats.size() > 1 && formats.size() != bind_message.parameters_.size()) {
+        RecoverableError(Status::SyntaxError("Parameter format count doesn't match parameter count"));
+    }
+    for (const PGFormatCode format : formats) {
+        if (format != PGFormatCode::kText) {
+            RecoverableError(Status::NotSupport("Binary parameter format"));
+        }
+    }
+
+    const PGPreparedStatement &statement = *statement_iter->second;
+    if (bind_message.parameters_.size() != statement.parameter_types_.size()) {
+        RecoverableError(Status::SyntaxError(
+            fmt::format("Bind has {} parameters, but the statement takes {}", bind_message.parameters_.size(), statement.parameter_types_.size())));
+    }
+    PGPortal portal;
+    portal.statement_ = statement_iter->second;
+    portal.parameters_.reserve(bind_message.parameters_.size());
+    for (SizeT i = 0; i < bind_message.parameters_.size(); ++i) {
+        portal.parameters_.push_back(MakeParameterValue(i + 1, bind_message.parameters_[i], statement.parameter_types_[i]));
+    }
+    if (statement.template_.get() == nullptr) {
+        ReplaceParameters(
+            statement.query_,
+            [&portal](SizeT parameter_id) { return ParameterLiteral(*portal.parameters_[parameter_id - 1]); },
+            portal.bound_query_);
+    }
+    portals_[bind_message.portal_name_] = std::move(portal);
+    pg_handler_->SendBindComplete();
+}
+
+void Connection::HandleDescribe() {
+    const auto [target_type, name] = pg_handler_->read_describe_message();
+    if (target_type == 'S') {
+        auto statement_iter = prepared_statements_.find(name);
+        if (statement_iter == prepared_statements_.end()) {
+            RecoverableError(Status::SyntaxError(fmt::format("Prepared statement \"{}\" doesn't exist", name)));
+        }
+        PGPreparedStatement &statement = *statement_iter->second;
+        // The parameters without a type are sent as text, which is how the server reads all of them.
+        Vector<u32> parameter_types = statement.parameter_types_;
+        Vector<UniquePtr<ConstantExpr>> samples;
+        for (u32 &parameter_type : parameter_types) {
+            samples.push_back(MakeParameterSample(parameter_type));
+            if (parameter_type == PGTypeOid::kUnspecified) {
+                parameter_type = PGTypeOid::kText;
+            }
+        }
+        pg_handler_->SendParameterDescription(parameter_types);
+        String sample_query;
+        if (statement.template_.get() == nullptr) {
+            ReplaceParameters(statement.query_, [&samples](SizeT parameter_id) { return ParameterLiteral(*samples[parameter_id - 1]); }, sample_query);
+        }
+        const QueryResult description = DescribeStatement(statement, samples, sample_query);
+        if (description.result_table_.get() == nullptr) {
+            // The result columns can't be planned from the sample values, they are known once the parameters are bound.
+            pg_handler_->SendNoData();
+            return;
+        }
+        SendRowDescription(description);
+        return;
+    }
+    auto portal_iter = portals_.find(name);
+    if (portal_iter == portals_.end()) {
+        RecoverableError(Status::SyntaxError(fmt::format("Portal \"{}\" doesn't exist", name)));
+    }
+    PGPortal &portal = portal_iter->second;
+    if (portal.result_.get() != nullptr) {
+        // Executed by a previous Execute
+        SendRowDescription(*portal.result_);
+        return;
+    }
+    const QueryResult description = DescribeStatement(*portal.statement_, portal.parameters_, portal.bound_query_);
+    if (description.result_table_.get() == nullptr) {
+        RecoverableError(description.status_.clone());
+    }
+    SendRowDescription(description);
+}
+
+void Connection::HandleExecute() {
+    const auto [portal_name, max_row_count] = pg_handler_->read_execute_message();
+    auto portal_iter = portals_.find(portal_name);
+    if (portal_iter == portals_.end()) {
+        RecoverableError(Status::SyntaxError(fmt::format("Portal \"{}\" doesn't exist", portal_name)));
+    }
+    PGPortal &portal = portal_iter->second;
+    if (portal.statement_->query_.empty()) {
+        pg_handler_->SendEmptyQueryResponse();
+        return;
+    }
+    ExecutePortal(portal);
+    const QueryResult &result = *portal.result_;
+    const SizeT row_limit = max_row_count > 0 ? max_row_count : 0;
+    portal.sent_row_count_ += SendQueryRows(result, portal.sent_row_count_, row_limit);
+    if (portal.sent_row_count_ < result.result_table_->row_count()) {
+        pg_handler_->SendPortalSuspended();
+    } else {
+        SendQueryComplete(result);
+    }
+}
+
+void Connection::HandleClose() {
+    const auto [target_type, name] = pg_handler_->read_close_message();
+    if (target_type == 'S') {
+        prepared_statements_.erase(name);
+    } else {
+        portals_.erase(name);
+    }
+    pg_handler_->SendCloseComplete();
+}
+
+void Connection::ExecutePortal(PGPortal &portal) {
+    if (portal.result_.get() != nullptr) {
+        // The rows left by a previous Execute
+        return;
+    }
+    UniquePtr<QueryContext> query_context_ptr = CreateQueryContext();
+    UniquePtr<QueryResult> result;
+    PGStatementTemplate *statement_template = portal.statement_->template_.get();
+    if (statement_template != nullptr) {
+        LOG_TRACE(fmt::format("Execute: {}", portal.statement_->query_));
+        statement_template->Bind(portal.parameters_);
+        result = MakeUnique<QueryResult>(query_context_ptr->QueryStatement(statement_template->statement()));
+    } else {
+        LOG_TRACE(fmt::format("Execute: {}", portal.bound_query_));
+        result = MakeUnique<QueryResult>(query_context_ptr->Query(portal.bound_query_));
+    }
+    if (result->result_table_.get() == nullptr) {
+        RecoverableError(result->status_.clone());
+    }
+    portal.result_ = std::move(result);
+}
+
+QueryResult Connection::DescribeStatement(PGPreparedStatement &statement, const Vector<UniquePtr<ConstantExpr>> &parameters, const String &bound_query) {
+    UniquePtr<QueryContext> query_context_ptr = CreateQueryContext();
+    if (statement.template_.get() != nullptr) {
+        statement.template_->Bind(parameters);
+        return query_context_ptr->DescribeStatement(statement.template_->statement());
+    }
+    if (statement.query_.empty()) {
+        QueryResult description;
+        description.result_table_ = DataTable::MakeResultTable({});
+        return description;
+    }
+    auto parsed_result = MakeUnique<ParserResult>();
+    SQLParser parser;
+    parser.Parse(bound_query, parsed_result.get());
+    if (parsed_result->IsError() || parsed_result->statements_ptr_->size() != 1) {
+        QueryResult description;
+        description.status_ =
+            parsed_result->IsError() ? Status::ParserError(parsed_result->error_message_) : Status::SyntaxError("Only support single statement.");
+        return description;
+    }
+    return query_context_ptr->DescribeStatement(parsed_result->statements_ptr_->front());
+}
+
+void Connection::SendRowDescription(const QueryResult &description) {
+    if (description.result_table_->ColumnCount() == 0) {
+        pg_handler_->SendNoData();
+    } else {
+        SendTableDescription(description.result_table_);
+    }
+}
+
 void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table) {
     u32 column_name_length_sum = 0;
     SizeT column_count = result_table->ColumnCount();
@@ -370,17 +755,25 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
     }
 }
 
-void Connection::SendQueryResponse(const QueryResult &query_result) {
-
+SizeT Connection::SendQueryRows(const QueryResult &query_result, SizeT row_offset, SizeT row_limit) {
     const SharedPtr<DataTable> &result_table = query_result.result_table_;
     SizeT column_count = result_table->ColumnCount();
     auto values_as_strings = Vector<Optional<String>>(column_count);
     SizeT block_count = result_table->DataBlockCount();
+    SizeT sent_row_count = 0;
+    SizeT block_row_offset = 0;
     for (SizeT idx = 0; idx < block_count; ++idx) {
         auto block = result_table->GetDataBlockById(idx);
         SizeT row_count = block->row_count();
+        if (block_row_offset + row_count <= row_offset) {
+            block_row_offset += row_count;
+            continue;
+        }
 
-        for (SizeT row_id = 0; row_id < row_count; ++row_id) {
+        for (SizeT row_id = row_offset > block_row_offset ? row_offset - block_row_offset : 0; row_id < row_count; ++row_id) {
+            if (row_limit != 0 && sent_row_count == row_limit) {
+                return sent_row_count;
+            }
             SizeT string_length_sum = 0;
 
             // iterate each column_vector of the block
@@ -391,9 +784,14 @@ void Connection::SendQueryResponse(const QueryResult &query_result) {
                 string_length_sum += string_value.size();
             }
             pg_handler_->SendData(values_as_strings, string_length_sum);
+            ++sent_row_count;
         }
+        block_row_offset += row_count;
     }
+    return sent_row_count;
+}
 
+void Connection::SendQueryComplete(const QueryResult &query_result) {
     String message;
     switch (query_result.root_operator_type_) {
         case LogicalNodeType::kInsert: {
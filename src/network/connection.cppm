@@ -20,19 +20,47 @@ import boost;
 import stl;
 import session;
 import pg_protocol_handler;
+import pg_message;
 import query_context;
 import data_table;
 import query_result;
+import pg_parameter;
+import constant_expr;
+import pg_worker_pool;
 
 namespace infinity {
 
-export class Connection {
+// A statement prepared by the Parse command of the extended query protocol
+struct PGPreparedStatement {
+    String query_{};
+    // the type oid of each parameter, 0 if the client leaves it to the server
+    Vector<u32> parameter_types_{};
+    // nullptr if the query can only be bound as text, see PGStatementTemplate::Make
+    UniquePtr<PGStatementTemplate> template_{};
+};
+
+// A prepared statement with bound parameters, created by the Bind command.
+// The statement is executed once by Execute, the rows are kept until all of them have been sent.
+struct PGPortal {
+    SharedPtr<PGPreparedStatement> statement_{};
+    Vector<UniquePtr<ConstantExpr>> parameters_{};
+    // the query with the parameters written as literals, if the statement has no template
+    String bound_query_{};
+    UniquePtr<QueryResult> result_{};
+    SizeT sent_row_count_{0};
+};
+
+// One client connection, driven by asynchronous reads and writes on the io threads of the pg server.
+// Commands are handled one at a time: read a command, handle it, write the responses, read the next one.
+// Commands that plan or execute a query are handled on the worker threads of the pg server, so that the io threads never block.
+export class Connection : public EnableSharedFromThis<Connection> {
 public:
-    explicit Connection(boost::asio::io_service &io_service);
+    Connection(boost::asio::io_service &io_service, atomic_u64 &running_connection_count, PGWorkerPool &worker_pool);
 
     ~Connection();
 
-    void Run();
+    // Start the message loop. The pending asynchronous operations keep the connection alive until the client leaves.
+    void Start();
 
     inline SharedPtr<boost::asio::ip::tcp::socket> socket() { return socket_; }
 
@@ -46,23 +74,75 @@ public:
     }
 
 private:
-    void HandleConnection();
+    void ReadStartupHeader();
+
+    void ReadStartupBody(u32 body_length);
+
+    void ReadCommandHeader();
+
+    void ReadCommandBody(PGMessageType command_type, u32 body_length);
+
+    void DispatchCommand(PGMessageType command_type);
+
+    void HandleCommand(PGMessageType command_type);
+
+    // Write the pending responses if the command asks for it, then read the next command.
+    void FinishCommand(PGMessageType command_type);
+
+    void WriteResponse(bool read_next);
+
+    void Close();
+
+    UniquePtr<QueryContext> CreateQueryContext();
+
+    void HandlerSimpleQuery();
 
-    void HandleRequest();
+    void HandleParse();
 
-    void HandlerSimpleQuery(QueryContext *query_context);
+    void HandleBind();
+
+    void HandleDescribe();
+
+    void HandleExecute();
+
+    void HandleClose();
+
+    void ExecutePortal(PGPortal &portal);
+
+    // Plan the statement without executing it, return the result table without rows, or nullptr with the error status.
+    QueryResult DescribeStatement(PGPreparedStatement &statement, const Vector<UniquePtr<ConstantExpr>> &parameters, const String &bound_query);
+
+    void SendRowDescription(const QueryResult &description);
+
+    void SendErrorResponse(const String &error_message);
 
     void SendTableDescription(const SharedPtr<DataTable> &result_table);
 
-    void SendQueryResponse(const QueryResult &query_result);
+    // Send at most row_limit rows from row_offset, 0 means no limit. Return the number of sent rows.
+    SizeT SendQueryRows(const QueryResult &query_result, SizeT row_offset, SizeT row_limit);
+
+    void SendQueryComplete(const QueryResult &query_result);
 
 private:
     const SharedPtr<boost::asio::ip::tcp::socket> socket_{};
 
+    atomic_u64 &running_connection_count_;
+
+    PGWorkerPool &worker_pool_;
+
     const SharedPtr<PGProtocolHandler> pg_handler_{};
 
+    Vector<char> read_buffer_{};
+
     bool terminate_connection_ = false;
 
+    // After an error in the extended query protocol, the commands until the next Sync are ignored.
+    bool skip_until_sync_ = false;
+
+    HashMap<String, SharedPtr<PGPreparedStatement>> prepared_statements_{};
+
+    HashMap<String, PGPortal> portals_{};
+
     SharedPtr<RemoteSession> session_{};
 };
 
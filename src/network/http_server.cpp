@@ -55,6 +55,11 @@ import decimal_info;
 import status;
 import constant_expr;
 import command_statement;
+import metrics;
+import system_info;
+import storage;
+import catalog;
+import profiler;
 
 namespace {
 
@@ -2326,6 +2331,63 @@ public:
 };
 
 
+class MetricsHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        auto &registry = MetricsRegistry::instance();
+        // process level values are sampled at the scrape
+        registry.Gauge("infinity_process_memory_bytes", "Resident memory of the process")->Set(SystemInfo::MemoryUsage());
+        registry.Gauge("infinity_process_open_files", "Open file descriptors of the process")->Set(SystemInfo::OpenFileCount());
+
+        auto response = ResponseFactory::createResponse(HTTPStatus::CODE_200, registry.ToPrometheusText());
+        response->putHeader("Content-Type", "text/plain; version=0.0.4; charset=utf-8");
+        return response;
+    }
+};
+
+class ListProfilesHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        auto records = InfinityContext::instance().storage()->catalog()->GetProfileRecords();
+
+        nlohmann::json json_response;
+        json_response["error_code"] = 0;
+        json_response["profiles"] = nlohmann::json::array();
+        for (SizeT i = 0; i < records.size(); ++i) {
+            nlohmann::json json_profile;
+            json_profile["profile_no"] = records[i]->profile_id();
+            json_profile["reason"] = QueryProfiler::ProfileReasonToString(records[i]->reason());
+            json_profile["query"] = records[i]->query_text();
+            json_profile["total"] = records[i]->TotalElapsed();
+            json_response["profiles"].push_back(json_profile);
+        }
+        json_response["time_unit"] = "ns";
+        return ResponseFactory::createResponse(HTTPStatus::CODE_200, json_response.dump());
+    }
+};
+
+class ShowProfileHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        auto profile_no = std::strtoull(request->getPathVariable("profile_no").get()->c_str(), nullptr, 0);
+        auto record = InfinityContext::instance().storage()->catalog()->GetProfileRecord(profile_no);
+
+        nlohmann::json json_response;
+        HTTPStatus http_status;
+        if (record.get() != nullptr) {
+            json_response = QueryProfiler::Serialize(record.get());
+            json_response["error_code"] = 0;
+            http_status = HTTPStatus::CODE_200;
+        } else {
+            Status status = Status::DataNotExist(fmt::format("The record does not exist: {}", profile_no));
+            json_response["error_code"] = status.code();
+            json_response["error_message"] = status.message();
+            http_status = HTTPStatus::CODE_500;
+        }
+        return ResponseFactory::createResponse(http_status, json_response.dump());
+    }
+};
+
 } // namespace
 
 namespace infinity {
@@ -2392,6 +2454,13 @@ void HTTPServer::Start(u16 port) {
 
     router->route("POST", "/variables", MakeShared<SetGlobalVariableHandler>());
 
+    // metrics
+    router->route("GET", "/metrics", MakeShared<MetricsHandler>());
+
+    // profiles
+    router->route("GET", "/profiles", MakeShared<ListProfilesHandler>());
+    router->route("GET", "/profiles/{profile_no}", MakeShared<ShowProfileHandler>());
+
     SharedPtr<HttpConnectionProvider> connection_provider = HttpConnectionProvider::createShared({"localhost", port, WebAddress::IP_4});
     SharedPtr<HttpConnectionHandler> connection_handler = HttpConnectionHandler::createShared(router);
 
@@ -23,6 +23,12 @@ export namespace infinity {
 // Each message has the length field to indicate the message size.
 constexpr auto LENGTH_FIELD_SIZE = 4u;
 
+// Each message after the startup has a type byte before the length field.
+constexpr auto MESSAGE_HEADER_SIZE = 1u + LENGTH_FIELD_SIZE;
+
+// Startup message: length field + protocol version
+constexpr auto STARTUP_HEADER_SIZE = 2 * LENGTH_FIELD_SIZE;
+
 constexpr char NULL_END = '\0';
 
 enum class NullTerminator : bool {
@@ -40,6 +46,13 @@ enum class PGMessageType : unsigned char {
     kRowDescription = 'T',
     kData = 'D',
     kComplete = 'C',
+    kParseComplete = '1',
+    kBindComplete = '2',
+    kCloseComplete = '3',
+    kNoData = 'n',
+    kParameterDescription = 't',
+    kPortalSuspended = 's',
+    kEmptyQueryResponse = 'I',
 
     // Errors
     kHumanReadableError = 'M',
@@ -60,6 +73,28 @@ enum class PGMessageType : unsigned char {
     kCloseCommand = 'C',
 };
 
+// Format codes of parameters and result columns
+enum class PGFormatCode : i16 {
+    kText = 0,
+    kBinary = 1,
+};
+
+// Parse: prepare a statement, the query uses $1, $2 ... as parameter placeholders
+struct PGParseMessage {
+    String statement_name_{};
+    String query_{};
+    Vector<u32> parameter_types_{};
+};
+
+// Bind: bind parameter values to a prepared statement and create a portal
+struct PGBindMessage {
+    String portal_name_{};
+    String statement_name_{};
+    Vector<PGFormatCode> parameter_formats_{};
+    Vector<Optional<String>> parameters_{};
+    Vector<PGFormatCode> result_formats_{};
+};
+
 enum class TransactionStateType : unsigned char {
     kIDLE = 'I',  // Not in a transaction block
     kBlock = 'T', // In a transaction block
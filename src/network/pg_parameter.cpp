@@ -0,0 +1,680 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+module pg_parameter;
+
+import stl;
+import third_party;
+import status;
+import infinity_exception;
+import sql_parser;
+import parser_result;
+import base_statement;
+import select_statement;
+import insert_statement;
+import update_statement;
+import delete_statement;
+import explain_statement;
+import base_table_reference;
+import table_reference;
+import join_reference;
+import cross_product_reference;
+import subquery_reference;
+import parsed_expr;
+import constant_expr;
+import function_expr;
+import between_expr;
+import in_expr;
+import cast_expr;
+import case_expr;
+import subquery_expr;
+import search_expr;
+import match_expr;
+
+namespace infinity {
+
+namespace {
+
+// The placeholder of $n is a string no client query contains, so that it is told from the strings of the query.
+String Placeholder(SizeT parameter_id) { return fmt::format("\x01${}", parameter_id); }
+
+// Return the parameter id of a placeholder, 0 for any other string
+SizeT PlaceholderId(const char *str) {
+    if (str == nullptr || str[0] != '\x01' || str[1] != '$') {
+        return 0;
+    }
+    SizeT parameter_id = 0;
+    for (const char *c = str + 2; *c != '\0'; ++c) {
+        if (!std::isdigit(static_cast<unsigned char>(*c))) {
+            return 0;
+        }
+        parameter_id = parameter_id * 10 + (*c - '0');
+    }
+    return parameter_id;
+}
+
+String TrimSpace(std::string_view value) {
+    while (!value.empty() && std::isspace(static_cast<unsigned char>(value.front()))) {
+        value.remove_prefix(1);
+    }
+    while (!value.empty() && std::isspace(static_cast<unsigned char>(value.back()))) {
+        value.remove_suffix(1);
+    }
+    return String(value);
+}
+
+bool ParseInteger(const String &value, i64 &result) {
+    const char *begin = value.data();
+    const char *end = value.data() + value.size();
+    if (begin != end && *begin == '+') {
+        ++begin;
+    }
+    auto [ptr, ec] = std::from_chars(begin, end, result);
+    return begin != end && ec == std::errc() && ptr == end;
+}
+
+bool ParseDouble(const String &value, double &result) {
+    if (value.empty() || std::isspace(static_cast<unsigned char>(value.front()))) {
+        return false;
+    }
+    char *end = nullptr;
+    result = std::strtod(value.c_str(), &end);
+    return end == value.c_str() + value.size();
+}
+
+// [1, 2, 3] as written in a query, or {1,2,3} as the text format of an array parameter
+bool ParseArray(const String &value, Vector<String> &elements) {
+    const String array = TrimSpace(value);
+    if (array.size() < 2 || !((array.front() == '[' && array.back() == ']') || (array.front() == '{' && array.back() == '}'))) {
+        return false;
+    }
+    elements.clear();
+    const std::string_view body(array.data() + 1, array.size() - 2);
+    if (TrimSpace(body).empty()) {
+        return true;
+    }
+    SizeT begin = 0;
+    while (true) {
+        const SizeT comma = body.find(',', begin);
+        elements.push_back(TrimSpace(body.substr(begin, comma == std::string_view::npos ? std::string_view::npos : comma - begin)));
+        if (comma == std::string_view::npos) {
+            break;
+        }
+        begin = comma + 1;
+    }
+    return true;
+}
+
+bool ParseIntegerArray(const String &value, Vector<i64> &result) {
+    Vector<String> elements;
+    if (!ParseArray(value, elements) || elements.empty()) {
+        return false;
+    }
+    result.resize(elements.size());
+    for (SizeT i = 0; i < elements.size(); ++i) {
+        if (!ParseInteger(elements[i], result[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ParseDoubleArray(const String &value, Vector<double> &result) {
+    Vector<String> elements;
+    if (!ParseArray(value, elements) || elements.empty()) {
+        return false;
+    }
+    result.resize(elements.size());
+    for (SizeT i = 0; i < elements.size(); ++i) {
+        if (!ParseDouble(elements[i], result[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+String ArrayLiteral(const Vector<T> &elements) {
+    String literal = "[";
+    for (SizeT i = 0; i < elements.size(); ++i) {
+        if (i > 0) {
+            literal += ',';
+        }
+        literal += fmt::format("{}", elements[i]);
+    }
+    literal += ']';
+    return literal;
+}
+
+void InvalidParameter(SizeT parameter_id, const String &value, const String &expected) {
+    RecoverableError(Status::InvalidParameterValue(fmt::format("${}", parameter_id), value, expected));
+}
+
+// Overwrite a placeholder with a value, the constant owns its strings
+void AssignConstant(ConstantExpr &slot, const ConstantExpr &value) {
+    switch (slot.literal_type_) {
+        case LiteralType::kString: {
+            std::free(slot.str_value_);
+            slot.str_value_ = nullptr;
+            break;
+        }
+        case LiteralType::kDate:
+        case LiteralType::kTime:
+        case LiteralType::kDateTime:
+        case LiteralType::kTimestamp: {
+            std::free(slot.date_value_);
+            slot.date_value_ = nullptr;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    slot.literal_type_ = value.literal_type_;
+    slot.bool_value_ = value.bool_value_;
+    slot.integer_value_ = value.integer_value_;
+    slot.double_value_ = value.double_value_;
+    if (value.str_value_ != nullptr) {
+        slot.str_value_ = strdup(value.str_value_);
+    }
+    if (value.date_value_ != nullptr) {
+        slot.date_value_ = strdup(value.date_value_);
+    }
+    slot.long_array_ = value.long_array_;
+    slot.double_array_ = value.double_array_;
+}
+
+// Collects the placeholders of a statement by parameter id
+class PlaceholderCollector {
+public:
+    explicit PlaceholderCollector(Vector<Vector<ConstantExpr *>> &constants, Vector<Vector<String *>> &texts) : constants_(constants), texts_(texts) {}
+
+    void VisitStatement(BaseStatement *statement) {
+        if (statement == nullptr) {
+            return;
+        }
+        switch (statement->type_) {
+            case StatementType::kSelect: {
+                VisitSelect(static_cast<SelectStatement *>(statement));
+                break;
+            }
+            case StatementType::kInsert: {
+                auto *insert_statement = static_cast<InsertStatement *>(statement);
+                if (insert_statement->values_ != nullptr) {
+                    for (auto *row : *insert_statement->values_) {
+                        VisitExprList(row);
+                    }
+                }
+                VisitSelect(insert_statement->select_);
+                break;
+            }
+            case StatementType::kUpdate: {
+                auto *update_statement = static_cast<UpdateStatement *>(statement);
+                VisitExpr(update_statement->where_expr_);
+                if (update_statement->update_expr_array_ != nullptr) {
+                    for (auto *update_expr : *update_statement->update_expr_array_) {
+                        VisitExpr(update_expr->value);
+                    }
+                }
+                break;
+            }
+            case StatementType::kDelete: {
+                VisitExpr(static_cast<DeleteStatement *>(statement)->where_expr_);
+                break;
+            }
+            case StatementType::kExplain: {
+                VisitStatement(static_cast<ExplainStatement *>(statement)->statement_);
+                break;
+            }
+            default: {
+                // The other statements have no expressions, a placeholder in them isn't found and the query is bound as text.
+                break;
+            }
+        }
+    }
+
+private:
+    void VisitSelect(SelectStatement *statement) {
+        for (; statement != nullptr; statement = statement->nested_select_) {
+            if (statement->with_exprs_ != nullptr) {
+                for (auto *with_expr : *statement->with_exprs_) {
+                    VisitStatement(with_expr->select_);
+                }
+            }
+            VisitTableRef(statement->table_ref_);
+            VisitExprList(statement->select_list_);
+            VisitExpr(statement->search_expr_);
+            VisitExpr(statement->where_expr_);
+            VisitExprList(statement->group_by_list_);
+            VisitExpr(statement->having_expr_);
+            if (statement->order_by_list != nullptr) {
+                for (auto *order_by_expr : *statement->order_by_list) {
+                    VisitExpr(order_by_expr->expr_);
+                }
+            }
+            VisitExpr(statement->limit_expr_);
+            VisitExpr(statement->offset_expr_);
+        }
+    }
+
+    void VisitTableRef(BaseTableReference *table_ref) {
+        if (table_ref == nullptr) {
+            return;
+        }
+        switch (table_ref->type_) {
+            case TableRefType::kJoin: {
+                auto *join_ref = static_cast<JoinReference *>(table_ref);
+                VisitTableRef(join_ref->left_);
+                VisitTableRef(join_ref->right_);
+                VisitExpr(join_ref->condition_);
+                break;
+            }
+            case TableRefType::kCrossProduct: {
+                for (auto *child_ref : static_cast<CrossProductReference *>(table_ref)->tables_) {
+                    VisitTableRef(child_ref);
+                }
+                break;
+            }
+            case TableRefType::kSubquery: {
+                VisitSelect(static_cast<SubqueryReference *>(table_ref)->select_statement_);
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+
+    void VisitExprList(Vector<ParsedExpr *> *exprs) {
+        if (exprs == nullptr) {
+            return;
+        }
+        for (auto *expr : *exprs) {
+            VisitExpr(expr);
+        }
+    }
+
+    void VisitExpr(ParsedExpr *expr) {
+        if (expr == nullptr) {
+            return;
+        }
+        switch (expr->type_) {
+            case ParsedExprType::kConstant: {
+                auto *constant_expr = static_cast<ConstantExpr *>(expr);
+                if (constant_expr->literal_type_ == LiteralType::kString) {
+                    if (SizeT parameter_id = PlaceholderId(constant_expr->str_value_); parameter_id != 0) {
+                        Slot(constants_, parameter_id).push_back(constant_expr);
+                    }
+                }
+                break;
+            }
+            case ParsedExprType::kFunction: {
+                VisitExprList(static_cast<FunctionExpr *>(expr)->arguments_);
+                break;
+            }
+            case ParsedExprType::kBetween: {
+                auto *between_expr = static_cast<BetweenExpr *>(expr);
+                VisitExpr(between_expr->value_);
+                VisitExpr(between_expr->lower_bound_);
+                VisitExpr(between_expr->upper_bound_);
+                break;
+            }
+            case ParsedExprType::kIn: {
+                auto *in_expr = static_cast<InExpr *>(expr);
+                VisitExpr(in_expr->left_);
+                VisitExprList(in_expr->arguments_);
+                break;
+            }
+            case ParsedExprType::kCast: {
+                VisitExpr(static_cast<CastExpr *>(expr)->expr_);
+                break;
+            }
+            case ParsedExprType::kCase: {
+                auto *case_expr = static_cast<CaseExpr *>(expr);
+                VisitExpr(case_expr->expr_);
+                if (case_expr->case_check_array_ != nullptr) {
+                    for (auto *when_then : *case_expr->case_check_array_) {
+                        VisitExpr(when_then->when_);
+                        VisitExpr(when_then->then_);
+                    }
+                }
+                VisitExpr(case_expr->else_expr_);
+                break;
+            }
+            case ParsedExprType::kSubquery: {
+                auto *subquery_expr = static_cast<SubqueryExpr *>(expr);
+                VisitExpr(subquery_expr->left_);
+                VisitSelect(subquery_expr->select_);
+                break;
+            }
+            case ParsedExprType::kSearch: {
+                for (auto *match_expr : static_cast<SearchExpr *>(expr)->match_exprs_) {
+                    VisitExpr(match_expr);
+                }
+                break;
+            }
+            case ParsedExprType::kMatch: {
+                auto *match_expr = static_cast<MatchExpr *>(expr);
+                for (String *text : {&match_expr->fields_, &match_expr->matching_text_, &match_expr->options_text_}) {
+                    if (SizeT parameter_id = PlaceholderId(text->c_str()); parameter_id != 0) {
+                        Slot(texts_, parameter_id).push_back(text);
+                    }
+                }
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+
+    template <typename T>
+    static Vector<T *> &Slot(Vector<Vector<T *>> &slots, SizeT parameter_id) {
+        if (slots.size() < parameter_id) {
+            slots.resize(parameter_id);
+        }
+        return slots[parameter_id - 1];
+    }
+
+    Vector<Vector<ConstantExpr *>> &constants_;
+    Vector<Vector<String *>> &texts_;
+};
+
+} // namespace
+
+UniquePtr<ConstantExpr> MakeParameterValue(SizeT parameter_id, const Optional<String> &value, u32 type_oid) {
+    if (!value.has_value()) {
+        return MakeUnique<ConstantExpr>(LiteralType::kNull);
+    }
+    const String &text = value.value();
+    switch (type_oid) {
+        case PGTypeOid::kBool: {
+            auto constant_expr = MakeUnique<ConstantExpr>(LiteralType::kBoolean);
+            if (text == "t" || text == "true" || text == "1") {
+                constant_expr->bool_value_ = true;
+            } else if (text == "f" || text == "false" || text == "0") {
+                constant_expr->bool_value_ = false;
+            } else {
+                InvalidParameter(parameter_id, text, "true or false");
+            }
+            return constant_expr;
+        }
+        case PGTypeOid::kInt2:
+        case PGTypeOid::kInt4:
+        case PGTypeOid::kInt8: {
+            auto constant_expr = MakeUnique<ConstantExpr>(LiteralType::kInteger);
+            if (!ParseInteger(text, constant_expr->integer_value_)) {
+                InvalidParameter(parameter_id, text, "an integer");
+            }
+            return constant_expr;
+        }
+        case PGTypeOid::kFloat4:
+        case PGTypeOid::kFloat8:
+        case PGTypeOid::kNumeric: {
+            auto constant_expr = MakeUnique<ConstantExpr>(LiteralType::kDouble);
+            if (!ParseDouble(text, constant_expr->double_value_)) {
+                InvalidParameter(parameter_id, text, "a number");
+            }
+            return constant_expr;
+        }
+        case PGTypeOid::kText:
+        case PGTypeOid::kUnknown:
+        case PGTypeOid::kBpChar:
+        case PGTypeOid::kVarchar: {
+            auto constant_expr = MakeUnique<ConstantExpr>(LiteralType::kString);
+            constant_expr->str_value_ = strdup(text.c_str());
+            return constant_expr;
+        }
+        case PGTypeOid::kDate:
+        case PGTypeOid::kTime:
+        case PGTypeOid::kTimestamp: {
+            const LiteralType literal_type =
+                type_oid == PGTypeOid::kDate ? LiteralType::kDate : (type_oid == PGTypeOid::kTime ? LiteralType::kTime : LiteralType::kTimestamp);
+            auto constant_expr = MakeUnique<ConstantExpr>(literal_type);
+            constant_expr->date_value_ = strdup(text.c_str());
+            return constant_expr;
+        }
+        case PGTypeOid::kInt2Array:
+        case PGTypeOid::kInt4Array:
+        case PGTypeOid::kInt8Array: {
+            auto constant_expr = MakeUnique<ConstantExpr>(LiteralType::kIntegerArray);
+            if (!ParseIntegerArray(text, constant_expr->long_array_)) {
+                InvalidParameter(parameter_id, text, "an array of integers");
+            }
+            return constant_expr;
+        }
+        case PGTypeOid::kFloat4Array:
+        case PGTypeOid::kFloat8Array: {
+            auto constant_expr = MakeUnique<ConstantExpr>(LiteralType::kDoubleArray);
+            if (!ParseDoubleArray(text, constant_expr->double_array_)) {
+                InvalidParameter(parameter_id, text, "an array of numbers");
+            }
+            return constant_expr;
+        }
+        case PGTypeOid::kUnspecified: {
+            if (i64 integer_value = 0; ParseInteger(text, integer_value)) {
+                auto constant_expr = MakeUnique<ConstantExpr>(LiteralType::kInteger);
+                constant_expr->integer_value_ = integer_value;
+                return constant_expr;
+            }
+            if (double double_value = 0; ParseDouble(text, double_value)) {
+                auto constant_expr = MakeUnique<ConstantExpr>(LiteralType::kDouble);
+                constant_expr->double_value_ = double_value;
+                return constant_expr;
+            }
+            if (Vector<i64> long_array; ParseIntegerArray(text, long_array)) {
+                auto constant_expr = MakeUnique<ConstantExpr>(LiteralType::kIntegerArray);
+                constant_expr->long_array_ = std::move(long_array);
+                return constant_expr;
+            }
+            if (Vector<double> double_array; ParseDoubleArray(text, double_array)) {
+                auto constant_expr = MakeUnique<ConstantExpr>(LiteralType::kDoubleArray);
+                constant_expr->double_array_ = std::move(double_array);
+                return constant_expr;
+            }
+            auto constant_expr = MakeUnique<ConstantExpr>(LiteralType::kString);
+            constant_expr->str_value_ = strdup(text.c_str());
+            return constant_expr;
+        }
+        default: {
+            RecoverableError(Status::NotSupport(fmt::format("Parameter ${} of type oid {}", parameter_id, type_oid)));
+        }
+    }
+    return nullptr;
+}
+
+UniquePtr<ConstantExpr> MakeParameterSample(u32 type_oid) {
+    switch (type_oid) {
+        case PGTypeOid::kBool: {
+            return MakeParameterValue(0, "false", type_oid);
+        }
+        case PGTypeOid::kInt2:
+        case PGTypeOid::kInt4:
+        case PGTypeOid::kInt8:
+        case PGTypeOid::kFloat4:
+        case PGTypeOid::kFloat8:
+        case PGTypeOid::kNumeric: {
+            return MakeParameterValue(0, "0", type_oid);
+        }
+        case PGTypeOid::kUnspecified:
+        case PGTypeOid::kUnknown:
+        case PGTypeOid::kText:
+        case PGTypeOid::kBpChar:
+        case PGTypeOid::kVarchar: {
+            return MakeParameterValue(0, "", PGTypeOid::kText);
+        }
+        case PGTypeOid::kDate: {
+            return MakeParameterValue(0, "1970-01-01", type_oid);
+        }
+        case PGTypeOid::kTime: {
+            return MakeParameterValue(0, "00:00:00", type_oid);
+        }
+        case PGTypeOid::kTimestamp: {
+            return MakeParameterValue(0, "1970-01-01 00:00:00", type_oid);
+        }
+        case PGTypeOid::kInt2Array:
+        case PGTypeOid::kInt4Array:
+        case PGTypeOid::kInt8Array:
+        case PGTypeOid::kFloat4Array:
+        case PGTypeOid::kFloat8Array: {
+            return MakeParameterValue(0, "{0}", type_oid);
+        }
+        default: {
+            RecoverableError(Status::NotSupport(fmt::format("Parameter type oid {}", type_oid)));
+        }
+    }
+    return nullptr;
+}
+
+String ParameterLiteral(const ConstantExpr &value) {
+    switch (value.literal_type_) {
+        case LiteralType::kBoolean: {
+            return value.bool_value_ ? "true" : "false";
+        }
+        case LiteralType::kInteger: {
+            return std::to_string(value.integer_value_);
+        }
+        case LiteralType::kDouble: {
+            return fmt::format("{}", value.double_value_);
+        }
+        case LiteralType::kNull: {
+            return "NULL";
+        }
+        case LiteralType::kDate:
+        case LiteralType::kTime:
+        case LiteralType::kTimestamp: {
+            const char *keyword = value.literal_type_ == LiteralType::kDate ? "DATE" : (value.literal_type_ == LiteralType::kTime ? "TIME" : "TIMESTAMP");
+            ConstantExpr date_string(LiteralType::kString);
+            date_string.str_value_ = strdup(value.date_value_);
+            return fmt::format("{} {}", keyword, ParameterLiteral(date_string));
+        }
+        case LiteralType::kIntegerArray: {
+            return ArrayLiteral(value.long_array_);
+        }
+        case LiteralType::kDoubleArray: {
+            return ArrayLiteral(value.double_array_);
+        }
+        default: {
+            String literal = "'";
+            for (const char *c = value.str_value_; c != nullptr && *c != '\0'; ++c) {
+                if (*c == '\'') {
+                    literal += '\'';
+                }
+                literal += *c;
+            }
+            literal += '\'';
+            return literal;
+        }
+    }
+}
+
+Vector<SizeT> ReplaceParameters(const String &query, const std::function<String(SizeT)> &replace, String &result) {
+    Vector<SizeT> occurrences;
+    result.clear();
+    result.reserve(query.size());
+    char quote = 0;
+    for (SizeT i = 0; i < query.size(); ++i) {
+        const char c = query[i];
+        if (quote != 0) {
+            result += c;
+            if (c == quote) {
+                quote = 0;
+            }
+            continue;
+        }
+        if (c == '\'' || c == '"') {
+            quote = c;
+            result += c;
+            continue;
+        }
+        if (c != '$' || i + 1 == query.size() || !std::isdigit(static_cast<unsigned char>(query[i + 1]))) {
+            result += c;
+            continue;
+        }
+        SizeT parameter_id = 0;
+        SizeT j = i + 1;
+        for (; j < query.size() && std::isdigit(static_cast<unsigned char>(query[j])); ++j) {
+            parameter_id = parameter_id * 10 + (query[j] - '0');
+        }
+        if (parameter_id == 0) {
+            RecoverableError(Status::SyntaxError("Parameter $0 doesn't exist"));
+        }
+        if (occurrences.size() < parameter_id) {
+            occurrences.resize(parameter_id, 0);
+        }
+        ++occurrences[parameter_id - 1];
+        result += replace(parameter_id);
+        i = j - 1;
+    }
+    return occurrences;
+}
+
+UniquePtr<PGStatementTemplate> PGStatementTemplate::Make(const String &query, SizeT &parameter_count) {
+    String template_query;
+    const Vector<SizeT> occurrences = ReplaceParameters(
+        query,
+        [](SizeT parameter_id) { return fmt::format("'{}'", Placeholder(parameter_id)); },
+        template_query);
+    parameter_count = occurrences.size();
+
+    auto statement_template = MakeUnique<PGStatementTemplate>();
+    statement_template->parsed_result_ = MakeUnique<ParserResult>();
+    SQLParser parser;
+    parser.Parse(template_query, statement_template->parsed_result_.get());
+    if (statement_template->parsed_result_->IsError() || statement_template->parsed_result_->statements_ptr_->size() != 1) {
+        return nullptr;
+    }
+
+    Vector<Vector<ConstantExpr *>> constants;
+    Vector<Vector<String *>> texts;
+    PlaceholderCollector collector(constants, texts);
+    collector.VisitStatement(statement_template->parsed_result_->statements_ptr_->front());
+    constants.resize(occurrences.size());
+    texts.resize(occurrences.size());
+
+    // Every placeholder written into the query has to be found in the statement
+    statement_template->slots_.resize(occurrences.size());
+    for (SizeT i = 0; i < occurrences.size(); ++i) {
+        if (constants[i].size() + texts[i].size() != occurrences[i]) {
+            return nullptr;
+        }
+        statement_template->slots_[i].constants_ = std::move(constants[i]);
+        statement_template->slots_[i].texts_ = std::move(texts[i]);
+    }
+    return statement_template;
+}
+
+const BaseStatement *PGStatementTemplate::statement() const { return parsed_result_->statements_ptr_->front(); }
+
+void PGStatementTemplate::Bind(const Vector<UniquePtr<ConstantExpr>> &values) {
+    if (values.size() < slots_.size()) {
+        RecoverableError(Status::SyntaxError(fmt::format("Parameter ${} isn't bound", values.size() + 1)));
+    }
+    for (SizeT i = 0; i < slots_.size(); ++i) {
+        for (ConstantExpr *constant_expr : slots_[i].constants_) {
+            AssignConstant(*constant_expr, *values[i]);
+        }
+        for (String *text : slots_[i].texts_) {
+            *text = values[i]->literal_type_ == LiteralType::kNull ? String() : values[i]->ToString();
+        }
+    }
+}
+
+} // namespace infinity
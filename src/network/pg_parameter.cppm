@@ -0,0 +1,92 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module pg_parameter;
+
+import stl;
+import base_statement;
+import constant_expr;
+import parser_result;
+
+namespace infinity {
+
+// The type oids of the parameters which can be bound, as sent by Parse and ParameterDescription.
+export namespace PGTypeOid {
+constexpr u32 kUnspecified = 0;
+constexpr u32 kBool = 16;
+constexpr u32 kInt8 = 20;
+constexpr u32 kInt2 = 21;
+constexpr u32 kInt4 = 23;
+constexpr u32 kText = 25;
+constexpr u32 kFloat4 = 700;
+constexpr u32 kFloat8 = 701;
+constexpr u32 kUnknown = 705;
+constexpr u32 kInt2Array = 1005;
+constexpr u32 kInt4Array = 1007;
+constexpr u32 kInt8Array = 1016;
+constexpr u32 kFloat4Array = 1021;
+constexpr u32 kFloat8Array = 1022;
+constexpr u32 kBpChar = 1042;
+constexpr u32 kVarchar = 1043;
+constexpr u32 kDate = 1082;
+constexpr u32 kTime = 1083;
+constexpr u32 kTimestamp = 1114;
+constexpr u32 kNumeric = 1700;
+} // namespace PGTypeOid
+
+// Convert the text format value of the parameter $parameter_id to a constant of the parameter type, NULL for a missing value.
+// A parameter without a type is an integer, a double, an array of them, or a string, whichever the text reads as.
+export UniquePtr<ConstantExpr> MakeParameterValue(SizeT parameter_id, const Optional<String> &value, u32 type_oid);
+
+// A value of the parameter type to plan the statement before the parameters are bound. A parameter without a type is
+// described to the client as text, its sample is an empty string.
+export UniquePtr<ConstantExpr> MakeParameterSample(u32 type_oid);
+
+// The SQL literal of a parameter value
+export String ParameterLiteral(const ConstantExpr &value);
+
+// Replace each $n outside of the quoted strings and identifiers with replace(n).
+// Return the number of the occurrences of each parameter, the size is the largest n.
+export Vector<SizeT> ReplaceParameters(const String &query, const std::function<String(SizeT)> &replace, String &result);
+
+// A statement of the extended query protocol, parsed once by Parse. Each $n is parsed as a placeholder string, which is
+// found again in the statement and overwritten by the value bound for an execution.
+export class PGStatementTemplate {
+public:
+    // Return nullptr if the query isn't one statement, or a parameter stands where the grammar only takes a literal token,
+    // such as the query vector of MATCH VECTOR. Such a query has to be bound as text and parsed for each execution.
+    // parameter_count is the largest n of the $n in the query in either case.
+    static UniquePtr<PGStatementTemplate> Make(const String &query, SizeT &parameter_count);
+
+    [[nodiscard]] const BaseStatement *statement() const;
+
+    [[nodiscard]] SizeT parameter_count() const { return slots_.size(); }
+
+    // Write the values into the placeholders, values[i] is the value of $(i + 1)
+    void Bind(const Vector<UniquePtr<ConstantExpr>> &values);
+
+private:
+    // Where one parameter is used: the constants of the expressions, and the strings of MATCH TEXT
+    struct ParameterSlots {
+        Vector<ConstantExpr *> constants_{};
+        Vector<String *> texts_{};
+    };
+
+    UniquePtr<ParserResult> parsed_result_{};
+    Vector<ParameterSlots> slots_{};
+};
+
+} // namespace infinity
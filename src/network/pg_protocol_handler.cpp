@@ -14,33 +14,37 @@
 
 module;
 
-import boost;
 import stl;
 import pg_message;
+import third_party;
+import infinity_exception;
+import default_values;
+import status;
+import logger;
 module pg_protocol_handler;
 
 namespace infinity {
 
-PGProtocolHandler::PGProtocolHandler(const SharedPtr<boost::asio::ip::tcp::socket> &socket) : buffer_reader_(socket), buffer_writer_(socket) {}
-
-u32 PGProtocolHandler::read_startup_header() {
+Optional<u32> PGProtocolHandler::read_startup_header() {
     constexpr u32 SSL_MESSAGE_VERSION = 80877103u;
     const auto length = buffer_reader_.read_value_u32();
     const auto version = buffer_reader_.read_value_u32();
     if (version == SSL_MESSAGE_VERSION) {
         // TODO: support SSL
-        // Now we said not support ssl
+        // Now we said not support ssl, the client will send the startup message again
         buffer_writer_.send_value_u8(static_cast<unsigned char>(PGMessageType::kSSLNo));
-        buffer_writer_.flush();
-        return read_startup_header();
-    } else {
-        return length - 2 * LENGTH_FIELD_SIZE;
+        return None;
+    }
+    if (length < STARTUP_HEADER_SIZE || length > PG_MAX_MESSAGE_SIZE) {
+        String error_message = fmt::format("Invalid startup message length: {}", length);
+        LOG_ERROR(error_message);
+        RecoverableError(Status::IOError(error_message));
     }
+    return length - STARTUP_HEADER_SIZE;
 }
 
-void PGProtocolHandler::read_startup_body(const u32 body_size) {
+void PGProtocolHandler::read_startup_body() {
     // TODO: Need to check the startup message which contains information from the cmd by user.
-    buffer_reader_.read_string(body_size, NullTerminator::kNo);
 }
 
 void PGProtocolHandler::send_authentication() {
@@ -67,14 +71,74 @@ void PGProtocolHandler::send_ready_for_query() {
     buffer_writer_.send_value_i8(static_cast<char>(PGMessageType::kReadyForQuery));
     buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE + sizeof(TransactionStateType::kIDLE));
     buffer_writer_.send_value_i8(static_cast<char>(TransactionStateType::kIDLE));
-    buffer_writer_.flush();
 }
 
-PGMessageType PGProtocolHandler::read_command_type() { return static_cast<PGMessageType>(buffer_reader_.read_value_i8()); }
+Pair<PGMessageType, u32> PGProtocolHandler::read_command_header() {
+    const auto command_type = static_cast<PGMessageType>(buffer_reader_.read_value_i8());
+    const auto command_length = buffer_reader_.read_value_u32();
+    if (command_length < LENGTH_FIELD_SIZE || command_length > PG_MAX_MESSAGE_SIZE) {
+        String error_message = fmt::format("Invalid message length: {}", command_length);
+        LOG_ERROR(error_message);
+        RecoverableError(Status::IOError(error_message));
+    }
+    return {command_type, command_length - LENGTH_FIELD_SIZE};
+}
+
+String PGProtocolHandler::read_command_body() { return buffer_reader_.read_string(buffer_reader_.size()); }
+
+Vector<PGFormatCode> PGProtocolHandler::ReadFormatCodes() {
+    const auto format_count = buffer_reader_.read_value_i16();
+    Vector<PGFormatCode> formats;
+    formats.reserve(std::max<i16>(format_count, 0));
+    for (i16 i = 0; i < format_count; ++i) {
+        formats.push_back(static_cast<PGFormatCode>(buffer_reader_.read_value_i16()));
+    }
+    return formats;
+}
+
+PGParseMessage PGProtocolHandler::read_parse_message() {
+    PGParseMessage message;
+    message.statement_name_ = buffer_reader_.read_string();
+    message.query_ = buffer_reader_.read_string();
+    const auto parameter_count = buffer_reader_.read_value_i16();
+    for (i16 i = 0; i < parameter_count; ++i) {
+        message.parameter_types_.push_back(buffer_reader_.read_value_u32());
+    }
+    return message;
+}
+
+PGBindMessage PGProtocolHandler::read_bind_message() {
+    PGBindMessage message;
+    message.portal_name_ = buffer_reader_.read_string();
+    message.statement_name_ = buffer_reader_.read_string();
+    message.parameter_formats_ = ReadFormatCodes();
+    const auto parameter_count = buffer_reader_.read_value_i16();
+    for (i16 i = 0; i < parameter_count; ++i) {
+        const auto value_length = buffer_reader_.read_value_i32();
+        if (value_length < 0) {
+            // Null value
+            message.parameters_.emplace_back(None);
+        } else {
+            message.parameters_.emplace_back(buffer_reader_.read_string(value_length, NullTerminator::kNo));
+        }
+    }
+    message.result_formats_ = ReadFormatCodes();
+    return message;
+}
+
+Pair<char, String> PGProtocolHandler::read_describe_message() {
+    const char target_type = buffer_reader_.read_value_i8();
+    return {target_type, buffer_reader_.read_string()};
+}
+
+Pair<String, i32> PGProtocolHandler::read_execute_message() {
+    String portal_name = buffer_reader_.read_string();
+    return {std::move(portal_name), buffer_reader_.read_value_i32()};
+}
 
-String PGProtocolHandler::read_command_body() {
-    const auto command_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
-    return buffer_reader_.read_string(command_length);
+Pair<char, String> PGProtocolHandler::read_close_message() {
+    const char target_type = buffer_reader_.read_value_i8();
+    return {target_type, buffer_reader_.read_string()};
 }
 
 void PGProtocolHandler::send_error_response(const HashMap<PGMessageType, String> &error_response_map) {
@@ -99,7 +163,6 @@ void PGProtocolHandler::send_error_response(const HashMap<PGMessageType, String>
 
     // message ending terminator
     buffer_writer_.send_value_u8(NULL_END);
-    buffer_writer_.flush();
 }
 
 void PGProtocolHandler::SendDescriptionHeader(u32 total_column_name_length, u32 column_count) {
@@ -163,4 +226,30 @@ void PGProtocolHandler::SendComplete(const String &complete_message) {
     buffer_writer_.send_string(complete_message);
 }
 
+void PGProtocolHandler::SendEmptyMessage(PGMessageType message_type) {
+    buffer_writer_.send_value_u8(static_cast<u8>(message_type));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendParseComplete() { SendEmptyMessage(PGMessageType::kParseComplete); }
+
+void PGProtocolHandler::SendBindComplete() { SendEmptyMessage(PGMessageType::kBindComplete); }
+
+void PGProtocolHandler::SendCloseComplete() { SendEmptyMessage(PGMessageType::kCloseComplete); }
+
+void PGProtocolHandler::SendNoData() { SendEmptyMessage(PGMessageType::kNoData); }
+
+void PGProtocolHandler::SendPortalSuspended() { SendEmptyMessage(PGMessageType::kPortalSuspended); }
+
+void PGProtocolHandler::SendEmptyQueryResponse() { SendEmptyMessage(PGMessageType::kEmptyQueryResponse); }
+
+void PGProtocolHandler::SendParameterDescription(const Vector<u32> &parameter_types) {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kParameterDescription));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE + sizeof(u16) + parameter_types.size() * sizeof(u32));
+    buffer_writer_.send_value_u16(parameter_types.size());
+    for (const u32 parameter_type : parameter_types) {
+        buffer_writer_.send_value_u32(parameter_type);
+    }
+}
+
 } // namespace infinity
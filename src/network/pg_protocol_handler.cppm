@@ -14,7 +14,6 @@
 module;
 
 import stl;
-import boost;
 import pg_message;
 import buffer_reader;
 import buffer_writer;
@@ -23,13 +22,18 @@ export module pg_protocol_handler;
 
 namespace infinity {
 
+// Decodes received messages and encodes responses in memory, the connection does the socket io.
 export class PGProtocolHandler {
 public:
-    explicit PGProtocolHandler(const SharedPtr<boost::asio::ip::tcp::socket> &socket);
+    PGProtocolHandler() = default;
 
-    u32 read_startup_header();
+    // set the message to decode: the startup header, the startup body or the body of a command
+    void set_message(Vector<char> data) { buffer_reader_.Reset(std::move(data)); }
 
-    void read_startup_body(u32 body_size);
+    // return the startup body size, or None for a SSL request which has been answered
+    Optional<u32> read_startup_header();
+
+    void read_startup_body();
 
     void send_authentication();
 
@@ -37,13 +41,25 @@ public:
 
     void send_ready_for_query();
 
-    PGMessageType read_command_type();
+    // decode the header of a command, return the command type and its body size
+    Pair<PGMessageType, u32> read_command_header();
 
     String read_command_body();
 
+    PGParseMessage read_parse_message();
+
+    PGBindMessage read_bind_message();
+
+    // 'S' for statement, 'P' for portal
+    Pair<char, String> read_describe_message();
+
+    // portal name and max row count, 0 means no limit
+    Pair<String, i32> read_execute_message();
+
+    // 'S' for statement, 'P' for portal
+    Pair<char, String> read_close_message();
+
     void send_error_response(const HashMap<PGMessageType, String> &error_response_map);
-    //
-    //    String read_query_packet();
 
     void SendDescriptionHeader(u32 total_column_name_length, u32 column_count);
 
@@ -52,17 +68,33 @@ public:
     void SendData(const Vector<Optional<String>> &values_as_strings, u64 string_length_sum);
 
     void SendComplete(const String &complete_message);
-    //
-    //    pair<String, String> read_parse_packet();
-    //    void read_sync_packet();
-    //
-    //    void send_status_message(const PGMessageType message_type);
 
-    //    void force_flush() { buffer_writer_.flush(); }
+    void SendParseComplete();
+
+    void SendBindComplete();
+
+    void SendCloseComplete();
+
+    void SendNoData();
+
+    void SendParameterDescription(const Vector<u32> &parameter_types);
+
+    void SendPortalSuspended();
+
+    void SendEmptyQueryResponse();
+
+    [[nodiscard]] bool has_output() const { return buffer_writer_.size() > 0; }
+
+    // take the encoded responses to write them to the socket
+    Vector<char> take_output() { return buffer_writer_.take(); }
 
 private:
+    void SendEmptyMessage(PGMessageType message_type);
+
+    Vector<PGFormatCode> ReadFormatCodes();
+
     BufferReader buffer_reader_;
     BufferWriter buffer_writer_;
 };
 
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
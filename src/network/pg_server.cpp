@@ -14,8 +14,7 @@
 
 module;
 
-#include <boost/bind.hpp>
-#include <thread>
+#include <boost/asio/error.hpp>
 
 module pg_server;
 
@@ -25,6 +24,7 @@ import stl;
 import boost;
 import third_party;
 import infinity_exception;
+import default_values;
 
 import connection;
 import logger;
@@ -54,48 +54,48 @@ void PGServer::Run() {
 
     fmt::print("Run 'psql -h {} -p {}' to connect to the server (SQL is only for test).\n", pg_listen_addr, pg_port);
 
+    // The current thread is one of the io threads.
+    for (u64 i = 1; i < PG_SERVER_IO_THREAD_NUM; ++i) {
+        io_threads_.emplace_back([this]() { io_service_.run(); });
+    }
     io_service_.run();
+    for (auto &io_thread : io_threads_) {
+        io_thread.join();
+    }
+    io_threads_.clear();
 }
 
 void PGServer::Shutdown() {
 
     initialized_ = false;
 
-    while (running_connection_count_ > 0) {
-        // Running connection exists.
-        std::this_thread::yield();
+    if (acceptor_ptr_.get() != nullptr) {
+        boost::system::error_code error;
+        acceptor_ptr_->close(error);
     }
 
+    // Wait for the running queries, their responses are dropped with the connections.
+    worker_pool_.Stop();
+
     io_service_.stop();
-    acceptor_ptr_->close();
 }
 
 void PGServer::CreateConnection() {
-    SharedPtr<Connection> connection_ptr = MakeShared<Connection>(io_service_);
-    acceptor_ptr_->async_accept(*(connection_ptr->socket()), boost::bind(&PGServer::StartConnection, this, connection_ptr));
+    SharedPtr<Connection> connection_ptr = MakeShared<Connection>(io_service_, running_connection_count_, worker_pool_);
+    acceptor_ptr_->async_accept(*(connection_ptr->socket()),
+                                [this, connection_ptr](const boost::system::error_code &error) { StartConnection(connection_ptr, error); });
 }
 
-void PGServer::StartConnection(SharedPtr<Connection> &connection) {
-    Thread connection_thread([connection = connection, &num_running_connections = this->running_connection_count_, initialized = bool(this->initialized_)]() mutable {
-        if(initialized) {
-            ++num_running_connections;
-            try {
-                connection->Run();
-            } catch (...) {
-                String ip_address;
-                u16 port;
-                connection->GetClientInfo(ip_address, port);
-                String msg = fmt::format("closed connection with {}:{} due to exception", ip_address, port);
-                LOG_ERROR(msg);
-            }
-
-            // User disconnected
-            connection.reset();
-            --num_running_connections;
-        }
-    });
-
-    connection_thread.detach();
+void PGServer::StartConnection(const SharedPtr<Connection> &connection, const boost::system::error_code &error) {
+    if (!initialized_ || error == boost::asio::error::operation_aborted) {
+        // The acceptor is closed
+        return;
+    }
+    if (!error) {
+        connection->Start();
+    } else {
+        LOG_ERROR(fmt::format("Failed to accept connection: {}", error.message()));
+    }
     CreateConnection();
 }
 
@@ -18,6 +18,8 @@ import stl;
 import singleton;
 import boost;
 import connection;
+import default_values;
+import pg_worker_pool;
 
 export module pg_server;
 
@@ -27,6 +29,8 @@ export struct StartupParameter {
     SharedPtr<String> config_path{};
 };
 
+// Connections are served by asynchronous socket io on a fixed number of io threads,
+// and the queries run on the worker threads of the server, a thread is only taken while a query command runs.
 export class PGServer {
 public:
     void Run();
@@ -36,12 +40,14 @@ public:
 private:
     void CreateConnection();
 
-    void StartConnection(SharedPtr<Connection> &connection);
+    void StartConnection(const SharedPtr<Connection> &connection, const boost::system::error_code &error);
 
     atomic_bool initialized_{false};
     atomic_u64 running_connection_count_{0};
+    PGWorkerPool worker_pool_{};
     boost::asio::io_service io_service_{};
     UniquePtr<boost::asio::ip::tcp::acceptor> acceptor_ptr_{};
+    Vector<Thread> io_threads_{};
 };
 
 }
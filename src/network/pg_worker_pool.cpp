@@ -0,0 +1,74 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module pg_worker_pool;
+
+import stl;
+
+namespace infinity {
+
+PGWorkerPool::~PGWorkerPool() { Stop(); }
+
+void PGWorkerPool::Submit(std::function<void()> task) {
+    std::unique_lock lock(mutex_);
+    if (stop_) {
+        return;
+    }
+    tasks_.push_back(std::move(task));
+    if (idle_count_ < tasks_.size()) {
+        threads_.emplace_back([this]() { Work(); });
+    } else {
+        cv_.notify_one();
+    }
+}
+
+void PGWorkerPool::Stop() {
+    Vector<Thread> threads;
+    {
+        std::unique_lock lock(mutex_);
+        stop_ = true;
+        threads.swap(threads_);
+    }
+    cv_.notify_all();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+SizeT PGWorkerPool::thread_count() {
+    std::unique_lock lock(mutex_);
+    return threads_.size();
+}
+
+void PGWorkerPool::Work() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+        ++idle_count_;
+        cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+        --idle_count_;
+        if (tasks_.empty()) {
+            // stopped and no task left
+            return;
+        }
+        auto task = std::move(tasks_.front());
+        tasks_.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+} // namespace infinity
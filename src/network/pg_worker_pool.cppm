@@ -0,0 +1,52 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module pg_worker_pool;
+
+import stl;
+
+namespace infinity {
+
+// The threads running the query commands of the pg connections. A command waits for its fragments on the task scheduler
+// and the shared thread pool, so it must not run on a thread of them: the commands of many sessions would hold all the
+// threads and the work they wait for could never run.
+// A new thread is started when a command comes and no thread is idle, so every running command has its own thread and
+// the number of sessions running queries at once isn't limited. The idle threads are kept for the next commands.
+export class PGWorkerPool {
+public:
+    PGWorkerPool() = default;
+
+    ~PGWorkerPool();
+
+    void Submit(std::function<void()> task);
+
+    // Wait for the submitted tasks and join all threads, the tasks submitted after are dropped.
+    void Stop();
+
+    SizeT thread_count();
+
+private:
+    void Work();
+
+    std::mutex mutex_{};
+    std::condition_variable cv_{};
+    Deque<std::function<void()>> tasks_{};
+    Vector<Thread> threads_{};
+    SizeT idle_count_{0};
+    bool stop_{false};
+};
+
+} // namespace infinity
@@ -44,7 +44,7 @@ std::string FunctionExpr::ToString() const {
             ss << func_name_ << "(star)";
             return ss.str();
         } else {
-            ss << func_name_ << '(' << arguments_->at(0)->ToString() << ")";
+            ss << func_name_ << '(' << (distinct_ ? "distinct " : "") << arguments_->at(0)->ToString() << ")";
             return ss.str();
         }
     }
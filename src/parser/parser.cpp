@@ -753,18 +753,18 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  89
+#define YYFINAL  90
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1145
+#define YYLAST   1153
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  192
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  113
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  425
+#define YYNRULES  426
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  895
+#define YYNSTATES  897
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   430
@@ -852,28 +852,28 @@ static const yytype_int16 yyrline[] =
     1448,  1451,  1454,  1462,  1465,  1480,  1480,  1482,  1496,  1505,
     1510,  1519,  1524,  1529,  1535,  1542,  1545,  1549,  1552,  1557,
     1569,  1576,  1590,  1593,  1596,  1599,  1602,  1605,  1608,  1614,
-    1618,  1622,  1626,  1630,  1637,  1641,  1645,  1649,  1654,  1658,
-    1663,  1667,  1671,  1677,  1683,  1689,  1700,  1711,  1722,  1734,
-    1746,  1759,  1773,  1784,  1798,  1814,  1835,  1839,  1843,  1851,
-    1865,  1871,  1876,  1882,  1888,  1896,  1902,  1908,  1914,  1920,
-    1928,  1934,  1940,  1946,  1952,  1960,  1966,  1973,  1990,  1994,
-    1999,  2003,  2030,  2036,  2040,  2041,  2042,  2043,  2044,  2046,
-    2049,  2055,  2058,  2059,  2060,  2061,  2062,  2063,  2064,  2065,
-    2066,  2067,  2069,  2072,  2078,  2097,  2139,  2185,  2203,  2221,
-    2229,  2240,  2246,  2255,  2261,  2273,  2276,  2279,  2282,  2285,
-    2288,  2292,  2296,  2301,  2309,  2317,  2326,  2333,  2340,  2347,
-    2354,  2361,  2369,  2377,  2385,  2393,  2401,  2409,  2417,  2425,
-    2433,  2441,  2449,  2457,  2487,  2495,  2504,  2512,  2521,  2529,
-    2535,  2542,  2548,  2555,  2560,  2567,  2574,  2582,  2606,  2612,
-    2618,  2625,  2633,  2640,  2647,  2652,  2662,  2667,  2672,  2677,
-    2682,  2687,  2692,  2697,  2702,  2707,  2710,  2713,  2717,  2720,
-    2723,  2726,  2730,  2733,  2736,  2740,  2744,  2749,  2754,  2757,
-    2761,  2765,  2772,  2779,  2783,  2790,  2797,  2801,  2805,  2809,
-    2812,  2816,  2820,  2825,  2830,  2834,  2839,  2844,  2850,  2856,
-    2862,  2868,  2874,  2880,  2886,  2892,  2898,  2904,  2910,  2921,
-    2925,  2930,  2958,  2968,  2974,  2978,  2979,  2981,  2982,  2984,
-    2985,  2997,  3005,  3009,  3012,  3016,  3019,  3023,  3027,  3032,
-    3038,  3048,  3055,  3066,  3118,  3167
+    1618,  1622,  1626,  1630,  1637,  1641,  1646,  1650,  1654,  1659,
+    1663,  1668,  1672,  1676,  1682,  1688,  1694,  1705,  1716,  1727,
+    1739,  1751,  1764,  1778,  1789,  1803,  1819,  1840,  1844,  1848,
+    1856,  1870,  1876,  1881,  1887,  1893,  1901,  1907,  1913,  1919,
+    1925,  1933,  1939,  1945,  1951,  1957,  1965,  1971,  1978,  1995,
+    1999,  2004,  2008,  2035,  2041,  2045,  2046,  2047,  2048,  2049,
+    2051,  2054,  2060,  2063,  2064,  2065,  2066,  2067,  2068,  2069,
+    2070,  2071,  2072,  2074,  2077,  2083,  2102,  2144,  2190,  2208,
+    2226,  2234,  2245,  2251,  2260,  2266,  2278,  2281,  2284,  2287,
+    2290,  2293,  2297,  2301,  2306,  2314,  2322,  2331,  2338,  2345,
+    2352,  2359,  2366,  2374,  2382,  2390,  2398,  2406,  2414,  2422,
+    2430,  2438,  2446,  2454,  2462,  2492,  2500,  2509,  2517,  2526,
+    2534,  2540,  2547,  2553,  2560,  2565,  2572,  2579,  2587,  2611,
+    2617,  2623,  2630,  2638,  2645,  2652,  2657,  2667,  2672,  2677,
+    2682,  2687,  2692,  2697,  2702,  2707,  2712,  2715,  2718,  2722,
+    2725,  2728,  2731,  2735,  2738,  2741,  2745,  2749,  2754,  2759,
+    2762,  2766,  2770,  2777,  2784,  2788,  2795,  2802,  2806,  2810,
+    2814,  2817,  2821,  2825,  2830,  2835,  2839,  2844,  2849,  2855,
+    2861,  2867,  2873,  2879,  2885,  2891,  2897,  2903,  2909,  2915,
+    2926,  2930,  2935,  2963,  2973,  2979,  2983,  2984,  2986,  2987,
+    2989,  2990,  3002,  3010,  3014,  3017,  3021,  3024,  3028,  3032,
+    3037,  3043,  3053,  3060,  3071,  3125,  3174
 };
 #endif
 
@@ -959,12 +959,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-642)
+#define YYPACT_NINF (-647)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-413)
+#define YYTABLE_NINF (-414)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -973,96 +973,96 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-      64,   317,    26,   344,    85,   -11,    85,   192,   507,   597,
-      65,   153,   100,    85,   128,   -26,   -48,   160,     1,  -642,
-    -642,  -642,  -642,  -642,  -642,  -642,  -642,   358,  -642,  -642,
-     225,  -642,  -642,  -642,  -642,  -642,   112,   112,   112,   112,
-      37,    85,   167,   167,   167,   167,   167,    61,   237,    85,
-      42,   260,   280,   293,  -642,  -642,  -642,  -642,  -642,  -642,
-    -642,   246,   334,    85,  -642,  -642,  -642,  -642,  -642,   273,
-      51,   124,  -642,   340,  -642,   203,  -642,    85,  -642,  -642,
-    -642,  -642,  -642,   307,   187,  -642,   391,   223,   224,  -642,
-      30,  -642,   396,  -642,  -642,     3,   370,  -642,   374,   387,
-     470,    85,    85,    85,   474,   425,   297,   411,   500,    85,
-      85,    85,   506,   512,   518,   488,   535,   535,   465,    63,
-      78,    93,  -642,  -642,  -642,  -642,  -642,  -642,  -642,   358,
-    -642,  -642,  -642,  -642,  -642,  -642,   352,  -642,  -642,   545,
-    -642,   562,  -642,   560,  -642,   402,   128,   535,  -642,  -642,
-    -642,  -642,     3,  -642,  -642,  -642,   465,   527,   531,   514,
-    -642,   -10,  -642,   297,  -642,    85,   620,    29,  -642,  -642,
-    -642,  -642,  -642,   564,  -642,   458,   -42,  -642,   465,  -642,
-    -642,   568,   579,   481,  -642,  -642,   606,   501,   484,   486,
-     316,   636,   661,   672,   674,  -642,  -642,   678,   503,   295,
-     505,   515,   604,   604,  -642,    12,   350,  -105,  -642,    -3,
-     516,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,
-    -642,  -642,  -642,  -642,   517,  -642,  -642,  -642,  -120,  -642,
-    -642,    -5,  -642,    50,  -642,  -642,  -642,    97,  -642,   104,
-    -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,
-    -642,  -642,  -642,  -642,  -642,  -642,   697,   696,  -642,  -642,
-    -642,  -642,  -642,  -642,   225,  -642,  -642,   528,   529,   -40,
-     465,   465,   632,  -642,   -48,    31,   647,   533,  -642,   -93,
-     534,  -642,    85,   465,   518,  -642,   178,   536,   544,   209,
-    -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,
-    -642,  -642,   604,   550,   381,   641,   465,   465,    56,   346,
-    -642,  -642,  -642,  -642,   606,  -642,   746,   565,   572,   573,
-     574,   760,   761,   241,   241,  -642,   575,  -642,  -642,  -642,
-    -642,   580,   174,   689,   465,   768,   465,   465,   -16,   586,
-      27,   604,   604,   604,   604,   604,   604,   604,   604,   604,
-     604,   604,   604,   604,   604,    21,  -642,   589,  -642,   771,
-    -642,   773,  -642,   774,  -642,   776,   736,   129,   600,  -642,
-    -642,     7,   622,   599,  -642,    34,   178,   465,  -642,   358,
-     753,   675,   610,    11,  -642,  -642,  -642,   -48,   620,   612,
-    -642,   798,   465,   617,  -642,   178,  -642,   471,   471,   465,
-    -642,   219,   641,   650,   621,    73,    94,   353,  -642,   465,
-     465,   731,   465,   806,    28,   465,   254,   276,   423,  -642,
-    -642,   535,  -642,  -642,  -642,   663,   627,   604,   350,   688,
-    -642,   659,   659,   121,   121,   648,   659,   659,   121,   121,
-     241,   241,  -642,  -642,  -642,  -642,  -642,  -642,   624,  -642,
-     625,  -642,  -642,  -642,   811,   812,  -642,  -642,   -48,   629,
-     666,  -642,    47,  -642,   302,   488,   465,  -642,  -642,  -642,
-     178,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,
-    -642,  -642,   634,  -642,  -642,  -642,  -642,  -642,  -642,  -642,
-    -642,  -642,  -642,   635,   637,   646,   679,   681,   206,   682,
-     620,   794,    31,   358,   288,   620,  -642,   329,   685,   829,
-     831,  -642,   348,  -642,   393,   394,  -642,   677,  -642,   753,
-     465,  -642,   465,   -33,   116,   604,    71,   686,  -642,   -39,
-      80,  -642,   868,  -642,   873,  -642,  -642,   799,   350,   659,
-     691,   399,  -642,   604,   874,   876,   830,   832,    38,     7,
-     825,  -642,  -642,  -642,  -642,  -642,  -642,   826,  -642,   883,
-    -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,   698,   833,
-    -642,   884,   366,   419,   480,   520,   619,   763,   705,   769,
-    -642,  -642,   152,  -642,   764,   620,   410,   708,  -642,  -642,
-     737,   412,  -642,   465,  -642,  -642,  -642,   471,  -642,  -642,
-    -642,   709,   178,    58,  -642,   465,   189,   713,   894,   589,
-     715,   714,   716,   718,   719,   430,  -642,  -642,   381,   896,
-     899,    47,   666,     7,     7,   721,   302,   845,   852,   434,
-     720,   722,   723,   724,   725,   726,   727,   728,   729,   730,
-     732,   733,   734,   735,   738,   739,   740,   741,   742,   743,
-     744,   745,   747,   748,   749,   750,   751,   752,   754,   755,
-     756,   757,   758,   759,   762,   765,   766,   767,   770,   772,
-    -642,   906,  -642,    10,  -642,  -642,  -642,   435,  -642,   906,
-     908,   778,   446,  -642,  -642,  -642,   178,  -642,   493,   775,
-     460,   777,    15,   779,  -642,  -642,  -642,  -642,  -642,   471,
-    -642,  -642,  -642,  -642,  -642,  -642,   857,   620,  -642,   465,
-     465,  -642,  -642,   920,   921,   937,   944,   945,   947,   948,
-     952,   953,   955,   957,   958,   960,   962,   964,   965,   966,
-     967,   968,   969,   970,   971,   972,   973,   974,   975,   976,
+     679,   239,    49,   344,    62,   -24,    62,   119,   407,   320,
+      89,   245,   110,    62,   131,   -27,   -49,   146,   -36,  -647,
+    -647,  -647,  -647,  -647,  -647,  -647,  -647,   240,  -647,  -647,
+     172,  -647,  -647,  -647,  -647,  -647,   130,   130,   130,   130,
+      16,    62,   138,   138,   138,   138,   138,    30,   208,    62,
+     -11,   226,   233,   258,  -647,  -647,  -647,  -647,  -647,  -647,
+    -647,   501,   262,    62,  -647,  -647,  -647,  -647,  -647,   236,
+     220,   314,   242,  -647,   279,  -647,   144,  -647,    62,  -647,
+    -647,  -647,  -647,  -647,   254,   132,  -647,   325,   152,   170,
+    -647,    35,  -647,   326,  -647,  -647,     2,   295,  -647,   298,
+     297,   380,    62,    62,    62,   401,   342,   228,   348,   415,
+      62,    62,    62,   425,   445,   458,   352,   459,   459,   485,
+      69,    83,    92,  -647,  -647,  -647,  -647,  -647,  -647,  -647,
+     240,  -647,  -647,  -647,  -647,  -647,  -647,   277,  -647,  -647,
+     475,  -647,   484,  -647,  -647,   503,  -647,   321,   131,   459,
+    -647,  -647,  -647,  -647,     2,  -647,  -647,  -647,   485,   465,
+     453,   455,  -647,   -37,  -647,   228,  -647,    62,   545,    -1,
+    -647,  -647,  -647,  -647,  -647,   488,  -647,   378,   -42,  -647,
+     485,  -647,  -647,   490,   498,   382,  -647,  -647,   755,   570,
+     400,   409,   365,   589,   619,   627,   635,  -647,  -647,   631,
+     463,   345,   464,   466,   121,   121,  -647,    32,   454,   -91,
+    -647,    -5,   533,  -647,  -647,  -647,  -647,  -647,  -647,  -647,
+    -647,  -647,  -647,  -647,  -647,  -647,   437,  -647,  -647,  -647,
+    -112,  -647,  -647,  -109,  -647,     0,  -647,  -647,  -647,    21,
+    -647,    56,  -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,
+    -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,   648,   647,
+    -647,  -647,  -647,  -647,  -647,  -647,   172,  -647,  -647,   471,
+     474,   -48,   485,   485,   591,  -647,   -49,    18,   610,   482,
+    -647,   -30,   496,  -647,    62,   485,   458,  -647,   284,   497,
+     511,   251,  -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,
+    -647,  -647,  -647,  -647,   121,   512,   633,   590,   485,   485,
+     -46,   186,  -647,  -647,  -647,  -647,   755,  -647,   672,   517,
+     521,   531,   532,   680,   715,   360,   360,  -647,   529,  -647,
+    -647,  -647,  -647,   535,   -86,   644,   485,   721,   485,   485,
+     -38,   544,    -9,   121,   121,   121,   121,   121,   121,   121,
+     121,   121,   121,   121,   121,   121,   121,    10,  -647,   547,
+    -647,   728,  -647,   729,  -647,   730,  -647,   732,   693,   514,
+     554,  -647,  -647,     8,   574,   555,  -647,    78,   284,   485,
+    -647,   240,   727,   622,   561,   100,  -647,  -647,  -647,   -49,
+     545,   567,  -647,   752,   485,   571,  -647,   284,  -647,   530,
+     530,   485,  -647,   143,   590,   612,   575,    51,    64,   219,
+    -647,   485,   485,   685,   485,   765,    11,   485,   156,   161,
+     636,  -647,  -647,   459,  -647,  -647,  -647,   623,   585,   121,
+     454,   649,  -647,   420,   420,   611,   611,   621,   420,   420,
+     611,   611,   360,   360,  -647,  -647,  -647,  -647,  -647,  -647,
+     583,  -647,   592,  -647,  -647,  -647,   770,   775,  -647,  -647,
+     -49,   594,   439,  -647,    37,  -647,   164,   352,   485,  -647,
+    -647,  -647,   284,  -647,  -647,  -647,  -647,  -647,  -647,  -647,
+    -647,  -647,  -647,  -647,   596,  -647,  -647,  -647,  -647,  -647,
+    -647,  -647,  -647,  -647,  -647,   600,   601,   609,   620,   652,
+     160,   653,   545,   777,    18,   240,   218,   545,  -647,   232,
+     656,   792,   804,  -647,   265,  -647,   266,   316,  -647,   658,
+    -647,   727,   485,  -647,   485,   -29,   127,   121,   -79,   618,
+    -647,   -88,   109,  -647,   842,  -647,   851,  -647,  -647,   776,
+     454,   420,   677,   331,  -647,   121,   862,   864,   817,   821,
+      33,     8,   813,  -647,  -647,  -647,  -647,  -647,  -647,   814,
+    -647,   871,  -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,
+     686,   824,  -647,   869,   222,   318,   634,   759,   768,   753,
+     694,   757,  -647,  -647,   -16,  -647,   754,   545,   332,   697,
+    -647,  -647,   726,   346,  -647,   485,  -647,  -647,  -647,   530,
+    -647,  -647,  -647,   698,   284,   117,  -647,   485,   214,   716,
+     895,   547,   717,   718,   719,   722,   720,   363,  -647,  -647,
+     633,   896,   897,    37,   439,     8,     8,   723,   164,   849,
+     854,   390,   724,   725,   731,   733,   734,   735,   736,   737,
+     738,   739,   740,   741,   742,   743,   744,   745,   746,   747,
+     748,   749,   750,   751,   756,   758,   760,   761,   762,   763,
+     764,   766,   767,   769,   771,   772,   773,   774,   778,   779,
+     780,   781,  -647,   908,  -647,    79,  -647,  -647,  -647,   392,
+    -647,   908,   909,   784,   404,  -647,  -647,  -647,   284,  -647,
+     638,   782,   417,   783,    13,   785,  -647,  -647,  -647,  -647,
+    -647,   530,  -647,  -647,  -647,  -647,  -647,  -647,   852,   545,
+    -647,   485,   485,  -647,  -647,   907,   911,   912,   913,   914,
+     916,   937,   938,   939,   941,   943,   949,   952,   954,   959,
+     960,   961,   968,   970,   971,   972,   973,   974,   975,   976,
      977,   978,   979,   980,   981,   982,   983,   984,   985,   986,
-     987,   988,   989,   990,   821,   466,  -642,  -642,  -642,   467,
-     918,   996,  -642,  -642,   997,  -642,   998,   999,  1000,   468,
-     465,   479,   810,   178,   818,   819,   820,   822,   823,   824,
-     827,   828,   834,   835,   836,   837,   838,   839,   840,   841,
-     842,   843,   844,   846,   847,   848,   849,   850,   851,   853,
-     854,   855,   856,   858,   859,   860,   861,   862,   863,   864,
-     865,   866,   867,   869,   870,   312,  -642,   906,  -642,  -642,
-     918,   871,   872,   875,   487,  -642,   178,  -642,  -642,  -642,
-    -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,
-    -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,
-    -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,
-    -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,  -642,
-    -642,  -642,  -642,  -642,  1004,  -642,  1008,   918,  1007,   496,
-     877,  -642,   879,   918,  1010,  1013,   881,   918,  -642,   882,
-    -642,  -642,  -642,   918,  -642
+     987,   988,   989,   990,   991,   992,   823,   419,  -647,  -647,
+    -647,   430,   920,   998,  -647,  -647,   999,  -647,  1000,  1001,
+    1002,   431,   485,   432,   812,   284,   820,   822,   825,   826,
+     827,   828,   829,   830,   831,   832,   833,   834,   835,   836,
+     837,   838,   839,   840,   841,   843,   844,   845,   846,   847,
+     848,   850,   853,   855,   856,   857,   858,   859,   860,   861,
+     863,   865,   866,   867,   868,   870,   872,   291,  -647,   908,
+    -647,  -647,   920,   818,   873,   874,   440,  -647,   284,  -647,
+    -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,
+    -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,
+    -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,
+    -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,  -647,
+    -647,  -647,  -647,  -647,  -647,  -647,  1006,  -647,  1007,   920,
+    1023,   442,   875,  -647,   876,   920,  1030,  1034,   879,   920,
+    -647,   880,  -647,  -647,  -647,   920,  -647
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1071,129 +1071,129 @@ static const yytype_int16 yypact[] =
 static const yytype_int16 yydefact[] =
 {
      196,     0,     0,     0,     0,     0,     0,     0,   131,     0,
-       0,     0,     0,     0,     0,     0,   196,     0,   410,     3,
+       0,     0,     0,     0,     0,     0,   196,     0,   411,     3,
        5,    10,    12,    13,    11,     6,     7,     9,   145,   144,
-       0,     8,    14,    15,    16,    17,   408,   408,   408,   408,
-     408,     0,   406,   406,   406,   406,   406,   189,     0,     0,
+       0,     8,    14,    15,    16,    17,   409,   409,   409,   409,
+     409,     0,   407,   407,   407,   407,   407,   189,     0,     0,
        0,     0,     0,     0,   125,   129,   126,   127,   128,   130,
-     124,   196,     0,     0,   210,   211,   209,   215,   218,     0,
-       0,     0,   212,     0,   214,     0,   216,     0,   236,   237,
-     238,   240,   239,     0,   195,   197,     0,     0,     0,     1,
-     196,     2,   179,   181,   182,     0,   168,   150,   156,     0,
-       0,     0,     0,     0,     0,     0,   122,     0,     0,     0,
-       0,     0,     0,     0,     0,   174,     0,     0,     0,     0,
-       0,     0,   123,    18,    23,    25,    24,    19,    20,    22,
-      21,    26,    27,    28,    29,   224,   225,   219,   220,     0,
-     221,     0,   213,     0,   257,     0,     0,     0,   149,   148,
-       4,   180,     0,   146,   147,   167,     0,     0,   164,     0,
-      30,     0,    31,   122,   411,     0,     0,   196,   405,   136,
-     138,   137,   139,     0,   190,     0,   174,   133,     0,   118,
-     404,     0,     0,   342,   346,   349,   350,     0,     0,     0,
-       0,     0,     0,     0,     0,   347,   348,     0,     0,     0,
-       0,     0,     0,     0,   344,     0,   196,     0,   258,   263,
-     264,   278,   276,   279,   277,   280,   281,   273,   268,   267,
-     266,   274,   275,   265,   272,   271,   357,   359,     0,   360,
-     368,     0,   369,     0,   361,   358,   379,     0,   380,     0,
-     356,   244,   246,   245,   242,   243,   249,   251,   250,   247,
-     248,   254,   256,   255,   252,   253,     0,     0,   227,   226,
-     232,   222,   223,   217,     0,   198,   241,     0,     0,   170,
-       0,     0,   166,   407,   196,     0,     0,     0,   116,     0,
-       0,   120,     0,     0,     0,   132,   173,     0,     0,     0,
-     388,   387,   390,   389,   392,   391,   394,   393,   396,   395,
-     398,   397,     0,     0,   308,   196,     0,     0,     0,     0,
-     351,   352,   353,   354,     0,   355,     0,     0,     0,     0,
-       0,     0,     0,   310,   309,   385,   382,   376,   366,   371,
-     374,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     124,   196,     0,     0,   210,   211,   209,   216,   219,     0,
+       0,     0,     0,   212,     0,   214,     0,   217,     0,   237,
+     238,   239,   241,   240,     0,   195,   197,     0,     0,     0,
+       1,   196,     2,   179,   181,   182,     0,   168,   150,   156,
+       0,     0,     0,     0,     0,     0,     0,   122,     0,     0,
+       0,     0,     0,     0,     0,     0,   174,     0,     0,     0,
+       0,     0,     0,   123,    18,    23,    25,    24,    19,    20,
+      22,    21,    26,    27,    28,    29,   225,   226,   220,   221,
+       0,   222,     0,   215,   213,     0,   258,     0,     0,     0,
+     149,   148,     4,   180,     0,   146,   147,   167,     0,     0,
+     164,     0,    30,     0,    31,   122,   412,     0,     0,   196,
+     406,   136,   138,   137,   139,     0,   190,     0,   174,   133,
+       0,   118,   405,     0,     0,   343,   347,   350,   351,     0,
+       0,     0,     0,     0,     0,     0,     0,   348,   349,     0,
+       0,     0,     0,     0,     0,     0,   345,     0,   196,     0,
+     259,   264,   265,   279,   277,   280,   278,   281,   282,   274,
+     269,   268,   267,   275,   276,   266,   273,   272,   358,   360,
+       0,   361,   369,     0,   370,     0,   362,   359,   380,     0,
+     381,     0,   357,   245,   247,   246,   243,   244,   250,   252,
+     251,   248,   249,   255,   257,   256,   253,   254,     0,     0,
+     228,   227,   233,   223,   224,   218,     0,   198,   242,     0,
+       0,   170,     0,     0,   166,   408,   196,     0,     0,     0,
+     116,     0,     0,   120,     0,     0,     0,   132,   173,     0,
+       0,     0,   389,   388,   391,   390,   393,   392,   395,   394,
+     397,   396,   399,   398,     0,     0,   309,   196,     0,     0,
+       0,     0,   352,   353,   354,   355,     0,   356,     0,     0,
+       0,     0,     0,     0,     0,   311,   310,   386,   383,   377,
+     367,   372,   375,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   365,     0,   370,     0,
-     373,     0,   381,     0,   384,     0,   233,   228,     0,   153,
-     152,     0,   172,   155,   157,   162,   163,     0,   151,    33,
-       0,     0,     0,     0,    36,    38,    39,   196,     0,    35,
-     121,     0,     0,   119,   140,   135,   134,     0,     0,     0,
-     303,     0,   196,     0,     0,     0,     0,     0,   333,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   270,
-     269,     0,   259,   262,   326,   327,     0,     0,   196,     0,
-     307,   317,   318,   321,   322,     0,   324,   316,   319,   320,
-     312,   311,   313,   314,   315,   343,   345,   367,     0,   372,
-       0,   375,   383,   386,     0,     0,   229,   199,   196,   169,
-     183,   185,   194,   186,     0,   174,     0,   160,   161,   159,
-     165,    42,    45,    46,    43,    44,    47,    48,    62,    49,
-      51,    50,    65,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,     0,     0,     0,     0,     0,   414,     0,
-       0,   416,     0,    34,     0,     0,   117,     0,     0,     0,
-       0,   403,     0,   399,     0,     0,   304,     0,   338,     0,
-       0,   331,     0,     0,     0,     0,     0,     0,   342,     0,
-       0,   291,     0,   293,     0,   378,   377,     0,   196,   325,
-       0,     0,   306,     0,     0,     0,   234,   230,     0,     0,
-       0,   203,   204,   205,   206,   202,   207,     0,   192,     0,
-     187,   297,   295,   298,   296,   299,   300,   301,   171,   178,
-     158,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     109,   110,   113,   106,   113,     0,     0,     0,    32,    37,
-     425,     0,   260,     0,   402,   401,   143,     0,   141,   305,
-     339,     0,   335,     0,   334,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   340,   329,   328,     0,
-       0,   194,   184,     0,     0,   191,     0,     0,   176,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   366,     0,
+     371,     0,   374,     0,   382,     0,   385,     0,   234,   229,
+       0,   153,   152,     0,   172,   155,   157,   162,   163,     0,
+     151,    33,     0,     0,     0,     0,    36,    38,    39,   196,
+       0,    35,   121,     0,     0,   119,   140,   135,   134,     0,
+       0,     0,   304,     0,   196,     0,     0,     0,     0,     0,
+     334,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   271,   270,     0,   260,   263,   327,   328,     0,     0,
+     196,     0,   308,   318,   319,   322,   323,     0,   325,   317,
+     320,   321,   313,   312,   314,   315,   316,   344,   346,   368,
+       0,   373,     0,   376,   384,   387,     0,     0,   230,   199,
+     196,   169,   183,   185,   194,   186,     0,   174,     0,   160,
+     161,   159,   165,    42,    45,    46,    43,    44,    47,    48,
+      62,    49,    51,    50,    65,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,     0,     0,     0,     0,     0,
+     415,     0,     0,   417,     0,    34,     0,     0,   117,     0,
+       0,     0,     0,   404,     0,   400,     0,     0,   305,     0,
+     339,     0,     0,   332,     0,     0,     0,     0,     0,     0,
+     343,     0,     0,   292,     0,   294,     0,   379,   378,     0,
+     196,   326,     0,     0,   307,     0,     0,     0,   235,   231,
+       0,     0,     0,   203,   204,   205,   206,   202,   207,     0,
+     192,     0,   187,   298,   296,   299,   297,   300,   301,   302,
+     171,   178,   158,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   109,   110,   113,   106,   113,     0,     0,     0,
+      32,    37,   426,     0,   261,     0,   403,   402,   143,     0,
+     141,   306,   340,     0,   336,     0,   335,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   341,   330,
+     329,     0,     0,   194,   184,     0,     0,   191,     0,     0,
+     176,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   111,     0,   108,     0,   107,    41,    40,     0,
+     115,     0,     0,     0,     0,   401,   338,   333,   337,   324,
+       0,     0,     0,     0,     0,     0,   363,   365,   364,   293,
+     295,     0,   342,   331,   236,   232,   188,   200,     0,     0,
+     303,     0,     0,   154,    64,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     111,     0,   108,     0,   107,    41,    40,     0,   115,     0,
-       0,     0,     0,   400,   337,   332,   336,   323,     0,     0,
-       0,     0,     0,     0,   362,   364,   363,   292,   294,     0,
-     341,   330,   235,   231,   188,   200,     0,     0,   302,     0,
-       0,   154,    64,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   420,     0,   418,   112,
+     114,     0,   415,     0,   262,   383,     0,   290,     0,     0,
+       0,     0,     0,     0,   177,   175,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   419,     0,   417,   112,   114,     0,
-     414,     0,   261,   382,     0,   289,     0,     0,     0,     0,
-       0,     0,   177,   175,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   413,     0,   415,   423,
-     414,     0,     0,     0,     0,   142,   201,   193,    63,    69,
-      70,    67,    68,    71,    72,    73,    66,    93,    94,    91,
-      92,    95,    96,    97,    90,    77,    78,    75,    76,    79,
-      80,    81,    74,   101,   102,    99,   100,   103,   104,   105,
-      98,    85,    86,    83,    84,    87,    88,    89,    82,   420,
-     422,   421,   418,   424,     0,   290,     0,   414,     0,     0,
-     283,   288,     0,   414,     0,     0,     0,   414,   286,     0,
-     282,   284,   287,   414,   285
+       0,     0,     0,     0,     0,     0,     0,     0,   414,     0,
+     416,   424,   415,     0,     0,     0,     0,   142,   201,   193,
+      63,    69,    70,    67,    68,    71,    72,    73,    66,    93,
+      94,    91,    92,    95,    96,    97,    90,    77,    78,    75,
+      76,    79,    80,    81,    74,   101,   102,    99,   100,   103,
+     104,   105,    98,    85,    86,    83,    84,    87,    88,    89,
+      82,   421,   423,   422,   419,   425,     0,   291,     0,   415,
+       0,     0,   284,   289,     0,   415,     0,     0,     0,   415,
+     287,     0,   283,   285,   288,   415,   286
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -642,  -642,  -642,   928,  -642,   959,  -642,   530,  -642,   525,
-    -642,   437,   455,  -642,  -382,   994,  1001,   895,  -642,  -642,
-    1002,  -642,   780,  1009,  1011,   -57,  1044,   -15,   807,   922,
-     -44,  -642,  -642,   607,  -642,  -642,  -642,  -642,  -642,  -642,
-    -168,  -642,  -642,  -642,  -642,   526,  -274,    23,   456,  -642,
-    -642,   930,  -642,  -642,  1017,  1018,  1019,  1020,  1021,  -154,
-    -642,   781,  -178,  -180,  -642,  -451,  -445,  -439,  -431,  -416,
-    -415,   457,  -642,  -642,  -642,  -642,  -642,  -642,   782,  -642,
-    -642,   670,   413,  -202,  -642,  -642,  -642,   475,  -642,  -642,
-    -642,  -642,   477,   783,   784,  -125,  -642,  -642,  -642,  -642,
-     891,  -389,   492,  -112,   405,   454,  -642,  -642,  -641,  -642,
-     414,   274,  -642
+    -647,  -647,  -647,   948,  -647,   995,  -647,   537,  -647,   528,
+    -647,   467,   472,  -647,  -384,  1008,  1009,   903,  -647,  -647,
+    1010,  -647,   786,  1012,  1013,   -57,  1045,   -15,   796,   921,
+     -67,  -647,  -647,   608,  -647,  -647,  -647,  -647,  -647,  -647,
+    -169,  -647,  -647,  -647,  -647,   526,    22,    28,   456,  -647,
+    -647,   930,  -647,  -647,  1019,  1020,  1021,  1022,  1024,  -156,
+    -647,   787,  -180,  -182,  -647,  -451,  -450,  -449,  -442,  -441,
+    -439,   460,  -647,  -647,  -647,  -647,  -647,  -647,   788,  -647,
+    -647,   668,   411,  -204,  -647,  -647,  -647,   477,  -647,  -647,
+    -647,  -647,   478,   789,   790,  -183,  -647,  -647,  -647,  -647,
+     888,  -392,   492,  -113,   333,   434,  -647,  -647,  -646,  -647,
+     412,   273,  -647
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-       0,    17,    18,    19,   122,    20,   383,   384,   385,   498,
-     582,   583,   675,   386,   279,    21,    22,   167,    23,    61,
-      24,   176,   177,    25,    26,    27,    28,    29,    97,   153,
-      98,   158,   373,   374,   469,   272,   378,   156,   372,   465,
-     179,   711,   628,    95,   459,   460,   461,   462,   560,    30,
-      84,    85,   463,   557,    31,    32,    33,    34,    35,   207,
-     393,   208,   209,   210,   886,   211,   212,   213,   214,   215,
-     216,   567,   568,   217,   218,   219,   220,   221,   309,   222,
-     223,   224,   225,   226,   693,   227,   228,   229,   230,   231,
-     232,   233,   234,   329,   330,   235,   236,   237,   238,   239,
-     240,   512,   513,   181,   108,   100,    91,   105,   584,   588,
-     755,   756,   389
+       0,    17,    18,    19,   123,    20,   385,   386,   387,   500,
+     584,   585,   677,   388,   281,    21,    22,   169,    23,    61,
+      24,   178,   179,    25,    26,    27,    28,    29,    98,   155,
+      99,   160,   375,   376,   471,   274,   380,   158,   374,   467,
+     181,   713,   630,    96,   461,   462,   463,   464,   562,    30,
+      85,    86,   465,   559,    31,    32,    33,    34,    35,   209,
+     395,   210,   211,   212,   888,   213,   214,   215,   216,   217,
+     218,   569,   570,   219,   220,   221,   222,   223,   311,   224,
+     225,   226,   227,   228,   695,   229,   230,   231,   232,   233,
+     234,   235,   236,   331,   332,   237,   238,   239,   240,   241,
+     242,   514,   515,   183,   109,   101,    92,   106,   586,   590,
+     757,   758,   391
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1201,240 +1201,242 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     286,    88,   269,   328,   129,   182,   504,   304,   285,   514,
-      47,    96,   308,   561,   184,   185,   186,   325,   326,   562,
-     325,   326,   323,   324,   445,   563,   178,    48,   332,    50,
-    -409,   528,    14,   564,   380,   266,    82,     1,   371,     2,
-       3,     4,     5,     6,     7,     8,     9,   274,   565,   566,
-     558,   154,   604,    10,   335,    11,    12,    13,    92,    41,
-      93,   426,    94,   280,   106,   356,   241,    49,   242,   243,
-     357,     1,   115,     2,     3,     4,     5,     6,     7,     8,
-       9,   246,   333,   247,   248,   334,   136,    10,    47,    11,
-      12,    13,   375,   376,   390,    77,   251,   391,   252,   253,
-     144,  -412,   429,    81,   559,   395,   467,   468,   268,    14,
-      14,    99,   191,   192,   193,   194,   336,   337,   586,   819,
-     116,   117,   304,   591,   161,   162,   163,   244,   405,   406,
-     519,    83,   170,   171,   172,   401,   427,    86,    16,   195,
-     196,   197,   249,   685,    14,   307,   336,   337,   284,   355,
-     334,   609,   281,   430,   381,   447,   382,   254,   424,   425,
-      89,   431,   432,   433,   434,   435,   436,   437,   438,   439,
-     440,   441,   442,   443,   444,   561,   275,   455,   456,   873,
-     358,   562,   520,   336,   337,   359,    99,   563,   277,   152,
-      90,   331,    15,   458,   205,   564,   205,   327,   501,   470,
-     327,   502,   446,   677,   605,   336,   337,   336,   337,   204,
-     565,   566,   183,   184,   185,   186,    16,   379,   138,   139,
-     336,   337,   336,   337,   245,   621,    15,   577,   118,   336,
-     337,   523,   524,    96,   526,   360,   881,   530,   507,   250,
-     361,   107,   888,   336,   337,   515,   892,   539,   340,   113,
-      16,   114,   894,     1,   255,     2,     3,     4,     5,     6,
-       7,   607,     9,   119,   403,   336,   337,  -413,  -413,    10,
-     610,    11,    12,    13,   541,   579,   399,   580,   581,   137,
-     673,   577,   362,   120,   187,   188,   578,   363,   375,   364,
-     404,   140,   141,   189,   365,   190,   121,   569,  -413,  -413,
-     350,   351,   352,   353,   354,   394,    78,    79,    80,   537,
-     769,   191,   192,   193,   194,   869,   340,   870,   871,   183,
-     184,   185,   186,   336,   337,   771,    14,   336,   337,   579,
-     503,   580,   581,   341,   342,   343,   344,   135,   195,   196,
-     197,   346,   602,   142,   603,   606,    36,    37,    38,   705,
-     706,    51,    52,   183,   184,   185,   186,    53,    39,    40,
-     198,   420,   143,   618,   145,   347,   348,   349,   350,   351,
-     352,   353,   354,    42,    43,    44,   687,   146,    92,   199,
-      93,   200,    94,   201,   615,    45,    46,   517,   202,   203,
-     204,   187,   188,   205,   256,   206,   400,   147,   257,   258,
-     189,   548,   190,   259,   260,   307,   516,   691,    15,   334,
-     148,   149,   317,   540,   318,   319,   320,   151,   191,   192,
-     193,   194,   352,   353,   354,   187,   188,   686,   535,   536,
-      14,   408,    16,   409,   189,   410,   190,   155,   521,   682,
-     522,   531,   410,   157,   532,   195,   196,   197,   109,   110,
-     111,   112,   191,   192,   193,   194,   403,   630,   631,   632,
-     633,   634,   159,   533,   635,   636,   534,   198,   183,   184,
-     185,   186,   199,   160,   200,   590,   201,   164,   391,   195,
-     196,   197,   689,   166,   637,   696,   199,   168,   200,   165,
-     201,   101,   102,   103,   104,   202,   203,   204,   325,   763,
-     205,   198,   206,   169,   183,   184,   185,   186,   340,   173,
-     638,   639,   640,   641,   642,   174,   592,   643,   644,   334,
-     199,   175,   200,   614,   201,   341,   342,   343,   344,   202,
-     203,   204,   773,   346,   205,   596,   206,   645,   597,   180,
-     187,   188,    54,    55,    56,    57,    58,    59,   261,   189,
-      60,   190,   509,   510,   511,   772,   178,   347,   348,   349,
-     350,   351,   352,   353,   354,   262,   263,   191,   192,   193,
-     194,   646,   647,   648,   649,   650,   302,   303,   651,   652,
-     598,   599,   270,   597,   334,   189,   617,   190,   264,   334,
-     273,   338,   826,   339,   195,   196,   197,   678,   653,   681,
-     391,   271,   391,   191,   192,   193,   194,   183,   184,   185,
-     186,   654,   655,   656,   657,   658,   198,   701,   659,   660,
-     334,   712,   758,   278,   713,   391,    62,    63,   282,    64,
-     195,   196,   197,   762,   283,   199,   334,   200,   661,   201,
-     310,    65,    66,   340,   202,   203,   204,   765,   287,   205,
-     766,   206,   198,   816,   818,   825,   817,   817,   597,   288,
-     341,   342,   343,   344,   345,   311,   827,   289,   346,   391,
-     305,   199,   306,   200,   877,   201,   312,   878,   313,   302,
-     202,   203,   204,   883,   314,   205,   884,   206,   189,   316,
-     190,   321,   347,   348,   349,   350,   351,   352,   353,   354,
-     366,   322,   367,   377,   387,   355,   191,   192,   193,   194,
-     662,   663,   664,   665,   666,   369,   370,   667,   668,   388,
-     392,    14,   397,   403,   550,  -208,   551,   552,   553,   554,
-     398,   555,   556,   195,   196,   197,   402,   669,   290,   291,
-     292,   293,   294,   295,   296,   297,   298,   299,   300,   301,
-     411,   412,    67,    68,    69,   198,    70,    71,   413,   414,
-     415,    72,    73,    74,   416,   417,   418,   419,   421,    75,
-      76,   423,   428,   205,   199,   340,   200,   448,   201,   450,
-     452,   453,   454,   202,   203,   204,   340,   457,   205,   466,
-     206,   464,   341,   342,   343,   344,   500,   543,   505,   499,
-     346,   506,   427,  -413,  -413,   343,   344,   508,   518,   525,
-     527,  -413,   336,   538,   542,   544,   545,   546,   547,   549,
-     571,   572,   587,   573,   347,   348,   349,   350,   351,   352,
-     353,   354,   574,   594,   595,  -413,   348,   349,   350,   351,
-     352,   353,   354,   471,   472,   473,   474,   475,   476,   477,
-     478,   479,   480,   481,   482,   483,   484,   485,   486,   487,
-     488,   489,   490,   491,   600,   575,   492,   576,   585,   493,
-     494,   593,   611,   495,   496,   497,   608,   612,   616,   613,
-     536,   535,   620,   619,   623,   624,   625,   627,   626,   670,
-     629,   671,   673,   672,   679,   680,   684,   688,   690,   692,
-     709,   697,   702,   698,   699,   703,   700,   707,   710,   754,
-     714,   760,   715,   716,   717,   718,   719,   720,   721,   722,
-     723,   770,   724,   725,   726,   727,   774,   775,   728,   729,
-     730,   731,   732,   733,   734,   735,   761,   736,   737,   738,
-     739,   740,   741,   776,   742,   743,   744,   745,   746,   747,
-     777,   778,   748,   779,   780,   749,   750,   751,   781,   782,
-     752,   783,   753,   784,   785,   764,   786,   767,   787,   768,
-     788,   789,   790,   791,   792,   793,   794,   795,   796,   797,
+     288,    89,   271,   330,   130,   184,   506,   306,   516,   287,
+      97,    47,   310,   447,   530,   563,   564,   565,   327,   328,
+     276,   382,   325,   326,   566,   567,   180,   568,   334,   156,
+     373,    14,    48,   282,    50,  -410,   268,   327,   328,   428,
+     560,    83,     1,   309,     2,     3,     4,     5,     6,     7,
+       8,     9,   337,    93,    49,    94,   606,    95,    10,   579,
+      11,    12,    13,   338,   339,    47,   431,   117,   118,   107,
+     338,   339,   243,   358,   244,   245,   360,   116,   359,    14,
+    -413,   361,    41,   186,   187,   188,   248,   270,   249,   250,
+     100,   137,   377,   378,   561,   253,   335,   254,   255,   336,
+     357,   422,   611,   338,   339,   397,   146,   581,   521,   582,
+     583,   609,   675,    82,   429,    14,   821,   432,   588,    78,
+     338,   339,   306,   593,   185,   186,   187,   188,   407,   408,
+     163,   164,   165,   246,    84,   403,    87,    16,   172,   173,
+     174,   383,   336,   384,   338,   339,    90,   251,   286,   277,
+     469,   470,   522,    91,   283,   449,   256,   392,   426,   427,
+     393,   433,   434,   435,   436,   437,   438,   439,   440,   441,
+     442,   443,   444,   445,   446,   119,   875,   563,   564,   565,
+      97,   193,   194,   195,   196,   362,   566,   567,   154,   568,
+     363,   448,   206,   333,   460,   279,   304,    15,   329,   472,
+     338,   339,   687,   679,   100,   191,   364,   192,   197,   198,
+     199,   365,   108,   338,   339,   607,   207,   329,   114,   381,
+     623,    16,   115,   193,   194,   195,   196,   338,   339,   120,
+     247,   525,   526,   883,   528,   579,   121,   532,   509,   890,
+     580,   366,   138,   894,   252,   517,   367,   541,   143,   896,
+     197,   198,   199,   257,   185,   186,   187,   188,   338,   339,
+      93,   122,    94,   207,    95,   136,   338,   339,    36,    37,
+      38,   410,   200,   411,   543,   412,   338,   339,    51,    52,
+      39,    40,   144,   581,    53,   582,   583,   503,   377,   405,
+     504,   201,   406,   202,   871,   203,   872,   873,   571,   612,
+     204,   205,   206,   145,   523,   207,   524,   208,   412,   771,
+     539,   147,   396,   632,   633,   634,   635,   636,   401,   258,
+     637,   638,   148,   259,   260,   773,   189,   190,   261,   262,
+     518,   149,   505,   336,   201,   191,   202,   192,   203,   150,
+     639,   342,   604,   533,   605,   608,   534,   153,   535,    62,
+      63,   536,    64,   193,   194,   195,   196,   151,   343,   344,
+     345,   346,   157,   620,    65,    66,   348,   159,   185,   186,
+     187,   188,   161,    42,    43,    44,   110,   111,   112,   113,
+     197,   198,   199,   162,   617,    45,    46,   139,   140,   519,
+     349,   350,   351,   352,   353,   354,   355,   356,    79,    80,
+      81,   689,   200,   550,   166,   592,   167,   693,   393,   640,
+     641,   642,   643,   644,   168,   542,   645,   646,   171,   594,
+     180,   201,   336,   202,   170,   203,   691,   688,   175,   698,
+     204,   205,   206,   338,   339,   207,   647,   208,   402,   684,
+     189,   190,    54,    55,    56,    57,    58,    59,   176,   191,
+      60,   192,   598,   600,   309,   599,   599,   185,   186,   187,
+     188,   177,   319,   182,   320,   321,   322,   193,   194,   195,
+     196,   102,   103,   104,   105,    67,    68,    69,   263,    70,
+      71,   141,   142,    72,    73,    74,    75,   264,   185,   186,
+     187,   188,    76,    77,   197,   198,   199,   552,  -208,   553,
+     554,   555,   556,   601,   557,   558,   336,   266,     1,   265,
+       2,     3,     4,     5,     6,     7,   200,     9,   619,   680,
+     272,   336,   393,   273,    10,   616,    11,    12,    13,   189,
+     190,   275,   775,   683,    14,   201,   393,   202,   191,   203,
+     192,   354,   355,   356,   204,   205,   206,   342,   280,   207,
+     703,   208,   284,   336,   285,   774,   193,   194,   195,   196,
+     189,   190,   457,   458,  -414,  -414,   345,   346,   291,   191,
+     289,   192,  -414,   185,   186,   187,   188,   714,   290,   760,
+     715,    14,   393,   197,   198,   199,   307,   193,   194,   195,
+     196,   764,   828,   312,   336,   308,  -414,   350,   351,   352,
+     353,   354,   355,   356,   767,   200,   818,   768,   340,   819,
+     341,   511,   512,   513,   197,   198,   199,   820,   827,   829,
+     819,   599,   393,   313,   201,   357,   202,   879,   203,   885,
+     880,   314,   886,   204,   205,   206,   200,   316,   207,   315,
+     208,   537,   538,   327,   765,   304,   305,   707,   708,   318,
+     323,   368,   324,   369,   191,   201,   192,   202,   371,   203,
+     342,   372,   379,    15,   204,   205,   206,   389,   390,   207,
+      14,   208,   193,   194,   195,   196,   413,   343,   344,   345,
+     346,   347,   394,   399,   418,   348,     1,    16,     2,     3,
+       4,     5,     6,     7,     8,     9,   405,   400,   404,   197,
+     198,   199,    10,   414,    11,    12,    13,   415,   405,   349,
+     350,   351,   352,   353,   354,   355,   356,   416,   417,   419,
+     420,   200,   421,   423,   425,   648,   649,   650,   651,   652,
+     430,   207,   653,   654,   450,   452,   454,   455,   342,   456,
+     201,   459,   202,   466,   203,   468,   501,   502,   342,   204,
+     205,   206,   655,   507,   207,   508,   208,  -414,  -414,    14,
+     342,   510,   520,   527,   429,   343,   344,   345,   346,   529,
+     545,   540,   338,   348,   546,   544,   548,   343,   344,   345,
+     346,   549,   573,   547,   551,   348,   574,   575,  -414,  -414,
+     352,   353,   354,   355,   356,   576,   596,   349,   350,   351,
+     352,   353,   354,   355,   356,   589,   577,   597,   610,   349,
+     350,   351,   352,   353,   354,   355,   356,   473,   474,   475,
+     476,   477,   478,   479,   480,   481,   482,   483,   484,   485,
+     486,   487,   488,   489,   490,   491,   492,   493,   578,   587,
+     494,    15,   595,   495,   496,   602,   613,   497,   498,   499,
+     656,   657,   658,   659,   660,   614,   615,   661,   662,   664,
+     665,   666,   667,   668,   618,    16,   669,   670,   538,   537,
+     621,   622,   625,   626,   627,   631,   628,   663,   629,   672,
+     673,   674,   675,   681,   682,   686,   671,   292,   293,   294,
+     295,   296,   297,   298,   299,   300,   301,   302,   303,   692,
+     690,   694,   704,   705,   711,   699,   700,   702,   701,   709,
+     712,   756,   762,   776,   716,   717,   772,   777,   778,   779,
+     780,   718,   781,   719,   720,   721,   722,   723,   724,   725,
+     726,   727,   728,   729,   730,   731,   732,   733,   734,   735,
+     736,   737,   763,   782,   783,   784,   738,   785,   739,   786,
+     740,   741,   742,   743,   744,   787,   745,   746,   788,   747,
+     789,   748,   749,   750,   751,   790,   791,   792,   752,   753,
+     754,   755,   766,   769,   793,   770,   794,   795,   796,   797,
      798,   799,   800,   801,   802,   803,   804,   805,   806,   807,
-     808,   809,   810,   811,   812,   813,   814,   815,   578,   820,
-     334,   821,   822,   823,   824,   828,   829,   830,   879,   831,
-     832,   833,   880,   882,   834,   835,   889,   890,   150,   674,
-     123,   836,   837,   838,   839,   840,   841,   842,   843,   844,
-     845,   846,   589,   847,   848,   849,   850,   851,   852,   676,
-     853,   854,   855,   856,   601,   857,   858,   859,   860,   861,
-     862,   863,   864,   865,   866,   124,   867,   868,   276,   875,
-      87,   874,   125,   126,   396,   876,   887,   885,   891,   893,
-     127,   368,   128,   570,   267,   622,   265,   704,   130,   131,
-     132,   133,   134,   708,   529,   694,   757,   695,   315,   683,
-     407,   872,     0,   759,     0,     0,     0,     0,     0,     0,
+     808,   809,   810,   811,   812,   813,   814,   815,   816,   817,
+     580,   822,   336,   823,   824,   825,   826,   830,   876,   831,
+     881,   882,   832,   833,   834,   835,   836,   837,   838,   839,
+     840,   841,   842,   843,   844,   845,   846,   847,   848,   884,
+     849,   850,   851,   852,   853,   854,   891,   855,   892,   152,
+     856,   591,   857,   858,   859,   860,   861,   862,   863,   603,
+     864,   676,   865,   866,   867,   868,   124,   869,   678,   870,
+     877,    88,   370,   889,   878,   887,   893,   895,   278,   125,
+     126,   127,   398,   128,   129,   269,   572,   624,   267,   706,
+     131,   132,   133,   134,   531,   135,   759,   317,   710,   696,
+     697,   685,   874,   761,     0,     0,     0,     0,   409,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   422,     0,     0,     0,     0,
+       0,     0,     0,   424,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   449,     0,     0,   451
+     451,     0,     0,   453
 };
 
 static const yytype_int16 yycheck[] =
 {
-     178,    16,   156,   205,    61,   117,   388,   187,   176,   398,
-       3,     8,   190,   464,     4,     5,     6,     5,     6,   464,
-       5,     6,   202,   203,     3,   464,    68,     4,   206,     6,
-       0,     3,    80,   464,     3,   147,    13,     7,    78,     9,
-      10,    11,    12,    13,    14,    15,    16,    57,   464,   464,
-       3,    95,    85,    23,    57,    25,    26,    27,    20,    33,
-      22,    77,    24,    34,    41,   185,     3,    78,     5,     6,
-     190,     7,    49,     9,    10,    11,    12,    13,    14,    15,
-      16,     3,   187,     5,     6,   190,    63,    23,     3,    25,
-      26,    27,   270,   271,   187,    30,     3,   190,     5,     6,
-      77,    64,    75,     3,    57,   283,    72,    73,   152,    80,
-      80,    74,   102,   103,   104,   105,   149,   150,   500,   760,
-      78,    79,   302,   505,   101,   102,   103,    64,   306,   307,
-      57,     3,   109,   110,   111,   289,   152,   163,   186,   129,
-     130,   131,    64,    85,    80,    89,   149,   150,   190,   188,
-     190,   190,   167,   126,   123,   357,   125,    64,   336,   337,
-       0,   341,   342,   343,   344,   345,   346,   347,   348,   349,
-     350,   351,   352,   353,   354,   626,   186,    48,    49,   820,
-     185,   626,    88,   149,   150,   190,    74,   626,   165,   186,
-     189,   206,   162,   186,   184,   626,   184,   185,   187,   377,
-     185,   190,   181,   585,    88,   149,   150,   149,   150,   181,
-     626,   626,     3,     4,     5,     6,   186,   274,   167,   168,
-     149,   150,   149,   150,   161,   187,   162,    75,   186,   149,
-     150,   409,   410,     8,   412,   185,   877,   415,   392,   161,
-     190,    74,   883,   149,   150,   399,   887,   427,   127,   188,
-     186,    14,   893,     7,   161,     9,    10,    11,    12,    13,
-      14,   190,    16,     3,    75,   149,   150,   146,   147,    23,
-     190,    25,    26,    27,   428,   123,    67,   125,   126,     6,
-     128,    75,   185,     3,    75,    76,    80,   190,   466,   185,
-     305,   167,   168,    84,   190,    86,     3,   465,   177,   178,
-     179,   180,   181,   182,   183,   282,   153,   154,   155,   421,
-     699,   102,   103,   104,   105,     3,   127,     5,     6,     3,
-       4,     5,     6,   149,   150,   707,    80,   149,   150,   123,
-     387,   125,   126,   144,   145,   146,   147,     3,   129,   130,
-     131,   152,   520,     3,   522,   525,    29,    30,    31,   623,
-     624,   159,   160,     3,     4,     5,     6,   165,    41,    42,
-     151,   187,   159,   543,    57,   176,   177,   178,   179,   180,
-     181,   182,   183,    29,    30,    31,   187,   190,    20,   170,
-      22,   172,    24,   174,   538,    41,    42,   402,   179,   180,
-     181,    75,    76,   184,    42,   186,   187,     6,    46,    47,
-      84,   458,    86,    51,    52,    89,   187,   609,   162,   190,
-     187,   187,   117,   428,   119,   120,   121,    21,   102,   103,
-     104,   105,   181,   182,   183,    75,    76,   605,     5,     6,
-      80,    85,   186,    87,    84,    89,    86,    67,    85,   593,
-      87,   187,    89,    69,   190,   129,   130,   131,    43,    44,
-      45,    46,   102,   103,   104,   105,    75,    91,    92,    93,
-      94,    95,    75,   187,    98,    99,   190,   151,     3,     4,
-       5,     6,   170,     3,   172,   187,   174,     3,   190,   129,
-     130,   131,   607,   186,   118,   610,   170,    76,   172,    64,
-     174,    37,    38,    39,    40,   179,   180,   181,     5,     6,
-     184,   151,   186,     3,     3,     4,     5,     6,   127,     3,
-      91,    92,    93,    94,    95,     3,   187,    98,    99,   190,
-     170,     3,   172,   538,   174,   144,   145,   146,   147,   179,
-     180,   181,   710,   152,   184,   187,   186,   118,   190,     4,
+     180,    16,   158,   207,    61,   118,   390,   189,   400,   178,
+       8,     3,   192,     3,     3,   466,   466,   466,     5,     6,
+      57,     3,   204,   205,   466,   466,    68,   466,   208,    96,
+      78,    80,     4,    34,     6,     0,   149,     5,     6,    77,
+       3,    13,     7,    89,     9,    10,    11,    12,    13,    14,
+      15,    16,    57,    20,    78,    22,    85,    24,    23,    75,
+      25,    26,    27,   149,   150,     3,    75,    78,    79,    41,
+     149,   150,     3,   185,     5,     6,   185,    49,   190,    80,
+      64,   190,    33,     4,     5,     6,     3,   154,     5,     6,
+      74,    63,   272,   273,    57,     3,   187,     5,     6,   190,
+     188,   187,   190,   149,   150,   285,    78,   123,    57,   125,
+     126,   190,   128,     3,   152,    80,   762,   126,   502,    30,
+     149,   150,   304,   507,     3,     4,     5,     6,   308,   309,
+     102,   103,   104,    64,     3,   291,   163,   186,   110,   111,
+     112,   123,   190,   125,   149,   150,     0,    64,   190,   186,
+      72,    73,    88,   189,   169,   359,    64,   187,   338,   339,
+     190,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   186,   822,   628,   628,   628,
+       8,   102,   103,   104,   105,   185,   628,   628,   186,   628,
+     190,   181,   181,   208,   186,   167,    75,   162,   185,   379,
+     149,   150,    85,   587,    74,    84,   185,    86,   129,   130,
+     131,   190,    74,   149,   150,    88,   184,   185,   188,   276,
+     187,   186,    14,   102,   103,   104,   105,   149,   150,     3,
+     161,   411,   412,   879,   414,    75,     3,   417,   394,   885,
+      80,   185,     6,   889,   161,   401,   190,   429,     6,   895,
+     129,   130,   131,   161,     3,     4,     5,     6,   149,   150,
+      20,     3,    22,   184,    24,     3,   149,   150,    29,    30,
+      31,    85,   151,    87,   430,    89,   149,   150,   159,   160,
+      41,    42,     3,   123,   165,   125,   126,   187,   468,    75,
+     190,   170,   307,   172,     3,   174,     5,     6,   467,   190,
+     179,   180,   181,   159,    85,   184,    87,   186,    89,   701,
+     423,    57,   284,    91,    92,    93,    94,    95,    67,    42,
+      98,    99,   190,    46,    47,   709,    75,    76,    51,    52,
+     187,     6,   389,   190,   170,    84,   172,    86,   174,   187,
+     118,   127,   522,   187,   524,   527,   190,    21,   187,    29,
+      30,   190,    32,   102,   103,   104,   105,   187,   144,   145,
+     146,   147,    67,   545,    44,    45,   152,    69,     3,     4,
+       5,     6,    75,    29,    30,    31,    43,    44,    45,    46,
+     129,   130,   131,     3,   540,    41,    42,   167,   168,   404,
+     176,   177,   178,   179,   180,   181,   182,   183,   153,   154,
+     155,   187,   151,   460,     3,   187,    64,   611,   190,    91,
+      92,    93,    94,    95,   186,   430,    98,    99,     3,   187,
+      68,   170,   190,   172,    76,   174,   609,   607,     3,   612,
+     179,   180,   181,   149,   150,   184,   118,   186,   187,   595,
       75,    76,    35,    36,    37,    38,    39,    40,     3,    84,
-      43,    86,    81,    82,    83,   709,    68,   176,   177,   178,
-     179,   180,   181,   182,   183,     3,     6,   102,   103,   104,
-     105,    91,    92,    93,    94,    95,    75,    76,    98,    99,
-     187,   187,    55,   190,   190,    84,   187,    86,   186,   190,
-      76,    75,   770,    77,   129,   130,   131,   187,   118,   187,
-     190,    70,   190,   102,   103,   104,   105,     3,     4,     5,
-       6,    91,    92,    93,    94,    95,   151,   187,    98,    99,
-     190,   187,   187,     3,   190,   190,    29,    30,    64,    32,
-     129,   130,   131,   187,   176,   170,   190,   172,   118,   174,
-       4,    44,    45,   127,   179,   180,   181,   187,    80,   184,
-     190,   186,   151,   187,   187,   187,   190,   190,   190,    80,
-     144,   145,   146,   147,   148,     4,   187,   186,   152,   190,
-     186,   170,   186,   172,   187,   174,     4,   190,     4,    75,
-     179,   180,   181,   187,     6,   184,   190,   186,    84,   186,
-      86,   186,   176,   177,   178,   179,   180,   181,   182,   183,
-       3,   186,     6,    71,    57,   188,   102,   103,   104,   105,
-      91,    92,    93,    94,    95,   187,   187,    98,    99,   186,
-     186,    80,   186,    75,    58,    59,    60,    61,    62,    63,
-     186,    65,    66,   129,   130,   131,   186,   118,   132,   133,
-     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
-       4,   186,   155,   156,   157,   151,   159,   160,   186,   186,
-     186,   164,   165,   166,     4,     4,   191,   187,    79,   172,
-     173,     3,   186,   184,   170,   127,   172,     6,   174,     6,
-       6,     5,    46,   179,   180,   181,   127,   187,   184,   190,
-     186,   169,   144,   145,   146,   147,   186,   149,   186,   124,
-     152,     3,   152,   144,   145,   146,   147,   190,   187,    78,
-       4,   152,   149,   186,   126,   191,   191,     6,     6,   190,
-     186,   186,    28,   186,   176,   177,   178,   179,   180,   181,
-     182,   183,   186,     4,     3,   176,   177,   178,   179,   180,
-     181,   182,   183,    90,    91,    92,    93,    94,    95,    96,
-      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
-     107,   108,   109,   110,   187,   186,   113,   186,   186,   116,
-     117,   186,     4,   120,   121,   122,   190,     4,   187,    80,
-       6,     5,    50,    53,    59,    59,     3,    54,   190,   126,
-       6,   186,   128,   124,   186,   158,   187,   184,     4,   184,
-      55,   187,     6,   187,   186,     6,   187,   186,    56,     3,
-     190,     3,   190,   190,   190,   190,   190,   190,   190,   190,
-     190,    64,   190,   190,   190,   190,     6,     6,   190,   190,
-     190,   190,   190,   190,   190,   190,   158,   190,   190,   190,
-     190,   190,   190,     6,   190,   190,   190,   190,   190,   190,
-       6,     6,   190,     6,     6,   190,   190,   190,     6,     6,
-     190,     6,   190,     6,     6,   190,     6,   190,     6,   190,
-       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+      43,    86,   187,   187,    89,   190,   190,     3,     4,     5,
+       6,     3,   117,     4,   119,   120,   121,   102,   103,   104,
+     105,    37,    38,    39,    40,   155,   156,   157,     3,   159,
+     160,   167,   168,   163,   164,   165,   166,     3,     3,     4,
+       5,     6,   172,   173,   129,   130,   131,    58,    59,    60,
+      61,    62,    63,   187,    65,    66,   190,   186,     7,     6,
+       9,    10,    11,    12,    13,    14,   151,    16,   187,   187,
+      55,   190,   190,    70,    23,   540,    25,    26,    27,    75,
+      76,    76,   712,   187,    80,   170,   190,   172,    84,   174,
+      86,   181,   182,   183,   179,   180,   181,   127,     3,   184,
+     187,   186,    64,   190,   176,   711,   102,   103,   104,   105,
+      75,    76,    48,    49,   144,   145,   146,   147,   186,    84,
+      80,    86,   152,     3,     4,     5,     6,   187,    80,   187,
+     190,    80,   190,   129,   130,   131,   186,   102,   103,   104,
+     105,   187,   772,     4,   190,   186,   176,   177,   178,   179,
+     180,   181,   182,   183,   187,   151,   187,   190,    75,   190,
+      77,    81,    82,    83,   129,   130,   131,   187,   187,   187,
+     190,   190,   190,     4,   170,   188,   172,   187,   174,   187,
+     190,     4,   190,   179,   180,   181,   151,     6,   184,     4,
+     186,     5,     6,     5,     6,    75,    76,   625,   626,   186,
+     186,     3,   186,     6,    84,   170,    86,   172,   187,   174,
+     127,   187,    71,   162,   179,   180,   181,    57,   186,   184,
+      80,   186,   102,   103,   104,   105,     4,   144,   145,   146,
+     147,   148,   186,   186,     4,   152,     7,   186,     9,    10,
+      11,    12,    13,    14,    15,    16,    75,   186,   186,   129,
+     130,   131,    23,   186,    25,    26,    27,   186,    75,   176,
+     177,   178,   179,   180,   181,   182,   183,   186,   186,     4,
+     191,   151,   187,    79,     3,    91,    92,    93,    94,    95,
+     186,   184,    98,    99,     6,     6,     6,     5,   127,    46,
+     170,   187,   172,   169,   174,   190,   124,   186,   127,   179,
+     180,   181,   118,   186,   184,     3,   186,   146,   147,    80,
+     127,   190,   187,    78,   152,   144,   145,   146,   147,     4,
+     149,   186,   149,   152,   191,   126,     6,   144,   145,   146,
+     147,     6,   186,   191,   190,   152,   186,   186,   177,   178,
+     179,   180,   181,   182,   183,   186,     4,   176,   177,   178,
+     179,   180,   181,   182,   183,    28,   186,     3,   190,   176,
+     177,   178,   179,   180,   181,   182,   183,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   186,   186,
+     113,   162,   186,   116,   117,   187,     4,   120,   121,   122,
+      91,    92,    93,    94,    95,     4,    80,    98,    99,    91,
+      92,    93,    94,    95,   187,   186,    98,    99,     6,     5,
+      53,    50,    59,    59,     3,     6,   190,   118,    54,   126,
+     186,   124,   128,   186,   158,   187,   118,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,     4,
+     184,   184,     6,     6,    55,   187,   187,   187,   186,   186,
+      56,     3,     3,     6,   190,   190,    64,     6,     6,     6,
+       6,   190,     6,   190,   190,   190,   190,   190,   190,   190,
+     190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
+     190,   190,   158,     6,     6,     6,   190,     6,   190,     6,
+     190,   190,   190,   190,   190,     6,   190,   190,     6,   190,
+       6,   190,   190,   190,   190,     6,     6,     6,   190,   190,
+     190,   190,   190,   190,     6,   190,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,     6,     6,   176,    80,     3,
-     190,     4,     4,     4,     4,   187,   187,   187,     4,   187,
-     187,   187,     4,     6,   187,   187,     6,     4,    90,   582,
-      61,   187,   187,   187,   187,   187,   187,   187,   187,   187,
-     187,   187,   502,   187,   187,   187,   187,   187,   187,   584,
-     187,   187,   187,   187,   519,   187,   187,   187,   187,   187,
-     187,   187,   187,   187,   187,    61,   187,   187,   163,   187,
-      16,   190,    61,    61,   284,   190,   187,   190,   187,   187,
-      61,   264,    61,   466,   152,   549,   146,   621,    61,    61,
-      61,    61,    61,   626,   414,   610,   673,   610,   197,   597,
-     308,   817,    -1,   679,    -1,    -1,    -1,    -1,    -1,    -1,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,   176,
+      80,     3,   190,     4,     4,     4,     4,   187,   190,   187,
+       4,     4,   187,   187,   187,   187,   187,   187,   187,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   187,     6,
+     187,   187,   187,   187,   187,   187,     6,   187,     4,    91,
+     187,   504,   187,   187,   187,   187,   187,   187,   187,   521,
+     187,   584,   187,   187,   187,   187,    61,   187,   586,   187,
+     187,    16,   266,   187,   190,   190,   187,   187,   165,    61,
+      61,    61,   286,    61,    61,   154,   468,   551,   148,   623,
+      61,    61,    61,    61,   416,    61,   675,   199,   628,   612,
+     612,   599,   819,   681,    -1,    -1,    -1,    -1,   310,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   334,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   336,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   359,    -1,    -1,   361
+     361,    -1,    -1,   363
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1448,89 +1450,89 @@ static const yytype_int16 yystos[] =
       42,    33,    29,    30,    31,    41,    42,     3,   239,    78,
      239,   159,   160,   165,    35,    36,    37,    38,    39,    40,
       43,   211,    29,    30,    32,    44,    45,   155,   156,   157,
-     159,   160,   164,   165,   166,   172,   173,    30,   153,   154,
-     155,     3,   239,     3,   242,   243,   163,   218,   219,     0,
-     189,   298,    20,    22,    24,   235,     8,   220,   222,    74,
-     297,   297,   297,   297,   297,   299,   239,    74,   296,   296,
-     296,   296,   296,   188,    14,   239,    78,    79,   186,     3,
-       3,     3,   196,   197,   207,   208,   212,   215,   216,   217,
-     246,   247,   248,   249,   250,     3,   239,     6,   167,   168,
-     167,   168,     3,   159,   239,    57,   190,     6,   187,   187,
-     195,    21,   186,   221,   222,    67,   229,    69,   223,    75,
-       3,   239,   239,   239,     3,    64,   186,   209,    76,     3,
-     239,   239,   239,     3,     3,     3,   213,   214,    68,   232,
-       4,   295,   295,     3,     4,     5,     6,    75,    76,    84,
-      86,   102,   103,   104,   105,   129,   130,   131,   151,   170,
-     172,   174,   179,   180,   181,   184,   186,   251,   253,   254,
-     255,   257,   258,   259,   260,   261,   262,   265,   266,   267,
-     268,   269,   271,   272,   273,   274,   275,   277,   278,   279,
-     280,   281,   282,   283,   284,   287,   288,   289,   290,   291,
-     292,     3,     5,     6,    64,   161,     3,     5,     6,    64,
-     161,     3,     5,     6,    64,   161,    42,    46,    47,    51,
-      52,     3,     3,     6,   186,   243,   295,   221,   222,   251,
-      55,    70,   227,    76,    57,   186,   209,   239,     3,   206,
-      34,   219,    64,   176,   190,   232,   254,    80,    80,   186,
-     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
-     142,   143,    75,    76,   255,   186,   186,    89,   254,   270,
-       4,     4,     4,     4,     6,   292,   186,   117,   119,   120,
-     121,   186,   186,   255,   255,     5,     6,   185,   275,   285,
-     286,   219,   254,   187,   190,    57,   149,   150,    75,    77,
-     127,   144,   145,   146,   147,   148,   152,   176,   177,   178,
-     179,   180,   181,   182,   183,   188,   185,   190,   185,   190,
-     185,   190,   185,   190,   185,   190,     3,     6,   220,   187,
-     187,    78,   230,   224,   225,   254,   254,    71,   228,   217,
-       3,   123,   125,   198,   199,   200,   205,    57,   186,   304,
-     187,   190,   186,   252,   239,   254,   214,   186,   186,    67,
-     187,   251,   186,    75,   219,   254,   254,   270,    85,    87,
-      89,     4,   186,   186,   186,   186,     4,     4,   191,   187,
-     187,    79,   253,     3,   254,   254,    77,   152,   186,    75,
-     126,   255,   255,   255,   255,   255,   255,   255,   255,   255,
-     255,   255,   255,   255,   255,     3,   181,   275,     6,   285,
-       6,   286,     6,     5,    46,    48,    49,   187,   186,   236,
-     237,   238,   239,   244,   169,   231,   190,    72,    73,   226,
-     254,    90,    91,    92,    93,    94,    95,    96,    97,    98,
-      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   113,   116,   117,   120,   121,   122,   201,   124,
-     186,   187,   190,   217,   206,   186,     3,   251,   190,    81,
-      82,    83,   293,   294,   293,   251,   187,   219,   187,    57,
-      88,    85,    87,   254,   254,    78,   254,     4,     3,   273,
-     254,   187,   190,   187,   190,     5,     6,   295,   186,   255,
-     219,   251,   126,   149,   191,   191,     6,     6,   217,   190,
-      58,    60,    61,    62,    63,    65,    66,   245,     3,    57,
-     240,   257,   258,   259,   260,   261,   262,   263,   264,   232,
-     225,   186,   186,   186,   186,   186,   186,    75,    80,   123,
-     125,   126,   202,   203,   300,   186,   206,    28,   301,   199,
-     187,   206,   187,   186,     4,     3,   187,   190,   187,   187,
-     187,   201,   254,   254,    85,    88,   255,   190,   190,   190,
-     190,     4,     4,    80,   219,   251,   187,   187,   255,    53,
-      50,   187,   237,    59,    59,     3,   190,    54,   234,     6,
+     159,   160,   163,   164,   165,   166,   172,   173,    30,   153,
+     154,   155,     3,   239,     3,   242,   243,   163,   218,   219,
+       0,   189,   298,    20,    22,    24,   235,     8,   220,   222,
+      74,   297,   297,   297,   297,   297,   299,   239,    74,   296,
+     296,   296,   296,   296,   188,    14,   239,    78,    79,   186,
+       3,     3,     3,   196,   197,   207,   208,   212,   215,   216,
+     217,   246,   247,   248,   249,   250,     3,   239,     6,   167,
+     168,   167,   168,     6,     3,   159,   239,    57,   190,     6,
+     187,   187,   195,    21,   186,   221,   222,    67,   229,    69,
+     223,    75,     3,   239,   239,   239,     3,    64,   186,   209,
+      76,     3,   239,   239,   239,     3,     3,     3,   213,   214,
+      68,   232,     4,   295,   295,     3,     4,     5,     6,    75,
+      76,    84,    86,   102,   103,   104,   105,   129,   130,   131,
+     151,   170,   172,   174,   179,   180,   181,   184,   186,   251,
+     253,   254,   255,   257,   258,   259,   260,   261,   262,   265,
+     266,   267,   268,   269,   271,   272,   273,   274,   275,   277,
+     278,   279,   280,   281,   282,   283,   284,   287,   288,   289,
+     290,   291,   292,     3,     5,     6,    64,   161,     3,     5,
+       6,    64,   161,     3,     5,     6,    64,   161,    42,    46,
+      47,    51,    52,     3,     3,     6,   186,   243,   295,   221,
+     222,   251,    55,    70,   227,    76,    57,   186,   209,   239,
+       3,   206,    34,   219,    64,   176,   190,   232,   254,    80,
+      80,   186,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,    75,    76,   255,   186,   186,    89,
+     254,   270,     4,     4,     4,     4,     6,   292,   186,   117,
+     119,   120,   121,   186,   186,   255,   255,     5,     6,   185,
+     275,   285,   286,   219,   254,   187,   190,    57,   149,   150,
+      75,    77,   127,   144,   145,   146,   147,   148,   152,   176,
+     177,   178,   179,   180,   181,   182,   183,   188,   185,   190,
+     185,   190,   185,   190,   185,   190,   185,   190,     3,     6,
+     220,   187,   187,    78,   230,   224,   225,   254,   254,    71,
+     228,   217,     3,   123,   125,   198,   199,   200,   205,    57,
+     186,   304,   187,   190,   186,   252,   239,   254,   214,   186,
+     186,    67,   187,   251,   186,    75,   219,   254,   254,   270,
+      85,    87,    89,     4,   186,   186,   186,   186,     4,     4,
+     191,   187,   187,    79,   253,     3,   254,   254,    77,   152,
+     186,    75,   126,   255,   255,   255,   255,   255,   255,   255,
+     255,   255,   255,   255,   255,   255,   255,     3,   181,   275,
+       6,   285,     6,   286,     6,     5,    46,    48,    49,   187,
+     186,   236,   237,   238,   239,   244,   169,   231,   190,    72,
+      73,   226,   254,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   113,   116,   117,   120,   121,   122,
+     201,   124,   186,   187,   190,   217,   206,   186,     3,   251,
+     190,    81,    82,    83,   293,   294,   293,   251,   187,   219,
+     187,    57,    88,    85,    87,   254,   254,    78,   254,     4,
+       3,   273,   254,   187,   190,   187,   190,     5,     6,   295,
+     186,   255,   219,   251,   126,   149,   191,   191,     6,     6,
+     217,   190,    58,    60,    61,    62,    63,    65,    66,   245,
+       3,    57,   240,   257,   258,   259,   260,   261,   262,   263,
+     264,   232,   225,   186,   186,   186,   186,   186,   186,    75,
+      80,   123,   125,   126,   202,   203,   300,   186,   206,    28,
+     301,   199,   187,   206,   187,   186,     4,     3,   187,   190,
+     187,   187,   187,   201,   254,   254,    85,    88,   255,   190,
+     190,   190,   190,     4,     4,    80,   219,   251,   187,   187,
+     255,    53,    50,   187,   237,    59,    59,     3,   190,    54,
+     234,     6,    91,    92,    93,    94,    95,    98,    99,   118,
       91,    92,    93,    94,    95,    98,    99,   118,    91,    92,
       93,    94,    95,    98,    99,   118,    91,    92,    93,    94,
       95,    98,    99,   118,    91,    92,    93,    94,    95,    98,
-      99,   118,    91,    92,    93,    94,    95,    98,    99,   118,
-     126,   186,   124,   128,   203,   204,   204,   206,   187,   186,
-     158,   187,   251,   294,   187,    85,   254,   187,   184,   287,
-       4,   275,   184,   276,   279,   284,   287,   187,   187,   186,
-     187,   187,     6,     6,   240,   238,   238,   186,   263,    55,
-      56,   233,   187,   190,   190,   190,   190,   190,   190,   190,
+      99,   118,   126,   186,   124,   128,   203,   204,   204,   206,
+     187,   186,   158,   187,   251,   294,   187,    85,   254,   187,
+     184,   287,     4,   275,   184,   276,   279,   284,   287,   187,
+     187,   186,   187,   187,     6,     6,   240,   238,   238,   186,
+     263,    55,    56,   233,   187,   190,   190,   190,   190,   190,
      190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
      190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
      190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
-     190,   190,   190,   190,     3,   302,   303,   274,   187,   302,
-       3,   158,   187,     6,   190,   187,   190,   190,   190,   293,
-      64,   206,   251,   254,     6,     6,     6,     6,     6,     6,
+     190,   190,   190,   190,   190,   190,     3,   302,   303,   274,
+     187,   302,     3,   158,   187,     6,   190,   187,   190,   190,
+     190,   293,    64,   206,   251,   254,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,   176,   187,   190,   187,   300,
-       3,     4,     4,     4,     4,   187,   254,   187,   187,   187,
+       6,     6,     6,     6,     6,     6,     6,   176,   187,   190,
+     187,   300,     3,     4,     4,     4,     4,   187,   254,   187,
      187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
      187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
      187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
-     187,   187,   187,   187,   187,   187,   187,   187,   187,     3,
-       5,     6,   303,   300,   190,   187,   190,   187,   190,     4,
-       4,   300,     6,   187,   190,   190,   256,   187,   300,     6,
-       4,   187,   300,   187,   300
+     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
+     187,     3,     5,     6,   303,   300,   190,   187,   190,   187,
+     190,     4,     4,   300,     6,   187,   190,   190,   256,   187,
+     300,     6,     4,   187,   300,   187,   300
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
@@ -1559,26 +1561,26 @@ static const yytype_int16 yyr1[] =
      244,   244,   245,   245,   245,   245,   245,   245,   245,   246,
      246,   246,   246,   246,   246,   246,   246,   246,   246,   246,
      246,   246,   246,   246,   246,   246,   246,   246,   246,   246,
-     246,   246,   246,   246,   246,   246,   247,   247,   247,   248,
-     249,   249,   249,   249,   249,   249,   249,   249,   249,   249,
-     249,   249,   249,   249,   249,   249,   249,   250,   251,   251,
-     252,   252,   253,   253,   254,   254,   254,   254,   254,   255,
+     246,   246,   246,   246,   246,   246,   246,   247,   247,   247,
+     248,   249,   249,   249,   249,   249,   249,   249,   249,   249,
+     249,   249,   249,   249,   249,   249,   249,   249,   250,   251,
+     251,   252,   252,   253,   253,   254,   254,   254,   254,   254,
      255,   255,   255,   255,   255,   255,   255,   255,   255,   255,
-     255,   255,   256,   256,   257,   258,   258,   259,   259,   260,
-     260,   261,   261,   262,   262,   263,   263,   263,   263,   263,
-     263,   264,   264,   265,   265,   265,   265,   265,   265,   265,
+     255,   255,   255,   256,   256,   257,   258,   258,   259,   259,
+     260,   260,   261,   261,   262,   262,   263,   263,   263,   263,
+     263,   263,   264,   264,   265,   265,   265,   265,   265,   265,
      265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
-     265,   265,   265,   265,   265,   265,   266,   266,   267,   268,
-     268,   269,   269,   269,   269,   270,   270,   271,   272,   272,
-     272,   272,   273,   273,   273,   273,   274,   274,   274,   274,
-     274,   274,   274,   274,   274,   274,   274,   274,   275,   275,
-     275,   275,   276,   276,   276,   277,   278,   278,   279,   279,
-     280,   281,   281,   282,   283,   283,   284,   285,   286,   287,
-     287,   288,   289,   289,   290,   291,   291,   292,   292,   292,
-     292,   292,   292,   292,   292,   292,   292,   292,   292,   293,
-     293,   294,   294,   294,   295,   296,   296,   297,   297,   298,
-     298,   299,   299,   300,   300,   301,   301,   302,   302,   303,
-     303,   303,   303,   304,   304,   304
+     265,   265,   265,   265,   265,   265,   265,   266,   266,   267,
+     268,   268,   269,   269,   269,   269,   270,   270,   271,   272,
+     272,   272,   272,   273,   273,   273,   273,   274,   274,   274,
+     274,   274,   274,   274,   274,   274,   274,   274,   274,   275,
+     275,   275,   275,   276,   276,   276,   277,   278,   278,   279,
+     279,   280,   281,   281,   282,   283,   283,   284,   285,   286,
+     287,   287,   288,   289,   289,   290,   291,   291,   292,   292,
+     292,   292,   292,   292,   292,   292,   292,   292,   292,   292,
+     293,   293,   294,   294,   294,   295,   296,   296,   297,   297,
+     298,   298,   299,   299,   300,   300,   301,   301,   302,   302,
+     303,   303,   303,   303,   304,   304,   304
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1605,28 +1607,28 @@ static const yytype_int8 yyr2[] =
        2,     1,     1,     1,     3,     1,     1,     2,     4,     1,
        3,     2,     1,     5,     0,     2,     0,     1,     3,     5,
        4,     6,     1,     1,     1,     1,     1,     1,     0,     2,
-       2,     2,     2,     3,     2,     2,     2,     4,     2,     3,
-       3,     3,     4,     4,     3,     3,     4,     4,     5,     6,
-       7,     9,     4,     5,     7,     9,     2,     2,     2,     2,
-       2,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     3,     1,     3,
-       3,     5,     3,     1,     1,     1,     1,     1,     1,     3,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     2,     0,    12,    14,    12,    12,    10,     7,
-       9,     4,     6,     4,     6,     1,     1,     1,     1,     1,
-       1,     1,     3,     3,     4,     5,     4,     3,     2,     2,
-       2,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     6,     3,     4,     3,     3,     5,     5,
-       6,     4,     6,     3,     5,     4,     5,     6,     4,     5,
-       5,     6,     1,     3,     1,     3,     1,     1,     1,     1,
-       1,     2,     2,     2,     2,     2,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     2,     2,     3,     1,     1,
-       2,     2,     3,     2,     2,     3,     2,     3,     3,     1,
-       1,     2,     2,     3,     2,     2,     3,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     1,
-       3,     2,     2,     1,     1,     2,     0,     3,     0,     1,
-       0,     2,     0,     4,     0,     4,     0,     1,     3,     1,
-       3,     3,     3,     6,     7,     3
+       2,     2,     2,     3,     2,     3,     2,     2,     4,     2,
+       3,     3,     3,     4,     4,     3,     3,     4,     4,     5,
+       6,     7,     9,     4,     5,     7,     9,     2,     2,     2,
+       2,     2,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     3,     1,
+       3,     3,     5,     3,     1,     1,     1,     1,     1,     1,
+       3,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     0,    12,    14,    12,    12,    10,
+       7,     9,     4,     6,     4,     6,     1,     1,     1,     1,
+       1,     1,     1,     3,     3,     4,     5,     4,     3,     2,
+       2,     2,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     6,     3,     4,     3,     3,     5,
+       5,     6,     4,     6,     3,     5,     4,     5,     6,     4,
+       5,     5,     6,     1,     3,     1,     3,     1,     1,     1,
+       1,     1,     2,     2,     2,     2,     2,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     2,     3,     1,
+       1,     2,     2,     3,     2,     2,     3,     2,     3,     3,
+       1,     1,     2,     2,     3,     2,     2,     3,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       1,     3,     2,     2,     1,     1,     2,     0,     3,     0,
+       1,     0,     2,     0,     4,     0,     4,     0,     1,     3,
+       1,     3,     3,     3,     6,     7,     3
 };
 
 
@@ -2194,7 +2196,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2198 "parser.cpp"
+#line 2200 "parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
@@ -2202,7 +2204,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2206 "parser.cpp"
+#line 2208 "parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
@@ -2216,7 +2218,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).stmt_array));
     }
 }
-#line 2220 "parser.cpp"
+#line 2222 "parser.cpp"
         break;
 
     case YYSYMBOL_table_element_array: /* table_element_array  */
@@ -2230,7 +2232,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_element_array_t));
     }
 }
-#line 2234 "parser.cpp"
+#line 2236 "parser.cpp"
         break;
 
     case YYSYMBOL_column_constraints: /* column_constraints  */
@@ -2241,7 +2243,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).column_constraints_t));
     }
 }
-#line 2245 "parser.cpp"
+#line 2247 "parser.cpp"
         break;
 
     case YYSYMBOL_default_expr: /* default_expr  */
@@ -2249,7 +2251,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2253 "parser.cpp"
+#line 2255 "parser.cpp"
         break;
 
     case YYSYMBOL_identifier_array: /* identifier_array  */
@@ -2258,7 +2260,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2262 "parser.cpp"
+#line 2264 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_identifier_array: /* optional_identifier_array  */
@@ -2267,7 +2269,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2271 "parser.cpp"
+#line 2273 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr_array: /* update_expr_array  */
@@ -2281,7 +2283,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).update_expr_array_t));
     }
 }
-#line 2285 "parser.cpp"
+#line 2287 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr: /* update_expr  */
@@ -2292,7 +2294,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).update_expr_t);
     }
 }
-#line 2296 "parser.cpp"
+#line 2298 "parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
@@ -2302,7 +2304,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2306 "parser.cpp"
+#line 2308 "parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
@@ -2312,7 +2314,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2316 "parser.cpp"
+#line 2318 "parser.cpp"
         break;
 
     case YYSYMBOL_select_without_paren: /* select_without_paren  */
@@ -2322,7 +2324,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2326 "parser.cpp"
+#line 2328 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_with_modifier: /* select_clause_with_modifier  */
@@ -2332,7 +2334,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2336 "parser.cpp"
+#line 2338 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier_paren: /* select_clause_without_modifier_paren  */
@@ -2342,7 +2344,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2346 "parser.cpp"
+#line 2348 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier: /* select_clause_without_modifier  */
@@ -2352,7 +2354,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2356 "parser.cpp"
+#line 2358 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_clause: /* order_by_clause  */
@@ -2366,7 +2368,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2370 "parser.cpp"
+#line 2372 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr_list: /* order_by_expr_list  */
@@ -2380,7 +2382,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2384 "parser.cpp"
+#line 2386 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr: /* order_by_expr  */
@@ -2390,7 +2392,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).order_by_expr_t)->expr_;
     delete ((*yyvaluep).order_by_expr_t);
 }
-#line 2394 "parser.cpp"
+#line 2396 "parser.cpp"
         break;
 
     case YYSYMBOL_limit_expr: /* limit_expr  */
@@ -2398,7 +2400,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2402 "parser.cpp"
+#line 2404 "parser.cpp"
         break;
 
     case YYSYMBOL_offset_expr: /* offset_expr  */
@@ -2406,7 +2408,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2410 "parser.cpp"
+#line 2412 "parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
@@ -2415,7 +2417,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2419 "parser.cpp"
+#line 2421 "parser.cpp"
         break;
 
     case YYSYMBOL_search_clause: /* search_clause  */
@@ -2423,7 +2425,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2427 "parser.cpp"
+#line 2429 "parser.cpp"
         break;
 
     case YYSYMBOL_where_clause: /* where_clause  */
@@ -2431,7 +2433,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2435 "parser.cpp"
+#line 2437 "parser.cpp"
         break;
 
     case YYSYMBOL_having_clause: /* having_clause  */
@@ -2439,7 +2441,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2443 "parser.cpp"
+#line 2445 "parser.cpp"
         break;
 
     case YYSYMBOL_group_by_clause: /* group_by_clause  */
@@ -2453,7 +2455,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2457 "parser.cpp"
+#line 2459 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference: /* table_reference  */
@@ -2462,7 +2464,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2466 "parser.cpp"
+#line 2468 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_unit: /* table_reference_unit  */
@@ -2471,7 +2473,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2475 "parser.cpp"
+#line 2477 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_name: /* table_reference_name  */
@@ -2480,7 +2482,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2484 "parser.cpp"
+#line 2486 "parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
@@ -2493,7 +2495,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_name_t));
     }
 }
-#line 2497 "parser.cpp"
+#line 2499 "parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
@@ -2502,7 +2504,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table alias\n");
     delete (((*yyvaluep).table_alias_t));
 }
-#line 2506 "parser.cpp"
+#line 2508 "parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
@@ -2516,7 +2518,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2520 "parser.cpp"
+#line 2522 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr_list: /* with_expr_list  */
@@ -2530,7 +2532,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2534 "parser.cpp"
+#line 2536 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr: /* with_expr  */
@@ -2540,7 +2542,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).with_expr_t)->select_;
     delete ((*yyvaluep).with_expr_t);
 }
-#line 2544 "parser.cpp"
+#line 2546 "parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
@@ -2549,7 +2551,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2553 "parser.cpp"
+#line 2555 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array: /* expr_array  */
@@ -2563,7 +2565,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2567 "parser.cpp"
+#line 2569 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array_list: /* expr_array_list  */
@@ -2580,7 +2582,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_list_t));
     }
 }
-#line 2584 "parser.cpp"
+#line 2586 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
@@ -2588,7 +2590,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2592 "parser.cpp"
+#line 2594 "parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
@@ -2596,7 +2598,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2600 "parser.cpp"
+#line 2602 "parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
@@ -2604,7 +2606,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2608 "parser.cpp"
+#line 2610 "parser.cpp"
         break;
 
     case YYSYMBOL_extra_match_tensor_option: /* extra_match_tensor_option  */
@@ -2612,7 +2614,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2616 "parser.cpp"
+#line 2618 "parser.cpp"
         break;
 
     case YYSYMBOL_match_tensor_expr: /* match_tensor_expr  */
@@ -2620,7 +2622,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2624 "parser.cpp"
+#line 2626 "parser.cpp"
         break;
 
     case YYSYMBOL_match_vector_expr: /* match_vector_expr  */
@@ -2628,7 +2630,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2632 "parser.cpp"
+#line 2634 "parser.cpp"
         break;
 
     case YYSYMBOL_match_sparse_expr: /* match_sparse_expr  */
@@ -2636,7 +2638,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2640 "parser.cpp"
+#line 2642 "parser.cpp"
         break;
 
     case YYSYMBOL_match_text_expr: /* match_text_expr  */
@@ -2644,7 +2646,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2648 "parser.cpp"
+#line 2650 "parser.cpp"
         break;
 
     case YYSYMBOL_query_expr: /* query_expr  */
@@ -2652,7 +2654,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2656 "parser.cpp"
+#line 2658 "parser.cpp"
         break;
 
     case YYSYMBOL_fusion_expr: /* fusion_expr  */
@@ -2660,7 +2662,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2664 "parser.cpp"
+#line 2666 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search: /* sub_search  */
@@ -2668,7 +2670,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2672 "parser.cpp"
+#line 2674 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search_array: /* sub_search_array  */
@@ -2682,7 +2684,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2686 "parser.cpp"
+#line 2688 "parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
@@ -2690,7 +2692,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2694 "parser.cpp"
+#line 2696 "parser.cpp"
         break;
 
     case YYSYMBOL_conjunction_expr: /* conjunction_expr  */
@@ -2698,7 +2700,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2702 "parser.cpp"
+#line 2704 "parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
@@ -2706,7 +2708,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2710 "parser.cpp"
+#line 2712 "parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
@@ -2714,7 +2716,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2718 "parser.cpp"
+#line 2720 "parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
@@ -2722,7 +2724,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2726 "parser.cpp"
+#line 2728 "parser.cpp"
         break;
 
     case YYSYMBOL_case_check_array: /* case_check_array  */
@@ -2735,7 +2737,7 @@ yydestruct (const char *yymsg,
         }
     }
 }
-#line 2739 "parser.cpp"
+#line 2741 "parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
@@ -2743,7 +2745,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2747 "parser.cpp"
+#line 2749 "parser.cpp"
         break;
 
     case YYSYMBOL_subquery_expr: /* subquery_expr  */
@@ -2751,7 +2753,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2755 "parser.cpp"
+#line 2757 "parser.cpp"
         break;
 
     case YYSYMBOL_column_expr: /* column_expr  */
@@ -2759,7 +2761,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2763 "parser.cpp"
+#line 2765 "parser.cpp"
         break;
 
     case YYSYMBOL_constant_expr: /* constant_expr  */
@@ -2767,7 +2769,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2771 "parser.cpp"
+#line 2773 "parser.cpp"
         break;
 
     case YYSYMBOL_common_array_expr: /* common_array_expr  */
@@ -2775,7 +2777,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2779 "parser.cpp"
+#line 2781 "parser.cpp"
         break;
 
     case YYSYMBOL_common_sparse_array_expr: /* common_sparse_array_expr  */
@@ -2783,7 +2785,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2787 "parser.cpp"
+#line 2789 "parser.cpp"
         break;
 
     case YYSYMBOL_subarray_array_expr: /* subarray_array_expr  */
@@ -2791,7 +2793,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2795 "parser.cpp"
+#line 2797 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_subarray_array_expr: /* unclosed_subarray_array_expr  */
@@ -2799,7 +2801,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2803 "parser.cpp"
+#line 2805 "parser.cpp"
         break;
 
     case YYSYMBOL_sparse_array_expr: /* sparse_array_expr  */
@@ -2807,7 +2809,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2811 "parser.cpp"
+#line 2813 "parser.cpp"
         break;
 
     case YYSYMBOL_long_sparse_array_expr: /* long_sparse_array_expr  */
@@ -2815,7 +2817,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2819 "parser.cpp"
+#line 2821 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_sparse_array_expr: /* unclosed_long_sparse_array_expr  */
@@ -2823,7 +2825,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2827 "parser.cpp"
+#line 2829 "parser.cpp"
         break;
 
     case YYSYMBOL_double_sparse_array_expr: /* double_sparse_array_expr  */
@@ -2831,7 +2833,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2835 "parser.cpp"
+#line 2837 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_sparse_array_expr: /* unclosed_double_sparse_array_expr  */
@@ -2839,7 +2841,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2843 "parser.cpp"
+#line 2845 "parser.cpp"
         break;
 
     case YYSYMBOL_empty_array_expr: /* empty_array_expr  */
@@ -2847,7 +2849,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2851 "parser.cpp"
+#line 2853 "parser.cpp"
         break;
 
     case YYSYMBOL_int_sparse_ele: /* int_sparse_ele  */
@@ -2855,7 +2857,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).int_sparse_ele_t));
 }
-#line 2859 "parser.cpp"
+#line 2861 "parser.cpp"
         break;
 
     case YYSYMBOL_float_sparse_ele: /* float_sparse_ele  */
@@ -2863,7 +2865,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).float_sparse_ele_t));
 }
-#line 2867 "parser.cpp"
+#line 2869 "parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
@@ -2871,7 +2873,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2875 "parser.cpp"
+#line 2877 "parser.cpp"
         break;
 
     case YYSYMBOL_long_array_expr: /* long_array_expr  */
@@ -2879,7 +2881,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2883 "parser.cpp"
+#line 2885 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_array_expr: /* unclosed_long_array_expr  */
@@ -2887,7 +2889,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2891 "parser.cpp"
+#line 2893 "parser.cpp"
         break;
 
     case YYSYMBOL_double_array_expr: /* double_array_expr  */
@@ -2895,7 +2897,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2899 "parser.cpp"
+#line 2901 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_array_expr: /* unclosed_double_array_expr  */
@@ -2903,7 +2905,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2907 "parser.cpp"
+#line 2909 "parser.cpp"
         break;
 
     case YYSYMBOL_interval_expr: /* interval_expr  */
@@ -2911,7 +2913,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2915 "parser.cpp"
+#line 2917 "parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
@@ -2919,7 +2921,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2923 "parser.cpp"
+#line 2925 "parser.cpp"
         break;
 
     case YYSYMBOL_if_not_exists_info: /* if_not_exists_info  */
@@ -2930,7 +2932,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).if_not_exists_info_t));
     }
 }
-#line 2934 "parser.cpp"
+#line 2936 "parser.cpp"
         break;
 
     case YYSYMBOL_with_index_param_list: /* with_index_param_list  */
@@ -2944,7 +2946,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2948 "parser.cpp"
+#line 2950 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_table_properties_list: /* optional_table_properties_list  */
@@ -2958,7 +2960,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2962 "parser.cpp"
+#line 2964 "parser.cpp"
         break;
 
     case YYSYMBOL_index_info_list: /* index_info_list  */
@@ -2972,7 +2974,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).index_info_list_t));
     }
 }
-#line 2976 "parser.cpp"
+#line 2978 "parser.cpp"
         break;
 
       default:
@@ -3080,7 +3082,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 3084 "parser.cpp"
+#line 3086 "parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -3295,7 +3297,7 @@ yyreduce:
                                          {
     result->statements_ptr_ = (yyvsp[-1].stmt_array);
 }
-#line 3299 "parser.cpp"
+#line 3301 "parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
@@ -3306,7 +3308,7 @@ yyreduce:
     (yyval.stmt_array) = new std::vector<infinity::BaseStatement*>();
     (yyval.stmt_array)->push_back((yyvsp[0].base_stmt));
 }
-#line 3310 "parser.cpp"
+#line 3312 "parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
@@ -3317,157 +3319,157 @@ yyreduce:
     (yyvsp[-2].stmt_array)->push_back((yyvsp[0].base_stmt));
     (yyval.stmt_array) = (yyvsp[-2].stmt_array);
 }
-#line 3321 "parser.cpp"
+#line 3323 "parser.cpp"
     break;
 
   case 5: /* statement: create_statement  */
 #line 509 "parser.y"
                              { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3327 "parser.cpp"
+#line 3329 "parser.cpp"
     break;
 
   case 6: /* statement: drop_statement  */
 #line 510 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3333 "parser.cpp"
+#line 3335 "parser.cpp"
     break;
 
   case 7: /* statement: copy_statement  */
 #line 511 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3339 "parser.cpp"
+#line 3341 "parser.cpp"
     break;
 
   case 8: /* statement: show_statement  */
 #line 512 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3345 "parser.cpp"
+#line 3347 "parser.cpp"
     break;
 
   case 9: /* statement: select_statement  */
 #line 513 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3351 "parser.cpp"
+#line 3353 "parser.cpp"
     break;
 
   case 10: /* statement: delete_statement  */
 #line 514 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3357 "parser.cpp"
+#line 3359 "parser.cpp"
     break;
 
   case 11: /* statement: update_statement  */
 #line 515 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3363 "parser.cpp"
+#line 3365 "parser.cpp"
     break;
 
   case 12: /* statement: insert_statement  */
 #line 516 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3369 "parser.cpp"
+#line 3371 "parser.cpp"
     break;
 
   case 13: /* statement: explain_statement  */
 #line 517 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].explain_stmt); }
-#line 3375 "parser.cpp"
+#line 3377 "parser.cpp"
     break;
 
   case 14: /* statement: flush_statement  */
 #line 518 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3381 "parser.cpp"
+#line 3383 "parser.cpp"
     break;
 
   case 15: /* statement: optimize_statement  */
 #line 519 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3387 "parser.cpp"
+#line 3389 "parser.cpp"
     break;
 
   case 16: /* statement: command_statement  */
 #line 520 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3393 "parser.cpp"
+#line 3395 "parser.cpp"
     break;
 
   case 17: /* statement: compact_statement  */
 #line 521 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3399 "parser.cpp"
+#line 3401 "parser.cpp"
     break;
 
   case 18: /* explainable_statement: create_statement  */
 #line 523 "parser.y"
                                          { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3405 "parser.cpp"
+#line 3407 "parser.cpp"
     break;
 
   case 19: /* explainable_statement: drop_statement  */
 #line 524 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3411 "parser.cpp"
+#line 3413 "parser.cpp"
     break;
 
   case 20: /* explainable_statement: copy_statement  */
 #line 525 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3417 "parser.cpp"
+#line 3419 "parser.cpp"
     break;
 
   case 21: /* explainable_statement: show_statement  */
 #line 526 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3423 "parser.cpp"
+#line 3425 "parser.cpp"
     break;
 
   case 22: /* explainable_statement: select_statement  */
 #line 527 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3429 "parser.cpp"
+#line 3431 "parser.cpp"
     break;
 
   case 23: /* explainable_statement: delete_statement  */
 #line 528 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3435 "parser.cpp"
+#line 3437 "parser.cpp"
     break;
 
   case 24: /* explainable_statement: update_statement  */
 #line 529 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3441 "parser.cpp"
+#line 3443 "parser.cpp"
     break;
 
   case 25: /* explainable_statement: insert_statement  */
 #line 530 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3447 "parser.cpp"
+#line 3449 "parser.cpp"
     break;
 
   case 26: /* explainable_statement: flush_statement  */
 #line 531 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3453 "parser.cpp"
+#line 3455 "parser.cpp"
     break;
 
   case 27: /* explainable_statement: optimize_statement  */
 #line 532 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3459 "parser.cpp"
+#line 3461 "parser.cpp"
     break;
 
   case 28: /* explainable_statement: command_statement  */
 #line 533 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3465 "parser.cpp"
+#line 3467 "parser.cpp"
     break;
 
   case 29: /* explainable_statement: compact_statement  */
 #line 534 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3471 "parser.cpp"
+#line 3473 "parser.cpp"
     break;
 
   case 30: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
@@ -3487,7 +3489,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_schema_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3491 "parser.cpp"
+#line 3493 "parser.cpp"
     break;
 
   case 31: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
@@ -3505,7 +3507,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3509 "parser.cpp"
+#line 3511 "parser.cpp"
     break;
 
   case 32: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')' optional_table_properties_list  */
@@ -3538,7 +3540,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_table_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-5].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3542 "parser.cpp"
+#line 3544 "parser.cpp"
     break;
 
   case 33: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
@@ -3558,7 +3560,7 @@ yyreduce:
     create_table_info->select_ = (yyvsp[0].select_stmt);
     (yyval.create_stmt)->create_info_ = create_table_info;
 }
-#line 3562 "parser.cpp"
+#line 3564 "parser.cpp"
     break;
 
   case 34: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
@@ -3579,7 +3581,7 @@ yyreduce:
     create_view_info->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     (yyval.create_stmt)->create_info_ = create_view_info;
 }
-#line 3583 "parser.cpp"
+#line 3585 "parser.cpp"
     break;
 
   case 35: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info_list  */
@@ -3612,7 +3614,7 @@ yyreduce:
     (yyval.create_stmt) = new infinity::CreateStatement();
     (yyval.create_stmt)->create_info_ = create_index_info;
 }
-#line 3616 "parser.cpp"
+#line 3618 "parser.cpp"
     break;
 
   case 36: /* table_element_array: table_element  */
@@ -3621,7 +3623,7 @@ yyreduce:
     (yyval.table_element_array_t) = new std::vector<infinity::TableElement*>();
     (yyval.table_element_array_t)->push_back((yyvsp[0].table_element_t));
 }
-#line 3625 "parser.cpp"
+#line 3627 "parser.cpp"
     break;
 
   case 37: /* table_element_array: table_element_array ',' table_element  */
@@ -3630,7 +3632,7 @@ yyreduce:
     (yyvsp[-2].table_element_array_t)->push_back((yyvsp[0].table_element_t));
     (yyval.table_element_array_t) = (yyvsp[-2].table_element_array_t);
 }
-#line 3634 "parser.cpp"
+#line 3636 "parser.cpp"
     break;
 
   case 38: /* table_element: table_column  */
@@ -3638,7 +3640,7 @@ yyreduce:
                              {
     (yyval.table_element_t) = (yyvsp[0].table_column_t);
 }
-#line 3642 "parser.cpp"
+#line 3644 "parser.cpp"
     break;
 
   case 39: /* table_element: table_constraint  */
@@ -3646,7 +3648,7 @@ yyreduce:
                    {
     (yyval.table_element_t) = (yyvsp[0].table_constraint_t);
 }
-#line 3650 "parser.cpp"
+#line 3652 "parser.cpp"
     break;
 
   case 40: /* table_column: IDENTIFIER column_type with_index_param_list default_expr  */
@@ -3701,7 +3703,7 @@ yyreduce:
     }
     */
 }
-#line 3705 "parser.cpp"
+#line 3707 "parser.cpp"
     break;
 
   case 41: /* table_column: IDENTIFIER column_type column_constraints default_expr  */
@@ -3740,391 +3742,391 @@ yyreduce:
     }
     */
 }
-#line 3744 "parser.cpp"
+#line 3746 "parser.cpp"
     break;
 
   case 42: /* column_type: BOOLEAN  */
 #line 772 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3750 "parser.cpp"
+#line 3752 "parser.cpp"
     break;
 
   case 43: /* column_type: TINYINT  */
 #line 773 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTinyInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3756 "parser.cpp"
+#line 3758 "parser.cpp"
     break;
 
   case 44: /* column_type: SMALLINT  */
 #line 774 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSmallInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3762 "parser.cpp"
+#line 3764 "parser.cpp"
     break;
 
   case 45: /* column_type: INTEGER  */
 #line 775 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3768 "parser.cpp"
+#line 3770 "parser.cpp"
     break;
 
   case 46: /* column_type: INT  */
 #line 776 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3774 "parser.cpp"
+#line 3776 "parser.cpp"
     break;
 
   case 47: /* column_type: BIGINT  */
 #line 777 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBigInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3780 "parser.cpp"
+#line 3782 "parser.cpp"
     break;
 
   case 48: /* column_type: HUGEINT  */
 #line 778 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kHugeInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3786 "parser.cpp"
+#line 3788 "parser.cpp"
     break;
 
   case 49: /* column_type: FLOAT  */
 #line 779 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3792 "parser.cpp"
+#line 3794 "parser.cpp"
     break;
 
   case 50: /* column_type: REAL  */
 #line 780 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3798 "parser.cpp"
+#line 3800 "parser.cpp"
     break;
 
   case 51: /* column_type: DOUBLE  */
 #line 781 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDouble, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3804 "parser.cpp"
+#line 3806 "parser.cpp"
     break;
 
   case 52: /* column_type: DATE  */
 #line 782 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDate, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3810 "parser.cpp"
+#line 3812 "parser.cpp"
     break;
 
   case 53: /* column_type: TIME  */
 #line 783 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3816 "parser.cpp"
+#line 3818 "parser.cpp"
     break;
 
   case 54: /* column_type: DATETIME  */
 #line 784 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDateTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3822 "parser.cpp"
+#line 3824 "parser.cpp"
     break;
 
   case 55: /* column_type: TIMESTAMP  */
 #line 785 "parser.y"
             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTimestamp, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3828 "parser.cpp"
+#line 3830 "parser.cpp"
     break;
 
   case 56: /* column_type: UUID  */
 #line 786 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kUuid, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3834 "parser.cpp"
+#line 3836 "parser.cpp"
     break;
 
   case 57: /* column_type: POINT  */
 #line 787 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kPoint, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3840 "parser.cpp"
+#line 3842 "parser.cpp"
     break;
 
   case 58: /* column_type: LINE  */
 #line 788 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLine, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3846 "parser.cpp"
+#line 3848 "parser.cpp"
     break;
 
   case 59: /* column_type: LSEG  */
 #line 789 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLineSeg, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3852 "parser.cpp"
+#line 3854 "parser.cpp"
     break;
 
   case 60: /* column_type: BOX  */
 #line 790 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBox, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3858 "parser.cpp"
+#line 3860 "parser.cpp"
     break;
 
   case 61: /* column_type: CIRCLE  */
 #line 793 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kCircle, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3864 "parser.cpp"
+#line 3866 "parser.cpp"
     break;
 
   case 62: /* column_type: VARCHAR  */
 #line 795 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kVarchar, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3870 "parser.cpp"
+#line 3872 "parser.cpp"
     break;
 
   case 63: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
 #line 796 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-3].long_value), (yyvsp[-1].long_value), infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3876 "parser.cpp"
+#line 3878 "parser.cpp"
     break;
 
   case 64: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
 #line 797 "parser.y"
                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-1].long_value), 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3882 "parser.cpp"
+#line 3884 "parser.cpp"
     break;
 
   case 65: /* column_type: DECIMAL  */
 #line 798 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3888 "parser.cpp"
+#line 3890 "parser.cpp"
     break;
 
   case 66: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
 #line 801 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3894 "parser.cpp"
+#line 3896 "parser.cpp"
     break;
 
   case 67: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
 #line 802 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3900 "parser.cpp"
+#line 3902 "parser.cpp"
     break;
 
   case 68: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 803 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3906 "parser.cpp"
+#line 3908 "parser.cpp"
     break;
 
   case 69: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
 #line 804 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3912 "parser.cpp"
+#line 3914 "parser.cpp"
     break;
 
   case 70: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
 #line 805 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3918 "parser.cpp"
+#line 3920 "parser.cpp"
     break;
 
   case 71: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
 #line 806 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3924 "parser.cpp"
+#line 3926 "parser.cpp"
     break;
 
   case 72: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
 #line 807 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3930 "parser.cpp"
+#line 3932 "parser.cpp"
     break;
 
   case 73: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 808 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3936 "parser.cpp"
+#line 3938 "parser.cpp"
     break;
 
   case 74: /* column_type: TENSOR '(' BIT ',' LONG_VALUE ')'  */
 #line 809 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3942 "parser.cpp"
+#line 3944 "parser.cpp"
     break;
 
   case 75: /* column_type: TENSOR '(' TINYINT ',' LONG_VALUE ')'  */
 #line 810 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3948 "parser.cpp"
+#line 3950 "parser.cpp"
     break;
 
   case 76: /* column_type: TENSOR '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 811 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3954 "parser.cpp"
+#line 3956 "parser.cpp"
     break;
 
   case 77: /* column_type: TENSOR '(' INTEGER ',' LONG_VALUE ')'  */
 #line 812 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3960 "parser.cpp"
+#line 3962 "parser.cpp"
     break;
 
   case 78: /* column_type: TENSOR '(' INT ',' LONG_VALUE ')'  */
 #line 813 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3966 "parser.cpp"
+#line 3968 "parser.cpp"
     break;
 
   case 79: /* column_type: TENSOR '(' BIGINT ',' LONG_VALUE ')'  */
 #line 814 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3972 "parser.cpp"
+#line 3974 "parser.cpp"
     break;
 
   case 80: /* column_type: TENSOR '(' FLOAT ',' LONG_VALUE ')'  */
 #line 815 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3978 "parser.cpp"
+#line 3980 "parser.cpp"
     break;
 
   case 81: /* column_type: TENSOR '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 816 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3984 "parser.cpp"
+#line 3986 "parser.cpp"
     break;
 
   case 82: /* column_type: TENSORARRAY '(' BIT ',' LONG_VALUE ')'  */
 #line 817 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3990 "parser.cpp"
+#line 3992 "parser.cpp"
     break;
 
   case 83: /* column_type: TENSORARRAY '(' TINYINT ',' LONG_VALUE ')'  */
 #line 818 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3996 "parser.cpp"
+#line 3998 "parser.cpp"
     break;
 
   case 84: /* column_type: TENSORARRAY '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 819 "parser.y"
                                               { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 4002 "parser.cpp"
+#line 4004 "parser.cpp"
     break;
 
   case 85: /* column_type: TENSORARRAY '(' INTEGER ',' LONG_VALUE ')'  */
 #line 820 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4008 "parser.cpp"
+#line 4010 "parser.cpp"
     break;
 
   case 86: /* column_type: TENSORARRAY '(' INT ',' LONG_VALUE ')'  */
 #line 821 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4014 "parser.cpp"
+#line 4016 "parser.cpp"
     break;
 
   case 87: /* column_type: TENSORARRAY '(' BIGINT ',' LONG_VALUE ')'  */
 #line 822 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 4020 "parser.cpp"
+#line 4022 "parser.cpp"
     break;
 
   case 88: /* column_type: TENSORARRAY '(' FLOAT ',' LONG_VALUE ')'  */
 #line 823 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 4026 "parser.cpp"
+#line 4028 "parser.cpp"
     break;
 
   case 89: /* column_type: TENSORARRAY '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 824 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 4032 "parser.cpp"
+#line 4034 "parser.cpp"
     break;
 
   case 90: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
 #line 825 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 4038 "parser.cpp"
+#line 4040 "parser.cpp"
     break;
 
   case 91: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
 #line 826 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 4044 "parser.cpp"
+#line 4046 "parser.cpp"
     break;
 
   case 92: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 827 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 4050 "parser.cpp"
+#line 4052 "parser.cpp"
     break;
 
   case 93: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
 #line 828 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4056 "parser.cpp"
+#line 4058 "parser.cpp"
     break;
 
   case 94: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
 #line 829 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4062 "parser.cpp"
+#line 4064 "parser.cpp"
     break;
 
   case 95: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
 #line 830 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 4068 "parser.cpp"
+#line 4070 "parser.cpp"
     break;
 
   case 96: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
 #line 831 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 4074 "parser.cpp"
+#line 4076 "parser.cpp"
     break;
 
   case 97: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 832 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 4080 "parser.cpp"
+#line 4082 "parser.cpp"
     break;
 
   case 98: /* column_type: SPARSE '(' BIT ',' LONG_VALUE ')'  */
 #line 833 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 4086 "parser.cpp"
+#line 4088 "parser.cpp"
     break;
 
   case 99: /* column_type: SPARSE '(' TINYINT ',' LONG_VALUE ')'  */
 #line 834 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 4092 "parser.cpp"
+#line 4094 "parser.cpp"
     break;
 
   case 100: /* column_type: SPARSE '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 835 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 4098 "parser.cpp"
+#line 4100 "parser.cpp"
     break;
 
   case 101: /* column_type: SPARSE '(' INTEGER ',' LONG_VALUE ')'  */
 #line 836 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4104 "parser.cpp"
+#line 4106 "parser.cpp"
     break;
 
   case 102: /* column_type: SPARSE '(' INT ',' LONG_VALUE ')'  */
 #line 837 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4110 "parser.cpp"
+#line 4112 "parser.cpp"
     break;
 
   case 103: /* column_type: SPARSE '(' BIGINT ',' LONG_VALUE ')'  */
 #line 838 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 4116 "parser.cpp"
+#line 4118 "parser.cpp"
     break;
 
   case 104: /* column_type: SPARSE '(' FLOAT ',' LONG_VALUE ')'  */
 #line 839 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 4122 "parser.cpp"
+#line 4124 "parser.cpp"
     break;
 
   case 105: /* column_type: SPARSE '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 840 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 4128 "parser.cpp"
+#line 4130 "parser.cpp"
     break;
 
   case 106: /* column_constraints: column_constraint  */
@@ -4133,7 +4135,7 @@ yyreduce:
     (yyval.column_constraints_t) = new std::set<infinity::ConstraintType>();
     (yyval.column_constraints_t)->insert((yyvsp[0].column_constraint_t));
 }
-#line 4137 "parser.cpp"
+#line 4139 "parser.cpp"
     break;
 
   case 107: /* column_constraints: column_constraints column_constraint  */
@@ -4147,7 +4149,7 @@ yyreduce:
     (yyvsp[-1].column_constraints_t)->insert((yyvsp[0].column_constraint_t));
     (yyval.column_constraints_t) = (yyvsp[-1].column_constraints_t);
 }
-#line 4151 "parser.cpp"
+#line 4153 "parser.cpp"
     break;
 
   case 108: /* column_constraint: PRIMARY KEY  */
@@ -4155,7 +4157,7 @@ yyreduce:
                                 {
     (yyval.column_constraint_t) = infinity::ConstraintType::kPrimaryKey;
 }
-#line 4159 "parser.cpp"
+#line 4161 "parser.cpp"
     break;
 
   case 109: /* column_constraint: UNIQUE  */
@@ -4163,7 +4165,7 @@ yyreduce:
          {
     (yyval.column_constraint_t) = infinity::ConstraintType::kUnique;
 }
-#line 4167 "parser.cpp"
+#line 4169 "parser.cpp"
     break;
 
   case 110: /* column_constraint: NULLABLE  */
@@ -4171,7 +4173,7 @@ yyreduce:
            {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNull;
 }
-#line 4175 "parser.cpp"
+#line 4177 "parser.cpp"
     break;
 
   case 111: /* column_constraint: NOT NULLABLE  */
@@ -4179,7 +4181,7 @@ yyreduce:
                {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNotNull;
 }
-#line 4183 "parser.cpp"
+#line 4185 "parser.cpp"
     break;
 
   case 112: /* default_expr: DEFAULT constant_expr  */
@@ -4187,7 +4189,7 @@ yyreduce:
                                      {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 4191 "parser.cpp"
+#line 4193 "parser.cpp"
     break;
 
   case 113: /* default_expr: %empty  */
@@ -4195,7 +4197,7 @@ yyreduce:
                             {
     (yyval.const_expr_t) = nullptr;
 }
-#line 4199 "parser.cpp"
+#line 4201 "parser.cpp"
     break;
 
   case 114: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
@@ -4205,7 +4207,7 @@ yyreduce:
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kPrimaryKey;
 }
-#line 4209 "parser.cpp"
+#line 4211 "parser.cpp"
     break;
 
   case 115: /* table_constraint: UNIQUE '(' identifier_array ')'  */
@@ -4215,7 +4217,7 @@ yyreduce:
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kUnique;
 }
-#line 4219 "parser.cpp"
+#line 4221 "parser.cpp"
     break;
 
   case 116: /* identifier_array: IDENTIFIER  */
@@ -4226,7 +4228,7 @@ yyreduce:
     (yyval.identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4230 "parser.cpp"
+#line 4232 "parser.cpp"
     break;
 
   case 117: /* identifier_array: identifier_array ',' IDENTIFIER  */
@@ -4237,7 +4239,7 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.identifier_array_t) = (yyvsp[-2].identifier_array_t);
 }
-#line 4241 "parser.cpp"
+#line 4243 "parser.cpp"
     break;
 
   case 118: /* delete_statement: DELETE FROM table_name where_clause  */
@@ -4254,7 +4256,7 @@ yyreduce:
     delete (yyvsp[-1].table_name_t);
     (yyval.delete_stmt)->where_expr_ = (yyvsp[0].expr_t);
 }
-#line 4258 "parser.cpp"
+#line 4260 "parser.cpp"
     break;
 
   case 119: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
@@ -4293,7 +4295,7 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-2].identifier_array_t);
     (yyval.insert_stmt)->values_ = (yyvsp[0].expr_array_list_t);
 }
-#line 4297 "parser.cpp"
+#line 4299 "parser.cpp"
     break;
 
   case 120: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
@@ -4310,7 +4312,7 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-1].identifier_array_t);
     (yyval.insert_stmt)->select_ = (yyvsp[0].select_stmt);
 }
-#line 4314 "parser.cpp"
+#line 4316 "parser.cpp"
     break;
 
   case 121: /* optional_identifier_array: '(' identifier_array ')'  */
@@ -4318,7 +4320,7 @@ yyreduce:
                                                     {
     (yyval.identifier_array_t) = (yyvsp[-1].identifier_array_t);
 }
-#line 4322 "parser.cpp"
+#line 4324 "parser.cpp"
     break;
 
   case 122: /* optional_identifier_array: %empty  */
@@ -4326,7 +4328,7 @@ yyreduce:
   {
     (yyval.identifier_array_t) = nullptr;
 }
-#line 4330 "parser.cpp"
+#line 4332 "parser.cpp"
     break;
 
   case 123: /* explain_statement: EXPLAIN explain_type explainable_statement  */
@@ -4336,7 +4338,7 @@ yyreduce:
     (yyval.explain_stmt)->type_ = (yyvsp[-1].explain_type_t);
     (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
 }
-#line 4340 "parser.cpp"
+#line 4342 "parser.cpp"
     break;
 
   case 124: /* explain_type: ANALYZE  */
@@ -4344,7 +4346,7 @@ yyreduce:
                       {
     (yyval.explain_type_t) = infinity::ExplainType::kAnalyze;
 }
-#line 4348 "parser.cpp"
+#line 4350 "parser.cpp"
     break;
 
   case 125: /* explain_type: AST  */
@@ -4352,7 +4354,7 @@ yyreduce:
       {
     (yyval.explain_type_t) = infinity::ExplainType::kAst;
 }
-#line 4356 "parser.cpp"
+#line 4358 "parser.cpp"
     break;
 
   case 126: /* explain_type: RAW  */
@@ -4360,7 +4362,7 @@ yyreduce:
       {
     (yyval.explain_type_t) = infinity::ExplainType::kUnOpt;
 }
-#line 4364 "parser.cpp"
+#line 4366 "parser.cpp"
     break;
 
   case 127: /* explain_type: LOGICAL  */
@@ -4368,7 +4370,7 @@ yyreduce:
           {
     (yyval.explain_type_t) = infinity::ExplainType::kOpt;
 }
-#line 4372 "parser.cpp"
+#line 4374 "parser.cpp"
     break;
 
   case 128: /* explain_type: PHYSICAL  */
@@ -4376,7 +4378,7 @@ yyreduce:
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 4380 "parser.cpp"
+#line 4382 "parser.cpp"
     break;
 
   case 129: /* explain_type: PIPELINE  */
@@ -4384,7 +4386,7 @@ yyreduce:
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPipeline;
 }
-#line 4388 "parser.cpp"
+#line 4390 "parser.cpp"
     break;
 
   case 130: /* explain_type: FRAGMENT  */
@@ -4392,7 +4394,7 @@ yyreduce:
            {
     (yyval.explain_type_t) = infinity::ExplainType::kFragment;
 }
-#line 4396 "parser.cpp"
+#line 4398 "parser.cpp"
     break;
 
   case 131: /* explain_type: %empty  */
@@ -4400,7 +4402,7 @@ yyreduce:
   {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 4404 "parser.cpp"
+#line 4406 "parser.cpp"
     break;
 
   case 132: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
@@ -4417,7 +4419,7 @@ yyreduce:
     (yyval.update_stmt)->where_expr_ = (yyvsp[0].expr_t);
     (yyval.update_stmt)->update_expr_array_ = (yyvsp[-1].update_expr_array_t);
 }
-#line 4421 "parser.cpp"
+#line 4423 "parser.cpp"
     break;
 
   case 133: /* update_expr_array: update_expr  */
@@ -4426,7 +4428,7 @@ yyreduce:
     (yyval.update_expr_array_t) = new std::vector<infinity::UpdateExpr*>();
     (yyval.update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
 }
-#line 4430 "parser.cpp"
+#line 4432 "parser.cpp"
     break;
 
   case 134: /* update_expr_array: update_expr_array ',' update_expr  */
@@ -4435,7 +4437,7 @@ yyreduce:
     (yyvsp[-2].update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
     (yyval.update_expr_array_t) = (yyvsp[-2].update_expr_array_t);
 }
-#line 4439 "parser.cpp"
+#line 4441 "parser.cpp"
     break;
 
   case 135: /* update_expr: IDENTIFIER '=' expr  */
@@ -4447,7 +4449,7 @@ yyreduce:
     free((yyvsp[-2].str_value));
     (yyval.update_expr_t)->value = (yyvsp[0].expr_t);
 }
-#line 4451 "parser.cpp"
+#line 4453 "parser.cpp"
     break;
 
   case 136: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
@@ -4463,7 +4465,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_ = drop_schema_info;
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 4467 "parser.cpp"
+#line 4469 "parser.cpp"
     break;
 
   case 137: /* drop_statement: DROP COLLECTION if_exists table_name  */
@@ -4481,7 +4483,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4485 "parser.cpp"
+#line 4487 "parser.cpp"
     break;
 
   case 138: /* drop_statement: DROP TABLE if_exists table_name  */
@@ -4499,7 +4501,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4503 "parser.cpp"
+#line 4505 "parser.cpp"
     break;
 
   case 139: /* drop_statement: DROP VIEW if_exists table_name  */
@@ -4517,7 +4519,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4521 "parser.cpp"
+#line 4523 "parser.cpp"
     break;
 
   case 140: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
@@ -4540,7 +4542,7 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4544 "parser.cpp"
+#line 4546 "parser.cpp"
     break;
 
   case 141: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
@@ -4586,7 +4588,7 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4590 "parser.cpp"
+#line 4592 "parser.cpp"
     break;
 
   case 142: /* copy_statement: COPY table_name '(' expr_array ')' TO file_path WITH '(' copy_option_list ')'  */
@@ -4634,7 +4636,7 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4638 "parser.cpp"
+#line 4640 "parser.cpp"
     break;
 
   case 143: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
@@ -4680,7 +4682,7 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4684 "parser.cpp"
+#line 4686 "parser.cpp"
     break;
 
   case 144: /* select_statement: select_without_paren  */
@@ -4688,7 +4690,7 @@ yyreduce:
                                         {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4692 "parser.cpp"
+#line 4694 "parser.cpp"
     break;
 
   case 145: /* select_statement: select_with_paren  */
@@ -4696,7 +4698,7 @@ yyreduce:
                     {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4700 "parser.cpp"
+#line 4702 "parser.cpp"
     break;
 
   case 146: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
@@ -4710,7 +4712,7 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4714 "parser.cpp"
+#line 4716 "parser.cpp"
     break;
 
   case 147: /* select_statement: select_statement set_operator select_clause_without_modifier  */
@@ -4724,7 +4726,7 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4728 "parser.cpp"
+#line 4730 "parser.cpp"
     break;
 
   case 148: /* select_with_paren: '(' select_without_paren ')'  */
@@ -4732,7 +4734,7 @@ yyreduce:
                                                  {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4736 "parser.cpp"
+#line 4738 "parser.cpp"
     break;
 
   case 149: /* select_with_paren: '(' select_with_paren ')'  */
@@ -4740,7 +4742,7 @@ yyreduce:
                             {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4744 "parser.cpp"
+#line 4746 "parser.cpp"
     break;
 
   case 150: /* select_without_paren: with_clause select_clause_with_modifier  */
@@ -4749,7 +4751,7 @@ yyreduce:
     (yyvsp[0].select_stmt)->with_exprs_ = (yyvsp[-1].with_expr_list_t);
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4753 "parser.cpp"
+#line 4755 "parser.cpp"
     break;
 
   case 151: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
@@ -4775,7 +4777,7 @@ yyreduce:
     (yyvsp[-3].select_stmt)->offset_expr_ = (yyvsp[0].expr_t);
     (yyval.select_stmt) = (yyvsp[-3].select_stmt);
 }
-#line 4779 "parser.cpp"
+#line 4781 "parser.cpp"
     break;
 
   case 152: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
@@ -4783,7 +4785,7 @@ yyreduce:
                                                                              {
   (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4787 "parser.cpp"
+#line 4789 "parser.cpp"
     break;
 
   case 153: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
@@ -4791,7 +4793,7 @@ yyreduce:
                                                {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4795 "parser.cpp"
+#line 4797 "parser.cpp"
     break;
 
   case 154: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
@@ -4811,7 +4813,7 @@ yyreduce:
         YYERROR;
     }
 }
-#line 4815 "parser.cpp"
+#line 4817 "parser.cpp"
     break;
 
   case 155: /* order_by_clause: ORDER BY order_by_expr_list  */
@@ -4819,7 +4821,7 @@ yyreduce:
                                               {
     (yyval.order_by_expr_list_t) = (yyvsp[0].order_by_expr_list_t);
 }
-#line 4823 "parser.cpp"
+#line 4825 "parser.cpp"
     break;
 
   case 156: /* order_by_clause: %empty  */
@@ -4827,7 +4829,7 @@ yyreduce:
                        {
     (yyval.order_by_expr_list_t) = nullptr;
 }
-#line 4831 "parser.cpp"
+#line 4833 "parser.cpp"
     break;
 
   case 157: /* order_by_expr_list: order_by_expr  */
@@ -4836,7 +4838,7 @@ yyreduce:
     (yyval.order_by_expr_list_t) = new std::vector<infinity::OrderByExpr*>();
     (yyval.order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
 }
-#line 4840 "parser.cpp"
+#line 4842 "parser.cpp"
     break;
 
   case 158: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
@@ -4845,7 +4847,7 @@ yyreduce:
     (yyvsp[-2].order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
     (yyval.order_by_expr_list_t) = (yyvsp[-2].order_by_expr_list_t);
 }
-#line 4849 "parser.cpp"
+#line 4851 "parser.cpp"
     break;
 
   case 159: /* order_by_expr: expr order_by_type  */
@@ -4855,7 +4857,7 @@ yyreduce:
     (yyval.order_by_expr_t)->expr_ = (yyvsp[-1].expr_t);
     (yyval.order_by_expr_t)->type_ = (yyvsp[0].order_by_type_t);
 }
-#line 4859 "parser.cpp"
+#line 4861 "parser.cpp"
     break;
 
   case 160: /* order_by_type: ASC  */
@@ -4863,7 +4865,7 @@ yyreduce:
                    {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4867 "parser.cpp"
+#line 4869 "parser.cpp"
     break;
 
   case 161: /* order_by_type: DESC  */
@@ -4871,7 +4873,7 @@ yyreduce:
        {
     (yyval.order_by_type_t) = infinity::kDesc;
 }
-#line 4875 "parser.cpp"
+#line 4877 "parser.cpp"
     break;
 
   case 162: /* order_by_type: %empty  */
@@ -4879,7 +4881,7 @@ yyreduce:
   {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4883 "parser.cpp"
+#line 4885 "parser.cpp"
     break;
 
   case 163: /* limit_expr: LIMIT expr  */
@@ -4887,13 +4889,13 @@ yyreduce:
                        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4891 "parser.cpp"
+#line 4893 "parser.cpp"
     break;
 
   case 164: /* limit_expr: %empty  */
 #line 1393 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4897 "parser.cpp"
+#line 4899 "parser.cpp"
     break;
 
   case 165: /* offset_expr: OFFSET expr  */
@@ -4901,13 +4903,13 @@ yyreduce:
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4905 "parser.cpp"
+#line 4907 "parser.cpp"
     break;
 
   case 166: /* offset_expr: %empty  */
 #line 1399 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4911 "parser.cpp"
+#line 4913 "parser.cpp"
     break;
 
   case 167: /* distinct: DISTINCT  */
@@ -4915,7 +4917,7 @@ yyreduce:
                     {
     (yyval.bool_value) = true;
 }
-#line 4919 "parser.cpp"
+#line 4921 "parser.cpp"
     break;
 
   case 168: /* distinct: %empty  */
@@ -4923,7 +4925,7 @@ yyreduce:
   {
     (yyval.bool_value) = false;
 }
-#line 4927 "parser.cpp"
+#line 4929 "parser.cpp"
     break;
 
   case 169: /* from_clause: FROM table_reference  */
@@ -4931,7 +4933,7 @@ yyreduce:
                                   {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4935 "parser.cpp"
+#line 4937 "parser.cpp"
     break;
 
   case 170: /* from_clause: %empty  */
@@ -4939,7 +4941,7 @@ yyreduce:
                        {
     (yyval.table_reference_t) = nullptr;
 }
-#line 4943 "parser.cpp"
+#line 4945 "parser.cpp"
     break;
 
   case 171: /* search_clause: SEARCH sub_search_array  */
@@ -4949,7 +4951,7 @@ yyreduce:
     search_expr->SetExprs((yyvsp[0].expr_array_t));
     (yyval.expr_t) = search_expr;
 }
-#line 4953 "parser.cpp"
+#line 4955 "parser.cpp"
     break;
 
   case 172: /* search_clause: %empty  */
@@ -4957,7 +4959,7 @@ yyreduce:
                          {
     (yyval.expr_t) = nullptr;
 }
-#line 4961 "parser.cpp"
+#line 4963 "parser.cpp"
     break;
 
   case 173: /* where_clause: WHERE expr  */
@@ -4965,7 +4967,7 @@ yyreduce:
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4969 "parser.cpp"
+#line 4971 "parser.cpp"
     break;
 
   case 174: /* where_clause: %empty  */
@@ -4973,7 +4975,7 @@ yyreduce:
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4977 "parser.cpp"
+#line 4979 "parser.cpp"
     break;
 
   case 175: /* having_clause: HAVING expr  */
@@ -4981,7 +4983,7 @@ yyreduce:
                            {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4985 "parser.cpp"
+#line 4987 "parser.cpp"
     break;
 
   case 176: /* having_clause: %empty  */
@@ -4989,7 +4991,7 @@ yyreduce:
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4993 "parser.cpp"
+#line 4995 "parser.cpp"
     break;
 
   case 177: /* group_by_clause: GROUP BY expr_array  */
@@ -4997,7 +4999,7 @@ yyreduce:
                                      {
     (yyval.expr_array_t) = (yyvsp[0].expr_array_t);
 }
-#line 5001 "parser.cpp"
+#line 5003 "parser.cpp"
     break;
 
   case 178: /* group_by_clause: %empty  */
@@ -5005,7 +5007,7 @@ yyreduce:
   {
     (yyval.expr_array_t) = nullptr;
 }
-#line 5009 "parser.cpp"
+#line 5011 "parser.cpp"
     break;
 
   case 179: /* set_operator: UNION  */
@@ -5013,7 +5015,7 @@ yyreduce:
                      {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnion;
 }
-#line 5017 "parser.cpp"
+#line 5019 "parser.cpp"
     break;
 
   case 180: /* set_operator: UNION ALL  */
@@ -5021,7 +5023,7 @@ yyreduce:
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnionAll;
 }
-#line 5025 "parser.cpp"
+#line 5027 "parser.cpp"
     break;
 
   case 181: /* set_operator: INTERSECT  */
@@ -5029,7 +5031,7 @@ yyreduce:
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kIntersect;
 }
-#line 5033 "parser.cpp"
+#line 5035 "parser.cpp"
     break;
 
   case 182: /* set_operator: EXCEPT  */
@@ -5037,7 +5039,7 @@ yyreduce:
          {
     (yyval.set_operator_t) = infinity::SetOperatorType::kExcept;
 }
-#line 5041 "parser.cpp"
+#line 5043 "parser.cpp"
     break;
 
   case 183: /* table_reference: table_reference_unit  */
@@ -5045,7 +5047,7 @@ yyreduce:
                                        {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 5049 "parser.cpp"
+#line 5051 "parser.cpp"
     break;
 
   case 184: /* table_reference: table_reference ',' table_reference_unit  */
@@ -5063,7 +5065,7 @@ yyreduce:
 
     (yyval.table_reference_t) = cross_product_ref;
 }
-#line 5067 "parser.cpp"
+#line 5069 "parser.cpp"
     break;
 
   case 187: /* table_reference_name: table_name table_alias  */
@@ -5081,7 +5083,7 @@ yyreduce:
     table_ref->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = table_ref;
 }
-#line 5085 "parser.cpp"
+#line 5087 "parser.cpp"
     break;
 
   case 188: /* table_reference_name: '(' select_statement ')' table_alias  */
@@ -5092,7 +5094,7 @@ yyreduce:
     subquery_reference->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = subquery_reference;
 }
-#line 5096 "parser.cpp"
+#line 5098 "parser.cpp"
     break;
 
   case 189: /* table_name: IDENTIFIER  */
@@ -5102,7 +5104,7 @@ yyreduce:
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 5106 "parser.cpp"
+#line 5108 "parser.cpp"
     break;
 
   case 190: /* table_name: IDENTIFIER '.' IDENTIFIER  */
@@ -5114,7 +5116,7 @@ yyreduce:
     (yyval.table_name_t)->schema_name_ptr_ = (yyvsp[-2].str_value);
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 5118 "parser.cpp"
+#line 5120 "parser.cpp"
     break;
 
   case 191: /* table_alias: AS IDENTIFIER  */
@@ -5124,7 +5126,7 @@ yyreduce:
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 5128 "parser.cpp"
+#line 5130 "parser.cpp"
     break;
 
   case 192: /* table_alias: IDENTIFIER  */
@@ -5134,7 +5136,7 @@ yyreduce:
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 5138 "parser.cpp"
+#line 5140 "parser.cpp"
     break;
 
   case 193: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
@@ -5145,7 +5147,7 @@ yyreduce:
     (yyval.table_alias_t)->alias_ = (yyvsp[-3].str_value);
     (yyval.table_alias_t)->column_alias_array_ = (yyvsp[-1].identifier_array_t);
 }
-#line 5149 "parser.cpp"
+#line 5151 "parser.cpp"
     break;
 
   case 194: /* table_alias: %empty  */
@@ -5153,7 +5155,7 @@ yyreduce:
   {
     (yyval.table_alias_t) = nullptr;
 }
-#line 5157 "parser.cpp"
+#line 5159 "parser.cpp"
     break;
 
   case 195: /* with_clause: WITH with_expr_list  */
@@ -5161,7 +5163,7 @@ yyreduce:
                                   {
     (yyval.with_expr_list_t) = (yyvsp[0].with_expr_list_t);
 }
-#line 5165 "parser.cpp"
+#line 5167 "parser.cpp"
     break;
 
   case 196: /* with_clause: %empty  */
@@ -5169,7 +5171,7 @@ yyreduce:
                           {
     (yyval.with_expr_list_t) = nullptr;
 }
-#line 5173 "parser.cpp"
+#line 5175 "parser.cpp"
     break;
 
   case 197: /* with_expr_list: with_expr  */
@@ -5178,7 +5180,7 @@ yyreduce:
     (yyval.with_expr_list_t) = new std::vector<infinity::WithExpr*>();
     (yyval.with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
 }
-#line 5182 "parser.cpp"
+#line 5184 "parser.cpp"
     break;
 
   case 198: /* with_expr_list: with_expr_list ',' with_expr  */
@@ -5187,7 +5189,7 @@ yyreduce:
     (yyvsp[-2].with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
     (yyval.with_expr_list_t) = (yyvsp[-2].with_expr_list_t);
 }
-#line 5191 "parser.cpp"
+#line 5193 "parser.cpp"
     break;
 
   case 199: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
@@ -5199,7 +5201,7 @@ yyreduce:
     free((yyvsp[-4].str_value));
     (yyval.with_expr_t)->select_ = (yyvsp[-1].select_stmt);
 }
-#line 5203 "parser.cpp"
+#line 5205 "parser.cpp"
     break;
 
   case 200: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
@@ -5211,7 +5213,7 @@ yyreduce:
     join_reference->join_type_ = infinity::JoinType::kNatural;
     (yyval.table_reference_t) = join_reference;
 }
-#line 5215 "parser.cpp"
+#line 5217 "parser.cpp"
     break;
 
   case 201: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
@@ -5224,7 +5226,7 @@ yyreduce:
     join_reference->condition_ = (yyvsp[0].expr_t);
     (yyval.table_reference_t) = join_reference;
 }
-#line 5228 "parser.cpp"
+#line 5230 "parser.cpp"
     break;
 
   case 202: /* join_type: INNER  */
@@ -5232,7 +5234,7 @@ yyreduce:
                   {
     (yyval.join_type_t) = infinity::JoinType::kInner;
 }
-#line 5236 "parser.cpp"
+#line 5238 "parser.cpp"
     break;
 
   case 203: /* join_type: LEFT  */
@@ -5240,7 +5242,7 @@ yyreduce:
        {
     (yyval.join_type_t) = infinity::JoinType::kLeft;
 }
-#line 5244 "parser.cpp"
+#line 5246 "parser.cpp"
     break;
 
   case 204: /* join_type: RIGHT  */
@@ -5248,7 +5250,7 @@ yyreduce:
         {
     (yyval.join_type_t) = infinity::JoinType::kRight;
 }
-#line 5252 "parser.cpp"
+#line 5254 "parser.cpp"
     break;
 
   case 205: /* join_type: OUTER  */
@@ -5256,7 +5258,7 @@ yyreduce:
         {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 5260 "parser.cpp"
+#line 5262 "parser.cpp"
     break;
 
   case 206: /* join_type: FULL  */
@@ -5264,7 +5266,7 @@ yyreduce:
        {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 5268 "parser.cpp"
+#line 5270 "parser.cpp"
     break;
 
   case 207: /* join_type: CROSS  */
@@ -5272,14 +5274,14 @@ yyreduce:
         {
     (yyval.join_type_t) = infinity::JoinType::kCross;
 }
-#line 5276 "parser.cpp"
+#line 5278 "parser.cpp"
     break;
 
   case 208: /* join_type: %empty  */
 #line 1608 "parser.y"
                 {
 }
-#line 5283 "parser.cpp"
+#line 5285 "parser.cpp"
     break;
 
   case 209: /* show_statement: SHOW DATABASES  */
@@ -5288,7 +5290,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabases;
 }
-#line 5292 "parser.cpp"
+#line 5294 "parser.cpp"
     break;
 
   case 210: /* show_statement: SHOW TABLES  */
@@ -5297,7 +5299,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTables;
 }
-#line 5301 "parser.cpp"
+#line 5303 "parser.cpp"
     break;
 
   case 211: /* show_statement: SHOW VIEWS  */
@@ -5306,7 +5308,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kViews;
 }
-#line 5310 "parser.cpp"
+#line 5312 "parser.cpp"
     break;
 
   case 212: /* show_statement: SHOW CONFIGS  */
@@ -5315,7 +5317,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfigs;
 }
-#line 5319 "parser.cpp"
+#line 5321 "parser.cpp"
     break;
 
   case 213: /* show_statement: SHOW CONFIG IDENTIFIER  */
@@ -5327,7 +5329,7 @@ yyreduce:
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5331 "parser.cpp"
+#line 5333 "parser.cpp"
     break;
 
   case 214: /* show_statement: SHOW PROFILES  */
@@ -5336,109 +5338,119 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kProfiles;
 }
-#line 5340 "parser.cpp"
+#line 5342 "parser.cpp"
     break;
 
-  case 215: /* show_statement: SHOW BUFFER  */
+  case 215: /* show_statement: SHOW PROFILE LONG_VALUE  */
 #line 1641 "parser.y"
+                          {
+    (yyval.show_stmt) = new infinity::ShowStatement();
+    (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kProfile;
+    (yyval.show_stmt)->profile_no_ = (yyvsp[0].long_value);
+}
+#line 5352 "parser.cpp"
+    break;
+
+  case 216: /* show_statement: SHOW BUFFER  */
+#line 1646 "parser.y"
               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBuffer;
 }
-#line 5349 "parser.cpp"
+#line 5361 "parser.cpp"
     break;
 
-  case 216: /* show_statement: SHOW QUERIES  */
-#line 1645 "parser.y"
+  case 217: /* show_statement: SHOW QUERIES  */
+#line 1650 "parser.y"
                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kQueries;
 }
-#line 5358 "parser.cpp"
+#line 5370 "parser.cpp"
     break;
 
-  case 217: /* show_statement: SHOW QUERY SESSION LONG_VALUE  */
-#line 1649 "parser.y"
+  case 218: /* show_statement: SHOW QUERY SESSION LONG_VALUE  */
+#line 1654 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kQuery;
     (yyval.show_stmt)->session_id_ = (yyvsp[0].long_value);
 }
-#line 5368 "parser.cpp"
+#line 5380 "parser.cpp"
     break;
 
-  case 218: /* show_statement: SHOW TRANSACTIONS  */
-#line 1654 "parser.y"
+  case 219: /* show_statement: SHOW TRANSACTIONS  */
+#line 1659 "parser.y"
                     {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTransactions;
 }
-#line 5377 "parser.cpp"
+#line 5389 "parser.cpp"
     break;
 
-  case 219: /* show_statement: SHOW TRANSACTION LONG_VALUE  */
-#line 1658 "parser.y"
+  case 220: /* show_statement: SHOW TRANSACTION LONG_VALUE  */
+#line 1663 "parser.y"
                               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTransaction;
     (yyval.show_stmt)->txn_id_ = (yyvsp[0].long_value);
 }
-#line 5387 "parser.cpp"
+#line 5399 "parser.cpp"
     break;
 
-  case 220: /* show_statement: SHOW SESSION VARIABLES  */
-#line 1663 "parser.y"
+  case 221: /* show_statement: SHOW SESSION VARIABLES  */
+#line 1668 "parser.y"
                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionVariables;
 }
-#line 5396 "parser.cpp"
+#line 5408 "parser.cpp"
     break;
 
-  case 221: /* show_statement: SHOW GLOBAL VARIABLES  */
-#line 1667 "parser.y"
+  case 222: /* show_statement: SHOW GLOBAL VARIABLES  */
+#line 1672 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalVariables;
 }
-#line 5405 "parser.cpp"
+#line 5417 "parser.cpp"
     break;
 
-  case 222: /* show_statement: SHOW SESSION VARIABLE IDENTIFIER  */
-#line 1671 "parser.y"
+  case 223: /* show_statement: SHOW SESSION VARIABLE IDENTIFIER  */
+#line 1676 "parser.y"
                                    {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionVariable;
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5416 "parser.cpp"
+#line 5428 "parser.cpp"
     break;
 
-  case 223: /* show_statement: SHOW GLOBAL VARIABLE IDENTIFIER  */
-#line 1677 "parser.y"
+  case 224: /* show_statement: SHOW GLOBAL VARIABLE IDENTIFIER  */
+#line 1682 "parser.y"
                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalVariable;
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5427 "parser.cpp"
+#line 5439 "parser.cpp"
     break;
 
-  case 224: /* show_statement: SHOW DATABASE IDENTIFIER  */
-#line 1683 "parser.y"
+  case 225: /* show_statement: SHOW DATABASE IDENTIFIER  */
+#line 1688 "parser.y"
                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabase;
     (yyval.show_stmt)->schema_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5438 "parser.cpp"
+#line 5450 "parser.cpp"
     break;
 
-  case 225: /* show_statement: SHOW TABLE table_name  */
-#line 1689 "parser.y"
+  case 226: /* show_statement: SHOW TABLE table_name  */
+#line 1694 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTable;
@@ -5450,11 +5462,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 5454 "parser.cpp"
+#line 5466 "parser.cpp"
     break;
 
-  case 226: /* show_statement: SHOW TABLE table_name COLUMNS  */
-#line 1700 "parser.y"
+  case 227: /* show_statement: SHOW TABLE table_name COLUMNS  */
+#line 1705 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kColumns;
@@ -5466,11 +5478,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5470 "parser.cpp"
+#line 5482 "parser.cpp"
     break;
 
-  case 227: /* show_statement: SHOW TABLE table_name SEGMENTS  */
-#line 1711 "parser.y"
+  case 228: /* show_statement: SHOW TABLE table_name SEGMENTS  */
+#line 1716 "parser.y"
                                  {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -5482,11 +5494,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5486 "parser.cpp"
+#line 5498 "parser.cpp"
     break;
 
-  case 228: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
-#line 1722 "parser.y"
+  case 229: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
+#line 1727 "parser.y"
                                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegment;
@@ -5499,11 +5511,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-2].table_name_t);
 }
-#line 5503 "parser.cpp"
+#line 5515 "parser.cpp"
     break;
 
-  case 229: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
-#line 1734 "parser.y"
+  case 230: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
+#line 1739 "parser.y"
                                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlocks;
@@ -5516,11 +5528,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[-1].long_value);
     delete (yyvsp[-3].table_name_t);
 }
-#line 5520 "parser.cpp"
+#line 5532 "parser.cpp"
     break;
 
-  case 230: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
-#line 1746 "parser.y"
+  case 231: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
+#line 1751 "parser.y"
                                                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlock;
@@ -5534,11 +5546,11 @@ yyreduce:
     (yyval.show_stmt)->block_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-4].table_name_t);
 }
-#line 5538 "parser.cpp"
+#line 5550 "parser.cpp"
     break;
 
-  case 231: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
-#line 1759 "parser.y"
+  case 232: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
+#line 1764 "parser.y"
                                                                               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlockColumn;
@@ -5553,11 +5565,11 @@ yyreduce:
     (yyval.show_stmt)->column_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-6].table_name_t);
 }
-#line 5557 "parser.cpp"
+#line 5569 "parser.cpp"
     break;
 
-  case 232: /* show_statement: SHOW TABLE table_name INDEXES  */
-#line 1773 "parser.y"
+  case 233: /* show_statement: SHOW TABLE table_name INDEXES  */
+#line 1778 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexes;
@@ -5569,11 +5581,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5573 "parser.cpp"
+#line 5585 "parser.cpp"
     break;
 
-  case 233: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
-#line 1784 "parser.y"
+  case 234: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
+#line 1789 "parser.y"
                                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndex;
@@ -5588,11 +5600,11 @@ yyreduce:
     (yyval.show_stmt)->index_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5592 "parser.cpp"
+#line 5604 "parser.cpp"
     break;
 
-  case 234: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE  */
-#line 1798 "parser.y"
+  case 235: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE  */
+#line 1803 "parser.y"
                                                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexSegment;
@@ -5609,11 +5621,11 @@ yyreduce:
 
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
 }
-#line 5613 "parser.cpp"
+#line 5625 "parser.cpp"
     break;
 
-  case 235: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE CHUNK LONG_VALUE  */
-#line 1814 "parser.y"
+  case 236: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE CHUNK LONG_VALUE  */
+#line 1819 "parser.y"
                                                                              {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexChunk;
@@ -5631,38 +5643,38 @@ yyreduce:
       (yyval.show_stmt)->segment_id_ = (yyvsp[-2].long_value);
       (yyval.show_stmt)->chunk_id_ = (yyvsp[0].long_value);
   }
-#line 5635 "parser.cpp"
+#line 5647 "parser.cpp"
     break;
 
-  case 236: /* flush_statement: FLUSH DATA  */
-#line 1835 "parser.y"
+  case 237: /* flush_statement: FLUSH DATA  */
+#line 1840 "parser.y"
                             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kData;
 }
-#line 5644 "parser.cpp"
+#line 5656 "parser.cpp"
     break;
 
-  case 237: /* flush_statement: FLUSH LOG  */
-#line 1839 "parser.y"
+  case 238: /* flush_statement: FLUSH LOG  */
+#line 1844 "parser.y"
             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kLog;
 }
-#line 5653 "parser.cpp"
+#line 5665 "parser.cpp"
     break;
 
-  case 238: /* flush_statement: FLUSH BUFFER  */
-#line 1843 "parser.y"
+  case 239: /* flush_statement: FLUSH BUFFER  */
+#line 1848 "parser.y"
                {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kBuffer;
 }
-#line 5662 "parser.cpp"
+#line 5674 "parser.cpp"
     break;
 
-  case 239: /* optimize_statement: OPTIMIZE table_name  */
-#line 1851 "parser.y"
+  case 240: /* optimize_statement: OPTIMIZE table_name  */
+#line 1856 "parser.y"
                                         {
     (yyval.optimize_stmt) = new infinity::OptimizeStatement();
     if((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5673,54 +5685,54 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 5677 "parser.cpp"
+#line 5689 "parser.cpp"
     break;
 
-  case 240: /* command_statement: USE IDENTIFIER  */
-#line 1865 "parser.y"
+  case 241: /* command_statement: USE IDENTIFIER  */
+#line 1870 "parser.y"
                                   {
     (yyval.command_stmt) = new infinity::CommandStatement();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::UseCmd>((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5688 "parser.cpp"
+#line 5700 "parser.cpp"
     break;
 
-  case 241: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
-#line 1871 "parser.y"
+  case 242: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
+#line 1876 "parser.y"
                                       {
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::ExportCmd>((yyvsp[0].str_value), infinity::ExportType::kProfileRecord, (yyvsp[-1].long_value));
     free((yyvsp[0].str_value));
 }
-#line 5698 "parser.cpp"
+#line 5710 "parser.cpp"
     break;
 
-  case 242: /* command_statement: SET SESSION IDENTIFIER ON  */
-#line 1876 "parser.y"
+  case 243: /* command_statement: SET SESSION IDENTIFIER ON  */
+#line 1881 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5709 "parser.cpp"
+#line 5721 "parser.cpp"
     break;
 
-  case 243: /* command_statement: SET SESSION IDENTIFIER OFF  */
-#line 1882 "parser.y"
+  case 244: /* command_statement: SET SESSION IDENTIFIER OFF  */
+#line 1887 "parser.y"
                              {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5720 "parser.cpp"
+#line 5732 "parser.cpp"
     break;
 
-  case 244: /* command_statement: SET SESSION IDENTIFIER IDENTIFIER  */
-#line 1888 "parser.y"
+  case 245: /* command_statement: SET SESSION IDENTIFIER IDENTIFIER  */
+#line 1893 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5729,55 +5741,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5733 "parser.cpp"
+#line 5745 "parser.cpp"
     break;
 
-  case 245: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
-#line 1896 "parser.y"
+  case 246: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
+#line 1901 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5744 "parser.cpp"
+#line 5756 "parser.cpp"
     break;
 
-  case 246: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
-#line 1902 "parser.y"
+  case 247: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
+#line 1907 "parser.y"
                                       {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5755 "parser.cpp"
+#line 5767 "parser.cpp"
     break;
 
-  case 247: /* command_statement: SET GLOBAL IDENTIFIER ON  */
-#line 1908 "parser.y"
+  case 248: /* command_statement: SET GLOBAL IDENTIFIER ON  */
+#line 1913 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5766 "parser.cpp"
+#line 5778 "parser.cpp"
     break;
 
-  case 248: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
-#line 1914 "parser.y"
+  case 249: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
+#line 1919 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5777 "parser.cpp"
+#line 5789 "parser.cpp"
     break;
 
-  case 249: /* command_statement: SET GLOBAL IDENTIFIER IDENTIFIER  */
-#line 1920 "parser.y"
+  case 250: /* command_statement: SET GLOBAL IDENTIFIER IDENTIFIER  */
+#line 1925 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5786,55 +5798,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5790 "parser.cpp"
+#line 5802 "parser.cpp"
     break;
 
-  case 250: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
-#line 1928 "parser.y"
+  case 251: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
+#line 1933 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5801 "parser.cpp"
+#line 5813 "parser.cpp"
     break;
 
-  case 251: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
-#line 1934 "parser.y"
+  case 252: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
+#line 1939 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5812 "parser.cpp"
+#line 5824 "parser.cpp"
     break;
 
-  case 252: /* command_statement: SET CONFIG IDENTIFIER ON  */
-#line 1940 "parser.y"
+  case 253: /* command_statement: SET CONFIG IDENTIFIER ON  */
+#line 1945 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5823 "parser.cpp"
+#line 5835 "parser.cpp"
     break;
 
-  case 253: /* command_statement: SET CONFIG IDENTIFIER OFF  */
-#line 1946 "parser.y"
+  case 254: /* command_statement: SET CONFIG IDENTIFIER OFF  */
+#line 1951 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5834 "parser.cpp"
+#line 5846 "parser.cpp"
     break;
 
-  case 254: /* command_statement: SET CONFIG IDENTIFIER IDENTIFIER  */
-#line 1952 "parser.y"
+  case 255: /* command_statement: SET CONFIG IDENTIFIER IDENTIFIER  */
+#line 1957 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5843,33 +5855,33 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5847 "parser.cpp"
+#line 5859 "parser.cpp"
     break;
 
-  case 255: /* command_statement: SET CONFIG IDENTIFIER LONG_VALUE  */
-#line 1960 "parser.y"
+  case 256: /* command_statement: SET CONFIG IDENTIFIER LONG_VALUE  */
+#line 1965 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5858 "parser.cpp"
+#line 5870 "parser.cpp"
     break;
 
-  case 256: /* command_statement: SET CONFIG IDENTIFIER DOUBLE_VALUE  */
-#line 1966 "parser.y"
+  case 257: /* command_statement: SET CONFIG IDENTIFIER DOUBLE_VALUE  */
+#line 1971 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5869 "parser.cpp"
+#line 5881 "parser.cpp"
     break;
 
-  case 257: /* compact_statement: COMPACT TABLE table_name  */
-#line 1973 "parser.y"
+  case 258: /* compact_statement: COMPACT TABLE table_name  */
+#line 1978 "parser.y"
                                             {
     std::string schema_name;
     if ((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5882,38 +5894,38 @@ yyreduce:
     (yyval.compact_stmt) = new infinity::ManualCompactStatement(std::move(schema_name), std::move(table_name));
     delete (yyvsp[0].table_name_t);
 }
-#line 5886 "parser.cpp"
+#line 5898 "parser.cpp"
     break;
 
-  case 258: /* expr_array: expr_alias  */
-#line 1990 "parser.y"
+  case 259: /* expr_array: expr_alias  */
+#line 1995 "parser.y"
                         {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5895 "parser.cpp"
+#line 5907 "parser.cpp"
     break;
 
-  case 259: /* expr_array: expr_array ',' expr_alias  */
-#line 1994 "parser.y"
+  case 260: /* expr_array: expr_array ',' expr_alias  */
+#line 1999 "parser.y"
                             {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5904 "parser.cpp"
+#line 5916 "parser.cpp"
     break;
 
-  case 260: /* expr_array_list: '(' expr_array ')'  */
-#line 1999 "parser.y"
+  case 261: /* expr_array_list: '(' expr_array ')'  */
+#line 2004 "parser.y"
                                      {
     (yyval.expr_array_list_t) = new std::vector<std::vector<infinity::ParsedExpr*>*>();
     (yyval.expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
 }
-#line 5913 "parser.cpp"
+#line 5925 "parser.cpp"
     break;
 
-  case 261: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
-#line 2003 "parser.y"
+  case 262: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
+#line 2008 "parser.y"
                                          {
     if(!(yyvsp[-4].expr_array_list_t)->empty() && (yyvsp[-4].expr_array_list_t)->back()->size() != (yyvsp[-1].expr_array_t)->size()) {
         yyerror(&yyloc, scanner, result, "The expr_array in list shall have the same size.");
@@ -5929,73 +5941,73 @@ yyreduce:
     (yyvsp[-4].expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
     (yyval.expr_array_list_t) = (yyvsp[-4].expr_array_list_t);
 }
-#line 5933 "parser.cpp"
+#line 5945 "parser.cpp"
     break;
 
-  case 262: /* expr_alias: expr AS IDENTIFIER  */
-#line 2030 "parser.y"
+  case 263: /* expr_alias: expr AS IDENTIFIER  */
+#line 2035 "parser.y"
                                 {
     (yyval.expr_t) = (yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.expr_t)->alias_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5944 "parser.cpp"
+#line 5956 "parser.cpp"
     break;
 
-  case 263: /* expr_alias: expr  */
-#line 2036 "parser.y"
+  case 264: /* expr_alias: expr  */
+#line 2041 "parser.y"
        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5952 "parser.cpp"
+#line 5964 "parser.cpp"
     break;
 
-  case 269: /* operand: '(' expr ')'  */
-#line 2046 "parser.y"
+  case 270: /* operand: '(' expr ')'  */
+#line 2051 "parser.y"
                       {
     (yyval.expr_t) = (yyvsp[-1].expr_t);
 }
-#line 5960 "parser.cpp"
+#line 5972 "parser.cpp"
     break;
 
-  case 270: /* operand: '(' select_without_paren ')'  */
-#line 2049 "parser.y"
+  case 271: /* operand: '(' select_without_paren ')'  */
+#line 2054 "parser.y"
                                {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kScalar;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5971 "parser.cpp"
+#line 5983 "parser.cpp"
     break;
 
-  case 271: /* operand: constant_expr  */
-#line 2055 "parser.y"
+  case 272: /* operand: constant_expr  */
+#line 2060 "parser.y"
                 {
     (yyval.expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 5979 "parser.cpp"
+#line 5991 "parser.cpp"
     break;
 
-  case 282: /* extra_match_tensor_option: ',' STRING  */
-#line 2069 "parser.y"
+  case 283: /* extra_match_tensor_option: ',' STRING  */
+#line 2074 "parser.y"
                                        {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 5987 "parser.cpp"
+#line 5999 "parser.cpp"
     break;
 
-  case 283: /* extra_match_tensor_option: %empty  */
-#line 2072 "parser.y"
+  case 284: /* extra_match_tensor_option: %empty  */
+#line 2077 "parser.y"
   {
     (yyval.str_value) = nullptr;
 }
-#line 5995 "parser.cpp"
+#line 6007 "parser.cpp"
     break;
 
-  case 284: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING extra_match_tensor_option ')'  */
-#line 2078 "parser.y"
+  case 285: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING extra_match_tensor_option ')'  */
+#line 2083 "parser.y"
                                                                                                                            {
     auto match_tensor_expr = std::make_unique<infinity::MatchTensorExpr>();
     // search column
@@ -6012,11 +6024,11 @@ yyreduce:
     }
     (yyval.expr_t) = match_tensor_expr.release();
 }
-#line 6016 "parser.cpp"
+#line 6028 "parser.cpp"
     break;
 
-  case 285: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
-#line 2097 "parser.y"
+  case 286: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
+#line 2102 "parser.y"
                                                                                                                         {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -6058,11 +6070,11 @@ Error1:
 Return1:
     ;
 }
-#line 6062 "parser.cpp"
+#line 6074 "parser.cpp"
     break;
 
-  case 286: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ')' with_index_param_list  */
-#line 2139 "parser.y"
+  case 287: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ')' with_index_param_list  */
+#line 2144 "parser.y"
                                                                                      {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -6105,11 +6117,11 @@ Error2:
 Return2:
     ;
 }
-#line 6109 "parser.cpp"
+#line 6121 "parser.cpp"
     break;
 
-  case 287: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
-#line 2185 "parser.y"
+  case 288: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
+#line 2190 "parser.y"
                                                                                                                           {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -6127,11 +6139,11 @@ Return2:
     // topn and options
     match_sparse_expr->SetOptParams((yyvsp[-2].long_value), (yyvsp[0].with_index_param_list_t));
 }
-#line 6131 "parser.cpp"
+#line 6143 "parser.cpp"
     break;
 
-  case 288: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ')' with_index_param_list  */
-#line 2203 "parser.y"
+  case 289: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ')' with_index_param_list  */
+#line 2208 "parser.y"
                                                                                         {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -6149,11 +6161,11 @@ Return2:
     // topn and options
     match_sparse_expr->SetOptParams(infinity::DEFAULT_MATCH_SPARSE_TOP_N, (yyvsp[0].with_index_param_list_t));
 }
-#line 6153 "parser.cpp"
+#line 6165 "parser.cpp"
     break;
 
-  case 289: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ')'  */
-#line 2221 "parser.y"
+  case 290: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ')'  */
+#line 2226 "parser.y"
                                                        {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-3].str_value));
@@ -6162,11 +6174,11 @@ Return2:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 6166 "parser.cpp"
+#line 6178 "parser.cpp"
     break;
 
-  case 290: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING ')'  */
-#line 2229 "parser.y"
+  case 291: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING ')'  */
+#line 2234 "parser.y"
                                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-5].str_value));
@@ -6177,22 +6189,22 @@ Return2:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 6181 "parser.cpp"
+#line 6193 "parser.cpp"
     break;
 
-  case 291: /* query_expr: QUERY '(' STRING ')'  */
-#line 2240 "parser.y"
+  case 292: /* query_expr: QUERY '(' STRING ')'  */
+#line 2245 "parser.y"
                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 6192 "parser.cpp"
+#line 6204 "parser.cpp"
     break;
 
-  case 292: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
-#line 2246 "parser.y"
+  case 293: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
+#line 2251 "parser.y"
                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-3].str_value));
@@ -6201,22 +6213,22 @@ Return2:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 6205 "parser.cpp"
+#line 6217 "parser.cpp"
     break;
 
-  case 293: /* fusion_expr: FUSION '(' STRING ')'  */
-#line 2255 "parser.y"
+  case 294: /* fusion_expr: FUSION '(' STRING ')'  */
+#line 2260 "parser.y"
                                     {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 6216 "parser.cpp"
+#line 6228 "parser.cpp"
     break;
 
-  case 294: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
-#line 2261 "parser.y"
+  case 295: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
+#line 2266 "parser.y"
                                    {
     auto fusion_expr = std::make_unique<infinity::FusionExpr>();
     fusion_expr->method_ = std::string((yyvsp[-3].str_value));
@@ -6228,77 +6240,77 @@ Return2:
     fusion_expr->JobAfterParser();
     (yyval.expr_t) = fusion_expr.release();
 }
-#line 6232 "parser.cpp"
+#line 6244 "parser.cpp"
     break;
 
-  case 295: /* sub_search: match_vector_expr  */
-#line 2273 "parser.y"
+  case 296: /* sub_search: match_vector_expr  */
+#line 2278 "parser.y"
                                {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6240 "parser.cpp"
+#line 6252 "parser.cpp"
     break;
 
-  case 296: /* sub_search: match_text_expr  */
-#line 2276 "parser.y"
+  case 297: /* sub_search: match_text_expr  */
+#line 2281 "parser.y"
                   {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6248 "parser.cpp"
+#line 6260 "parser.cpp"
     break;
 
-  case 297: /* sub_search: match_tensor_expr  */
-#line 2279 "parser.y"
+  case 298: /* sub_search: match_tensor_expr  */
+#line 2284 "parser.y"
                     {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6256 "parser.cpp"
+#line 6268 "parser.cpp"
     break;
 
-  case 298: /* sub_search: match_sparse_expr  */
-#line 2282 "parser.y"
+  case 299: /* sub_search: match_sparse_expr  */
+#line 2287 "parser.y"
                     {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6264 "parser.cpp"
+#line 6276 "parser.cpp"
     break;
 
-  case 299: /* sub_search: query_expr  */
-#line 2285 "parser.y"
+  case 300: /* sub_search: query_expr  */
+#line 2290 "parser.y"
              {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6272 "parser.cpp"
+#line 6284 "parser.cpp"
     break;
 
-  case 300: /* sub_search: fusion_expr  */
-#line 2288 "parser.y"
+  case 301: /* sub_search: fusion_expr  */
+#line 2293 "parser.y"
               {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6280 "parser.cpp"
+#line 6292 "parser.cpp"
     break;
 
-  case 301: /* sub_search_array: sub_search  */
-#line 2292 "parser.y"
+  case 302: /* sub_search_array: sub_search  */
+#line 2297 "parser.y"
                               {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 6289 "parser.cpp"
+#line 6301 "parser.cpp"
     break;
 
-  case 302: /* sub_search_array: sub_search_array ',' sub_search  */
-#line 2296 "parser.y"
+  case 303: /* sub_search_array: sub_search_array ',' sub_search  */
+#line 2301 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 6298 "parser.cpp"
+#line 6310 "parser.cpp"
     break;
 
-  case 303: /* function_expr: IDENTIFIER '(' ')'  */
-#line 2301 "parser.y"
+  case 304: /* function_expr: IDENTIFIER '(' ')'  */
+#line 2306 "parser.y"
                                    {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -6307,11 +6319,11 @@ Return2:
     func_expr->arguments_ = nullptr;
     (yyval.expr_t) = func_expr;
 }
-#line 6311 "parser.cpp"
+#line 6323 "parser.cpp"
     break;
 
-  case 304: /* function_expr: IDENTIFIER '(' expr_array ')'  */
-#line 2309 "parser.y"
+  case 305: /* function_expr: IDENTIFIER '(' expr_array ')'  */
+#line 2314 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -6320,11 +6332,11 @@ Return2:
     func_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = func_expr;
 }
-#line 6324 "parser.cpp"
+#line 6336 "parser.cpp"
     break;
 
-  case 305: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
-#line 2317 "parser.y"
+  case 306: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
+#line 2322 "parser.y"
                                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -6334,11 +6346,11 @@ Return2:
     func_expr->distinct_ = true;
     (yyval.expr_t) = func_expr;
 }
-#line 6338 "parser.cpp"
+#line 6350 "parser.cpp"
     break;
 
-  case 306: /* function_expr: operand IS NOT NULLABLE  */
-#line 2326 "parser.y"
+  case 307: /* function_expr: operand IS NOT NULLABLE  */
+#line 2331 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_not_null";
@@ -6346,11 +6358,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[-3].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6350 "parser.cpp"
+#line 6362 "parser.cpp"
     break;
 
-  case 307: /* function_expr: operand IS NULLABLE  */
-#line 2333 "parser.y"
+  case 308: /* function_expr: operand IS NULLABLE  */
+#line 2338 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_null";
@@ -6358,11 +6370,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[-2].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6362 "parser.cpp"
+#line 6374 "parser.cpp"
     break;
 
-  case 308: /* function_expr: NOT operand  */
-#line 2340 "parser.y"
+  case 309: /* function_expr: NOT operand  */
+#line 2345 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not";
@@ -6370,11 +6382,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6374 "parser.cpp"
+#line 6386 "parser.cpp"
     break;
 
-  case 309: /* function_expr: '-' operand  */
-#line 2347 "parser.y"
+  case 310: /* function_expr: '-' operand  */
+#line 2352 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -6382,11 +6394,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6386 "parser.cpp"
+#line 6398 "parser.cpp"
     break;
 
-  case 310: /* function_expr: '+' operand  */
-#line 2354 "parser.y"
+  case 311: /* function_expr: '+' operand  */
+#line 2359 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -6394,11 +6406,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6398 "parser.cpp"
+#line 6410 "parser.cpp"
     break;
 
-  case 311: /* function_expr: operand '-' operand  */
-#line 2361 "parser.y"
+  case 312: /* function_expr: operand '-' operand  */
+#line 2366 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -6407,11 +6419,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6411 "parser.cpp"
+#line 6423 "parser.cpp"
     break;
 
-  case 312: /* function_expr: operand '+' operand  */
-#line 2369 "parser.y"
+  case 313: /* function_expr: operand '+' operand  */
+#line 2374 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -6420,11 +6432,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6424 "parser.cpp"
+#line 6436 "parser.cpp"
     break;
 
-  case 313: /* function_expr: operand '*' operand  */
-#line 2377 "parser.y"
+  case 314: /* function_expr: operand '*' operand  */
+#line 2382 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "*";
@@ -6433,11 +6445,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6437 "parser.cpp"
+#line 6449 "parser.cpp"
     break;
 
-  case 314: /* function_expr: operand '/' operand  */
-#line 2385 "parser.y"
+  case 315: /* function_expr: operand '/' operand  */
+#line 2390 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "/";
@@ -6446,11 +6458,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6450 "parser.cpp"
+#line 6462 "parser.cpp"
     break;
 
-  case 315: /* function_expr: operand '%' operand  */
-#line 2393 "parser.y"
+  case 316: /* function_expr: operand '%' operand  */
+#line 2398 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "%";
@@ -6459,11 +6471,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6463 "parser.cpp"
+#line 6475 "parser.cpp"
     break;
 
-  case 316: /* function_expr: operand '=' operand  */
-#line 2401 "parser.y"
+  case 317: /* function_expr: operand '=' operand  */
+#line 2406 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -6472,11 +6484,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6476 "parser.cpp"
+#line 6488 "parser.cpp"
     break;
 
-  case 317: /* function_expr: operand EQUAL operand  */
-#line 2409 "parser.y"
+  case 318: /* function_expr: operand EQUAL operand  */
+#line 2414 "parser.y"
                         {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -6485,11 +6497,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6489 "parser.cpp"
+#line 6501 "parser.cpp"
     break;
 
-  case 318: /* function_expr: operand NOT_EQ operand  */
-#line 2417 "parser.y"
+  case 319: /* function_expr: operand NOT_EQ operand  */
+#line 2422 "parser.y"
                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<>";
@@ -6498,11 +6510,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6502 "parser.cpp"
+#line 6514 "parser.cpp"
     break;
 
-  case 319: /* function_expr: operand '<' operand  */
-#line 2425 "parser.y"
+  case 320: /* function_expr: operand '<' operand  */
+#line 2430 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<";
@@ -6511,11 +6523,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6515 "parser.cpp"
+#line 6527 "parser.cpp"
     break;
 
-  case 320: /* function_expr: operand '>' operand  */
-#line 2433 "parser.y"
+  case 321: /* function_expr: operand '>' operand  */
+#line 2438 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">";
@@ -6524,11 +6536,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6528 "parser.cpp"
+#line 6540 "parser.cpp"
     break;
 
-  case 321: /* function_expr: operand LESS_EQ operand  */
-#line 2441 "parser.y"
+  case 322: /* function_expr: operand LESS_EQ operand  */
+#line 2446 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<=";
@@ -6537,11 +6549,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6541 "parser.cpp"
+#line 6553 "parser.cpp"
     break;
 
-  case 322: /* function_expr: operand GREATER_EQ operand  */
-#line 2449 "parser.y"
+  case 323: /* function_expr: operand GREATER_EQ operand  */
+#line 2454 "parser.y"
                              {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">=";
@@ -6550,11 +6562,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6554 "parser.cpp"
+#line 6566 "parser.cpp"
     break;
 
-  case 323: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
-#line 2457 "parser.y"
+  case 324: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
+#line 2462 "parser.y"
                                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -6585,11 +6597,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6589 "parser.cpp"
+#line 6601 "parser.cpp"
     break;
 
-  case 324: /* function_expr: operand LIKE operand  */
-#line 2487 "parser.y"
+  case 325: /* function_expr: operand LIKE operand  */
+#line 2492 "parser.y"
                        {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "like";
@@ -6598,11 +6610,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6602 "parser.cpp"
+#line 6614 "parser.cpp"
     break;
 
-  case 325: /* function_expr: operand NOT LIKE operand  */
-#line 2495 "parser.y"
+  case 326: /* function_expr: operand NOT LIKE operand  */
+#line 2500 "parser.y"
                            {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not_like";
@@ -6611,11 +6623,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6615 "parser.cpp"
+#line 6627 "parser.cpp"
     break;
 
-  case 326: /* conjunction_expr: expr AND expr  */
-#line 2504 "parser.y"
+  case 327: /* conjunction_expr: expr AND expr  */
+#line 2509 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "and";
@@ -6624,11 +6636,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6628 "parser.cpp"
+#line 6640 "parser.cpp"
     break;
 
-  case 327: /* conjunction_expr: expr OR expr  */
-#line 2512 "parser.y"
+  case 328: /* conjunction_expr: expr OR expr  */
+#line 2517 "parser.y"
                {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "or";
@@ -6637,11 +6649,11 @@ Return2:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6641 "parser.cpp"
+#line 6653 "parser.cpp"
     break;
 
-  case 328: /* between_expr: operand BETWEEN operand AND operand  */
-#line 2521 "parser.y"
+  case 329: /* between_expr: operand BETWEEN operand AND operand  */
+#line 2526 "parser.y"
                                                   {
     infinity::BetweenExpr* between_expr = new infinity::BetweenExpr();
     between_expr->value_ = (yyvsp[-4].expr_t);
@@ -6649,44 +6661,44 @@ Return2:
     between_expr->upper_bound_ = (yyvsp[0].expr_t);
     (yyval.expr_t) = between_expr;
 }
-#line 6653 "parser.cpp"
+#line 6665 "parser.cpp"
     break;
 
-  case 329: /* in_expr: operand IN '(' expr_array ')'  */
-#line 2529 "parser.y"
+  case 330: /* in_expr: operand IN '(' expr_array ')'  */
+#line 2534 "parser.y"
                                        {
     infinity::InExpr* in_expr = new infinity::InExpr(true);
     in_expr->left_ = (yyvsp[-4].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 6664 "parser.cpp"
+#line 6676 "parser.cpp"
     break;
 
-  case 330: /* in_expr: operand NOT IN '(' expr_array ')'  */
-#line 2535 "parser.y"
+  case 331: /* in_expr: operand NOT IN '(' expr_array ')'  */
+#line 2540 "parser.y"
                                     {
     infinity::InExpr* in_expr = new infinity::InExpr(false);
     in_expr->left_ = (yyvsp[-5].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 6675 "parser.cpp"
+#line 6687 "parser.cpp"
     break;
 
-  case 331: /* case_expr: CASE expr case_check_array END  */
-#line 2542 "parser.y"
+  case 332: /* case_expr: CASE expr case_check_array END  */
+#line 2547 "parser.y"
                                           {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-2].expr_t);
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6686 "parser.cpp"
+#line 6698 "parser.cpp"
     break;
 
-  case 332: /* case_expr: CASE expr case_check_array ELSE expr END  */
-#line 2548 "parser.y"
+  case 333: /* case_expr: CASE expr case_check_array ELSE expr END  */
+#line 2553 "parser.y"
                                            {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-4].expr_t);
@@ -6694,32 +6706,32 @@ Return2:
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6698 "parser.cpp"
+#line 6710 "parser.cpp"
     break;
 
-  case 333: /* case_expr: CASE case_check_array END  */
-#line 2555 "parser.y"
+  case 334: /* case_expr: CASE case_check_array END  */
+#line 2560 "parser.y"
                             {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6708 "parser.cpp"
+#line 6720 "parser.cpp"
     break;
 
-  case 334: /* case_expr: CASE case_check_array ELSE expr END  */
-#line 2560 "parser.y"
+  case 335: /* case_expr: CASE case_check_array ELSE expr END  */
+#line 2565 "parser.y"
                                       {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-3].case_check_array_t);
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6719 "parser.cpp"
+#line 6731 "parser.cpp"
     break;
 
-  case 335: /* case_check_array: WHEN expr THEN expr  */
-#line 2567 "parser.y"
+  case 336: /* case_check_array: WHEN expr THEN expr  */
+#line 2572 "parser.y"
                                       {
     (yyval.case_check_array_t) = new std::vector<infinity::WhenThen*>();
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
@@ -6727,11 +6739,11 @@ Return2:
     when_then_ptr->then_ = (yyvsp[0].expr_t);
     (yyval.case_check_array_t)->emplace_back(when_then_ptr);
 }
-#line 6731 "parser.cpp"
+#line 6743 "parser.cpp"
     break;
 
-  case 336: /* case_check_array: case_check_array WHEN expr THEN expr  */
-#line 2574 "parser.y"
+  case 337: /* case_check_array: case_check_array WHEN expr THEN expr  */
+#line 2579 "parser.y"
                                        {
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
     when_then_ptr->when_ = (yyvsp[-2].expr_t);
@@ -6739,11 +6751,11 @@ Return2:
     (yyvsp[-4].case_check_array_t)->emplace_back(when_then_ptr);
     (yyval.case_check_array_t) = (yyvsp[-4].case_check_array_t);
 }
-#line 6743 "parser.cpp"
+#line 6755 "parser.cpp"
     break;
 
-  case 337: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 2582 "parser.y"
+  case 338: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 2587 "parser.y"
                                             {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -6767,33 +6779,33 @@ Return2:
     cast_expr->expr_ = (yyvsp[-3].expr_t);
     (yyval.expr_t) = cast_expr;
 }
-#line 6771 "parser.cpp"
+#line 6783 "parser.cpp"
     break;
 
-  case 338: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
-#line 2606 "parser.y"
+  case 339: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
+#line 2611 "parser.y"
                                                    {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6782 "parser.cpp"
+#line 6794 "parser.cpp"
     break;
 
-  case 339: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
-#line 2612 "parser.y"
+  case 340: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
+#line 2617 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6793 "parser.cpp"
+#line 6805 "parser.cpp"
     break;
 
-  case 340: /* subquery_expr: operand IN '(' select_without_paren ')'  */
-#line 2618 "parser.y"
+  case 341: /* subquery_expr: operand IN '(' select_without_paren ')'  */
+#line 2623 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kIn;
@@ -6801,11 +6813,11 @@ Return2:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6805 "parser.cpp"
+#line 6817 "parser.cpp"
     break;
 
-  case 341: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
-#line 2625 "parser.y"
+  case 342: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
+#line 2630 "parser.y"
                                               {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotIn;
@@ -6813,11 +6825,11 @@ Return2:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6817 "parser.cpp"
+#line 6829 "parser.cpp"
     break;
 
-  case 342: /* column_expr: IDENTIFIER  */
-#line 2633 "parser.y"
+  case 343: /* column_expr: IDENTIFIER  */
+#line 2638 "parser.y"
                          {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6825,11 +6837,11 @@ Return2:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 6829 "parser.cpp"
+#line 6841 "parser.cpp"
     break;
 
-  case 343: /* column_expr: column_expr '.' IDENTIFIER  */
-#line 2640 "parser.y"
+  case 344: /* column_expr: column_expr '.' IDENTIFIER  */
+#line 2645 "parser.y"
                              {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6837,21 +6849,21 @@ Return2:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 6841 "parser.cpp"
+#line 6853 "parser.cpp"
     break;
 
-  case 344: /* column_expr: '*'  */
-#line 2647 "parser.y"
+  case 345: /* column_expr: '*'  */
+#line 2652 "parser.y"
       {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6851 "parser.cpp"
+#line 6863 "parser.cpp"
     break;
 
-  case 345: /* column_expr: column_expr '.' '*'  */
-#line 2652 "parser.y"
+  case 346: /* column_expr: column_expr '.' '*'  */
+#line 2657 "parser.y"
                       {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     if(column_expr->star_) {
@@ -6861,232 +6873,232 @@ Return2:
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6865 "parser.cpp"
+#line 6877 "parser.cpp"
     break;
 
-  case 346: /* constant_expr: STRING  */
-#line 2662 "parser.y"
+  case 347: /* constant_expr: STRING  */
+#line 2667 "parser.y"
                       {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6875 "parser.cpp"
+#line 6887 "parser.cpp"
     break;
 
-  case 347: /* constant_expr: TRUE  */
-#line 2667 "parser.y"
+  case 348: /* constant_expr: TRUE  */
+#line 2672 "parser.y"
        {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = true;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6885 "parser.cpp"
+#line 6897 "parser.cpp"
     break;
 
-  case 348: /* constant_expr: FALSE  */
-#line 2672 "parser.y"
+  case 349: /* constant_expr: FALSE  */
+#line 2677 "parser.y"
         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = false;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6895 "parser.cpp"
+#line 6907 "parser.cpp"
     break;
 
-  case 349: /* constant_expr: DOUBLE_VALUE  */
-#line 2677 "parser.y"
+  case 350: /* constant_expr: DOUBLE_VALUE  */
+#line 2682 "parser.y"
                {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDouble);
     const_expr->double_value_ = (yyvsp[0].double_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6905 "parser.cpp"
+#line 6917 "parser.cpp"
     break;
 
-  case 350: /* constant_expr: LONG_VALUE  */
-#line 2682 "parser.y"
+  case 351: /* constant_expr: LONG_VALUE  */
+#line 2687 "parser.y"
              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInteger);
     const_expr->integer_value_ = (yyvsp[0].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6915 "parser.cpp"
+#line 6927 "parser.cpp"
     break;
 
-  case 351: /* constant_expr: DATE STRING  */
-#line 2687 "parser.y"
+  case 352: /* constant_expr: DATE STRING  */
+#line 2692 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDate);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6925 "parser.cpp"
+#line 6937 "parser.cpp"
     break;
 
-  case 352: /* constant_expr: TIME STRING  */
-#line 2692 "parser.y"
+  case 353: /* constant_expr: TIME STRING  */
+#line 2697 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6935 "parser.cpp"
+#line 6947 "parser.cpp"
     break;
 
-  case 353: /* constant_expr: DATETIME STRING  */
-#line 2697 "parser.y"
+  case 354: /* constant_expr: DATETIME STRING  */
+#line 2702 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDateTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6945 "parser.cpp"
+#line 6957 "parser.cpp"
     break;
 
-  case 354: /* constant_expr: TIMESTAMP STRING  */
-#line 2702 "parser.y"
+  case 355: /* constant_expr: TIMESTAMP STRING  */
+#line 2707 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTimestamp);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6955 "parser.cpp"
+#line 6967 "parser.cpp"
     break;
 
-  case 355: /* constant_expr: INTERVAL interval_expr  */
-#line 2707 "parser.y"
+  case 356: /* constant_expr: INTERVAL interval_expr  */
+#line 2712 "parser.y"
                          {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6963 "parser.cpp"
+#line 6975 "parser.cpp"
     break;
 
-  case 356: /* constant_expr: interval_expr  */
-#line 2710 "parser.y"
+  case 357: /* constant_expr: interval_expr  */
+#line 2715 "parser.y"
                 {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6971 "parser.cpp"
+#line 6983 "parser.cpp"
     break;
 
-  case 357: /* constant_expr: common_array_expr  */
-#line 2713 "parser.y"
+  case 358: /* constant_expr: common_array_expr  */
+#line 2718 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6979 "parser.cpp"
+#line 6991 "parser.cpp"
     break;
 
-  case 358: /* common_array_expr: array_expr  */
-#line 2717 "parser.y"
+  case 359: /* common_array_expr: array_expr  */
+#line 2722 "parser.y"
                               {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6987 "parser.cpp"
+#line 6999 "parser.cpp"
     break;
 
-  case 359: /* common_array_expr: subarray_array_expr  */
-#line 2720 "parser.y"
+  case 360: /* common_array_expr: subarray_array_expr  */
+#line 2725 "parser.y"
                       {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6995 "parser.cpp"
+#line 7007 "parser.cpp"
     break;
 
-  case 360: /* common_array_expr: sparse_array_expr  */
-#line 2723 "parser.y"
+  case 361: /* common_array_expr: sparse_array_expr  */
+#line 2728 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7003 "parser.cpp"
+#line 7015 "parser.cpp"
     break;
 
-  case 361: /* common_array_expr: empty_array_expr  */
-#line 2726 "parser.y"
+  case 362: /* common_array_expr: empty_array_expr  */
+#line 2731 "parser.y"
                    {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7011 "parser.cpp"
+#line 7023 "parser.cpp"
     break;
 
-  case 362: /* common_sparse_array_expr: sparse_array_expr  */
-#line 2730 "parser.y"
+  case 363: /* common_sparse_array_expr: sparse_array_expr  */
+#line 2735 "parser.y"
                                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7019 "parser.cpp"
+#line 7031 "parser.cpp"
     break;
 
-  case 363: /* common_sparse_array_expr: array_expr  */
-#line 2733 "parser.y"
+  case 364: /* common_sparse_array_expr: array_expr  */
+#line 2738 "parser.y"
              {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7027 "parser.cpp"
+#line 7039 "parser.cpp"
     break;
 
-  case 364: /* common_sparse_array_expr: empty_array_expr  */
-#line 2736 "parser.y"
+  case 365: /* common_sparse_array_expr: empty_array_expr  */
+#line 2741 "parser.y"
                    {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7035 "parser.cpp"
+#line 7047 "parser.cpp"
     break;
 
-  case 365: /* subarray_array_expr: unclosed_subarray_array_expr ']'  */
-#line 2740 "parser.y"
+  case 366: /* subarray_array_expr: unclosed_subarray_array_expr ']'  */
+#line 2745 "parser.y"
                                                       {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 7043 "parser.cpp"
+#line 7055 "parser.cpp"
     break;
 
-  case 366: /* unclosed_subarray_array_expr: '[' common_array_expr  */
-#line 2744 "parser.y"
+  case 367: /* unclosed_subarray_array_expr: '[' common_array_expr  */
+#line 2749 "parser.y"
                                                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kSubArrayArray);
     const_expr->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = const_expr;
 }
-#line 7053 "parser.cpp"
+#line 7065 "parser.cpp"
     break;
 
-  case 367: /* unclosed_subarray_array_expr: unclosed_subarray_array_expr ',' common_array_expr  */
-#line 2749 "parser.y"
+  case 368: /* unclosed_subarray_array_expr: unclosed_subarray_array_expr ',' common_array_expr  */
+#line 2754 "parser.y"
                                                      {
     (yyvsp[-2].const_expr_t)->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 7062 "parser.cpp"
+#line 7074 "parser.cpp"
     break;
 
-  case 368: /* sparse_array_expr: long_sparse_array_expr  */
-#line 2754 "parser.y"
+  case 369: /* sparse_array_expr: long_sparse_array_expr  */
+#line 2759 "parser.y"
                                           {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7070 "parser.cpp"
+#line 7082 "parser.cpp"
     break;
 
-  case 369: /* sparse_array_expr: double_sparse_array_expr  */
-#line 2757 "parser.y"
+  case 370: /* sparse_array_expr: double_sparse_array_expr  */
+#line 2762 "parser.y"
                            {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7078 "parser.cpp"
+#line 7090 "parser.cpp"
     break;
 
-  case 370: /* long_sparse_array_expr: unclosed_long_sparse_array_expr ']'  */
-#line 2761 "parser.y"
+  case 371: /* long_sparse_array_expr: unclosed_long_sparse_array_expr ']'  */
+#line 2766 "parser.y"
                                                             {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 7086 "parser.cpp"
+#line 7098 "parser.cpp"
     break;
 
-  case 371: /* unclosed_long_sparse_array_expr: '[' int_sparse_ele  */
-#line 2765 "parser.y"
+  case 372: /* unclosed_long_sparse_array_expr: '[' int_sparse_ele  */
+#line 2770 "parser.y"
                                                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kLongSparseArray);
     const_expr->long_sparse_array_.first.emplace_back((yyvsp[0].int_sparse_ele_t)->first);
@@ -7094,30 +7106,30 @@ Return2:
     delete (yyvsp[0].int_sparse_ele_t);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7098 "parser.cpp"
+#line 7110 "parser.cpp"
     break;
 
-  case 372: /* unclosed_long_sparse_array_expr: unclosed_long_sparse_array_expr ',' int_sparse_ele  */
-#line 2772 "parser.y"
+  case 373: /* unclosed_long_sparse_array_expr: unclosed_long_sparse_array_expr ',' int_sparse_ele  */
+#line 2777 "parser.y"
                                                      {
     (yyvsp[-2].const_expr_t)->long_sparse_array_.first.emplace_back((yyvsp[0].int_sparse_ele_t)->first);
     (yyvsp[-2].const_expr_t)->long_sparse_array_.second.emplace_back((yyvsp[0].int_sparse_ele_t)->second);
     delete (yyvsp[0].int_sparse_ele_t);
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 7109 "parser.cpp"
+#line 7121 "parser.cpp"
     break;
 
-  case 373: /* double_sparse_array_expr: unclosed_double_sparse_array_expr ']'  */
-#line 2779 "parser.y"
+  case 374: /* double_sparse_array_expr: unclosed_double_sparse_array_expr ']'  */
+#line 2784 "parser.y"
                                                                 {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 7117 "parser.cpp"
+#line 7129 "parser.cpp"
     break;
 
-  case 374: /* unclosed_double_sparse_array_expr: '[' float_sparse_ele  */
-#line 2783 "parser.y"
+  case 375: /* unclosed_double_sparse_array_expr: '[' float_sparse_ele  */
+#line 2788 "parser.y"
                                                         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleSparseArray);
     const_expr->double_sparse_array_.first.emplace_back((yyvsp[0].float_sparse_ele_t)->first);
@@ -7125,266 +7137,266 @@ Return2:
     delete (yyvsp[0].float_sparse_ele_t);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7129 "parser.cpp"
+#line 7141 "parser.cpp"
     break;
 
-  case 375: /* unclosed_double_sparse_array_expr: unclosed_double_sparse_array_expr ',' float_sparse_ele  */
-#line 2790 "parser.y"
+  case 376: /* unclosed_double_sparse_array_expr: unclosed_double_sparse_array_expr ',' float_sparse_ele  */
+#line 2795 "parser.y"
                                                          {
     (yyvsp[-2].const_expr_t)->double_sparse_array_.first.emplace_back((yyvsp[0].float_sparse_ele_t)->first);
     (yyvsp[-2].const_expr_t)->double_sparse_array_.second.emplace_back((yyvsp[0].float_sparse_ele_t)->second);
     delete (yyvsp[0].float_sparse_ele_t);
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 7140 "parser.cpp"
+#line 7152 "parser.cpp"
     break;
 
-  case 376: /* empty_array_expr: '[' ']'  */
-#line 2797 "parser.y"
+  case 377: /* empty_array_expr: '[' ']'  */
+#line 2802 "parser.y"
                           {
     (yyval.const_expr_t) = new infinity::ConstantExpr(infinity::LiteralType::kEmptyArray);
 }
-#line 7148 "parser.cpp"
+#line 7160 "parser.cpp"
     break;
 
-  case 377: /* int_sparse_ele: LONG_VALUE ':' LONG_VALUE  */
-#line 2801 "parser.y"
+  case 378: /* int_sparse_ele: LONG_VALUE ':' LONG_VALUE  */
+#line 2806 "parser.y"
                                           {
     (yyval.int_sparse_ele_t) = new std::pair<int64_t, int64_t>{(yyvsp[-2].long_value), (yyvsp[0].long_value)};
 }
-#line 7156 "parser.cpp"
+#line 7168 "parser.cpp"
     break;
 
-  case 378: /* float_sparse_ele: LONG_VALUE ':' DOUBLE_VALUE  */
-#line 2805 "parser.y"
+  case 379: /* float_sparse_ele: LONG_VALUE ':' DOUBLE_VALUE  */
+#line 2810 "parser.y"
                                               {
     (yyval.float_sparse_ele_t) = new std::pair<int64_t, double>{(yyvsp[-2].long_value), (yyvsp[0].double_value)};
 }
-#line 7164 "parser.cpp"
+#line 7176 "parser.cpp"
     break;
 
-  case 379: /* array_expr: long_array_expr  */
-#line 2809 "parser.y"
+  case 380: /* array_expr: long_array_expr  */
+#line 2814 "parser.y"
                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7172 "parser.cpp"
+#line 7184 "parser.cpp"
     break;
 
-  case 380: /* array_expr: double_array_expr  */
-#line 2812 "parser.y"
+  case 381: /* array_expr: double_array_expr  */
+#line 2817 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7180 "parser.cpp"
+#line 7192 "parser.cpp"
     break;
 
-  case 381: /* long_array_expr: unclosed_long_array_expr ']'  */
-#line 2816 "parser.y"
+  case 382: /* long_array_expr: unclosed_long_array_expr ']'  */
+#line 2821 "parser.y"
                                               {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 7188 "parser.cpp"
+#line 7200 "parser.cpp"
     break;
 
-  case 382: /* unclosed_long_array_expr: '[' LONG_VALUE  */
-#line 2820 "parser.y"
+  case 383: /* unclosed_long_array_expr: '[' LONG_VALUE  */
+#line 2825 "parser.y"
                                          {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kIntegerArray);
     const_expr->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 7198 "parser.cpp"
+#line 7210 "parser.cpp"
     break;
 
-  case 383: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
-#line 2825 "parser.y"
+  case 384: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
+#line 2830 "parser.y"
                                           {
     (yyvsp[-2].const_expr_t)->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 7207 "parser.cpp"
+#line 7219 "parser.cpp"
     break;
 
-  case 384: /* double_array_expr: unclosed_double_array_expr ']'  */
-#line 2830 "parser.y"
+  case 385: /* double_array_expr: unclosed_double_array_expr ']'  */
+#line 2835 "parser.y"
                                                   {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 7215 "parser.cpp"
+#line 7227 "parser.cpp"
     break;
 
-  case 385: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
-#line 2834 "parser.y"
+  case 386: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
+#line 2839 "parser.y"
                                              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleArray);
     const_expr->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 7225 "parser.cpp"
+#line 7237 "parser.cpp"
     break;
 
-  case 386: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
-#line 2839 "parser.y"
+  case 387: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
+#line 2844 "parser.y"
                                               {
     (yyvsp[-2].const_expr_t)->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 7234 "parser.cpp"
+#line 7246 "parser.cpp"
     break;
 
-  case 387: /* interval_expr: LONG_VALUE SECONDS  */
-#line 2844 "parser.y"
+  case 388: /* interval_expr: LONG_VALUE SECONDS  */
+#line 2849 "parser.y"
                                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7245 "parser.cpp"
+#line 7257 "parser.cpp"
     break;
 
-  case 388: /* interval_expr: LONG_VALUE SECOND  */
-#line 2850 "parser.y"
+  case 389: /* interval_expr: LONG_VALUE SECOND  */
+#line 2855 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7256 "parser.cpp"
+#line 7268 "parser.cpp"
     break;
 
-  case 389: /* interval_expr: LONG_VALUE MINUTES  */
-#line 2856 "parser.y"
+  case 390: /* interval_expr: LONG_VALUE MINUTES  */
+#line 2861 "parser.y"
                      {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7267 "parser.cpp"
+#line 7279 "parser.cpp"
     break;
 
-  case 390: /* interval_expr: LONG_VALUE MINUTE  */
-#line 2862 "parser.y"
+  case 391: /* interval_expr: LONG_VALUE MINUTE  */
+#line 2867 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7278 "parser.cpp"
+#line 7290 "parser.cpp"
     break;
 
-  case 391: /* interval_expr: LONG_VALUE HOURS  */
-#line 2868 "parser.y"
+  case 392: /* interval_expr: LONG_VALUE HOURS  */
+#line 2873 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7289 "parser.cpp"
+#line 7301 "parser.cpp"
     break;
 
-  case 392: /* interval_expr: LONG_VALUE HOUR  */
-#line 2874 "parser.y"
+  case 393: /* interval_expr: LONG_VALUE HOUR  */
+#line 2879 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7300 "parser.cpp"
+#line 7312 "parser.cpp"
     break;
 
-  case 393: /* interval_expr: LONG_VALUE DAYS  */
-#line 2880 "parser.y"
+  case 394: /* interval_expr: LONG_VALUE DAYS  */
+#line 2885 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7311 "parser.cpp"
+#line 7323 "parser.cpp"
     break;
 
-  case 394: /* interval_expr: LONG_VALUE DAY  */
-#line 2886 "parser.y"
+  case 395: /* interval_expr: LONG_VALUE DAY  */
+#line 2891 "parser.y"
                  {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7322 "parser.cpp"
+#line 7334 "parser.cpp"
     break;
 
-  case 395: /* interval_expr: LONG_VALUE MONTHS  */
-#line 2892 "parser.y"
+  case 396: /* interval_expr: LONG_VALUE MONTHS  */
+#line 2897 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7333 "parser.cpp"
+#line 7345 "parser.cpp"
     break;
 
-  case 396: /* interval_expr: LONG_VALUE MONTH  */
-#line 2898 "parser.y"
+  case 397: /* interval_expr: LONG_VALUE MONTH  */
+#line 2903 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7344 "parser.cpp"
+#line 7356 "parser.cpp"
     break;
 
-  case 397: /* interval_expr: LONG_VALUE YEARS  */
-#line 2904 "parser.y"
+  case 398: /* interval_expr: LONG_VALUE YEARS  */
+#line 2909 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7355 "parser.cpp"
+#line 7367 "parser.cpp"
     break;
 
-  case 398: /* interval_expr: LONG_VALUE YEAR  */
-#line 2910 "parser.y"
+  case 399: /* interval_expr: LONG_VALUE YEAR  */
+#line 2915 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7366 "parser.cpp"
+#line 7378 "parser.cpp"
     break;
 
-  case 399: /* copy_option_list: copy_option  */
-#line 2921 "parser.y"
+  case 400: /* copy_option_list: copy_option  */
+#line 2926 "parser.y"
                                {
     (yyval.copy_option_array) = new std::vector<infinity::CopyOption*>();
     (yyval.copy_option_array)->push_back((yyvsp[0].copy_option_t));
 }
-#line 7375 "parser.cpp"
+#line 7387 "parser.cpp"
     break;
 
-  case 400: /* copy_option_list: copy_option_list ',' copy_option  */
-#line 2925 "parser.y"
+  case 401: /* copy_option_list: copy_option_list ',' copy_option  */
+#line 2930 "parser.y"
                                    {
     (yyvsp[-2].copy_option_array)->push_back((yyvsp[0].copy_option_t));
     (yyval.copy_option_array) = (yyvsp[-2].copy_option_array);
 }
-#line 7384 "parser.cpp"
+#line 7396 "parser.cpp"
     break;
 
-  case 401: /* copy_option: FORMAT IDENTIFIER  */
-#line 2930 "parser.y"
+  case 402: /* copy_option: FORMAT IDENTIFIER  */
+#line 2935 "parser.y"
                                 {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kFormat;
@@ -7413,11 +7425,11 @@ Return2:
         YYERROR;
     }
 }
-#line 7417 "parser.cpp"
+#line 7429 "parser.cpp"
     break;
 
-  case 402: /* copy_option: DELIMITER STRING  */
-#line 2958 "parser.y"
+  case 403: /* copy_option: DELIMITER STRING  */
+#line 2963 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kDelimiter;
@@ -7428,53 +7440,53 @@ Return2:
     }
     free((yyvsp[0].str_value));
 }
-#line 7432 "parser.cpp"
+#line 7444 "parser.cpp"
     break;
 
-  case 403: /* copy_option: HEADER  */
-#line 2968 "parser.y"
+  case 404: /* copy_option: HEADER  */
+#line 2973 "parser.y"
          {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kHeader;
     (yyval.copy_option_t)->header_ = true;
 }
-#line 7442 "parser.cpp"
+#line 7454 "parser.cpp"
     break;
 
-  case 404: /* file_path: STRING  */
-#line 2974 "parser.y"
+  case 405: /* file_path: STRING  */
+#line 2979 "parser.y"
                    {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 7450 "parser.cpp"
+#line 7462 "parser.cpp"
     break;
 
-  case 405: /* if_exists: IF EXISTS  */
-#line 2978 "parser.y"
+  case 406: /* if_exists: IF EXISTS  */
+#line 2983 "parser.y"
                      { (yyval.bool_value) = true; }
-#line 7456 "parser.cpp"
+#line 7468 "parser.cpp"
     break;
 
-  case 406: /* if_exists: %empty  */
-#line 2979 "parser.y"
+  case 407: /* if_exists: %empty  */
+#line 2984 "parser.y"
   { (yyval.bool_value) = false; }
-#line 7462 "parser.cpp"
+#line 7474 "parser.cpp"
     break;
 
-  case 407: /* if_not_exists: IF NOT EXISTS  */
-#line 2981 "parser.y"
+  case 408: /* if_not_exists: IF NOT EXISTS  */
+#line 2986 "parser.y"
                               { (yyval.bool_value) = true; }
-#line 7468 "parser.cpp"
+#line 7480 "parser.cpp"
     break;
 
-  case 408: /* if_not_exists: %empty  */
-#line 2982 "parser.y"
+  case 409: /* if_not_exists: %empty  */
+#line 2987 "parser.y"
   { (yyval.bool_value) = false; }
-#line 7474 "parser.cpp"
+#line 7486 "parser.cpp"
     break;
 
-  case 411: /* if_not_exists_info: if_not_exists IDENTIFIER  */
-#line 2997 "parser.y"
+  case 412: /* if_not_exists_info: if_not_exists IDENTIFIER  */
+#line 3002 "parser.y"
                                               {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
     (yyval.if_not_exists_info_t)->exists_ = true;
@@ -7483,80 +7495,80 @@ Return2:
     (yyval.if_not_exists_info_t)->info_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 7487 "parser.cpp"
+#line 7499 "parser.cpp"
     break;
 
-  case 412: /* if_not_exists_info: %empty  */
-#line 3005 "parser.y"
+  case 413: /* if_not_exists_info: %empty  */
+#line 3010 "parser.y"
   {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
 }
-#line 7495 "parser.cpp"
+#line 7507 "parser.cpp"
     break;
 
-  case 413: /* with_index_param_list: WITH '(' index_param_list ')'  */
-#line 3009 "parser.y"
+  case 414: /* with_index_param_list: WITH '(' index_param_list ')'  */
+#line 3014 "parser.y"
                                                       {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 7503 "parser.cpp"
+#line 7515 "parser.cpp"
     break;
 
-  case 414: /* with_index_param_list: %empty  */
-#line 3012 "parser.y"
+  case 415: /* with_index_param_list: %empty  */
+#line 3017 "parser.y"
   {
     (yyval.with_index_param_list_t) = new std::vector<infinity::InitParameter*>();
 }
-#line 7511 "parser.cpp"
+#line 7523 "parser.cpp"
     break;
 
-  case 415: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
-#line 3016 "parser.y"
+  case 416: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
+#line 3021 "parser.y"
                                                                      {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 7519 "parser.cpp"
+#line 7531 "parser.cpp"
     break;
 
-  case 416: /* optional_table_properties_list: %empty  */
-#line 3019 "parser.y"
+  case 417: /* optional_table_properties_list: %empty  */
+#line 3024 "parser.y"
   {
     (yyval.with_index_param_list_t) = nullptr;
 }
-#line 7527 "parser.cpp"
+#line 7539 "parser.cpp"
     break;
 
-  case 417: /* index_param_list: index_param  */
-#line 3023 "parser.y"
+  case 418: /* index_param_list: index_param  */
+#line 3028 "parser.y"
                                {
     (yyval.index_param_list_t) = new std::vector<infinity::InitParameter*>();
     (yyval.index_param_list_t)->push_back((yyvsp[0].index_param_t));
 }
-#line 7536 "parser.cpp"
+#line 7548 "parser.cpp"
     break;
 
-  case 418: /* index_param_list: index_param_list ',' index_param  */
-#line 3027 "parser.y"
+  case 419: /* index_param_list: index_param_list ',' index_param  */
+#line 3032 "parser.y"
                                    {
     (yyvsp[-2].index_param_list_t)->push_back((yyvsp[0].index_param_t));
     (yyval.index_param_list_t) = (yyvsp[-2].index_param_list_t);
 }
-#line 7545 "parser.cpp"
+#line 7557 "parser.cpp"
     break;
 
-  case 419: /* index_param: IDENTIFIER  */
-#line 3032 "parser.y"
+  case 420: /* index_param: IDENTIFIER  */
+#line 3037 "parser.y"
                          {
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 7556 "parser.cpp"
+#line 7568 "parser.cpp"
     break;
 
-  case 420: /* index_param: IDENTIFIER '=' IDENTIFIER  */
-#line 3038 "parser.y"
+  case 421: /* index_param: IDENTIFIER '=' IDENTIFIER  */
+#line 3043 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -7567,11 +7579,11 @@ Return2:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 7571 "parser.cpp"
+#line 7583 "parser.cpp"
     break;
 
-  case 421: /* index_param: IDENTIFIER '=' LONG_VALUE  */
-#line 3048 "parser.y"
+  case 422: /* index_param: IDENTIFIER '=' LONG_VALUE  */
+#line 3053 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -7579,11 +7591,11 @@ Return2:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].long_value));
 }
-#line 7583 "parser.cpp"
+#line 7595 "parser.cpp"
     break;
 
-  case 422: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
-#line 3055 "parser.y"
+  case 423: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
+#line 3060 "parser.y"
                               {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -7591,11 +7603,11 @@ Return2:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].double_value));
 }
-#line 7595 "parser.cpp"
+#line 7607 "parser.cpp"
     break;
 
-  case 423: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 3066 "parser.y"
+  case 424: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 3071 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -7609,6 +7621,8 @@ Return2:
         index_type = infinity::IndexType::kIVFFlat;
     } else if (strcmp((yyvsp[-1].str_value), "emvb") == 0) {
         index_type = infinity::IndexType::kEMVB;
+    } else if (strcmp((yyvsp[-1].str_value), "diskann") == 0) {
+        index_type = infinity::IndexType::kDiskAnn;
     } else {
         free((yyvsp[-1].str_value));
         delete (yyvsp[-4].identifier_array_t);
@@ -7648,11 +7662,11 @@ Return2:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 7652 "parser.cpp"
+#line 7666 "parser.cpp"
     break;
 
-  case 424: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 3118 "parser.y"
+  case 425: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 3125 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -7702,11 +7716,11 @@ Return2:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 7706 "parser.cpp"
+#line 7720 "parser.cpp"
     break;
 
-  case 425: /* index_info_list: '(' identifier_array ')'  */
-#line 3167 "parser.y"
+  case 426: /* index_info_list: '(' identifier_array ')'  */
+#line 3174 "parser.y"
                            {
     infinity::IndexType index_type = infinity::IndexType::kSecondary;
     size_t index_count = (yyvsp[-1].identifier_array_t)->size();
@@ -7720,11 +7734,11 @@ Return2:
     }
     delete (yyvsp[-1].identifier_array_t);
 }
-#line 7724 "parser.cpp"
+#line 7738 "parser.cpp"
     break;
 
 
-#line 7728 "parser.cpp"
+#line 7742 "parser.cpp"
 
       default: break;
     }
@@ -7953,7 +7967,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 3181 "parser.y"
+#line 3188 "parser.y"
 
 
 void
@@ -1638,6 +1638,11 @@ show_statement: SHOW DATABASES {
     $$ = new infinity::ShowStatement();
     $$->show_type_ = infinity::ShowStmtType::kProfiles;
 }
+| SHOW PROFILE LONG_VALUE {
+    $$ = new infinity::ShowStatement();
+    $$->show_type_ = infinity::ShowStmtType::kProfile;
+    $$->profile_no_ = $3;
+}
 | SHOW BUFFER {
     $$ = new infinity::ShowStatement();
     $$->show_type_ = infinity::ShowStmtType::kBuffer;
@@ -3076,6 +3081,8 @@ index_info_list : '(' identifier_array ')' USING IDENTIFIER with_index_param_lis
         index_type = infinity::IndexType::kIVFFlat;
     } else if (strcmp($5, "emvb") == 0) {
         index_type = infinity::IndexType::kEMVB;
+    } else if (strcmp($5, "diskann") == 0) {
+        index_type = infinity::IndexType::kDiskAnn;
     } else {
         free($5);
         delete $2;
@@ -28,6 +28,7 @@ enum class IndexType {
     kFullText,
     kSecondary,
     kEMVB,
+    kDiskAnn,
     kInvalid,
 };
 
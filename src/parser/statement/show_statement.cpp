@@ -96,6 +96,10 @@ std::string ShowStatement::ToString() const {
             ss << "Show profiles";
             break;
         }
+        case ShowStmtType::kProfile: {
+            ss << "Show profile";
+            break;
+        }
         case ShowStmtType::kQueries: {
             ss << "Show queries";
             break;
@@ -31,6 +31,7 @@ enum class ShowStmtType {
     kIndexes,
     kConfigs,
     kProfiles,
+    kProfile,
     kSegments,
     kSegment,
     kBlocks,
@@ -66,6 +67,7 @@ public:
     std::optional<u_int64_t> column_id_{};
     std::optional<u_int64_t> session_id_{};
     std::optional<u_int64_t> txn_id_{};
+    std::optional<u_int64_t> profile_no_{};
     std::string var_name_{};
 };
 
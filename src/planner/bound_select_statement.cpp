@@ -76,8 +76,6 @@ import common_query_filter;
 import logger;
 
 import search_options;
-import search_driver;
-import query_node;
 import status;
 import early_terminate_iterator;
 import default_values;
@@ -181,7 +179,6 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
             match_node->common_query_filter_ = common_query_filter;
             match_node->index_reader_ = base_table_ref->table_entry_ptr_->GetFullTextIndexReader(query_context->GetTxn());
 
-            const Map<String, String> &column2analyzer = match_node->index_reader_.GetColumn2Analyzer();
             SearchOptions search_ops(match_node->match_expr_->options_text_);
 
             // option: threshold
@@ -190,9 +187,8 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
 
             // option: default field
             auto iter = search_ops.options_.find("default_field");
-            String default_field;
             if(iter != search_ops.options_.end()) {
-                default_field = iter->second;
+                match_node->default_field_ = iter->second;
             }
 
             // option: block max
@@ -225,15 +221,7 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
                 match_node->top_n_ = DEFAULT_MATCH_TEXT_OPTION_TOP_N;
             }
 
-            SearchDriver search_driver(column2analyzer, default_field);
-            UniquePtr<QueryNode> query_tree = search_driver.ParseSingleWithFields(match_node->match_expr_->fields_, match_node->match_expr_->matching_text_);
-            if (query_tree.get() == nullptr) {
-                Status status = Status::ParseMatchExprFailed(match_node->match_expr_->fields_, match_node->match_expr_->matching_text_);
-                LOG_ERROR(status.message());
-                RecoverableError(status);
-            }
-
-            match_node->query_tree_ = std::move(query_tree);
+            match_node->BuildQueryTree();
             match_knn_nodes.push_back(std::move(match_node));
         }
         for (auto &match_tensor_expr : search_expr_->match_tensor_exprs_) {
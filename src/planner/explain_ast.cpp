@@ -662,6 +662,10 @@ void ExplainAST::BuildShow(const ShowStatement *show_statement, SharedPtr<Vector
             result->emplace_back(MakeShared<String>("SHOW QUERIES"));
             break;
         }
+        case ShowStmtType::kProfile: {
+            result->emplace_back(MakeShared<String>("SHOW PROFILE"));
+            break;
+        }
         case ShowStmtType::kSessionVariable: {
             result->emplace_back(MakeShared<String>("SHOW SESSION VARIABLE"));
             break;
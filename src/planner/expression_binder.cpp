@@ -28,6 +28,7 @@ import value;
 import logical_type;
 import internal_types;
 import base_expression;
+import expression_type;
 import aggregate_expression;
 import column_expression;
 import in_expression;
@@ -453,6 +454,32 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildFuncExpr(const FunctionExpr &ex
             // SharedPtr<AggregateFunctionSet> aggregate_function_set_ptr
             auto aggregate_function_set_ptr = static_pointer_cast<AggregateFunctionSet>(function_set_ptr);
             AggregateFunction aggregate_function = aggregate_function_set_ptr->GetMostMatchFunction(arguments[0]);
+            if (arguments.size() == 2) {
+                // the constant argument, e.g. the percentile of APPROX_PERCENTILE(x, 0.9)
+                Optional<f64> parameter = None;
+                if (arguments[1]->type() == ExpressionType::kValue) {
+                    const Value &value = static_pointer_cast<ValueExpression>(arguments[1])->GetValue();
+                    switch (value.type().type()) {
+                        case LogicalType::kDouble: {
+                            parameter = value.GetValue<DoubleT>();
+                            break;
+                        }
+                        case LogicalType::kBigInt: {
+                            parameter = value.GetValue<BigIntT>();
+                            break;
+                        }
+                        default: {
+                            break;
+                        }
+                    }
+                }
+                if (!parameter.has_value() || !aggregate_function.BindParameter(*parameter)) {
+                    Status status = Status::FunctionArgsError(expr.ToString());
+                    LOG_ERROR(status.message());
+                    RecoverableError(status);
+                }
+                arguments.pop_back();
+            }
             auto aggregate_function_ptr = MakeShared<AggregateExpression>(aggregate_function, arguments);
             return aggregate_function_ptr;
         }
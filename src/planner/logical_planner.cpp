@@ -72,6 +72,7 @@ import index_hnsw;
 import index_secondary;
 import index_emvb;
 import index_bmp;
+import index_diskann;
 import index_full_text;
 import base_table_ref;
 import table_ref;
@@ -716,6 +717,12 @@ Status LogicalPlanner::BuildCreateIndex(const CreateStatement *statement, Shared
             base_index_ptr = IndexBMP::Make(index_name, index_filename, {index_info->column_name_}, *(index_info->index_param_list_));
             break;
         }
+        case IndexType::kDiskAnn: {
+            assert(index_info->index_param_list_ != nullptr);
+            IndexDiskAnn::ValidateColumnDataType(base_table_ref, index_info->column_name_); // may throw exception
+            base_index_ptr = IndexDiskAnn::Make(index_name, index_filename, {index_info->column_name_}, *(index_info->index_param_list_));
+            break;
+        }
         case IndexType::kInvalid: {
             String error_message = "Invalid index type.";
             LOG_CRITICAL(error_message);
@@ -1202,6 +1209,9 @@ Status LogicalPlanner::BuildShow(ShowStatement *statement, SharedPtr<BindContext
         case ShowStmtType::kProfiles: {
             return BuildShowProfiles(statement, bind_context_ptr);
         }
+        case ShowStmtType::kProfile: {
+            return BuildShowProfile(statement, bind_context_ptr);
+        }
         case ShowStmtType::kQueries: {
             return BuildShowQueries(statement, bind_context_ptr);
         }
@@ -1276,6 +1286,24 @@ Status LogicalPlanner::BuildShowProfiles(const ShowStatement *statement, SharedP
     return Status::OK();
 }
 
+Status LogicalPlanner::BuildShowProfile(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    SharedPtr<LogicalNode> logical_show = MakeShared<LogicalShow>(bind_context_ptr->GetNewLogicalNodeId(),
+                                                                  ShowType::kShowProfile,
+                                                                  statement->schema_name_,
+                                                                  statement->table_name_,
+                                                                  bind_context_ptr->GenerateTableIndex(),
+                                                                  None,
+                                                                  None,
+                                                                  None,
+                                                                  None,
+                                                                  None,
+                                                                  None,
+                                                                  None,
+                                                                  statement->profile_no_);
+    this->logical_plan_ = logical_show;
+    return Status::OK();
+}
+
 Status LogicalPlanner::BuildShowQueries(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     SharedPtr<LogicalNode> logical_show = MakeShared<LogicalShow>(bind_context_ptr->GetNewLogicalNodeId(),
                                                                   ShowType::kShowQueries,
@@ -159,6 +159,8 @@ public:
 
     Status BuildShowProfiles(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
+    Status BuildShowProfile(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
+
     Status BuildShowSessionVariable(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
     Status BuildShowSessionVariables(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
@@ -30,12 +30,27 @@ import third_party;
 import logical_type;
 import internal_types;
 import explain_logical_plan;
+import search_driver;
+import status;
+import infinity_exception;
+import logger;
 
 namespace infinity {
 
 LogicalMatch::LogicalMatch(u64 node_id, SharedPtr<BaseTableRef> base_table_ref, SharedPtr<MatchExpression> match_expr)
     : LogicalNode(node_id, LogicalNodeType::kMatch), base_table_ref_(base_table_ref), match_expr_(std::move(match_expr)) {}
 
+void LogicalMatch::BuildQueryTree() {
+    SearchDriver search_driver(index_reader_.GetColumn2Analyzer(), default_field_);
+    UniquePtr<QueryNode> query_tree = search_driver.ParseSingleWithFields(match_expr_->fields_, match_expr_->matching_text_);
+    if (query_tree.get() == nullptr) {
+        Status status = Status::ParseMatchExprFailed(match_expr_->fields_, match_expr_->matching_text_);
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    query_tree_ = std::move(query_tree);
+}
+
 Vector<ColumnBinding> LogicalMatch::GetColumnBindings() const {
     Vector<ColumnBinding> result;
     auto &column_ids = base_table_ref_->column_ids_;
@@ -54,11 +54,15 @@ public:
 
     inline String name() final { return "LogicalMatch"; }
 
+    // parse the matching text of match_expr_ with the analyzers of index_reader_
+    void BuildQueryTree();
+
     SharedPtr<BaseTableRef> base_table_ref_{};
     SharedPtr<MatchExpression> match_expr_{};
     SharedPtr<BaseExpression> filter_expression_{};
     IndexReader index_reader_;
     UniquePtr<QueryNode> query_tree_;
+    String default_field_{};
     float begin_threshold_;
     EarlyTermAlgo early_term_algo_{EarlyTermAlgo::kBMW};
     u32 top_n_{1};
@@ -52,6 +52,8 @@ String ToString(ShowType type) {
             return "Show configs";
         case ShowType::kShowProfiles:
             return "Show profiles";
+        case ShowType::kShowProfile:
+            return "Show profile";
         case ShowType::kShowSegments:
             return "Show segments";
         case ShowType::kShowSegment:
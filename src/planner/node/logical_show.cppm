@@ -38,6 +38,7 @@ export enum class ShowType {
     kShowColumn,
     kShowConfigs,
     kShowProfiles,
+    kShowProfile,
     kShowQueries,
     kShowQuery,
     kShowTransactions,
@@ -71,9 +72,10 @@ public:
                          Optional<ColumnID> column_id = None,
                          Optional<String> index_name = None,
                          Optional<TransactionID> session_id = None,
-                         Optional<u64> txn_id = None)
+                         Optional<u64> txn_id = None,
+                         Optional<u64> profile_no = None)
         : LogicalNode(node_id, LogicalNodeType::kShow), scan_type_(type), schema_name_(std::move(schema_name)), object_name_(std::move(object_name)),
-          table_index_(table_index), segment_id_(segment_id), block_id_(block_id), chunk_id_(chunk_id), column_id_(column_id), index_name_(index_name), session_id_(session_id), txn_id_(txn_id) {}
+          table_index_(table_index), segment_id_(segment_id), block_id_(block_id), chunk_id_(chunk_id), column_id_(column_id), index_name_(index_name), session_id_(session_id), txn_id_(txn_id), profile_no_(profile_no) {}
 
     [[nodiscard]] Vector<ColumnBinding> GetColumnBindings() const final;
 
@@ -99,6 +101,8 @@ public:
 
     [[nodiscard]] inline const Optional<TransactionID> transaction_id() const { return txn_id_; }
 
+    [[nodiscard]] inline const Optional<u64> profile_no() const { return profile_no_; }
+
     [[nodiscard]] inline const Optional<BlockID> block_id() const { return block_id_; }
 
     [[nodiscard]] inline const Optional<ChunkID> chunk_id() const { return chunk_id_; }
@@ -120,6 +124,7 @@ private:
     Optional<String> index_name_{};
     Optional<u64> session_id_{};
     Optional<TransactionID> txn_id_{};
+    Optional<u64> profile_no_{};
 };
 
 } // namespace infinity
@@ -46,6 +46,7 @@ import value;
 import column_vector;
 import filter_expression_push_down_helper;
 import table_index_meta;
+import string_pattern;
 
 namespace infinity {
 
@@ -356,6 +357,16 @@ private:
             case ExpressionType::kFunction: {
                 auto function_expression = std::static_pointer_cast<FunctionExpression>(expression);
                 auto const &f_name = function_expression->ScalarFunctionName();
+                if (f_name == "like") {
+                    // the varchar secondary index is hashed, it serves the LIKE pattern without wildcard as "="
+                    if (auto equals_expression = RewriteExactLike(function_expression); equals_expression) {
+                        return CheckExprIndexStateAndRewrite(equals_expression, sub_expr_depth);
+                    }
+                    LOG_TRACE(fmt::format("Expression depth: {}. LIKE with wildcard can't apply index scan: {}.",
+                                          sub_expr_depth,
+                                          function_expression->Name()));
+                    return nullptr;
+                }
                 static constexpr std::array<const char *, 5> IndexScanSupportedCompareFunctionNames = {"<", ">", "<=", ">=", "="};
                 static constexpr std::array<const char *, 5> IndexScanSupportedCompareFunctionNamesCorrespondingReverse = {">", "<", ">=", "<=", "="};
                 // depth 0: <, >, <=, >=, = function
@@ -439,6 +450,28 @@ private:
         }
     }
 
+    // "x LIKE 'abc'" to "x = 'abc'", nullptr if the pattern isn't a constant without wildcard
+    inline SharedPtr<BaseExpression> RewriteExactLike(const SharedPtr<FunctionExpression> &expression) {
+        auto &text_expr = expression->arguments()[0];
+        auto &pattern_expr = expression->arguments()[1];
+        if (text_expr->type() != ExpressionType::kColumn or !IsValueResultExpression(pattern_expr, 1)) {
+            return nullptr;
+        }
+        Value pattern_value = FilterExpressionPushDownHelper::CalcValueResult(pattern_expr);
+        if (pattern_value.type().type() != LogicalType::kVarchar) {
+            return nullptr;
+        }
+        LikePattern pattern(pattern_value.GetVarchar());
+        if (pattern.kind() != LikePattern::Kind::kExact) {
+            return nullptr;
+        }
+        Vector<SharedPtr<BaseExpression>> arguments{text_expr, MakeShared<ValueExpression>(Value::MakeVarchar(pattern.LiteralPrefix()))};
+        auto function_set_ptr = Catalog::GetFunctionSetByName(query_context_->storage()->catalog(), "=");
+        auto scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(function_set_ptr);
+        ScalarFunction func = scalar_function_set_ptr->GetMostMatchFunction(arguments);
+        return MakeShared<FunctionExpression>(std::move(func), std::move(arguments));
+    }
+
     inline void PrepareResult() {
         auto and_function_set_ptr = Catalog::GetFunctionSetByName(query_context_->storage()->catalog(), "AND");
         auto and_scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(and_function_set_ptr);
@@ -617,6 +650,7 @@ public:
         // known expression 1: "[cast] x equal value_expr" for ProbabilisticDataFilter, also need to build a val <= x <= val filter for MinMaxFilter
         // known expression 2: "[cast] x compare (>, <, >=, <=) value_expr" for MinMaxFilter
         // known expression 3 : "and" or "or" expression
+        // known expression 4: "x like 'abc%...'" for MinMaxFilter, as 'abc' <= x <= 'abd'
         switch (expression->type()) {
             case ExpressionType::kFunction: {
                 static constexpr std::array<const char *, 4> Case2FunctionNames = {"<", ">", "<=", ">="};
@@ -769,6 +803,9 @@ public:
                         // unknown expression
                         return ReturnAlwaysTrue();
                     }
+                } else if (f_name == "like") {
+                    // maybe known expression 4
+                    return SolveForLikePrefix(function_expression, sub_expr_depth);
                 } else if (FilterExpressionPushDownMethodBase::IsValueResultExpression(expression, sub_expr_depth + 1)) {
                     return ReturnValue(expression, sub_expr_depth);
                 } else {
@@ -788,6 +825,36 @@ public:
     }
 
 private:
+    static inline UniquePtr<FastRoughFilterEvaluator> SolveForLikePrefix(const SharedPtr<FunctionExpression> &expression, u32 sub_expr_depth) {
+        auto &text_expr = expression->arguments()[0];
+        auto &pattern_expr = expression->arguments()[1];
+        if (text_expr->type() != ExpressionType::kColumn or !text_expr->Type().SupportMinMaxFilter() or
+            !FilterExpressionPushDownMethodBase::IsValueResultExpression(pattern_expr, sub_expr_depth + 1)) {
+            return ReturnAlwaysTrue();
+        }
+        Value pattern_value = FilterExpressionPushDownHelper::CalcValueResult(pattern_expr);
+        if (pattern_value.type().type() != LogicalType::kVarchar) {
+            return ReturnAlwaysTrue();
+        }
+        LikePattern pattern(pattern_value.GetVarchar());
+        String prefix(pattern.LiteralPrefix());
+        if (prefix.empty()) {
+            return ReturnAlwaysTrue();
+        }
+        ColumnID column_id = std::static_pointer_cast<ColumnExpression>(text_expr)->binding().column_idx;
+        auto minmax_filter_ge =
+            MakeUnique<FastRoughFilterEvaluatorMinMaxFilter>(column_id, Value::MakeVarchar(prefix), FilterCompareType::kGreaterEqual);
+        // the strings starting with the prefix are less than its successor, e.g. 'abd' for 'abc'. Only ascii is incremented,
+        // since the order of other bytes depends on the signedness of char.
+        if (static_cast<u8>(prefix.back()) >= 0x7F) {
+            return minmax_filter_ge;
+        }
+        ++prefix.back();
+        auto minmax_filter_le =
+            MakeUnique<FastRoughFilterEvaluatorMinMaxFilter>(column_id, Value::MakeVarchar(prefix), FilterCompareType::kLessEqual);
+        return MakeUnique<FastRoughFilterEvaluatorCombineAnd>(std::move(minmax_filter_ge), std::move(minmax_filter_le));
+    }
+
     static inline UniquePtr<FastRoughFilterEvaluator> ReturnAlwaysTrue() { return MakeUnique<FastRoughFilterEvaluatorTrue>(); }
 
     static inline UniquePtr<FastRoughFilterEvaluator> ReturnAlwaysFalse() { return MakeUnique<FastRoughFilterEvaluatorFalse>(); }
@@ -0,0 +1,477 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <iterator>
+
+module plan_cache;
+
+import stl;
+import third_party;
+import logical_node;
+import logical_node_type;
+import logical_match;
+import logical_knn_scan;
+import logical_match_tensor_scan;
+import logical_fusion;
+import bind_context;
+import base_statement;
+import select_statement;
+import table_reference;
+import base_table_reference;
+import parsed_expr;
+import constant_expr;
+import column_expr;
+import function_expr;
+import between_expr;
+import in_expr;
+import cast_expr;
+import search_expr;
+import knn_expr;
+import match_expr;
+import match_tensor_expr;
+import fusion_expr;
+import search_options;
+import statement_common;
+import knn_expression;
+import match_tensor_expression;
+import fusion_expression;
+import base_table_ref;
+import block_index;
+import common_query_filter;
+import table_entry;
+import txn;
+import status;
+import internal_types;
+
+namespace infinity {
+
+namespace {
+
+// Writes a SELECT ... SEARCH statement into a cache key.
+// Strings are length prefixed and every node starts with its own tag, so different statements never share a key.
+class PlanKeyWriter {
+public:
+    explicit PlanKeyWriter(PlanParameters &parameters) : parameters_(parameters) {}
+
+    bool WriteStatement(const SelectStatement *statement, const String &schema_name) {
+        if (statement->search_expr_ == nullptr or statement->table_ref_ == nullptr or statement->table_ref_->type_ != TableRefType::kTable) {
+            return false;
+        }
+        if (statement->select_distinct_ or statement->group_by_list_ != nullptr or statement->having_expr_ != nullptr or
+            statement->order_by_list != nullptr or statement->with_exprs_ != nullptr or statement->nested_select_ != nullptr) {
+            return false;
+        }
+        const auto *table_ref = static_cast<const TableReference *>(statement->table_ref_);
+        if (table_ref->alias_ != nullptr and table_ref->alias_->column_alias_array_ != nullptr) {
+            return false;
+        }
+        WriteString(table_ref->db_name_.empty() ? schema_name : table_ref->db_name_);
+        WriteString(table_ref->table_name_);
+        WriteString(table_ref->GetTableName());
+
+        key_.append("|select");
+        if (!WriteExprList(statement->select_list_)) {
+            return false;
+        }
+        key_.append("|search");
+        if (!WriteSearch(static_cast<const SearchExpr *>(statement->search_expr_))) {
+            return false;
+        }
+        key_.append("|where");
+        if (!WriteExpr(statement->where_expr_)) {
+            return false;
+        }
+        key_.append("|limit");
+        if (!WriteExpr(statement->limit_expr_)) {
+            return false;
+        }
+        key_.append("|offset");
+        return WriteExpr(statement->offset_expr_);
+    }
+
+    String &key() { return key_; }
+
+private:
+    void WriteString(const String &str) { fmt::format_to(std::back_inserter(key_), "{}:{}", str.size(), str); }
+
+    bool WriteExprList(const Vector<ParsedExpr *> *exprs) {
+        if (exprs == nullptr) {
+            key_.append("[]");
+            return true;
+        }
+        key_.push_back('[');
+        for (const auto *expr : *exprs) {
+            if (!WriteExpr(expr)) {
+                return false;
+            }
+        }
+        key_.push_back(']');
+        return true;
+    }
+
+    bool WriteExpr(const ParsedExpr *expr) {
+        if (expr == nullptr) {
+            key_.push_back('_');
+            return true;
+        }
+        switch (expr->type_) {
+            case ParsedExprType::kConstant: {
+                const auto *constant_expr = static_cast<const ConstantExpr *>(expr);
+                // the literal type tells the string '1' from the integer 1
+                fmt::format_to(std::back_inserter(key_), "c{}", static_cast<int>(constant_expr->literal_type_));
+                WriteString(constant_expr->ToString());
+                break;
+            }
+            case ParsedExprType::kColumn: {
+                const auto *column_expr = static_cast<const ColumnExpr *>(expr);
+                key_.append(column_expr->star_ ? "*" : "col");
+                for (const auto &name : column_expr->names_) {
+                    WriteString(name);
+                }
+                break;
+            }
+            case ParsedExprType::kFunction: {
+                const auto *function_expr = static_cast<const FunctionExpr *>(expr);
+                key_.append(function_expr->distinct_ ? "fd" : "f");
+                WriteString(function_expr->func_name_);
+                if (!WriteExprList(function_expr->arguments_)) {
+                    return false;
+                }
+                break;
+            }
+            case ParsedExprType::kBetween: {
+                const auto *between_expr = static_cast<const BetweenExpr *>(expr);
+                key_.append("between(");
+                if (!WriteExpr(between_expr->value_) or !WriteExpr(between_expr->lower_bound_) or !WriteExpr(between_expr->upper_bound_)) {
+                    return false;
+                }
+                key_.push_back(')');
+                break;
+            }
+            case ParsedExprType::kIn: {
+                const auto *in_expr = static_cast<const InExpr *>(expr);
+                key_.append(in_expr->not_in_ ? "notin(" : "in(");
+                if (!WriteExpr(in_expr->left_) or !WriteExprList(in_expr->arguments_)) {
+                    return false;
+                }
+                key_.push_back(')');
+                break;
+            }
+            case ParsedExprType::kCast: {
+                const auto *cast_expr = static_cast<const CastExpr *>(expr);
+                key_.append("cast");
+                WriteString(cast_expr->data_type_.ToString());
+                if (!WriteExpr(cast_expr->expr_)) {
+                    return false;
+                }
+                break;
+            }
+            default: {
+                // parameters, subqueries, case and the search expressions outside of SEARCH
+                return false;
+            }
+        }
+        if (!expr->alias_.empty()) {
+            key_.append("as");
+            WriteString(expr->alias_);
+        }
+        return true;
+    }
+
+    bool WriteSearch(const SearchExpr *search_expr) {
+        if (!search_expr->match_sparse_exprs_.empty()) {
+            return false;
+        }
+        for (const auto *match_expr : search_expr->match_exprs_) {
+            // the matching text is a parameter
+            key_.append("match");
+            WriteString(match_expr->fields_);
+            WriteString(match_expr->options_text_);
+            parameters_.match_exprs_.push_back(match_expr);
+        }
+        for (const auto *match_tensor_expr : search_expr->match_tensor_exprs_) {
+            if (!WriteMatchTensor(match_tensor_expr)) {
+                return false;
+            }
+        }
+        for (const auto *knn_expr : search_expr->knn_exprs_) {
+            // the query embedding is a parameter
+            key_.append("knn");
+            if (!WriteExpr(knn_expr->column_expr_)) {
+                return false;
+            }
+            fmt::format_to(std::back_inserter(key_),
+                           "{},{},{},{}",
+                           knn_expr->dimension_,
+                           static_cast<int>(knn_expr->embedding_data_type_),
+                           static_cast<int>(knn_expr->distance_type_),
+                           knn_expr->topn_);
+            if (knn_expr->opt_params_ != nullptr) {
+                for (const auto *param : *knn_expr->opt_params_) {
+                    WriteString(param->param_name_);
+                    WriteString(param->param_value_);
+                }
+            }
+            parameters_.knn_exprs_.push_back(knn_expr);
+        }
+        for (const auto *fusion_expr : search_expr->fusion_exprs_) {
+            key_.append("fusion");
+            WriteString(fusion_expr->method_);
+            if (fusion_expr->options_.get() != nullptr) {
+                for (const auto &[name, value] : fusion_expr->options_->options_) {
+                    if (fusion_expr->match_tensor_expr_.get() != nullptr and name == "search_tensor") {
+                        // bound through the rerank tensor below
+                        continue;
+                    }
+                    WriteString(name);
+                    WriteString(value);
+                }
+            }
+            if (fusion_expr->match_tensor_expr_.get() != nullptr and !WriteMatchTensor(fusion_expr->match_tensor_expr_.get())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool WriteMatchTensor(const MatchTensorExpr *match_tensor_expr) {
+        // the query tensor is a parameter
+        key_.append("tensor");
+        if (!WriteExpr(match_tensor_expr->column_expr_.get())) {
+            return false;
+        }
+        fmt::format_to(std::back_inserter(key_),
+                       "{},{},{}",
+                       static_cast<int>(match_tensor_expr->search_method_enum_),
+                       static_cast<int>(match_tensor_expr->embedding_data_type_),
+                       match_tensor_expr->dimension_);
+        WriteString(match_tensor_expr->options_text_);
+        parameters_.match_tensor_exprs_.push_back(match_tensor_expr);
+        return true;
+    }
+
+    String key_;
+    PlanParameters &parameters_;
+};
+
+// The nodes and expressions of a cached plan which hold a parameter or per transaction state
+struct PlanSlots {
+    Vector<LogicalMatch *> match_nodes_;
+    Vector<KnnExpression *> knn_exprs_;
+    Vector<MatchTensorExpression *> match_tensor_exprs_;
+    Vector<MatchTensorExpression *> fusion_tensor_exprs_;
+    BaseTableRef *base_table_ref_ = nullptr;
+    CommonQueryFilter *common_query_filter_ = nullptr;
+
+    bool SetTable(BaseTableRef *base_table_ref, CommonQueryFilter *common_query_filter) {
+        if (base_table_ref_ == nullptr) {
+            base_table_ref_ = base_table_ref;
+            common_query_filter_ = common_query_filter;
+            return base_table_ref_ != nullptr and common_query_filter_ != nullptr;
+        }
+        // the children of a SEARCH share the table and the filter
+        return base_table_ref_ == base_table_ref and common_query_filter_ == common_query_filter;
+    }
+};
+
+// Walks the plan built by BoundSelectStatement for SEARCH. The children of a fusion are visited before the fusion,
+// so every kind of slot is collected in the order of the statement.
+bool CollectSlots(LogicalNode *node, PlanSlots &slots) {
+    if (node == nullptr) {
+        return true;
+    }
+    switch (node->operator_type()) {
+        case LogicalNodeType::kProjection: {
+            return node->right_node().get() == nullptr and CollectSlots(node->left_node().get(), slots);
+        }
+        case LogicalNodeType::kFusion: {
+            auto *fusion_node = static_cast<LogicalFusion *>(node);
+            if (!CollectSlots(node->left_node().get(), slots) or !CollectSlots(node->right_node().get(), slots)) {
+                return false;
+            }
+            for (const auto &child : fusion_node->other_children_) {
+                if (!CollectSlots(child.get(), slots)) {
+                    return false;
+                }
+            }
+            if (auto &match_tensor_expr = fusion_node->fusion_expr_->match_tensor_expr_; match_tensor_expr.get() != nullptr) {
+                slots.fusion_tensor_exprs_.push_back(match_tensor_expr.get());
+            }
+            return true;
+        }
+        case LogicalNodeType::kMatch: {
+            auto *match_node = static_cast<LogicalMatch *>(node);
+            slots.match_nodes_.push_back(match_node);
+            return slots.SetTable(match_node->base_table_ref_.get(), match_node->common_query_filter_.get());
+        }
+        case LogicalNodeType::kKnnScan: {
+            auto *knn_scan = static_cast<LogicalKnnScan *>(node);
+            slots.knn_exprs_.push_back(knn_scan->knn_expression().get());
+            return slots.SetTable(knn_scan->base_table_ref_.get(), knn_scan->common_query_filter_.get());
+        }
+        case LogicalNodeType::kMatchTensorScan: {
+            auto *match_tensor_scan = static_cast<LogicalMatchTensorScan *>(node);
+            slots.match_tensor_exprs_.push_back(static_cast<MatchTensorExpression *>(match_tensor_scan->query_expression_.get()));
+            return slots.SetTable(match_tensor_scan->base_table_ref_.get(), match_tensor_scan->common_query_filter_.get());
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+bool CollectSlots(const Vector<SharedPtr<LogicalNode>> &logical_plans, const PlanParameters &parameters, PlanSlots &slots) {
+    if (logical_plans.size() != 1 or !CollectSlots(logical_plans[0].get(), slots) or slots.base_table_ref_ == nullptr) {
+        return false;
+    }
+    slots.match_tensor_exprs_.insert(slots.match_tensor_exprs_.end(), slots.fusion_tensor_exprs_.begin(), slots.fusion_tensor_exprs_.end());
+    return slots.match_nodes_.size() == parameters.match_exprs_.size() and slots.knn_exprs_.size() == parameters.knn_exprs_.size() and
+           slots.match_tensor_exprs_.size() == parameters.match_tensor_exprs_.size();
+}
+
+} // namespace
+
+Optional<String> PlanCache::MakeKey(const BaseStatement *statement, const String &schema_name, PlanParameters &parameters) {
+    if (statement->type_ != StatementType::kSelect) {
+        return None;
+    }
+    PlanKeyWriter writer(parameters);
+    if (!writer.WriteStatement(static_cast<const SelectStatement *>(statement), schema_name)) {
+        parameters = {};
+        return None;
+    }
+    return std::move(writer.key());
+}
+
+String PlanCache::MakeResultKey(const String &plan_key, const PlanParameters &parameters) {
+    String key = plan_key;
+    auto out = std::back_inserter(key);
+    for (const auto *match_expr : parameters.match_exprs_) {
+        fmt::format_to(out, "|{}:{}", match_expr->matching_text_.size(), match_expr->matching_text_);
+    }
+    for (const auto *knn_expr : parameters.knn_exprs_) {
+        const SizeT embedding_size = EmbeddingT::EmbeddingSize(knn_expr->embedding_data_type_, knn_expr->dimension_);
+        key.push_back('|');
+        key.append(static_cast<const char *>(knn_expr->embedding_data_ptr_), embedding_size);
+    }
+    for (const auto *match_tensor_expr : parameters.match_tensor_exprs_) {
+        const SizeT tensor_size = EmbeddingT::EmbeddingSize(match_tensor_expr->embedding_data_type_, match_tensor_expr->dimension_);
+        key.push_back('|');
+        key.append(match_tensor_expr->query_tensor_data_ptr_.get(), tensor_size);
+    }
+    return key;
+}
+
+UniquePtr<CachedPlan> PlanCache::MakeCachedPlan(Vector<SharedPtr<LogicalNode>> logical_plans,
+                                                SharedPtr<BindContext> bind_context,
+                                                u64 max_node_id,
+                                                const PlanParameters &parameters,
+                                                TxnTimeStamp schema_version) {
+    PlanSlots slots;
+    if (!CollectSlots(logical_plans, parameters, slots)) {
+        return nullptr;
+    }
+    // the bound expressions point into the parsed statement, which is freed after this query
+    for (auto *knn_expr : slots.knn_exprs_) {
+        knn_expr->OwnQueryEmbedding();
+    }
+    for (auto *match_tensor_expr : slots.match_tensor_exprs_) {
+        match_tensor_expr->OwnQueryEmbedding();
+    }
+    auto plan = MakeUnique<CachedPlan>();
+    plan->logical_plans_ = std::move(logical_plans);
+    plan->bind_context_ = std::move(bind_context);
+    plan->max_node_id_ = max_node_id;
+    plan->schema_version_ = schema_version;
+    return plan;
+}
+
+bool PlanCache::BindParameters(CachedPlan &plan, const PlanParameters &parameters, Txn *txn) {
+    PlanSlots slots;
+    if (!CollectSlots(plan.logical_plans_, parameters, slots)) {
+        return false;
+    }
+    BaseTableRef *base_table_ref = slots.base_table_ref_;
+    TableEntry *table_entry = base_table_ref->table_entry_ptr_;
+    if (auto [txn_table_entry, status] = txn->GetTableByName(*base_table_ref->schema_name(), *base_table_ref->table_name());
+        !status.ok() or txn_table_entry != table_entry) {
+        return false;
+    }
+
+    // per transaction state
+    base_table_ref->block_index_ = table_entry->GetBlockIndex(txn);
+    base_table_ref->block_index_->RecordAccess();
+    slots.common_query_filter_->ResetForQuery(txn->BeginTS());
+
+    for (SizeT i = 0; i < slots.match_nodes_.size(); ++i) {
+        LogicalMatch *match_node = slots.match_nodes_[i];
+        match_node->match_expr_->matching_text_ = parameters.match_exprs_[i]->matching_text_;
+        match_node->index_reader_ = table_entry->GetFullTextIndexReader(txn);
+        match_node->BuildQueryTree();
+    }
+    for (SizeT i = 0; i < slots.knn_exprs_.size(); ++i) {
+        slots.knn_exprs_[i]->SetQueryEmbedding(parameters.knn_exprs_[i]->embedding_data_ptr_);
+    }
+    for (SizeT i = 0; i < slots.match_tensor_exprs_.size(); ++i) {
+        slots.match_tensor_exprs_[i]->SetQueryEmbedding(parameters.match_tensor_exprs_[i]->query_tensor_data_ptr_.get());
+    }
+    return true;
+}
+
+UniquePtr<CachedPlan> PlanCache::Take(const String &key, TxnTimeStamp begin_ts, TxnTimeStamp schema_version) {
+    std::lock_guard lock(mutex_);
+    auto map_iter = entry_map_.find(key);
+    if (map_iter == entry_map_.end()) {
+        ++miss_count_;
+        return nullptr;
+    }
+    auto list_iter = map_iter->second;
+    UniquePtr<CachedPlan> plan = std::move(list_iter->plan_);
+    entry_map_.erase(map_iter);
+    lru_list_.erase(list_iter);
+    if (plan->schema_version_ != schema_version or begin_ts <= schema_version) {
+        // the catalog has changed, or this transaction can't see the catalog the plan was bound to
+        ++miss_count_;
+        return nullptr;
+    }
+    ++hit_count_;
+    return plan;
+}
+
+void PlanCache::Put(const String &key, UniquePtr<CachedPlan> plan) {
+    if (capacity_ == 0) {
+        return;
+    }
+    std::lock_guard lock(mutex_);
+    if (entry_map_.contains(key)) {
+        // another query of the same shape has put its plan back first
+        return;
+    }
+    while (lru_list_.size() >= capacity_) {
+        entry_map_.erase(lru_list_.back().key_);
+        lru_list_.pop_back();
+    }
+    lru_list_.push_front(CacheEntry{key, std::move(plan)});
+    entry_map_.emplace(key, lru_list_.begin());
+}
+
+void PlanCache::Clear() {
+    std::lock_guard lock(mutex_);
+    entry_map_.clear();
+    lru_list_.clear();
+}
+
+} // namespace infinity
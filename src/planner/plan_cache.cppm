@@ -0,0 +1,105 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module plan_cache;
+
+import stl;
+import logical_node;
+import bind_context;
+import base_statement;
+import knn_expr;
+import match_expr;
+import match_tensor_expr;
+import txn;
+
+namespace infinity {
+
+// The query payloads of a SEARCH statement, which change between executions of the same statement shape.
+// They are not part of the plan cache key, but bound into the cached plan instead.
+export struct PlanParameters {
+    Vector<const MatchExpr *> match_exprs_;
+    Vector<const KnnExpr *> knn_exprs_;
+    // MATCH TENSOR of the SEARCH list first, then the rerank tensors of the FUSION list
+    Vector<const MatchTensorExpr *> match_tensor_exprs_;
+};
+
+export struct CachedPlan {
+    // bound and optimized, the physical plan still depends on the segments and indexes seen by the transaction
+    Vector<SharedPtr<LogicalNode>> logical_plans_;
+    SharedPtr<BindContext> bind_context_;
+    u64 max_node_id_{};
+    // Catalog::schema_version_ when the plan was bound
+    TxnTimeStamp schema_version_{};
+};
+
+// LRU cache of the logical plans of SEARCH statements, shared by all sessions.
+// The key is the normalized statement with the query vectors, tensors and texts replaced by their types,
+// so the same hybrid search sent with different payloads only goes through binding and optimization once.
+// A plan is used by one query at a time: Take() removes it from the cache and Put() gives it back.
+export class PlanCache {
+public:
+    explicit PlanCache(SizeT capacity) : capacity_(capacity) {}
+
+    // return the key of a cacheable statement and collect its payloads into `parameters`
+    static Optional<String> MakeKey(const BaseStatement *statement, const String &schema_name, PlanParameters &parameters);
+
+    // the plan key with the payloads appended, it identifies the result of the statement
+    static String MakeResultKey(const String &plan_key, const PlanParameters &parameters);
+
+    // return nullptr if the logical plans have a shape the cache can't rebind
+    static UniquePtr<CachedPlan> MakeCachedPlan(Vector<SharedPtr<LogicalNode>> logical_plans,
+                                                SharedPtr<BindContext> bind_context,
+                                                u64 max_node_id,
+                                                const PlanParameters &parameters,
+                                                TxnTimeStamp schema_version);
+
+    // bind the payloads of another execution and refresh the state read from the previous transaction
+    // return false if the plan can't be used by this transaction
+    static bool BindParameters(CachedPlan &plan, const PlanParameters &parameters, Txn *txn);
+
+    // plans bound before `schema_version`, or newer than the snapshot of the transaction, are dropped
+    UniquePtr<CachedPlan> Take(const String &key, TxnTimeStamp begin_ts, TxnTimeStamp schema_version);
+
+    void Put(const String &key, UniquePtr<CachedPlan> plan);
+
+    void Clear();
+
+    SizeT size() const {
+        std::lock_guard lock(mutex_);
+        return lru_list_.size();
+    }
+
+    SizeT hit_count() const { return hit_count_.load(); }
+
+    SizeT miss_count() const { return miss_count_.load(); }
+
+private:
+    struct CacheEntry {
+        String key_;
+        UniquePtr<CachedPlan> plan_;
+    };
+
+    const SizeT capacity_;
+    mutable std::mutex mutex_;
+    // most recently used entry at the front
+    List<CacheEntry> lru_list_;
+    HashMap<String, List<CacheEntry>::iterator> entry_map_;
+
+    Atomic<SizeT> hit_count_{0};
+    Atomic<SizeT> miss_count_{0};
+};
+
+} // namespace infinity
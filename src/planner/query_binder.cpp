@@ -466,6 +466,7 @@ SharedPtr<BaseTableRef> QueryBinder::BuildBaseTable(QueryContext *query_context,
     Txn *txn = query_context->GetTxn();
 
     SharedPtr<BlockIndex> block_index = table_entry->GetBlockIndex(txn);
+    block_index->RecordAccess();
 
     u64 table_index = bind_context_ptr_->GenerateTableIndex();
     auto table_ref = MakeShared<BaseTableRef>(table_entry, std::move(columns), block_index, alias, table_index, names_ptr, types_ptr);
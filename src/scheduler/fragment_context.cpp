@@ -71,6 +71,7 @@ import column_def;
 import explain_statement;
 import table_entry;
 import segment_entry;
+import aggregate_function;
 
 namespace infinity {
 
@@ -242,7 +243,7 @@ UniquePtr<OperatorState> MakeCompactFinishState(PhysicalCompactFinish *physical_
 }
 
 UniquePtr<OperatorState> MakeAggregateState(PhysicalAggregate *physical_aggregate, FragmentTask *task) {
-    Vector<UniquePtr<char[]>> states;
+    Vector<AggregateStatePtr> states;
     for (auto &expr : physical_aggregate->aggregates_) {
         auto agg_expr = std::static_pointer_cast<AggregateExpression>(expr);
         states.push_back(agg_expr->aggregate_function_.InitState());
@@ -700,7 +701,7 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                 MakeUnique<KnnScanSharedData>(knn_scan_operator->base_table_ref_,
                                               std::move(knn_scan_operator->block_column_entries_),
                                               std::move(knn_scan_operator->index_entries_),
-                                              std::move(knn_expr->opt_params_),
+                                              knn_expr->opt_params_,
                                               knn_expr->topn_,
                                               knn_expr->dimension_,
                                               1,
@@ -715,7 +716,7 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                 MakeUnique<KnnScanSharedData>(knn_scan_operator->base_table_ref_,
                                               std::move(knn_scan_operator->block_column_entries_),
                                               std::move(knn_scan_operator->index_entries_),
-                                              std::move(knn_expr->opt_params_),
+                                              knn_expr->opt_params_,
                                               knn_expr->topn_,
                                               knn_expr->dimension_,
                                               1,
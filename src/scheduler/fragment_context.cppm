@@ -120,7 +120,7 @@ public:
     inline void IncreaseTask() { unfinished_task_n_.fetch_add(1); }
 
     inline void FlushProfiler(TaskProfiler &profiler) {
-        if (!query_context_->is_enable_profiling()) {
+        if (!query_context_->is_profiling_tasks()) {
             return;
         }
         query_context_->FlushProfiler(std::move(profiler));
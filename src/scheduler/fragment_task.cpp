@@ -35,9 +35,42 @@ import defer_op;
 import fragment_context;
 import status;
 import parser_assert;
+import data_block;
+import metrics;
 
 namespace infinity {
 
+namespace {
+
+// registered at the first execution of each operator type, the registry returns the same metrics to racing threads
+struct OperatorMetric {
+    Atomic<MetricHistogram *> execute_{};
+    Atomic<MetricCounter *> output_rows_{};
+};
+
+void RecordOperatorMetric(PhysicalOperatorType type, f64 seconds, const OperatorState *operator_state) {
+    static Array<OperatorMetric, 256> operator_metrics{};
+    OperatorMetric &metric = operator_metrics[static_cast<u8>(type)];
+    MetricHistogram *execute = metric.execute_.load(std::memory_order_acquire);
+    MetricCounter *output_rows = metric.output_rows_.load(std::memory_order_acquire);
+    if (execute == nullptr || output_rows == nullptr) {
+        auto &registry = MetricsRegistry::instance();
+        String labels = MetricsRegistry::Label("operator", PhysicalOperatorToString(type));
+        execute = registry.Histogram("infinity_operator_execute_seconds", "Time of one execution of a physical operator", labels);
+        output_rows = registry.Counter("infinity_operator_output_rows_total", "Rows output by a physical operator", labels);
+        metric.execute_.store(execute, std::memory_order_release);
+        metric.output_rows_.store(output_rows, std::memory_order_release);
+    }
+    execute->Observe(seconds);
+    u64 rows = 0;
+    for (const auto &data_block : operator_state->data_block_array_) {
+        rows += data_block->Finalized() ? data_block->row_count() : 0;
+    }
+    output_rows->Add(rows);
+}
+
+} // namespace
+
 void FragmentTask::Init() {
     //    FragmentContext *fragment_context = (FragmentContext *)fragment_context_;
     // Init each operator input / output
@@ -71,7 +104,7 @@ void FragmentTask::OnExecute() {
         // No source error
         Vector<PhysicalOperator *> &operator_refs = fragment_context->GetOperators();
 
-        bool enable_profiler = query_context->is_enable_profiling();
+        bool enable_profiler = query_context->is_profiling_tasks();
         TaskProfiler profiler(TaskBinding(), enable_profiler, operator_count_);
         HashMap<SizeT, SharedPtr<BaseTableRef>> table_refs;
         profiler.Begin();
@@ -80,9 +113,13 @@ void FragmentTask::OnExecute() {
                 profiler.StartOperator(operator_refs[op_idx]);
                 DeferFn defer_fn([&]() { profiler.StopOperator(operator_states_[op_idx].get()); });
 
+                auto op_begin = std::chrono::steady_clock::now();
                 operator_refs[op_idx]->InputLoad(query_context, operator_states_[op_idx].get(), table_refs);
                 execute_success = operator_refs[op_idx]->Execute(query_context, operator_states_[op_idx].get());
                 operator_refs[op_idx]->FillingTableRefs(table_refs);
+                RecordOperatorMetric(operator_refs[op_idx]->operator_type(),
+                                     std::chrono::duration<f64>(std::chrono::steady_clock::now() - op_begin).count(),
+                                     operator_states_[op_idx].get());
 
                 if (!operator_states_[op_idx]->status_.ok()) {
                     operator_status = operator_states_[op_idx]->status_;
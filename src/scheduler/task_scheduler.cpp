@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <list>
 #include <sched.h>
 
@@ -38,6 +39,8 @@ import base_statement;
 import extra_ddl_info;
 import create_statement;
 import command_statement;
+import metrics;
+import numa_topology;
 
 namespace infinity {
 
@@ -47,26 +50,36 @@ TaskScheduler::TaskScheduler(Config *config_ptr) { Init(config_ptr); }
 
 void TaskScheduler::Init(Config *config_ptr) {
     worker_count_ = config_ptr->CPULimit();
+    auto &metrics_registry = MetricsRegistry::instance();
+    queue_depth_metric_ = metrics_registry.Gauge("infinity_scheduler_queue_depth", "Fragment tasks scheduled to the workers and not finished");
+    task_execute_metric_ = metrics_registry.Histogram("infinity_scheduler_task_execute_seconds", "Time of one execution of a fragment task");
     worker_array_.reserve(worker_count_);
     worker_workloads_.resize(worker_count_);
-    u64 cpu_count = Thread::hardware_concurrency();
 
-    u64 cpu_select_step = cpu_count / worker_count_;
-    if (cpu_select_step >= 2) {
-        cpu_select_step = 2;
-    } else {
-        cpu_select_step = 1;
+    // Workers are dealt to the numa nodes in turn and pinned to the cpus of their node, skipping every other cpu when
+    // the node has enough of them, so that the buffers a worker loads are allocated on its node.
+    const NumaTopology &topology = NumaTopology::instance();
+    SizeT node_count = std::min<SizeT>(topology.node_count(), worker_count_);
+    node_workers_.assign(node_count, {});
+    for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+        node_workers_[worker_id % node_count].push_back(worker_id);
     }
+    LOG_INFO(fmt::format("Scheduler uses {} numa node(s) for {} workers", node_count, worker_count_));
+
+    for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+        SizeT numa_node = worker_id % node_count;
+        SizeT rank = worker_id / node_count;
+        const Vector<u32> &node_cpus = topology.NodeCpus(numa_node);
+        SizeT cpu_select_step = node_cpus.size() / node_workers_[numa_node].size() >= 2 ? 2 : 1;
+        u64 cpu_id = node_cpus[rank * cpu_select_step % node_cpus.size()];
 
-    for (u64 cpu_id = 0, worker_id = 0; worker_id < worker_count_; ++worker_id) {
         UniquePtr<FragmentTaskBlockQueue> worker_queue = MakeUnique<FragmentTaskBlockQueue>();
-        UniquePtr<Thread> worker_thread = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker_queue.get(), worker_id);
+        UniquePtr<Thread> worker_thread = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker_queue.get(), worker_id, numa_node);
         // Pin the thread to specific cpu
-        ThreadUtil::pin(*worker_thread, cpu_id % cpu_count);
+        ThreadUtil::pin(*worker_thread, cpu_id);
 
-        worker_array_.emplace_back(cpu_id, std::move(worker_queue), std::move(worker_thread));
+        worker_array_.emplace_back(cpu_id, numa_node, std::move(worker_queue), std::move(worker_thread));
         worker_workloads_[worker_id] = 0;
-        cpu_id += cpu_select_step;
     }
 
     if (worker_array_.empty()) {
@@ -101,6 +114,41 @@ u64 TaskScheduler::FindLeastWorkloadWorker() {
     return min_workload_worker_id;
 }
 
+u64 TaskScheduler::FindLeastWorkloadWorker(SizeT numa_node) {
+    if (node_workers_.size() <= 1) {
+        return FindLeastWorkloadWorker();
+    }
+    const Vector<u64> &local_workers = node_workers_[numa_node];
+    u64 min_workload_worker_id = local_workers[0];
+    u64 min_workload = worker_workloads_[min_workload_worker_id];
+    for (SizeT i = 1; i < local_workers.size() && min_workload; ++i) {
+        u64 current_worker_load = worker_workloads_[local_workers[i]];
+        if (current_worker_load < min_workload) {
+            min_workload = current_worker_load;
+            min_workload_worker_id = local_workers[i];
+        }
+    }
+    if (min_workload == 0) {
+        return min_workload_worker_id;
+    }
+    // Leave the node only for a worker with strictly less tasks, a remote node costs every later block access
+    u64 global_worker_id = FindLeastWorkloadWorker();
+    if (worker_workloads_[global_worker_id] < min_workload) {
+        return global_worker_id;
+    }
+    return min_workload_worker_id;
+}
+
+SizeT TaskScheduler::PreferredNode(FragmentTask *task) const {
+    // The tasks of a fragment scan consecutive slices of the blocks in task id order, so the slice of a task id goes to
+    // the same node on every query and the buffers it loads stay on that node.
+    SizeT task_n = task->fragment_context()->Tasks().size();
+    if (node_workers_.size() <= 1 || task_n == 0 || task->TaskID() < 0) {
+        return 0;
+    }
+    return std::min<SizeT>(task->TaskID(), task_n - 1) * node_workers_.size() / task_n;
+}
+
 void TaskScheduler::Schedule(PlanFragment *plan_fragment, const BaseStatement *base_statement) {
     if (!initialized_) {
         String error_message = "Scheduler isn't initialized";
@@ -161,7 +209,7 @@ void TaskScheduler::Schedule(PlanFragment *plan_fragment, const BaseStatement *b
                 LOG_CRITICAL(error_message);
                 UnrecoverableError(error_message);
             }
-            u64 worker_id = FindLeastWorkloadWorker();
+            u64 worker_id = FindLeastWorkloadWorker(PreferredNode(task.get()));
             ScheduleTask(task.get(), worker_id);
         }
     }
@@ -198,7 +246,7 @@ void TaskScheduler::ScheduleFragment(PlanFragment *plan_fragment) {
     }
     for (auto *task_ptr : task_ptrs) {
         if (task_ptr->LastWorkerID() == -1) {
-            u64 worker_id = FindLeastWorkloadWorker();
+            u64 worker_id = FindLeastWorkloadWorker(PreferredNode(task_ptr));
             ScheduleTask(task_ptr, worker_id);
         } else {
             ScheduleTask(task_ptr, task_ptr->LastWorkerID());
@@ -208,10 +256,12 @@ void TaskScheduler::ScheduleFragment(PlanFragment *plan_fragment) {
 
 void TaskScheduler::ScheduleTask(FragmentTask *task, u64 worker_id) {
     ++worker_workloads_[worker_id];
+    queue_depth_metric_->Add(1);
     worker_array_[worker_id].queue_->Enqueue(task);
 }
 
-void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id) {
+void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id, SizeT numa_node) {
+    NumaTopology::SetThreadNode(numa_node);
     List<FragmentTask *> task_lists;
     auto iter = task_lists.end();
     auto last_iter = task_lists.end();
@@ -238,11 +288,15 @@ void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id
         auto *fragment_ctx = fragment_task->fragment_context();
         if (!fragment_ctx->notifier()->StartTask()) {
             --worker_workloads_[worker_id];
+            queue_depth_metric_->Add(-1);
             iter = task_lists.erase(iter);
             continue;
         }
 
-        fragment_task->OnExecute();
+        {
+            MetricTimer timer(task_execute_metric_);
+            fragment_task->OnExecute();
+        }
         fragment_task->SetLastWorkID(worker_id);
 
         bool error = false;
@@ -252,11 +306,13 @@ void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id
             if (fragment_task->IsComplete()) {
                 // auto *sink_op = fragment_ctx->GetSinkOperator();
                 --worker_workloads_[worker_id];
+                queue_depth_metric_->Add(-1);
                 fragment_task->CompleteTask();
                 iter = task_lists.erase(iter);
                 finish = true;
             } else if (fragment_task->QuitFromWorkerLoop()) {
                 --worker_workloads_[worker_id];
+                queue_depth_metric_->Add(-1);
                 iter = task_lists.erase(iter);
             } else {
                 ++iter;
@@ -265,6 +321,7 @@ void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id
             error = true;
             finish = true;
             --worker_workloads_[worker_id];
+            queue_depth_metric_->Add(-1);
             iter = task_lists.erase(iter);
         }
         if (finish || error) {
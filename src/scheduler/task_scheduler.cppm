@@ -21,6 +21,7 @@ import stl;
 import fragment_task;
 import blocking_queue;
 import base_statement;
+import metrics;
 
 namespace infinity {
 
@@ -30,9 +31,10 @@ class PlanFragment;
 using FragmentTaskBlockQueue = BlockingQueue<FragmentTask*>;
 
 struct Worker {
-    Worker(u64 cpu_id, UniquePtr<FragmentTaskBlockQueue> queue, UniquePtr<Thread> thread)
-        : cpu_id_(cpu_id), queue_(std::move(queue)), thread_(std::move(thread)) {}
+    Worker(u64 cpu_id, SizeT numa_node, UniquePtr<FragmentTaskBlockQueue> queue, UniquePtr<Thread> thread)
+        : cpu_id_(cpu_id), numa_node_(numa_node), queue_(std::move(queue)), thread_(std::move(thread)) {}
     u64 cpu_id_{0};
+    SizeT numa_node_{0};
     UniquePtr<FragmentTaskBlockQueue> queue_{};
     UniquePtr<Thread> thread_{};
 };
@@ -58,19 +60,31 @@ public:
 private:
     u64 FindLeastWorkloadWorker();
 
+    // The least loaded worker of the node, unless a worker of another node has less tasks
+    u64 FindLeastWorkloadWorker(SizeT numa_node);
+
+    // The node a task without a last worker goes to
+    SizeT PreferredNode(FragmentTask *task) const;
+
     void ScheduleTask(FragmentTask *task, u64 worker_id);
 
     void RunTask(FragmentTask *task);
 
-    void WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id);
+    void WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id, SizeT numa_node);
 
 private:
     bool initialized_{false};
 
     Vector<Worker> worker_array_{};
     Deque<Atomic<u64>> worker_workloads_{};
+    // worker ids of each numa node that has workers
+    Vector<Vector<u64>> node_workers_{};
 
     u64 worker_count_{0};
+
+    // tasks scheduled to the workers and not yet finished or quit, the sum of worker_workloads_
+    MetricGauge *queue_depth_metric_{};
+    MetricHistogram *task_execute_metric_{};
 };
 
 } // namespace infinity
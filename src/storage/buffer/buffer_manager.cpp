@@ -146,6 +146,8 @@ void BufferManager::RequestSpace(SizeT need_size) {
     current_memory_size_ += need_size;
 }
 
+void BufferManager::ReleaseSpace(SizeT free_size) { current_memory_size_ -= free_size; }
+
 void BufferManager::PushGCQueue(BufferObj *buffer_obj) {
     std::unique_lock lock(gc_locker_);
     auto iter = gc_map_.find(buffer_obj);
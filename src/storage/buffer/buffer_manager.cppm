@@ -66,6 +66,9 @@ private:
     // BufferHandle calls it, before allocate memory. It will start GC if necessary.
     void RequestSpace(SizeT need_size);
 
+    // BufferObj calls it, when the buffer takes less memory than it was charged.
+    void ReleaseSpace(SizeT free_size);
+
     // BufferHandle calls it, after unload.
     void PushGCQueue(BufferObj *buffer_obj);
 
@@ -23,11 +23,54 @@ import logger;
 
 import third_party;
 import logger;
+import file_worker_type;
+import metrics;
+import numa_topology;
 
 module buffer_obj;
 
 namespace infinity {
 
+namespace {
+
+struct BufferMetric {
+    MetricCounter *hit_{};
+    MetricCounter *miss_{};
+    MetricCounter *evict_bytes_{};
+};
+
+const BufferMetric &GetBufferMetric(FileWorkerType type) {
+    constexpr SizeT type_count = static_cast<SizeT>(FileWorkerType::kInvalid);
+    static const Array<BufferMetric, type_count> buffer_metrics = [] {
+        Array<BufferMetric, type_count> res;
+        auto &registry = MetricsRegistry::instance();
+        for (SizeT i = 0; i < type_count; ++i) {
+            String labels = MetricsRegistry::Label("file_worker", FileWorkerType2Str(static_cast<FileWorkerType>(i)));
+            res[i].hit_ = registry.Counter("infinity_buffer_hit_total", "Buffer loads served from memory", labels);
+            res[i].miss_ = registry.Counter("infinity_buffer_miss_total", "Buffer loads read from disk", labels);
+            res[i].evict_bytes_ = registry.Counter("infinity_buffer_evict_bytes_total", "Bytes of the buffers evicted from memory", labels);
+        }
+        return res;
+    }();
+    return buffer_metrics[static_cast<SizeT>(type)];
+}
+
+// The block data is read by a worker pinned to one numa node, but the allocator may hand out pages another node touched
+// before, so they are moved to the node of the loading worker. Other buffers are left to the first touch policy.
+void PlaceOnThreadNode(FileWorker *file_worker, SizeT size) {
+    if (file_worker->Type() != FileWorkerType::kDataFile) {
+        return;
+    }
+    i64 numa_node = NumaTopology::ThreadNode();
+    const NumaTopology &topology = NumaTopology::instance();
+    if (numa_node < 0 || topology.node_count() <= 1) {
+        return;
+    }
+    topology.MovePagesToNode(file_worker->GetData(), size, numa_node);
+}
+
+} // namespace
+
 BufferObj::BufferObj(BufferManager *buffer_mgr, bool is_ephemeral, UniquePtr<FileWorker> file_worker)
     : buffer_mgr_(buffer_mgr), file_worker_(std::move(file_worker)) {
     // Init other info
@@ -48,9 +91,11 @@ BufferHandle BufferObj::Load() {
     std::unique_lock<std::mutex> locker(w_locker_);
     switch (status_) {
         case BufferStatus::kLoaded: {
+            GetBufferMetric(file_worker_->Type()).hit_->Add();
             break;
         }
         case BufferStatus::kUnloaded: {
+            GetBufferMetric(file_worker_->Type()).hit_->Add();
             if (!buffer_mgr_->RemoveFromGCQueue(this)) {
                 String error_message = fmt::format("attempt to buffer: {} status is UNLOADED, but not in GC queue", GetFilename());
                 LOG_CRITICAL(error_message);
@@ -59,7 +104,9 @@ BufferHandle BufferObj::Load() {
             break;
         }
         case BufferStatus::kFreed: {
-            buffer_mgr_->RequestSpace(GetBufferSize());
+            GetBufferMetric(file_worker_->Type()).miss_->Add();
+            buffer_size_ = file_worker_->GetMemoryCost();
+            buffer_mgr_->RequestSpace(buffer_size_);
             if (type_ == BufferType::kEphemeral) {
                 String error_message = "Invalid status";
                 LOG_CRITICAL(error_message);
@@ -67,12 +114,17 @@ BufferHandle BufferObj::Load() {
             }
             bool from_spill = type_ != BufferType::kPersistent;
             file_worker_->ReadFromFile(from_spill);
+            ChargeBufferSize();
+            PlaceOnThreadNode(file_worker_.get(), GetBufferSize());
             break;
         }
         case BufferStatus::kNew: {
-            LOG_TRACE(fmt::format("Request memory {}", GetBufferSize()));
-            buffer_mgr_->RequestSpace(GetBufferSize());
+            buffer_size_ = file_worker_->GetMemoryCost();
+            LOG_TRACE(fmt::format("Request memory {}", buffer_size_));
+            buffer_mgr_->RequestSpace(buffer_size_);
             file_worker_->AllocateInMemory();
+            ChargeBufferSize();
+            PlaceOnThreadNode(file_worker_.get(), GetBufferSize());
             LOG_TRACE(fmt::format("Allocated memory {}", GetBufferSize()));
             break;
         }
@@ -111,6 +163,7 @@ bool BufferObj::Free() {
             break;
         }
     }
+    GetBufferMetric(file_worker_->Type()).evict_bytes_->Add(GetBufferSize());
     file_worker_->FreeInMemory();
     status_ = BufferStatus::kFreed;
     return true;
@@ -224,6 +277,7 @@ void BufferObj::UnloadInner() {
         case BufferStatus::kLoaded: {
             --rc_;
             if (rc_ == 0) {
+                ChargeBufferSize();
                 buffer_mgr_->PushGCQueue(this);
                 status_ = BufferStatus::kUnloaded;
             }
@@ -237,6 +291,16 @@ void BufferObj::UnloadInner() {
     }
 }
 
+void BufferObj::ChargeBufferSize() {
+    SizeT buffer_size = file_worker_->GetMemoryCost();
+    if (buffer_size > buffer_size_) {
+        buffer_mgr_->RequestSpace(buffer_size - buffer_size_);
+    } else {
+        buffer_mgr_->ReleaseSpace(buffer_size_ - buffer_size);
+    }
+    buffer_size_ = buffer_size;
+}
+
 void BufferObj::CheckState() const {
     std::unique_lock<std::mutex> locker(w_locker_);
     switch (status_) {
@@ -101,7 +101,8 @@ public:
 
     void CleanupTempFile() const;
 
-    SizeT GetBufferSize() const { return file_worker_->GetMemoryCost(); }
+    // The memory charged to the buffer manager for this buffer.
+    SizeT GetBufferSize() const { return buffer_size_; }
 
     String GetFilename() const { return file_worker_->GetFilePath(); }
 
@@ -121,6 +122,9 @@ private:
     // called when BufferHandle destructs, to decrease rc_ by 1.
     void UnloadInner();
 
+    // Charge the buffer manager for the memory the file worker takes now, some buffers grow after they are loaded.
+    void ChargeBufferSize();
+
 public:
     // interface for unit test
     BufferStatus status() const {
@@ -141,6 +145,7 @@ protected:
     BufferStatus status_{BufferStatus::kNew};
     BufferType type_{BufferType::kTemp};
     u64 rc_{0};
+    SizeT buffer_size_{0};
     const UniquePtr<FileWorker> file_worker_;
 };
 
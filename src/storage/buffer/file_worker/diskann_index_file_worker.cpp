@@ -0,0 +1,112 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module diskann_index_file_worker;
+
+import stl;
+import index_file_worker;
+import file_worker;
+import index_base;
+import index_diskann;
+import diskann_index;
+import diskann_pq;
+import infinity_exception;
+import embedding_info;
+import internal_types;
+import status;
+import logger;
+import third_party;
+
+namespace infinity {
+
+DiskAnnIndexFileWorker::~DiskAnnIndexFileWorker() {
+    if (data_ != nullptr) {
+        FreeInMemory();
+        data_ = nullptr;
+    }
+}
+
+void DiskAnnIndexFileWorker::AllocateInMemory() {
+    if (data_) {
+        const auto error_message = "Data is already allocated.";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    NewIndex();
+}
+
+void DiskAnnIndexFileWorker::FreeInMemory() {
+    if (!data_) {
+        const auto error_message = "Data is not allocated.";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    auto *index = static_cast<DiskAnnIndex *>(data_);
+    delete index;
+    data_ = nullptr;
+}
+
+void DiskAnnIndexFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success) {
+    if (!data_) {
+        UnrecoverableError("Data is not allocated.");
+    }
+    auto *index = static_cast<DiskAnnIndex *>(data_);
+    index->Save(*file_handler_);
+    prepare_success = true;
+}
+
+void DiskAnnIndexFileWorker::ReadFromFileImpl() {
+    if (data_) {
+        const auto error_message = "Data is already allocated.";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    NewIndex();
+    auto *index = static_cast<DiskAnnIndex *>(data_);
+    index->Load(*file_handler_);
+}
+
+void DiskAnnIndexFileWorker::NewIndex() {
+    const auto *embedding_info = GetEmbeddingInfo();
+    if (embedding_info->Type() != EmbeddingDataType::kElemFloat) {
+        const auto error_message = "DiskAnn index should be created on Float column now.";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    const auto *index_diskann = static_cast<const IndexDiskAnn *>(index_base_.get());
+    const SizeT dimension = embedding_info->Dimension();
+    SizeT pq_subspace_num = index_diskann->pq_subspace_num_;
+    if (pq_subspace_num == 0) {
+        pq_subspace_num = DiskAnnPQ::DefaultSubspaceNum(dimension);
+    } else if (pq_subspace_num > dimension || dimension % pq_subspace_num != 0) {
+        Status status = Status::InvalidIndexParam(fmt::format("pq_subspace_num {} of dimension {}", pq_subspace_num, dimension));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    auto *index = new DiskAnnIndex(dimension,
+                                   index_diskann->metric_type_,
+                                   index_diskann->max_degree_,
+                                   index_diskann->build_list_size_,
+                                   index_diskann->alpha_,
+                                   pq_subspace_num);
+    data_ = static_cast<void *>(index);
+}
+
+const EmbeddingInfo *DiskAnnIndexFileWorker::GetEmbeddingInfo() const {
+    return static_cast<EmbeddingInfo *>(column_def_->type()->type_info().get());
+}
+
+} // namespace infinity
@@ -33,6 +33,7 @@ export enum class FileWorkerType {
     kIndexFile,
     kEMVBIndexFile,
     kBMPIndexFile,
+    kDiskAnnIndexFile,
     kInvalid,
 };
 
@@ -68,6 +69,9 @@ export String FileWorkerType2Str(FileWorkerType type) {
         case FileWorkerType::kBMPIndexFile: {
             return "BMP index";
         }
+        case FileWorkerType::kDiskAnnIndexFile: {
+            return "DiskAnn index";
+        }
         case FileWorkerType::kInvalid: {
             String error_message = "Invalid file worker type";
             LOG_CRITICAL(error_message);
@@ -60,8 +60,13 @@ void VersionFileWorker::FreeInMemory() {
     data_ = nullptr;
 }
 
-// FIXME
-SizeT VersionFileWorker::GetMemoryCost() const { return capacity_ * sizeof(TxnTimeStamp); }
+// The cost grows with the deletes, the buffer object charges it again after load and each time it is unloaded.
+SizeT VersionFileWorker::GetMemoryCost() const {
+    if (data_ == nullptr) {
+        return 0;
+    }
+    return static_cast<const BlockVersion *>(data_)->MemoryCost();
+}
 
 void VersionFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success) {
     if (data_ == nullptr) {
@@ -16,6 +16,7 @@ module;
 
 #include <cstring>
 #include <sstream>
+#include <string_view>
 
 module column_vector;
 
@@ -897,6 +898,16 @@ String ColumnVector::ToString(SizeT row_index) const {
     return String();
 }
 
+std::string_view ColumnVector::GetVarcharView(SizeT index, String &buffer) const {
+    const VarcharT &varchar = reinterpret_cast<const VarcharT *>(data_ptr_)[index];
+    if (varchar.IsInlined()) {
+        return {varchar.short_.data_, varchar.length_};
+    }
+    buffer.resize(varchar.length_);
+    buffer_->fix_heap_mgr_->ReadFromHeap(buffer.data(), varchar.vector_.chunk_id_, varchar.vector_.chunk_offset_, varchar.length_);
+    return buffer;
+}
+
 Value ColumnVector::GetValue(SizeT index) const {
     if (!initialized) {
         String error_message = "Column vector isn't initialized.";
@@ -17,6 +17,7 @@ module;
 #include <compare>
 #include <concepts>
 #include <sstream>
+#include <string_view>
 
 export module column_vector;
 
@@ -202,6 +203,10 @@ public:
     // Directly uses data_ptr in vectorized computation.
     Value GetValue(SizeT index) const;
 
+    // The varchar at the index without constructing a Value. The view may refer to the buffer, which holds
+    // the content read from the heap, so it's valid until the buffer is reused.
+    std::string_view GetVarcharView(SizeT index, String &buffer) const;
+
     // Set the <index> element of the vector to the specified value.
     void SetValue(SizeT index, const Value &Value);
 
@@ -87,6 +87,18 @@ public:
         }
     }
 
+    // The bytes held by the buffer and its heaps
+    [[nodiscard]] SizeT MemorySize() const {
+        SizeT memory_size = data_size_;
+        if (fix_heap_mgr_.get() != nullptr) {
+            memory_size += fix_heap_mgr_->total_mem();
+        }
+        if (fix_heap_mgr_1_.get() != nullptr) {
+            memory_size += fix_heap_mgr_1_->total_mem();
+        }
+        return memory_size;
+    }
+
     [[nodiscard]] bool GetCompactBit(SizeT idx) const;
 
     void SetCompactBit(SizeT idx, bool val);
@@ -48,6 +48,19 @@ void BlockIndex::Insert(SegmentEntry *segment_entry, Txn *txn) {
     }
 }
 
+void BlockIndex::RecordAccess() const {
+    // Sample one query in 16 per thread and count it 16 times, so that most queries don't write the shared counters of
+    // every segment. The heat only needs to be right in magnitude.
+    constexpr u64 sample_rate = 16;
+    thread_local u64 query_count = 0;
+    if (++query_count % sample_rate != 0) {
+        return;
+    }
+    for (const auto &[_, segment_info] : segment_block_index_) {
+        segment_info.segment_entry_->IncreaseAccessCount(sample_rate);
+    }
+}
+
 SegmentOffset BlockIndex::GetSegmentOffset(SegmentID segment_id) const {
     auto seg_it = segment_block_index_.find(segment_id);
     if (seg_it != segment_block_index_.end()) {
@@ -57,6 +57,9 @@ public:
 
     bool IsEmpty() const { return segment_block_index_.empty(); }
 
+    // count a query reading the segments, sampled, see SegmentEntry::access_count
+    void RecordAccess() const;
+
 public:
     Map<SegmentID, SegmentSnapshot> segment_block_index_;
 };
@@ -14,6 +14,7 @@
 
 module;
 
+#include <cmath>
 #include <utility>
 #include <vector>
 
@@ -30,6 +31,19 @@ import table_entry;
 
 namespace infinity {
 
+f64 CompactionCostModel::RewriteScore(SizeT row_count, SizeT actual_row_count, SizeT index_count, u64 access_count) const {
+    if (row_count == 0 || actual_row_count >= row_count) {
+        return 0;
+    }
+    SizeT deleted_row_count = row_count - actual_row_count;
+    if (deleted_row_count < min_deleted_rows_ || static_cast<f64>(deleted_row_count) < min_delete_ratio_ * row_count) {
+        return 0;
+    }
+    f64 benefit = deleted_row_count * (1 + heat_weight_ * std::log2(1.0 + access_count));
+    f64 cost = std::max<SizeT>(actual_row_count, 1) * (1 + index_rebuild_cost_ * index_count);
+    return benefit / cost;
+}
+
 void SegmentLayer::AddSegment(SegmentEntry *segment_entry) {
     SegmentID segment_id = segment_entry->segment_id();
     auto [iter, insert_ok] = segments_.emplace(segment_id, segment_entry);
@@ -67,6 +81,18 @@ Vector<SegmentEntry *> SegmentLayer::PickCompacting(TransactionID txn_id, SizeT
     return ret;
 }
 
+Vector<SegmentEntry *> SegmentLayer::PickCompacting(TransactionID txn_id, SegmentEntry *segment_entry) {
+    RemoveSegment(segment_entry);
+    Vector<SegmentEntry *> ret{segment_entry};
+    auto [iter, insert_ok] = compacting_segments_map_.emplace(txn_id, ret);
+    if (!insert_ok) {
+        String error_message = fmt::format("TransactionID conflict: {}", txn_id);
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    return ret;
+}
+
 void SegmentLayer::CommitCompact(TransactionID txn_id) {
     SizeT remove_n = compacting_segments_map_.erase(txn_id);
     if (remove_n != 1) {
@@ -97,6 +123,8 @@ SegmentEntry *SegmentLayer::FindSegment(SegmentID segment_id) {
 }
 
 Vector<SegmentEntry *> DBTCompactionAlg::CheckCompaction(TransactionID txn_id) {
+    // read before locking, the index map of the table is locked when rows are deleted
+    SizeT index_count = table_entry_ == nullptr ? 0 : table_entry_->IndexCount();
     std::unique_lock lock(mtx_);
 
     if (status_ == CompactionStatus::kDisable) {
@@ -116,6 +144,20 @@ Vector<SegmentEntry *> DBTCompactionAlg::CheckCompaction(TransactionID txn_id) {
             return compact_segments;
         }
     }
+
+    // no layer is full, rewrite a segment whose deleted rows cost more than removing them
+    if (auto [rewrite_segment, layer] = PickRewriteSegment(index_count); rewrite_segment != nullptr) {
+        if (++running_task_n_ == 1) {
+            status_ = CompactionStatus::kRunning;
+        }
+        LOG_DEBUG(fmt::format("Rewrite segment {}, {} of {} rows are deleted",
+                              rewrite_segment->segment_id(),
+                              rewrite_segment->row_count() - rewrite_segment->actual_row_count(),
+                              rewrite_segment->row_count()));
+        Vector<SegmentEntry *> compact_segments = segment_layers_[layer].PickCompacting(txn_id, rewrite_segment);
+        txn_2_layer_.emplace(txn_id, layer);
+        return compact_segments;
+    }
     return {};
 }
 
@@ -252,4 +294,19 @@ Pair<SegmentEntry *, int> DBTCompactionAlg::FindSegmentAndLayer(SegmentID segmen
     return {nullptr, -1};
 }
 
+Pair<SegmentEntry *, int> DBTCompactionAlg::PickRewriteSegment(SizeT index_count) const {
+    Pair<SegmentEntry *, int> result{nullptr, -1};
+    f64 best_score = 1;
+    for (int layer = 0; layer < (int)segment_layers_.size(); ++layer) {
+        for (const auto &[segment_id, segment_entry] : segment_layers_[layer].segments()) {
+            f64 score = cost_model_.RewriteScore(segment_entry->row_count(), segment_entry->actual_row_count(), index_count, segment_entry->access_count());
+            if (score >= best_score) {
+                best_score = score;
+                result = {segment_entry, layer};
+            }
+        }
+    }
+    return result;
+}
+
 } // namespace infinity
@@ -26,9 +26,28 @@ import txn;
 import compaction_alg;
 import table_entry;
 import logger;
+import default_values;
 
 namespace infinity {
 
+// Decides whether a segment with deleted rows is rewritten alone. The layers only merge segments by their live row
+// count, so the deleted rows of a segment are kept until its layer is full, and every query reading the segment and
+// every index of it pays for them till then. Rewriting copies the live rows and rebuilds each index on them, and it
+// saves the work spent on the deleted rows by the queries reading the segment later, which the segment's query heat
+// stands for.
+export struct CompactionCostModel {
+    // the benefit of rewriting over its cost, the segment is worth rewriting if it's at least 1
+    f64 RewriteScore(SizeT row_count, SizeT actual_row_count, SizeT index_count, u64 access_count) const;
+
+    // below either of them the deleted rows are left to the merge of the layer
+    f64 min_delete_ratio_{DEFAULT_COMPACTION_MIN_DELETE_RATIO};
+    SizeT min_deleted_rows_{DEFAULT_BLOCK_CAPACITY};
+    // the cost to rebuild one index for a row, relative to copying the row
+    f64 index_rebuild_cost_{DEFAULT_COMPACTION_INDEX_REBUILD_COST};
+    // the extra saving of a deleted row each time the number of the queries reading the segment doubles
+    f64 heat_weight_{DEFAULT_COMPACTION_HEAT_WEIGHT};
+};
+
 class DBTConfig {
 public:
     DBTConfig(SizeT m, SizeT c, SizeT s) : m_(m), c_(c), s_(s) {
@@ -62,6 +81,8 @@ public:
 
     Vector<SegmentEntry *> PickCompacting(TransactionID txn_id, SizeT M);
 
+    Vector<SegmentEntry *> PickCompacting(TransactionID txn_id, SegmentEntry *segment_entry);
+
     void CommitCompact(TransactionID txn_id);
 
     void RollbackCompact(TransactionID txn_id);
@@ -70,6 +91,8 @@ public:
 
     SegmentEntry *FindSegment(SegmentID segment_id);
 
+    const HashMap<SegmentID, SegmentEntry *> &segments() const { return segments_; }
+
 private:
     HashMap<SegmentID, SegmentEntry *> segments_;
     HashMap<TransactionID, Vector<SegmentEntry *>> compacting_segments_map_;
@@ -77,9 +100,9 @@ private:
 
 export class DBTCompactionAlg final : public CompactionAlg {
 public:
-    DBTCompactionAlg(int m, int c, int s, SizeT max_segment_capacity, TableEntry *table_entry = nullptr)
-        : CompactionAlg(), config_(m, c, s), max_layer_(config_.CalculateLayer(max_segment_capacity)), table_entry_(table_entry), running_task_n_(0) {
-    }
+    DBTCompactionAlg(int m, int c, int s, SizeT max_segment_capacity, TableEntry *table_entry = nullptr, CompactionCostModel cost_model = {})
+        : CompactionAlg(), config_(m, c, s), max_layer_(config_.CalculateLayer(max_segment_capacity)), table_entry_(table_entry),
+          cost_model_(cost_model), running_task_n_(0) {}
 
     virtual Vector<SegmentEntry *> CheckCompaction(TransactionID txn_id) override;
 
@@ -101,10 +124,14 @@ private:
 
     Pair<SegmentEntry *, int> FindSegmentAndLayer(SegmentID segment_id);
 
+    // the segment with the highest rewrite score not less than 1, and its layer
+    Pair<SegmentEntry *, int> PickRewriteSegment(SizeT index_count) const;
+
 private:
     const DBTConfig config_;
     const int max_layer_;
     TableEntry *table_entry_;
+    const CompactionCostModel cost_model_;
 
     std::mutex mtx_;
     Vector<SegmentLayer> segment_layers_;
@@ -0,0 +1,70 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <chrono>
+#include <thread>
+
+module compaction_rate_limiter;
+
+import stl;
+
+namespace infinity {
+
+CompactionRateLimiter::CompactionRateLimiter(SizeT bytes_per_second)
+    : bytes_per_second_(bytes_per_second), available_(bytes_per_second), last_refill_(std::chrono::steady_clock::now()) {}
+
+void CompactionRateLimiter::SetRate(SizeT bytes_per_second) {
+    std::unique_lock lock(mtx_);
+    bytes_per_second_ = bytes_per_second;
+    available_ = std::min(available_, static_cast<f64>(bytes_per_second));
+}
+
+i64 CompactionRateLimiter::Acquire(SizeT bytes) {
+    std::chrono::microseconds wait_time{0};
+    {
+        std::unique_lock lock(mtx_);
+        wait_time = TakeTokens(bytes);
+    }
+    if (wait_time.count() > 0) {
+        std::this_thread::sleep_for(wait_time);
+    }
+    return wait_time.count();
+}
+
+void CompactionRateLimiter::Charge(SizeT bytes) {
+    std::unique_lock lock(mtx_);
+    TakeTokens(bytes);
+}
+
+i64 CompactionRateLimiter::Wait() { return Acquire(0); }
+
+std::chrono::microseconds CompactionRateLimiter::TakeTokens(SizeT bytes) {
+    const f64 rate = bytes_per_second_;
+    if (rate == 0) {
+        return std::chrono::microseconds(0);
+    }
+    auto now = std::chrono::steady_clock::now();
+    f64 elapsed_seconds = std::chrono::duration<f64>(now - last_refill_).count();
+    last_refill_ = now;
+    available_ = std::min(rate, available_ + elapsed_seconds * rate);
+    available_ -= bytes;
+    if (available_ < 0) {
+        return std::chrono::microseconds(static_cast<i64>(-available_ / rate * 1'000'000));
+    }
+    return std::chrono::microseconds(0);
+}
+
+} // namespace infinity
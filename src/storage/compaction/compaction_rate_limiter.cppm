@@ -0,0 +1,59 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <chrono>
+
+export module compaction_rate_limiter;
+
+import stl;
+
+namespace infinity {
+
+// A token bucket shared by the background compaction tasks, which bounds the bytes they rewrite per second so that
+// compaction doesn't compete with the foreground queries for the disk. The bucket holds at most one second of tokens.
+// A caller takes its tokens at once and sleeps off the debt, so the waiting callers are served in order. The compaction
+// tasks on the scheduler only Charge the bytes they copy, and the compaction thread Waits off the debt before it starts
+// the next compaction, so no scheduler worker ever sleeps.
+export class CompactionRateLimiter {
+public:
+    // 0 means unlimited
+    explicit CompactionRateLimiter(SizeT bytes_per_second);
+
+    void SetRate(SizeT bytes_per_second);
+
+    SizeT rate() const { return bytes_per_second_.load(); }
+
+    // Block until the bytes can be written under the rate. Return the time slept in microseconds.
+    i64 Acquire(SizeT bytes);
+
+    // Take the tokens of the bytes already written, never blocks.
+    void Charge(SizeT bytes);
+
+    // Block until the debt of the charged bytes is paid off. Return the time slept in microseconds.
+    i64 Wait();
+
+private:
+    // Take the bytes from the bucket and return how long the debt takes to pay off, requires mtx_.
+    std::chrono::microseconds TakeTokens(SizeT bytes);
+
+    std::mutex mtx_;
+    Atomic<SizeT> bytes_per_second_;
+    // negative when the callers are in debt
+    f64 available_{0};
+    std::chrono::steady_clock::time_point last_refill_;
+};
+
+} // namespace infinity
@@ -35,9 +35,20 @@ import compact_statement;
 import compilation_config;
 import defer_op;
 import bg_query_state;
+import metrics;
 
 namespace infinity {
 
+namespace {
+
+MetricHistogram *CompactMetric() {
+    static MetricHistogram *compact_metric =
+        MetricsRegistry::instance().Histogram("infinity_compaction_seconds", "Time of a compaction round, from scanning the tables to committing");
+    return compact_metric;
+}
+
+} // namespace
+
 CompactionProcessor::CompactionProcessor(Catalog *catalog, TxnManager *txn_mgr) : catalog_(catalog), txn_mgr_(txn_mgr) {}
 
 void CompactionProcessor::Start() {
@@ -60,6 +71,9 @@ void CompactionProcessor::Submit(SharedPtr<BGTask> bg_task) {
 }
 
 void CompactionProcessor::DoCompact() {
+    // the compaction tasks charge the bytes they copy, sleep them off before the txns of this round are opened
+    rate_limiter_.Wait();
+    auto begin = std::chrono::steady_clock::now();
     Txn *scan_txn = txn_mgr_->BeginTxn(MakeUnique<String>("ScanForCompact"));
     bool success = false;
     DeferFn defer_fn([&] {
@@ -84,10 +98,15 @@ void CompactionProcessor::DoCompact() {
     }
     txn_mgr_->CommitTxn(scan_txn);
     success = true;
+    // the rounds finding nothing to compact are not observed
+    if (!statements.empty()) {
+        CompactMetric()->Observe(std::chrono::duration<f64>(std::chrono::steady_clock::now() - begin).count());
+    }
 }
 
 TxnTimeStamp
 CompactionProcessor::ManualDoCompact(const String &schema_name, const String &table_name, bool rollback, Optional<std::function<void()>> mid_func) {
+    MetricTimer timer(CompactMetric());
     auto statement = MakeUnique<ManualCompactStatement>(schema_name, table_name);
     Txn *txn = txn_mgr_->BeginTxn(MakeUnique<String>("ManualCompact"));
     BGQueryContextWrapper wrapper(txn);
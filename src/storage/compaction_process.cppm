@@ -21,6 +21,8 @@ import txn;
 import bg_task;
 import blocking_queue;
 import base_statement;
+import compaction_rate_limiter;
+import default_values;
 
 namespace infinity {
 
@@ -42,6 +44,9 @@ public:
 
     u64 RunningTaskCount() const { return task_count_; }
 
+    // paces the auto compactions by the bytes they copy, a manual compaction isn't limited
+    CompactionRateLimiter *rate_limiter() { return &rate_limiter_; }
+
     TxnTimeStamp ManualDoCompact(const String &schema_name,
                                  const String &table_name,
                                  bool rollback,
@@ -64,6 +69,8 @@ private:
     SessionManager *session_mgr_{};
 
     Atomic<u64> task_count_{};
+
+    CompactionRateLimiter rate_limiter_{DEFAULT_COMPACTION_IO_RATE};
 };
 
 } // namespace infinity
\ No newline at end of file
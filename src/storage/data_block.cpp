@@ -152,6 +152,7 @@ void DataBlock::UnInit() {
     }
 
     column_vectors.clear();
+    selection_.reset();
 
     row_count_ = 0;
     initialized = false;
@@ -174,6 +175,7 @@ void DataBlock::Reset() {
         column_vectors[i]->Reset();
         column_vectors[i]->Initialize(old_vector_type);
     }
+    selection_.reset();
 
     row_count_ = 0;
     finalized = false;
@@ -195,6 +197,7 @@ void DataBlock::Reset(SizeT capacity) {
         column_vectors[i]->Reset();
         column_vectors[i]->Initialize(old_vector_type, capacity);
     }
+    selection_.reset();
     row_count_ = 0;
     capacity_ = capacity;
     finalized = false;
@@ -321,6 +324,10 @@ void DataBlock::AppendWith(const DataBlock *other) {
         UnrecoverableError(error_message);
     }
 
+    if (other->HasSelection()) {
+        AppendWith(other, 0, other->row_count());
+        return;
+    }
     SizeT column_count = this->column_count();
     for (SizeT idx = 0; idx < column_count; ++idx) {
         this->column_vectors[idx]->AppendWith(*other->column_vectors[idx]);
@@ -342,11 +349,57 @@ void DataBlock::AppendWith(const DataBlock *other, SizeT from, SizeT count) {
         UnrecoverableError(error_message);
     }
     SizeT column_count = this->column_count();
+    if (other->HasSelection()) {
+        // copy the selected rows straight from the unfiltered columns, one run of adjacent rows at a time
+        const Selection &selection = *other->selection_;
+        SizeT idx = from;
+        const SizeT end = from + count;
+        while (idx < end) {
+            const SizeT run_begin = selection[idx];
+            SizeT run_length = 1;
+            while (idx + run_length < end && selection[idx + run_length] == run_begin + run_length) {
+                ++run_length;
+            }
+            for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+                this->column_vectors[column_idx]->AppendWith(*other->column_vectors[column_idx], run_begin, run_length);
+            }
+            idx += run_length;
+        }
+        return;
+    }
     for (SizeT idx = 0; idx < column_count; ++idx) {
         this->column_vectors[idx]->AppendWith(*other->column_vectors[idx], from, count);
     }
 }
 
+void DataBlock::SetSelection(SharedPtr<Selection> selection) {
+    if (!finalized || HasSelection()) {
+        String error_message = "Selection can only be set on a finalized block without selection";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    row_count_ = selection->Size();
+    selection_ = std::move(selection);
+}
+
+void DataBlock::Materialize() { Materialize(Vector<bool>(column_count_, true)); }
+
+void DataBlock::Materialize(const Vector<bool> &column_used) {
+    if (!HasSelection()) {
+        return;
+    }
+    for (SizeT idx = 0; idx < column_count_; ++idx) {
+        if (idx >= column_used.size() || !column_used[idx]) {
+            continue;
+        }
+        auto column_vector = MakeShared<ColumnVector>(column_vectors[idx]->data_type());
+        column_vector->Initialize(*column_vectors[idx], *selection_);
+        column_vectors[idx] = std::move(column_vector);
+    }
+    capacity_ = column_vectors[0]->capacity();
+    selection_.reset();
+}
+
 void DataBlock::InsertVector(const SharedPtr<ColumnVector> &vector, SizeT index) {
     column_vectors.insert(column_vectors.begin() + index, vector);
     column_count_++;
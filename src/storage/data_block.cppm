@@ -86,6 +86,22 @@ public:
 
     void InsertVector(const SharedPtr<ColumnVector> &vector, SizeT index);
 
+    // Late materialization: keep the column vectors as they are and only mark the rows in `selection` as valid.
+    // row_count() becomes the selection size. Operators that read column_vectors directly must Materialize() first,
+    // AppendWith() handles the selection itself.
+    void SetSelection(SharedPtr<Selection> selection);
+
+    [[nodiscard]] inline bool HasSelection() const { return selection_.get() != nullptr; }
+
+    [[nodiscard]] inline const SharedPtr<Selection> &selection() const { return selection_; }
+
+    // copy the selected rows of all columns
+    void Materialize();
+
+    // copy the selected rows of the columns with column_used[idx] == true only,
+    // the other columns are left as they are and must not be read afterwards
+    void Materialize(const Vector<bool> &column_used);
+
 public:
     [[nodiscard]] inline SizeT column_count() const { return column_count_; }
 
@@ -132,5 +148,6 @@ private:
     SizeT capacity_{0};
     bool initialized = false;
     bool finalized = false;
+    SharedPtr<Selection> selection_{};
 };
 } // namespace infinity
@@ -27,6 +27,7 @@ import index_full_text;
 import index_secondary;
 import index_emvb;
 import index_bmp;
+import index_diskann;
 import bmp_util;
 import third_party;
 import status;
@@ -154,6 +155,15 @@ SharedPtr<IndexBase> IndexBase::ReadAdv(char *&ptr, int32_t maxbytes) {
             res = MakeShared<IndexBMP>(index_name, file_name, std::move(column_names), block_size, compress_type);
             break;
         }
+        case IndexType::kDiskAnn: {
+            MetricType metric_type = ReadBufAdv<MetricType>(ptr);
+            SizeT max_degree = ReadBufAdv<SizeT>(ptr);
+            SizeT build_list_size = ReadBufAdv<SizeT>(ptr);
+            f32 alpha = ReadBufAdv<f32>(ptr);
+            SizeT pq_subspace_num = ReadBufAdv<SizeT>(ptr);
+            res = MakeShared<IndexDiskAnn>(index_name, file_name, std::move(column_names), metric_type, max_degree, build_list_size, alpha, pq_subspace_num);
+            break;
+        }
         case IndexType::kInvalid: {
             String error_message = "Error index method while reading";
             LOG_CRITICAL(error_message);
@@ -243,6 +253,15 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
             res = MakeShared<IndexBMP>(index_name, file_name, std::move(column_names), block_size, compress_type);
             break;
         }
+        case IndexType::kDiskAnn: {
+            MetricType metric_type = StringToMetricType(index_def_json["metric_type"]);
+            SizeT max_degree = index_def_json["max_degree"];
+            SizeT build_list_size = index_def_json["build_list_size"];
+            f32 alpha = index_def_json["alpha"];
+            SizeT pq_subspace_num = index_def_json["pq_subspace_num"];
+            res = MakeShared<IndexDiskAnn>(index_name, file_name, std::move(column_names), metric_type, max_degree, build_list_size, alpha, pq_subspace_num);
+            break;
+        }
         case IndexType::kInvalid: {
             String error_message = "Error index method while deserializing";
             LOG_CRITICAL(error_message);
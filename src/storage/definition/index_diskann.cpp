@@ -0,0 +1,154 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+module index_diskann;
+
+import stl;
+import status;
+import logger;
+import infinity_exception;
+import default_values;
+import logical_type;
+import serialize;
+import embedding_info;
+import internal_types;
+
+namespace infinity {
+
+SharedPtr<IndexBase>
+IndexDiskAnn::Make(SharedPtr<String> index_name, const String &file_name, Vector<String> column_names, const Vector<InitParameter *> &index_param_list) {
+    MetricType metric_type = MetricType::kInvalid;
+    SizeT max_degree = DISKANN_MAX_DEGREE;
+    SizeT build_list_size = DISKANN_BUILD_LIST_SIZE;
+    f32 alpha = DISKANN_ALPHA;
+    SizeT pq_subspace_num = 0;
+    for (const auto *para : index_param_list) {
+        if (para->param_name_ == "metric") {
+            metric_type = StringToMetricType(para->param_value_);
+        } else if (para->param_name_ == "max_degree") {
+            max_degree = std::stoi(para->param_value_);
+            if (max_degree <= 0) {
+                Status status = Status::InvalidIndexParam("max_degree");
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+        } else if (para->param_name_ == "build_list_size") {
+            build_list_size = std::stoi(para->param_value_);
+            if (build_list_size <= 0) {
+                Status status = Status::InvalidIndexParam("build_list_size");
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+        } else if (para->param_name_ == "alpha") {
+            alpha = std::stof(para->param_value_);
+            if (alpha < 1.0f) {
+                Status status = Status::InvalidIndexParam("alpha");
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+        } else if (para->param_name_ == "pq_subspace_num") {
+            pq_subspace_num = std::stoi(para->param_value_);
+            if (pq_subspace_num <= 0) {
+                Status status = Status::InvalidIndexParam("pq_subspace_num");
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+        } else {
+            Status status = Status::InvalidIndexParam(para->param_name_);
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+    }
+    if (metric_type != MetricType::kMetricL2 && metric_type != MetricType::kMetricInnerProduct) {
+        Status status = Status::InvalidIndexParam("Metric type");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    return MakeShared<IndexDiskAnn>(index_name, file_name, std::move(column_names), metric_type, max_degree, build_list_size, alpha, pq_subspace_num);
+}
+
+void IndexDiskAnn::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name) {
+    auto &column_names_vector = *(base_table_ref->column_names_);
+    auto &column_types_vector = *(base_table_ref->column_types_);
+    SizeT column_id = std::find(column_names_vector.begin(), column_names_vector.end(), column_name) - column_names_vector.begin();
+    if (column_id == column_names_vector.size()) {
+        Status status = Status::ColumnNotExist(column_name);
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    } else if (auto &data_type = column_types_vector[column_id]; data_type->type() != LogicalType::kEmbedding) {
+        Status status = Status::InvalidIndexDefinition(
+            fmt::format("Attempt to create DISKANN index on column: {}, data type: {}.", column_name, data_type->ToString()));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    } else if (const auto *embedding_info = static_cast<EmbeddingInfo *>(data_type->type_info().get());
+               embedding_info->Type() != EmbeddingDataType::kElemFloat) {
+        Status status = Status::InvalidIndexDefinition(fmt::format("Attempt to create DISKANN index on column: {}, data type: {}, embedding info: {}.",
+                                                                   column_name,
+                                                                   data_type->ToString(),
+                                                                   embedding_info->ToString()));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+}
+
+i32 IndexDiskAnn::GetSizeInBytes() const {
+    i32 size = IndexBase::GetSizeInBytes();
+    size += sizeof(metric_type_);
+    size += sizeof(max_degree_);
+    size += sizeof(build_list_size_);
+    size += sizeof(alpha_);
+    size += sizeof(pq_subspace_num_);
+    return size;
+}
+
+void IndexDiskAnn::WriteAdv(char *&ptr) const {
+    IndexBase::WriteAdv(ptr);
+    WriteBufAdv(ptr, metric_type_);
+    WriteBufAdv(ptr, max_degree_);
+    WriteBufAdv(ptr, build_list_size_);
+    WriteBufAdv(ptr, alpha_);
+    WriteBufAdv(ptr, pq_subspace_num_);
+}
+
+String IndexDiskAnn::ToString() const {
+    std::stringstream ss;
+    ss << IndexBase::ToString() << ", " << MetricTypeToString(metric_type_) << ", " << max_degree_ << ", " << build_list_size_ << ", " << alpha_
+       << ", " << pq_subspace_num_;
+    return ss.str();
+}
+
+String IndexDiskAnn::BuildOtherParamsString() const {
+    std::stringstream ss;
+    ss << "metric = " << MetricTypeToString(metric_type_) << ", max_degree = " << max_degree_ << ", build_list_size = " << build_list_size_
+       << ", alpha = " << alpha_ << ", pq_subspace_num = " << pq_subspace_num_;
+    return ss.str();
+}
+
+nlohmann::json IndexDiskAnn::Serialize() const {
+    nlohmann::json res = IndexBase::Serialize();
+    res["metric_type"] = MetricTypeToString(metric_type_);
+    res["max_degree"] = max_degree_;
+    res["build_list_size"] = build_list_size_;
+    res["alpha"] = alpha_;
+    res["pq_subspace_num"] = pq_subspace_num_;
+    return res;
+}
+
+} // namespace infinity
@@ -0,0 +1,68 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module index_diskann;
+
+import stl;
+import index_base;
+import statement_common;
+import third_party;
+import base_table_ref;
+import create_index_info;
+
+namespace infinity {
+
+export class IndexDiskAnn final : public IndexBase {
+public:
+    static SharedPtr<IndexBase>
+    Make(SharedPtr<String> index_name, const String &file_name, Vector<String> column_names, const Vector<InitParameter *> &index_param_list);
+
+    static void ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name);
+
+    IndexDiskAnn(SharedPtr<String> index_name,
+                 const String &file_name,
+                 Vector<String> column_names,
+                 MetricType metric_type,
+                 SizeT max_degree,
+                 SizeT build_list_size,
+                 f32 alpha,
+                 SizeT pq_subspace_num)
+        : IndexBase(IndexType::kDiskAnn, std::move(index_name), file_name, std::move(column_names)), metric_type_(metric_type),
+          max_degree_(max_degree), build_list_size_(build_list_size), alpha_(alpha), pq_subspace_num_(pq_subspace_num) {}
+
+    ~IndexDiskAnn() final = default;
+
+public:
+    virtual i32 GetSizeInBytes() const override;
+
+    virtual void WriteAdv(char *&ptr) const override;
+
+    virtual String ToString() const override;
+
+    virtual String BuildOtherParamsString() const override;
+
+    virtual nlohmann::json Serialize() const override;
+
+public:
+    const MetricType metric_type_{MetricType::kInvalid};
+    const SizeT max_degree_{};
+    const SizeT build_list_size_{};
+    const f32 alpha_{};
+    // 0 means the default subspace number of the column dimension
+    const SizeT pq_subspace_num_{};
+};
+
+} // namespace infinity
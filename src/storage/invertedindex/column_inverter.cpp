@@ -51,13 +51,14 @@ ColumnInverter::ColumnInverter(PostingWriterProvider posting_writer_provider, Ve
     : posting_writer_provider_(posting_writer_provider), column_lengths_(column_lengths) {}
 
 void ColumnInverter::InitAnalyzer(const String &analyzer_name) {
-    auto [analyzer, status] = AnalyzerPool::instance().GetAnalyzer(analyzer_name);
+    // the analyzer is taken from the pool of the thread running InvertColumn, here only check the name
+    auto [analyzer, status] = AnalyzerPool::instance().GetPooledAnalyzer(analyzer_name);
     if(!status.ok()) {
         Status status = Status::UnexpectedError(fmt::format("Invalid analyzer: {}", analyzer_name));
         LOG_ERROR(status.message());
         RecoverableError(status);
     }
-    analyzer_ = std::move(analyzer);
+    analyzer_name_ = analyzer_name;
 }
 
 ColumnInverter::~ColumnInverter() = default;
@@ -65,16 +66,21 @@ ColumnInverter::~ColumnInverter() = default;
 bool ColumnInverter::CompareTermRef::operator()(const u32 lhs, const u32 rhs) const { return std::strcmp(GetTerm(lhs), GetTerm(rhs)) < 0; }
 
 SizeT ColumnInverter::InvertColumn(SharedPtr<ColumnVector> column_vector, u32 row_offset, u32 row_count, u32 begin_doc_id) {
+    analyzer_ = std::get<0>(AnalyzerPool::instance().GetPooledAnalyzer(analyzer_name_));
     begin_doc_id_ = begin_doc_id;
     doc_count_ = row_count;
     Vector<u32> column_lengths(row_count);
     SizeT term_count_sum = 0;
     for (SizeT i = 0; i < row_count; ++i) {
-        String data = column_vector->ToString(row_offset + i);
+        // a text on the heap is read into the term directly, an inlined one is copied
+        std::string_view data = column_vector->GetVarcharView(row_offset + i, input_term_.text_);
         if (data.empty()) {
             continue;
         }
-        SizeT term_count = InvertColumn(begin_doc_id + i, data);
+        if (data.data() != input_term_.text_.data()) {
+            input_term_.text_.assign(data);
+        }
+        SizeT term_count = InvertColumn(begin_doc_id + i, input_term_);
         column_lengths[i] = term_count;
         term_count_sum += term_count;
     }
@@ -82,11 +88,15 @@ SizeT ColumnInverter::InvertColumn(SharedPtr<ColumnVector> column_vector, u32 ro
     return term_count_sum;
 }
 
-SizeT ColumnInverter::InvertColumn(u32 doc_id, const String &val) {
-    auto terms_once_ = MakeUnique<TermList>();
-    analyzer_->Analyze(val, *terms_once_);
-    SizeT term_count = terms_once_->size();
-    terms_per_doc_.push_back(Pair<u32, UniquePtr<TermList>>(doc_id, std::move(terms_once_)));
+SizeT ColumnInverter::InvertColumn(u32 doc_id, const Term &val) {
+    // the terms go to the buffer of this inverter directly, nothing is kept per document
+    SizeT term_count = 0;
+    auto on_term = [&](const char *text, u32 len, u32 offset) {
+        u32 term_ref = AddTerm(StringRef(text, len));
+        positions_.emplace_back(term_ref, doc_id, offset);
+        ++term_count;
+    };
+    analyzer_->AnalyzeTerms(val, on_term);
     return term_count;
 }
 
@@ -106,41 +116,30 @@ u32 ColumnInverter::AddTerm(StringRef term) {
     return term_ref;
 }
 
-void ColumnInverter::MergePrepare() {
-    for (auto &doc_terms : terms_per_doc_) {
-        u32 doc_id = doc_terms.first;
-        auto &terms_once = doc_terms.second;
-        for (auto it = terms_once->begin(); it != terms_once->end(); ++it) {
-            StringRef term(it->text_);
-            u32 term_ref = AddTerm(term);
-            positions_.emplace_back(term_ref, doc_id, it->word_offset_);
-        }
-    }
-    terms_per_doc_.clear();
-}
-
 void ColumnInverter::Merge(ColumnInverter &rhs) {
     assert(begin_doc_id_ + doc_count_ <= rhs.begin_doc_id_);
-    MergePrepare();
-    for (auto &doc_terms : rhs.terms_per_doc_) {
-        u32 doc_id = doc_terms.first;
-        auto &terms_once = doc_terms.second;
-        for (auto it = terms_once->begin(); it != terms_once->end(); ++it) {
-            StringRef term(it->text_);
-            u32 term_ref = AddTerm(term);
-            positions_.emplace_back(term_ref, doc_id, it->word_offset_);
-        }
+    // the term buffer of rhs is appended as a whole, its refs are shifted by the words before it
+    const u32 term_ref_shift = terms_.size() >> 2;
+    terms_.insert(terms_.end(), rhs.terms_.begin(), rhs.terms_.end());
+    term_refs_.reserve(term_refs_.size() + rhs.term_refs_.size());
+    for (u32 term_ref : rhs.term_refs_) {
+        term_refs_.push_back(term_ref + term_ref_shift);
+    }
+    positions_.reserve(positions_.size() + rhs.positions_.size());
+    for (const PosInfo &pos : rhs.positions_) {
+        positions_.emplace_back(pos.term_num_ + term_ref_shift, pos.doc_id_, pos.term_pos_);
     }
     doc_count_ += rhs.doc_count_;
     merged_++;
-    rhs.terms_per_doc_.clear();
+    rhs.terms_.clear();
+    rhs.term_refs_.clear();
+    rhs.positions_.clear();
     rhs.doc_count_ = 0;
     rhs.merged_ = 0;
 }
 
 void ColumnInverter::Merge(Vector<SharedPtr<ColumnInverter>> &inverters) {
     assert(!inverters.empty());
-    inverters[0]->MergePrepare();
     SizeT end = inverters.size();
     for (SizeT i = 1; i < end; i++) {
         SharedPtr<ColumnInverter> &rhs = inverters[i];
@@ -243,10 +242,7 @@ void ColumnInverter::GeneratePosting() {
     // printf("GeneratePosting() end begin_doc_id_ %u, doc_count_ %u, merged_ %u", begin_doc_id_, doc_count_, merged_);
 }
 
-void ColumnInverter::SortForOfflineDump() {
-    MergePrepare();
-    Sort();
-}
+void ColumnInverter::SortForOfflineDump() { Sort(); }
 
 /// Layout of the input of external sort file
 //    +-----------+  +----------------++--------------------++--------------------------++-------------------------------------------------------+
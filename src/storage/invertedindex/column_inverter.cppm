@@ -91,7 +91,7 @@ private:
         bool operator()(const u32 lhs, const u32 rhs) const;
     };
 
-    SizeT InvertColumn(u32 doc_id, const String &val);
+    SizeT InvertColumn(u32 doc_id, const Term &val);
 
     const char *GetTermFromRef(u32 term_ref) const { return &terms_[term_ref << 2]; }
 
@@ -111,16 +111,17 @@ private:
 
     void SortTerms();
 
-    void MergePrepare();
-
-    UniquePtr<Analyzer> analyzer_{nullptr};
+    String analyzer_name_;
+    // pooled by the thread inverting the column
+    Analyzer *analyzer_{nullptr};
+    // reused by the rows to keep their text
+    Term input_term_;
     u32 begin_doc_id_{0};
     u32 doc_count_{0};
     u32 merged_{1};
     TermBuffer terms_;
     PosInfoVec positions_;
     U32Vec term_refs_;
-    Vector<Pair<u32, UniquePtr<TermList>>> terms_per_doc_;
     PostingWriterProvider posting_writer_provider_{};
     VectorWithLock<u32> &column_lengths_;
 };
@@ -60,6 +60,7 @@ import buf_writer;
 import profiler;
 import third_party;
 import infinity_context;
+import resource_manager;
 
 namespace infinity {
 constexpr int MAX_TUPLE_LENGTH = 1024; // we assume that analyzed term, together with docid/offset info, will never exceed such length
@@ -72,8 +73,7 @@ MemoryIndexer::PostingTable::PostingTable() {}
 
 MemoryIndexer::MemoryIndexer(const String &index_dir, const String &base_name, RowID base_row_id, optionflag_t flag, const String &analyzer)
     : index_dir_(index_dir), base_name_(base_name), base_row_id_(base_row_id), flag_(flag), posting_format_(PostingFormatOption(flag_)),
-      analyzer_(analyzer), inverting_thread_pool_(infinity::InfinityContext::instance().GetFulltextInvertingThreadPool()),
-      commiting_thread_pool_(infinity::InfinityContext::instance().GetFulltextCommitingThreadPool()), ring_inverted_(15UL), ring_sorted_(13UL) {
+      analyzer_(analyzer), thread_pool_(infinity::InfinityContext::instance().GetSharedThreadPool()), ring_inverted_(15UL), ring_sorted_(13UL) {
     posting_table_ = MakeShared<PostingTable>();
     prepared_posting_ = MakeShared<PostingWriter>(posting_format_, column_lengths_);
     Path path = Path(index_dir) / (base_name + ".tmp.merge");
@@ -101,8 +101,8 @@ void MemoryIndexer::Insert(SharedPtr<ColumnVector> column_vector, u32 row_offset
         doc_count_ += row_count;
     }
     // if ((doc_count & 0x0FFF) == 0) {
-    //     SizeT inverting_que_size = inverting_thread_pool_.queue_size();
-    //     SizeT commiting_que_size = commiting_thread_pool_.queue_size();
+    //     SizeT inverting_que_size = thread_pool_.QueueSize(TaskClass::kIngest);
+    //     SizeT commiting_que_size = thread_pool_.QueueSize(TaskClass::kBackground);
     //     SizeT inverted_ring_size = ring_inverted_.Size();
     //     SizeT sorted_ring_size = ring_sorted_.Size();
     //     LOG_INFO(fmt::format("doc_count {}, inverting_que_size {}, commiting_que_size {}, inverted_ring_size {}, sorted_ring_size {}",
@@ -117,7 +117,7 @@ void MemoryIndexer::Insert(SharedPtr<ColumnVector> column_vector, u32 row_offset
     if (offline) {
         auto inverter = MakeShared<ColumnInverter>(nullptr, column_lengths_);
         inverter->InitAnalyzer(this->analyzer_);
-        auto func = [this, task, inverter](int id) {
+        auto func = [this, task, inverter]() {
             SizeT column_length_sum = inverter->InvertColumn(task->column_vector_, task->row_offset_, task->row_count_, task->start_doc_id_);
             column_length_sum_ += column_length_sum;
             if (column_length_sum > 0) {
@@ -125,19 +125,19 @@ void MemoryIndexer::Insert(SharedPtr<ColumnVector> column_vector, u32 row_offset
             }
             this->ring_sorted_.Put(task->task_seq_, inverter);
         };
-        inverting_thread_pool_.push(std::move(func));
+        thread_pool_.Submit(TaskClass::kIngest, std::move(func));
     } else {
         PostingWriterProvider provider = [this](const String &term) -> SharedPtr<PostingWriter> { return GetOrAddPosting(term); };
         auto inverter = MakeShared<ColumnInverter>(provider, column_lengths_);
         inverter->InitAnalyzer(this->analyzer_);
-        auto func = [this, task, inverter](int id) {
+        auto func = [this, task, inverter]() {
             // LOG_INFO(fmt::format("online inverter {} begin", id));
             SizeT column_length_sum = inverter->InvertColumn(task->column_vector_, task->row_offset_, task->row_count_, task->start_doc_id_);
             column_length_sum_ += column_length_sum;
             this->ring_inverted_.Put(task->task_seq_, inverter);
             // LOG_INFO(fmt::format("online inverter {} end", id));
         };
-        inverting_thread_pool_.push(std::move(func));
+        thread_pool_.Submit(TaskClass::kIngest, std::move(func));
     }
     {
         std::unique_lock<std::mutex> lock(mutex_);
@@ -156,9 +156,9 @@ void MemoryIndexer::InsertGap(u32 row_count) {
 
 void MemoryIndexer::Commit(bool offline) {
     if (offline) {
-        commiting_thread_pool_.push([this](int id) { this->CommitOffline(); });
+        thread_pool_.Submit(TaskClass::kBackground, [this]() { this->CommitOffline(); });
     } else {
-        commiting_thread_pool_.push([this](int id) { this->CommitSync(); });
+        thread_pool_.Submit(TaskClass::kBackground, [this]() { this->CommitSync(); });
     }
 }
 
@@ -226,6 +226,9 @@ SizeT MemoryIndexer::CommitSync(SizeT wait_if_empty_ms) {
             cv_.notify_all();
         }
     }
+    if (num_generated > 0 && commit_callback_) {
+        commit_callback_();
+    }
 
     // LOG_INFO(fmt::format("MemoryIndexer::CommitSync sorted {} inverters, generated posting for {} inverters(merged to {}), inflight_tasks_ is {}",
     //                      num_sorted,
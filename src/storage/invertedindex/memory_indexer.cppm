@@ -32,6 +32,7 @@ import map_with_lock;
 import vector_with_lock;
 import buf_writer;
 import posting_list_format;
+import resource_manager;
 
 namespace infinity {
 
@@ -67,6 +68,9 @@ public:
     // Returns the batch size of generated posting.
     SizeT CommitSync(SizeT wait_if_empty_ms = 0);
 
+    // The callback is called after each commit which makes new postings searchable.
+    void SetCommitCallback(std::function<void()> commit_callback) { commit_callback_ = std::move(commit_callback); }
+
     // Dump is blocking and shall be called only once after inserting all documents.
     // WARN: Don't reuse MemoryIndexer after calling Dump!
     void Dump(bool offline = false, bool spill = false);
@@ -121,8 +125,7 @@ private:
     optionflag_t flag_;
     PostingFormat posting_format_;
     String analyzer_;
-    ThreadPool &inverting_thread_pool_;
-    ThreadPool &commiting_thread_pool_;
+    SharedThreadPool &thread_pool_;
     u32 doc_count_{0};
     SharedPtr<PostingTable> posting_table_;
     PostingPtr prepared_posting_{nullptr};
@@ -133,6 +136,7 @@ private:
     std::condition_variable cv_;
     std::mutex mutex_;
     std::mutex mutex_commit_;
+    std::function<void()> commit_callback_{};
 
     u32 num_runs_{0};                  // For offline index building
     FILE *spill_file_handle_{nullptr}; // Temp file for offline external merge sort
@@ -24,8 +24,8 @@ import third_party;
 
 namespace infinity {
 
-constexpr float k1 = 1.2F;
-constexpr float b = 0.75F;
+constexpr float k1 = BM25_K1;
+constexpr float b = BM25_B;
 
 BM25Ranker::BM25Ranker(u64 total_df) : total_df_(std::max(total_df, 1UL)) {}
 
@@ -41,4 +41,19 @@ void BM25Ranker::AddPhraseParam(tf_t tf, u64 df, float avg_column_len, u32 colum
     score_ += smooth_idf * smooth_tf * weight;
 }
 
+void BM25FRanker::AddColumnDF(u64 df) {
+    float smooth_idf = std::log(1.0F + (total_df_ - df + 0.5F) / (df + 0.5F));
+    smooth_idf_ = has_idf_ ? std::min(smooth_idf_, smooth_idf) : smooth_idf;
+    has_idf_ = true;
+}
+
+void BM25FRanker::AddColumnTF(tf_t tf, float avg_column_len, u32 column_len, float weight) {
+    // tf / (1 - b + b * column_len / avg_column_len), in the order BlockMaxTermDocIterator::NormalizedTF computes it
+    float f1 = k1 * (1.0F - b);
+    float f2 = k1 * b / avg_column_len;
+    combined_tf_ += weight * (k1 * tf / (f1 + f2 * column_len));
+}
+
+float BM25FRanker::GetScore() const { return smooth_idf_ * (k1 + 1.0F) * combined_tf_ / (k1 + combined_tf_); }
+
 } // namespace infinity
@@ -20,6 +20,11 @@ import stl;
 import index_defines;
 
 namespace infinity {
+
+// BM25 parameters, shared by every BM25 scorer
+export constexpr float BM25_K1 = 1.2F;
+export constexpr float BM25_B = 0.75F;
+
 export class BM25Ranker {
 public:
     BM25Ranker(u64 total_df);
@@ -35,4 +40,25 @@ private:
     float score_{0};
     u64 total_df_{0};
 };
+
+// BM25F of one term searched in several columns, the same score as BlockMaxMultiFieldTermIterator gives on the early
+// terminate path: the smallest idf of the columns, and the weighted normalized tf of the matched columns summed before
+// the k1 saturation.
+export class BM25FRanker {
+public:
+    explicit BM25FRanker(u64 total_df) : total_df_(total_df) {}
+
+    // called for every column of the term, matched or not
+    void AddColumnDF(u64 df);
+
+    void AddColumnTF(tf_t tf, float avg_column_len, u32 column_len, float weight);
+
+    float GetScore() const;
+
+private:
+    u64 total_df_{0};
+    bool has_idf_{false};
+    float smooth_idf_{0};
+    float combined_tf_{0};
+};
 } // namespace infinity
\ No newline at end of file
@@ -0,0 +1,228 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cassert>
+#include <iostream>
+
+module blockmax_multi_field_term_iterator;
+
+import stl;
+import index_defines;
+import bm25_ranker;
+import internal_types;
+import early_terminate_iterator;
+import blockmax_term_doc_iterator;
+import infinity_exception;
+import logger;
+
+namespace infinity {
+
+constexpr float k1 = BM25_K1;
+
+BlockMaxMultiFieldTermIterator::BlockMaxMultiFieldTermIterator(Vector<UniquePtr<BlockMaxTermDocIterator>> field_iterators)
+    : field_iterators_(std::move(field_iterators)) {
+    if (field_iterators_.empty()) {
+        String error_message = "BlockMaxMultiFieldTermIterator: no field iterator";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    // the union of the posting lists is at least as large as the largest one, use it for idf
+    float smooth_idf = field_iterators_[0]->IDF();
+    float combined_tf_upper_bound = 0.0f;
+    for (const auto &it : field_iterators_) {
+        doc_freq_ += it->DocFreq();
+        smooth_idf = std::min(smooth_idf, it->IDF());
+        combined_tf_upper_bound += it->Weight() * it->NormalizedTFUpperBound();
+    }
+    bm25_common_score_ = smooth_idf * (k1 + 1.0F);
+    bm25_score_upper_bound_ = Saturate(combined_tf_upper_bound);
+}
+
+float BlockMaxMultiFieldTermIterator::Saturate(const float combined_tf) const { return bm25_common_score_ * combined_tf / (k1 + combined_tf); }
+
+bool BlockMaxMultiFieldTermIterator::ShallowAllFields(RowID doc_id) {
+    RowID block_min_possible_doc_id = INVALID_ROWID;
+    RowID block_last_doc_id = INVALID_ROWID;
+    float combined_tf = 0.0f;
+    SizeT alive_num = 0;
+    for (SizeT i = 0; i < field_iterators_.size(); ++i) {
+        auto &it = field_iterators_[i];
+        // zero threshold: a field alone can't tell whether the block is skippable
+        if (!it->BlockSkipTo(doc_id, 0.0f)) {
+            // exhausted
+            continue;
+        }
+        block_min_possible_doc_id = std::min(block_min_possible_doc_id, it->BlockMinPossibleDocID());
+        block_last_doc_id = std::min(block_last_doc_id, it->BlockLastDocID());
+        combined_tf += it->Weight() * it->BlockMaxNormalizedTF();
+        if (alive_num != i) {
+            field_iterators_[alive_num] = std::move(it);
+        }
+        ++alive_num;
+    }
+    field_iterators_.resize(alive_num);
+    if (field_iterators_.empty()) [[unlikely]] {
+        block_min_possible_doc_id_ = INVALID_ROWID;
+        block_last_doc_id_ = INVALID_ROWID;
+        block_max_bm25_score_ = 0.0f;
+        doc_id_ = INVALID_ROWID;
+        return false;
+    }
+    block_min_possible_doc_id_ = std::max(doc_id, block_min_possible_doc_id);
+    block_last_doc_id_ = block_last_doc_id;
+    block_max_bm25_score_ = Saturate(combined_tf);
+    return true;
+}
+
+bool BlockMaxMultiFieldTermIterator::NextShallow(RowID doc_id) {
+    if (threshold_ > BM25ScoreUpperBound()) [[unlikely]] {
+        doc_id_ = INVALID_ROWID;
+        return false;
+    }
+    while (true) {
+        if (!ShallowAllFields(doc_id)) {
+            return false;
+        }
+        if (BlockMaxBM25Score() > threshold_) {
+            return true;
+        }
+        doc_id = BlockLastDocID() + 1;
+    }
+}
+
+bool BlockMaxMultiFieldTermIterator::BlockSkipTo(RowID doc_id, float threshold) {
+    if (threshold > BM25ScoreUpperBound()) [[unlikely]] {
+        return false;
+    }
+    while (true) {
+        if (!ShallowAllFields(doc_id)) {
+            return false;
+        }
+        if (BlockMaxBM25Score() >= threshold) {
+            return true;
+        }
+        doc_id = BlockLastDocID() + 1;
+    }
+}
+
+bool BlockMaxMultiFieldTermIterator::Next(RowID doc_id) {
+    assert(doc_id != INVALID_ROWID);
+    while (true) {
+        if (!NextShallow(doc_id)) {
+            return false;
+        }
+        if (const auto [found, found_doc_id] = SeekInBlockRange(BlockMinPossibleDocID(), BlockLastDocID()); found) {
+            return true;
+        }
+        doc_id = BlockLastDocID() + 1;
+    }
+}
+
+Pair<bool, RowID> BlockMaxMultiFieldTermIterator::SeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond) {
+    const RowID seek_end = std::min(doc_id_no_beyond, BlockLastDocID());
+    if (doc_id > seek_end) {
+        return {false, INVALID_ROWID};
+    }
+    // the common block ends no later than the block of every field
+    RowID min_doc_id = INVALID_ROWID;
+    for (auto &it : field_iterators_) {
+        if (const auto [found, found_doc_id] = it->SeekInBlockRange(doc_id, seek_end); found) {
+            min_doc_id = std::min(min_doc_id, found_doc_id);
+        }
+    }
+    if (min_doc_id == INVALID_ROWID) {
+        return {false, INVALID_ROWID};
+    }
+    doc_id_ = min_doc_id;
+    return {true, min_doc_id};
+}
+
+Tuple<bool, float, RowID> BlockMaxMultiFieldTermIterator::SeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond, float threshold) {
+    if (threshold > BlockMaxBM25Score()) [[unlikely]] {
+        return {false, 0.0F, INVALID_ROWID};
+    }
+    while (true) {
+        const auto [found, found_doc_id] = SeekInBlockRange(doc_id, doc_id_no_beyond);
+        if (!found) {
+            return {false, 0.0F, INVALID_ROWID};
+        }
+        if (const float score = BM25Score(); score >= threshold) {
+            return {true, score, found_doc_id};
+        }
+        doc_id = found_doc_id + 1;
+    }
+}
+
+Pair<bool, RowID> BlockMaxMultiFieldTermIterator::PeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond) {
+    const RowID seek_end = std::min(doc_id_no_beyond, BlockLastDocID());
+    if (doc_id > seek_end) {
+        return {false, INVALID_ROWID};
+    }
+    RowID min_doc_id = INVALID_ROWID;
+    for (auto &it : field_iterators_) {
+        if (const auto [found, found_doc_id] = it->PeekInBlockRange(doc_id, seek_end); found) {
+            min_doc_id = std::min(min_doc_id, found_doc_id);
+        }
+    }
+    if (min_doc_id == INVALID_ROWID) {
+        return {false, INVALID_ROWID};
+    }
+    return {true, min_doc_id};
+}
+
+bool BlockMaxMultiFieldTermIterator::NotPartCheckExist(RowID doc_id) {
+    bool exist = false;
+    for (auto &it : field_iterators_) {
+        if (it->NotPartCheckExist(doc_id)) {
+            exist = true;
+        }
+    }
+    if (exist) {
+        doc_id_ = doc_id;
+    }
+    return exist;
+}
+
+float BlockMaxMultiFieldTermIterator::BM25Score() {
+    if (doc_id_ == bm25_score_cache_doc_id_) [[unlikely]] {
+        return bm25_score_cache_;
+    }
+    float combined_tf = 0.0f;
+    for (auto &it : field_iterators_) {
+        if (it->DocID() == doc_id_) {
+            combined_tf += it->Weight() * it->NormalizedTF();
+        }
+    }
+    bm25_score_cache_doc_id_ = doc_id_;
+    bm25_score_cache_ = Saturate(combined_tf);
+    return bm25_score_cache_;
+}
+
+void BlockMaxMultiFieldTermIterator::PrintTree(std::ostream &os, const String &prefix, bool is_final) const {
+    os << prefix;
+    os << (is_final ? "└──" : "├──");
+    os << "BlockMaxMultiFieldTermIterator";
+    os << " (doc_freq: " << DocFreq() << ")";
+    os << " (bm25_score_upper_bound: " << BM25ScoreUpperBound() << ")";
+    os << " (threshold: " << threshold_ << ")";
+    os << '\n';
+    const String next_prefix = prefix + (is_final ? "    " : "│   ");
+    for (SizeT i = 0; i < field_iterators_.size(); ++i) {
+        field_iterators_[i]->PrintTree(os, next_prefix, i + 1 == field_iterators_.size());
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,81 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module blockmax_multi_field_term_iterator;
+
+import stl;
+import index_defines;
+import internal_types;
+import early_terminate_iterator;
+import blockmax_term_doc_iterator;
+
+namespace infinity {
+
+// One term searched in several columns ("title^2,body"), scored with BM25F:
+// the weighted normalized tf of all fields is summed before the k1 saturation,
+// score = idf * (k1 + 1) * tf' / (k1 + tf'), tf' = sum(weight_f * tf_f / (1 - b + b * len_f / avg_len_f)).
+// The block-max bound is computed the same way from the block-max tf of every field,
+// so WAND / MaxScore can still skip blocks when the term comes from several fields.
+export class BlockMaxMultiFieldTermIterator final : public EarlyTerminateIterator {
+public:
+    // field_iterators should have been added to the Scorer
+    explicit BlockMaxMultiFieldTermIterator(Vector<UniquePtr<BlockMaxTermDocIterator>> field_iterators);
+
+    ~BlockMaxMultiFieldTermIterator() override = default;
+
+    bool NextShallow(RowID doc_id) override;
+
+    bool Next(RowID doc_id) override;
+
+    bool BlockSkipTo(RowID doc_id, float threshold) override;
+
+    RowID BlockMinPossibleDocID() const override { return block_min_possible_doc_id_; }
+
+    RowID BlockLastDocID() const override { return block_last_doc_id_; }
+
+    float BlockMaxBM25Score() override { return block_max_bm25_score_; }
+
+    Pair<bool, RowID> SeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond) override;
+
+    Tuple<bool, float, RowID> SeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond, float threshold) override;
+
+    Pair<bool, RowID> PeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond) override;
+
+    bool NotPartCheckExist(RowID doc_id) override;
+
+    float BM25Score() override;
+
+    void PrintTree(std::ostream &os, const String &prefix, bool is_final) const override;
+
+private:
+    float Saturate(float combined_tf) const;
+
+    // move the block cursor of every field to doc_id, and drop exhausted fields
+    // the common block ends at the smallest block end of all fields
+    bool ShallowAllFields(RowID doc_id);
+
+    Vector<UniquePtr<BlockMaxTermDocIterator>> field_iterators_;
+    float bm25_common_score_ = 0.0f; // smooth_idf * (k1 + 1.0F)
+    // common block info
+    RowID block_min_possible_doc_id_ = INVALID_ROWID;
+    RowID block_last_doc_id_ = INVALID_ROWID;
+    float block_max_bm25_score_ = 0.0f;
+    // bm25 score cache
+    RowID bm25_score_cache_doc_id_ = INVALID_ROWID;
+    float bm25_score_cache_ = 0.0f;
+};
+
+} // namespace infinity
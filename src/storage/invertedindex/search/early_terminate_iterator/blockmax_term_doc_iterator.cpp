@@ -23,6 +23,7 @@ module blockmax_term_doc_iterator;
 
 import stl;
 import index_defines;
+import bm25_ranker;
 import internal_types;
 
 import segment_posting;
@@ -114,15 +115,14 @@ bool BlockMaxTermDocIterator::BlockSkipTo(RowID doc_id, float threshold) {
     }
 }
 
-// BM25 parameters
-constexpr float k1 = 1.2F;
-constexpr float b = 0.75F;
+constexpr float k1 = BM25_K1;
+constexpr float b = BM25_B;
 
 void BlockMaxTermDocIterator::InitBM25Info(u64 total_df, float avg_column_len, FullTextColumnLengthReader *column_length_reader) {
     avg_column_len_ = avg_column_len;
     column_length_reader_ = column_length_reader;
-    const float smooth_idf = std::log(1.0F + (total_df - doc_freq_ + 0.5F) / (doc_freq_ + 0.5F));
-    bm25_common_score_ = weight_ * smooth_idf * (k1 + 1.0F);
+    smooth_idf_ = std::log(1.0F + (total_df - doc_freq_ + 0.5F) / (doc_freq_ + 0.5F));
+    bm25_common_score_ = weight_ * smooth_idf_ * (k1 + 1.0F);
     bm25_score_upper_bound_ = bm25_common_score_ / (1.0F + k1 * b / avg_column_len_);
     f1 = k1 * (1.0F - b);
     f2 = k1 * b / avg_column_len_;
@@ -164,6 +164,21 @@ float BlockMaxTermDocIterator::BM25Score() {
     return bm25_score_cache_;
 }
 
+// k1 * tf / (f1 + f2 * doc_len) == tf / (1.0F - b + b * doc_len / avg_column_len)
+float BlockMaxTermDocIterator::NormalizedTF() {
+    const auto [tf, doc_len] = GetScoreData();
+    return k1 * tf / (f1 + f2 * doc_len);
+}
+
+// same bound as BlockMaxBM25Score(), before saturation
+float BlockMaxTermDocIterator::BlockMaxNormalizedTF() const {
+    const auto [block_max_tf, block_max_percentage_u16] = GetBlockMaxInfo();
+    return k1 / (f1 / block_max_tf + f3 / block_max_percentage_u16);
+}
+
+// tf <= doc_len, so tf / (1.0F - b + b * doc_len / avg_column_len) < avg_column_len / b
+float BlockMaxTermDocIterator::NormalizedTFUpperBound() const { return avg_column_len_ / b; }
+
 Pair<bool, RowID> BlockMaxTermDocIterator::SeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond) {
     const RowID block_last = BlockLastDocID();
     const RowID seek_end = std::min(doc_id_no_beyond, block_last);
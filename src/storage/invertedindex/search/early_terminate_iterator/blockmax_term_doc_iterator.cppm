@@ -67,6 +67,20 @@ public:
     // weight included
     float BM25Score() override;
 
+    // for BM25F scoring across fields, see BlockMaxMultiFieldTermIterator
+    float Weight() const { return weight_; }
+
+    float IDF() const { return smooth_idf_; }
+
+    // tf / (1 - b + b * column_len / avg_column_len) of the current doc
+    float NormalizedTF();
+
+    // upper bound of NormalizedTF() in the current block
+    float BlockMaxNormalizedTF() const;
+
+    // upper bound of NormalizedTF() in the whole posting list
+    float NormalizedTFUpperBound() const;
+
     void PrintTree(std::ostream &os, const String &prefix, bool is_final) const override;
 
     // debug info
@@ -85,6 +99,7 @@ private:
     float f2 = 0.0f;
     float f3 = 0.0f;
     float avg_column_len_ = 0;
+    float smooth_idf_ = 0;
     FullTextColumnLengthReader *column_length_reader_ = nullptr;
     float bm25_common_score_ = 0; // include: weight * smooth_idf * (k1 + 1.0F)
     float block_max_bm25_score_cache_ = 0;
@@ -65,6 +65,15 @@ void Scorer::AddBlockMaxPhraseDocIterator(BlockMaxPhraseDocIterator *iter, u64 c
     iter->InitBM25Info(total_df_, avg_column_length_[column_index], column_length_reader_.GetColumnLengthReader(column_index));
 }
 
+void Scorer::AddMultiFieldTermIterators(const Vector<TermDocIterator *> &iters) {
+    auto &multi_field_term = multi_field_terms_.emplace_back();
+    for (auto *iter : iters) {
+        multi_field_term.emplace_back(iter, GetOrSetColumnIndex(iter->column_id()));
+    }
+    // a column may have only multi-field terms
+    iterators_.resize(std::max<u32>(column_counter_, iterators_.size()));
+}
+
 float Scorer::Score(RowID doc_id) {
     float score = 0.0F;
     for (u32 i = 0; i < column_counter_; i++) {
@@ -98,6 +107,22 @@ float Scorer::Score(RowID doc_id) {
         }
         score += ranker.GetScore();
     }
+    for (const auto &multi_field_term : multi_field_terms_) {
+        BM25FRanker ranker(total_df_);
+        bool matched = false;
+        for (const auto &[term_iter, column_index] : multi_field_term) {
+            ranker.AddColumnDF(term_iter->GetDF());
+            TermColumnMatchData column_match_data;
+            if (term_iter->GetTermMatchData(column_match_data, doc_id)) {
+                u32 column_len = column_length_reader_.GetColumnLength(column_index, doc_id);
+                ranker.AddColumnTF(column_match_data.tf_, avg_column_length_[column_index], column_len, term_iter->GetWeight());
+                matched = true;
+            }
+        }
+        if (matched) {
+            score += ranker.GetScore();
+        }
+    }
     return score;
 }
 
@@ -54,6 +54,9 @@ public:
 
     void AddBlockMaxPhraseDocIterator(BlockMaxPhraseDocIterator *iter, u64 column_id);
 
+    // The iterators of one term in different columns, scored together with BM25F instead of one BM25 per column.
+    void AddMultiFieldTermIterators(const Vector<TermDocIterator *> &iters);
+
     float Score(RowID doc_id);
 
 private:
@@ -70,6 +73,8 @@ private:
     Vector<Vector<DocIterator *>> iterators_;
     Vector<Vector<BlockMaxTermDocIterator *>> block_max_term_iterators_;
     Vector<Vector<BlockMaxPhraseDocIterator *>> block_max_phrase_iterators_;
+    // (iterator, column index) of every column of a multi-field term
+    Vector<Vector<Pair<TermDocIterator *, u32>>> multi_field_terms_;
     Vector<float> avg_column_length_;
     ColumnLengthReader column_length_reader_;
     IndexReader *index_reader_ = nullptr;
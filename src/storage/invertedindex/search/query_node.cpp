@@ -1,4 +1,5 @@
 #include "query_node.h"
+#include <algorithm>
 #include <chrono>
 
 import stl;
@@ -20,6 +21,7 @@ import blockmax_and_iterator;
 import blockmax_and_not_iterator;
 import blockmax_wand_iterator;
 import blockmax_maxscore_iterator;
+import blockmax_multi_field_term_iterator;
 import index_defines;
 import third_party;
 import phrase_doc_iterator;
@@ -427,6 +429,15 @@ std::unique_ptr<QueryNode> AndNotQueryNode::InnerGetNewOptimizedQueryTree() {
 
 // create search iterator
 std::unique_ptr<DocIterator> TermQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
+    auto search = CreateTermSearch(table_entry, index_reader);
+    if (search && scorer) {
+        // nodes under "not" will not be added to scorer
+        scorer->AddDocIterator(search.get(), search->column_id());
+    }
+    return search;
+}
+
+std::unique_ptr<TermDocIterator> TermQueryNode::CreateTermSearch(const TableEntry *table_entry, IndexReader &index_reader) const {
     ColumnID column_id = table_entry->GetColumnIdByName(column_);
     ColumnIndexReader *column_index_reader = index_reader.GetColumnIndexReader(column_id);
     if (!column_index_reader) {
@@ -445,10 +456,6 @@ std::unique_ptr<DocIterator> TermQueryNode::CreateSearch(const TableEntry *table
     auto search = MakeUnique<TermDocIterator>(std::move(posting_iterator), column_id, GetWeight());
     search->term_ptr_ = &term_;
     search->column_name_ptr_ = &column_;
-    if (scorer) {
-        // nodes under "not" will not be added to scorer
-        scorer->AddDocIterator(search.get(), column_id);
-    }
     return search;
 }
 
@@ -456,6 +463,11 @@ std::unique_ptr<EarlyTerminateIterator> TermQueryNode::CreateEarlyTerminateSearc
                                                                                   IndexReader &index_reader,
                                                                                   Scorer *scorer,
                                                                                   EarlyTermAlgo /*early_term_algo*/) const {
+    return CreateBlockMaxTermSearch(table_entry, index_reader, scorer);
+}
+
+std::unique_ptr<BlockMaxTermDocIterator>
+TermQueryNode::CreateBlockMaxTermSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
     ColumnID column_id = table_entry->GetColumnIdByName(column_);
     ColumnIndexReader *column_index_reader = index_reader.GetColumnIndexReader(column_id);
     if (!column_index_reader) {
@@ -639,12 +651,44 @@ std::unique_ptr<EarlyTerminateIterator> AndNotQueryNode::CreateEarlyTerminateSea
 std::unique_ptr<DocIterator> OrQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
     Vector<std::unique_ptr<DocIterator>> sub_doc_iters;
     sub_doc_iters.reserve(children_.size());
+    // group the same term of different columns as CreateEarlyTerminateSearch does, so that both score it with BM25F
+    Vector<Vector<TermDocIterator *>> term_groups;
+    HashMap<std::string_view, SizeT> term_group_index;
     for (auto &child : children_) {
+        if (scorer and child->GetType() == QueryNodeType::TERM) {
+            const auto &term_node = static_cast<const TermQueryNode &>(*child);
+            auto iter = term_node.CreateTermSearch(table_entry, index_reader);
+            if (!iter) {
+                continue;
+            }
+            auto [map_iter, inserted] = term_group_index.emplace(term_node.term_, term_groups.size());
+            if (inserted) {
+                term_groups.emplace_back();
+            }
+            auto &term_group = term_groups[map_iter->second];
+            const bool same_column = std::any_of(term_group.begin(), term_group.end(), [&](const auto *it) {
+                return *(it->column_name_ptr_) == term_node.column_;
+            });
+            if (same_column) {
+                scorer->AddDocIterator(iter.get(), iter->column_id());
+            } else {
+                term_group.emplace_back(iter.get());
+            }
+            sub_doc_iters.emplace_back(std::move(iter));
+            continue;
+        }
         auto iter = child->CreateSearch(table_entry, index_reader, scorer);
         if (iter) {
             sub_doc_iters.emplace_back(std::move(iter));
         }
     }
+    for (auto &term_group : term_groups) {
+        if (term_group.size() == 1) {
+            scorer->AddDocIterator(term_group[0], term_group[0]->column_id());
+        } else {
+            scorer->AddMultiFieldTermIterators(term_group);
+        }
+    }
     if (sub_doc_iters.empty()) {
         return nullptr;
     } else if (sub_doc_iters.size() == 1) {
@@ -658,12 +702,44 @@ std::unique_ptr<EarlyTerminateIterator>
 OrQueryNode::CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer, EarlyTermAlgo early_term_algo) const {
     Vector<std::unique_ptr<EarlyTerminateIterator>> sub_doc_iters;
     sub_doc_iters.reserve(children_.size());
+    // a multi-field query puts the same term of different columns under one "or"
+    // group them into one BM25F term, so that its block-max bound covers all the columns
+    Vector<Vector<std::unique_ptr<BlockMaxTermDocIterator>>> term_groups;
+    HashMap<std::string_view, SizeT> term_group_index;
     for (auto &child : children_) {
+        if (scorer and child->GetType() == QueryNodeType::TERM) {
+            const auto &term_node = static_cast<const TermQueryNode &>(*child);
+            auto iter = term_node.CreateBlockMaxTermSearch(table_entry, index_reader, scorer);
+            if (!iter) {
+                continue;
+            }
+            auto [map_iter, inserted] = term_group_index.emplace(term_node.term_, term_groups.size());
+            if (inserted) {
+                term_groups.emplace_back();
+            }
+            auto &term_group = term_groups[map_iter->second];
+            const bool same_column = std::any_of(term_group.begin(), term_group.end(), [&](const auto &it) {
+                return *(it->column_name_ptr_) == term_node.column_;
+            });
+            if (same_column) {
+                sub_doc_iters.emplace_back(std::move(iter));
+            } else {
+                term_group.emplace_back(std::move(iter));
+            }
+            continue;
+        }
         auto iter = child->CreateEarlyTerminateSearch(table_entry, index_reader, scorer, early_term_algo);
         if (iter) {
             sub_doc_iters.emplace_back(std::move(iter));
         }
     }
+    for (auto &term_group : term_groups) {
+        if (term_group.size() == 1) {
+            sub_doc_iters.emplace_back(std::move(term_group[0]));
+        } else {
+            sub_doc_iters.emplace_back(MakeUnique<BlockMaxMultiFieldTermIterator>(std::move(term_group)));
+        }
+    }
     if (sub_doc_iters.empty()) {
         return nullptr;
     } else if (sub_doc_iters.size() == 1) {
@@ -51,6 +51,8 @@ struct IndexReader;
 class Scorer;
 class DocIterator;
 class EarlyTerminateIterator;
+class TermDocIterator;
+class BlockMaxTermDocIterator;
 enum class EarlyTermAlgo;
 
 // step 1. get the query tree from parser
@@ -98,8 +100,11 @@ struct TermQueryNode final : public QueryNode {
 
     void PushDownWeight(float factor) override { MultiplyWeight(factor); }
     std::unique_ptr<DocIterator> CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
+    // the term iterator, not added to any scorer
+    std::unique_ptr<TermDocIterator> CreateTermSearch(const TableEntry *table_entry, IndexReader &index_reader) const;
     std::unique_ptr<EarlyTerminateIterator>
     CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer, EarlyTermAlgo early_term_algo) const override;
+    std::unique_ptr<BlockMaxTermDocIterator> CreateBlockMaxTermSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const;
     void PrintTree(std::ostream &os, const std::string &prefix, bool is_final) const override;
 };
 
@@ -52,6 +52,8 @@ public:
 
     float GetWeight() const { return weight_; }
 
+    u64 column_id() const { return column_id_; }
+
     void PrintTree(std::ostream &os, const String &prefix, bool is_final) const override;
 
     DocIteratorType GetType() const override { return DocIteratorType::kTermIterator; }
@@ -26,6 +26,7 @@ import infinity_exception;
 import logger;
 import third_party;
 import status;
+import resource_manager;
 
 namespace infinity {
 
@@ -202,14 +203,19 @@ struct AnnIVFFlatIndexData {
 
     inline void InsertData(u32 vector_count, const VectorDataType *vector_data_ptr, auto &&get_offset) {
         // step 1. Classify vectors
-        // search_top_1
+        // search_top_1, batches of the vectors in parallel
         auto assigned_partition_id = MakeUniqueForOverwrite<u32[]>(vector_count);
-        search_top_1_without_dis<CommonType>(dimension_,
-                                             vector_count,
-                                             vector_data_ptr,
-                                             partition_num_,
-                                             centroids_.data(),
-                                             assigned_partition_id.get());
+        constexpr u32 classify_batch = 4096;
+        SharedParallelFor(TaskClass::kIngest, (vector_count + classify_batch - 1) / classify_batch, [&](SizeT batch_idx) {
+            u32 begin = batch_idx * classify_batch;
+            u32 end = std::min(begin + classify_batch, vector_count);
+            search_top_1_without_dis<CommonType>(dimension_,
+                                                 end - begin,
+                                                 vector_data_ptr + SizeT(begin) * dimension_,
+                                                 partition_num_,
+                                                 centroids_.data(),
+                                                 assigned_partition_id.get() + begin);
+        });
 
         // step 2. Reserve space
         Vector<u32> partition_element_count(partition_num_);
@@ -24,6 +24,7 @@ import search_top_k;
 import index_base;
 import vector_distance;
 import logger;
+import resource_manager;
 
 namespace infinity {
 
@@ -62,6 +63,10 @@ inline void NormalizeCentroids(u32 dimension, u32 partition_num, CentroidType *c
     }
 }
 
+// the vectors assigned by one task of the parallel assignment, and the partitions updated by one task of the update
+constexpr u32 kmeans_assign_batch = 4096;
+constexpr u32 kmeans_update_batch = 16;
+
 // CentroidsType: the type to calculate centroids
 // partition_num: the number of partitions, default to sqrt(vector_count)
 // iteration_max: the max iteration count, default to 10
@@ -182,6 +187,9 @@ export template <typename CentroidsType, typename ElemType, typename CentroidsOu
     Vector<f32> partition_element_distance(training_data_num);
     // Record the number of vectors in each partition
     Vector<u32> partition_element_count(partition_num);
+    // The vectors of partition i are partition_element_ids[partition_element_begin[i], partition_element_begin[i + 1])
+    Vector<u32> partition_element_begin(partition_num + 1);
+    Vector<u32> partition_element_ids(training_data_num);
 
     // Iteration
     for (u32 iter = 1; iter <= iteration_max; ++iter) {
@@ -189,14 +197,18 @@ export template <typename CentroidsType, typename ElemType, typename CentroidsOu
         f32 this_iter_distance = 0;
         // First : assign each training vector to a partition
         {
-            // search top 1
-            search_top_1_with_dis(dimension,
-                                  training_data_num,
-                                  training_data,
-                                  partition_num,
-                                  centroids,
-                                  training_data_partition_id.data(),
-                                  partition_element_distance.data());
+            // search top 1, batches of the vectors in parallel
+            SharedParallelFor(TaskClass::kIngest, (training_data_num + kmeans_assign_batch - 1) / kmeans_assign_batch, [&](SizeT batch_idx) {
+                u32 begin = batch_idx * kmeans_assign_batch;
+                u32 end = std::min(begin + kmeans_assign_batch, training_data_num);
+                search_top_1_with_dis(dimension,
+                                      end - begin,
+                                      training_data + SizeT(begin) * dimension,
+                                      partition_num,
+                                      centroids,
+                                      training_data_partition_id.data() + begin,
+                                      partition_element_distance.data() + begin);
+            });
             // Clear partition_element_count
             memset(partition_element_count.data(), 0, sizeof(u32) * partition_num);
             // calculate partition_element_count
@@ -208,30 +220,45 @@ export template <typename CentroidsType, typename ElemType, typename CentroidsOu
         }
         // Second : update centroids
         {
-            // Clear old centroids data
-            memset(centroids, 0, sizeof(CentroidsType) * partition_num * dimension);
-            // Sum
-            for (u32 i = 0; i < training_data_num; ++i) {
-                auto vector_pos_i = training_data + i * dimension;
-                auto centroid_pos_i = centroids + training_data_partition_id[i] * dimension;
-                for (u32 j = 0; j < dimension; ++j) {
-                    centroid_pos_i[j] += vector_pos_i[j];
+            // Group the vectors by partition, then sum and divide the partitions in parallel. Each partition adds its vectors in
+            // the order of the vectors, same as summing all vectors one by one.
+            partition_element_begin[0] = 0;
+            for (u32 i = 0; i < partition_num; ++i) {
+                partition_element_begin[i + 1] = partition_element_begin[i] + partition_element_count[i];
+            }
+            {
+                Vector<u32> partition_element_pos(partition_element_begin.begin(), partition_element_begin.end() - 1);
+                for (u32 i = 0; i < training_data_num; ++i) {
+                    partition_element_ids[partition_element_pos[training_data_partition_id[i]]++] = i;
                 }
             }
-            // For L2 metric, divide the count. If there is no vector in a partition, the centroid of this partition will not be updated.
-            // For IP metric, normalize centroids.
-            if (metric == MetricType::kMetricL2) {
-                for (u32 i = 0; i < partition_num; ++i) {
-                    if (auto cnt = partition_element_count[i]; cnt > 0) {
+            SharedParallelFor(TaskClass::kIngest, (partition_num + kmeans_update_batch - 1) / kmeans_update_batch, [&](SizeT batch_idx) {
+                u32 begin = batch_idx * kmeans_update_batch;
+                u32 end = std::min(begin + kmeans_update_batch, partition_num);
+                // Clear old centroids data
+                memset(centroids + begin * dimension, 0, sizeof(CentroidsType) * (end - begin) * dimension);
+                for (u32 partition_id = begin; partition_id < end; ++partition_id) {
+                    auto centroid_pos = centroids + partition_id * dimension;
+                    // Sum
+                    for (u32 k = partition_element_begin[partition_id]; k < partition_element_begin[partition_id + 1]; ++k) {
+                        auto vector_pos_i = training_data + partition_element_ids[k] * dimension;
+                        for (u32 j = 0; j < dimension; ++j) {
+                            centroid_pos[j] += vector_pos_i[j];
+                        }
+                    }
+                    // For L2 metric, divide the count. If there is no vector in a partition, the centroid of this partition will not be updated.
+                    if (auto cnt = partition_element_count[partition_id]; metric == MetricType::kMetricL2 && cnt > 0) {
                         f32 inv = 1.0f / (f32)cnt;
                         for (u32 j = 0; j < dimension; ++j) {
-                            centroids[i * dimension + j] *= inv;
+                            centroid_pos[j] *= inv;
                         }
                     }
                 }
-            } else if (metric == MetricType::kMetricInnerProduct) {
-                NormalizeCentroids(dimension, partition_num, centroids);
-            }
+                // For IP metric, normalize centroids.
+                if (metric == MetricType::kMetricInnerProduct) {
+                    NormalizeCentroids(dimension, end - begin, centroids + begin * dimension);
+                }
+            });
         }
 
         // Third: split partitions when needed
@@ -0,0 +1,604 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include "../header.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/aio_abi.h>
+#include <sys/syscall.h>
+#endif
+
+module diskann_index;
+
+import stl;
+import index_base;
+import hnsw_common;
+import hnsw_simd_func;
+import diskann_pq;
+import file_system;
+import resource_manager;
+import infinity_exception;
+import logger;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+// sector aligned memory for the direct reads
+class AlignedBuffer {
+public:
+    explicit AlignedBuffer(SizeT size) : data_(static_cast<char *>(std::aligned_alloc(DiskAnnIndex::kSectorSize, size))) {
+        if (data_ == nullptr) {
+            String error_message = fmt::format("Failed to allocate {} bytes for diskann nodes", size);
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+    }
+    ~AlignedBuffer() { std::free(data_); }
+
+    char *get() const { return data_; }
+
+private:
+    char *data_;
+};
+
+void PreadFully(i32 fd, char *buffer, SizeT size, i64 offset) {
+    while (size > 0) {
+        ssize_t read_n = pread(fd, buffer, size, offset);
+        if (read_n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (read_n <= 0) {
+            String error_message = fmt::format("Failed to read diskann nodes at {}: {}", offset, strerror(errno));
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+        buffer += read_n;
+        size -= read_n;
+        offset += read_n;
+    }
+}
+
+#if defined(__linux__)
+// A kernel aio context of the thread. The reads of a beam are submitted together and reaped together, so the device
+// serves them in parallel and a beam costs about one read latency.
+class AioContext {
+public:
+    AioContext() {
+        if (syscall(SYS_io_setup, DiskAnnIndex::kMaxBeamWidth, &ctx_) != 0) {
+            ctx_ = 0;
+        }
+    }
+
+    ~AioContext() {
+        if (ctx_ != 0) {
+            syscall(SYS_io_destroy, ctx_);
+        }
+    }
+
+    // Return false if the batch isn't read fully, the caller reads it again synchronously.
+    bool Read(i32 fd, const Vector<i64> &offsets, char *buffer, SizeT read_size) {
+        const SizeT read_n = offsets.size();
+        if (ctx_ == 0 || read_n > DiskAnnIndex::kMaxBeamWidth) {
+            return false;
+        }
+        Array<iocb, DiskAnnIndex::kMaxBeamWidth> cbs;
+        Array<iocb *, DiskAnnIndex::kMaxBeamWidth> cb_ptrs;
+        for (SizeT i = 0; i < read_n; ++i) {
+            std::memset(&cbs[i], 0, sizeof(iocb));
+            cbs[i].aio_fildes = fd;
+            cbs[i].aio_lio_opcode = IOCB_CMD_PREAD;
+            cbs[i].aio_buf = reinterpret_cast<u64>(buffer + i * read_size);
+            cbs[i].aio_nbytes = read_size;
+            cbs[i].aio_offset = offsets[i];
+            cb_ptrs[i] = &cbs[i];
+        }
+        SizeT submitted = 0;
+        while (submitted < read_n) {
+            long ret = syscall(SYS_io_submit, ctx_, read_n - submitted, cb_ptrs.data() + submitted);
+            if (ret < 0 && errno == EINTR) {
+                continue;
+            }
+            if (ret <= 0) {
+                break;
+            }
+            submitted += ret;
+        }
+        bool success = submitted == read_n;
+        Array<io_event, DiskAnnIndex::kMaxBeamWidth> events;
+        SizeT reaped = 0;
+        while (reaped < submitted) {
+            long ret = syscall(SYS_io_getevents, ctx_, 1, submitted - reaped, events.data(), nullptr);
+            if (ret < 0 && errno == EINTR) {
+                continue;
+            }
+            if (ret < 0) {
+                String error_message = fmt::format("Failed to reap diskann node reads: {}", strerror(errno));
+                LOG_CRITICAL(error_message);
+                UnrecoverableError(error_message);
+            }
+            for (long i = 0; i < ret; ++i) {
+                if (events[i].res != static_cast<i64>(read_size)) {
+                    success = false;
+                }
+            }
+            reaped += ret;
+        }
+        return success;
+    }
+
+private:
+    aio_context_t ctx_{0};
+};
+#endif
+
+} // namespace
+
+DiskAnnIndex::DiskAnnIndex(SizeT dimension, MetricType metric, SizeT max_degree, SizeT build_list_size, f32 alpha, SizeT pq_subspace_num)
+    : dimension_(dimension), metric_(metric), max_degree_(max_degree), build_list_size_(std::max(build_list_size, max_degree)), alpha_(alpha),
+      pq_(dimension, pq_subspace_num), node_size_(dimension * sizeof(f32) + sizeof(SegmentOffset) + sizeof(u32) + max_degree * sizeof(u32)) {
+    if (metric_ != MetricType::kMetricL2 && metric_ != MetricType::kMetricInnerProduct) {
+        String error_message = fmt::format("Diskann index doesn't support metric {}", MetricTypeToString(metric_));
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    if (node_size_ <= kSectorSize) {
+        nodes_per_sector_ = kSectorSize / node_size_;
+        sectors_per_node_ = 1;
+    } else {
+        nodes_per_sector_ = 1;
+        sectors_per_node_ = (node_size_ + kSectorSize - 1) / kSectorSize;
+    }
+    node_read_size_ = sectors_per_node_ * kSectorSize;
+#if defined(USE_AVX512)
+    l2_func_ = dimension % 16 == 0 ? F32L2AVX512 : F32L2AVX512Residual;
+    ip_func_ = dimension % 16 == 0 ? F32IPAVX512 : F32IPAVX512Residual;
+#elif defined(USE_AVX)
+    l2_func_ = dimension % 16 == 0 ? F32L2AVX : F32L2AVXResidual;
+    ip_func_ = dimension % 16 == 0 ? F32IPAVX : F32IPAVXResidual;
+#elif defined(USE_SSE)
+    l2_func_ = dimension % 16 == 0 ? F32L2SSE : F32L2SSEResidual;
+    ip_func_ = dimension % 16 == 0 ? F32IPSSE : F32IPSSEResidual;
+#else
+    l2_func_ = F32L2BF;
+    ip_func_ = F32IPBF;
+#endif
+}
+
+DiskAnnIndex::~DiskAnnIndex() {
+    if (fd_ != -1) {
+        close(fd_);
+    }
+}
+
+void DiskAnnIndex::BuildInner(Vector<f32> data, Vector<SegmentOffset> labels, const DiskAnnIndex *base) {
+    row_count_ = labels.size();
+    if (row_count_ == 0) {
+        return;
+    }
+    codes_.resize(row_count_ * pq_.subspace_num());
+    pq_.Train(data.data(), row_count_);
+    pq_.Encode(data.data(), row_count_, codes_.data());
+
+    // start from the vector nearest to the mean
+    Vector<f32> mean(dimension_, 0);
+    for (SizeT i = 0; i < row_count_; ++i) {
+        for (SizeT j = 0; j < dimension_; ++j) {
+            mean[j] += data[i * dimension_ + j];
+        }
+    }
+    for (SizeT j = 0; j < dimension_; ++j) {
+        mean[j] /= row_count_;
+    }
+    f32 medoid_dist = std::numeric_limits<f32>::max();
+    for (SizeT i = 0; i < row_count_; ++i) {
+        f32 dist = l2_func_(mean.data(), data.data() + i * dimension_, dimension_);
+        if (dist < medoid_dist) {
+            medoid_dist = dist;
+            medoid_ = i;
+        }
+    }
+
+    Vector<Vector<u32>> graph;
+    u32 first_vertex = 0;
+    if (base != nullptr) {
+        Vector<SegmentOffset> base_labels;
+        base->ReadGraph(base_labels, graph);
+        if (base_labels.size() <= row_count_ && std::equal(base_labels.begin(), base_labels.end(), labels.begin())) {
+            first_vertex = base_labels.size();
+        } else {
+            graph.clear();
+        }
+    }
+    graph.resize(row_count_);
+    // the first pass links the graph, the second one adds the long edges kept by alpha
+    for (f32 alpha : {1.0f, alpha_}) {
+        LinkVertices(graph, data.data(), first_vertex, alpha);
+    }
+
+    nodes_offset_ = AlignTo(HeaderSize(), kSectorSize);
+    build_data_ = std::move(data);
+    build_labels_ = std::move(labels);
+    build_graph_ = std::move(graph);
+}
+
+void DiskAnnIndex::LinkVertices(Vector<Vector<u32>> &graph, const f32 *data, u32 first_vertex, f32 alpha) const {
+    constexpr SizeT vertices_per_task = 32;
+    Vector<u32> order(row_count_ - first_vertex);
+    std::iota(order.begin(), order.end(), first_vertex);
+    std::shuffle(order.begin(), order.end(), std::mt19937(row_count_));
+    // An empty graph starts from batches of one vertex doubled each time, so the first vertices link each other before
+    // the later ones search through them.
+    const SizeT max_batch_size = std::max<SizeT>(row_count_ / 50, vertices_per_task);
+    SizeT batch_size = first_vertex == 0 ? 1 : max_batch_size;
+    Vector<Vector<u32>> new_neighbors;
+    Vector<Pair<u32, u32>> reverse_edges;
+    Vector<SizeT> target_begins;
+    for (SizeT batch_begin = 0; batch_begin < order.size(); batch_begin += batch_size, batch_size = std::min(batch_size * 2, max_batch_size)) {
+        const SizeT batch_end = std::min(batch_begin + batch_size, order.size());
+        new_neighbors.assign(batch_end - batch_begin, {});
+        SharedParallelFor(TaskClass::kIngest, (batch_end - batch_begin + vertices_per_task - 1) / vertices_per_task, [&](SizeT task_idx) {
+            SizeT end = std::min(batch_begin + (task_idx + 1) * vertices_per_task, batch_end);
+            for (SizeT i = batch_begin + task_idx * vertices_per_task; i < end; ++i) {
+                u32 vertex_i = order[i];
+                Vector<Pair<f32, u32>> candidates = GreedySearch(graph, data, data + vertex_i * dimension_);
+                Vector<u32> &neighbors = new_neighbors[i - batch_begin];
+                neighbors = graph[vertex_i];
+                RobustPrune(vertex_i, candidates, alpha, data, neighbors);
+            }
+        });
+
+        reverse_edges.clear();
+        for (SizeT i = batch_begin; i < batch_end; ++i) {
+            u32 vertex_i = order[i];
+            graph[vertex_i] = std::move(new_neighbors[i - batch_begin]);
+            for (u32 neighbor_i : graph[vertex_i]) {
+                reverse_edges.emplace_back(neighbor_i, vertex_i);
+            }
+        }
+        // each task owns the neighbor lists of its targets
+        std::sort(reverse_edges.begin(), reverse_edges.end());
+        target_begins.clear();
+        for (SizeT i = 0; i < reverse_edges.size(); ++i) {
+            if (i == 0 || reverse_edges[i].first != reverse_edges[i - 1].first) {
+                target_begins.push_back(i);
+            }
+        }
+        const SizeT target_n = target_begins.size();
+        target_begins.push_back(reverse_edges.size());
+        SharedParallelFor(TaskClass::kIngest, (target_n + vertices_per_task - 1) / vertices_per_task, [&](SizeT task_idx) {
+            Vector<Pair<f32, u32>> candidates;
+            SizeT end = std::min((task_idx + 1) * vertices_per_task, target_n);
+            for (SizeT target_idx = task_idx * vertices_per_task; target_idx < end; ++target_idx) {
+                u32 target_i = reverse_edges[target_begins[target_idx]].first;
+                Vector<u32> &reverse_neighbors = graph[target_i];
+                candidates.clear();
+                for (SizeT i = target_begins[target_idx]; i < target_begins[target_idx + 1]; ++i) {
+                    u32 vertex_i = reverse_edges[i].second;
+                    if (std::find(reverse_neighbors.begin(), reverse_neighbors.end(), vertex_i) == reverse_neighbors.end()) {
+                        candidates.emplace_back(l2_func_(data + target_i * dimension_, data + vertex_i * dimension_, dimension_), vertex_i);
+                    }
+                }
+                if (reverse_neighbors.size() + candidates.size() <= max_degree_) {
+                    for (const auto &[_, vertex_i] : candidates) {
+                        reverse_neighbors.push_back(vertex_i);
+                    }
+                    continue;
+                }
+                RobustPrune(target_i, candidates, alpha, data, reverse_neighbors);
+            }
+        });
+    }
+}
+
+Vector<Pair<f32, u32>> DiskAnnIndex::GreedySearch(const Vector<Vector<u32>> &graph, const f32 *data, const f32 *query) const {
+    Vector<Candidate> list;
+    list.reserve(build_list_size_ + 1);
+    HashSet<u32> visited;
+    list.push_back({l2_func_(query, data + medoid_ * dimension_, dimension_), medoid_, false});
+    visited.insert(medoid_);
+    Vector<Pair<f32, u32>> expanded;
+    // the candidates before `next` are expanded
+    SizeT next = 0;
+    while (true) {
+        while (next < list.size() && list[next].expanded_) {
+            ++next;
+        }
+        if (next == list.size()) {
+            break;
+        }
+        list[next].expanded_ = true;
+        u32 vertex_i = list[next].vertex_i_;
+        expanded.emplace_back(list[next].dist_, vertex_i);
+        for (u32 neighbor_i : graph[vertex_i]) {
+            if (!visited.insert(neighbor_i).second) {
+                continue;
+            }
+            f32 dist = l2_func_(query, data + neighbor_i * dimension_, dimension_);
+            if (list.size() >= build_list_size_ && dist >= list.back().dist_) {
+                continue;
+            }
+            auto pos = std::upper_bound(list.begin(), list.end(), dist, [](f32 d, const Candidate &candidate) { return d < candidate.dist_; });
+            next = std::min<SizeT>(next, pos - list.begin());
+            list.insert(pos, {dist, neighbor_i, false});
+            if (list.size() > build_list_size_) {
+                list.pop_back();
+            }
+        }
+    }
+    return expanded;
+}
+
+void DiskAnnIndex::RobustPrune(u32 vertex_i, Vector<Pair<f32, u32>> &candidates, f32 alpha, const f32 *data, Vector<u32> &neighbors) const {
+    const f32 *vec = data + vertex_i * dimension_;
+    for (u32 neighbor_i : neighbors) {
+        candidates.emplace_back(l2_func_(vec, data + neighbor_i * dimension_, dimension_), neighbor_i);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end(), [](const auto &a, const auto &b) { return a.second == b.second; }),
+                     candidates.end());
+    neighbors.clear();
+    Vector<bool> pruned(candidates.size(), false);
+    for (SizeT i = 0; i < candidates.size() && neighbors.size() < max_degree_; ++i) {
+        auto [dist, candidate_i] = candidates[i];
+        if (pruned[i] || candidate_i == vertex_i) {
+            continue;
+        }
+        neighbors.push_back(candidate_i);
+        const f32 *candidate_vec = data + candidate_i * dimension_;
+        for (SizeT j = i + 1; j < candidates.size(); ++j) {
+            if (!pruned[j] && alpha * l2_func_(candidate_vec, data + candidates[j].second * dimension_, dimension_) <= candidates[j].first) {
+                pruned[j] = true;
+            }
+        }
+    }
+}
+
+SizeT DiskAnnIndex::HeaderSize() const {
+    return sizeof(u64) * 6 + DiskAnnPQ::kCentroidNum * dimension_ * sizeof(f32) + row_count_ * pq_.subspace_num();
+}
+
+void DiskAnnIndex::Save(FileHandler &file_handler) {
+    std::unique_lock lock(rw_mutex_);
+    u64 header[6] = {dimension_, static_cast<u64>(metric_), max_degree_, pq_.subspace_num(), row_count_, medoid_};
+    file_handler.Write(header, sizeof(header));
+    pq_.Save(file_handler);
+    file_handler.Write(codes_.data(), codes_.size());
+    if (row_count_ == 0) {
+        return;
+    }
+    Vector<char> padding(nodes_offset_ - HeaderSize(), 0);
+    file_handler.Write(padding.data(), padding.size());
+    const SizeT copy_sector_num = CopySectorNum();
+    AlignedBuffer buffer(copy_sector_num * kSectorSize);
+    const SizeT sector_num = NodeSectorNum();
+    if (fd_ == -1) {
+        // the nodes are written a batch of sectors at a time, the built vectors are never copied whole
+        u32 vertex_i = 0;
+        for (SizeT sector_i = 0; sector_i < sector_num; sector_i += copy_sector_num) {
+            SizeT copy_size = std::min(copy_sector_num, sector_num - sector_i) * kSectorSize;
+            i64 copy_offset = nodes_offset_ + sector_i * kSectorSize;
+            std::memset(buffer.get(), 0, copy_size);
+            for (; vertex_i < row_count_ && NodeFileOffset(vertex_i) < copy_offset + static_cast<i64>(copy_size); ++vertex_i) {
+                WriteNode(vertex_i, buffer.get() + (NodeFileOffset(vertex_i) - copy_offset) + NodeOffsetInSector(vertex_i));
+            }
+            file_handler.Write(buffer.get(), copy_size);
+        }
+        OpenNodeFile(file_handler.path_.string());
+        build_data_ = Vector<f32>();
+        build_labels_ = Vector<SegmentOffset>();
+        build_graph_ = Vector<Vector<u32>>();
+        return;
+    }
+    // spilled and loaded again, copy the nodes from the spilled file
+    for (SizeT sector_i = 0; sector_i < sector_num; sector_i += copy_sector_num) {
+        SizeT copy_size = std::min(copy_sector_num, sector_num - sector_i) * kSectorSize;
+        PreadFully(fd_, buffer.get(), copy_size, nodes_offset_ + sector_i * kSectorSize);
+        file_handler.Write(buffer.get(), copy_size);
+    }
+    // don't keep the spilled file open after it is moved or removed
+    OpenNodeFile(file_handler.path_.string());
+}
+
+void DiskAnnIndex::Load(FileHandler &file_handler) {
+    std::unique_lock lock(rw_mutex_);
+    u64 header[6];
+    file_handler.Read(header, sizeof(header));
+    auto [dimension, metric, max_degree, subspace_num, row_count, medoid] = header;
+    if (dimension != dimension_ || metric != static_cast<u64>(metric_) || max_degree != max_degree_ || subspace_num != pq_.subspace_num()) {
+        String error_message = fmt::format("Diskann index file {} doesn't match the index definition", file_handler.path_.string());
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    row_count_ = row_count;
+    medoid_ = medoid;
+    pq_.Load(file_handler);
+    codes_.resize(row_count_ * pq_.subspace_num());
+    file_handler.Read(codes_.data(), codes_.size());
+    nodes_offset_ = AlignTo(HeaderSize(), kSectorSize);
+    if (row_count_ > 0) {
+        OpenNodeFile(file_handler.path_.string());
+    }
+}
+
+void DiskAnnIndex::OpenNodeFile(const String &path) {
+    if (fd_ != -1) {
+        close(fd_);
+    }
+    // bypass the page cache, the nodes are read once per query and the beam decides what to read. Some file systems
+    // don't support direct io, read through the cache there.
+#if defined(O_DIRECT)
+    fd_ = open(path.c_str(), O_RDONLY | O_DIRECT);
+    if (fd_ == -1) {
+        fd_ = open(path.c_str(), O_RDONLY);
+    }
+#else
+    fd_ = open(path.c_str(), O_RDONLY);
+#endif
+    if (fd_ == -1) {
+        String error_message = fmt::format("Failed to open diskann index file {}: {}", path, strerror(errno));
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+}
+
+SizeT DiskAnnIndex::CopySectorNum() const { return std::max<SizeT>(256 / sectors_per_node_, 1) * sectors_per_node_; }
+
+void DiskAnnIndex::WriteNode(u32 vertex_i, char *node) const {
+    std::memcpy(node, build_data_.data() + vertex_i * dimension_, dimension_ * sizeof(f32));
+    node += dimension_ * sizeof(f32);
+    std::memcpy(node, &build_labels_[vertex_i], sizeof(SegmentOffset));
+    node += sizeof(SegmentOffset);
+    u32 degree = build_graph_[vertex_i].size();
+    std::memcpy(node, &degree, sizeof(u32));
+    node += sizeof(u32);
+    std::memcpy(node, build_graph_[vertex_i].data(), degree * sizeof(u32));
+}
+
+void DiskAnnIndex::ReadGraph(Vector<SegmentOffset> &labels, Vector<Vector<u32>> &graph) const {
+    std::shared_lock lock(rw_mutex_);
+    if (fd_ == -1) {
+        labels = build_labels_;
+        graph = build_graph_;
+        return;
+    }
+    labels.resize(row_count_);
+    graph.resize(row_count_);
+    const SizeT copy_sector_num = CopySectorNum();
+    AlignedBuffer buffer(copy_sector_num * kSectorSize);
+    const SizeT sector_num = NodeSectorNum();
+    u32 vertex_i = 0;
+    for (SizeT sector_i = 0; sector_i < sector_num; sector_i += copy_sector_num) {
+        SizeT copy_size = std::min(copy_sector_num, sector_num - sector_i) * kSectorSize;
+        i64 copy_offset = nodes_offset_ + sector_i * kSectorSize;
+        PreadFully(fd_, buffer.get(), copy_size, copy_offset);
+        for (; vertex_i < row_count_ && NodeFileOffset(vertex_i) < copy_offset + static_cast<i64>(copy_size); ++vertex_i) {
+            const char *node = buffer.get() + (NodeFileOffset(vertex_i) - copy_offset) + NodeOffsetInSector(vertex_i) + dimension_ * sizeof(f32);
+            std::memcpy(&labels[vertex_i], node, sizeof(SegmentOffset));
+            u32 degree;
+            std::memcpy(&degree, node + sizeof(SegmentOffset), sizeof(u32));
+            graph[vertex_i].resize(degree);
+            std::memcpy(graph[vertex_i].data(), node + sizeof(SegmentOffset) + sizeof(u32), degree * sizeof(u32));
+        }
+    }
+}
+
+void DiskAnnIndex::ReadNodes(const Vector<u32> &vertices, char *buffer) const {
+    if (fd_ == -1) {
+        for (SizeT i = 0; i < vertices.size(); ++i) {
+            WriteNode(vertices[i], buffer + i * node_read_size_ + NodeOffsetInSector(vertices[i]));
+        }
+        return;
+    }
+    Vector<i64> offsets(vertices.size());
+    for (SizeT i = 0; i < vertices.size(); ++i) {
+        offsets[i] = NodeFileOffset(vertices[i]);
+    }
+#if defined(__linux__)
+    static thread_local AioContext aio_context;
+    if (aio_context.Read(fd_, offsets, buffer, node_read_size_)) {
+        return;
+    }
+#endif
+    for (SizeT i = 0; i < offsets.size(); ++i) {
+        PreadFully(fd_, buffer + i * node_read_size_, node_read_size_, offsets[i]);
+    }
+}
+
+Tuple<SizeT, UniquePtr<f32[]>, UniquePtr<SegmentOffset[]>>
+DiskAnnIndex::KnnSearch(const f32 *query, SizeT k, const DiskAnnSearchOption &option, const FilterBase<SegmentOffset> *filter) const {
+    std::shared_lock lock(rw_mutex_);
+    if (row_count_ == 0 || k == 0) {
+        return {0, nullptr, nullptr};
+    }
+    const SizeT subspace_num = pq_.subspace_num();
+    Vector<f32> dist_table(subspace_num * DiskAnnPQ::kCentroidNum);
+    pq_.MakeDistanceTable(query, metric_, dist_table.data());
+
+    const SizeT list_size = std::max(option.search_list_size_, k);
+    const SizeT beam_width = std::clamp<SizeT>(option.beam_width_, 1, kMaxBeamWidth);
+    Vector<Candidate> list;
+    list.reserve(list_size + 1);
+    HashSet<u32> visited;
+    list.push_back({pq_.Distance(dist_table.data(), codes_.data() + medoid_ * subspace_num), medoid_, false});
+    visited.insert(medoid_);
+
+    Vector<Pair<f32, SegmentOffset>> results;
+    Vector<u32> beam;
+    AlignedBuffer buffer(beam_width * node_read_size_);
+    // the candidates before `next` are expanded
+    SizeT next = 0;
+    while (true) {
+        beam.clear();
+        for (SizeT i = next; i < list.size() && beam.size() < beam_width; ++i) {
+            if (!list[i].expanded_) {
+                list[i].expanded_ = true;
+                beam.push_back(list[i].vertex_i_);
+            }
+        }
+        if (beam.empty()) {
+            break;
+        }
+        while (next < list.size() && list[next].expanded_) {
+            ++next;
+        }
+        ReadNodes(beam, buffer.get());
+        for (SizeT i = 0; i < beam.size(); ++i) {
+            const char *node = buffer.get() + i * node_read_size_ + NodeOffsetInSector(beam[i]);
+            const auto *vec = reinterpret_cast<const f32 *>(node);
+            SegmentOffset label;
+            std::memcpy(&label, node + dimension_ * sizeof(f32), sizeof(SegmentOffset));
+            u32 degree;
+            std::memcpy(&degree, node + dimension_ * sizeof(f32) + sizeof(SegmentOffset), sizeof(u32));
+            const auto *neighbors = reinterpret_cast<const u32 *>(node + dimension_ * sizeof(f32) + sizeof(SegmentOffset) + sizeof(u32));
+            if (filter == nullptr || (*filter)(label)) {
+                results.emplace_back(Distance(query, vec), label);
+            }
+            for (u32 j = 0; j < degree; ++j) {
+                u32 neighbor_i = neighbors[j];
+                if (!visited.insert(neighbor_i).second) {
+                    continue;
+                }
+                f32 dist = pq_.Distance(dist_table.data(), codes_.data() + neighbor_i * subspace_num);
+                if (list.size() >= list_size && dist >= list.back().dist_) {
+                    continue;
+                }
+                auto pos = std::upper_bound(list.begin(), list.end(), dist, [](f32 d, const Candidate &candidate) { return d < candidate.dist_; });
+                next = std::min<SizeT>(next, pos - list.begin());
+                list.insert(pos, {dist, neighbor_i, false});
+                if (list.size() > list_size) {
+                    list.pop_back();
+                }
+            }
+        }
+    }
+
+    SizeT result_n = std::min(k, results.size());
+    std::partial_sort(results.begin(), results.begin() + result_n, results.end());
+    auto dists = MakeUniqueForOverwrite<f32[]>(result_n);
+    auto labels = MakeUniqueForOverwrite<SegmentOffset[]>(result_n);
+    for (SizeT i = 0; i < result_n; ++i) {
+        std::tie(dists[i], labels[i]) = results[i];
+    }
+    return {result_n, std::move(dists), std::move(labels)};
+}
+
+} // namespace infinity
@@ -0,0 +1,175 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module diskann_index;
+
+import stl;
+import index_base;
+import hnsw_common;
+import diskann_pq;
+
+namespace infinity {
+
+class FileHandler;
+
+export struct DiskAnnSearchOption {
+    // the number of candidates kept by the search, larger is more accurate and reads more nodes
+    SizeT search_list_size_{100};
+    // the number of nodes read from the disk at once
+    SizeT beam_width_{4};
+};
+
+// A Vamana graph index whose nodes live on the disk.
+//
+// Each node holds the full precision vector, the label and the neighbor list of a vertex. The nodes are packed into
+// 4KB sectors, a node never crosses a sector unless it is larger than one, so reading a node is one aligned read.
+// Only the pq codes of the vectors are kept in memory. The search walks the graph from the medoid, ranks the unread
+// vertices by their pq distances and reads the `beam_width` best of them in one batch of direct aio reads. The full
+// precision vectors of the read nodes rank the results.
+//
+// File layout: header | pq centroids | pq codes | padding to a sector | node sectors
+//
+// The graph is built in memory over the whole chunk. The vectors, labels and neighbor lists of the build are kept until
+// Save streams them into the node sectors of the file, then the index only reads the file.
+export class DiskAnnIndex {
+public:
+    static constexpr SizeT kSectorSize = 4096;
+    static constexpr SizeT kMaxBeamWidth = 64;
+
+    DiskAnnIndex(SizeT dimension, MetricType metric, SizeT max_degree, SizeT build_list_size, f32 alpha, SizeT pq_subspace_num);
+
+    ~DiskAnnIndex();
+
+    DiskAnnIndex(const DiskAnnIndex &) = delete;
+    DiskAnnIndex &operator=(const DiskAnnIndex &) = delete;
+
+    // The vertices of `base` whose labels lead the rows keep their edges, only the other rows are linked into its graph.
+    template <DataIteratorConcept<const f32 *, SegmentOffset> Iterator>
+    SizeT Build(Iterator &&iter, const DiskAnnIndex *base = nullptr) {
+        Vector<f32> data;
+        Vector<SegmentOffset> labels;
+        while (true) {
+            auto ret = iter.Next();
+            if (!ret) {
+                break;
+            }
+            auto &[vec, label] = *ret;
+            data.insert(data.end(), vec, vec + dimension_);
+            labels.push_back(label);
+        }
+        BuildInner(std::move(data), std::move(labels), base);
+        return row_count_;
+    }
+
+    // Write the index to the file and read the nodes from it afterwards.
+    void Save(FileHandler &file_handler);
+
+    void Load(FileHandler &file_handler);
+
+    // The distances are smaller is better, inner products are negated. The filter drops results but not the walk.
+    Tuple<SizeT, UniquePtr<f32[]>, UniquePtr<SegmentOffset[]>>
+    KnnSearch(const f32 *query, SizeT k, const DiskAnnSearchOption &option, const FilterBase<SegmentOffset> *filter = nullptr) const;
+
+    SizeT row_count() const { return row_count_; }
+
+    SizeT GetMemoryCost() const {
+        return pq_.GetMemoryCost() + codes_.size() + build_data_.size() * sizeof(f32) + build_labels_.size() * sizeof(SegmentOffset) +
+               build_graph_.size() * max_degree_ * sizeof(u32);
+    }
+
+    bool on_disk() const { return fd_ != -1; }
+
+private:
+    struct Candidate {
+        f32 dist_;
+        u32 vertex_i_;
+        bool expanded_;
+    };
+
+    void BuildInner(Vector<f32> data, Vector<SegmentOffset> labels, const DiskAnnIndex *base);
+
+    // Link the vertices from `first_vertex` into the graph in shuffled batches. The vertices of a batch search the graph of the
+    // former batches in parallel, then their reverse edges are added in parallel by the target vertex.
+    void LinkVertices(Vector<Vector<u32>> &graph, const f32 *data, u32 first_vertex, f32 alpha) const;
+
+    // the vertices expanded by the search and their distances to the query
+    Vector<Pair<f32, u32>> GreedySearch(const Vector<Vector<u32>> &graph, const f32 *data, const f32 *query) const;
+
+    // keep at most max_degree_ neighbors, drop the candidates which are `alpha` times closer to a kept one than to the vertex
+    void RobustPrune(u32 vertex_i, Vector<Pair<f32, u32>> &candidates, f32 alpha, const f32 *data, Vector<u32> &neighbors) const;
+
+    SizeT HeaderSize() const;
+
+    SizeT NodeSectorNum() const { return (row_count_ + nodes_per_sector_ - 1) / nodes_per_sector_ * sectors_per_node_; }
+
+    i64 NodeFileOffset(u32 vertex_i) const { return nodes_offset_ + vertex_i / nodes_per_sector_ * sectors_per_node_ * kSectorSize; }
+
+    SizeT NodeOffsetInSector(u32 vertex_i) const { return vertex_i % nodes_per_sector_ * node_size_; }
+
+    // read the sectors of the nodes, one node_read_size_ slot of the buffer each
+    void ReadNodes(const Vector<u32> &vertices, char *buffer) const;
+
+    // write the node of the built vertex at `node`
+    void WriteNode(u32 vertex_i, char *node) const;
+
+    // the labels and the neighbor lists of all vertices
+    void ReadGraph(Vector<SegmentOffset> &labels, Vector<Vector<u32>> &graph) const;
+
+    // the number of node sectors copied at once, a multiple of the sectors of a node
+    SizeT CopySectorNum() const;
+
+    void OpenNodeFile(const String &path);
+
+    // the graph is built on l2 geometry, the search ranks by the metric of the index
+    f32 Distance(const f32 *v1, const f32 *v2) const {
+        return metric_ == MetricType::kMetricInnerProduct ? -ip_func_(v1, v2, dimension_) : l2_func_(v1, v2, dimension_);
+    }
+
+private:
+    const SizeT dimension_;
+    const MetricType metric_;
+    const SizeT max_degree_;
+    const SizeT build_list_size_;
+    const f32 alpha_;
+
+    using DistFuncType = f32 (*)(const f32 *, const f32 *, SizeT);
+    DistFuncType l2_func_{};
+    DistFuncType ip_func_{};
+
+    DiskAnnPQ pq_;
+
+    // vector | label | degree | neighbors
+    const SizeT node_size_;
+    SizeT nodes_per_sector_{};
+    SizeT sectors_per_node_{};
+    SizeT node_read_size_{};
+
+    SizeT row_count_{};
+    u32 medoid_{};
+    i64 nodes_offset_{};
+
+    Vector<u8> codes_;
+    // the built nodes before the index is saved
+    Vector<f32> build_data_;
+    Vector<SegmentOffset> build_labels_;
+    Vector<Vector<u32>> build_graph_;
+    i32 fd_{-1};
+
+    // the index switches to the file in Save
+    mutable std::shared_mutex rw_mutex_;
+};
+
+} // namespace infinity
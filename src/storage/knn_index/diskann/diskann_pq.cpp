@@ -0,0 +1,119 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module diskann_pq;
+
+import stl;
+import index_base;
+import kmeans_partition;
+import search_top_k;
+import file_system;
+import infinity_exception;
+import logger;
+import third_party;
+
+namespace infinity {
+
+DiskAnnPQ::DiskAnnPQ(SizeT dimension, SizeT subspace_num)
+    : dimension_(dimension), subspace_num_(subspace_num), subspace_dimension_(subspace_num == 0 ? 0 : dimension / subspace_num) {
+    if (subspace_num_ == 0 || dimension_ % subspace_num_ != 0) {
+        String error_message = fmt::format("Dimension {} is not divisible by pq_subspace_num {}", dimension_, subspace_num_);
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    centroids_.resize(subspace_num_ * kCentroidNum * subspace_dimension_);
+}
+
+SizeT DiskAnnPQ::DefaultSubspaceNum(SizeT dimension) {
+    for (SizeT subspace_num = std::max<SizeT>(dimension / 4, 1); subspace_num > 1; --subspace_num) {
+        if (dimension % subspace_num == 0) {
+            return subspace_num;
+        }
+    }
+    return 1;
+}
+
+void DiskAnnPQ::Train(const f32 *data, SizeT vec_num) {
+    const SizeT centroid_num = std::min(kCentroidNum, vec_num);
+    Vector<f32> subspace_data(vec_num * subspace_dimension_);
+    Vector<f32> subspace_centroids;
+    for (SizeT subspace_i = 0; subspace_i < subspace_num_; ++subspace_i) {
+        for (SizeT vec_i = 0; vec_i < vec_num; ++vec_i) {
+            std::copy_n(data + vec_i * dimension_ + subspace_i * subspace_dimension_,
+                        subspace_dimension_,
+                        subspace_data.data() + vec_i * subspace_dimension_);
+        }
+        [[maybe_unused]] u32 partition_num = GetKMeansCentroids<f32, f32, f32>(MetricType::kMetricL2,
+                                                                               subspace_dimension_,
+                                                                               vec_num,
+                                                                               subspace_data.data(),
+                                                                               subspace_centroids,
+                                                                               centroid_num);
+        f32 *centroids = centroids_.data() + subspace_i * kCentroidNum * subspace_dimension_;
+        std::copy_n(subspace_centroids.data(), centroid_num * subspace_dimension_, centroids);
+        // too few vectors, the unused slots repeat the first centroid and are never the only nearest one
+        for (SizeT centroid_i = centroid_num; centroid_i < kCentroidNum; ++centroid_i) {
+            std::copy_n(centroids, subspace_dimension_, centroids + centroid_i * subspace_dimension_);
+        }
+    }
+}
+
+void DiskAnnPQ::Encode(const f32 *data, SizeT vec_num, u8 *codes) const {
+    Vector<f32> subspace_data(vec_num * subspace_dimension_);
+    Vector<u32> centroid_ids(vec_num);
+    for (SizeT subspace_i = 0; subspace_i < subspace_num_; ++subspace_i) {
+        for (SizeT vec_i = 0; vec_i < vec_num; ++vec_i) {
+            std::copy_n(data + vec_i * dimension_ + subspace_i * subspace_dimension_,
+                        subspace_dimension_,
+                        subspace_data.data() + vec_i * subspace_dimension_);
+        }
+        search_top_1_without_dis<f32>(subspace_dimension_,
+                                      vec_num,
+                                      subspace_data.data(),
+                                      kCentroidNum,
+                                      centroids_.data() + subspace_i * kCentroidNum * subspace_dimension_,
+                                      centroid_ids.data());
+        for (SizeT vec_i = 0; vec_i < vec_num; ++vec_i) {
+            codes[vec_i * subspace_num_ + subspace_i] = centroid_ids[vec_i];
+        }
+    }
+}
+
+void DiskAnnPQ::MakeDistanceTable(const f32 *query, MetricType metric, f32 *table) const {
+    const f32 *centroid = centroids_.data();
+    for (SizeT subspace_i = 0; subspace_i < subspace_num_; ++subspace_i, query += subspace_dimension_) {
+        for (SizeT centroid_i = 0; centroid_i < kCentroidNum; ++centroid_i, centroid += subspace_dimension_) {
+            f32 dist = 0;
+            if (metric == MetricType::kMetricInnerProduct) {
+                for (SizeT i = 0; i < subspace_dimension_; ++i) {
+                    dist -= query[i] * centroid[i];
+                }
+            } else {
+                for (SizeT i = 0; i < subspace_dimension_; ++i) {
+                    f32 diff = query[i] - centroid[i];
+                    dist += diff * diff;
+                }
+            }
+            *table++ = dist;
+        }
+    }
+}
+
+void DiskAnnPQ::Save(FileHandler &file_handler) const { file_handler.Write(centroids_.data(), centroids_.size() * sizeof(f32)); }
+
+void DiskAnnPQ::Load(FileHandler &file_handler) { file_handler.Read(centroids_.data(), centroids_.size() * sizeof(f32)); }
+
+} // namespace infinity
@@ -0,0 +1,70 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module diskann_pq;
+
+import stl;
+import index_base;
+
+namespace infinity {
+
+class FileHandler;
+
+// Product quantizer of the diskann index. Each vector is split into `subspace_num` subvectors and each subvector is
+// encoded by the id of its nearest one of 256 centroids. The codes are the only per vector data kept in memory, the
+// search ranks the unvisited vertices by the distances between the query and the decoded codes.
+export class DiskAnnPQ {
+public:
+    static constexpr SizeT kCentroidNum = 256;
+
+    DiskAnnPQ(SizeT dimension, SizeT subspace_num);
+
+    void Train(const f32 *data, SizeT vec_num);
+
+    void Encode(const f32 *data, SizeT vec_num, u8 *codes) const;
+
+    // table[subspace_i * kCentroidNum + centroid_i] is the distance between the query subvector and the centroid,
+    // smaller is better for both metrics
+    void MakeDistanceTable(const f32 *query, MetricType metric, f32 *table) const;
+
+    f32 Distance(const f32 *table, const u8 *code) const {
+        f32 dist = 0;
+        for (SizeT subspace_i = 0; subspace_i < subspace_num_; ++subspace_i, table += kCentroidNum) {
+            dist += table[code[subspace_i]];
+        }
+        return dist;
+    }
+
+    void Save(FileHandler &file_handler) const;
+
+    void Load(FileHandler &file_handler);
+
+    SizeT subspace_num() const { return subspace_num_; }
+
+    SizeT GetMemoryCost() const { return centroids_.size() * sizeof(f32); }
+
+    // the default number of subspaces, a quarter of the dimension rounded down to one of its divisors
+    static SizeT DefaultSubspaceNum(SizeT dimension);
+
+private:
+    const SizeT dimension_;
+    const SizeT subspace_num_;
+    const SizeT subspace_dimension_;
+    // subspace_num_ * kCentroidNum * subspace_dimension_
+    Vector<f32> centroids_;
+};
+
+} // namespace infinity
@@ -121,6 +121,18 @@ public:
         std::visit([&file_handler](auto &&arg) { arg->Save(file_handler); }, knn_hnsw_ptr_);
     }
 
+    // Replace the index pointed to by a copy of the index of `other`, the pointer is unchanged.
+    void CopyFrom(const AbstractHnsw &other) {
+        std::visit(
+            [&other](auto &&arg) {
+                using T = std::decay_t<decltype(*arg)>;
+                T copy = std::get<T *>(other.knn_hnsw_ptr_)->Copy();
+                arg->~T();
+                new (arg) T(std::move(copy));
+            },
+            knn_hnsw_ptr_);
+    }
+
     void Free() {
         std::visit([](auto &&arg) { delete arg; }, knn_hnsw_ptr_);
     }
@@ -155,27 +167,40 @@ public:
         std::visit([ef](auto &&arg) { arg->SetEf(ef); }, knn_hnsw_ptr_);
     }
 
+    bool MarkDeleted(LabelType label) {
+        return std::visit([label](auto &&arg) { return arg->MarkDeleted(label); }, knn_hnsw_ptr_);
+    }
+
+    bool AllDeleted(const Vector<LabelType> &labels) const {
+        return std::visit([&labels](auto &&arg) { return arg->AllDeleted(labels); }, knn_hnsw_ptr_);
+    }
+
+    SizeT Consolidate() {
+        return std::visit([](auto &&arg) { return arg->Consolidate(); }, knn_hnsw_ptr_);
+    }
+
     template <FilterConcept<LabelType> Filter>
     Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>>
-    KnnSearch(const DataType *q, SizeT k, const Filter &filter, bool with_lock = true) const {
+    KnnSearch(const DataType *q, SizeT k, const Filter &filter, bool with_lock = true, DataType dist_bound = std::numeric_limits<DataType>::max()) const {
         return std::visit(
-            [q, k, &filter, with_lock](auto &&arg) {
+            [q, k, &filter, with_lock, dist_bound](auto &&arg) {
                 if (with_lock) {
-                    return arg->template KnnSearch<Filter, true>(q, k, filter);
+                    return arg->template KnnSearch<Filter, true>(q, k, filter, dist_bound);
                 } else {
-                    return arg->template KnnSearch<Filter, false>(q, k, filter);
+                    return arg->template KnnSearch<Filter, false>(q, k, filter, dist_bound);
                 }
             },
             knn_hnsw_ptr_);
     }
 
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, bool with_lock = true) const {
+    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>>
+    KnnSearch(const DataType *q, SizeT k, bool with_lock = true, DataType dist_bound = std::numeric_limits<DataType>::max()) const {
         return std::visit(
-            [q, k, with_lock](auto &&arg) {
+            [q, k, with_lock, dist_bound](auto &&arg) {
                 if (with_lock) {
-                    return arg->template KnnSearch<true>(q, k);
+                    return arg->template KnnSearch<true>(q, k, dist_bound);
                 } else {
-                    return arg->template KnnSearch<false>(q, k);
+                    return arg->template KnnSearch<false>(q, k, dist_bound);
                 }
             },
             knn_hnsw_ptr_);
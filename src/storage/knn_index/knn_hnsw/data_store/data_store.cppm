@@ -14,6 +14,7 @@
 
 module;
 
+#include <bit>
 #include <cassert>
 #include <ostream>
 #include <type_traits>
@@ -63,11 +64,11 @@ private:
     }
 
 public:
-    DataStore() : chunk_size_(0), max_chunk_n_(0), chunk_shift_(0), cur_vec_num_(0) {}
+    DataStore() : chunk_size_(0), max_chunk_n_(0), chunk_shift_(0), cur_vec_num_(0), deleted_num_(0) {}
     DataStore(This &&other)
         : chunk_size_(std::exchange(other.chunk_size_, 0)), max_chunk_n_(std::exchange(other.max_chunk_n_, 0)),
           chunk_shift_(std::exchange(other.chunk_shift_, 0)), cur_vec_num_(other.cur_vec_num_.exchange(0)),
-          vec_store_meta_(std::move(other.vec_store_meta_)), graph_store_meta_(std::move(other.graph_store_meta_)),
+          deleted_num_(other.deleted_num_.exchange(0)), vec_store_meta_(std::move(other.vec_store_meta_)), graph_store_meta_(std::move(other.graph_store_meta_)),
           inners_(std::exchange(other.inners_, nullptr)) {}
     ~DataStore() {
         if (!inners_) {
@@ -132,6 +133,22 @@ public:
         for (SizeT i = 0; i < chunk_num; ++i) {
             SizeT cur_chunk_size = (i < chunk_num - 1) ? chunk_size : last_chunk_size;
             ret.inners_[i] = Inner::Load(file_handler, cur_chunk_size, chunk_size, ret.vec_store_meta_, ret.graph_store_meta_);
+            ret.deleted_num_ += ret.inners_[i].DeletedNum(cur_chunk_size);
+        }
+        return ret;
+    }
+
+    // Deep copy, the graph isn't modified during the copy but may be searched.
+    This Copy() const {
+        SizeT cur_vec_num = this->cur_vec_num();
+        This ret(chunk_size_, max_chunk_n_, vec_store_meta_.Copy(), graph_store_meta_.Copy());
+        ret.cur_vec_num_ = cur_vec_num;
+        ret.deleted_num_ = deleted_num();
+
+        auto [chunk_num, last_chunk_size] = ChunkInfo(cur_vec_num);
+        for (SizeT i = 0; i < chunk_num; ++i) {
+            SizeT cur_chunk_size = (i < chunk_num - 1) ? chunk_size_ : last_chunk_size;
+            ret.inners_[i] = inners_[i].Copy(cur_chunk_size, chunk_size_, ret.vec_store_meta_, ret.graph_store_meta_);
         }
         return ret;
     }
@@ -218,6 +235,11 @@ public:
         return inner.GetNeighborsMut(idx, layer_i, graph_store_meta_);
     }
 
+    i32 GetLayerNum(VertexType vertex_i) const {
+        const auto &[inner, idx] = GetInner(vertex_i);
+        return inner.GetLayerNum(idx, graph_store_meta_);
+    }
+
     Pair<i32, VertexType> GetEnterPoint() const { return graph_store_meta_.GetEnterPoint(); }
 
     Pair<i32, VertexType> TryUpdateEnterPoint(i32 layer, VertexType vertex_i) { return graph_store_meta_.TryUpdateEnterPoint(layer, vertex_i); }
@@ -231,6 +253,24 @@ public:
         return inner.GetLabel(idx);
     }
 
+    // The tombstones are saved with the index, so a consolidated graph is known to be consolidated after a reload.
+    bool IsDeleted(SizeT vec_i) const {
+        const auto &[inner, idx] = GetInner(vec_i);
+        return inner.IsDeleted(idx);
+    }
+
+    // return false if the vertex is deleted already
+    bool MarkDeleted(SizeT vec_i) {
+        auto [inner, idx] = GetInner(vec_i);
+        if (!inner.MarkDeleted(idx)) {
+            return false;
+        }
+        ++deleted_num_;
+        return true;
+    }
+
+    SizeT deleted_num() const { return deleted_num_.load(); }
+
     std::shared_lock<std::shared_mutex> SharedLock(SizeT vec_i) const {
         const auto &[inner, idx] = GetInner(vec_i);
         return inner.SharedLock(idx);
@@ -262,6 +302,7 @@ private:
     SizeT chunk_shift_;
 
     Atomic<SizeT> cur_vec_num_;
+    Atomic<SizeT> deleted_num_;
     VecStoreMeta vec_store_meta_;
     GraphStoreMeta graph_store_meta_;
 
@@ -323,7 +364,8 @@ public:
 private:
     DataStoreInner(SizeT chunk_size, VecStoreInner vec_store_inner, GraphStoreInner graph_store_inner)
         : vec_store_inner_(std::move(vec_store_inner)), graph_store_inner_(std::move(graph_store_inner)),
-          labels_(MakeUnique<LabelType[]>(chunk_size)), vertex_mutex_(MakeUnique<std::shared_mutex[]>(chunk_size)) {}
+          labels_(MakeUnique<LabelType[]>(chunk_size)), deleted_(MakeUnique<Atomic<u64>[]>((chunk_size + 63) / 64)),
+          vertex_mutex_(MakeUnique<std::shared_mutex[]>(chunk_size)) {}
 
 public:
     DataStoreInner() = default;
@@ -340,6 +382,11 @@ public:
         vec_store_inner_.Save(file_handler, cur_vec_num, vec_store_meta);
         graph_store_inner_.Save(file_handler, cur_vec_num, graph_store_meta);
         file_handler.Write(labels_.get(), sizeof(LabelType) * cur_vec_num);
+        Vector<u64> deleted((cur_vec_num + 63) / 64);
+        for (SizeT i = 0; i < deleted.size(); ++i) {
+            deleted[i] = deleted_[i].load(memory_order_relaxed);
+        }
+        file_handler.Write(deleted.data(), sizeof(u64) * deleted.size());
     }
 
     static This Load(FileHandler &file_handler, SizeT cur_vec_num, SizeT chunk_size, VecStoreMeta &vec_store_meta, GraphStoreMeta &graph_store_meta) {
@@ -347,6 +394,22 @@ public:
         auto graph_store_iner = GraphStoreInner::Load(file_handler, cur_vec_num, chunk_size, graph_store_meta);
         This ret(chunk_size, std::move(vec_store_inner), std::move(graph_store_iner));
         file_handler.Read(ret.labels_.get(), sizeof(LabelType) * cur_vec_num);
+        Vector<u64> deleted((cur_vec_num + 63) / 64);
+        file_handler.Read(deleted.data(), sizeof(u64) * deleted.size());
+        for (SizeT i = 0; i < deleted.size(); ++i) {
+            ret.deleted_[i].store(deleted[i], memory_order_relaxed);
+        }
+        return ret;
+    }
+
+    This Copy(SizeT cur_vec_num, SizeT chunk_size, const VecStoreMeta &vec_store_meta, const GraphStoreMeta &graph_store_meta) const {
+        This ret(chunk_size,
+                 vec_store_inner_.Copy(cur_vec_num, chunk_size, vec_store_meta),
+                 graph_store_inner_.Copy(cur_vec_num, chunk_size, graph_store_meta));
+        std::copy(labels_.get(), labels_.get() + cur_vec_num, ret.labels_.get());
+        for (SizeT i = 0; i < (cur_vec_num + 63) / 64; ++i) {
+            ret.deleted_[i].store(deleted_[i].load(memory_order_relaxed), memory_order_relaxed);
+        }
         return ret;
     }
 
@@ -376,6 +439,8 @@ public:
     // graph store
     void AddVertex(VertexType vec_i, i32 layer_n, const GraphStoreMeta &meta) { graph_store_inner_.AddVertex(vec_i, layer_n, meta); }
 
+    i32 GetLayerNum(VertexType vertex_i, const GraphStoreMeta &meta) const { return graph_store_inner_.GetLayerNum(vertex_i, meta); }
+
     Pair<const VertexType *, VertexListSize> GetNeighbors(VertexType vertex_i, i32 layer_i, const GraphStoreMeta &meta) const {
         return graph_store_inner_.GetNeighbors(vertex_i, layer_i, meta);
     }
@@ -385,6 +450,21 @@ public:
 
     LabelType GetLabel(VertexType vec_i) const { return labels_[vec_i]; }
 
+    bool IsDeleted(VertexType vec_i) const { return (deleted_[vec_i >> 6].load(memory_order_relaxed) >> (vec_i & 63)) & 1; }
+
+    bool MarkDeleted(VertexType vec_i) {
+        u64 bit = u64(1) << (vec_i & 63);
+        return (deleted_[vec_i >> 6].fetch_or(bit) & bit) == 0;
+    }
+
+    SizeT DeletedNum(SizeT cur_vec_num) const {
+        SizeT deleted_num = 0;
+        for (SizeT i = 0; i < (cur_vec_num + 63) / 64; ++i) {
+            deleted_num += std::popcount(deleted_[i].load(memory_order_relaxed));
+        }
+        return deleted_num;
+    }
+
     std::shared_lock<std::shared_mutex> SharedLock(VertexType vec_i) const { return std::shared_lock<std::shared_mutex>(vertex_mutex_[vec_i]); }
 
     std::unique_lock<std::shared_mutex> UniqueLock(VertexType vec_i) { return std::unique_lock<std::shared_mutex>(vertex_mutex_[vec_i]); }
@@ -395,6 +475,8 @@ protected:
     VecStoreInner vec_store_inner_;
     GraphStoreInner graph_store_inner_;
     UniquePtr<LabelType[]> labels_;
+    // one bit per vertex, set when the vertex is deleted
+    UniquePtr<Atomic<u64>[]> deleted_;
 
 private:
     mutable UniquePtr<std::shared_mutex[]> vertex_mutex_;
@@ -80,6 +80,14 @@ public:
         return meta;
     }
 
+    GraphStoreMeta Copy() const {
+        GraphStoreMeta meta(Mmax0_, Mmax_);
+        auto [max_layer, enterpoint] = GetEnterPoint();
+        meta.max_layer_ = max_layer;
+        meta.enterpoint_ = enterpoint;
+        return meta;
+    }
+
     SizeT Mmax0() const { return Mmax0_; }
     SizeT Mmax() const { return Mmax_; }
     SizeT level0_size() const { return level0_size_; }
@@ -182,6 +190,33 @@ public:
         return graph_store;
     }
 
+    // The copy keeps the upper layers in one array as if it were loaded.
+    GraphStoreInner Copy(SizeT cur_vertex_n, SizeT max_vertex, const GraphStoreMeta &meta) const {
+        assert(cur_vertex_n <= max_vertex);
+
+        SizeT layer_sum = 0;
+        for (VertexType vertex_i = 0; vertex_i < (VertexType)cur_vertex_n; ++vertex_i) {
+            layer_sum += GetLevel0(vertex_i, meta)->layer_n_;
+        }
+
+        GraphStoreInner graph_store(max_vertex, meta, cur_vertex_n);
+        std::copy(graph_.get(), graph_.get() + cur_vertex_n * meta.level0_size(), graph_store.graph_.get());
+
+        auto loaded_layers = MakeUnique<char[]>(meta.levelx_size() * layer_sum);
+        char *loaded_layers_p = loaded_layers.get();
+        for (VertexType vertex_i = 0; vertex_i < (VertexType)cur_vertex_n; ++vertex_i) {
+            VertexL0 *v = graph_store.GetLevel0(vertex_i, meta);
+            if (v->layer_n_) {
+                SizeT layers_size = meta.levelx_size() * v->layer_n_;
+                std::copy(v->layers_p_, v->layers_p_ + layers_size, loaded_layers_p);
+                v->layers_p_ = loaded_layers_p;
+                loaded_layers_p += layers_size;
+            }
+        }
+        graph_store.loaded_layers_ = std::move(loaded_layers);
+        return graph_store;
+    }
+
     void AddVertex(VertexType vertex_i, i32 layer_n, const GraphStoreMeta &meta) {
         VertexL0 *v = GetLevel0(vertex_i, meta);
         v->neighbor_n_ = 0;
@@ -196,6 +231,8 @@ public:
         }
     }
 
+    i32 GetLayerNum(VertexType vertex_i, const GraphStoreMeta &meta) const { return GetLevel0(vertex_i, meta)->layer_n_; }
+
     Pair<const VertexType *, VertexListSize> GetNeighbors(VertexType vertex_i, i32 layer_i, const GraphStoreMeta &meta) const {
         const VertexL0 *v = GetLevel0(vertex_i, meta);
         if (layer_i == 0) {
@@ -100,6 +100,14 @@ public:
         return meta;
     }
 
+    This Copy() const {
+        This meta(dim_);
+        std::copy(mean_.get(), mean_.get() + dim_, meta.mean_.get());
+        meta.global_cache_ = global_cache_;
+        meta.normalize_ = normalize_;
+        return meta;
+    }
+
     LVQQuery MakeQuery(const DataType *vec) const {
         LVQQuery query(compress_data_size_);
         CompressTo(vec, query.inner_.get());
@@ -257,6 +265,13 @@ public:
         return ret;
     }
 
+    This Copy(SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta) const {
+        assert(cur_vec_num <= max_vec_num);
+        This ret(max_vec_num, meta);
+        std::copy(ptr_.get(), ptr_.get() + cur_vec_num * meta.compress_data_size(), ret.ptr_.get());
+        return ret;
+    }
+
     void SetVec(SizeT idx, const DataType *vec, const Meta &meta) { meta.CompressTo(vec, GetVecMut(idx, meta)); }
 
     const LVQData *GetVec(SizeT idx, const Meta &meta) const {
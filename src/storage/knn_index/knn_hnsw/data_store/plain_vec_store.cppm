@@ -55,6 +55,8 @@ public:
         return This(dim);
     }
 
+    This Copy() const { return This(dim_); }
+
     QueryType MakeQuery(const DataType *vec) const { return vec; }
 
     SizeT dim() const { return dim_; }
@@ -91,6 +93,13 @@ public:
         return ret;
     }
 
+    This Copy(SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta) const {
+        assert(cur_vec_num <= max_vec_num);
+        This ret(max_vec_num, meta);
+        std::copy(ptr_.get(), ptr_.get() + cur_vec_num * meta.dim(), ret.ptr_.get());
+        return ret;
+    }
+
     void SetVec(SizeT idx, const DataType *vec, const Meta &meta) { Copy(vec, vec + meta.dim(), GetVecMut(idx, meta)); }
 
     const DataType *GetVec(SizeT idx, const Meta &meta) const { return ptr_.get() + idx * meta.dim(); }
@@ -53,6 +53,8 @@ public:
         return This(max_dim);
     }
 
+    This Copy() const { return This(max_dim_); }
+
     QueryType MakeQuery(QueryVecType vec) const { return vec; }
 
     SizeT dim() const { return max_dim_; }
@@ -123,6 +125,14 @@ public:
         return ret;
     }
 
+    This Copy(SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta) const {
+        This ret(max_vec_num, meta);
+        for (SizeT i = 0; i < cur_vec_num; ++i) {
+            ret.SetVec(i, GetVec(i, meta), meta);
+        }
+        return ret;
+    }
+
     void SetVec(SizeT idx, const SparseVecRef &vec, const Meta &meta) {
         SparseVecEle &dst = vecs_[idx];
         dst.nnz_ = vec.nnz_;
@@ -115,6 +115,13 @@ public:
         return This(M, ef_construction, std::move(data_store), std::move(distance), 0, 0);
     }
 
+    // Deep copy to be modified while this one is still searched.
+    This Copy() const {
+        auto data_store = data_store_.Copy();
+        Distance distance(data_store.dim());
+        return This(M_, ef_construction_, std::move(data_store), std::move(distance), ef_, 0);
+    }
+
 private:
     // >= 0
     i32 GenerateRandomLayer() {
@@ -125,9 +132,15 @@ private:
     }
 
     // return the nearest `ef_construction_` neighbors of `query` in layer `layer_idx`
+    // vertices farther than `dist_bound` are expanded as usual but not returned, the search stops at `dist_bound` once the
+    // nearest `result_n` vertices are found
     template <bool WithLock, FilterConcept<LabelType> Filter = NoneType>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<VertexType[]>>
-    SearchLayer(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT result_n, const Filter &filter) const {
+    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<VertexType[]>> SearchLayer(VertexType enter_point,
+                                                                             const StoreType &query,
+                                                                             i32 layer_idx,
+                                                                             SizeT result_n,
+                                                                             const Filter &filter,
+                                                                             DataType dist_bound = std::numeric_limits<DataType>::max()) const {
         auto d_ptr = MakeUniqueForOverwrite<DataType[]>(result_n);
         auto i_ptr = MakeUniqueForOverwrite<VertexType[]>(result_n);
         HeapResultHandler<CompareMax<DataType, VertexType>> result_handler(1, result_n, d_ptr.get(), i_ptr.get());
@@ -138,12 +151,15 @@ private:
         // enter_point will not be added to result_handler, the distance is not used
         auto dist = distance_(query, data_store_.GetVec(enter_point), data_store_.vec_store_meta());
         candidate.emplace(-dist, enter_point);
+        // a deleted vertex is still expanded to keep the graph connected, but never returned
         if constexpr (!std::is_same_v<Filter, NoneType>) {
-            if (filter(GetLabel(enter_point))) {
+            if (!data_store_.IsDeleted(enter_point) && filter(GetLabel(enter_point))) {
                 result_handler.AddResult(0, dist, enter_point);
             }
         } else {
-            result_handler.AddResult(0, dist, enter_point);
+            if (!data_store_.IsDeleted(enter_point)) {
+                result_handler.AddResult(0, dist, enter_point);
+            }
         }
 
         SizeT cur_vec_num = data_store_.cur_vec_num();
@@ -153,7 +169,7 @@ private:
         while (!candidate.empty()) {
             const auto [minus_c_dist, c_idx] = candidate.top();
             candidate.pop();
-            if (result_handler.GetSize(0) == result_n && -minus_c_dist > result_handler.GetDistance0(0)) {
+            if (result_handler.GetSize(0) == result_n && -minus_c_dist > std::min(result_handler.GetDistance0(0), dist_bound)) {
                 break;
             }
 
@@ -181,6 +197,9 @@ private:
                 auto dist = distance_(query, data_store_.GetVec(n_idx), data_store_.vec_store_meta());
                 if (result_handler.GetSize(0) < result_n || dist < result_handler.GetDistance0(0)) {
                     candidate.emplace(-dist, n_idx);
+                    if (data_store_.IsDeleted(n_idx)) {
+                        continue;
+                    }
                     if constexpr (!std::is_same_v<Filter, NoneType>) {
                         if (filter(GetLabel(n_idx))) {
                             result_handler.AddResult(0, dist, n_idx);
@@ -192,7 +211,15 @@ private:
             }
         }
         result_handler.EndWithoutSort();
-        return {result_handler.GetSize(0), std::move(d_ptr), std::move(i_ptr)};
+        SizeT bound_n = 0;
+        for (SizeT i = 0; i < result_handler.GetSize(0); ++i) {
+            if (d_ptr[i] <= dist_bound) {
+                d_ptr[bound_n] = d_ptr[i];
+                i_ptr[bound_n] = i_ptr[i];
+                ++bound_n;
+            }
+        }
+        return {bound_n, std::move(d_ptr), std::move(i_ptr)};
     }
 
     template <bool WithLock>
@@ -285,8 +312,77 @@ private:
 
     LabelType GetLabel(VertexType vertex_i) const { return data_store_.GetLabel(vertex_i); }
 
+    // the labels are added in ascending order, they are the offsets of the rows in the segment
+    VertexType FindVertex(LabelType label) const {
+        VertexType cur_vec_num = data_store_.cur_vec_num();
+        VertexType lo = 0, hi = cur_vec_num;
+        while (lo < hi) {
+            VertexType mid = lo + (hi - lo) / 2;
+            if (GetLabel(mid) < label) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return (lo < cur_vec_num && GetLabel(lo) == label) ? lo : -1;
+    }
+
+    // Replace the edges from `vertex_i` to the deleted vertices in the layer by the live neighbors of those vertices, and prune them
+    // with the heuristic of the insertion. Only one vertex is locked at a time. Return false if there is no deleted neighbor, or no live
+    // vertex to take their place, in which case the edges are kept so that the deleted vertices still lead somewhere.
+    bool RepairNeighbors(VertexType vertex_i, i32 layer_i) {
+        Vector<VertexType> deleted_neighbors;
+        {
+            std::shared_lock<std::shared_mutex> lock = data_store_.SharedLock(vertex_i);
+            const auto [neighbors_p, neighbor_size] = data_store_.GetNeighbors(vertex_i, layer_i);
+            for (int i = 0; i < neighbor_size; ++i) {
+                if (data_store_.IsDeleted(neighbors_p[i])) {
+                    deleted_neighbors.push_back(neighbors_p[i]);
+                }
+            }
+        }
+        if (deleted_neighbors.empty()) {
+            return false;
+        }
+        Vector<VertexType> candidate_idx;
+        for (VertexType d_idx : deleted_neighbors) {
+            std::shared_lock<std::shared_mutex> lock = data_store_.SharedLock(d_idx);
+            const auto [d_neighbors_p, d_neighbor_size] = data_store_.GetNeighbors(d_idx, layer_i);
+            for (int i = 0; i < d_neighbor_size; ++i) {
+                VertexType n_idx = d_neighbors_p[i];
+                if (n_idx != vertex_i && !data_store_.IsDeleted(n_idx)) {
+                    candidate_idx.push_back(n_idx);
+                }
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> lock = data_store_.UniqueLock(vertex_i);
+        auto [neighbors_p, neighbor_size_p] = data_store_.GetNeighborsMut(vertex_i, layer_i);
+        for (int i = 0; i < *neighbor_size_p; ++i) {
+            if (!data_store_.IsDeleted(neighbors_p[i])) {
+                candidate_idx.push_back(neighbors_p[i]);
+            }
+        }
+        if (candidate_idx.empty()) {
+            return false;
+        }
+        std::sort(candidate_idx.begin(), candidate_idx.end());
+        candidate_idx.erase(std::unique(candidate_idx.begin(), candidate_idx.end()), candidate_idx.end());
+
+        StoreType v_data = data_store_.GetVec(vertex_i);
+        Vector<PDV> candidates;
+        candidates.reserve(candidate_idx.size());
+        for (VertexType n_idx : candidate_idx) {
+            candidates.emplace_back(distance_(v_data, data_store_.GetVec(n_idx), data_store_.vec_store_meta()), n_idx);
+        }
+        SizeT Mmax = layer_i == 0 ? data_store_.Mmax0() : data_store_.Mmax();
+        SelectNeighborsHeuristic(std::move(candidates), Mmax, neighbors_p, neighbor_size_p);
+        return true;
+    }
+
     template <bool WithLock, FilterConcept<LabelType> Filter = NoneType>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<VertexType[]>> KnnSearchInner(const QueryVecType &q, SizeT k, const Filter &filter) const {
+    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<VertexType[]>>
+    KnnSearchInner(const QueryVecType &q, SizeT k, const Filter &filter, DataType dist_bound = std::numeric_limits<DataType>::max()) const {
         QueryType query = data_store_.MakeQuery(q);
         auto [max_layer, ep] = data_store_.GetEnterPoint();
         if (ep == -1) {
@@ -295,7 +391,7 @@ private:
         for (i32 cur_layer = max_layer; cur_layer > 0; --cur_layer) {
             ep = SearchLayerNearest<WithLock>(ep, query, cur_layer);
         }
-        return SearchLayer<WithLock, Filter>(ep, query, 0, std::max(k, ef_), filter);
+        return SearchLayer<WithLock, Filter>(ep, query, 0, std::max(k, ef_), filter, dist_bound);
     }
 
 public:
@@ -340,14 +436,20 @@ public:
 
             const auto [q_neighbors_p, q_neighbor_size_p] = data_store_.GetNeighborsMut(vertex_i, cur_layer);
             SelectNeighborsHeuristic(std::move(search_result), M_, q_neighbors_p, q_neighbor_size_p);
+            if (*q_neighbor_size_p == 0) {
+                // only deleted vertices around, keep searching from the same enter point
+                continue;
+            }
             ep = q_neighbors_p[0];
             ConnectNeighbors(vertex_i, q_neighbors_p, *q_neighbor_size_p, cur_layer);
         }
     }
 
+    // `dist_bound` is the k-th distance already found elsewhere, e.g. in other segments, the search stops at it
     template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>> KnnSearch(const QueryVecType &q, SizeT k, const Filter &filter) const {
-        auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter>(q, k, filter);
+    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>>
+    KnnSearch(const QueryVecType &q, SizeT k, const Filter &filter, DataType dist_bound = std::numeric_limits<DataType>::max()) const {
+        auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter>(q, k, filter, dist_bound);
         auto labels = MakeUniqueForOverwrite<LabelType[]>(result_n);
         for (SizeT i = 0; i < result_n; ++i) {
             labels[i] = GetLabel(v_ptr[i]);
@@ -356,8 +458,9 @@ public:
     }
 
     template <bool WithLock = true>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>> KnnSearch(const QueryVecType &q, SizeT k) const {
-        return KnnSearch<NoneType, WithLock>(q, k, None);
+    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>>
+    KnnSearch(const QueryVecType &q, SizeT k, DataType dist_bound = std::numeric_limits<DataType>::max()) const {
+        return KnnSearch<NoneType, WithLock>(q, k, None, dist_bound);
     }
 
     // function for test, add sort for convenience
@@ -375,6 +478,92 @@ public:
     // function for test
     Vector<Pair<DataType, LabelType>> KnnSearchSorted(const QueryVecType &q, SizeT k) const { return KnnSearchSorted<NoneType>(q, k, None); }
 
+    // Tombstone the vertex of `label`. The vertex is still expanded by the searches but never returned, until Consolidate takes it out
+    // of the neighbor lists. Return false if the label isn't in the index or is deleted already.
+    bool MarkDeleted(LabelType label) {
+        VertexType vertex_i = FindVertex(label);
+        if (vertex_i < 0) {
+            return false;
+        }
+        return data_store_.MarkDeleted(vertex_i);
+    }
+
+    // Return true if every label of `labels` in the index is tombstoned, i.e. the deletes are consolidated already since the
+    // tombstones are saved with the graph. Read only, so it can run on a graph being searched.
+    bool AllDeleted(const Vector<LabelType> &labels) const {
+        for (LabelType label : labels) {
+            VertexType vertex_i = FindVertex(label);
+            if (vertex_i >= 0 && !data_store_.IsDeleted(vertex_i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // function for test, return true if a vertex not in `labels` has an edge to a vertex of `labels`. It reads every neighbor list.
+    bool HasEdgeTo(const Vector<LabelType> &labels) const {
+        VertexType cur_vec_num = data_store_.cur_vec_num();
+        Vector<bool> targets(cur_vec_num, false);
+        bool any_target = false;
+        for (LabelType label : labels) {
+            VertexType vertex_i = FindVertex(label);
+            if (vertex_i >= 0) {
+                targets[vertex_i] = true;
+                any_target = true;
+            }
+        }
+        if (!any_target) {
+            return false;
+        }
+        for (VertexType vertex_i = 0; vertex_i < cur_vec_num; ++vertex_i) {
+            if (targets[vertex_i]) {
+                continue;
+            }
+            std::shared_lock<std::shared_mutex> lock = data_store_.SharedLock(vertex_i);
+            i32 layer_n = data_store_.GetLayerNum(vertex_i);
+            for (i32 layer_i = 0; layer_i <= layer_n; ++layer_i) {
+                const auto [neighbors_p, neighbor_size] = data_store_.GetNeighbors(vertex_i, layer_i);
+                for (int i = 0; i < neighbor_size; ++i) {
+                    if (targets[neighbors_p[i]]) {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    // Consolidation as in FreshDiskANN: every live vertex pointing to a deleted one gets its neighbors repaired from the
+    // neighbors of the deleted one. The pass reads all neighbor lists, but only the vertices next to a delete compute distances, so
+    // the cost follows the number of deletes rather than the size of the index. The neighbor lists are rewritten while the searches
+    // without lock may read them, so a graph that is searched is copied and consolidated in the copy.
+    // Return the number of repaired neighbor lists.
+    SizeT Consolidate() {
+        if (data_store_.deleted_num() == 0) {
+            return 0;
+        }
+        SizeT repaired_n = 0;
+        VertexType cur_vec_num = data_store_.cur_vec_num();
+        for (VertexType vertex_i = 0; vertex_i < cur_vec_num; ++vertex_i) {
+            if (data_store_.IsDeleted(vertex_i)) {
+                continue;
+            }
+            i32 layer_n = 0;
+            {
+                std::shared_lock<std::shared_mutex> lock = data_store_.SharedLock(vertex_i);
+                layer_n = data_store_.GetLayerNum(vertex_i);
+            }
+            for (i32 layer_i = 0; layer_i <= layer_n; ++layer_i) {
+                if (RepairNeighbors(vertex_i, layer_i)) {
+                    ++repaired_n;
+                }
+            }
+        }
+        return repaired_n;
+    }
+
+    SizeT GetDeletedNum() const { return data_store_.deleted_num(); }
+
     void SetEf(SizeT ef) { ef_ = ef; }
 
     SizeT GetVertexNum() const { return data_store_.cur_vec_num(); }
@@ -0,0 +1,170 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include "header.h"
+#include <bit>
+#include <cstring>
+
+module maxsim_kernel;
+
+import stl;
+import hnsw_simd_func;
+import mlas_matrix_multiply;
+
+namespace infinity {
+
+namespace {
+
+using F32IPFuncT = float (*)(const float *, const float *, SizeT);
+using I8IPFuncT = i32 (*)(const i8 *, const i8 *, SizeT);
+
+F32IPFuncT GetF32IPFunc() {
+#if defined(USE_AVX512)
+    return F32IPAVX512Residual;
+#elif defined(USE_AVX)
+    return F32IPAVXResidual;
+#elif defined(USE_SSE)
+    return F32IPSSEResidual;
+#else
+    return F32IPBF;
+#endif
+}
+
+I8IPFuncT GetI8IPFunc() {
+#if defined(USE_AVX512)
+    return I8IPAVX512Residual;
+#elif defined(USE_AVX)
+    return I8IPAVXResidual;
+#elif defined(USE_SSE)
+    return I8IPSSEResidual;
+#else
+    return I8IPBF;
+#endif
+}
+
+u32 BitIP(const u8 *a, const u8 *b, const u32 bytes) {
+    u32 res = 0;
+    u32 i = 0;
+    for (; i + sizeof(u64) <= bytes; i += sizeof(u64)) {
+        u64 x, y;
+        std::memcpy(&x, a + i, sizeof(u64));
+        std::memcpy(&y, b + i, sizeof(u64));
+        res += std::popcount(x & y);
+    }
+    for (; i < bytes; ++i) {
+        res += std::popcount(static_cast<u32>(a[i] & b[i]));
+    }
+    return res;
+}
+
+u32 QueryTileSize(const SizeT embedding_bytes) {
+    const SizeT tile_size = MAXSIM_QUERY_TILE_BYTES / std::max<SizeT>(embedding_bytes, 1);
+    return static_cast<u32>(std::clamp<SizeT>(tile_size, 1, MAXSIM_MAX_QUERY_TILE));
+}
+
+template <typename ElemT, typename IPFunc>
+float MaxSimTiled(const ElemT *query,
+                  const ElemT *target,
+                  const u32 query_embedding_num,
+                  const u32 target_embedding_num,
+                  const u32 embedding_len,
+                  const SizeT embedding_bytes,
+                  IPFunc &&ip_func) {
+    const u32 tile_size = QueryTileSize(embedding_bytes);
+    Array<float, MAXSIM_MAX_QUERY_TILE> max_scores;
+    float maxsim_score = 0.0f;
+    for (u32 query_begin = 0; query_begin < query_embedding_num; query_begin += tile_size) {
+        const u32 query_end = std::min(query_begin + tile_size, query_embedding_num);
+        const u32 tile_num = query_end - query_begin;
+        std::fill_n(max_scores.begin(), tile_num, std::numeric_limits<float>::lowest());
+        for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
+            const ElemT *target_ptr = target + SizeT(target_j) * embedding_len;
+            for (u32 i = 0; i < tile_num; ++i) {
+                const ElemT *query_ptr = query + SizeT(query_begin + i) * embedding_len;
+                max_scores[i] = std::max(max_scores[i], static_cast<float>(ip_func(query_ptr, target_ptr, embedding_len)));
+            }
+        }
+        for (u32 i = 0; i < tile_num; ++i) {
+            maxsim_score += max_scores[i];
+        }
+    }
+    return maxsim_score;
+}
+
+float MaxSimF32GEMM(const float *query, const float *target, const u32 query_embedding_num, const u32 target_embedding_num, const u32 dimension) {
+    const u32 chunk_size = std::min(target_embedding_num, MAXSIM_GEMM_TARGET_CHUNK);
+    auto output_ptr = MakeUniqueForOverwrite<float[]>(SizeT(query_embedding_num) * chunk_size);
+    Vector<float> max_scores(query_embedding_num, std::numeric_limits<float>::lowest());
+    for (u32 target_begin = 0; target_begin < target_embedding_num; target_begin += chunk_size) {
+        const u32 target_num = std::min(chunk_size, target_embedding_num - target_begin);
+        matrixA_multiply_transpose_matrixB_output_to_C(query,
+                                                       target + SizeT(target_begin) * dimension,
+                                                       query_embedding_num,
+                                                       target_num,
+                                                       dimension,
+                                                       output_ptr.get());
+        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
+            const float *query_ip_ptr = output_ptr.get() + SizeT(query_i) * target_num;
+            float max_score_i = max_scores[query_i];
+            for (u32 k = 0; k < target_num; ++k) {
+                max_score_i = std::max(max_score_i, query_ip_ptr[k]);
+            }
+            max_scores[query_i] = max_score_i;
+        }
+    }
+    float maxsim_score = 0.0f;
+    for (const float max_score_i : max_scores) {
+        maxsim_score += max_score_i;
+    }
+    return maxsim_score;
+}
+
+} // namespace
+
+float MaxSimF32(const float *query, const float *target, const u32 query_embedding_num, const u32 target_embedding_num, const u32 dimension) {
+    if (query_embedding_num == 0 || target_embedding_num == 0) {
+        return 0.0f;
+    }
+    if (SizeT(query_embedding_num) * target_embedding_num >= MAXSIM_GEMM_MIN_PAIRS) {
+        return MaxSimF32GEMM(query, target, query_embedding_num, target_embedding_num, dimension);
+    }
+    const F32IPFuncT ip_func = GetF32IPFunc();
+    return MaxSimTiled(query, target, query_embedding_num, target_embedding_num, dimension, dimension * sizeof(float), ip_func);
+}
+
+float MaxSimI8(const i8 *query, const i8 *target, const u32 query_embedding_num, const u32 target_embedding_num, const u32 dimension) {
+    if (query_embedding_num == 0 || target_embedding_num == 0) {
+        return 0.0f;
+    }
+    const I8IPFuncT ip_func = GetI8IPFunc();
+    return MaxSimTiled(query, target, query_embedding_num, target_embedding_num, dimension, dimension * sizeof(i8), ip_func);
+}
+
+float MaxSimBit(const u8 *query, const u8 *target, const u32 query_embedding_num, const u32 target_embedding_num, const u32 dimension) {
+    if (query_embedding_num == 0 || target_embedding_num == 0) {
+        return 0.0f;
+    }
+    const u32 unit_embedding_bytes = dimension / 8;
+    return MaxSimTiled(query, target, query_embedding_num, target_embedding_num, unit_embedding_bytes, unit_embedding_bytes, BitIP);
+}
+
+void ExpandBitsToF32(const u8 *bits, const SizeT bit_num, float *output) {
+    for (SizeT k = 0; k < bit_num; ++k) {
+        output[k] = static_cast<float>((bits[k / 8] >> (k % 8)) & 1u);
+    }
+}
+
+} // namespace infinity
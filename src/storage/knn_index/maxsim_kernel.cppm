@@ -0,0 +1,45 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module maxsim_kernel;
+
+import stl;
+
+namespace infinity {
+
+// Late-interaction (ColBERT) MaxSim: score = sum over query tokens of the max inner product with any target token.
+// Small inputs use a kernel blocked over query tokens: a tile of query tokens stays in L1 while the target tokens
+// stream through it once. Large inputs go through one mlas GEMM per chunk of target tokens.
+
+// a tile of query tokens should not exceed this many bytes
+export constexpr SizeT MAXSIM_QUERY_TILE_BYTES = 16 * 1024;
+export constexpr u32 MAXSIM_MAX_QUERY_TILE = 32;
+// use GEMM when query_embedding_num * target_embedding_num reaches this
+export constexpr SizeT MAXSIM_GEMM_MIN_PAIRS = 1024;
+// target tokens per GEMM call, bounds the size of the temporary score matrix
+export constexpr u32 MAXSIM_GEMM_TARGET_CHUNK = 1024;
+
+export float MaxSimF32(const float *query, const float *target, u32 query_embedding_num, u32 target_embedding_num, u32 dimension);
+
+export float MaxSimI8(const i8 *query, const i8 *target, u32 query_embedding_num, u32 target_embedding_num, u32 dimension);
+
+// dimension is the number of bits of an embedding, bit k of an embedding is (ptr[k / 8] >> (k % 8)) & 1
+export float MaxSimBit(const u8 *query, const u8 *target, u32 query_embedding_num, u32 target_embedding_num, u32 dimension);
+
+// expand bit embeddings to 0.0f / 1.0f, so that mixed bit and numeric tensors can use MaxSimF32
+export void ExpandBitsToF32(const u8 *bits, SizeT bit_num, float *output);
+
+} // namespace infinity
@@ -32,15 +32,39 @@ public:
     virtual ~MergeKnnBase() = default;
 };
 
+export class KnnThresholdBase {
+public:
+    virtual ~KnnThresholdBase() = default;
+};
+
+// The best k-th distance published by the tasks of a knn scan, in the order of their merge heaps.
+// It's updated without lock, a task reads it to prune the candidates that can't enter the top-k of the whole scan.
+export template <typename DataType, template <typename, typename> typename C>
+class KnnThreshold final : public KnnThresholdBase {
+    using Compare = C<DataType, RowID>;
+
+public:
+    DataType Get() const { return threshold_.load(std::memory_order_relaxed); }
+
+    void Update(DataType threshold) {
+        DataType current = threshold_.load(std::memory_order_relaxed);
+        while (Compare::Compare(current, threshold) && !threshold_.compare_exchange_weak(current, threshold, std::memory_order_relaxed)) {
+        }
+    }
+
+private:
+    Atomic<DataType> threshold_{Compare::InitialValue()};
+};
+
 export template <typename DataType, template <typename, typename> typename C>
 class MergeKnn final : public MergeKnnBase {
-    using ResultHandler = ReservoirResultHandler<C<DataType, RowID>>;
+    using ResultHandler = HeapResultHandler<C<DataType, RowID>>;
     using DistFunc = DataType (*)(const DataType *, const DataType *, SizeT);
 
 public:
     explicit MergeKnn(u64 query_count, u64 topk)
         : total_count_(0), query_count_(query_count), topk_(topk), idx_array_(MakeUniqueForOverwrite<RowID[]>(topk * query_count)),
-          distance_array_(MakeUniqueForOverwrite<DataType[]>(topk * query_count)) {
+          distance_array_(MakeUniqueForOverwrite<DataType[]>(topk * query_count)), result_counts_(query_count) {
         result_handler_ = MakeUnique<ResultHandler>(query_count, topk, this->distance_array_.get(), this->idx_array_.get());
     }
 
@@ -71,6 +95,15 @@ public:
 
     i64 total_count() const { return total_count_; }
 
+    // number of results of the query after End()
+    i64 result_count(u64 query_id) const { return result_counts_[query_id]; }
+
+    // the k-th best distance of the query so far, no candidate worse than it can enter the top-k
+    DataType GetKthDistance(u64 query_id) const { return result_handler_->GetKthDistance(query_id); }
+
+    // drop the candidates of the query not better than `threshold`, which is reached by top-k results elsewhere
+    void UpdateThreshold(u64 query_id, DataType threshold) { result_handler_->UpdateThreshold(query_id, threshold); }
+
 private:
     i64 total_count_{};
     bool begin_{false};
@@ -78,6 +111,7 @@ private:
     i64 topk_{};
     UniquePtr<RowID[]> idx_array_{};
     UniquePtr<DataType[]> distance_array_{};
+    Vector<i64> result_counts_{};
 
 private:
     UniquePtr<ResultHandler> result_handler_{};
@@ -162,6 +196,10 @@ void MergeKnn<DataType, C>::End() {
     if (!this->begin_)
         return;
 
+    // the heap is emptied by End()
+    for (u64 i = 0; i < this->query_count_; ++i) {
+        result_counts_[i] = result_handler_->GetSize(i);
+    }
     result_handler_->End();
 
     this->begin_ = false;
@@ -172,6 +210,9 @@ void MergeKnn<DataType, C>::EndWithoutSort() {
     if (!this->begin_)
         return;
 
+    for (u64 i = 0; i < this->query_count_; ++i) {
+        result_counts_[i] = result_handler_->GetSize(i);
+    }
     result_handler_->EndWithoutSort();
 
     this->begin_ = false;
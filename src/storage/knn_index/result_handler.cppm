@@ -95,10 +95,12 @@ class HeapResultHandler : public ResultHandlerBase {
     DistType *distance_ptr = nullptr;
     ID *id_ptr = nullptr;
     Vector<u32> sizes;
+    Vector<DistType> thresholds;
 
 public:
     explicit HeapResultHandler(SizeT n_queries, SizeT top_k, DistType *distance, ID *id)
-        : ResultHandlerBase(ResultHandlerType::kHeap), n_queries(n_queries), top_k(top_k), distance_ptr(distance), id_ptr(id), sizes(n_queries) {}
+        : ResultHandlerBase(ResultHandlerType::kHeap), n_queries(n_queries), top_k(top_k), distance_ptr(distance), id_ptr(id), sizes(n_queries),
+          thresholds(n_queries, Compare::InitialValue()) {}
 
     ~HeapResultHandler() = default;
 
@@ -112,9 +114,25 @@ public:
 
     [[nodiscard]] u32 GetSize(SizeT q_id) const { return sizes[q_id]; }
 
-    void ReInitialize() { std::fill(sizes.begin(), sizes.end(), 0); }
+    void ReInitialize() {
+        std::fill(sizes.begin(), sizes.end(), 0);
+        std::fill(thresholds.begin(), thresholds.end(), Compare::InitialValue());
+    }
+
+    // a distance known to be reached by top_k results elsewhere, candidates not better than it are dropped
+    void UpdateThreshold(SizeT q_id, DistType threshold) {
+        if (Compare::Compare(thresholds[q_id], threshold)) {
+            thresholds[q_id] = threshold;
+        }
+    }
+
+    // the k-th best distance added so far, which is the heap top, or the threshold if there are less than top_k results
+    [[nodiscard]] DistType GetKthDistance(SizeT q_id) const { return sizes[q_id] < top_k ? thresholds[q_id] : distance_ptr[q_id * top_k]; }
 
     void AddResult(SizeT q_id, DistType d, ID i) {
+        if (!Compare::Compare(thresholds[q_id], d)) {
+            return;
+        }
         u32 &size = sizes[q_id];
         auto distance = distance_ptr + q_id * top_k - 1;
         auto id = id_ptr + q_id * top_k - 1;
@@ -24,18 +24,25 @@ import third_party;
 import knn_result_handler;
 import serialize;
 import segment_iter;
+import resource_manager;
 
 namespace infinity {
 
 template <typename DataType, BMPCompressType CompressType>
 template <typename IdxType>
-void BMPIvt<DataType, CompressType>::AddBlock(BMPBlockID block_id, const Vector<Vector<Pair<IdxType, DataType>>> &tail_terms) {
+Vector<Pair<IdxType, DataType>> BMPIvt<DataType, CompressType>::BlockMaxScores(const Vector<Vector<Pair<IdxType, DataType>>> &tail_terms) {
     HashMap<IdxType, DataType> max_scores;
     for (const auto &terms : tail_terms) {
         for (const auto &[term_id, score] : terms) {
             max_scores[term_id] = std::max(max_scores[term_id], score);
         }
     }
+    return Vector<Pair<IdxType, DataType>>(max_scores.begin(), max_scores.end());
+}
+
+template <typename DataType, BMPCompressType CompressType>
+template <typename IdxType>
+void BMPIvt<DataType, CompressType>::AddBlock(BMPBlockID block_id, const Vector<Pair<IdxType, DataType>> &max_scores) {
     for (const auto &[term_id, score] : max_scores) {
         postings_[term_id].data_.AddBlock(block_id, score);
     }
@@ -134,16 +141,27 @@ template class TailFwd<f64, i8>;
 
 template <typename DataType, typename IdxType>
 Optional<TailFwd<DataType, IdxType>> BlockFwd<DataType, IdxType>::AddDoc(const SparseVecRef<DataType, IdxType> &doc) {
+    Optional<TailFwd<DataType, IdxType>> tail_fwd1 = AddDocToTail(doc);
+    if (tail_fwd1.has_value()) {
+        AddBlock(tail_fwd1->ToBlockFwd());
+    }
+    return tail_fwd1;
+}
+
+template <typename DataType, typename IdxType>
+Optional<TailFwd<DataType, IdxType>> BlockFwd<DataType, IdxType>::AddDocToTail(const SparseVecRef<DataType, IdxType> &doc) {
     SizeT tail_size = tail_fwd_.AddDoc(doc);
     if (tail_size < block_size_) {
         return None;
     }
     TailFwd<DataType, IdxType> tail_fwd1;
     std::swap(tail_fwd1, tail_fwd_);
+    return tail_fwd1;
+}
 
-    Vector<Tuple<IdxType, Vector<BMPBlockOffset>, Vector<DataType>>> block_terms = tail_fwd1.ToBlockFwd();
+template <typename DataType, typename IdxType>
+void BlockFwd<DataType, IdxType>::AddBlock(Vector<Tuple<IdxType, Vector<BMPBlockOffset>, Vector<DataType>>> block_terms) {
     block_terms_.emplace_back(std::move(block_terms));
-    return tail_fwd1;
 }
 
 template <typename DataType, typename IdxType>
@@ -160,9 +178,9 @@ Vector<Vector<DataType>> BlockFwd<DataType, IdxType>::GetIvtScores(SizeT term_nu
 }
 
 template <typename DataType, typename IdxType>
-Vector<DataType> BlockFwd<DataType, IdxType>::GetScores(BMPBlockID block_id, const SparseVecRef<DataType, IdxType> &query) const {
+void BlockFwd<DataType, IdxType>::GetScores(BMPBlockID block_id, const SparseVecRef<DataType, IdxType> &query, Vector<DataType> &res) const {
     const auto &block_terms = block_terms_[block_id];
-    Vector<DataType> res(block_size_, 0.0);
+    res.assign(block_size_, 0.0);
     SizeT j = 0;
     for (i32 i = 0; i < query.nnz_; ++i) {
         IdxType query_term = query.indices_[i];
@@ -178,7 +196,6 @@ Vector<DataType> BlockFwd<DataType, IdxType>::GetScores(BMPBlockID block_id, con
             BlockFwd::Calculate(block_offsets, scores, res, query_score);
         }
     }
-    return res;
 }
 
 template <typename DataType, typename IdxType>
@@ -214,7 +231,27 @@ void BMPAlg<DataType, IdxType, CompressType>::AddDoc(const SparseVecRef<DataType
     }
     BMPBlockID block_id = block_fwd_.block_num() - 1;
     const auto &tail_terms = tail_fwd->GetTailTerms();
-    bm_ivt_.AddBlock(block_id, tail_terms);
+    bm_ivt_.AddBlock(block_id, BMPIvt<DataType, CompressType>::BlockMaxScores(tail_terms));
+}
+
+template <typename DataType, typename IdxType, BMPCompressType CompressType>
+void BMPAlg<DataType, IdxType, CompressType>::AddBlocks(Vector<TailFwd<DataType, IdxType>> tail_fwds) {
+    constexpr SizeT blocks_per_task = 16;
+    SizeT block_num = tail_fwds.size();
+    Vector<Vector<Tuple<IdxType, Vector<BMPBlockOffset>, Vector<DataType>>>> block_terms(block_num);
+    Vector<Vector<Pair<IdxType, DataType>>> max_scores(block_num);
+    SharedParallelFor(TaskClass::kIngest, (block_num + blocks_per_task - 1) / blocks_per_task, [&](SizeT task_idx) {
+        SizeT end = std::min((task_idx + 1) * blocks_per_task, block_num);
+        for (SizeT i = task_idx * blocks_per_task; i < end; ++i) {
+            block_terms[i] = tail_fwds[i].ToBlockFwd();
+            max_scores[i] = BMPIvt<DataType, CompressType>::BlockMaxScores(tail_fwds[i].GetTailTerms());
+        }
+    });
+    for (SizeT i = 0; i < block_num; ++i) {
+        BMPBlockID block_id = block_fwd_.block_num();
+        block_fwd_.AddBlock(std::move(block_terms[i]));
+        bm_ivt_.AddBlock(block_id, max_scores[i]);
+    }
 }
 
 template <typename DataType, typename IdxType, BMPCompressType CompressType>
@@ -247,14 +284,24 @@ BMPAlg<DataType, IdxType, CompressType>::SearchKnn(const SparseVecRef<DataType,
     const auto &postings = bm_ivt_.GetPostings();
     DataType threshold = 0.0;
     SizeT block_num = block_fwd_.block_num();
-    Vector<DataType> upper_bounds(block_num, 0.0);
     for (i32 i = 0; i < query_ref.nnz_; ++i) {
         IdxType query_term = query_ref.indices_[i];
         DataType query_score = query_ref.data_[i];
-        const auto &posting = postings[query_term];
-        threshold = std::max(threshold, query_score * posting.kth(topk));
-        posting.data_.Calculate(upper_bounds, query_score);
+        threshold = std::max(threshold, query_score * postings[query_term].kth(topk));
     }
+    // The upper bounds from the quantized max scores. A large index splits the blocks to ranges, and sums the upper bounds
+    // of the ranges in parallel.
+    constexpr SizeT blocks_per_task = 16384;
+    Vector<DataType> upper_bounds(block_num, 0.0);
+    SharedParallelFor(TaskClass::kQuery, (block_num + blocks_per_task - 1) / blocks_per_task, [&](SizeT task_idx) {
+        auto begin = static_cast<BMPBlockID>(task_idx * blocks_per_task);
+        auto end = static_cast<BMPBlockID>(std::min((task_idx + 1) * blocks_per_task, block_num));
+        for (i32 i = 0; i < query_ref.nnz_; ++i) {
+            IdxType query_term = query_ref.indices_[i];
+            DataType query_score = query_ref.data_[i];
+            postings[query_term].data_.Calculate(upper_bounds, query_score, begin, end);
+        }
+    });
 
     Vector<Pair<DataType, BMPBlockID>> block_scores;
     for (SizeT block_id = 0; block_id < block_num; ++block_id) {
@@ -269,6 +316,7 @@ BMPAlg<DataType, IdxType, CompressType>::SearchKnn(const SparseVecRef<DataType,
     HeapResultHandler<CompareMin<DataType, BMPDocID>> result_handler(1 /*query_n*/, topk, result_score.data(), result.data());
 
     SizeT block_scores_num = block_scores.size();
+    Vector<DataType> scores;
     for (SizeT i = 0; i < block_scores_num; ++i) {
         if (i + 1 < block_scores_num) {
             BMPBlockID next_block_id = block_scores[i + 1].second;
@@ -276,7 +324,7 @@ BMPAlg<DataType, IdxType, CompressType>::SearchKnn(const SparseVecRef<DataType,
         }
         const auto &[ub_score, block_id] = block_scores[i];
         BMPDocID off = block_id * block_size;
-        Vector<DataType> scores = block_fwd_.GetScores(block_id, query_ref);
+        block_fwd_.GetScores(block_id, query_ref, scores);
         for (SizeT block_off = 0; block_off < scores.size(); ++block_off) {
             BMPDocID doc_id = off + block_off;
             DataType score = scores[block_off];
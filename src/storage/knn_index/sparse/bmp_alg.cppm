@@ -33,8 +33,12 @@ private:
 public:
     BMPIvt(SizeT term_num) : postings_(term_num) {}
 
+    // the max score of each term in the docs of a block
     template <typename IdxType>
-    void AddBlock(BMPBlockID block_id, const Vector<Vector<Pair<IdxType, DataType>>> &tail_terms);
+    static Vector<Pair<IdxType, DataType>> BlockMaxScores(const Vector<Vector<Pair<IdxType, DataType>>> &tail_terms);
+
+    template <typename IdxType>
+    void AddBlock(BMPBlockID block_id, const Vector<Pair<IdxType, DataType>> &max_scores);
 
     void Optimize(i32 topk, Vector<Vector<DataType>> ivt_scores);
 
@@ -87,9 +91,15 @@ public:
 
     Optional<TailFwd<DataType, IdxType>> AddDoc(const SparseVecRef<DataType, IdxType> &doc);
 
+    // add the doc to the tail, and take the tail out once it's full, for the caller to build the block by AddBlock
+    Optional<TailFwd<DataType, IdxType>> AddDocToTail(const SparseVecRef<DataType, IdxType> &doc);
+
+    void AddBlock(Vector<Tuple<IdxType, Vector<BMPBlockOffset>, Vector<DataType>>> block_terms);
+
     Vector<Vector<DataType>> GetIvtScores(SizeT term_num) const;
 
-    Vector<DataType> GetScores(BMPBlockID block_id, const SparseVecRef<DataType, IdxType> &query) const;
+    // the scores of the docs of the block into res, which is reused from block to block
+    void GetScores(BMPBlockID block_id, const SparseVecRef<DataType, IdxType> &query, Vector<DataType> &res) const;
 
     Vector<DataType> GetScoresTail(const SparseVecRef<DataType, IdxType> &query) const { return tail_fwd_.GetScores(query); }
 
@@ -139,12 +149,18 @@ public:
     static BMPAlg<DataType, IdxType, CompressType> Load(FileHandler &file_handler);
 
 private:
+    // build the blocks of the full tails in parallel, and append them in order
+    void AddBlocks(Vector<TailFwd<DataType, IdxType>> tail_fwds);
+
     SizeT GetSizeInBytes() const;
 
     void WriteAdv(char *&p) const;
 
     static BMPAlg<DataType, IdxType, CompressType> ReadAdv(char *&p);
 
+    // the full tails AddDocs collects before building them as blocks
+    static constexpr SizeT add_block_batch_ = 256;
+
 private:
     BMPIvt<DataType, CompressType> bm_ivt_;
     BlockFwd<DataType, IdxType> block_fwd_;
@@ -155,15 +171,24 @@ template <typename DataType, typename IdxType, BMPCompressType CompressType>
 template <DataIteratorConcept<SparseVecRef<DataType, IdxType>, BMPDocID> Iterator>
 SizeT BMPAlg<DataType, IdxType, CompressType>::AddDocs(Iterator iter) {
     SizeT cnt = 0;
+    Vector<TailFwd<DataType, IdxType>> tail_fwds;
     while (true) {
         auto ret = iter.Next();
         if (!ret.has_value()) {
             break;
         }
         const auto &[sparse_ref, doc_id] = *ret;
-        AddDoc(sparse_ref, doc_id);
+        doc_ids_.push_back(doc_id);
+        if (Optional<TailFwd<DataType, IdxType>> tail_fwd = block_fwd_.AddDocToTail(sparse_ref); tail_fwd.has_value()) {
+            tail_fwds.push_back(std::move(*tail_fwd));
+            if (tail_fwds.size() == add_block_batch_) {
+                AddBlocks(std::move(tail_fwds));
+                tail_fwds.clear();
+            }
+        }
         ++cnt;
     }
+    AddBlocks(std::move(tail_fwds));
     return cnt;
 }
 
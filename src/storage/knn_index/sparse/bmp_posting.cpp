@@ -14,6 +14,8 @@
 
 module;
 
+#include <cmath>
+
 module bm_posting;
 
 import stl;
@@ -22,13 +24,74 @@ import infinity_exception;
 
 namespace infinity {
 
+// the scale covers this times the max score when it grows, so a term with rising scores is quantized again only a few times
+constexpr f64 quant_scale_headroom = 1.25;
+
+template <typename DataType>
+u8 BlockQuantScores<DataType>::Add(DataType max_score, const Vector<DataType> &max_scores, Vector<u8> &quant_scores) {
+    if (max_score > scale_ * std::numeric_limits<u8>::max()) {
+        scale_ = max_score * quant_scale_headroom / std::numeric_limits<u8>::max();
+        for (SizeT i = 0; i < quant_scores.size(); ++i) {
+            quant_scores[i] = Quantize(max_scores[i]);
+        }
+    }
+    return Quantize(max_score);
+}
+
+template <typename DataType>
+void BlockQuantScores<DataType>::Build(const Vector<DataType> &max_scores, Vector<u8> &quant_scores) {
+    DataType max_score = max_scores.empty() ? 0 : *std::max_element(max_scores.begin(), max_scores.end());
+    scale_ = max_score > 0 ? max_score / std::numeric_limits<u8>::max() : 0;
+    quant_scores.resize(max_scores.size());
+    for (SizeT i = 0; i < max_scores.size(); ++i) {
+        quant_scores[i] = Quantize(max_scores[i]);
+    }
+}
+
+template <typename DataType>
+u8 BlockQuantScores<DataType>::Quantize(DataType max_score) const {
+    if (max_score <= 0 || scale_ <= 0) {
+        return 0;
+    }
+    DataType quant_score = std::ceil(max_score / scale_);
+    return quant_score >= std::numeric_limits<u8>::max() ? std::numeric_limits<u8>::max() : static_cast<u8>(quant_score);
+}
+
+template class BlockQuantScores<f32>;
+template class BlockQuantScores<f64>;
+
 template <typename DataType>
 void BlockData<DataType, BMPCompressType::kCompressed>::Calculate(Vector<DataType> &upper_bounds, DataType query_score) const {
-    // MultiF32StoreI32(block_ids_.data(), max_scores_.data(), upper_bounds.data(), query_score, block_ids_.size());
+    if (query_score < 0) {
+        // the rounded up scores would lower the upper bounds of a negative query weight, use the exact ones
+        for (SizeT i = 0; i < block_ids_.size(); ++i) {
+            upper_bounds[block_ids_[i]] += max_scores_[i] * query_score;
+        }
+        return;
+    }
+    DataType quant_query_score = query_score * quant_.scale();
     for (SizeT i = 0; i < block_ids_.size(); ++i) {
         BMPBlockID block_id = block_ids_[i];
-        DataType score = max_scores_[i];
-        upper_bounds[block_id] += score * query_score;
+        upper_bounds[block_id] += quant_scores_[i] * quant_query_score;
+    }
+}
+
+template <typename DataType>
+void BlockData<DataType, BMPCompressType::kCompressed>::Calculate(Vector<DataType> &upper_bounds,
+                                                                  DataType query_score,
+                                                                  BMPBlockID begin,
+                                                                  BMPBlockID end) const {
+    SizeT i = std::lower_bound(block_ids_.begin(), block_ids_.end(), begin) - block_ids_.begin();
+    if (query_score < 0) {
+        for (; i < block_ids_.size() && block_ids_[i] < end; ++i) {
+            upper_bounds[block_ids_[i]] += max_scores_[i] * query_score;
+        }
+        return;
+    }
+    DataType quant_query_score = query_score * quant_.scale();
+    for (; i < block_ids_.size() && block_ids_[i] < end; ++i) {
+        BMPBlockID block_id = block_ids_[i];
+        upper_bounds[block_id] += quant_scores_[i] * quant_query_score;
     }
 }
 
@@ -36,6 +99,8 @@ template <typename DataType>
 void BlockData<DataType, BMPCompressType::kCompressed>::AddBlock(BMPBlockID block_id, DataType max_score) {
     block_ids_.push_back(block_id);
     max_scores_.push_back(max_score);
+    u8 quant_score = quant_.Add(max_score, max_scores_, quant_scores_);
+    quant_scores_.push_back(quant_score);
 }
 
 template struct BlockData<f32, BMPCompressType::kCompressed>;
@@ -43,9 +108,34 @@ template struct BlockData<f64, BMPCompressType::kCompressed>;
 
 template <typename DataType>
 void BlockData<DataType, BMPCompressType::kRaw>::Calculate(Vector<DataType> &upper_bounds, DataType query_score) const {
-    for (BMPBlockID block_id = 0; block_id < (BMPBlockID)max_scores_.size(); ++block_id) {
-        if (max_scores_[block_id] > 0.0) {
-            upper_bounds[block_id] += max_scores_[block_id] * query_score;
+    Calculate(upper_bounds, query_score, 0, (BMPBlockID)quant_scores_.size());
+}
+
+template <typename DataType>
+void BlockData<DataType, BMPCompressType::kRaw>::Calculate(Vector<DataType> &upper_bounds,
+                                                           DataType query_score,
+                                                           BMPBlockID begin,
+                                                           BMPBlockID end) const {
+    // the scores of the blocks without the term are 0, so the whole range is added without a branch
+    end = std::min(end, (BMPBlockID)quant_scores_.size());
+    if (begin >= end) {
+        return;
+    }
+    if (query_score < 0) {
+        // the rounded up scores would lower the upper bounds of a negative query weight, use the exact ones
+        for (BMPBlockID block_id = begin; block_id < end; ++block_id) {
+            if (max_scores_[block_id] > 0.0) {
+                upper_bounds[block_id] += max_scores_[block_id] * query_score;
+            }
+        }
+        return;
+    }
+    DataType quant_query_score = query_score * quant_.scale();
+    if constexpr (std::is_same_v<DataType, f32>) {
+        U8ScaleAddF32(quant_scores_.data() + begin, quant_query_score, upper_bounds.data() + begin, end - begin);
+    } else {
+        for (BMPBlockID block_id = begin; block_id < end; ++block_id) {
+            upper_bounds[block_id] += quant_scores_[block_id] * quant_query_score;
         }
     }
 }
@@ -54,8 +144,10 @@ template <typename DataType>
 void BlockData<DataType, BMPCompressType::kRaw>::AddBlock(BMPBlockID block_id, DataType max_score) {
     if (block_id >= (BMPBlockID)max_scores_.size()) {
         max_scores_.resize(block_id + 1, 0.0);
+        quant_scores_.resize(block_id + 1, 0);
     }
     max_scores_[block_id] = max_score;
+    quant_scores_[block_id] = quant_.Add(max_score, max_scores_, quant_scores_);
 }
 
 template struct BlockData<f32, BMPCompressType::kRaw>;
@@ -24,11 +24,35 @@ namespace infinity {
 export template <typename DataType, BMPCompressType CompressType>
 struct BlockData {};
 
+// The max scores of a term are also kept quantized to u8 by a scale of the term, rounded up, so that the upper bounds
+// summed from them never fall below the exact ones and prune no block the exact ones keep. Rounding up would lower the
+// bounds of a negative query weight, so those are summed from the exact scores. The quantized scores are not saved,
+// they are built again from the exact ones on load.
+export template <typename DataType>
+class BlockQuantScores {
+public:
+    // quantize the max score of a new block, the scale grows with headroom when the score exceeds it
+    u8 Add(DataType max_score, const Vector<DataType> &max_scores, Vector<u8> &quant_scores);
+
+    // quantize all the scores by the tightest scale
+    void Build(const Vector<DataType> &max_scores, Vector<u8> &quant_scores);
+
+    DataType scale() const { return scale_; }
+
+private:
+    u8 Quantize(DataType max_score) const;
+
+    DataType scale_{};
+};
+
 template <typename DataType>
 struct BlockData<DataType, BMPCompressType::kCompressed> {
 public:
     void Calculate(Vector<DataType> &upper_bounds, DataType query_score) const;
 
+    // add the upper bounds of the blocks in [begin, end)
+    void Calculate(Vector<DataType> &upper_bounds, DataType query_score, BMPBlockID begin, BMPBlockID end) const;
+
     void AddBlock(BMPBlockID block_id, DataType max_score);
 
     SizeT GetSizeInBytes() const;
@@ -38,14 +62,18 @@ public:
 private:
     Vector<BMPBlockID> block_ids_;
     Vector<DataType> max_scores_;
+    Vector<u8> quant_scores_;
+    BlockQuantScores<DataType> quant_;
 };
 
 export template <typename DataType>
 struct BlockData<DataType, BMPCompressType::kRaw> {
 public:
-    // template <bool UseSIMD = false>
     void Calculate(Vector<DataType> &upper_bounds, DataType query_score) const;
 
+    // add the upper bounds of the blocks in [begin, end)
+    void Calculate(Vector<DataType> &upper_bounds, DataType query_score, BMPBlockID begin, BMPBlockID end) const;
+
     void AddBlock(BMPBlockID block_id, DataType max_score);
 
     SizeT GetSizeInBytes() const;
@@ -54,6 +82,10 @@ public:
 
 public:
     Vector<DataType> max_scores_;
+    Vector<u8> quant_scores_;
+
+private:
+    BlockQuantScores<DataType> quant_;
 };
 
 export template <typename DataType, BMPCompressType CompressType>
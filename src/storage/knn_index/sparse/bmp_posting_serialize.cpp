@@ -48,6 +48,7 @@ BlockData<DataType, BMPCompressType::kCompressed> BlockData<DataType, BMPCompres
     for (SizeT i = 0; i < max_score_size; ++i) {
         res.max_scores_[i] = ReadBufAdv<DataType>(p);
     }
+    res.quant_.Build(res.max_scores_, res.quant_scores_);
     return res;
 }
 
@@ -76,6 +77,7 @@ BlockData<DataType, BMPCompressType::kRaw> BlockData<DataType, BMPCompressType::
     for (SizeT i = 0; i < max_score_size; ++i) {
         res.max_scores_[i] = ReadBufAdv<DataType>(p);
     }
+    res.quant_.Build(res.max_scores_, res.quant_scores_);
     return res;
 }
 
@@ -107,6 +107,41 @@ export void MultiF32StoreI32(const int32_t *idx, const float *data, float *dest,
     }
 }
 
+#if defined(USE_AVX)
+void U8ScaleAddF32AVX(const uint8_t *src, float scale, float *dest, size_t dim) {
+    const uint8_t *src_end = src + (dim & ~7);
+    __m256 vscale = _mm256_set1_ps(scale);
+    while (src < src_end) {
+        __m256 vsrc = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)src)));
+        _mm256_storeu_ps(dest, _mm256_fmadd_ps(vsrc, vscale, _mm256_loadu_ps(dest)));
+        src += 8;
+        dest += 8;
+    }
+}
+#endif
+
+void U8ScaleAddF32BF(const uint8_t *src, float scale, float *dest, size_t dim) {
+    for (size_t i = 0; i < dim; ++i) {
+        dest[i] += src[i] * scale;
+    }
+}
+
+// for every src[i], multiple with scale and add to dest[i]
+export void U8ScaleAddF32(const uint8_t *src, float scale, float *dest, size_t dim) {
+#if defined(USE_AVX)
+    if (dim >= 8) {
+        U8ScaleAddF32AVX(src, scale, dest, dim);
+        size_t step = dim & ~7;
+        src += step;
+        dest += step;
+        dim &= 7;
+    }
+#endif
+    if (dim > 0) {
+        U8ScaleAddF32BF(src, scale, dest, dim);
+    }
+}
+
 #if defined(USE_AVX)
 
 void MultiF32StoreI8AVX(const int8_t *idx, const float *data, float *dest, float x, size_t dim) {
@@ -54,6 +54,7 @@ import block_column_entry;
 import segment_index_entry;
 import chunk_index_entry;
 import log_file;
+import resource_manager;
 
 namespace infinity {
 
@@ -68,23 +69,23 @@ void ProfileHistory::Resize(SizeT new_size) {
         return;
     }
 
-    if (new_size < deque_.size()) {
-        SizeT diff = max_size_ - new_size;
-        for (SizeT i = 0; i < diff; ++i) {
-            deque_.pop_back();
-        }
+    while (new_size < deque_.size()) {
+        deque_.pop_back();
     }
 
     max_size_ = new_size;
 }
 
-QueryProfiler *ProfileHistory::GetElement(SizeT index) {
+SharedPtr<QueryProfiler> ProfileHistory::GetElement(u64 profile_id) {
     std::unique_lock<std::mutex> lk(lock_);
-    if (index < 0 || index > max_size_) {
+    if (deque_.empty() || profile_id > deque_.front()->profile_id()) {
         return nullptr;
     }
-
-    return deque_[index].get();
+    SizeT index = deque_.front()->profile_id() - profile_id;
+    if (index >= deque_.size()) {
+        return nullptr;
+    }
+    return deque_[index];
 }
 
 Vector<SharedPtr<QueryProfiler>> ProfileHistory::GetElements() {
@@ -1094,13 +1095,23 @@ void Catalog::MemIndexCommitLoop() {
 }
 
 void Catalog::MemIndexRecover(BufferManager *buffer_manager) {
-    auto db_meta_map_guard = db_meta_map_.GetMetaMap();
-    for (auto &[_, db_meta] : *db_meta_map_guard) {
-        auto [db_entry, status] = db_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
-        if (status.ok()) {
-            db_entry->MemIndexRecover(buffer_manager);
+    Vector<TableEntry *> table_entries;
+    {
+        auto db_meta_map_guard = db_meta_map_.GetMetaMap();
+        for (auto &[_, db_meta] : *db_meta_map_guard) {
+            auto [db_entry, status] = db_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
+            if (status.ok()) {
+                db_entry->MemIndexRecoverTables(table_entries);
+            }
         }
     }
+    if (table_entries.empty()) {
+        return;
+    }
+
+    // Memory indexes of different tables are independent, rebuild them concurrently.
+    SharedParallelFor(TaskClass::kIngest, table_entries.size(), [&](SizeT table_idx) { table_entries[table_idx]->MemIndexRecover(buffer_manager); });
+    LOG_INFO(fmt::format("MemIndex recovered for {} tables", table_entries.size()));
 }
 
 void Catalog::StartMemoryIndexCommit() {
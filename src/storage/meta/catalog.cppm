@@ -43,6 +43,7 @@ import column_def;
 import meta_entry_interface;
 import cleanup_scanner;
 import log_file;
+import common_query_filter_cache;
 
 namespace infinity {
 
@@ -51,8 +52,10 @@ class Txn;
 class ProfileHistory {
 private:
     mutable std::mutex lock_{};
+    // the newest first, their ids descend by one
     Deque<SharedPtr<QueryProfiler>> deque_{};
     SizeT max_size_{};
+    u64 next_profile_id_{};
 
 public:
     explicit ProfileHistory(SizeT size) {
@@ -69,14 +72,19 @@ public:
 
     void Enqueue(SharedPtr<QueryProfiler> &&profiler) {
         std::unique_lock<std::mutex> lk(lock_);
+        if (max_size_ == 0) {
+            return;
+        }
         if(deque_.size() >= max_size_) {
             deque_.pop_back();
         }
 
+        profiler->set_profile_id(next_profile_id_++);
         deque_.emplace_front(profiler);
     }
 
-    QueryProfiler *GetElement(SizeT index);
+    // nullptr if the profile has been dropped
+    SharedPtr<QueryProfiler> GetElement(u64 profile_id);
 
     Vector<SharedPtr<QueryProfiler>> GetElements();
 
@@ -250,7 +258,8 @@ public:
 
     void AppendProfileRecord(SharedPtr<QueryProfiler> profiler) { history_.Enqueue(std::move(profiler)); }
 
-    const QueryProfiler *GetProfileRecord(SizeT index) { return history_.GetElement(index); }
+    // the profile of the id shown by SHOW PROFILES
+    SharedPtr<QueryProfiler> GetProfileRecord(u64 profile_id) { return history_.GetElement(profile_id); }
 
     const Vector<SharedPtr<QueryProfiler>> GetProfileRecords() { return history_.GetElements(); }
 
@@ -288,6 +297,13 @@ public:
 
     ProfileHistory history_{DEFAULT_PROFILER_HISTORY_SIZE};
 
+    // per-segment filter results shared between queries
+    CommonQueryFilterCache filter_cache_{DEFAULT_QUERY_FILTER_CACHE_SIZE};
+
+    // commit ts of the last transaction that created, dropped or altered a database, table or index, set when it starts committing
+    // plans bound before it may refer to stale catalog entries
+    atomic_u64 schema_version_{0};
+
 private: // TODO: remove this
     std::shared_mutex &rw_locker() { return db_meta_map_.rw_locker_; }
 
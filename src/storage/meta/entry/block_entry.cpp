@@ -134,28 +134,61 @@ SizeT BlockEntry::row_count(TxnTimeStamp check_ts) const {
 }
 
 Pair<BlockOffset, BlockOffset> BlockEntry::GetVisibleRange(TxnTimeStamp begin_ts, u16 block_offset_begin) const {
+    Vector<u64> visible;
+    BlockOffset block_offset_end = GetVisibleMask(begin_ts, visible);
+    return GetVisibleRange(visible, block_offset_end, block_offset_begin);
+}
+
+BlockOffset BlockEntry::GetVisibleMask(TxnTimeStamp begin_ts, Vector<u64> &visible) const {
+    visible.clear();
+    TxnTimeStamp segment_first_delete_ts = SegmentFirstDeleteTS();
     std::shared_lock lock(rw_locker_);
+    if (FullyVisibleNoLock(begin_ts, segment_first_delete_ts)) {
+        return row_count_;
+    }
     begin_ts = std::min(begin_ts, this->max_row_ts_);
 
     auto block_version_handle = this->block_version_->Load();
     const auto *block_version = reinterpret_cast<const BlockVersion *>(block_version_handle.GetData());
 
-    auto &deleted = block_version->deleted_;
-    BlockOffset block_offset_end = block_version->GetRowCount(begin_ts);
-    while (block_offset_begin < block_offset_end && deleted[block_offset_begin] != 0 && deleted[block_offset_begin] <= begin_ts) {
-        block_offset_begin++;
+    BlockOffset row_count = block_version->GetRowCount(begin_ts);
+    if (block_version->HasDelete()) {
+        block_version->GetVisibleMask(begin_ts, row_count, visible);
+    }
+    return row_count;
+}
+
+Pair<BlockOffset, BlockOffset> BlockEntry::GetVisibleRange(const Vector<u64> &visible, BlockOffset row_count, BlockOffset block_offset_begin) {
+    if (visible.empty() || block_offset_begin >= row_count) {
+        return {block_offset_begin, std::max(block_offset_begin, row_count)};
     }
-    BlockOffset row_idx;
-    for (row_idx = block_offset_begin; row_idx < block_offset_end; ++row_idx) {
-        if (deleted[row_idx] != 0 && deleted[row_idx] <= begin_ts) {
-            break;
+    // Skip the invisible rows, a whole word at a time when possible.
+    while (block_offset_begin < row_count && ((visible[block_offset_begin / 64] >> (block_offset_begin % 64)) & 1) == 0) {
+        if (visible[block_offset_begin / 64] == 0) {
+            block_offset_begin = std::min<SizeT>(row_count, (block_offset_begin / 64 + 1) * 64);
+        } else {
+            ++block_offset_begin;
+        }
+    }
+    BlockOffset row_idx = block_offset_begin;
+    while (row_idx < row_count && ((visible[row_idx / 64] >> (row_idx % 64)) & 1) != 0) {
+        if (row_idx % 64 == 0 && visible[row_idx / 64] == ~u64(0)) {
+            row_idx += 64;
+        } else {
+            ++row_idx;
         }
     }
     return {block_offset_begin, row_idx};
 }
 
+TxnTimeStamp BlockEntry::SegmentFirstDeleteTS() const { return segment_entry_ == nullptr ? 0 : segment_entry_->first_delete_ts(); }
+
 bool BlockEntry::CheckRowVisible(BlockOffset block_offset, TxnTimeStamp check_ts, bool check_append) const {
+    TxnTimeStamp segment_first_delete_ts = SegmentFirstDeleteTS();
     std::shared_lock lock(rw_locker_);
+    if (FullyVisibleNoLock(check_ts, segment_first_delete_ts)) {
+        return !check_append || block_offset < row_count_;
+    }
 
     auto block_version_handle = this->block_version_->Load();
     const auto *block_version = reinterpret_cast<const BlockVersion *>(block_version_handle.GetData());
@@ -163,24 +196,36 @@ bool BlockEntry::CheckRowVisible(BlockOffset block_offset, TxnTimeStamp check_ts
     if (check_append && block_version->GetRowCount(check_ts) <= block_offset) {
         return false;
     }
-    const auto &deleted = block_version->deleted_;
-    return deleted[block_offset] == 0 || deleted[block_offset] > check_ts;
+    return !block_version->IsDeleted(block_offset, check_ts);
 }
 
 void BlockEntry::SetDeleteBitmask(TxnTimeStamp query_ts, Bitmask &bitmask) const {
-    BlockOffset read_offset = 0;
-    while (true) {
-        auto [row_begin, row_end] = GetVisibleRange(query_ts, read_offset);
-        if (row_begin == row_end) {
-            break;
-        }
-        for (BlockOffset offset = read_offset; offset < row_begin; ++offset) {
-            bitmask.SetFalse(offset);
+    TxnTimeStamp segment_first_delete_ts = SegmentFirstDeleteTS();
+    std::shared_lock lock(rw_locker_);
+    if (FullyVisibleNoLock(query_ts, segment_first_delete_ts)) {
+        return;
+    }
+    query_ts = std::min(query_ts, this->max_row_ts_);
+
+    auto block_version_handle = this->block_version_->Load();
+    const auto *block_version = reinterpret_cast<const BlockVersion *>(block_version_handle.GetData());
+
+    BlockOffset visible_row_count = block_version->GetRowCount(query_ts);
+    if (block_version->HasDelete()) {
+        Vector<u64> visible;
+        block_version->GetVisibleMask(query_ts, visible_row_count, visible);
+        for (SizeT word_idx = 0; word_idx < visible.size(); ++word_idx) {
+            u64 invisible = ~visible[word_idx];
+            if (word_idx + 1 == visible.size() && visible_row_count % 64 != 0) {
+                invisible &= (u64(1) << (visible_row_count % 64)) - 1;
+            }
+            while (invisible != 0) {
+                bitmask.SetFalse(word_idx * 64 + __builtin_ctzll(invisible));
+                invisible &= invisible - 1;
+            }
         }
-        read_offset = row_end;
     }
-    // FIXME: read row_count_ is not thread safe
-    for (BlockOffset offset = read_offset; offset < row_count_; ++offset) {
+    for (BlockOffset offset = visible_row_count; offset < row_count_; ++offset) {
         bitmask.SetFalse(offset);
     }
 }
@@ -245,19 +290,20 @@ SizeT BlockEntry::DeleteData(TransactionID txn_id, TxnTimeStamp commit_ts, const
 
     SizeT delete_row_n = 0;
     for (BlockOffset block_offset : rows) {
-        if (block_version->deleted_[block_offset] != 0) {
+        if (TxnTimeStamp delete_ts = block_version->GetDeleteTS(block_offset); delete_ts != 0) {
             String error_message = fmt::format("Segment {} Block {} Row {} is already deleted at {}, cur commit_ts: {}.",
                                                segment_id,
                                                block_id,
                                                block_offset,
-                                               block_version->deleted_[block_offset],
+                                               delete_ts,
                                                commit_ts);
             LOG_CRITICAL(error_message);
             UnrecoverableError(error_message);
         }
-        block_version->deleted_[block_offset] = commit_ts;
+        block_version->Delete(block_offset, commit_ts);
         delete_row_n++;
     }
+    has_delete_ = true;
 
     LOG_TRACE(fmt::format("Segment {} Block {} has deleted {} rows", segment_id, block_id, rows.size()));
     return delete_row_n;
@@ -319,9 +365,7 @@ ColumnVector BlockEntry::GetDeleteTSVector(BufferManager *buffer_mgr, SizeT offs
         std::shared_lock<std::shared_mutex> lock(this->rw_locker_);
         auto block_version_handle = this->block_version_->Load();
         const auto *block_version = reinterpret_cast<const BlockVersion *>(block_version_handle.GetData());
-        for (SizeT i = offset; i < offset + size; ++i) {
-            column_vector.AppendByPtr(reinterpret_cast<const char *>(&block_version->deleted_[i]));
-        }
+        block_version->GetDeleteTS(offset, size, column_vector);
     }
     return column_vector;
 }
@@ -144,6 +144,13 @@ public:
     // Get visible range of the BlockEntry since the given row number for a txn
     Pair<BlockOffset, BlockOffset> GetVisibleRange(TxnTimeStamp begin_ts, BlockOffset block_offset_begin = 0) const;
 
+    // Get the row count visible to a txn. If some of these rows are deleted at begin_ts, `visible` is set to one bit per row,
+    // otherwise `visible` is cleared and all rows in [0, row count) are visible.
+    BlockOffset GetVisibleMask(TxnTimeStamp begin_ts, Vector<u64> &visible) const;
+
+    // Get the next range of visible rows since block_offset_begin from a mask returned by GetVisibleMask.
+    static Pair<BlockOffset, BlockOffset> GetVisibleRange(const Vector<u64> &visible, BlockOffset row_count, BlockOffset block_offset_begin);
+
     bool CheckRowVisible(BlockOffset block_offset, TxnTimeStamp check_ts, bool check_append) const;
 
     void SetDeleteBitmask(TxnTimeStamp query_ts, Bitmask &bitmask) const;
@@ -164,7 +171,21 @@ public:
     // Setter
     inline void IncreaseRowCount(SizeT increased_row_count) { row_count_ += increased_row_count; }
 
+    // All rows are committed before begin_ts and none of them is deleted, so the block version needn't be loaded.
+    // `segment_first_delete_ts` has to be read before locking the block, the segment lock is always taken first.
+    bool FullyVisible(TxnTimeStamp begin_ts, TxnTimeStamp segment_first_delete_ts) const {
+        std::shared_lock lock(rw_locker_);
+        return FullyVisibleNoLock(begin_ts, segment_first_delete_ts);
+    }
+
 private:
+    // The segment's first delete ts for FullyVisibleNoLock, read before locking the block. A block without a segment is never fully visible.
+    TxnTimeStamp SegmentFirstDeleteTS() const;
+
+    bool FullyVisibleNoLock(TxnTimeStamp begin_ts, TxnTimeStamp segment_first_delete_ts) const {
+        return using_txn_id_ == 0 && max_row_ts_ <= begin_ts && !has_delete_ && segment_first_delete_ts > begin_ts;
+    }
+
     void FlushData(SizeT start_row_count, SizeT checkpoint_row_count);
 
     bool FlushVersion(TxnTimeStamp checkpoint_ts);
@@ -191,6 +212,9 @@ protected:
 
     TransactionID using_txn_id_{0}; // Temporarily used to lock the modification to block entry.
 
+    // Set by the first delete in memory. Blocks loaded from disk rely on the first_delete_ts of their segment instead.
+    bool has_delete_{false};
+
     // checkpoint state
     u16 checkpoint_row_count_{0};
 
@@ -14,6 +14,7 @@
 
 module;
 
+#include <bit>
 #include <fstream>
 
 module block_version;
@@ -42,17 +43,16 @@ CreateField CreateField::LoadFromFile(FileHandler &file_handler) {
 }
 
 bool BlockVersion::operator==(const BlockVersion &rhs) const {
-    if (this->created_.size() != rhs.created_.size() || this->deleted_.size() != rhs.deleted_.size())
+    if (this->created_.size() != rhs.created_.size() || this->capacity_ != rhs.capacity_)
         return false;
     for (SizeT i = 0; i < this->created_.size(); i++) {
         if (this->created_[i] != rhs.created_[i])
             return false;
     }
-    for (SizeT i = 0; i < this->deleted_.size(); i++) {
-        if (this->deleted_[i] != rhs.deleted_[i])
-            return false;
-    }
-    return true;
+    Vector<TxnTimeStamp> deleted, rhs_deleted;
+    this->GetDenseDeleteTS(MAX_TIMESTAMP, deleted);
+    rhs.GetDenseDeleteTS(MAX_TIMESTAMP, rhs_deleted);
+    return deleted == rhs_deleted;
 }
 
 i32 BlockVersion::GetRowCount(TxnTimeStamp begin_ts) const {
@@ -77,16 +77,12 @@ void BlockVersion::SaveToFile(TxnTimeStamp checkpoint_ts, FileHandler &file_hand
         created_[j].SaveToFile(file_handler);
     }
 
-    BlockOffset capacity = deleted_.size();
+    // The file keeps one timestamp per row, deletes after checkpoint_ts are dumped as 0.
+    BlockOffset capacity = capacity_;
     file_handler.Write(&capacity, sizeof(capacity));
-    TxnTimeStamp dump_ts = 0;
-    for (const auto &ts : deleted_) {
-        if (ts <= checkpoint_ts) {
-            file_handler.Write(&ts, sizeof(ts));
-        } else {
-            file_handler.Write(&dump_ts, sizeof(dump_ts));
-        }
-    }
+    Vector<TxnTimeStamp> deleted;
+    GetDenseDeleteTS(checkpoint_ts, deleted);
+    file_handler.Write(deleted.data(), capacity * sizeof(TxnTimeStamp));
 }
 
 void BlockVersion::SpillToFile(FileHandler &file_handler) const {
@@ -96,9 +92,11 @@ void BlockVersion::SpillToFile(FileHandler &file_handler) const {
         create.SaveToFile(file_handler);
     }
 
-    BlockOffset capacity = deleted_.size();
+    BlockOffset capacity = capacity_;
     file_handler.Write(&capacity, sizeof(capacity));
-    file_handler.Write(deleted_.data(), capacity * sizeof(TxnTimeStamp));
+    Vector<TxnTimeStamp> deleted;
+    GetDenseDeleteTS(MAX_TIMESTAMP, deleted);
+    file_handler.Write(deleted.data(), capacity * sizeof(TxnTimeStamp));
 }
 
 UniquePtr<BlockVersion> BlockVersion::LoadFromFile(FileHandler &file_handler) {
@@ -112,9 +110,13 @@ UniquePtr<BlockVersion> BlockVersion::LoadFromFile(FileHandler &file_handler) {
     }
     BlockOffset capacity;
     file_handler.Read(&capacity, sizeof(capacity));
-    block_version->deleted_.resize(capacity);
+    block_version->capacity_ = capacity;
+    Vector<TxnTimeStamp> deleted(capacity);
+    file_handler.Read(deleted.data(), capacity * sizeof(TxnTimeStamp));
     for (BlockOffset i = 0; i < capacity; i++) {
-        file_handler.Read(&block_version->deleted_[i], sizeof(TxnTimeStamp));
+        if (deleted[i] != 0) {
+            block_version->Delete(i, deleted[i]);
+        }
     }
     return block_version;
 }
@@ -139,6 +141,94 @@ void BlockVersion::GetCreateTS(SizeT offset, SizeT size, ColumnVector &res) cons
     }
 }
 
+void BlockVersion::GetDeleteTS(SizeT offset, SizeT size, ColumnVector &res) const {
+    for (SizeT i = 0; i < size; ++i) {
+        TxnTimeStamp delete_ts = GetDeleteTS(BlockOffset(offset + i));
+        res.AppendByPtr(reinterpret_cast<const char *>(&delete_ts));
+    }
+}
+
+TxnTimeStamp BlockVersion::GetDeleteTS(BlockOffset offset) const {
+    if (delete_bitmap_.empty() || (delete_bitmap_[offset / 64] & (u64(1) << (offset % 64))) == 0) {
+        return 0;
+    }
+    return (*delete_words_[offset / 64])[offset % 64];
+}
+
+void BlockVersion::Delete(BlockOffset offset, TxnTimeStamp commit_ts) {
+    if (delete_bitmap_.empty()) {
+        delete_bitmap_.resize((capacity_ + 63) / 64, 0);
+        delete_words_.resize(delete_bitmap_.size());
+    }
+    auto &delete_word = delete_words_[offset / 64];
+    if (delete_word.get() == nullptr) {
+        delete_word = MakeUnique<DeleteWord>();
+        delete_word->fill(0);
+        ++delete_word_count_;
+    }
+    delete_bitmap_[offset / 64] |= u64(1) << (offset % 64);
+    (*delete_word)[offset % 64] = commit_ts;
+    max_delete_ts_ = std::max(max_delete_ts_, commit_ts);
+}
+
+bool BlockVersion::IsDeleted(BlockOffset offset, TxnTimeStamp check_ts) const {
+    if (delete_bitmap_.empty() || (delete_bitmap_[offset / 64] & (u64(1) << (offset % 64))) == 0) {
+        return false;
+    }
+    if (check_ts >= max_delete_ts_) {
+        return true;
+    }
+    return (*delete_words_[offset / 64])[offset % 64] <= check_ts;
+}
+
+void BlockVersion::GetVisibleMask(TxnTimeStamp begin_ts, BlockOffset row_count, Vector<u64> &visible) const {
+    SizeT word_count = (row_count + 63) / 64;
+    visible.assign(word_count, ~u64(0));
+    if (row_count % 64 != 0) {
+        visible.back() = (u64(1) << (row_count % 64)) - 1;
+    }
+    if (delete_bitmap_.empty()) {
+        return;
+    }
+    for (SizeT i = 0; i < word_count; ++i) {
+        visible[i] &= ~delete_bitmap_[i];
+    }
+    if (begin_ts >= max_delete_ts_) {
+        return;
+    }
+    // Rows deleted after begin_ts are still visible to this reader.
+    for (SizeT i = 0; i < word_count; ++i) {
+        u64 deleted = delete_bitmap_[i];
+        if (i == word_count - 1 && row_count % 64 != 0) {
+            deleted &= (u64(1) << (row_count % 64)) - 1;
+        }
+        for (; deleted != 0; deleted &= deleted - 1) {
+            SizeT bit = std::countr_zero(deleted);
+            if ((*delete_words_[i])[bit] > begin_ts) {
+                visible[i] |= u64(1) << bit;
+            }
+        }
+    }
+}
+
+void BlockVersion::GetDenseDeleteTS(TxnTimeStamp max_ts, Vector<TxnTimeStamp> &delete_ts) const {
+    delete_ts.assign(capacity_, 0);
+    for (SizeT i = 0; i < delete_bitmap_.size(); ++i) {
+        for (u64 word = delete_bitmap_[i]; word != 0; word &= word - 1) {
+            SizeT bit = std::countr_zero(word);
+            TxnTimeStamp ts = (*delete_words_[i])[bit];
+            if (ts <= max_ts) {
+                delete_ts[i * 64 + bit] = ts;
+            }
+        }
+    }
+}
+
+SizeT BlockVersion::MemoryCost() const {
+    return created_.capacity() * sizeof(CreateField) + delete_bitmap_.size() * sizeof(u64) + delete_words_.size() * sizeof(UniquePtr<DeleteWord>) +
+           delete_word_count_ * sizeof(DeleteWord);
+}
+
 // void BlockVersion::Cleanup(const String &version_path) {
 //     LocalFileSystem fs;
 
@@ -43,7 +43,7 @@ export struct BlockVersion {
 
     static SharedPtr<String> FileName() { return MakeShared<String>(PATH); }
 
-    explicit BlockVersion(SizeT capacity) : deleted_(capacity, 0) {}
+    explicit BlockVersion(SizeT capacity) : capacity_(capacity) {}
     BlockVersion() = default;
 
     bool operator==(const BlockVersion &rhs) const;
@@ -59,11 +59,44 @@ export struct BlockVersion {
 
     void GetCreateTS(SizeT offset, SizeT size, ColumnVector &res) const;
 
+    void GetDeleteTS(SizeT offset, SizeT size, ColumnVector &res) const;
+
+    SizeT capacity() const { return capacity_; }
+
+    bool HasDelete() const { return max_delete_ts_ != 0; }
+
+    // Return 0 if the row is not deleted.
+    TxnTimeStamp GetDeleteTS(BlockOffset offset) const;
+
+    void Delete(BlockOffset offset, TxnTimeStamp commit_ts);
+
+    bool IsDeleted(BlockOffset offset, TxnTimeStamp check_ts) const;
+
+    // Set `visible` to one bit per row in [0, row_count), true if the row is not deleted at begin_ts.
+    void GetVisibleMask(TxnTimeStamp begin_ts, BlockOffset row_count, Vector<u64> &visible) const;
+
+    // The memory the block version takes now, the delete timestamps only count once the rows of their word are deleted.
+    SizeT MemoryCost() const;
+
     // void Cleanup(const String &version_path);
 
     Vector<CreateField> created_{}; // second field width is same as timestamp, otherwise Valgrind will issue BlockVersion::SaveToFile has
                                     // risk to write uninitialized buffer. (ts, rows)
-    Vector<TxnTimeStamp> deleted_{};
+
+private:
+    // Dense delete timestamps, 0 for the rows not deleted, or deleted after max_ts.
+    void GetDenseDeleteTS(TxnTimeStamp max_ts, Vector<TxnTimeStamp> &delete_ts) const;
+
+    SizeT capacity_{};
+    // Most blocks never see a delete, so nothing below is allocated until the first one.
+    // delete_bitmap_ has one bit per row, set if the row is deleted at any timestamp. Readers that begin after max_delete_ts_
+    // only need the bitmap. For the older readers, delete_words_ has the delete timestamps of the 64 rows of a bitmap word,
+    // allocated only for the words that have a deleted row, so a delete of any commit order writes one slot.
+    using DeleteWord = Array<TxnTimeStamp, 64>;
+    Vector<u64> delete_bitmap_{};
+    Vector<UniquePtr<DeleteWord>> delete_words_{};
+    SizeT delete_word_count_{};
+    TxnTimeStamp max_delete_ts_{};
 };
 
 } // namespace infinity
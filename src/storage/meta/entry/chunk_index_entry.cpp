@@ -42,6 +42,7 @@ import local_file_system;
 import secondary_index_file_worker;
 import emvb_index_file_worker;
 import bmp_index_file_worker;
+import diskann_index_file_worker;
 import column_def;
 
 namespace infinity {
@@ -82,6 +83,10 @@ UniquePtr<IndexFileWorker> ChunkIndexEntry::CreateFileWorker(const SharedPtr<Ind
             auto index_file_name = MakeShared<String>(ChunkIndexEntry::IndexFileName(segment_id, chunk_id));
             return MakeUnique<BMPIndexFileWorker>(index_dir, index_file_name, index_base, column_def);
         }
+        case IndexType::kDiskAnn: {
+            auto index_file_name = MakeShared<String>(ChunkIndexEntry::IndexFileName(segment_id, chunk_id));
+            return MakeUnique<DiskAnnIndexFileWorker>(index_dir, index_file_name, index_base, column_def);
+        }
         default: {
             LOG_TRACE(fmt::format("index {} not store in index chunk entry by buffer obj", (u8)index_base->index_type_));
             return nullptr;
@@ -212,7 +217,8 @@ SharedPtr<ChunkIndexEntry> ChunkIndexEntry::NewReplayChunkIndexEntry(ChunkID chu
             break;
         }
         case IndexType::kHnsw:
-        case IndexType::kBMP: {
+        case IndexType::kBMP:
+        case IndexType::kDiskAnn: {
             const auto &index_dir = segment_index_entry->index_dir();
             const auto &index_base = param->index_base_;
             SegmentID segment_id = segment_index_entry->segment_id();
@@ -322,12 +322,12 @@ void DBEntry::MemIndexCommit() {
     }
 }
 
-void DBEntry::MemIndexRecover(BufferManager *buffer_manager) {
+void DBEntry::MemIndexRecoverTables(Vector<TableEntry *> &table_entries) {
     auto table_meta_map_guard = table_meta_map_.GetMetaMap();
     for (auto &[_, table_meta] : *table_meta_map_guard) {
         auto [table_entry, status] = table_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
         if (status.ok()) {
-            table_entry->MemIndexRecover(buffer_manager);
+            table_entries.push_back(table_entry);
         }
     }
 }
@@ -149,6 +149,7 @@ public:
     void Cleanup() override;
 
     void MemIndexCommit();
-    void MemIndexRecover(BufferManager *buffer_manager);
+    // Collect the table entries whose memory indexes need recovering, so that the caller can recover them concurrently.
+    void MemIndexRecoverTables(Vector<TableEntry *> &table_entries);
 };
 } // namespace infinity
@@ -239,6 +239,19 @@ bool SegmentEntry::CheckRowVisible(SegmentOffset segment_offset, TxnTimeStamp ch
     return block_entry->CheckRowVisible(block_offset, check_ts, check_append);
 }
 
+bool SegmentEntry::FullyVisible(TxnTimeStamp begin_ts) const {
+    std::shared_lock lock(rw_locker_);
+    if (max_row_ts_ > begin_ts || first_delete_ts_ <= begin_ts) {
+        return false;
+    }
+    for (const auto &block_entry : block_entries_) {
+        if (!block_entry->FullyVisible(begin_ts, first_delete_ts_)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool SegmentEntry::CheckVisible(Txn *txn) const {
     TxnTimeStamp begin_ts = txn->BeginTS();
     std::shared_lock lock(rw_locker_);
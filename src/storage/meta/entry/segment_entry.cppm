@@ -115,6 +115,9 @@ public:
 
     bool CheckRowVisible(SegmentOffset segment_offset, TxnTimeStamp check_ts, bool check_append) const;
 
+    // All rows of the segment are committed before begin_ts and none of them is deleted at begin_ts.
+    bool FullyVisible(TxnTimeStamp begin_ts) const;
+
     virtual bool CheckVisible(Txn *txn) const override;
 
     bool CheckDeprecate(TxnTimeStamp check_ts) const;
@@ -181,6 +184,11 @@ public:
         return deprecate_ts_;
     }
 
+    // the number of queries which have read the segment, the query heat for compaction
+    u64 access_count() const { return access_count_.load(std::memory_order_relaxed); }
+
+    void IncreaseAccessCount(u64 count = 1) { access_count_.fetch_add(count, std::memory_order_relaxed); }
+
     SharedPtr<BlockEntry> GetBlockEntryByID(BlockID block_id) const;
 
     BlocksGuard GetBlocksGuard() const { return BlocksGuard{block_entries_, std::shared_lock(rw_locker_)}; }
@@ -236,6 +244,8 @@ private:
     TxnTimeStamp first_delete_ts_{UNCOMMIT_TS}; // Indicate the first delete commit ts. If not delete, it is UNCOMMIT_TS
     TxnTimeStamp deprecate_ts_{UNCOMMIT_TS};
 
+    Atomic<u64> access_count_{0};
+
     Vector<SharedPtr<BlockEntry>> block_entries_{};
 
     // check if a value must not exist in the segment
@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 #include <vector>
@@ -49,12 +50,16 @@ import annivfflat_index_file_worker;
 import hnsw_file_worker;
 import secondary_index_file_worker;
 import bmp_index_file_worker;
+import diskann_index;
 import sparse_util;
 import index_full_text;
 import index_defines;
 import column_inverter;
 import block_entry;
+import segment_entry;
 import local_file_system;
+import file_system;
+import file_system_type;
 import chunk_index_entry;
 import abstract_hnsw;
 import block_column_iter;
@@ -62,6 +67,9 @@ import txn_store;
 import secondary_index_in_mem;
 import emvb_index;
 import emvb_index_in_mem;
+import infinity_context;
+import table_index_meta;
+import table_entry;
 
 namespace infinity {
 
@@ -176,7 +184,8 @@ Vector<UniquePtr<IndexFileWorker>> SegmentIndexEntry::CreateFileWorkers(SharedPt
         case IndexType::kFullText:
         case IndexType::kEMVB:
         case IndexType::kSecondary:
-        case IndexType::kBMP: {
+        case IndexType::kBMP:
+        case IndexType::kDiskAnn: {
             // these indexes don't use BufferManager
             return vector_file_worker;
         }
@@ -252,16 +261,11 @@ void SegmentIndexEntry::MemIndexInsert(SharedPtr<BlockEntry> block_entry,
 
     switch (index_base->index_type_) {
         case IndexType::kFullText: {
-            const IndexFullText *index_fulltext = static_cast<const IndexFullText *>(index_base.get());
             if (memory_indexer_.get() == nullptr) {
                 String base_name = fmt::format("ft_{:016x}", begin_row_id.ToUint64());
                 {
                     std::unique_lock<std::shared_mutex> lck(rw_locker_);
-                    memory_indexer_ = MakeUnique<MemoryIndexer>(*table_index_entry_->index_dir(),
-                                                                base_name,
-                                                                begin_row_id,
-                                                                index_fulltext->flag_,
-                                                                index_fulltext->analyzer_);
+                    memory_indexer_ = MakeMemoryIndexer(base_name, begin_row_id);
                 }
                 table_index_entry_->UpdateFulltextSegmentTs(commit_ts);
             } else {
@@ -444,15 +448,22 @@ SharedPtr<ChunkIndexEntry> SegmentIndexEntry::MemIndexDump(bool spill) {
     }
 }
 
+UniquePtr<MemoryIndexer> SegmentIndexEntry::MakeMemoryIndexer(const String &base_name, RowID base_row_id) {
+    const auto *index_fulltext = static_cast<const IndexFullText *>(table_index_entry_->index_base());
+    auto memory_indexer =
+        MakeUnique<MemoryIndexer>(*table_index_entry_->index_dir(), base_name, base_row_id, index_fulltext->flag_, index_fulltext->analyzer_);
+    TableEntry *table_entry = table_index_entry_->table_index_meta()->GetTableEntry();
+    memory_indexer->SetCommitCallback([table_entry]() { table_entry->CommitMemIndexVersion(); });
+    return memory_indexer;
+}
+
 void SegmentIndexEntry::MemIndexLoad(const String &base_name, RowID base_row_id) {
     const IndexBase *index_base = table_index_entry_->index_base();
     if (index_base->index_type_ != IndexType::kFullText)
         return;
     // Init the mem index from previously spilled one.
     assert(memory_indexer_.get() == nullptr);
-    const IndexFullText *index_fulltext = static_cast<const IndexFullText *>(index_base);
-    memory_indexer_ =
-        MakeUnique<MemoryIndexer>(*table_index_entry_->index_dir(), base_name, base_row_id, index_fulltext->flag_, index_fulltext->analyzer_);
+    memory_indexer_ = MakeMemoryIndexer(base_name, base_row_id);
     memory_indexer_->Load();
 }
 
@@ -477,6 +488,36 @@ u32 SegmentIndexEntry::MemIndexRowCount() {
     }
 }
 
+namespace {
+
+// diskann has no memory index, a chunk covers the rows of the segment when it is built and the knn scan reads the rows
+// appended later. The rows of `base` keep their edges. Returns the number of covered rows.
+template <bool CheckTS>
+SegmentOffset BuildDiskAnnIndex(DiskAnnIndex *index,
+                                const SegmentEntry *segment_entry,
+                                BufferManager *buffer_mgr,
+                                ColumnID column_id,
+                                TxnTimeStamp begin_ts,
+                                const DiskAnnIndex *base = nullptr) {
+    const SegmentOffset row_count = CheckTS ? segment_entry->row_count(begin_ts) : segment_entry->row_count();
+    struct CoveredRowIterator {
+        OneColumnIterator<float, CheckTS> iter_;
+        SegmentOffset row_count_;
+
+        Optional<Pair<const float *, SegmentOffset>> Next() {
+            auto ret = iter_.Next();
+            if (ret.has_value() && ret->second >= row_count_) {
+                return None;
+            }
+            return ret;
+        }
+    };
+    index->Build(CoveredRowIterator{OneColumnIterator<float, CheckTS>(segment_entry, buffer_mgr, column_id, begin_ts), row_count}, base);
+    return row_count;
+}
+
+} // namespace
+
 void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn *txn, const PopulateEntireConfig &config) {
     TxnTimeStamp begin_ts = txn->BeginTS();
     auto *buffer_mgr = txn->buffer_mgr();
@@ -484,13 +525,16 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
     SharedPtr<ColumnDef> column_def = table_index_entry_->column_def();
     switch (index_base->index_type_) {
         case IndexType::kFullText: {
-            const IndexFullText *index_fulltext = static_cast<const IndexFullText *>(index_base);
             u32 seg_id = segment_entry->segment_id();
             RowID base_row_id(seg_id, 0);
             String base_name = fmt::format("ft_{:016x}", base_row_id.ToUint64());
-            memory_indexer_ =
-                MakeUnique<MemoryIndexer>(*table_index_entry_->index_dir(), base_name, base_row_id, index_fulltext->flag_, index_fulltext->analyzer_);
+            memory_indexer_ = MakeMemoryIndexer(base_name, base_row_id);
             u64 column_id = column_def->id();
+            // Each insert is inverted by its own ColumnInverter on the ingest threads, and the sorted runs of all inverters are
+            // merged by the offline dump. Split the blocks when the segment has too few of them to keep the threads busy.
+            constexpr SizeT min_invert_row_count = 1024;
+            SizeT thread_count = InfinityContext::instance().GetSharedThreadPool().thread_count();
+            u32 invert_row_count = std::max((segment_entry->row_count() + thread_count - 1) / thread_count, min_invert_row_count);
             auto block_entry_iter = BlockEntryIter(segment_entry);
             for (const auto *block_entry = block_entry_iter.Next(); block_entry != nullptr; block_entry = block_entry_iter.Next()) {
                 BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
@@ -506,7 +550,10 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
                 }
 
                 SharedPtr<ColumnVector> column_vector = MakeShared<ColumnVector>(block_column_entry->GetColumnVector(buffer_mgr));
-                memory_indexer_->Insert(column_vector, 0, block_entry->row_count(), true);
+                u32 block_row_count = block_entry->row_count();
+                for (u32 row_offset = 0; row_offset < block_row_count; row_offset += invert_row_count) {
+                    memory_indexer_->Insert(column_vector, row_offset, std::min(invert_row_count, block_row_count - row_offset), true);
+                }
                 memory_indexer_->Commit(true);
             }
             memory_indexer_->Dump(true);
@@ -628,6 +675,22 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
             chunk_index_entry->SetRowCount(row_count);
             break;
         }
+        case IndexType::kDiskAnn: {
+            RowID base_rowid(segment_entry->segment_id(), 0);
+            SharedPtr<ChunkIndexEntry> chunk_index_entry = CreateChunkIndexEntry(column_def, base_rowid, buffer_mgr);
+            this->AddChunkIndexEntry(chunk_index_entry);
+            BufferHandle buffer_handle = chunk_index_entry->GetIndex();
+            auto *index = static_cast<DiskAnnIndex *>(buffer_handle.GetDataMut());
+
+            SegmentOffset row_count = 0;
+            if (config.check_ts_) {
+                row_count = BuildDiskAnnIndex<true>(index, segment_entry, buffer_mgr, column_def->id(), begin_ts);
+            } else {
+                row_count = BuildDiskAnnIndex<false>(index, segment_entry, buffer_mgr, column_def->id(), begin_ts);
+            }
+            chunk_index_entry->SetRowCount(row_count);
+            break;
+        }
         default: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("Invalid index type: {}", IndexInfo::IndexTypeToString(index_base->index_type_)));
@@ -698,7 +761,8 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
             PopulateEntirely(segment_entry, txn, populate_entire_config);
             break;
         }
-        case IndexType::kBMP: {
+        case IndexType::kBMP:
+        case IndexType::kDiskAnn: {
             PopulateEntirely(segment_entry, txn, populate_entire_config);
             break;
         }
@@ -866,7 +930,8 @@ SegmentIndexEntry::GetCreateIndexParam(SharedPtr<IndexBase> index_base, SizeT se
         case IndexType::kEMVB: {
             return MakeUnique<CreateIndexParam>(index_base, column_def);
         }
-        case IndexType::kBMP: {
+        case IndexType::kBMP:
+        case IndexType::kDiskAnn: {
             return MakeUnique<CreateIndexParam>(index_base, column_def);
         }
         default: {
@@ -898,7 +963,7 @@ ChunkIndexEntry *SegmentIndexEntry::RebuildChunkIndexEntries(TxnTableStore *txn_
     u32 row_count = 0;
     {
         std::shared_lock lock(rw_locker_);
-        if (chunk_index_entries_.size() <= 1) { // TODO
+        if (index_base->index_type_ != IndexType::kDiskAnn && chunk_index_entries_.size() <= 1) { // TODO
             return nullptr;
         }
         for (const auto &chunk_index_entry : chunk_index_entries_) {
@@ -908,6 +973,14 @@ ChunkIndexEntry *SegmentIndexEntry::RebuildChunkIndexEntries(TxnTableStore *txn_
             }
         }
     }
+    if (index_base->index_type_ == IndexType::kDiskAnn) {
+        // diskann has no memory index, rebuild when the chunk misses the appended rows. A segment still appended is
+        // rebuilt once its rows double. The rebuild links the appended rows into the graph of the old chunk.
+        SizeT segment_row_count = segment_entry->row_count(begin_ts);
+        if (segment_row_count <= row_count || (segment_entry->status() == SegmentStatus::kUnsealed && segment_row_count < 2 * row_count)) {
+            return nullptr;
+        }
+    }
     RowID base_rowid(segment_id_, 0);
     SharedPtr<ChunkIndexEntry> merged_chunk_index_entry = nullptr;
     switch (index_base->index_type_) {
@@ -970,6 +1043,20 @@ ChunkIndexEntry *SegmentIndexEntry::RebuildChunkIndexEntries(TxnTableStore *txn_
             merged_chunk_index_entry->SetRowCount(row_count);
             break;
         }
+        case IndexType::kDiskAnn: {
+            merged_chunk_index_entry = CreateChunkIndexEntry(column_def, base_rowid, buffer_mgr);
+            BufferHandle buffer_handle = merged_chunk_index_entry->GetIndex();
+            auto *index = static_cast<DiskAnnIndex *>(buffer_handle.GetDataMut());
+            BufferHandle base_handle;
+            const DiskAnnIndex *base = nullptr;
+            if (old_chunks.size() == 1 && old_chunks[0]->base_rowid_.segment_offset_ == 0) {
+                base_handle = old_chunks[0]->GetIndex();
+                base = static_cast<const DiskAnnIndex *>(base_handle.GetData());
+            }
+            SegmentOffset row_count = BuildDiskAnnIndex<true>(index, segment_entry, buffer_mgr, column_def->id(), begin_ts, base);
+            merged_chunk_index_entry->SetRowCount(row_count);
+            break;
+        }
         case IndexType::kSecondary: {
             merged_chunk_index_entry = CreateSecondaryIndexChunkIndexEntry(base_rowid, row_count, buffer_mgr);
             BufferHandle handle = merged_chunk_index_entry->GetIndex();
@@ -997,6 +1084,101 @@ ChunkIndexEntry *SegmentIndexEntry::RebuildChunkIndexEntries(TxnTableStore *txn_
     return merged_chunk_index_entry.get();
 }
 
+SizeT SegmentIndexEntry::ConsolidateHnswDeletes(TxnTableStore *txn_table_store, SegmentEntry *segment_entry, TxnTimeStamp visible_ts) {
+    const IndexBase *index_base = table_index_entry_->index_base();
+    // the blocks of an unsealed segment are still appended
+    if (index_base->index_type_ != IndexType::kHnsw || segment_entry->status() != SegmentStatus::kSealed ||
+        !segment_entry->CheckAnyDelete(visible_ts)) {
+        return 0;
+    }
+    auto index_hnsw = static_cast<const IndexHnsw *>(index_base);
+    SharedPtr<ColumnDef> column_def = table_index_entry_->column_def();
+    auto embedding_info = static_cast<EmbeddingInfo *>(column_def->type()->type_info().get());
+    if (embedding_info->Type() != kElemFloat) {
+        return 0;
+    }
+
+    // a row deleted at visible_ts is invisible to every reader, so it can leave the graph
+    Vector<SegmentOffset> deleted_offsets;
+    for (const auto &block_entry : segment_entry->block_entries()) {
+        Vector<u64> visible;
+        BlockOffset row_count = block_entry->GetVisibleMask(visible_ts, visible);
+        if (visible.empty()) {
+            continue;
+        }
+        SegmentOffset block_offset = block_entry->segment_offset();
+        for (BlockOffset i = 0; i < row_count; ++i) {
+            if (((visible[i / 64] >> (i % 64)) & 1) == 0) {
+                deleted_offsets.push_back(block_offset + i);
+            }
+        }
+    }
+    if (deleted_offsets.empty()) {
+        return 0;
+    }
+
+    Txn *txn = txn_table_store->GetTxn();
+    BufferManager *buffer_mgr = txn->buffer_mgr();
+    Vector<SharedPtr<ChunkIndexEntry>> old_chunks;
+    {
+        std::shared_lock lock(rw_locker_);
+        for (const auto &chunk_index_entry : chunk_index_entries_) {
+            if (chunk_index_entry->CheckVisible(txn)) {
+                old_chunks.push_back(chunk_index_entry);
+            }
+        }
+    }
+    SizeT deleted_n = 0;
+    for (const auto &old_chunk : old_chunks) {
+        SegmentOffset chunk_begin = old_chunk->base_rowid_.segment_offset_;
+        SegmentOffset chunk_end = chunk_begin + old_chunk->row_count_;
+        auto iter = std::lower_bound(deleted_offsets.begin(), deleted_offsets.end(), chunk_begin);
+        auto iter_end = std::lower_bound(iter, deleted_offsets.end(), chunk_end);
+        Vector<SegmentOffset> chunk_deleted(iter, iter_end);
+        if (chunk_deleted.empty()) {
+            continue;
+        }
+
+        // The committed chunk is searched without lock, so it is never rewritten. The graph is copied into a new chunk in memory,
+        // repaired there, and replaces the old chunk when the txn commits.
+        SharedPtr<ChunkIndexEntry> new_chunk;
+        {
+            BufferHandle old_handle = old_chunk->GetIndex();
+            AbstractHnsw<f32, SegmentOffset> old_hnsw(const_cast<void *>(old_handle.GetData()), index_hnsw);
+            // the tombstones are saved with the chunk, so the deletes are consolidated already if they are all tombstoned
+            if (old_hnsw.AllDeleted(chunk_deleted)) {
+                continue;
+            }
+            new_chunk = CreateChunkIndexEntry(column_def, old_chunk->base_rowid_, buffer_mgr);
+            BufferHandle new_handle = new_chunk->GetIndex();
+            AbstractHnsw<f32, SegmentOffset> new_hnsw(new_handle.GetDataMut(), index_hnsw);
+            new_hnsw.CopyFrom(old_hnsw);
+        }
+
+        BufferHandle new_handle = new_chunk->GetIndex();
+        AbstractHnsw<f32, SegmentOffset> new_hnsw(new_handle.GetDataMut(), index_hnsw);
+        SizeT chunk_deleted_n = 0;
+        for (SegmentOffset offset : chunk_deleted) {
+            if (new_hnsw.MarkDeleted(offset)) {
+                ++chunk_deleted_n;
+            }
+        }
+        SizeT repaired_n = new_hnsw.Consolidate();
+        new_chunk->SetRowCount(old_chunk->row_count_);
+        ReplaceChunkIndexEntries(txn_table_store, new_chunk, {old_chunk.get()});
+        txn_table_store->AddChunkIndexStore(table_index_entry_, new_chunk.get());
+        new_chunk->SaveIndexFile();
+        deleted_n += chunk_deleted_n;
+        LOG_INFO(fmt::format("Segment {} hnsw chunk {} replaces chunk {}: {} vertices deleted, {} neighbor lists repaired",
+                             segment_id_,
+                             new_chunk->chunk_id_,
+                             old_chunk->chunk_id_,
+                             chunk_deleted_n,
+                             repaired_n));
+    }
+    return deleted_n;
+}
+
 void SegmentIndexEntry::SaveIndexFile() {
     String &index_name = *table_index_entry_->index_dir();
     u64 segment_id = this->segment_id_;
@@ -166,6 +166,10 @@ public:
 
     ChunkIndexEntry *RebuildChunkIndexEntries(TxnTableStore *txn_table_store, SegmentEntry *segment_entry);
 
+    // Replace each hnsw chunk with edges to the rows deleted before `visible_ts` by a copy whose graph is repaired around them.
+    // Return the number of deleted vertices in the new chunks.
+    SizeT ConsolidateHnswDeletes(TxnTableStore *txn_table_store, SegmentEntry *segment_entry, TxnTimeStamp visible_ts);
+
     Tuple<Vector<SharedPtr<ChunkIndexEntry>>, SharedPtr<MemoryIndexer>> GetFullTextIndexSnapshot() {
         std::shared_lock lock(rw_locker_);
         return {chunk_index_entries_, memory_indexer_};
@@ -191,6 +195,12 @@ public:
         return {chunk_index_entries_, memory_emvb_index_};
     }
 
+    // diskann has no memory index, the rows after the chunks are scanned by brute force
+    Vector<SharedPtr<ChunkIndexEntry>> GetDiskAnnIndexSnapshot() {
+        std::shared_lock lock(rw_locker_);
+        return chunk_index_entries_;
+    }
+
     Pair<u64, u32> GetFulltextColumnLenInfo() {
         std::shared_lock lock(rw_locker_);
         if (ft_column_len_sum_ == 0 && memory_indexer_.get() != nullptr) {
@@ -237,6 +247,9 @@ private:
 
     ChunkID GetNextChunkID() { return next_chunk_id_++; }
 
+    // The memory full text index of the segment, whose commits invalidate the cached search results of the table
+    UniquePtr<MemoryIndexer> MakeMemoryIndexer(const String &base_name, RowID base_row_id);
+
 private:
     BufferManager *buffer_manager_{};
     TableIndexEntry *table_index_entry_;
@@ -55,6 +55,8 @@ import column_index_merger;
 import parsed_expr;
 import constant_expr;
 import infinity_context;
+import config;
+import metrics;
 
 namespace infinity {
 
@@ -100,7 +102,14 @@ TableEntry::TableEntry(bool is_delete,
 
     // this->SetCompactionAlg(nullptr);
     if (!is_delete) {
-        this->SetCompactionAlg(MakeUnique<DBTCompactionAlg>(DBT_COMPACTION_M, DBT_COMPACTION_C, DBT_COMPACTION_S, DEFAULT_SEGMENT_CAPACITY, this));
+        CompactionCostModel cost_model;
+        if (Config *config = InfinityContext::instance().config(); config != nullptr) {
+            cost_model.min_delete_ratio_ = config->CompactionMinDeleteRatio();
+            cost_model.index_rebuild_cost_ = config->CompactionIndexRebuildCost();
+            cost_model.heat_weight_ = config->CompactionHeatWeight();
+        }
+        this->SetCompactionAlg(
+            MakeUnique<DBTCompactionAlg>(DBT_COMPACTION_M, DBT_COMPACTION_C, DBT_COMPACTION_S, DEFAULT_SEGMENT_CAPACITY, this, cost_model));
         compaction_alg_->Enable({});
     }
 }
@@ -322,6 +331,22 @@ void TableEntry::GetFulltextAnalyzers(TransactionID txn_id, TxnTimeStamp begin_t
     }
 }
 
+void TableEntry::CommitDataVersion(TxnTimeStamp commit_ts) {
+    // The ts is raised before the version, a reader which loads the version first sees at least this ts with it
+    TxnTimeStamp version_ts = data_version_ts_.load();
+    while (version_ts < commit_ts && !data_version_ts_.compare_exchange_weak(version_ts, commit_ts)) {
+    }
+    ++data_version_;
+}
+
+void TableEntry::CommitMemIndexVersion() { ++data_version_; }
+
+Pair<u64, TxnTimeStamp> TableEntry::data_version() const {
+    u64 version = data_version_.load();
+    TxnTimeStamp version_ts = data_version_ts_.load();
+    return {version, version_ts};
+}
+
 void TableEntry::Import(SharedPtr<SegmentEntry> segment_entry, Txn *txn) {
     {
         std::unique_lock lock(this->rw_locker_);
@@ -346,7 +371,8 @@ void TableEntry::Import(SharedPtr<SegmentEntry> segment_entry, Txn *txn) {
             case IndexType::kSecondary:
             case IndexType::kEMVB:
             case IndexType::kHnsw:
-            case IndexType::kBMP: {
+            case IndexType::kBMP:
+            case IndexType::kDiskAnn: {
                 // support realtime index
                 break;
             }
@@ -828,6 +854,8 @@ void TableEntry::MemIndexRecover(BufferManager *buffer_manager) {
 }
 
 void TableEntry::OptimizeIndex(Txn *txn) {
+    static MetricHistogram *optimize_metric = MetricsRegistry::instance().Histogram("infinity_optimize_seconds", "Time of optimizing the indexes of a table");
+    MetricTimer timer(optimize_metric);
     TxnTableStore *txn_table_store = txn->GetTxnTableStore(this);
     auto index_meta_map_guard = index_meta_map_.GetMetaMap();
     for (auto &[_, table_index_meta] : *index_meta_map_guard) {
@@ -889,6 +917,8 @@ void TableEntry::OptimizeIndex(Txn *txn) {
             case IndexType::kSecondary:
             case IndexType::kBMP: {
                 TxnTimeStamp begin_ts = txn->BeginTS();
+                // the rows deleted before the oldest active txn began are seen by nobody, hnsw drops them without a rebuild
+                TxnTimeStamp visible_ts = txn->txn_mgr()->GetCleanupScanTS();
                 auto segment_index_guard = table_index_entry->GetSegmentIndexesGuard();
                 for (auto &[segment_id, segment_index_entry] : segment_index_guard.index_by_segment_) {
                     SegmentEntry *segment_entry = GetSegmentByID(segment_id, begin_ts).get();
@@ -896,9 +926,38 @@ void TableEntry::OptimizeIndex(Txn *txn) {
                         auto *merged_chunk_entry = segment_index_entry->RebuildChunkIndexEntries(txn_table_store, segment_entry);
                         if (merged_chunk_entry != nullptr) {
                             merged_chunk_entry->SaveIndexFile();
+                        } else if (index_base->index_type_ == IndexType::kHnsw) {
+                            segment_index_entry->ConsolidateHnswDeletes(txn_table_store, segment_entry, visible_ts);
+                        }
+                    }
+                }
+                break;
+            }
+            case IndexType::kDiskAnn: {
+                // diskann has no memory index, the segments appended after the index was created have no index entry yet
+                TxnTimeStamp begin_ts = txn->BeginTS();
+                Vector<SharedPtr<SegmentEntry>> segment_entries;
+                {
+                    std::shared_lock lock(this->rw_locker_);
+                    for (const auto &[segment_id, segment_entry] : segment_map_) {
+                        SegmentStatus segment_status = segment_entry->status();
+                        if (segment_entry->min_row_ts() <= begin_ts &&
+                            (segment_status == SegmentStatus::kUnsealed || segment_status == SegmentStatus::kSealed)) {
+                            segment_entries.push_back(segment_entry);
                         }
                     }
                 }
+                for (const auto &segment_entry : segment_entries) {
+                    SharedPtr<SegmentIndexEntry> segment_index_entry;
+                    if (table_index_entry->GetOrCreateSegment(segment_entry->segment_id(), txn, segment_index_entry)) {
+                        Vector<SegmentIndexEntry *> segment_index_entries{segment_index_entry.get()};
+                        txn_table_store->AddSegmentIndexesStore(table_index_entry, segment_index_entries);
+                    }
+                    auto *merged_chunk_entry = segment_index_entry->RebuildChunkIndexEntries(txn_table_store, segment_entry.get());
+                    if (merged_chunk_entry != nullptr) {
+                        merged_chunk_entry->SaveIndexFile();
+                    }
+                }
                 break;
             }
             default: {
@@ -971,6 +1030,11 @@ SharedPtr<BlockIndex> TableEntry::GetBlockIndex(Txn *txn) {
     return result;
 }
 
+SizeT TableEntry::IndexCount() {
+    auto index_meta_map_guard = index_meta_map_.GetMetaMap();
+    return (*index_meta_map_guard).size();
+}
+
 SharedPtr<IndexIndex> TableEntry::GetIndexIndex(Txn *txn) {
     SharedPtr<IndexIndex> result = MakeShared<IndexIndex>();
     auto index_meta_map_guard = index_meta_map_.GetMetaMap();
@@ -224,8 +224,20 @@ public:
 
     SharedPtr<IndexIndex> GetIndexIndex(Txn *txn);
 
+    // the number of index metas, including the dropped ones not cleaned up yet
+    SizeT IndexCount();
+
     void GetFulltextAnalyzers(TransactionID txn_id, TxnTimeStamp begin_ts, Map<String, String> &column2analyzer);
 
+    // Bumped by each commit which changes the data or the indexes of the table
+    void CommitDataVersion(TxnTimeStamp commit_ts);
+
+    // Bumped when a memory index makes committed rows searchable, which changes the search results without a commit
+    void CommitMemIndexVersion();
+
+    // The number of the changes on the table so far, and the largest commit ts of them
+    Pair<u64, TxnTimeStamp> data_version() const;
+
 public:
     nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
 
@@ -269,6 +281,8 @@ private:
     SharedPtr<SegmentEntry> unsealed_segment_{};
     SegmentID unsealed_id_{};
     Atomic<SegmentID> next_segment_id_{};
+    Atomic<u64> data_version_{};
+    Atomic<TxnTimeStamp> data_version_ts_{};
 
     // for full text search cache
     TableIndexReaderCache fulltext_column_index_cache_;
@@ -276,7 +276,8 @@ SharedPtr<SegmentIndexEntry> TableIndexEntry::PopulateEntirely(SegmentEntry *seg
         case IndexType::kEMVB:
         case IndexType::kFullText:
         case IndexType::kSecondary:
-        case IndexType::kBMP: {
+        case IndexType::kBMP:
+        case IndexType::kDiskAnn: {
             break;
         }
         default: {
@@ -37,13 +37,15 @@ class BlockColumnIter {
 public:
     BlockColumnIter(BlockColumnEntry *entry, BufferManager *buffer_mgr, TxnTimeStamp iterate_ts)
         : block_entry_(entry->GetBlockEntry()), column_vector_(MakeShared<ColumnVector>(entry->GetColumnVector(buffer_mgr))),
-          ele_size_(entry->column_type()->Size()), iterate_ts_(iterate_ts), offset_(0), read_end_(0) {}
+          ele_size_(entry->column_type()->Size()), iterate_ts_(iterate_ts), offset_(0), read_end_(0) {
+        visible_row_count_ = block_entry_->GetVisibleMask(iterate_ts_, visible_);
+    }
     // TODO: Does `ColumnVector` implements the move constructor?
 
     Optional<Pair<const void *, BlockOffset>> Next() {
         // FIXME: because no non-copy way to get data from `ColumnVector`, use data() tmply
         if (offset_ == read_end_) {
-            auto [begin, end] = block_entry_->GetVisibleRange(iterate_ts_, read_end_);
+            auto [begin, end] = BlockEntry::GetVisibleRange(visible_, visible_row_count_, read_end_);
             if (begin == end) {
                 return None;
             }
@@ -66,6 +68,9 @@ private:
 
     BlockOffset offset_;
     BlockOffset read_end_;
+
+    Vector<u64> visible_;
+    BlockOffset visible_row_count_;
 };
 
 export template <>
@@ -45,6 +45,10 @@ import expression_state;
 import infinity_exception;
 import third_party;
 import logger;
+import txn;
+import catalog;
+import table_entry;
+import common_query_filter_cache;
 
 namespace infinity {
 
@@ -121,6 +125,14 @@ void MergeIntoBitmask(const VectorBuffer *input_bool_column_buffer,
 
 CommonQueryFilter::CommonQueryFilter(SharedPtr<BaseExpression> original_filter, SharedPtr<BaseTableRef> base_table_ref, TxnTimeStamp begin_ts)
     : begin_ts_(begin_ts), original_filter_(std::move(original_filter)), base_table_ref_(std::move(base_table_ref)) {
+    InitTasks();
+    if (original_filter_ and base_table_ref_->table_entry_ptr_) {
+        // the table dir is unique per table entry, so a dropped and recreated table never sees stale results
+        filter_cache_key_ = fmt::format("{}#{}", *base_table_ref_->table_entry_ptr_->TableEntryDir(), original_filter_->ToString());
+    }
+}
+
+void CommonQueryFilter::InitTasks() {
     const auto &segment_index = base_table_ref_->block_index_->segment_block_index_;
     if (segment_index.empty()) {
         finish_build_.test_and_set(std::memory_order_release);
@@ -133,17 +145,61 @@ CommonQueryFilter::CommonQueryFilter(SharedPtr<BaseExpression> original_filter,
     }
 }
 
+void CommonQueryFilter::ResetForQuery(TxnTimeStamp begin_ts) {
+    begin_ts_ = begin_ts;
+    finish_build_.clear(std::memory_order_release);
+    filter_result_.clear();
+    filter_result_count_ = 0;
+    tasks_.clear();
+    total_task_num_ = 0;
+    begin_task_num_ = 0;
+    end_task_num_ = 0;
+    InitTasks();
+}
+
 void CommonQueryFilter::BuildFilter(u32 task_id, Txn *txn) {
-    auto *buffer_mgr = txn->buffer_mgr();
-    TxnTimeStamp begin_ts = txn->BeginTS();
     const auto &segment_index = base_table_ref_->block_index_->segment_block_index_;
     const SegmentID segment_id = tasks_[task_id];
     const SegmentEntry *segment_entry = segment_index.at(segment_id).segment_entry_;
+    // rows of a sealed segment never change, and the result does not depend on delete visibility,
+    // so it can be reused by later queries with the same filter
+    CommonQueryFilterCache *filter_cache = nullptr;
+    if (!filter_cache_key_.empty() and segment_entry->status() != SegmentStatus::kUnsealed) {
+        filter_cache = &(txn->GetCatalog()->filter_cache_);
+    }
+    const SizeT segment_row_count = segment_entry->row_count();
+    std::variant<Vector<u32>, Bitmask> result_elem;
+    if (filter_cache == nullptr or !filter_cache->Get(filter_cache_key_, segment_id, segment_row_count, result_elem)) {
+        result_elem = SolveSegmentFilter(segment_entry, segment_row_count, txn);
+        if (filter_cache != nullptr) {
+            filter_cache->Put(filter_cache_key_, segment_id, segment_row_count, result_elem);
+        }
+    }
+    if (const SizeT result_count = std::visit(Overload{[](const Vector<u32> &v) -> SizeT { return v.size(); },
+                                                       [segment_row_count](const Bitmask &m) -> SizeT {
+                                                           if (m.GetData() == nullptr) {
+                                                               return segment_row_count;
+                                                           }
+                                                           assert(m.count() >= segment_row_count);
+                                                           assert(m.CountTrue() >= m.count() - segment_row_count);
+                                                           return m.CountTrue() - (m.count() - segment_row_count);
+                                                       }},
+                                              result_elem);
+        result_count) {
+        std::lock_guard lock(result_mutex_);
+        filter_result_count_ += result_count;
+        filter_result_.emplace(segment_id, std::move(result_elem));
+    }
+}
+
+std::variant<Vector<u32>, Bitmask> CommonQueryFilter::SolveSegmentFilter(const SegmentEntry *segment_entry, const SizeT segment_row_count, Txn *txn) const {
+    auto *buffer_mgr = txn->buffer_mgr();
+    TxnTimeStamp begin_ts = txn->BeginTS();
+    const SegmentID segment_id = segment_entry->segment_id();
     if (!fast_rough_filter_evaluator_->Evaluate(begin_ts, *segment_entry->GetFastRoughFilter())) {
         // skip this segment
-        return;
+        return Vector<u32>{};
     }
-    const SizeT segment_row_count = segment_entry->row_count();
     const SizeT segment_actual_row_count = segment_entry->actual_row_count();
     auto result_elem = SolveSecondaryIndexFilter(filter_execute_command_,
                                                  secondary_index_column_index_map_,
@@ -153,7 +209,7 @@ void CommonQueryFilter::BuildFilter(u32 task_id, Txn *txn) {
                                                  txn);
     if (std::visit(Overload{[](const Vector<u32> &v) -> bool { return v.empty(); }, [](const Bitmask &) -> bool { return false; }}, result_elem)) {
         // empty result
-        return;
+        return result_elem;
     }
     if (filter_leftover_) {
         Bitmask bitmask;
@@ -203,21 +259,7 @@ void CommonQueryFilter::BuildFilter(u32 task_id, Txn *txn) {
                             [&bitmask](Bitmask &m) { m.Merge(bitmask); }},
                    result_elem);
     }
-    if (const SizeT result_count = std::visit(Overload{[](const Vector<u32> &v) -> SizeT { return v.size(); },
-                                                       [segment_row_count](const Bitmask &m) -> SizeT {
-                                                           if (m.GetData() == nullptr) {
-                                                               return segment_row_count;
-                                                           }
-                                                           assert(m.count() >= segment_row_count);
-                                                           assert(m.CountTrue() >= m.count() - segment_row_count);
-                                                           return m.CountTrue() - (m.count() - segment_row_count);
-                                                       }},
-                                              result_elem);
-        result_count) {
-        std::lock_guard lock(result_mutex_);
-        filter_result_count_ += result_count;
-        filter_result_.emplace(segment_id, std::move(result_elem));
-    }
+    return result_elem;
 }
 
 void CommonQueryFilter::TryApplyFastRoughFilterOptimizer() {
@@ -26,6 +26,7 @@ class QueryContext;
 class BufferManager;
 class Txn;
 struct TableIndexEntry;
+struct SegmentEntry;
 
 export struct CommonQueryFilter {
     TxnTimeStamp begin_ts_;
@@ -42,6 +43,8 @@ export struct CommonQueryFilter {
     SharedPtr<BaseExpression> secondary_index_filter_qualified_;
     HashMap<ColumnID, TableIndexEntry *> secondary_index_column_index_map_;
     Vector<FilterExecuteElem> filter_execute_command_;
+    // identifies the filter on this table in the shared filter result cache, empty if the result is not cacheable
+    String filter_cache_key_;
 
     // result
     atomic_flag finish_build_;
@@ -89,8 +92,17 @@ export struct CommonQueryFilter {
     void TryApplyFastRoughFilterOptimizer();
     void TryApplySecondaryIndexFilterOptimizer(QueryContext *query_context);
 
+    // reuse the filter of a cached plan in another query
+    // the block index of base_table_ref_ should have been refreshed for the new transaction
+    // the pushed down filters only depend on the table schema and are kept
+    void ResetForQuery(TxnTimeStamp begin_ts);
+
 private:
+    void InitTasks();
+
     void BuildFilter(u32 task_id, Txn *txn);
+
+    std::variant<Vector<u32>, Bitmask> SolveSegmentFilter(const SegmentEntry *segment_entry, SizeT segment_row_count, Txn *txn) const;
 };
 
 } // namespace infinity
\ No newline at end of file
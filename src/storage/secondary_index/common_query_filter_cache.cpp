@@ -0,0 +1,103 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module common_query_filter_cache;
+
+import stl;
+import bitmask;
+import third_party;
+import filter_value_type_classification;
+
+namespace infinity {
+
+namespace {
+
+SizeT ResultMemoryCost(const std::variant<Vector<u32>, Bitmask> &result) {
+    return std::visit(Overload{[](const Vector<u32> &v) -> SizeT { return v.size() * sizeof(u32); },
+                               [](const Bitmask &m) -> SizeT { return m.GetData() == nullptr ? 0 : m.count() / 8; }},
+                      result);
+}
+
+} // namespace
+
+String CommonQueryFilterCache::MakeKey(const String &filter_key, SegmentID segment_id) { return fmt::format("{}#{}", filter_key, segment_id); }
+
+void CommonQueryFilterCache::CopyResult(const std::variant<Vector<u32>, Bitmask> &src, std::variant<Vector<u32>, Bitmask> &dst) {
+    std::visit(Overload{[&dst](const Vector<u32> &v) { dst.emplace<Vector<u32>>(v); },
+                        [&dst](const Bitmask &m) { dst.emplace<Bitmask>().DeepCopy(m); }},
+               src);
+}
+
+bool CommonQueryFilterCache::Get(const String &filter_key,
+                                 SegmentID segment_id,
+                                 SizeT segment_row_count,
+                                 std::variant<Vector<u32>, Bitmask> &result) {
+    const String key = MakeKey(filter_key, segment_id);
+    std::lock_guard lock(mutex_);
+    auto map_iter = entry_map_.find(key);
+    if (map_iter == entry_map_.end()) {
+        ++miss_count_;
+        return false;
+    }
+    auto list_iter = map_iter->second;
+    if (list_iter->segment_row_count_ != segment_row_count) {
+        // the segment has changed since the result was cached
+        EraseNoLock(list_iter);
+        ++miss_count_;
+        return false;
+    }
+    lru_list_.splice(lru_list_.begin(), lru_list_, list_iter);
+    CopyResult(list_iter->result_, result);
+    ++hit_count_;
+    return true;
+}
+
+void CommonQueryFilterCache::Put(const String &filter_key,
+                                 SegmentID segment_id,
+                                 SizeT segment_row_count,
+                                 const std::variant<Vector<u32>, Bitmask> &result) {
+    String key = MakeKey(filter_key, segment_id);
+    const SizeT memory_cost = key.size() + ResultMemoryCost(result);
+    if (memory_cost > memory_limit_) {
+        return;
+    }
+    std::lock_guard lock(mutex_);
+    if (auto map_iter = entry_map_.find(key); map_iter != entry_map_.end()) {
+        EraseNoLock(map_iter->second);
+    }
+    while (!lru_list_.empty() && memory_usage_ + memory_cost > memory_limit_) {
+        EraseNoLock(--lru_list_.end());
+    }
+    lru_list_.push_front(CacheEntry{key, segment_row_count, memory_cost, {}});
+    CopyResult(result, lru_list_.front().result_);
+    entry_map_.emplace(std::move(key), lru_list_.begin());
+    memory_usage_ += memory_cost;
+}
+
+void CommonQueryFilterCache::Clear() {
+    std::lock_guard lock(mutex_);
+    entry_map_.clear();
+    lru_list_.clear();
+    memory_usage_ = 0;
+}
+
+void CommonQueryFilterCache::EraseNoLock(List<CacheEntry>::iterator iter) {
+    memory_usage_ -= iter->memory_cost_;
+    entry_map_.erase(iter->key_);
+    lru_list_.erase(iter);
+}
+
+} // namespace infinity
@@ -0,0 +1,73 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module common_query_filter_cache;
+
+import stl;
+import bitmask;
+
+namespace infinity {
+
+// Memory-bounded LRU cache of per-segment filter results, shared by all queries.
+// A result is the raw filter evaluation on the segment data, before delete visibility is applied,
+// so it only depends on the filter, the table and the rows of the segment.
+// Callers only cache sealed segments, whose row count never changes afterwards.
+export class CommonQueryFilterCache {
+public:
+    explicit CommonQueryFilterCache(SizeT memory_limit) : memory_limit_(memory_limit) {}
+
+    // return true and copy the cached result into `result` if there is a valid entry
+    bool Get(const String &filter_key, SegmentID segment_id, SizeT segment_row_count, std::variant<Vector<u32>, Bitmask> &result);
+
+    void Put(const String &filter_key, SegmentID segment_id, SizeT segment_row_count, const std::variant<Vector<u32>, Bitmask> &result);
+
+    void Clear();
+
+    SizeT memory_usage() const {
+        std::lock_guard lock(mutex_);
+        return memory_usage_;
+    }
+
+    SizeT hit_count() const { return hit_count_.load(); }
+
+    SizeT miss_count() const { return miss_count_.load(); }
+
+private:
+    struct CacheEntry {
+        String key_;
+        SizeT segment_row_count_;
+        SizeT memory_cost_;
+        std::variant<Vector<u32>, Bitmask> result_;
+    };
+
+    static String MakeKey(const String &filter_key, SegmentID segment_id);
+
+    static void CopyResult(const std::variant<Vector<u32>, Bitmask> &src, std::variant<Vector<u32>, Bitmask> &dst);
+
+    void EraseNoLock(List<CacheEntry>::iterator iter);
+
+    const SizeT memory_limit_;
+    mutable std::mutex mutex_;
+    SizeT memory_usage_ = 0;
+    // most recently used entry at the front
+    List<CacheEntry> lru_list_;
+    HashMap<String, List<CacheEntry>::iterator> entry_map_;
+
+    Atomic<SizeT> hit_count_{0};
+    Atomic<SizeT> miss_count_{0};
+};
+
+} // namespace infinity
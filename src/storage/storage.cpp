@@ -89,6 +89,7 @@ void Storage::Init() {
 
     if (enable_compaction || enable_optimize) {
         compact_processor_ = MakeUnique<CompactionProcessor>(new_catalog_.get(), txn_mgr_.get());
+        compact_processor_->rate_limiter()->SetRate(config_ptr_->CompactionIORate());
     } else {
         LOG_WARN("Compact interval is not set, auto compact is disable");
     }
@@ -393,6 +393,15 @@ void Txn::SetTxnCommitting(TxnTimeStamp commit_ts) {
 
 WalEntry *Txn::GetWALEntry() const { return wal_entry_.get(); }
 
+bool Txn::ChangesSchema() const {
+    for (const auto &cmd : wal_entry_->cmds_) {
+        if (IsSchemaChange(cmd->GetType())) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // void Txn::Begin() {
 //     TxnTimeStamp ts = txn_mgr_->GetBeginTimestamp(txn_id_);
 //     LOG_TRACE(fmt::format("Txn: {} is Begin. begin ts: {}", txn_id_, ts));
@@ -210,6 +210,9 @@ public:
 
     WalEntry *GetWALEntry() const;
 
+    // the txn creates or drops a database, table or index
+    bool ChangesSchema() const;
+
     const SharedPtr<String> GetTxnText() const {
         return txn_text_;
     }
@@ -122,6 +122,12 @@ TxnTimeStamp TxnManager::GetCommitTimeStampW(Txn *txn) {
     wait_conflict_ck_.emplace(commit_ts, nullptr);
     finishing_txns_.emplace(txn);
     txn->SetTxnWrite();
+    // The txns beginning after commit_ts see the new schema once this txn is committing, long before its bottom runs. The
+    // version is bumped under the lock that gives out their begin ts, so they read it too and don't take a plan of the old schema.
+    // A txn rolled back by a conflict leaves the version bumped, which only drops the cached plans.
+    if (txn->ChangesSchema()) {
+        catalog_->schema_version_.store(commit_ts);
+    }
     return commit_ts;
 }
 
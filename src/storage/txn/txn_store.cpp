@@ -377,6 +377,9 @@ void TxnTableStore::Commit(TransactionID txn_id, TxnTimeStamp commit_ts) {
     for (auto [table_index_entry, ptr_seq_n] : txn_indexes_) {
         table_index_entry->Commit(commit_ts);
     }
+    if (has_update_) {
+        table_entry_->CommitDataVersion(commit_ts);
+    }
 }
 
 void TxnTableStore::MaintainCompactionAlg() {
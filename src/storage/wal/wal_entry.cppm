@@ -65,6 +65,24 @@ export enum class WalCommandType : i8 {
     COMPACT = 100,
 };
 
+// the command changes the catalog, rather than the data of a table
+export inline bool IsSchemaChange(WalCommandType type) {
+    switch (type) {
+        case WalCommandType::CREATE_DATABASE:
+        case WalCommandType::DROP_DATABASE:
+        case WalCommandType::CREATE_TABLE:
+        case WalCommandType::DROP_TABLE:
+        case WalCommandType::ALTER_INFO:
+        case WalCommandType::CREATE_INDEX:
+        case WalCommandType::DROP_INDEX: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
 export struct WalBlockInfo {
     BlockID block_id_{};
     u16 row_count_{};
@@ -54,6 +54,8 @@ import default_values;
 import defer_op;
 import index_base;
 import base_table_ref;
+import metrics;
+import resource_manager;
 
 module wal_manager;
 
@@ -160,6 +162,9 @@ void WalManager::Flush() {
 
     Deque<WalEntry *> log_batch{};
     TxnManager *txn_mgr = storage_->txn_manager();
+    auto &metrics_registry = MetricsRegistry::instance();
+    MetricHistogram *sync_metric = metrics_registry.Histogram("infinity_wal_sync_seconds", "Time of flushing a batch of wal entries to the file");
+    MetricCounter *write_bytes_metric = metrics_registry.Counter("infinity_wal_write_bytes_total", "Bytes written to the wal");
     while (running_.load()) {
         wait_flush_.DequeueBulk(log_batch);
         if (log_batch.empty()) {
@@ -197,24 +202,28 @@ void WalManager::Flush() {
             // update
             max_commit_ts_ = entry->commit_ts_;
             wal_size_ += act_size;
+            write_bytes_metric->Add(act_size);
         }
 
         if (!running_.load()) {
             break;
         }
 
-        switch (flush_option_) {
-            case FlushOptionType::kFlushAtOnce: {
-                ofs_.flush();
-                break;
-            }
-            case FlushOptionType::kOnlyWrite: {
-                ofs_.flush(); // FIXME: not flush, only write
-                break;
-            }
-            case FlushOptionType::kFlushPerSecond: {
-                ofs_.flush(); // FIXME: not flush, flush per second
-                break;
+        {
+            MetricTimer timer(sync_metric);
+            switch (flush_option_) {
+                case FlushOptionType::kFlushAtOnce: {
+                    ofs_.flush();
+                    break;
+                }
+                case FlushOptionType::kOnlyWrite: {
+                    ofs_.flush(); // FIXME: not flush, only write
+                    break;
+                }
+                case FlushOptionType::kFlushPerSecond: {
+                    ofs_.flush(); // FIXME: not flush, flush per second
+                    break;
+                }
             }
         }
 
@@ -529,8 +538,8 @@ i64 WalManager::ReplayWalFile() {
         last_txn_id = replay_entries[replay_count]->txn_id_;
 
         LOG_TRACE(replay_entries[replay_count]->ToString());
-        ReplayWalEntry(*replay_entries[replay_count]);
     }
+    ReplayWalEntries(replay_entries);
 
     LOG_INFO(fmt::format("System start ts: {}, latest txn id: {}", system_start_ts, last_txn_id));
     storage_->catalog()->next_txn_id_ = last_txn_id;
@@ -543,74 +552,141 @@ i64 WalManager::ReplayWalFile() {
     return system_start_ts;
 }
 
-void WalManager::ReplayWalEntry(const WalEntry &entry) {
-    for (const auto &cmd : entry.cmds_) {
-        LOG_TRACE(fmt::format("Replay wal cmd: {}, commit ts: {}", WalCmd::WalCommandTypeToString(cmd->GetType()).c_str(), entry.commit_ts_));
-        switch (cmd->GetType()) {
-            case WalCommandType::CREATE_DATABASE: {
-                WalCmdCreateDatabaseReplay(*dynamic_cast<const WalCmdCreateDatabase *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DROP_DATABASE: {
-                WalCmdDropDatabaseReplay(*dynamic_cast<const WalCmdDropDatabase *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::CREATE_TABLE: {
-                WalCmdCreateTableReplay(*dynamic_cast<const WalCmdCreateTable *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DROP_TABLE: {
-                WalCmdDropTableReplay(*dynamic_cast<const WalCmdDropTable *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::ALTER_INFO: {
-                Status status = Status::NotSupport("WalCmdAlterInfo Replay Not implemented");
-                LOG_ERROR(status.message());
-                RecoverableError(status);
-                break;
-            }
-            case WalCommandType::CREATE_INDEX: {
-                WalCmdCreateIndexReplay(*dynamic_cast<const WalCmdCreateIndex *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DROP_INDEX: {
-                WalCmdDropIndexReplay(*dynamic_cast<const WalCmdDropIndex *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::IMPORT: {
-                WalCmdImportReplay(*dynamic_cast<const WalCmdImport *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::APPEND: {
-                WalCmdAppendReplay(*dynamic_cast<const WalCmdAppend *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DELETE: {
-                WalCmdDeleteReplay(*dynamic_cast<const WalCmdDelete *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            // case WalCommandType::SET_SEGMENT_STATUS_SEALED:
-            //     WalCmdSetSegmentStatusSealedReplay(*dynamic_cast<const WalCmdSetSegmentStatusSealed *>(cmd.get()), entry.txn_id_,
-            //     entry.commit_ts_); break;
-            // case WalCommandType::UPDATE_SEGMENT_BLOOM_FILTER_DATA:
-            //     WalCmdUpdateSegmentBloomFilterDataReplay(*dynamic_cast<const WalCmdUpdateSegmentBloomFilterData *>(cmd.get()),
-            //                                              entry.txn_id_,
-            //                                              entry.commit_ts_);
-            //     break;
-            case WalCommandType::CHECKPOINT: {
-                break;
+/**
+ * @brief Replay the entries in wal order, dispatching DML to several threads.
+ *  - APPEND and DELETE commands are batched per table. Commands of one table keep their wal order, since an append decides its
+ *    segment and row ids at apply time and a later delete may refer to those rows. Batches of different tables are replayed
+ *    concurrently on the shared thread pool.
+ *  - All other commands (DDL, IMPORT, COMPACT) are barriers: the pending batches are drained before the command is replayed.
+ */
+void WalManager::ReplayWalEntries(const Vector<SharedPtr<WalEntry>> &replay_entries) {
+    struct ReplayCmd {
+        WalCmd *cmd_;
+        TransactionID txn_id_;
+        TxnTimeStamp commit_ts_;
+    };
+    // table key -> commands in wal order
+    HashMap<String, Vector<ReplayCmd>> table_batches;
+    SizeT batched_cmd_count = 0;
+    SizeT barrier_count = 0;
+
+    auto drain_batches = [&]() {
+        if (table_batches.empty()) {
+            return;
+        }
+        Vector<Vector<ReplayCmd> *> batches;
+        batches.reserve(table_batches.size());
+        for (auto &[table_key, batch] : table_batches) {
+            batches.push_back(&batch);
+        }
+        // an error of one batch is rethrown here after the other batches finish, like a replay on this thread
+        SharedParallelFor(TaskClass::kIngest, batches.size(), [&](SizeT batch_idx) {
+            for (const auto &replay_cmd : *batches[batch_idx]) {
+                ReplayWalCmd(replay_cmd.cmd_, replay_cmd.txn_id_, replay_cmd.commit_ts_);
             }
-            case WalCommandType::COMPACT: {
-                WalCmdCompactReplay(*static_cast<const WalCmdCompact *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            default: {
-                String error_message = "WalManager::ReplayWalEntry unknown wal command type";
-                LOG_CRITICAL(error_message);
-                UnrecoverableError(error_message);
+        });
+        table_batches.clear();
+    };
+
+    for (const auto &entry : replay_entries) {
+        for (const auto &cmd : entry->cmds_) {
+            switch (cmd->GetType()) {
+                case WalCommandType::APPEND: {
+                    const auto *append_cmd = static_cast<const WalCmdAppend *>(cmd.get());
+                    String table_key = fmt::format("{}.{}", append_cmd->db_name_, append_cmd->table_name_);
+                    table_batches[table_key].push_back(ReplayCmd{cmd.get(), entry->txn_id_, entry->commit_ts_});
+                    ++batched_cmd_count;
+                    break;
+                }
+                case WalCommandType::DELETE: {
+                    const auto *delete_cmd = static_cast<const WalCmdDelete *>(cmd.get());
+                    String table_key = fmt::format("{}.{}", delete_cmd->db_name_, delete_cmd->table_name_);
+                    table_batches[table_key].push_back(ReplayCmd{cmd.get(), entry->txn_id_, entry->commit_ts_});
+                    ++batched_cmd_count;
+                    break;
+                }
+                case WalCommandType::CHECKPOINT: {
+                    break;
+                }
+                default: {
+                    drain_batches();
+                    ReplayWalCmd(cmd.get(), entry->txn_id_, entry->commit_ts_);
+                    ++barrier_count;
+                    break;
+                }
             }
         }
     }
+    drain_batches();
+    LOG_INFO(fmt::format("Replayed {} append/delete commands in parallel batches, {} barrier commands", batched_cmd_count, barrier_count));
+}
+
+void WalManager::ReplayWalCmd(WalCmd *cmd, TransactionID txn_id, TxnTimeStamp commit_ts) {
+    LOG_TRACE(fmt::format("Replay wal cmd: {}, commit ts: {}", WalCmd::WalCommandTypeToString(cmd->GetType()).c_str(), commit_ts));
+    switch (cmd->GetType()) {
+        case WalCommandType::CREATE_DATABASE: {
+            WalCmdCreateDatabaseReplay(*dynamic_cast<const WalCmdCreateDatabase *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DROP_DATABASE: {
+            WalCmdDropDatabaseReplay(*dynamic_cast<const WalCmdDropDatabase *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::CREATE_TABLE: {
+            WalCmdCreateTableReplay(*dynamic_cast<const WalCmdCreateTable *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DROP_TABLE: {
+            WalCmdDropTableReplay(*dynamic_cast<const WalCmdDropTable *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::ALTER_INFO: {
+            Status status = Status::NotSupport("WalCmdAlterInfo Replay Not implemented");
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+            break;
+        }
+        case WalCommandType::CREATE_INDEX: {
+            WalCmdCreateIndexReplay(*dynamic_cast<const WalCmdCreateIndex *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DROP_INDEX: {
+            WalCmdDropIndexReplay(*dynamic_cast<const WalCmdDropIndex *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::IMPORT: {
+            WalCmdImportReplay(*dynamic_cast<const WalCmdImport *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::APPEND: {
+            WalCmdAppendReplay(*dynamic_cast<const WalCmdAppend *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DELETE: {
+            WalCmdDeleteReplay(*dynamic_cast<const WalCmdDelete *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        // case WalCommandType::SET_SEGMENT_STATUS_SEALED:
+        //     WalCmdSetSegmentStatusSealedReplay(*dynamic_cast<const WalCmdSetSegmentStatusSealed *>(cmd.get()), entry.txn_id_,
+        //     entry.commit_ts_); break;
+        // case WalCommandType::UPDATE_SEGMENT_BLOOM_FILTER_DATA:
+        //     WalCmdUpdateSegmentBloomFilterDataReplay(*dynamic_cast<const WalCmdUpdateSegmentBloomFilterData *>(cmd.get()),
+        //                                              entry.txn_id_,
+        //                                              entry.commit_ts_);
+        //     break;
+        case WalCommandType::CHECKPOINT: {
+            break;
+        }
+        case WalCommandType::COMPACT: {
+            WalCmdCompactReplay(*static_cast<const WalCmdCompact *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        default: {
+            String error_message = "WalManager::ReplayWalCmd unknown wal command type";
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+    }
 }
 
 void WalManager::WalCmdCreateDatabaseReplay(const WalCmdCreateDatabase &cmd, TransactionID txn_id, TxnTimeStamp commit_ts) {
@@ -63,7 +63,7 @@ public:
 
     i64 ReplayWalFile();
 
-    void ReplayWalEntry(const WalEntry &entry);
+    void ReplayWalEntries(const Vector<SharedPtr<WalEntry>> &replay_entries);
 
     void RecycleWalFile(TxnTimeStamp full_ckp_ts);
 
@@ -80,6 +80,8 @@ private:
 
     void SetLastCkpWalSize(i64 wal_size);
 
+    void ReplayWalCmd(WalCmd *cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
+
     void WalCmdCreateDatabaseReplay(const WalCmdCreateDatabase &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     void WalCmdDropDatabaseReplay(const WalCmdDropDatabase &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     void WalCmdCreateTableReplay(const WalCmdCreateTable &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
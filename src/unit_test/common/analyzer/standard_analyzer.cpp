@@ -138,3 +138,26 @@ TEST_F(StandardAnalyzerTest, test6) {
         std::cout << std::endl;
     }
 }
+
+TEST_F(StandardAnalyzerTest, analyze_terms) {
+    StandardAnalyzer analyzer;
+    analyzer.SetExtractEngStem(false);
+    analyzer.SetExtractSpecialChar(true, true);
+    // runs longer than a SIMD register, digits, non-ASCII bytes and punctuation
+    String input("Internationalization2024 of the Encyclopædia,, Britannica... 42 x");
+    TermList term_list;
+    analyzer.Analyze(input, term_list);
+
+    Vector<Pair<String, u32>> terms;
+    auto on_term = [&](const char *text, u32 len, u32 offset) { terms.emplace_back(String(text, len), offset); };
+    int ret = analyzer.AnalyzeTerms(input, on_term);
+    EXPECT_GT(ret, 0);
+    ASSERT_EQ(terms.size(), term_list.size());
+    for (SizeT i = 0; i < terms.size(); ++i) {
+        EXPECT_EQ(terms[i].first, term_list[i].text_);
+        EXPECT_EQ(terms[i].second, term_list[i].word_offset_);
+    }
+    ASSERT_GE(terms.size(), 2u);
+    EXPECT_EQ(terms[0].first, String("internationalization2024"));
+    EXPECT_EQ(terms[1].first, String("of"));
+}
@@ -0,0 +1,58 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import tokenizer;
+
+using namespace infinity;
+
+class TokenizerTest : public BaseTest {
+protected:
+    static Vector<String> Tokens(Tokenizer &tokenizer, const String &input) {
+        Vector<String> tokens;
+        tokenizer.Tokenize(input);
+        while (tokenizer.NextToken()) {
+            tokens.emplace_back(tokenizer.GetToken(), tokenizer.GetLength());
+        }
+        return tokens;
+    }
+};
+
+TEST_F(TokenizerTest, default_table) {
+    Tokenizer tokenizer;
+    String input("abcdefghijklmnopqrstuvwxyz0123456789 Hello,world \xff");
+    tokenizer.Tokenize(input);
+    // the tokens without united chars point into the input
+    ASSERT_TRUE(tokenizer.NextToken());
+    EXPECT_EQ(tokenizer.GetToken(), input.data());
+    EXPECT_EQ(tokenizer.GetLength(), 36u);
+    EXPECT_FALSE(tokenizer.IsDelimiter());
+
+    Vector<String> tokens = Tokens(tokenizer, input);
+    Vector<String> expected = {"abcdefghijklmnopqrstuvwxyz0123456789", "Hello", ",", "world", "\xff"};
+    EXPECT_EQ(tokens, expected);
+}
+
+TEST_F(TokenizerTest, united_chars) {
+    Tokenizer tokenizer;
+    TokenizeConfig config;
+    config.AddUnites("-");
+    config.AddAllows("_");
+    tokenizer.SetConfig(config);
+    Vector<String> tokens = Tokens(tokenizer, "e-mail snake_case a-b-c.");
+    Vector<String> expected = {"email", "snake_case", "abc", "."};
+    EXPECT_EQ(tokens, expected);
+}
@@ -0,0 +1,53 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "unit_test/base_test.h"
+#include <thread>
+
+import stl;
+import numa_topology;
+
+using namespace infinity;
+
+class NumaTopologyTest : public BaseTest {};
+
+TEST_F(NumaTopologyTest, parse_cpu_list) {
+    EXPECT_EQ(NumaTopology::ParseCpuList("0-3,8,10-11\n"), (Vector<u32>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(NumaTopology::ParseCpuList("5"), (Vector<u32>{5}));
+    EXPECT_TRUE(NumaTopology::ParseCpuList("").empty());
+    EXPECT_TRUE(NumaTopology::ParseCpuList("\n").empty());
+}
+
+TEST_F(NumaTopologyTest, node_of_cpu) {
+    NumaTopology topology({{0, 1, 4}, {2, 3}}, {0, 1});
+    EXPECT_EQ(topology.node_count(), 2u);
+    EXPECT_EQ(topology.NodeOfCpu(4), 0u);
+    EXPECT_EQ(topology.NodeOfCpu(3), 1u);
+    EXPECT_EQ(topology.NodeOfCpu(100), 0u);
+    EXPECT_EQ(topology.NodeCpus(1), (Vector<u32>{2, 3}));
+}
+
+TEST_F(NumaTopologyTest, instance) {
+    const NumaTopology &topology = NumaTopology::instance();
+    ASSERT_GE(topology.node_count(), 1u);
+    for (SizeT node = 0; node < topology.node_count(); ++node) {
+        EXPECT_FALSE(topology.NodeCpus(node).empty());
+    }
+
+    EXPECT_EQ(NumaTopology::ThreadNode(), -1);
+    std::thread([] {
+        NumaTopology::SetThreadNode(0);
+        EXPECT_EQ(NumaTopology::ThreadNode(), 0);
+    }).join();
+    EXPECT_EQ(NumaTopology::ThreadNode(), -1);
+}
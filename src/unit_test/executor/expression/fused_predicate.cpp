@@ -0,0 +1,141 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import catalog;
+import scalar_function;
+import scalar_function_set;
+import base_expression;
+import function_expression;
+import reference_expression;
+import value_expression;
+import cast_expression;
+import cast_function;
+import fused_predicate;
+import expression_selector;
+import selection;
+import bitmask_buffer;
+import data_block;
+import column_vector;
+import value;
+import and_func;
+import or_func;
+import equals;
+import greater;
+import less;
+import logical_type;
+import internal_types;
+import data_type;
+
+using namespace infinity;
+
+class FusedPredicateTest : public BaseTest {
+protected:
+    void SetUp() override {
+        BaseTest::SetUp();
+        catalog_ptr_ = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+        RegisterAndFunction(catalog_ptr_);
+        RegisterOrFunction(catalog_ptr_);
+        RegisterEqualsFunction(catalog_ptr_);
+        RegisterGreaterFunction(catalog_ptr_);
+        RegisterLessFunction(catalog_ptr_);
+    }
+
+    SharedPtr<BaseExpression> MakeFunction(const String &name, Vector<SharedPtr<BaseExpression>> arguments) {
+        auto function_set = std::static_pointer_cast<ScalarFunctionSet>(Catalog::GetFunctionSetByName(catalog_ptr_.get(), name));
+        ScalarFunction func = function_set->GetMostMatchFunction(arguments);
+        return MakeShared<FunctionExpression>(std::move(func), std::move(arguments));
+    }
+
+    UniquePtr<Catalog> catalog_ptr_;
+};
+
+TEST_F(FusedPredicateTest, evaluate) {
+    // a: Integer, b: BigInt, c: Double
+    auto a = ReferenceExpression::Make(DataType(LogicalType::kInteger), "t1", "a", "a", 0);
+    auto b = ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "b", "b", 1);
+    auto c = ReferenceExpression::Make(DataType(LogicalType::kDouble), "t1", "c", "c", 2);
+    DataType bigint_type(LogicalType::kBigInt);
+    auto cast_a = MakeShared<CastExpression>(CastFunction::GetBoundFunc(DataType(LogicalType::kInteger), bigint_type), a, bigint_type);
+
+    // (CAST(a AS BigInt) > 5 AND b < 700) OR 2.5 = c
+    auto expr = MakeFunction("OR",
+                             {MakeFunction("AND",
+                                           {MakeFunction(">", {cast_a, MakeShared<ValueExpression>(Value::MakeBigInt(5))}),
+                                            MakeFunction("<", {b, MakeShared<ValueExpression>(Value::MakeBigInt(700))})}),
+                              MakeFunction("=", {MakeShared<ValueExpression>(Value::MakeDouble(2.5)), c})});
+    UniquePtr<FusedPredicate> predicate = FusedPredicate::Make(expr);
+    ASSERT_NE(predicate.get(), nullptr);
+    EXPECT_EQ(predicate->ToString(), "((a > 5 AND b < 700) OR c = 2.500000)");
+
+    // not a multiple of 64 rows
+    constexpr SizeT row_count = 1000;
+    DataBlock data_block;
+    data_block.Init({MakeShared<DataType>(LogicalType::kInteger), MakeShared<DataType>(LogicalType::kBigInt), MakeShared<DataType>(LogicalType::kDouble)});
+    for (SizeT i = 0; i < row_count; ++i) {
+        data_block.AppendValue(0, Value::MakeInt(i % 20));
+        data_block.AppendValue(1, Value::MakeBigInt(i));
+        data_block.AppendValue(2, Value::MakeDouble(i * 0.5));
+    }
+    data_block.Finalize();
+    // a is null in every 7th row
+    for (SizeT i = 0; i < row_count; i += 7) {
+        data_block.column_vectors[0]->nulls_ptr_->SetFalse(i);
+    }
+
+    Vector<u64> row_bits(BitmaskBuffer::UnitCount(row_count));
+    ASSERT_TRUE(predicate->Evaluate(data_block, row_count, row_bits.data()));
+    SharedPtr<Selection> selection = MakeShared<Selection>();
+    selection->Initialize(row_count);
+    ExpressionSelector::Select(row_bits.data(), row_count, selection);
+
+    Vector<SizeT> expected;
+    for (SizeT i = 0; i < row_count; ++i) {
+        if ((i % 7 != 0 && i % 20 > 5 && i < 700) || i == 5) {
+            expected.push_back(i);
+        }
+    }
+    ASSERT_EQ(selection->Size(), expected.size());
+    for (SizeT idx = 0; idx < expected.size(); ++idx) {
+        EXPECT_EQ(selection->Get(idx), expected[idx]);
+    }
+}
+
+TEST_F(FusedPredicateTest, unsupported_shape) {
+    auto a = ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "a", "a", 0);
+    auto b = ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "b", "b", 1);
+    auto s = ReferenceExpression::Make(DataType(LogicalType::kVarchar), "t1", "s", "s", 2);
+
+    // column compared with column
+    EXPECT_EQ(FusedPredicate::Make(MakeFunction("<", {a, b})).get(), nullptr);
+    // not a fixed width column
+    EXPECT_EQ(FusedPredicate::Make(MakeFunction("=", {s, MakeShared<ValueExpression>(Value::MakeVarchar("x"))})).get(), nullptr);
+    // one unsupported child disables the whole tree
+    EXPECT_EQ(FusedPredicate::Make(MakeFunction("AND", {MakeFunction("<", {a, b}), MakeFunction("<", {a, MakeShared<ValueExpression>(Value::MakeBigInt(1))})}))
+                  .get(),
+              nullptr);
+
+    // a constant column is left to the expression evaluator
+    auto predicate = FusedPredicate::Make(MakeFunction("<", {a, MakeShared<ValueExpression>(Value::MakeBigInt(1))}));
+    ASSERT_NE(predicate.get(), nullptr);
+    auto column = ColumnVector::Make(MakeShared<DataType>(LogicalType::kBigInt));
+    column->Initialize(ColumnVectorType::kConstant);
+    column->AppendValue(Value::MakeBigInt(0));
+    DataBlock data_block;
+    data_block.Init({column});
+    u64 row_bits = 0;
+    EXPECT_FALSE(predicate->Evaluate(data_block, 1, &row_bits));
+}
@@ -0,0 +1,108 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import data_block;
+import value;
+import internal_types;
+import logical_type;
+import data_type;
+import selection;
+import physical_limit;
+
+using namespace infinity;
+
+class PhysicalLimitTest : public BaseTest {
+protected:
+    // blocks of block_rows rows with the values first, first + 1, ..., only the even values kept when selected
+    static UniquePtr<DataBlock> MakeBlock(i32 first, SizeT block_rows, bool selected) {
+        Vector<SharedPtr<DataType>> column_types{MakeShared<DataType>(LogicalType::kInteger)};
+        auto data_block = DataBlock::MakeUniquePtr();
+        data_block->Init(column_types);
+        for (SizeT i = 0; i < block_rows; ++i) {
+            data_block->AppendValue(0, Value::MakeInt(first + static_cast<i32>(i)));
+        }
+        data_block->Finalize();
+        if (selected) {
+            auto selection = MakeShared<Selection>();
+            selection->Initialize(block_rows);
+            for (SizeT i = 0; i < block_rows; i += 2) {
+                selection->Append(i);
+            }
+            data_block->SetSelection(selection);
+        }
+        return data_block;
+    }
+
+    static Vector<i32> Run(const Vector<UniquePtr<DataBlock>> &input_blocks, i64 offset, i64 limit) {
+        UnSyncCounter counter(offset, limit);
+        Vector<UniquePtr<DataBlock>> output_blocks;
+        PhysicalLimit::Execute(nullptr, input_blocks, output_blocks, &counter);
+        Vector<i32> res;
+        for (const auto &block : output_blocks) {
+            for (SizeT i = 0; i < block->row_count(); ++i) {
+                res.push_back(block->GetValue(0, i).value_.integer);
+            }
+        }
+        return res;
+    }
+};
+
+TEST_F(PhysicalLimitTest, offset_inside_block) {
+    Vector<UniquePtr<DataBlock>> input_blocks;
+    input_blocks.push_back(MakeBlock(0, 10, false));
+    input_blocks.push_back(MakeBlock(10, 10, false));
+
+    EXPECT_EQ(Run(input_blocks, 3, 4), (Vector<i32>{3, 4, 5, 6}));
+    // the rest of the first block and part of the second one
+    EXPECT_EQ(Run(input_blocks, 7, 5), (Vector<i32>{7, 8, 9, 10, 11}));
+    // more than is left
+    EXPECT_EQ(Run(input_blocks, 15, 100), (Vector<i32>{15, 16, 17, 18, 19}));
+    // the offset ends right at a block end
+    EXPECT_EQ(Run(input_blocks, 10, 2), (Vector<i32>{10, 11}));
+}
+
+TEST_F(PhysicalLimitTest, offset_inside_selected_block) {
+    Vector<UniquePtr<DataBlock>> input_blocks;
+    input_blocks.push_back(MakeBlock(0, 10, true));
+    input_blocks.push_back(MakeBlock(10, 10, true));
+
+    // the selected rows are 0, 2, ..., 18, five in each block
+    EXPECT_EQ(Run(input_blocks, 2, 2), (Vector<i32>{4, 6}));
+    EXPECT_EQ(Run(input_blocks, 3, 4), (Vector<i32>{6, 8, 10, 12}));
+    EXPECT_EQ(Run(input_blocks, 4, 100), (Vector<i32>{8, 10, 12, 14, 16, 18}));
+    EXPECT_EQ(Run(input_blocks, 5, 1), (Vector<i32>{10}));
+}
+
+TEST_F(PhysicalLimitTest, offset_beyond_input) {
+    // the offset skips the whole first input, the window is in the second one
+    UnSyncCounter counter(12, 3);
+    Vector<UniquePtr<DataBlock>> first_input;
+    first_input.push_back(MakeBlock(0, 10, true));
+    Vector<UniquePtr<DataBlock>> output_blocks;
+    PhysicalLimit::Execute(nullptr, first_input, output_blocks, &counter);
+    EXPECT_TRUE(output_blocks.empty());
+
+    Vector<UniquePtr<DataBlock>> second_input;
+    second_input.push_back(MakeBlock(10, 20, false));
+    PhysicalLimit::Execute(nullptr, second_input, output_blocks, &counter);
+    ASSERT_EQ(output_blocks.size(), 1u);
+    ASSERT_EQ(output_blocks[0]->row_count(), 3u);
+    for (SizeT i = 0; i < 3; ++i) {
+        EXPECT_EQ(output_blocks[0]->GetValue(0, i).value_.integer, static_cast<i32>(17 + i));
+    }
+    EXPECT_TRUE(counter.IsLimitOver());
+}
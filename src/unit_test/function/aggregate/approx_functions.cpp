@@ -0,0 +1,271 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import third_party;
+import catalog;
+import approx_sketch;
+import approx_count_distinct;
+import approx_percentile;
+import approx_top_k;
+import count_distinct;
+import function_set;
+import aggregate_function_set;
+import aggregate_function;
+import column_expression;
+import column_vector;
+import value;
+import default_values;
+import data_block;
+import internal_types;
+import logical_type;
+import data_type;
+
+using namespace infinity;
+
+class ApproxFunctionTest : public BaseTest {
+protected:
+    static AggregateFunction GetFunction(const UniquePtr<Catalog> &catalog_ptr, const String &name, LogicalType input_type) {
+        SharedPtr<FunctionSet> function_set = Catalog::GetFunctionSetByName(catalog_ptr.get(), name);
+        auto aggregate_function_set = std::static_pointer_cast<AggregateFunctionSet>(function_set);
+        auto col_expr_ptr = MakeShared<ColumnExpression>(DataType(input_type), "t1", 1, "c1", 0, 0);
+        return aggregate_function_set->GetMostMatchFunction(col_expr_ptr);
+    }
+
+    // i % distinct_count for i in [begin, end)
+    static void FillBigIntBlock(DataBlock &data_block, SizeT begin, SizeT end, SizeT distinct_count) {
+        Vector<SharedPtr<DataType>> column_types{MakeShared<DataType>(LogicalType::kBigInt)};
+        data_block.Init(column_types);
+        for (SizeT i = begin; i < end; ++i) {
+            data_block.AppendValue(0, Value::MakeBigInt(i % distinct_count));
+        }
+        data_block.Finalize();
+    }
+
+    static Vector<SharedPtr<DataType>> VarcharTypes() { return {MakeShared<DataType>(LogicalType::kVarchar)}; }
+};
+
+TEST_F(ApproxFunctionTest, HyperLogLog) {
+    HyperLogLog hll1, hll2;
+    hll1.Initialize();
+    hll2.Initialize();
+    EXPECT_EQ(hll1.Count(), 0u);
+    for (u64 i = 0; i < 100000; ++i) {
+        (i < 60000 ? hll1 : hll2).Add(SketchHash(&i, sizeof(i)));
+        // duplicates don't count
+        hll2.Add(SketchHash(&i, sizeof(i)));
+    }
+    EXPECT_NEAR(f64(hll2.Count()), 100000, 100000 * 0.05);
+    hll1.Merge(hll2);
+    EXPECT_NEAR(f64(hll1.Count()), 100000, 100000 * 0.05);
+
+    HyperLogLog small;
+    small.Initialize();
+    for (u64 i = 0; i < 100; ++i) {
+        small.Add(SketchHash(&i, sizeof(i)));
+    }
+    EXPECT_NEAR(f64(small.Count()), 100, 3);
+}
+
+TEST_F(ApproxFunctionTest, TDigest) {
+    auto digest1 = MakeUnique<TDigest>();
+    auto digest2 = MakeUnique<TDigest>();
+    digest1->Initialize();
+    digest2->Initialize();
+    EXPECT_TRUE(std::isnan(digest1->Quantile(0.5)));
+    // 0..99999 shuffled between two digests
+    for (SizeT i = 0; i < 100000; ++i) {
+        ((i * 7919) % 2 == 0 ? digest1 : digest2)->Add((i * 7919) % 100000);
+    }
+    digest1->Merge(*digest2);
+    EXPECT_EQ(digest1->total_weight(), 100000);
+    EXPECT_NEAR(digest1->Quantile(0.5), 50000, 500);
+    EXPECT_NEAR(digest1->Quantile(0.99), 99000, 100);
+    EXPECT_NEAR(digest1->Quantile(0.001), 100, 20);
+    EXPECT_EQ(digest1->Quantile(0), 0);
+    EXPECT_EQ(digest1->Quantile(1), 99999);
+}
+
+TEST_F(ApproxFunctionTest, SpaceSaving) {
+    SpaceSaving<i64> summary1(8), summary2(8);
+    // 0 and 1 are heavy hitters, the others appear once
+    for (i64 i = 0; i < 1000; ++i) {
+        summary1.Add(i % 2 == 0 ? 0 : 100 + i);
+        summary2.Add(i % 3 == 0 ? 1 : 100 + i);
+    }
+    String serialized;
+    summary2.Serialize(serialized);
+    summary1.Merge(SpaceSaving<i64>::Deserialize(serialized));
+    auto top = summary1.TopK(2);
+    ASSERT_EQ(top.size(), 2u);
+    EXPECT_EQ(top[0].first, 0);
+    EXPECT_GE(top[0].second, 500u);
+    EXPECT_EQ(top[1].first, 1);
+    EXPECT_GE(top[1].second, 334u);
+
+    SpaceSaving<String> strings(4);
+    strings.Add("a", 3);
+    strings.Add("b");
+    String serialized_strings;
+    strings.Serialize(serialized_strings);
+    auto top_strings = SpaceSaving<String>::Deserialize(serialized_strings).TopK(4);
+    ASSERT_EQ(top_strings.size(), 2u);
+    EXPECT_EQ(top_strings[0], MakePair(String("a"), u64(3)));
+    EXPECT_EQ(top_strings[1], MakePair(String("b"), u64(1)));
+}
+
+TEST_F(ApproxFunctionTest, CountDistinctMerge) {
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+    RegisterCountDistinctFunction(catalog_ptr);
+    RegisterApproxCountDistinctFunction(catalog_ptr);
+
+    for (const String name : {"count_distinct", "approx_count_distinct"}) {
+        AggregateFunction func = GetFunction(catalog_ptr, name, LogicalType::kBigInt);
+        ASSERT_TRUE(func.IsMergeable());
+
+        // two tasks see overlapping values, the partial state of the second is merged into the first
+        DataBlock block1, block2;
+        FillBigIntBlock(block1, 0, DEFAULT_VECTOR_SIZE, 1000);
+        FillBigIntBlock(block2, 500, 1500, 1500);
+        auto state1 = func.InitState();
+        auto state2 = func.InitState();
+        func.init_func_(state1.get());
+        func.init_func_(state2.get());
+        func.update_func_(state1.get(), block1.column_vectors[0]);
+        func.update_func_(state2.get(), block2.column_vectors[0]);
+
+        ColumnVector partial(MakeShared<DataType>(LogicalType::kVarchar));
+        partial.Initialize();
+        func.AppendResult(state2.get(), partial, true);
+        func.merge_func_(state1.get(), partial.GetValue(0).GetVarchar());
+        BigIntT result = *(BigIntT *)func.finalize_func_(state1.get());
+        if (name == "count_distinct") {
+            EXPECT_EQ(result, 1500);
+        } else {
+            EXPECT_NEAR(result, 1500, 1500 * 0.05);
+        }
+    }
+}
+
+TEST_F(ApproxFunctionTest, CountDistinctVarchar) {
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+    RegisterCountDistinctFunction(catalog_ptr);
+    AggregateFunction func = GetFunction(catalog_ptr, "count_distinct", LogicalType::kVarchar);
+
+    DataBlock data_block;
+    data_block.Init(VarcharTypes());
+    for (SizeT i = 0; i < 100; ++i) {
+        // both inlined and heap strings
+        data_block.AppendValue(0, Value::MakeVarchar(fmt::format("{}{}", i % 10 < 5 ? "short" : "a_much_longer_varchar_value", i % 10)));
+    }
+    data_block.Finalize();
+
+    auto state = func.InitState();
+    func.init_func_(state.get());
+    func.update_func_(state.get(), data_block.column_vectors[0]);
+    EXPECT_EQ(*(BigIntT *)func.finalize_func_(state.get()), 10);
+}
+
+TEST_F(ApproxFunctionTest, ApproxPercentile) {
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+    RegisterApproxPercentileFunction(catalog_ptr);
+    RegisterMedianFunction(catalog_ptr);
+
+    AggregateFunction median = GetFunction(catalog_ptr, "median", LogicalType::kBigInt);
+    EXPECT_STREQ("MEDIAN(BigInt)->Double", median.ToString().c_str());
+    // MEDIAN takes no percentile
+    EXPECT_FALSE(median.BindParameter(0.9));
+
+    AggregateFunction p90 = GetFunction(catalog_ptr, "approx_percentile", LogicalType::kBigInt);
+    EXPECT_FALSE(p90.BindParameter(1.5));
+    EXPECT_TRUE(p90.BindParameter(0.9));
+
+    DataBlock data_block;
+    FillBigIntBlock(data_block, 0, DEFAULT_VECTOR_SIZE, DEFAULT_VECTOR_SIZE);
+    for (auto *func : {&median, &p90}) {
+        auto state = func->InitState();
+        func->init_func_(state.get());
+        func->update_func_(state.get(), data_block.column_vectors[0]);
+        DoubleT expected = (func == &median ? 0.5 : 0.9) * DEFAULT_VECTOR_SIZE;
+        EXPECT_NEAR(*(DoubleT *)func->finalize_func_(state.get()), expected, DEFAULT_VECTOR_SIZE * 0.01);
+    }
+}
+
+TEST_F(ApproxFunctionTest, ApproxTopK) {
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+    RegisterApproxTopKFunction(catalog_ptr);
+
+    AggregateFunction func = GetFunction(catalog_ptr, "approx_top_k", LogicalType::kVarchar);
+    EXPECT_FALSE(func.BindParameter(0));
+    EXPECT_FALSE(func.BindParameter(2.5));
+    EXPECT_TRUE(func.BindParameter(2));
+
+    DataBlock data_block;
+    data_block.Init(VarcharTypes());
+    for (SizeT i = 0; i < 1000; ++i) {
+        String value = i % 2 == 0 ? "the_most_frequent_value" : (i % 3 == 0 ? "second" : fmt::format("other{}", i));
+        data_block.AppendValue(0, Value::MakeVarchar(value));
+    }
+    data_block.Finalize();
+
+    auto state = func.InitState();
+    func.init_func_(state.get());
+    func.update_func_(state.get(), data_block.column_vectors[0]);
+    ColumnVector output(MakeShared<DataType>(LogicalType::kVarchar));
+    output.Initialize();
+    func.AppendResult(state.get(), output, false);
+
+    json result = json::parse(output.GetValue(0).GetVarchar());
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_EQ(result[0]["value"], "the_most_frequent_value");
+    EXPECT_GE(result[0]["count"].get<u64>(), 500u);
+    EXPECT_EQ(result[1]["value"], "second");
+    EXPECT_GE(result[1]["count"].get<u64>(), 166u);
+}
+
+TEST_F(ApproxFunctionTest, DestroyState) {
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+    RegisterCountDistinctFunction(catalog_ptr);
+    RegisterApproxTopKFunction(catalog_ptr);
+
+    for (const String name : {"count_distinct", "approx_top_k"}) {
+        AggregateFunction func = GetFunction(catalog_ptr, name, LogicalType::kBigInt);
+        ASSERT_TRUE(func.destroy_func_ != nullptr);
+
+        DataBlock data_block;
+        FillBigIntBlock(data_block, 0, DEFAULT_VECTOR_SIZE, 100);
+        {
+            // dropped by a failed query before it's finalized, the memory of the state is freed with it
+            auto state = func.InitState();
+            func.init_func_(state.get());
+            func.update_func_(state.get(), data_block.column_vectors[0]);
+        }
+        {
+            // never initialized
+            auto state = func.InitState();
+        }
+        {
+            // destroyed again after the result is appended
+            auto state = func.InitState();
+            func.init_func_(state.get());
+            func.update_func_(state.get(), data_block.column_vectors[0]);
+            ColumnVector output(MakeShared<DataType>(func.return_type()));
+            output.Initialize();
+            func.AppendResult(state.get(), output, false);
+            EXPECT_EQ(output.Size(), 1u);
+        }
+    }
+}
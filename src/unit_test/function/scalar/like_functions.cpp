@@ -0,0 +1,172 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import infinity_exception;
+import third_party;
+import stl;
+import catalog;
+import scalar_function;
+import scalar_function_set;
+import function_set;
+import function;
+import column_expression;
+import value;
+import default_values;
+import data_block;
+import base_expression;
+import column_vector;
+import like;
+import regexp_match;
+import string_pattern;
+import logical_type;
+import internal_types;
+import data_type;
+
+using namespace infinity;
+
+class LikeFunctionsTest : public BaseTest {};
+
+TEST_F(LikeFunctionsTest, like_pattern) {
+    EXPECT_EQ(LikePattern("abc").kind(), LikePattern::Kind::kExact);
+    EXPECT_EQ(LikePattern("abc%").kind(), LikePattern::Kind::kPrefix);
+    EXPECT_EQ(LikePattern("%abc").kind(), LikePattern::Kind::kSuffix);
+    EXPECT_EQ(LikePattern("%%abc%").kind(), LikePattern::Kind::kContains);
+    EXPECT_EQ(LikePattern("a%b%c").kind(), LikePattern::Kind::kGeneral);
+    EXPECT_EQ(LikePattern("a_c").kind(), LikePattern::Kind::kGeneral);
+
+    EXPECT_EQ(LikePattern("ab_d%").LiteralPrefix(), "ab");
+    EXPECT_EQ(LikePattern("a\\%b%").LiteralPrefix(), "a%b");
+    EXPECT_EQ(LikePattern("%abc").LiteralPrefix(), "");
+
+    Vector<std::tuple<const char *, const char *, bool>> cases = {
+        {"", "", true},
+        {"", "%", true},
+        {"a", "", false},
+        {"abc", "abc", true},
+        {"abcd", "abc", false},
+        {"abc", "a_c", true},
+        {"ac", "a_c", false},
+        {"abcdef", "abc%", true},
+        {"xabc", "abc%", false},
+        {"xxabc", "%abc", true},
+        {"abcx", "%abc", false},
+        {"xxabcxx", "%abc%", true},
+        {"xxabxcxx", "%abc%", false},
+        {"abcbc", "a%bc", true},
+        {"abcbcx", "a%bc", false},
+        {"aXbXXc", "a%b%c", true},
+        {"acb", "a%b%c", false},
+        // the first and last segments must not overlap
+        {"aba", "ab%ba", false},
+        {"abba", "ab%ba", true},
+        {"axxbyc", "a%_b_%c", true},
+        {"abc", "a%_b_%c", false},
+        {"a%b", "a\\%b", true},
+        {"axb", "a\\%b", false},
+        {"a_b", "a\\_b", true},
+        {"axb", "a\\_b", false},
+    };
+    for (const auto &[text, pattern, expected] : cases) {
+        EXPECT_EQ(LikePattern(pattern).Match(text), expected) << text << " LIKE " << pattern;
+    }
+}
+
+TEST_F(LikeFunctionsTest, regex_pattern) {
+    Vector<std::tuple<const char *, const char *, bool>> cases = {
+        {"", "", true},
+        {"hello world", "wor", true},
+        {"hello world", "^wor", false},
+        {"hello world", "^hel+o", true},
+        {"hello world", "world$", true},
+        {"hello world", "hello$", false},
+        {"abc123", "[a-c]+\\d{3}$", true},
+        {"abc12", "^[a-c]+\\d{3}$", false},
+        {"abcd", "^[^0-9]*$", true},
+        {"ab1d", "^[^0-9]*$", false},
+        {"cat", "^(cat|dog)s?$", true},
+        {"dogs", "^(cat|dog)s?$", true},
+        {"cow", "^(cat|dog)s?$", false},
+        {"a.b", "a\\.b", true},
+        {"axb", "a\\.b", false},
+        {"axb", "a.b", true},
+        {"a\nb", "a.b", false},
+        {"x{y", "x{y", true},
+        {"aaaa", "^a{2,3}$", false},
+        {"aaa", "^a{2,3}$", true},
+        {"aaaaa", "^a{2,}$", true},
+        {"foo_bar", "^\\w+$", true},
+        {"foo bar", "^\\w+$", false},
+        {"]", "[]]", true},
+        {"-", "[a-]", true},
+        {"b", "(?:a|b)", true},
+    };
+    for (const auto &[text, pattern, expected] : cases) {
+        EXPECT_EQ(RegexPattern(pattern).Match(text), expected) << text << " ~ " << pattern;
+    }
+
+    // linear time where a backtracking engine takes exponential time
+    String text(64, 'a');
+    EXPECT_FALSE(RegexPattern("^(a|a)*(a|a)*(a|a)*b$").Match(text));
+    EXPECT_TRUE(RegexPattern("(a*)*$").Match(text));
+
+    for (const char *invalid : {"(ab", "ab)", "[ab", "*a", "a{5,2}", "a\\1", "(?=a)", "a\\"}) {
+        EXPECT_THROW(RegexPattern{invalid}, RecoverableException) << invalid;
+    }
+}
+
+TEST_F(LikeFunctionsTest, like_func) {
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+    RegisterLikeFunction(catalog_ptr);
+    RegisterNotLikeFunction(catalog_ptr);
+    RegisterRegexpMatchFunction(catalog_ptr);
+
+    SharedPtr<DataType> varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+    SharedPtr<DataType> result_type = MakeShared<DataType>(LogicalType::kBoolean);
+    Vector<SharedPtr<BaseExpression>> inputs;
+    inputs.emplace_back(MakeShared<ColumnExpression>(*varchar_type, "t1", 1, "c1", 0, 0));
+    inputs.emplace_back(MakeShared<ColumnExpression>(*varchar_type, "t1", 1, "c2", 1, 0));
+
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    SharedPtr<ColumnVector> text_column = ColumnVector::Make(varchar_type);
+    text_column->Initialize(ColumnVectorType::kFlat);
+    for (SizeT i = 0; i < row_count; ++i) {
+        // both inlined and heap strings
+        text_column->AppendValue(Value::MakeVarchar(i % 2 == 0 ? fmt::format("prefix_{}", i) : fmt::format("another_long_prefix_{}", i)));
+    }
+
+    for (const String name : {"like", "not_like", "regexp_match"}) {
+        SharedPtr<ScalarFunctionSet> function_set = std::static_pointer_cast<ScalarFunctionSet>(Catalog::GetFunctionSetByName(catalog_ptr.get(), name));
+        ScalarFunction func = function_set->GetMostMatchFunction(inputs);
+        EXPECT_STREQ(fmt::format("{}(Varchar, Varchar)->Boolean", name).c_str(), func.ToString().c_str());
+
+        SharedPtr<ColumnVector> pattern_column = ColumnVector::Make(varchar_type);
+        pattern_column->Initialize(ColumnVectorType::kConstant);
+        pattern_column->AppendValue(Value::MakeVarchar(name == "regexp_match" ? "^another_.*_\\d*1$" : "another%\\_%1"));
+
+        DataBlock data_block;
+        data_block.Init({text_column, pattern_column});
+        SharedPtr<ColumnVector> result = MakeShared<ColumnVector>(result_type);
+        result->Initialize();
+        func.function_(data_block, result);
+
+        for (SizeT i = 0; i < row_count; ++i) {
+            Value v = result->GetValue(i);
+            EXPECT_EQ(v.type_.type(), LogicalType::kBoolean);
+            bool expected = i % 2 == 1 && i % 10 == 1;
+            EXPECT_EQ(v.value_.boolean, name == "not_like" ? !expected : expected);
+        }
+    }
+}
@@ -56,6 +56,9 @@ TEST_F(ConfigTest, test1) {
 
     EXPECT_EQ(config.DataDir(), "/var/infinity/data");
     EXPECT_EQ(config.WALDir(), "/var/infinity/wal");
+    EXPECT_EQ(config.CompactionIORate(), 64 * 1024l * 1024l);
+    EXPECT_EQ(config.CompactionMinDeleteRatio(), 0.2);
+    EXPECT_EQ(config.CompactionHeatWeight(), 0.5);
 
     EXPECT_EQ(config.BufferManagerSize(), 4 * 1024l * 1024l * 1024l);
     EXPECT_EQ(config.TempDir(), "/var/infinity/tmp");
@@ -88,6 +91,9 @@ TEST_F(ConfigTest, test2) {
 
     EXPECT_EQ(config.DataDir(), "/var/infinity/data");
     EXPECT_EQ(config.WALDir(), "/var/infinity/wal");
+    EXPECT_EQ(config.CompactionIORate(), 16 * 1024l * 1024l);
+    EXPECT_EQ(config.CompactionMinDeleteRatio(), 0.2);
+    EXPECT_EQ(config.CompactionHeatWeight(), 1.0);
 
     EXPECT_EQ(config.BufferManagerSize(), 3 * 1024l * 1024l * 1024l);
     EXPECT_EQ(config.TempDir(), "/tmp");
@@ -363,4 +363,103 @@ TEST_F(InfinityTest, test2) {
     infinity->LocalDisconnect();
 
     Infinity::LocalUnInit();
-}
\ No newline at end of file
+}
+TEST_F(InfinityTest, sampled_profile) {
+    using namespace infinity;
+    String path = GetHomeDir();
+    RemoveDbDirs();
+    Infinity::LocalInit(path);
+
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+
+    {
+        QueryResult result = infinity->SetVariableOrConfig("profile_sample_rate", i64(1), SetScope::kConfig);
+        EXPECT_TRUE(result.IsOk());
+        EXPECT_TRUE(infinity->Query("create table t1 (c1 int)").IsOk());
+        EXPECT_TRUE(infinity->Query("insert into t1 values (1), (2)").IsOk());
+        EXPECT_TRUE(infinity->Query("select c1 from t1").IsOk());
+    }
+
+    {
+        // the newest profile comes first, the show statements are not profiled
+        QueryResult result = infinity->Query("show profiles");
+        EXPECT_TRUE(result.IsOk());
+        SharedPtr<DataBlock> data_block = result.result_table_->GetDataBlockById(0);
+        EXPECT_EQ(data_block->row_count(), 3);
+        EXPECT_EQ(data_block->GetValue(0, 0).GetVarchar(), "2");
+        EXPECT_EQ(data_block->GetValue(11, 0).GetVarchar(), "sampled");
+        EXPECT_EQ(data_block->GetValue(12, 0).GetVarchar(), "select c1 from t1");
+        EXPECT_EQ(data_block->GetValue(0, 2).GetVarchar(), "0");
+        EXPECT_EQ(data_block->GetValue(12, 2).GetVarchar(), "create table t1 (c1 int)");
+
+        result = infinity->Query("show profile 2");
+        EXPECT_TRUE(result.IsOk());
+        EXPECT_EQ(result.result_table_->GetColumnNameById(2), "operator");
+        EXPECT_GT(result.result_table_->GetDataBlockById(0)->row_count(), 0);
+
+        result = infinity->Query("show profile 3");
+        EXPECT_FALSE(result.IsOk());
+
+        // the number of a profile stays when newer ones come
+        EXPECT_TRUE(infinity->Query("select c1 from t1 where c1 > 1").IsOk());
+        result = infinity->Query("show profiles");
+        data_block = result.result_table_->GetDataBlockById(0);
+        EXPECT_EQ(data_block->row_count(), 4);
+        EXPECT_EQ(data_block->GetValue(0, 0).GetVarchar(), "3");
+        EXPECT_EQ(data_block->GetValue(0, 1).GetVarchar(), "2");
+        EXPECT_EQ(data_block->GetValue(12, 1).GetVarchar(), "select c1 from t1");
+    }
+
+    {
+        // a query under the slow query threshold is not kept
+        EXPECT_TRUE(infinity->SetVariableOrConfig("profile_sample_rate", i64(0), SetScope::kConfig).IsOk());
+        EXPECT_TRUE(infinity->SetVariableOrConfig("slow_query_threshold", i64(3600 * 1000), SetScope::kConfig).IsOk());
+        EXPECT_TRUE(infinity->Query("select c1 from t1").IsOk());
+        QueryResult result = infinity->Query("show profiles");
+        EXPECT_EQ(result.result_table_->GetDataBlockById(0)->row_count(), 4);
+
+        EXPECT_FALSE(infinity->SetVariableOrConfig("slow_query_threshold", i64(-1), SetScope::kConfig).IsOk());
+        EXPECT_TRUE(infinity->SetVariableOrConfig("slow_query_threshold", i64(0), SetScope::kConfig).IsOk());
+    }
+
+    infinity->LocalDisconnect();
+
+    Infinity::LocalUnInit();
+}
+
+TEST_F(InfinityTest, result_cache_after_mem_index_commit) {
+    using namespace infinity;
+    String path = GetHomeDir();
+    RemoveDbDirs();
+    Infinity::LocalInit(path);
+
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    EXPECT_TRUE(infinity->SetVariableOrConfig("enable_result_cache", true, SetScope::kSession).IsOk());
+    EXPECT_TRUE(infinity->Query("create table t1 (c1 int, body varchar)").IsOk());
+    EXPECT_TRUE(infinity->Query("create index ft_index on t1(body) using fulltext").IsOk());
+    EXPECT_TRUE(infinity->Query("insert into t1 values (1, 'dune frank herbert')").IsOk());
+
+    auto match_row_count = [&]() {
+        QueryResult result = infinity->Query("select c1 from t1 search match text ('body', 'dune', 'topn=10')");
+        EXPECT_TRUE(result.IsOk());
+        SizeT row_count = 0;
+        for (SizeT i = 0; i < result.result_table_->DataBlockCount(); ++i) {
+            row_count += result.result_table_->GetDataBlockById(i)->row_count();
+        }
+        return row_count;
+    };
+
+    // The row is searchable after the background commit of the memory index. A result cached before that commit must
+    // not be returned after it.
+    SizeT row_count = match_row_count();
+    for (SizeT i = 0; i < 100 && row_count == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        row_count = match_row_count();
+    }
+    EXPECT_EQ(row_count, 1u);
+    EXPECT_EQ(match_row_count(), 1u);
+
+    infinity->LocalDisconnect();
+
+    Infinity::LocalUnInit();
+}
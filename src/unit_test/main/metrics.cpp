@@ -0,0 +1,90 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <thread>
+
+import stl;
+import third_party;
+import metrics;
+
+using namespace infinity;
+
+class MetricsTest : public BaseTest {};
+
+TEST_F(MetricsTest, counter_and_gauge) {
+    auto &registry = MetricsRegistry::instance();
+    String labels = MetricsRegistry::Label("kind", "a");
+    MetricCounter *counter = registry.Counter("test_metrics_counter_total", "A test counter", labels);
+    EXPECT_EQ(counter, registry.Counter("test_metrics_counter_total", "A test counter", labels));
+    EXPECT_NE(counter, registry.Counter("test_metrics_counter_total", "A test counter", MetricsRegistry::Label("kind", "b")));
+
+    constexpr SizeT thread_n = 4;
+    constexpr SizeT add_n = 10000;
+    Vector<std::thread> threads;
+    for (SizeT i = 0; i < thread_n; ++i) {
+        threads.emplace_back([counter] {
+            for (SizeT j = 0; j < add_n; ++j) {
+                counter->Add();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter->value(), thread_n * add_n);
+
+    MetricGauge *gauge = registry.Gauge("test_metrics_gauge", "A test gauge");
+    gauge->Set(5);
+    gauge->Add(-7);
+    EXPECT_EQ(gauge->value(), -2);
+
+    String text = registry.ToPrometheusText();
+    EXPECT_NE(text.find("# TYPE test_metrics_counter_total counter\n"), String::npos);
+    EXPECT_NE(text.find(fmt::format("test_metrics_counter_total{{kind=\"a\"}} {}\n", thread_n * add_n)), String::npos);
+    EXPECT_NE(text.find("test_metrics_counter_total{kind=\"b\"} 0\n"), String::npos);
+    EXPECT_NE(text.find("# TYPE test_metrics_gauge gauge\ntest_metrics_gauge -2\n"), String::npos);
+}
+
+TEST_F(MetricsTest, histogram) {
+    auto &registry = MetricsRegistry::instance();
+    MetricHistogram *histogram = registry.Histogram("test_metrics_histogram_seconds", "A test histogram", "", {0.1, 1, 10});
+    histogram->Observe(0.05);
+    histogram->Observe(0.1);
+    histogram->Observe(0.5);
+    histogram->Observe(20);
+    EXPECT_EQ(histogram->count(), 4u);
+    EXPECT_DOUBLE_EQ(histogram->sum(), 20.65);
+    EXPECT_EQ(histogram->BucketCounts(), (Vector<u64>{2, 1, 0, 1}));
+
+    String text = registry.ToPrometheusText();
+    EXPECT_NE(text.find("# TYPE test_metrics_histogram_seconds histogram\n"
+                        "test_metrics_histogram_seconds_bucket{le=\"0.1\"} 2\n"
+                        "test_metrics_histogram_seconds_bucket{le=\"1\"} 3\n"
+                        "test_metrics_histogram_seconds_bucket{le=\"10\"} 3\n"
+                        "test_metrics_histogram_seconds_bucket{le=\"+Inf\"} 4\n"
+                        "test_metrics_histogram_seconds_sum 20.65\n"
+                        "test_metrics_histogram_seconds_count 4\n"),
+              String::npos);
+
+    {
+        MetricTimer timer(histogram);
+    }
+    EXPECT_EQ(histogram->count(), 5u);
+    MetricTimer null_timer(nullptr);
+}
+
+TEST_F(MetricsTest, label_escape) {
+    EXPECT_EQ(MetricsRegistry::Label("path", "a\"b\\c\nd"), "path=\"a\\\"b\\\\c\\nd\"");
+}
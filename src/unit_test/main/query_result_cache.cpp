@@ -0,0 +1,101 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import data_table;
+import data_block;
+import table_def;
+import column_def;
+import value;
+import logical_type;
+import data_type;
+import logical_node_type;
+import query_result_cache;
+
+using namespace infinity;
+
+class QueryResultCacheTest : public BaseTest {};
+
+TEST_F(QueryResultCacheTest, GetPut) {
+    QueryResultCache cache(1024);
+    SharedPtr<DataTable> result;
+    LogicalNodeType root_type = LogicalNodeType::kInvalid;
+    EXPECT_FALSE(cache.Get("q1", "t1#0#5", result, root_type));
+
+    auto table = DataTable::MakeEmptyResultTable();
+    cache.Put("q1", "t1#0#5", table, LogicalNodeType::kProjection);
+    ASSERT_TRUE(cache.Get("q1", "t1#0#5", result, root_type));
+    EXPECT_EQ(result, table);
+    EXPECT_EQ(root_type, LogicalNodeType::kProjection);
+
+    // the table has been written since the result was cached
+    result.reset();
+    EXPECT_FALSE(cache.Get("q1", "t1#0#6", result, root_type));
+    EXPECT_EQ(result, nullptr);
+    EXPECT_EQ(cache.memory_usage(), 0u);
+    EXPECT_FALSE(cache.Get("q1", "t1#0#5", result, root_type));
+
+    EXPECT_EQ(cache.hit_count(), 1u);
+    EXPECT_EQ(cache.miss_count(), 3u);
+}
+
+TEST_F(QueryResultCacheTest, Evict) {
+    // room for two of the entries below
+    const String snapshot = "t1#0";
+    const SizeT entry_cost = String("q1").size() + snapshot.size();
+    QueryResultCache cache(2 * entry_cost);
+    SharedPtr<DataTable> result;
+    LogicalNodeType root_type;
+
+    cache.Put("q1", snapshot, DataTable::MakeEmptyResultTable(), LogicalNodeType::kProjection);
+    cache.Put("q2", snapshot, DataTable::MakeEmptyResultTable(), LogicalNodeType::kProjection);
+    EXPECT_TRUE(cache.Get("q1", snapshot, result, root_type));
+    // q2 is the least recently used one
+    cache.Put("q3", snapshot, DataTable::MakeEmptyResultTable(), LogicalNodeType::kProjection);
+    EXPECT_EQ(cache.memory_usage(), 2 * entry_cost);
+    EXPECT_FALSE(cache.Get("q2", snapshot, result, root_type));
+    EXPECT_TRUE(cache.Get("q1", snapshot, result, root_type));
+    EXPECT_TRUE(cache.Get("q3", snapshot, result, root_type));
+
+    // an entry larger than the whole cache is not kept
+    cache.Put(String(3 * entry_cost, 'q'), snapshot, DataTable::MakeEmptyResultTable(), LogicalNodeType::kProjection);
+    EXPECT_EQ(cache.memory_usage(), 2 * entry_cost);
+
+    cache.Clear();
+    EXPECT_EQ(cache.memory_usage(), 0u);
+    EXPECT_FALSE(cache.Get("q1", snapshot, result, root_type));
+}
+
+TEST_F(QueryResultCacheTest, VarcharMemoryCost) {
+    auto varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+    auto column_def = MakeShared<ColumnDef>(0, varchar_type, "c1", std::set<ConstraintType>());
+    auto data_block = DataBlock::Make();
+    data_block->Init(Vector<SharedPtr<DataType>>{varchar_type}, 8);
+    const String long_varchar(60000, 'v');
+    data_block->AppendValue(0, Value::MakeVarchar(long_varchar));
+    data_block->Finalize();
+    auto table = DataTable::MakeResultTable({column_def});
+    table->Append(data_block);
+
+    // the varchar payload counts, not only the fixed size part of the rows
+    QueryResultCache cache(1 << 20);
+    cache.Put("q1", "t1#0", table, LogicalNodeType::kProjection);
+    EXPECT_GE(cache.memory_usage(), long_varchar.size());
+
+    QueryResultCache small_cache(long_varchar.size());
+    small_cache.Put("q1", "t1#0", table, LogicalNodeType::kProjection);
+    EXPECT_EQ(small_cache.memory_usage(), 0u);
+}
@@ -0,0 +1,201 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <chrono>
+#include <condition_variable>
+#include <thread>
+
+import stl;
+import resource_manager;
+
+using namespace infinity;
+
+class SharedThreadPoolTest : public BaseTest {
+protected:
+    // a task which blocks until Release, and records the most tasks of its class running at once
+    std::function<void()> MakeTask(TaskClass task_class) {
+        return [this, task_class] {
+            SizeT class_idx = static_cast<SizeT>(task_class);
+            {
+                std::unique_lock lock(mtx_);
+                SizeT running = ++running_[class_idx];
+                max_running_[class_idx] = std::max(max_running_[class_idx], running);
+                order_.push_back(task_class);
+                cv_.wait(lock, [this] { return released_; });
+                --running_[class_idx];
+                ++finished_;
+            }
+            cv_.notify_all();
+        };
+    }
+
+    void WaitStarted(SizeT count) {
+        std::unique_lock lock(mtx_);
+        cv_.wait_for(lock, std::chrono::seconds(10), [&] { return order_.size() >= count; });
+    }
+
+    void Release() {
+        {
+            std::unique_lock lock(mtx_);
+            released_ = true;
+        }
+        cv_.notify_all();
+    }
+
+    void WaitFinished(SizeT count) {
+        std::unique_lock lock(mtx_);
+        cv_.wait_for(lock, std::chrono::seconds(10), [&] { return finished_ >= count; });
+    }
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool released_{false};
+    SizeT finished_{0};
+    Array<SizeT, TASK_CLASS_COUNT> running_{};
+    Array<SizeT, TASK_CLASS_COUNT> max_running_{};
+    Vector<TaskClass> order_;
+};
+
+TEST_F(SharedThreadPoolTest, quota) {
+    SharedThreadPool pool(4);
+    pool.SetQuota(TaskClass::kIngest, 50);
+    for (SizeT i = 0; i < 6; ++i) {
+        pool.Submit(TaskClass::kIngest, MakeTask(TaskClass::kIngest));
+    }
+    for (SizeT i = 0; i < 2; ++i) {
+        pool.Submit(TaskClass::kBackground, MakeTask(TaskClass::kBackground));
+    }
+    // 2 ingest tasks by the quota and 2 background tasks
+    WaitStarted(4);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(pool.RunningCount(TaskClass::kIngest), 2u);
+    EXPECT_EQ(pool.RunningCount(TaskClass::kBackground), 2u);
+    EXPECT_EQ(pool.QueueSize(TaskClass::kIngest), 4u);
+
+    Release();
+    WaitFinished(8);
+    EXPECT_EQ(max_running_[static_cast<SizeT>(TaskClass::kIngest)], 2u);
+    EXPECT_EQ(pool.QueueSize(TaskClass::kIngest), 0u);
+}
+
+TEST_F(SharedThreadPoolTest, ingest_leaves_a_thread) {
+    SharedThreadPool pool(2);
+    // a full quota of ingest can't hold the last thread, the background task waited by them still runs
+    for (SizeT i = 0; i < 3; ++i) {
+        pool.Submit(TaskClass::kIngest, MakeTask(TaskClass::kIngest));
+    }
+    pool.Submit(TaskClass::kBackground, MakeTask(TaskClass::kBackground));
+    WaitStarted(2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(pool.RunningCount(TaskClass::kIngest), 1u);
+    EXPECT_EQ(pool.RunningCount(TaskClass::kBackground), 1u);
+    Release();
+    WaitFinished(4);
+}
+
+TEST_F(SharedThreadPoolTest, priority_and_resize) {
+    SharedThreadPool pool(2);
+    pool.SetQuota(TaskClass::kIngest, 100);
+    // the queries can't hold the last thread either, the ingest task runs beside them
+    pool.Submit(TaskClass::kQuery, MakeTask(TaskClass::kQuery));
+    pool.Submit(TaskClass::kQuery, MakeTask(TaskClass::kQuery));
+    pool.Submit(TaskClass::kIngest, MakeTask(TaskClass::kIngest));
+    WaitStarted(2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(pool.RunningCount(TaskClass::kQuery), 1u);
+    EXPECT_EQ(pool.RunningCount(TaskClass::kIngest), 1u);
+    EXPECT_EQ(pool.QueueSize(TaskClass::kQuery), 1u);
+    pool.Submit(TaskClass::kBackground, MakeTask(TaskClass::kBackground));
+    pool.Submit(TaskClass::kIngest, MakeTask(TaskClass::kIngest));
+    pool.Submit(TaskClass::kQuery, MakeTask(TaskClass::kQuery));
+
+    // each new thread takes the queued task of the highest class
+    pool.Resize(3);
+    EXPECT_EQ(pool.thread_count(), 3u);
+    WaitStarted(3);
+    pool.Resize(4);
+    WaitStarted(4);
+    pool.Resize(5);
+    WaitStarted(5);
+    pool.Resize(6);
+    WaitStarted(6);
+    ASSERT_EQ(order_.size(), 6u);
+    EXPECT_EQ(order_[2], TaskClass::kQuery);
+    EXPECT_EQ(order_[3], TaskClass::kQuery);
+    EXPECT_EQ(order_[4], TaskClass::kIngest);
+    EXPECT_EQ(order_[5], TaskClass::kBackground);
+    Release();
+    WaitFinished(6);
+
+    // the threads beyond the size exit, the rest keep running tasks
+    pool.Resize(2);
+    EXPECT_EQ(pool.thread_count(), 2u);
+    Atomic<SizeT> done{0};
+    for (SizeT i = 0; i < 10; ++i) {
+        pool.Submit(TaskClass::kBackground, [&done] { ++done; });
+    }
+    for (SizeT i = 0; i < 1000 && done.load() < 10; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(done.load(), 10u);
+    // and grow again
+    pool.Resize(3);
+    EXPECT_EQ(pool.thread_count(), 3u);
+    pool.Stop();
+    EXPECT_EQ(pool.thread_count(), 0u);
+
+    // a stopped pool starts again by resize
+    pool.Resize(2);
+    pool.Submit(TaskClass::kBackground, [&done] { ++done; });
+    for (SizeT i = 0; i < 1000 && done.load() < 11; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(done.load(), 11u);
+    pool.Stop();
+}
+
+TEST_F(SharedThreadPoolTest, parallel_for) {
+    SharedThreadPool pool(4);
+    Vector<Atomic<SizeT>> hits(1000);
+    pool.ParallelFor(TaskClass::kIngest, hits.size(), [&](SizeT i) { ++hits[i]; });
+    for (const auto &hit : hits) {
+        EXPECT_EQ(hit.load(), 1u);
+    }
+
+    // the ingest threads are all held, the caller runs every task itself
+    for (SizeT i = 0; i < 3; ++i) {
+        pool.Submit(TaskClass::kIngest, MakeTask(TaskClass::kIngest));
+    }
+    WaitStarted(3);
+    auto caller_id = std::this_thread::get_id();
+    SizeT run_by_caller = 0;
+    pool.ParallelFor(TaskClass::kIngest, 100, [&](SizeT) { run_by_caller += std::this_thread::get_id() == caller_id; });
+    EXPECT_EQ(run_by_caller, 100u);
+    Release();
+    WaitFinished(3);
+
+    // the exception of a task reaches the caller after all tasks are done
+    Atomic<SizeT> done{0};
+    EXPECT_THROW(pool.ParallelFor(TaskClass::kIngest,
+                                  100,
+                                  [&](SizeT i) {
+                                      if (i == 42) {
+                                          throw std::runtime_error("task failed");
+                                      }
+                                      ++done;
+                                  }),
+                 std::runtime_error);
+    EXPECT_EQ(done.load(), 99u);
+}
@@ -0,0 +1,240 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import infinity_exception;
+import pg_message;
+import pg_protocol_handler;
+import pg_parameter;
+import base_statement;
+import select_statement;
+import insert_statement;
+import parsed_expr;
+import constant_expr;
+import function_expr;
+import search_expr;
+import match_expr;
+
+using namespace infinity;
+
+namespace {
+
+// Builds a message body the way a client writes it, in network byte order
+class MessageBuilder {
+public:
+    MessageBuilder &I16(i16 value) { return Int(static_cast<u16>(value), sizeof(i16)); }
+
+    MessageBuilder &I32(i32 value) { return Int(static_cast<u32>(value), sizeof(i32)); }
+
+    MessageBuilder &Str(const String &value) {
+        data_.insert(data_.end(), value.begin(), value.end());
+        data_.push_back('\0');
+        return *this;
+    }
+
+    MessageBuilder &Bytes(const String &value) {
+        data_.insert(data_.end(), value.begin(), value.end());
+        return *this;
+    }
+
+    Vector<char> Take() { return std::move(data_); }
+
+private:
+    MessageBuilder &Int(u32 value, SizeT size) {
+        for (SizeT i = size; i > 0; --i) {
+            data_.push_back(static_cast<char>((value >> ((i - 1) * 8)) & 0xFF));
+        }
+        return *this;
+    }
+
+    Vector<char> data_;
+};
+
+u32 ReadU32(const Vector<char> &data, SizeT offset) {
+    u32 value = 0;
+    for (SizeT i = 0; i < 4; ++i) {
+        value = (value << 8) | static_cast<u8>(data[offset + i]);
+    }
+    return value;
+}
+
+u16 ReadU16(const Vector<char> &data, SizeT offset) { return (static_cast<u8>(data[offset]) << 8) | static_cast<u8>(data[offset + 1]); }
+
+Vector<UniquePtr<ConstantExpr>> MakeValues(const Vector<Pair<Optional<String>, u32>> &parameters) {
+    Vector<UniquePtr<ConstantExpr>> values;
+    for (SizeT i = 0; i < parameters.size(); ++i) {
+        values.push_back(MakeParameterValue(i + 1, parameters[i].first, parameters[i].second));
+    }
+    return values;
+}
+
+} // namespace
+
+class PGProtocolTest : public BaseTest {};
+
+TEST_F(PGProtocolTest, read_parse_and_bind) {
+    PGProtocolHandler handler;
+    handler.set_message(MessageBuilder().Str("s1").Str("SELECT a FROM t WHERE b = $1 AND c = $2").I16(2).I32(PGTypeOid::kInt4).I32(0).Take());
+    PGParseMessage parse_message = handler.read_parse_message();
+    EXPECT_EQ(parse_message.statement_name_, "s1");
+    EXPECT_EQ(parse_message.query_, "SELECT a FROM t WHERE b = $1 AND c = $2");
+    ASSERT_EQ(parse_message.parameter_types_.size(), 2u);
+    EXPECT_EQ(parse_message.parameter_types_[0], PGTypeOid::kInt4);
+    EXPECT_EQ(parse_message.parameter_types_[1], PGTypeOid::kUnspecified);
+
+    // one text format for all parameters, the second one is NULL
+    handler.set_message(MessageBuilder().Str("p1").Str("s1").I16(1).I16(0).I16(2).I32(2).Bytes("42").I32(-1).I16(0).Take());
+    PGBindMessage bind_message = handler.read_bind_message();
+    EXPECT_EQ(bind_message.portal_name_, "p1");
+    EXPECT_EQ(bind_message.statement_name_, "s1");
+    ASSERT_EQ(bind_message.parameter_formats_.size(), 1u);
+    EXPECT_EQ(bind_message.parameter_formats_[0], PGFormatCode::kText);
+    ASSERT_EQ(bind_message.parameters_.size(), 2u);
+    EXPECT_EQ(bind_message.parameters_[0], Optional<String>("42"));
+    EXPECT_FALSE(bind_message.parameters_[1].has_value());
+    EXPECT_TRUE(bind_message.result_formats_.empty());
+}
+
+TEST_F(PGProtocolTest, send_descriptions) {
+    PGProtocolHandler handler;
+    handler.SendParameterDescription({PGTypeOid::kInt8, PGTypeOid::kText});
+    handler.SendNoData();
+    Vector<char> output = handler.take_output();
+    ASSERT_EQ(output.size(), 1u + 4 + 2 + 2 * 4 + 1 + 4);
+    EXPECT_EQ(output[0], static_cast<char>(PGMessageType::kParameterDescription));
+    EXPECT_EQ(ReadU32(output, 1), 4u + 2 + 2 * 4);
+    EXPECT_EQ(ReadU16(output, 5), 2u);
+    EXPECT_EQ(ReadU32(output, 7), PGTypeOid::kInt8);
+    EXPECT_EQ(ReadU32(output, 11), PGTypeOid::kText);
+    EXPECT_EQ(output[15], static_cast<char>(PGMessageType::kNoData));
+    EXPECT_EQ(ReadU32(output, 16), 4u);
+    EXPECT_FALSE(handler.has_output());
+}
+
+TEST_F(PGProtocolTest, replace_parameters) {
+    String result;
+    Vector<SizeT> occurrences = ReplaceParameters(
+        "SELECT '$1', \"$2\" FROM t WHERE a = $2 OR b = $2 OR c = $10",
+        [](SizeT parameter_id) { return fmt::format("<{}>", parameter_id); },
+        result);
+    EXPECT_EQ(result, "SELECT '$1', \"$2\" FROM t WHERE a = <2> OR b = <2> OR c = <10>");
+    ASSERT_EQ(occurrences.size(), 10u);
+    EXPECT_EQ(occurrences[0], 0u);
+    EXPECT_EQ(occurrences[1], 2u);
+    EXPECT_EQ(occurrences[9], 1u);
+
+    EXPECT_THROW(ReplaceParameters("SELECT $0", [](SizeT) { return String(); }, result), RecoverableException);
+}
+
+TEST_F(PGProtocolTest, typed_parameter_values) {
+    auto integer_value = MakeParameterValue(1, "-42", PGTypeOid::kInt8);
+    EXPECT_EQ(integer_value->literal_type_, LiteralType::kInteger);
+    EXPECT_EQ(integer_value->integer_value_, -42);
+    EXPECT_THROW(MakeParameterValue(1, "4.2", PGTypeOid::kInt4), RecoverableException);
+    EXPECT_THROW(MakeParameterValue(1, "1; DROP TABLE t", PGTypeOid::kInt4), RecoverableException);
+
+    auto double_value = MakeParameterValue(1, "1.5e3", PGTypeOid::kFloat8);
+    EXPECT_EQ(double_value->literal_type_, LiteralType::kDouble);
+    EXPECT_DOUBLE_EQ(double_value->double_value_, 1500.0);
+
+    auto bool_value = MakeParameterValue(1, "t", PGTypeOid::kBool);
+    EXPECT_EQ(bool_value->literal_type_, LiteralType::kBoolean);
+    EXPECT_TRUE(bool_value->bool_value_);
+    EXPECT_THROW(MakeParameterValue(1, "yes please", PGTypeOid::kBool), RecoverableException);
+
+    // a text parameter stays a string, even if it reads as a number
+    auto text_value = MakeParameterValue(1, "42", PGTypeOid::kText);
+    EXPECT_EQ(text_value->literal_type_, LiteralType::kString);
+    EXPECT_STREQ(text_value->str_value_, "42");
+    EXPECT_EQ(ParameterLiteral(*MakeParameterValue(1, "it's", PGTypeOid::kText)), "'it''s'");
+
+    auto array_value = MakeParameterValue(1, "{0.5, 1, -2}", PGTypeOid::kFloat4Array);
+    EXPECT_EQ(array_value->literal_type_, LiteralType::kDoubleArray);
+    EXPECT_EQ(array_value->double_array_, (Vector<double>{0.5, 1, -2}));
+    EXPECT_EQ(ParameterLiteral(*array_value), "[0.5,1,-2]");
+
+    auto null_value = MakeParameterValue(1, None, PGTypeOid::kInt4);
+    EXPECT_EQ(null_value->literal_type_, LiteralType::kNull);
+    EXPECT_EQ(ParameterLiteral(*null_value), "NULL");
+
+    // the type of a parameter without one is read from the text
+    EXPECT_EQ(MakeParameterValue(1, "7", PGTypeOid::kUnspecified)->literal_type_, LiteralType::kInteger);
+    EXPECT_EQ(MakeParameterValue(1, "0.7", PGTypeOid::kUnspecified)->literal_type_, LiteralType::kDouble);
+    EXPECT_EQ(MakeParameterValue(1, "[1,2,3]", PGTypeOid::kUnspecified)->literal_type_, LiteralType::kIntegerArray);
+    EXPECT_EQ(MakeParameterValue(1, "[1,2.5]", PGTypeOid::kUnspecified)->literal_type_, LiteralType::kDoubleArray);
+    EXPECT_EQ(MakeParameterValue(1, "abc", PGTypeOid::kUnspecified)->literal_type_, LiteralType::kString);
+
+    EXPECT_THROW(MakeParameterValue(1, "x", 114 /*json*/), RecoverableException);
+    EXPECT_THROW(MakeParameterSample(114), RecoverableException);
+}
+
+TEST_F(PGProtocolTest, statement_template) {
+    SizeT parameter_count = 0;
+    auto statement_template = PGStatementTemplate::Make("SELECT a FROM t WHERE b = $1 AND c = '$1' LIMIT $2", parameter_count);
+    ASSERT_NE(statement_template.get(), nullptr);
+    EXPECT_EQ(parameter_count, 2u);
+    EXPECT_EQ(statement_template->parameter_count(), 2u);
+
+    const auto *select_statement = static_cast<const SelectStatement *>(statement_template->statement());
+    ASSERT_EQ(select_statement->where_expr_->type_, ParsedExprType::kFunction);
+    const auto *and_expr = static_cast<const FunctionExpr *>(select_statement->where_expr_);
+    const auto *b_equal = static_cast<const FunctionExpr *>(and_expr->arguments_->at(0));
+    const auto *c_equal = static_cast<const FunctionExpr *>(and_expr->arguments_->at(1));
+    const auto *b_value = static_cast<const ConstantExpr *>(b_equal->arguments_->at(1));
+    const auto *c_value = static_cast<const ConstantExpr *>(c_equal->arguments_->at(1));
+    const auto *limit_value = static_cast<const ConstantExpr *>(select_statement->limit_expr_);
+
+    // the same parsed statement is bound again for each execution
+    for (i64 limit : {10, 20}) {
+        statement_template->Bind(MakeValues({{"abc", PGTypeOid::kText}, {std::to_string(limit), PGTypeOid::kInt8}}));
+        EXPECT_EQ(b_value->literal_type_, LiteralType::kString);
+        EXPECT_STREQ(b_value->str_value_, "abc");
+        EXPECT_EQ(limit_value->literal_type_, LiteralType::kInteger);
+        EXPECT_EQ(limit_value->integer_value_, limit);
+        // a quoted $1 is a string of the query
+        EXPECT_STREQ(c_value->str_value_, "$1");
+    }
+    statement_template->Bind(MakeValues({{None, PGTypeOid::kText}, {"5", PGTypeOid::kInt8}}));
+    EXPECT_EQ(b_value->literal_type_, LiteralType::kNull);
+    EXPECT_EQ(b_value->str_value_, nullptr);
+
+    EXPECT_THROW(statement_template->Bind(MakeValues({{"abc", PGTypeOid::kText}})), RecoverableException);
+}
+
+TEST_F(PGProtocolTest, statement_template_insert_and_match_text) {
+    SizeT parameter_count = 0;
+    auto insert_template = PGStatementTemplate::Make("INSERT INTO t VALUES ($1, $2), ($3, $2)", parameter_count);
+    ASSERT_NE(insert_template.get(), nullptr);
+    EXPECT_EQ(parameter_count, 3u);
+    insert_template->Bind(MakeValues({{"1", PGTypeOid::kInt4}, {"[0.1,0.2]", PGTypeOid::kUnspecified}, {"2", PGTypeOid::kInt4}}));
+    const auto *insert_statement = static_cast<const InsertStatement *>(insert_template->statement());
+    const auto *embedding_value = static_cast<const ConstantExpr *>(insert_statement->values_->at(1)->at(1));
+    EXPECT_EQ(embedding_value->literal_type_, LiteralType::kDoubleArray);
+    EXPECT_EQ(embedding_value->double_array_, (Vector<double>{0.1, 0.2}));
+
+    auto match_template = PGStatementTemplate::Make("SELECT a FROM t SEARCH MATCH TEXT('body', $1, 'topn=10')", parameter_count);
+    ASSERT_NE(match_template.get(), nullptr);
+    EXPECT_EQ(parameter_count, 1u);
+    match_template->Bind(MakeValues({{"harmful chemicals", PGTypeOid::kText}}));
+    const auto *search_expr = static_cast<const SearchExpr *>(static_cast<const SelectStatement *>(match_template->statement())->search_expr_);
+    ASSERT_EQ(search_expr->match_exprs_.size(), 1u);
+    EXPECT_EQ(search_expr->match_exprs_[0]->matching_text_, "harmful chemicals");
+
+    // the query vector of MATCH VECTOR is a literal token of the grammar, such a query is bound as text
+    auto knn_template = PGStatementTemplate::Make("SELECT a FROM t SEARCH MATCH VECTOR(v, $1, 'float', 'l2', 10)", parameter_count);
+    EXPECT_EQ(knn_template.get(), nullptr);
+    EXPECT_EQ(parameter_count, 1u);
+}
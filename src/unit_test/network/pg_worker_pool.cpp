@@ -0,0 +1,75 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import default_values;
+import resource_manager;
+import pg_worker_pool;
+
+using namespace infinity;
+
+class PGWorkerPoolTest : public BaseTest {};
+
+// Each command of a session waits until the commands of all sessions are running, as queries waiting for each other's
+// fragments do. With more sessions than the threads of the shared thread pool, all of them must still run at once.
+TEST_F(PGWorkerPoolTest, more_sessions_than_pool_threads) {
+    const SizeT pool_thread_count = std::max<SizeT>(Thread::hardware_concurrency(), DEFAULT_SHARED_THREAD_POOL_SIZE);
+    const SizeT session_count = pool_thread_count * 2 + 1;
+
+    SharedThreadPool shared_pool(pool_thread_count);
+    PGWorkerPool worker_pool;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    SizeT started_count = 0;
+    atomic_u64 all_started_count = 0;
+    atomic_u64 background_done_count = 0;
+    for (SizeT i = 0; i < session_count; ++i) {
+        worker_pool.Submit([&]() {
+            std::unique_lock lock(mutex);
+            ++started_count;
+            cv.notify_all();
+            if (cv.wait_for(lock, std::chrono::seconds(10), [&]() { return started_count == session_count; })) {
+                ++all_started_count;
+            }
+        });
+    }
+    // The shared pool stays free for the work the queries wait for.
+    shared_pool.ParallelFor(TaskClass::kBackground, pool_thread_count, [&](SizeT) { ++background_done_count; });
+
+    worker_pool.Stop();
+    EXPECT_EQ(all_started_count.load(), session_count);
+    EXPECT_EQ(background_done_count.load(), pool_thread_count);
+    shared_pool.Stop();
+}
+
+// The threads of finished commands are reused by the next ones.
+TEST_F(PGWorkerPoolTest, reuse_idle_threads) {
+    PGWorkerPool worker_pool;
+    atomic_u64 done_count = 0;
+    for (SizeT i = 0; i < 100; ++i) {
+        worker_pool.Submit([&]() { ++done_count; });
+        while (done_count.load() <= i) {
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_LT(worker_pool.thread_count(), 100u);
+
+    worker_pool.Stop();
+    worker_pool.Submit([&]() { ++done_count; });
+    EXPECT_EQ(done_count.load(), 100u);
+}
@@ -0,0 +1,127 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import sql_parser;
+import parser_result;
+import base_statement;
+import plan_cache;
+
+using namespace infinity;
+
+class PlanCacheTest : public BaseTest {
+protected:
+    Optional<String> MakeKey(const String &sql, PlanParameters &parameters) {
+        SQLParser parser;
+        ParserResult result;
+        parser.Parse(sql, &result);
+        EXPECT_TRUE(result.error_message_.empty());
+        EXPECT_EQ(result.statements_ptr_->size(), 1u);
+        return PlanCache::MakeKey(result.statements_ptr_->at(0), "default_db", parameters);
+    }
+};
+
+TEST_F(PlanCacheTest, KeyIgnoresPayloads) {
+    PlanParameters parameters1;
+    auto key1 = MakeKey("SELECT title FROM t1 SEARCH MATCH TEXT ('body', 'dune frank', 'topn=10'), "
+                        "MATCH VECTOR (vec, [1.0, 2.0], 'float', 'ip', 10), FUSION('rrf') WHERE year > 2000;",
+                        parameters1);
+    ASSERT_TRUE(key1.has_value());
+    EXPECT_EQ(parameters1.match_exprs_.size(), 1u);
+    EXPECT_EQ(parameters1.knn_exprs_.size(), 1u);
+    EXPECT_TRUE(parameters1.match_tensor_exprs_.empty());
+
+    PlanParameters parameters2;
+    auto key2 = MakeKey("SELECT title FROM t1 SEARCH MATCH TEXT ('body', 'the star', 'topn=10'), "
+                        "MATCH VECTOR (vec, [3.0, 4.0], 'float', 'ip', 10), FUSION('rrf') WHERE year > 2000;",
+                        parameters2);
+    ASSERT_TRUE(key2.has_value());
+    EXPECT_EQ(*key1, *key2);
+
+    // everything else is part of the key
+    PlanParameters parameters3;
+    auto key3 = MakeKey("SELECT title FROM t1 SEARCH MATCH TEXT ('body', 'dune frank', 'topn=10'), "
+                        "MATCH VECTOR (vec, [1.0, 2.0], 'float', 'ip', 10), FUSION('rrf') WHERE year > 2001;",
+                        parameters3);
+    ASSERT_TRUE(key3.has_value());
+    EXPECT_NE(*key1, *key3);
+
+    PlanParameters parameters4;
+    auto key4 = MakeKey("SELECT title FROM t1 SEARCH MATCH TEXT ('body', 'dune frank', 'topn=10'), "
+                        "MATCH VECTOR (vec, [1.0, 2.0, 3.0], 'float', 'ip', 10), FUSION('rrf') WHERE year > 2000;",
+                        parameters4);
+    ASSERT_TRUE(key4.has_value());
+    EXPECT_NE(*key1, *key4);
+
+    // the string '2000' is not the integer 2000
+    PlanParameters parameters5;
+    auto key5 = MakeKey("SELECT title FROM t1 SEARCH MATCH TEXT ('body', 'dune frank', 'topn=10'), "
+                        "MATCH VECTOR (vec, [1.0, 2.0], 'float', 'ip', 10), FUSION('rrf') WHERE year > '2000';",
+                        parameters5);
+    ASSERT_TRUE(key5.has_value());
+    EXPECT_NE(*key1, *key5);
+}
+
+TEST_F(PlanCacheTest, NotCacheable) {
+    PlanParameters parameters;
+    EXPECT_FALSE(MakeKey("SELECT title FROM t1 WHERE year > 2000;", parameters).has_value());
+    EXPECT_FALSE(MakeKey("SELECT title FROM t1 SEARCH MATCH VECTOR (vec, [1.0, 2.0], 'float', 'ip', 10) ORDER BY year;", parameters).has_value());
+    EXPECT_FALSE(MakeKey("CREATE TABLE t2 (c1 INT);", parameters).has_value());
+    EXPECT_TRUE(parameters.knn_exprs_.empty());
+}
+
+TEST_F(PlanCacheTest, TakePut) {
+    PlanCache cache(2);
+    EXPECT_EQ(cache.Take("q1", 10, 5), nullptr);
+
+    auto plan = MakeUnique<CachedPlan>();
+    plan->schema_version_ = 5;
+    cache.Put("q1", std::move(plan));
+    EXPECT_EQ(cache.size(), 1u);
+
+    // the plan is used by one query at a time
+    auto taken = cache.Take("q1", 10, 5);
+    ASSERT_NE(taken, nullptr);
+    EXPECT_EQ(cache.Take("q1", 10, 5), nullptr);
+    cache.Put("q1", std::move(taken));
+
+    // a transaction started before the schema change can't use it
+    EXPECT_EQ(cache.Take("q1", 5, 5), nullptr);
+    EXPECT_EQ(cache.size(), 0u);
+
+    // the schema changed since the plan was bound
+    plan = MakeUnique<CachedPlan>();
+    plan->schema_version_ = 5;
+    cache.Put("q1", std::move(plan));
+    EXPECT_EQ(cache.Take("q1", 10, 6), nullptr);
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.hit_count(), 1u);
+}
+
+TEST_F(PlanCacheTest, Evict) {
+    PlanCache cache(2);
+    cache.Put("q1", MakeUnique<CachedPlan>());
+    cache.Put("q2", MakeUnique<CachedPlan>());
+    auto plan = cache.Take("q1", 10, 0);
+    ASSERT_NE(plan, nullptr);
+    cache.Put("q1", std::move(plan));
+    // q2 is the least recently used one
+    cache.Put("q3", MakeUnique<CachedPlan>());
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.Take("q2", 10, 0), nullptr);
+    EXPECT_NE(cache.Take("q1", 10, 0), nullptr);
+    EXPECT_NE(cache.Take("q3", 10, 0), nullptr);
+}
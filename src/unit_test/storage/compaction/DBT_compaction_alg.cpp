@@ -504,3 +504,86 @@ TEST_F(DBTCompactionTest, RollbackTest) {
         }
     }
 }
+
+TEST_F(DBTCompactionTest, RewriteScore) {
+    CompactionCostModel cost_model;
+    cost_model.min_deleted_rows_ = 1;
+
+    EXPECT_EQ(cost_model.RewriteScore(0, 0, 0, 0), 0);
+    EXPECT_EQ(cost_model.RewriteScore(100, 100, 0, 0), 0);
+    // below min_delete_ratio_
+    EXPECT_EQ(cost_model.RewriteScore(100, 90, 0, 0), 0);
+    // 60 deleted rows against 40 copied rows
+    EXPECT_DOUBLE_EQ(cost_model.RewriteScore(100, 40, 0, 0), 1.5);
+    // and an index rebuilt on them
+    EXPECT_DOUBLE_EQ(cost_model.RewriteScore(100, 40, 1, 0), 0.5);
+    // and 15 queries read the segment
+    EXPECT_DOUBLE_EQ(cost_model.RewriteScore(100, 40, 1, 15), 1.5);
+    EXPECT_GT(cost_model.RewriteScore(100, 0, 2, 0), 1);
+
+    cost_model.min_deleted_rows_ = 100;
+    EXPECT_EQ(cost_model.RewriteScore(100, 40, 0, 0), 0);
+}
+
+TEST_F(DBTCompactionTest, RewriteDeletedSegment) {
+    TransactionID txn_id = 0;
+
+    int m = 3;
+    int c = 3;
+    int s = 1;
+    CompactionCostModel cost_model;
+    cost_model.min_deleted_rows_ = 1;
+    DBTCompactionAlg DBTCompact(m, c, s, MockSegmentEntry::segment_capacity, nullptr, cost_model);
+    DBTCompact.Enable(Vector<SegmentEntry *>{});
+
+    Vector<SharedPtr<SegmentEntry>> segment_entries; // hold lifetime
+    auto cold_segment = MockSegmentEntry::Make(10);
+    auto hot_segment = MockSegmentEntry::Make(10);
+    segment_entries.emplace_back(cold_segment);
+    segment_entries.emplace_back(hot_segment);
+    DBTCompact.AddSegment(cold_segment.get());
+    DBTCompact.AddSegment(hot_segment.get());
+    EXPECT_TRUE(DBTCompact.CheckCompaction(++txn_id).empty());
+
+    // 3 deleted rows cost less than copying 7 rows
+    cold_segment->ShrinkSegment(3);
+    DBTCompact.DeleteInSegment(cold_segment->segment_id());
+    EXPECT_TRUE(DBTCompact.CheckCompaction(++txn_id).empty());
+
+    // 4 deleted rows against 6 copied rows, but the segment is read by 15 queries
+    hot_segment->ShrinkSegment(4);
+    DBTCompact.DeleteInSegment(hot_segment->segment_id());
+    EXPECT_TRUE(DBTCompact.CheckCompaction(++txn_id).empty());
+    for (int i = 0; i < 15; ++i) {
+        hot_segment->IncreaseAccessCount();
+    }
+    {
+        auto segments = DBTCompact.CheckCompaction(++txn_id);
+        ASSERT_EQ(segments.size(), 1u);
+        EXPECT_EQ(segments[0], hot_segment.get());
+        DBTCompact.RollbackCompact(txn_id);
+    }
+    {
+        auto segments = DBTCompact.CheckCompaction(++txn_id);
+        ASSERT_EQ(segments.size(), 1u);
+        EXPECT_EQ(segments[0], hot_segment.get());
+        auto compacted_segments = MockSegmentEntry::MockCompact(segments);
+        ASSERT_EQ(compacted_segments.size(), 1u);
+        segment_entries.insert(segment_entries.end(), compacted_segments.begin(), compacted_segments.end());
+        EXPECT_EQ(compacted_segments[0]->actual_row_count(), 6u);
+
+        DBTCompact.CommitCompact(txn_id);
+        DBTCompact.AddSegment(compacted_segments[0].get());
+        EXPECT_TRUE(DBTCompact.CheckCompaction(++txn_id).empty());
+    }
+
+    // most rows of the cold segment are deleted
+    cold_segment->ShrinkSegment(5);
+    DBTCompact.DeleteInSegment(cold_segment->segment_id());
+    {
+        auto segments = DBTCompact.CheckCompaction(++txn_id);
+        ASSERT_EQ(segments.size(), 1u);
+        EXPECT_EQ(segments[0], cold_segment.get());
+        DBTCompact.CommitCompact(txn_id);
+    }
+}
@@ -0,0 +1,51 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <chrono>
+
+import stl;
+import compaction_rate_limiter;
+
+using namespace infinity;
+
+class CompactionRateLimiterTest : public BaseTest {};
+
+TEST_F(CompactionRateLimiterTest, acquire) {
+    CompactionRateLimiter unlimited(0);
+    EXPECT_EQ(unlimited.Acquire(1024lu * 1024lu * 1024lu), 0);
+
+    constexpr SizeT rate = 1000 * 1000; // 1MB/s
+    CompactionRateLimiter rate_limiter(rate);
+    // the first second is in the bucket
+    EXPECT_EQ(rate_limiter.Acquire(rate), 0);
+    // then each acquire waits for its bytes
+    auto begin = std::chrono::steady_clock::now();
+    i64 wait_us = rate_limiter.Acquire(rate / 10);
+    wait_us += rate_limiter.Acquire(rate / 10);
+    auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+    EXPECT_GE(wait_us, 150'000);
+    EXPECT_LE(wait_us, 200'000);
+    EXPECT_GE(elapsed_us, wait_us);
+
+    // the charged bytes are waited off later
+    rate_limiter.Charge(rate / 10);
+    wait_us = rate_limiter.Wait();
+    EXPECT_GE(wait_us, 50'000);
+    EXPECT_LE(wait_us, 100'000);
+
+    rate_limiter.SetRate(0);
+    EXPECT_EQ(rate_limiter.Acquire(rate), 0);
+    EXPECT_EQ(rate_limiter.rate(), 0u);
+}
@@ -34,6 +34,8 @@ import embedding_info;
 import array_info;
 import knn_expr;
 import data_type;
+import selection;
+import column_vector;
 
 class DataBlockTest : public BaseTest {
     void SetUp() override {
@@ -312,3 +314,77 @@ TEST_F(DataBlockTest, ReadWrite) {
     EXPECT_NE(data_block2, nullptr);
     EXPECT_EQ(data_block == *data_block2, true);
 }
+
+TEST_F(DataBlockTest, Selection) {
+    using namespace infinity;
+
+    Vector<SharedPtr<DataType>> column_types;
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kInteger));
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kBigInt));
+
+    SizeT row_count = 100;
+    auto make_input = [&]() {
+        auto data_block = DataBlock::MakeUniquePtr();
+        data_block->Init(column_types);
+        for (SizeT i = 0; i < row_count; ++i) {
+            data_block->AppendValue(0, Value::MakeInt(static_cast<i32>(i)));
+            data_block->AppendValue(1, Value::MakeBigInt(static_cast<i64>(i) * 10));
+        }
+        data_block->Finalize();
+        // rows 10..29 and every 7th row after
+        auto selection = MakeShared<Selection>();
+        selection->Initialize(row_count);
+        for (SizeT i = 0; i < row_count; ++i) {
+            if ((i >= 10 && i < 30) || (i >= 30 && i % 7 == 0)) {
+                selection->Append(i);
+            }
+        }
+        data_block->SetSelection(selection);
+        return data_block;
+    };
+    Vector<i32> expected;
+    for (SizeT i = 0; i < row_count; ++i) {
+        if ((i >= 10 && i < 30) || (i >= 30 && i % 7 == 0)) {
+            expected.push_back(static_cast<i32>(i));
+        }
+    }
+
+    {
+        auto data_block = make_input();
+        EXPECT_TRUE(data_block->HasSelection());
+        EXPECT_EQ(data_block->row_count(), expected.size());
+
+        // append a window of the selected rows
+        DataBlock output;
+        output.Init(column_types);
+        output.AppendWith(data_block.get(), 5, 20);
+        output.Finalize();
+        EXPECT_EQ(output.row_count(), 20u);
+        for (SizeT i = 0; i < 20; ++i) {
+            EXPECT_EQ(output.GetValue(0, i).value_.integer, expected[i + 5]);
+            EXPECT_EQ(output.GetValue(1, i).value_.big_int, static_cast<i64>(expected[i + 5]) * 10);
+        }
+    }
+    {
+        auto data_block = make_input();
+        data_block->Materialize();
+        EXPECT_FALSE(data_block->HasSelection());
+        EXPECT_EQ(data_block->row_count(), expected.size());
+        for (SizeT i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(data_block->GetValue(0, i).value_.integer, expected[i]);
+            EXPECT_EQ(data_block->GetValue(1, i).value_.big_int, static_cast<i64>(expected[i]) * 10);
+        }
+    }
+    {
+        // only the used column is copied
+        auto data_block = make_input();
+        data_block->Materialize(Vector<bool>{false, true});
+        EXPECT_FALSE(data_block->HasSelection());
+        EXPECT_EQ(data_block->row_count(), expected.size());
+        EXPECT_EQ(data_block->column_vectors[0]->Size(), row_count);
+        EXPECT_EQ(data_block->column_vectors[1]->Size(), expected.size());
+        for (SizeT i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(data_block->GetValue(1, i).value_.big_int, static_cast<i64>(expected[i]) * 10);
+        }
+    }
+}
@@ -1,4 +1,5 @@
 #include "unit_test/base_test.h"
+#include <cmath>
 
 import stl;
 import logical_type;
@@ -39,6 +40,8 @@ import global_resource_usage;
 import term_doc_iterator;
 import logger;
 import column_index_reader;
+import early_terminate_iterator;
+import bm25_ranker;
 
 using namespace infinity;
 
@@ -65,10 +68,13 @@ protected:
 
     void CreateDBAndTable(const String& db_name, const String& table_name);
 
-    void CreateIndex(const String &db_name, const String &table_name, const String &index_name, const String &analyzer);
+    void CreateIndex(const String &db_name, const String &table_name, const String &index_name, const String &analyzer, const String &column_name = "text");
 
     void InsertData(const String& db_name, const String& table_name);
 
+    // the scores of the ordinary and the early terminate iterators of the same query
+    void QueryScores(const String &fields, const String &match_text, Map<u64, float> &ordinary_scores, Map<u64, float> &early_terminate_scores);
+
     void QueryMatch(const String& db_name,
                     const String& table_name,
                     const String& index_name,
@@ -147,6 +153,91 @@ TEST_F(QueryMatchTest, basic_term) {
     }
 }
 
+TEST_F(QueryMatchTest, multi_field_bm25f) {
+    CreateDBAndTable(db_name_, table_name_);
+    CreateIndex(db_name_, table_name_, index_name_, "standard");
+    CreateIndex(db_name_, table_name_, "test_title_index", "standard", "title");
+    InsertData(db_name_, table_name_);
+    // "animalia" and "academy" are in both the title and the text of a document, "harmful" only in the texts of two
+    Vector<String> fields_list = {"title^2,text", "title,text^3"};
+    for (const auto &fields : fields_list) {
+        Map<u64, float> ordinary_scores;
+        Map<u64, float> early_terminate_scores;
+        QueryScores(fields, "animalia academy harmful", ordinary_scores, early_terminate_scores);
+        EXPECT_EQ(ordinary_scores.size(), 3u);
+        ASSERT_EQ(ordinary_scores.size(), early_terminate_scores.size());
+        for (const auto &[row_id, score] : ordinary_scores) {
+            ASSERT_TRUE(early_terminate_scores.contains(row_id));
+            EXPECT_GT(score, 0.0f);
+            EXPECT_NEAR(score, early_terminate_scores[row_id], 1e-4f * score);
+        }
+    }
+}
+
+class BM25RankerTest : public BaseTest {};
+
+TEST_F(BM25RankerTest, bm25f) {
+    constexpr u64 total_df = 100;
+    // with one column of weight 1, BM25F is BM25
+    BM25Ranker bm25_ranker(total_df);
+    bm25_ranker.AddTermParam(3, 10, 20.0f, 30, 1.0f);
+    BM25FRanker one_column(total_df);
+    one_column.AddColumnDF(10);
+    one_column.AddColumnTF(3, 20.0f, 30, 1.0f);
+    EXPECT_NEAR(one_column.GetScore(), bm25_ranker.GetScore(), 1e-5f);
+
+    // tf' = 2 * 1 / (0.25 + 0.75 * 5 / 10) + 1 * 2 / (0.25 + 0.75 * 20 / 20) = 3.2 + 2 = 5.2
+    // the smallest idf is the one of df 20
+    BM25FRanker two_columns(total_df);
+    two_columns.AddColumnDF(10);
+    two_columns.AddColumnDF(20);
+    two_columns.AddColumnTF(1, 10.0f, 5, 2.0f);
+    two_columns.AddColumnTF(2, 20.0f, 20, 1.0f);
+    const float idf = std::log(1.0f + (total_df - 20 + 0.5f) / (20 + 0.5f));
+    const float combined_tf = 5.2f;
+    EXPECT_NEAR(two_columns.GetScore(), idf * 2.2f * combined_tf / (1.2f + combined_tf), 1e-4f);
+
+    // saturated once for all columns, less than one BM25 per column
+    BM25Ranker per_column(total_df);
+    per_column.AddTermParam(1, 10, 10.0f, 5, 2.0f);
+    per_column.AddTermParam(2, 20, 20.0f, 20, 1.0f);
+    EXPECT_LT(two_columns.GetScore(), per_column.GetScore());
+}
+
+void QueryMatchTest::QueryScores(const String &fields,
+                                 const String &match_text,
+                                 Map<u64, float> &ordinary_scores,
+                                 Map<u64, float> &early_terminate_scores) {
+    Storage *storage = InfinityContext::instance().storage();
+    TxnManager *txn_mgr = storage->txn_manager();
+    auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("query scores"));
+    auto [table_entry, status_table] = txn->GetTableByName(db_name_, table_name_);
+    EXPECT_TRUE(status_table.ok());
+    auto fake_table_ref = BaseTableRef::FakeTableRef(table_entry, txn);
+
+    QueryBuilder query_builder(fake_table_ref.get());
+    IndexReader index_reader = fake_table_ref->table_entry_ptr_->GetFullTextIndexReader(txn);
+    query_builder.Init(index_reader);
+    SearchDriver driver(query_builder.GetColumn2Analyzer(), "");
+    FullTextQueryContext full_text_query_context;
+    full_text_query_context.query_tree_ = driver.ParseSingleWithFields(fields, match_text);
+    ASSERT_NE(full_text_query_context.query_tree_, nullptr);
+
+    UniquePtr<DocIterator> doc_iterator = query_builder.CreateSearch(full_text_query_context);
+    ASSERT_NE(doc_iterator, nullptr);
+    doc_iterator->PrepareFirstDoc();
+    for (RowID row_id = doc_iterator->Doc(); row_id != INVALID_ROWID; row_id = doc_iterator->Next()) {
+        ordinary_scores[row_id.ToUint64()] = query_builder.Score(row_id);
+    }
+
+    UniquePtr<EarlyTerminateIterator> et_iter = query_builder.CreateEarlyTerminateSearch(full_text_query_context, EarlyTermAlgo::kBMW);
+    ASSERT_NE(et_iter, nullptr);
+    while (et_iter->Next()) {
+        early_terminate_scores[et_iter->DocID().ToUint64()] = et_iter->BM25Score();
+    }
+    txn_mgr->CommitTxn(txn);
+}
+
 void QueryMatchTest::CreateDBAndTable(const String& db_name, const String& table_name) {
     Vector<SharedPtr<ColumnDef>> column_defs;
     {
@@ -186,12 +277,12 @@ void QueryMatchTest::CreateDBAndTable(const String& db_name, const String& table
     }
 }
 
-void QueryMatchTest::CreateIndex(const String &db_name, const String &table_name, const String &index_name, const String &analyzer) {
+void QueryMatchTest::CreateIndex(const String &db_name, const String &table_name, const String &index_name, const String &analyzer, const String &column_name) {
     Storage *storage = InfinityContext::instance().storage();
 
     TxnManager *txn_mgr = storage->txn_manager();
 
-    Vector<String> col_name_list{"text"};
+    Vector<String> col_name_list{column_name};
     String index_file_name = index_name + ".json";
     {
         auto *txn_idx = txn_mgr->BeginTxn(MakeUnique<String>("create index"));
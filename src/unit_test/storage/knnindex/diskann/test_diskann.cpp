@@ -0,0 +1,161 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import third_party;
+import compilation_config;
+import index_base;
+import hnsw_common;
+import diskann_index;
+import file_system;
+import local_file_system;
+import file_system_type;
+import infinity_exception;
+
+using namespace infinity;
+
+class DiskAnnTest : public BaseTest {
+protected:
+    static constexpr SizeT dim_ = 32;
+    static constexpr SizeT row_n_ = 2000;
+    static constexpr SizeT query_n_ = 50;
+    static constexpr SizeT topk_ = 10;
+
+    void SetUp() override {
+        BaseTest::SetUp();
+        std::mt19937 rng(0);
+        std::normal_distribution<f32> dist;
+        data_.resize(row_n_ * dim_);
+        queries_.resize(query_n_ * dim_);
+        for (auto &v : data_) {
+            v = dist(rng);
+        }
+        for (auto &v : queries_) {
+            v = dist(rng);
+        }
+    }
+
+    // the exact top k of the rows accepted by the filter
+    Vector<SegmentOffset> GroundTruth(const f32 *query, bool odd_only) const {
+        Vector<Pair<f32, SegmentOffset>> dists;
+        for (SegmentOffset i = 0; i < row_n_; ++i) {
+            if (odd_only && i % 2 == 0) {
+                continue;
+            }
+            f32 dist = 0;
+            for (SizeT j = 0; j < dim_; ++j) {
+                f32 diff = query[j] - data_[i * dim_ + j];
+                dist += diff * diff;
+            }
+            dists.emplace_back(dist, i);
+        }
+        std::partial_sort(dists.begin(), dists.begin() + topk_, dists.end());
+        Vector<SegmentOffset> res;
+        for (SizeT i = 0; i < topk_; ++i) {
+            res.push_back(dists[i].second);
+        }
+        return res;
+    }
+
+    f32 Recall(const DiskAnnIndex &index, bool odd_only) const {
+        struct OddFilter final : public FilterBase<SegmentOffset> {
+            bool operator()(const SegmentOffset &label) const final { return label % 2 == 1; }
+        } odd_filter;
+        SizeT hit = 0;
+        for (SizeT query_i = 0; query_i < query_n_; ++query_i) {
+            const f32 *query = queries_.data() + query_i * dim_;
+            auto [result_n, dists, labels] = index.KnnSearch(query, topk_, DiskAnnSearchOption{}, odd_only ? &odd_filter : nullptr);
+            EXPECT_EQ(result_n, topk_);
+            Vector<SegmentOffset> gt = GroundTruth(query, odd_only);
+            for (SizeT i = 0; i < result_n; ++i) {
+                if (i > 0) {
+                    EXPECT_LE(dists[i - 1], dists[i]);
+                }
+                if (odd_only) {
+                    EXPECT_EQ(labels[i] % 2, 1u);
+                }
+                hit += std::find(gt.begin(), gt.end(), labels[i]) != gt.end();
+            }
+        }
+        return f32(hit) / (query_n_ * topk_);
+    }
+
+    Vector<f32> data_;
+    Vector<f32> queries_;
+};
+
+TEST_F(DiskAnnTest, test_build_save_load) {
+    String save_path = String(tmp_data_path()) + "/diskann_test1.index";
+    LocalFileSystem fs;
+    {
+        DiskAnnIndex index(dim_, MetricType::kMetricL2, 32, 64, 1.2, 8);
+        EXPECT_EQ(index.Build(DenseVectorIter<f32, SegmentOffset>(data_.data(), dim_, row_n_)), row_n_);
+        EXPECT_FALSE(index.on_disk());
+        EXPECT_GE(Recall(index, false), 0.9);
+
+        auto [file_handler, status] = fs.OpenFile(save_path, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kNoLock);
+        if (!status.ok()) {
+            UnrecoverableError(fmt::format("Failed to open file: {}", save_path));
+        }
+        index.Save(*file_handler);
+        file_handler->Close();
+        // the nodes are read from the file after Save
+        EXPECT_TRUE(index.on_disk());
+        EXPECT_GE(Recall(index, false), 0.9);
+    }
+    {
+        auto [file_handler, status] = fs.OpenFile(save_path, FileFlags::READ_FLAG, FileLockType::kNoLock);
+        if (!status.ok()) {
+            UnrecoverableError(fmt::format("Failed to open file: {}", save_path));
+        }
+        DiskAnnIndex index(dim_, MetricType::kMetricL2, 32, 64, 1.2, 8);
+        index.Load(*file_handler);
+        file_handler->Close();
+        EXPECT_EQ(index.row_count(), row_n_);
+        EXPECT_TRUE(index.on_disk());
+        EXPECT_GE(Recall(index, false), 0.9);
+        EXPECT_GE(Recall(index, true), 0.9);
+    }
+    fs.DeleteFile(save_path);
+}
+
+TEST_F(DiskAnnTest, test_build_on_base) {
+    String save_path = String(tmp_data_path()) + "/diskann_test2.index";
+    LocalFileSystem fs;
+    DiskAnnIndex base(dim_, MetricType::kMetricL2, 32, 64, 1.2, 8);
+    EXPECT_EQ(base.Build(DenseVectorIter<f32, SegmentOffset>(data_.data(), dim_, row_n_ / 2)), row_n_ / 2);
+    {
+        auto [file_handler, status] = fs.OpenFile(save_path, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kNoLock);
+        if (!status.ok()) {
+            UnrecoverableError(fmt::format("Failed to open file: {}", save_path));
+        }
+        base.Save(*file_handler);
+        file_handler->Close();
+    }
+    // the rows of the base are read from its file and keep their edges
+    DiskAnnIndex index(dim_, MetricType::kMetricL2, 32, 64, 1.2, 8);
+    EXPECT_EQ(index.Build(DenseVectorIter<f32, SegmentOffset>(data_.data(), dim_, row_n_), &base), row_n_);
+    EXPECT_GE(Recall(index, false), 0.9);
+    EXPECT_GE(Recall(index, true), 0.9);
+    fs.DeleteFile(save_path);
+}
+
+TEST_F(DiskAnnTest, test_empty) {
+    DiskAnnIndex index(dim_, MetricType::kMetricL2, 32, 64, 1.2, 8);
+    EXPECT_EQ(index.Build(DenseVectorIter<f32, SegmentOffset>(data_.data(), dim_, 0)), 0u);
+    auto [result_n, dists, labels] = index.KnnSearch(queries_.data(), topk_, DiskAnnSearchOption{});
+    EXPECT_EQ(result_n, 0u);
+}
@@ -0,0 +1,140 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import hnsw_alg;
+import data_store;
+import dist_func_l2;
+import vec_store_type;
+import hnsw_common;
+import file_system;
+import file_system_type;
+import local_file_system;
+import infinity_exception;
+
+using namespace infinity;
+
+class HnswDeleteTest : public BaseTest {
+public:
+    using LabelT = u64;
+    using Hnsw = KnnHnsw<PlainL2VecStoreType<float>, LabelT>;
+
+    const std::string save_dir_ = GetTmpDir();
+
+    static constexpr int dim_ = 16;
+    static constexpr int chunk_size_ = 128;
+    static constexpr int max_chunk_n_ = 20;
+
+    // the nearest of each live vector is itself, and no deleted label is ever returned
+    static void CheckSearch(const Hnsw &hnsw_index, const float *data, int element_size, const Vector<bool> &deleted) {
+        int correct = 0;
+        int live = 0;
+        for (int i = 0; i < element_size; ++i) {
+            auto result = hnsw_index.KnnSearchSorted(data + i * dim_, 10);
+            for (const auto &[_, label] : result) {
+                ASSERT_FALSE(deleted[label]);
+            }
+            if (deleted[i]) {
+                continue;
+            }
+            ++live;
+            if (!result.empty() && result[0].second == (LabelT)i) {
+                ++correct;
+            }
+        }
+        EXPECT_GE(float(correct) / live, 0.95);
+    }
+};
+
+TEST_F(HnswDeleteTest, mark_deleted_and_consolidate) {
+    int M = 8;
+    int ef_construction = 200;
+    int element_size = 10 * chunk_size_;
+    int total_size = 12 * chunk_size_;
+
+    std::mt19937 rng;
+    rng.seed(0);
+    std::uniform_real_distribution<float> distrib_real;
+    auto data = MakeUnique<float[]>(dim_ * total_size);
+    for (int i = 0; i < dim_ * total_size; ++i) {
+        data[i] = distrib_real(rng);
+    }
+
+    Hnsw hnsw_index = Hnsw::Make(chunk_size_, max_chunk_n_, dim_, M, ef_construction);
+    hnsw_index.InsertVecs(DenseVectorIter<float, LabelT>(data.get(), dim_, element_size));
+    hnsw_index.SetEf(20);
+
+    Vector<bool> deleted(total_size, false);
+    Vector<LabelT> deleted_labels;
+    for (int i = 0; i < element_size; i += 3) {
+        deleted_labels.push_back(i);
+    }
+    EXPECT_TRUE(hnsw_index.HasEdgeTo(deleted_labels));
+    EXPECT_FALSE(hnsw_index.AllDeleted(deleted_labels));
+    for (LabelT label : deleted_labels) {
+        EXPECT_TRUE(hnsw_index.MarkDeleted(label));
+        deleted[label] = true;
+    }
+    EXPECT_FALSE(hnsw_index.MarkDeleted(0));
+    EXPECT_FALSE(hnsw_index.MarkDeleted(total_size));
+    EXPECT_EQ(hnsw_index.GetDeletedNum(), SizeT(element_size + 2) / 3);
+    EXPECT_TRUE(hnsw_index.AllDeleted(deleted_labels));
+
+    // the tombstones are skipped before the graph is repaired
+    CheckSearch(hnsw_index, data.get(), element_size, deleted);
+
+    EXPECT_GT(hnsw_index.Consolidate(), 0u);
+    hnsw_index.Check();
+    CheckSearch(hnsw_index, data.get(), element_size, deleted);
+    // nothing points to a deleted vertex any more
+    EXPECT_FALSE(hnsw_index.HasEdgeTo(deleted_labels));
+    EXPECT_EQ(hnsw_index.Consolidate(), 0u);
+
+    // the tombstones are copied and saved with the graph
+    {
+        Hnsw hnsw_copy = hnsw_index.Copy();
+        hnsw_copy.Check();
+        EXPECT_EQ(hnsw_copy.GetDeletedNum(), hnsw_index.GetDeletedNum());
+        EXPECT_TRUE(hnsw_copy.AllDeleted(deleted_labels));
+        CheckSearch(hnsw_copy, data.get(), element_size, deleted);
+    }
+    {
+        LocalFileSystem fs;
+        {
+            auto [file_handler, status] =
+                fs.OpenFile(save_dir_ + "/test_hnsw_delete.bin", FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kNoLock);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            hnsw_index.Save(*file_handler);
+            file_handler->Close();
+        }
+        auto [file_handler, status] = fs.OpenFile(save_dir_ + "/test_hnsw_delete.bin", FileFlags::READ_FLAG, FileLockType::kNoLock);
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+        Hnsw hnsw_loaded = Hnsw::Load(*file_handler);
+        EXPECT_EQ(hnsw_loaded.GetDeletedNum(), hnsw_index.GetDeletedNum());
+        EXPECT_TRUE(hnsw_loaded.AllDeleted(deleted_labels));
+    }
+
+    // the repaired graph takes new vectors
+    auto iter = DenseVectorIter<float, LabelT>(data.get() + element_size * dim_, dim_, total_size - element_size, element_size);
+    hnsw_index.InsertVecs(std::move(iter));
+    hnsw_index.Check();
+    CheckSearch(hnsw_index, data.get(), total_size, deleted);
+}
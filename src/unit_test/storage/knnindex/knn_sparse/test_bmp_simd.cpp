@@ -18,6 +18,8 @@
 
 import bmp_simd_func;
 import stl;
+import bm_posting;
+import bmp_util;
 
 using namespace infinity;
 
@@ -66,3 +68,68 @@ TEST_F(BMPSIMDTest, test1) {
         test_func(i, 100);
     }
 }
+
+TEST_F(BMPSIMDTest, test_u8_scale_add) {
+    std::default_random_engine rng;
+    std::uniform_real_distribution<float> rdist(0, 1);
+    std::uniform_int_distribution<int> u8dist(0, 255);
+
+    for (SizeT dim = 1; dim <= 41; ++dim) {
+        Vector<u8> src(dim);
+        Vector<f32> dest(dim);
+        f32 scale = rdist(rng);
+        for (SizeT i = 0; i < dim; ++i) {
+            src[i] = u8dist(rng);
+            dest[i] = rdist(rng);
+        }
+        Vector<f32> groundtruth(dest);
+        for (SizeT i = 0; i < dim; ++i) {
+            groundtruth[i] += src[i] * scale;
+        }
+        U8ScaleAddF32(src.data(), scale, dest.data(), dim);
+        for (SizeT i = 0; i < dim; ++i) {
+            ASSERT_FLOAT_EQ(dest[i], groundtruth[i]);
+        }
+    }
+}
+
+TEST_F(BMPSIMDTest, test_quantized_upper_bound) {
+    std::default_random_engine rng;
+    std::uniform_real_distribution<float> rdist(0, 10);
+
+    // rising scores grow the scale on the way, the quantized upper bounds stay above the exact ones and close to them
+    SizeT block_num = 1000;
+    Vector<f32> max_scores(block_num);
+    BlockData<f32, BMPCompressType::kCompressed> compressed;
+    BlockData<f32, BMPCompressType::kRaw> raw;
+    for (SizeT block_id = 0; block_id < block_num; block_id += 2) {
+        max_scores[block_id] = rdist(rng) * block_id / block_num;
+        compressed.AddBlock(block_id, max_scores[block_id]);
+        raw.AddBlock(block_id, max_scores[block_id]);
+    }
+    f32 query_score = 0.5;
+    Vector<f32> compressed_ub(block_num, 0.0);
+    Vector<f32> raw_ub(block_num, 0.0);
+    compressed.Calculate(compressed_ub, query_score, 0, block_num / 2);
+    compressed.Calculate(compressed_ub, query_score, block_num / 2, block_num);
+    raw.Calculate(raw_ub, query_score);
+    for (SizeT block_id = 0; block_id < block_num; ++block_id) {
+        f32 exact = max_scores[block_id] * query_score;
+        EXPECT_GE(compressed_ub[block_id] * (1 + 1e-6), exact);
+        EXPECT_LE(compressed_ub[block_id], exact + 10 * query_score * 1.25 / 255 * 1.01);
+        EXPECT_FLOAT_EQ(raw_ub[block_id], compressed_ub[block_id]);
+    }
+
+    // a negative query weight sums the exact scores
+    query_score = -0.5;
+    std::fill(compressed_ub.begin(), compressed_ub.end(), 0.0);
+    std::fill(raw_ub.begin(), raw_ub.end(), 0.0);
+    compressed.Calculate(compressed_ub, query_score, 0, block_num / 2);
+    compressed.Calculate(compressed_ub, query_score, block_num / 2, block_num);
+    raw.Calculate(raw_ub, query_score);
+    for (SizeT block_id = 0; block_id < block_num; ++block_id) {
+        f32 exact = max_scores[block_id] * query_score;
+        EXPECT_FLOAT_EQ(compressed_ub[block_id], exact);
+        EXPECT_FLOAT_EQ(raw_ub[block_id], exact);
+    }
+}
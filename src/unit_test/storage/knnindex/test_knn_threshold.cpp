@@ -0,0 +1,109 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import merge_knn;
+import knn_result_handler;
+import internal_types;
+import hnsw_alg;
+import hnsw_common;
+import vec_store_type;
+import dist_func_l2;
+
+using namespace infinity;
+
+class KnnThresholdTest : public BaseTest {};
+
+TEST_F(KnnThresholdTest, SharedThreshold) {
+    KnnThreshold<f32, CompareMax> l2_threshold;
+    EXPECT_EQ(l2_threshold.Get(), std::numeric_limits<f32>::max());
+    l2_threshold.Update(4.0f);
+    l2_threshold.Update(6.0f);
+    EXPECT_EQ(l2_threshold.Get(), 4.0f);
+
+    KnnThreshold<f32, CompareMin> ip_threshold;
+    ip_threshold.Update(4.0f);
+    ip_threshold.Update(6.0f);
+    ip_threshold.Update(5.0f);
+    EXPECT_EQ(ip_threshold.Get(), 6.0f);
+}
+
+TEST_F(KnnThresholdTest, MergeWithThreshold) {
+    // the first task has found its top-2
+    MergeKnn<f32, CompareMax> task1(1, 2);
+    task1.Begin();
+    f32 dists1[] = {5.0f, 3.0f, 4.0f};
+    RowID row_ids1[] = {RowID(0, 0), RowID(0, 1), RowID(0, 2)};
+    task1.Search(0, dists1, row_ids1, 3);
+    EXPECT_EQ(task1.GetKthDistance(0), 4.0f);
+
+    // the second task only keeps the candidates better than it
+    MergeKnn<f32, CompareMax> task2(1, 2);
+    task2.Begin();
+    task2.UpdateThreshold(0, task1.GetKthDistance(0));
+    f32 dists2[] = {6.0f, 1.0f, 4.5f};
+    RowID row_ids2[] = {RowID(1, 0), RowID(1, 1), RowID(1, 2)};
+    task2.Search(0, dists2, row_ids2, 3);
+    task2.End();
+    EXPECT_EQ(task2.total_count(), 3);
+    ASSERT_EQ(task2.result_count(0), 1);
+    EXPECT_EQ(task2.GetDistancesByIdx(0)[0], 1.0f);
+    EXPECT_EQ(task2.GetIDsByIdx(0)[0], RowID(1, 1));
+
+    MergeKnn<f32, CompareMax> task3(1, 2);
+    task3.Begin();
+    task3.UpdateThreshold(0, task1.GetKthDistance(0));
+    task3.Search(0, dists2, row_ids2, 1);
+    task3.End();
+    EXPECT_EQ(task3.result_count(0), 0);
+}
+
+TEST_F(KnnThresholdTest, HnswDistBound) {
+    using Hnsw = KnnHnsw<PlainL2VecStoreType<f32>, u64>;
+    const SizeT dim = 16;
+    const SizeT element_size = 1024;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<f32> distrib_real;
+    auto data = MakeUnique<f32[]>(dim * element_size);
+    for (SizeT i = 0; i < dim * element_size; ++i) {
+        data[i] = distrib_real(rng);
+    }
+    auto hnsw_index = Hnsw::Make(element_size, 1, dim, 8, 200);
+    hnsw_index.InsertVecs(DenseVectorIter<f32, u64>(data.get(), dim, element_size));
+    hnsw_index.SetEf(50);
+
+    const f32 *query = data.get();
+    const SizeT topk = 10;
+    auto [result_n, d_ptr, l_ptr] = hnsw_index.KnnSearch(query, topk);
+    ASSERT_EQ(result_n, 50u);
+    Vector<f32> dists(d_ptr.get(), d_ptr.get() + result_n);
+    std::sort(dists.begin(), dists.end());
+
+    // as if other segments have found the top-3
+    const f32 dist_bound = dists[2];
+    auto [bound_n, bound_d_ptr, bound_l_ptr] = hnsw_index.KnnSearch(query, topk, dist_bound);
+    EXPECT_GE(bound_n, 1u);
+    EXPECT_LE(bound_n, 3u);
+    for (SizeT i = 0; i < bound_n; ++i) {
+        EXPECT_LE(bound_d_ptr[i], dist_bound);
+    }
+
+    // only the query vertex itself is within the bound, the search reaches it from wherever it enters layer 0
+    auto [nearest_n, nearest_d_ptr, nearest_l_ptr] = hnsw_index.KnnSearch(query, topk, dists[0]);
+    ASSERT_EQ(nearest_n, 1u);
+    EXPECT_EQ(nearest_l_ptr[0], 0u);
+}
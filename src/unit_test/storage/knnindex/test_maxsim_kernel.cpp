@@ -0,0 +1,105 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import maxsim_kernel;
+
+using namespace infinity;
+
+class MaxSimKernelTest : public BaseTest {};
+
+namespace {
+
+template <typename T>
+float MaxSimRef(const T *query, const T *target, u32 query_num, u32 target_num, u32 dim) {
+    float res = 0.0f;
+    for (u32 i = 0; i < query_num; ++i) {
+        float max_score = std::numeric_limits<float>::lowest();
+        for (u32 j = 0; j < target_num; ++j) {
+            float score = 0.0f;
+            for (u32 k = 0; k < dim; ++k) {
+                score += static_cast<float>(query[i * dim + k]) * static_cast<float>(target[j * dim + k]);
+            }
+            max_score = std::max(max_score, score);
+        }
+        res += max_score;
+    }
+    return res;
+}
+
+} // namespace
+
+TEST_F(MaxSimKernelTest, F32) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    const u32 dim = 67;
+    // both the tiled kernel and the GEMM path (with several target chunks)
+    for (const auto [query_num, target_num] : Vector<Pair<u32, u32>>{{1, 1}, {5, 9}, {33, 17}, {32, 2500}}) {
+        Vector<float> query(query_num * dim);
+        Vector<float> target(target_num * dim);
+        for (auto &v : query) {
+            v = dist(rng);
+        }
+        for (auto &v : target) {
+            v = dist(rng);
+        }
+        const float expected = MaxSimRef(query.data(), target.data(), query_num, target_num, dim);
+        const float result = MaxSimF32(query.data(), target.data(), query_num, target_num, dim);
+        EXPECT_NEAR(result, expected, 1e-3f * std::max(1.0f, std::abs(expected)));
+    }
+}
+
+TEST_F(MaxSimKernelTest, I8) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(-128, 127);
+    const u32 dim = 100;
+    const u32 query_num = 40;
+    const u32 target_num = 30;
+    Vector<i8> query(query_num * dim);
+    Vector<i8> target(target_num * dim);
+    for (auto &v : query) {
+        v = static_cast<i8>(dist(rng));
+    }
+    for (auto &v : target) {
+        v = static_cast<i8>(dist(rng));
+    }
+    EXPECT_EQ(MaxSimI8(query.data(), target.data(), query_num, target_num, dim),
+              MaxSimRef(query.data(), target.data(), query_num, target_num, dim));
+}
+
+TEST_F(MaxSimKernelTest, Bit) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    const u32 dim = 200;
+    const u32 bytes = dim / 8;
+    const u32 query_num = 7;
+    const u32 target_num = 13;
+    Vector<u8> query(query_num * bytes);
+    Vector<u8> target(target_num * bytes);
+    for (auto &v : query) {
+        v = static_cast<u8>(dist(rng));
+    }
+    for (auto &v : target) {
+        v = static_cast<u8>(dist(rng));
+    }
+    Vector<float> query_f(query_num * dim);
+    Vector<float> target_f(target_num * dim);
+    ExpandBitsToF32(query.data(), query_f.size(), query_f.data());
+    ExpandBitsToF32(target.data(), target_f.size(), target_f.data());
+    EXPECT_EQ(MaxSimBit(query.data(), target.data(), query_num, target_num, dim),
+              MaxSimRef(query_f.data(), target_f.data(), query_num, target_num, dim));
+}
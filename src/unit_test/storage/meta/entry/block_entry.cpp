@@ -42,8 +42,8 @@ TEST_F(BlockVersionTest, SaveAndLoad) {
     BlockVersion block_version(8192);
     block_version.created_.emplace_back(10, 3);
     block_version.created_.emplace_back(20, 6);
-    block_version.deleted_[2] = 30;
-    block_version.deleted_[5] = 40;
+    block_version.Delete(2, 30);
+    block_version.Delete(5, 40);
     String version_path = String(GetTmpDir()) + "/block_version_test";
     LocalFileSystem fs;
 
@@ -65,6 +65,71 @@ TEST_F(BlockVersionTest, SaveAndLoad) {
     }
 }
 
+TEST_F(BlockVersionTest, DeleteVisibility) {
+    BlockVersion block_version(8192);
+    block_version.created_.emplace_back(10, 100);
+    EXPECT_FALSE(block_version.HasDelete());
+    SizeT no_delete_cost = block_version.MemoryCost();
+
+    Vector<u64> visible;
+    block_version.GetVisibleMask(20, 100, visible);
+    ASSERT_EQ(visible.size(), 2u);
+    EXPECT_EQ(visible[0], ~u64(0));
+    EXPECT_EQ(visible[1], (u64(1) << 36) - 1);
+
+    block_version.Delete(3, 30);
+    block_version.Delete(70, 30);
+    block_version.Delete(5, 40);
+    EXPECT_TRUE(block_version.HasDelete());
+    // the bitmap, and the timestamps of the two words with a deleted row
+    EXPECT_EQ(block_version.MemoryCost(), no_delete_cost + 128 * (sizeof(u64) + sizeof(void *)) + 2 * 64 * sizeof(TxnTimeStamp));
+    EXPECT_EQ(block_version.GetDeleteTS(3), 30u);
+    EXPECT_EQ(block_version.GetDeleteTS(5), 40u);
+    EXPECT_EQ(block_version.GetDeleteTS(4), 0u);
+
+    EXPECT_FALSE(block_version.IsDeleted(3, 20));
+    EXPECT_TRUE(block_version.IsDeleted(3, 30));
+    EXPECT_FALSE(block_version.IsDeleted(5, 35));
+    EXPECT_TRUE(block_version.IsDeleted(5, 50));
+
+    block_version.GetVisibleMask(35, 100, visible);
+    EXPECT_EQ(visible[0], ~u64(0) & ~(u64(1) << 3));
+    EXPECT_EQ(visible[1], ((u64(1) << 36) - 1) & ~(u64(1) << 6));
+
+    block_version.GetVisibleMask(50, 100, visible);
+    EXPECT_EQ(visible[0], ~u64(0) & ~(u64(1) << 3) & ~(u64(1) << 5));
+}
+
+TEST_F(BlockVersionTest, DeleteOutOfCommitOrder) {
+    BlockVersion block_version(8192);
+    block_version.created_.emplace_back(10, 200);
+    block_version.Delete(1, 30);
+    block_version.Delete(130, 50);
+    block_version.Delete(2, 30);
+    // an older commit after a newer one
+    block_version.Delete(64, 40);
+    block_version.Delete(3, 20);
+
+    EXPECT_EQ(block_version.GetDeleteTS(1), 30u);
+    EXPECT_EQ(block_version.GetDeleteTS(2), 30u);
+    EXPECT_EQ(block_version.GetDeleteTS(3), 20u);
+    EXPECT_EQ(block_version.GetDeleteTS(64), 40u);
+    EXPECT_EQ(block_version.GetDeleteTS(130), 50u);
+
+    EXPECT_TRUE(block_version.IsDeleted(3, 25));
+    EXPECT_FALSE(block_version.IsDeleted(1, 25));
+    EXPECT_TRUE(block_version.IsDeleted(64, 45));
+    EXPECT_FALSE(block_version.IsDeleted(130, 45));
+
+    Vector<u64> visible;
+    block_version.GetVisibleMask(35, 200, visible);
+    ASSERT_EQ(visible.size(), 4u);
+    EXPECT_EQ(visible[0], ~u64(0) & ~(u64(1) << 1) & ~(u64(1) << 2) & ~(u64(1) << 3));
+    EXPECT_EQ(visible[1], ~u64(0));
+    EXPECT_EQ(visible[2], ~u64(0));
+    EXPECT_EQ(visible[3], (u64(1) << 8) - 1);
+}
+
 TEST_F(BlockVersionTest, SaveAndLoad2) {
     auto data_dir = MakeShared<String>(String(GetTmpDir()) + "/block_version_test");
     auto temp_dir = MakeShared<String>(String(GetTmpDir()) + "/temp/block_version_test");
@@ -83,8 +148,8 @@ TEST_F(BlockVersionTest, SaveAndLoad2) {
 
             block_version->created_.emplace_back(10, 3);
             block_version->created_.emplace_back(20, 6);
-            block_version->deleted_[2] = 30;
-            block_version->deleted_[5] = 40;
+            block_version->Delete(2, 30);
+            block_version->Delete(5, 40);
         }
         {
             auto *file_worker = static_cast<VersionFileWorker *>(buffer_obj->file_worker());
@@ -109,8 +174,8 @@ TEST_F(BlockVersionTest, SaveAndLoad2) {
             }
             auto *block_version = static_cast<BlockVersion *>(block_version_handle.GetDataMut());
             block_version->created_.emplace_back(20, 6);
-            block_version->deleted_[2] = 30;
-            block_version->deleted_[5] = 40;
+            block_version->Delete(2, 30);
+            block_version->Delete(5, 40);
         }
         {
             auto *file_worker = static_cast<VersionFileWorker *>(buffer_obj->file_worker());
@@ -128,7 +193,7 @@ TEST_F(BlockVersionTest, SaveAndLoad2) {
             BlockVersion block_version1(8192);
             block_version1.created_.emplace_back(10, 3);
             block_version1.created_.emplace_back(20, 6);
-            block_version1.deleted_[2] = 30;
+            block_version1.Delete(2, 30);
 
             auto block_version_handle = buffer_obj->Load();
             const auto *block_version = static_cast<const BlockVersion *>(block_version_handle.GetData());
@@ -0,0 +1,78 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import bitmask;
+import common_query_filter_cache;
+
+using namespace infinity;
+
+class CommonQueryFilterCacheTest : public BaseTest {};
+
+TEST_F(CommonQueryFilterCacheTest, GetPut) {
+    CommonQueryFilterCache cache(1024 * 1024);
+    std::variant<Vector<u32>, Bitmask> result;
+    EXPECT_FALSE(cache.Get("t1#(c1 > 1)", 0, 100, result));
+
+    cache.Put("t1#(c1 > 1)", 0, 100, Vector<u32>{1, 3, 5});
+    Bitmask bitmask;
+    bitmask.Initialize(128);
+    bitmask.SetFalse(7);
+    cache.Put("t1#(c1 > 1)", 1, 128, std::variant<Vector<u32>, Bitmask>(std::move(bitmask)));
+
+    EXPECT_TRUE(cache.Get("t1#(c1 > 1)", 0, 100, result));
+    EXPECT_EQ(std::get<Vector<u32>>(result), (Vector<u32>{1, 3, 5}));
+    EXPECT_TRUE(cache.Get("t1#(c1 > 1)", 1, 128, result));
+    const auto &cached_mask = std::get<Bitmask>(result);
+    EXPECT_EQ(cached_mask.count(), 128u);
+    EXPECT_FALSE(cached_mask.IsTrue(7));
+    EXPECT_TRUE(cached_mask.IsTrue(8));
+
+    // other filters and other segments don't hit
+    EXPECT_FALSE(cache.Get("t1#(c1 > 2)", 0, 100, result));
+    EXPECT_FALSE(cache.Get("t1#(c1 > 1)", 2, 100, result));
+    EXPECT_EQ(cache.hit_count(), 2u);
+}
+
+TEST_F(CommonQueryFilterCacheTest, RowCountChanged) {
+    CommonQueryFilterCache cache(1024 * 1024);
+    std::variant<Vector<u32>, Bitmask> result;
+    cache.Put("t1#(c1 > 1)", 0, 100, Vector<u32>{1, 3, 5});
+    EXPECT_FALSE(cache.Get("t1#(c1 > 1)", 0, 200, result));
+    // the stale entry is dropped
+    EXPECT_EQ(cache.memory_usage(), 0u);
+    EXPECT_FALSE(cache.Get("t1#(c1 > 1)", 0, 100, result));
+}
+
+TEST_F(CommonQueryFilterCacheTest, Evict) {
+    // room for two results of 64 rows
+    CommonQueryFilterCache cache(2 * (64 * sizeof(u32) + 16));
+    Vector<u32> rows(64);
+    std::variant<Vector<u32>, Bitmask> result;
+    cache.Put("t1#f", 0, 64, rows);
+    cache.Put("t1#f", 1, 64, rows);
+    EXPECT_TRUE(cache.Get("t1#f", 0, 64, result));
+    // segment 1 is the least recently used one
+    cache.Put("t1#f", 2, 64, rows);
+    EXPECT_TRUE(cache.Get("t1#f", 0, 64, result));
+    EXPECT_FALSE(cache.Get("t1#f", 1, 64, result));
+    EXPECT_TRUE(cache.Get("t1#f", 2, 64, result));
+    EXPECT_LE(cache.memory_usage(), 2 * (64 * sizeof(u32) + 16));
+
+    cache.Clear();
+    EXPECT_EQ(cache.memory_usage(), 0u);
+    EXPECT_FALSE(cache.Get("t1#f", 0, 64, result));
+}